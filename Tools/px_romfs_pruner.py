@@ -38,7 +38,9 @@ px_romfs_pruner.py:
 Try to keep size of the ROMFS minimal.
 
 This script goes through the temporarily copied ROMFS data and deletes all
-comments, empty lines and unnecessary whitespace.
+comments, empty lines and unnecessary whitespace. Consecutive
+"param set-default" lines are coalesced into multi-pair invocations to cut
+down the number of commands nsh spawns while sourcing airframe configs.
 It also deletes hidden files such as auto-saved backups that a text editor
 might have left in the tree.
 
@@ -51,6 +53,53 @@ import re
 import os
 import io
 
+# nsh limits for a coalesced "param set-default" line: total argument count
+# is bounded by CONFIG_NSH_MAXARGUMENTS (15 on our boards), the line by
+# CONFIG_NSH_LINELEN (128). Stay below both.
+PARAM_COALESCE_MAX_PAIRS = 6
+PARAM_COALESCE_MAX_LINELEN = 120
+
+PARAM_SET_DEFAULT_RE = re.compile(r"^param set-default (-s )?(\S+ \S+)$")
+
+
+def coalesce_param_defaults(lines):
+    """Merge runs of consecutive "param set-default" lines into multi-pair
+    invocations, so that sourcing an airframe config spawns one param
+    command instead of one per parameter."""
+    result = []
+    pending_silent = None
+    pending_pairs = []
+
+    def flush():
+        if pending_pairs:
+            result.append("param set-default " + pending_silent +
+                          " ".join(pending_pairs))
+            del pending_pairs[:]
+
+    for line in lines:
+        match = PARAM_SET_DEFAULT_RE.match(line)
+
+        if not match:
+            flush()
+            result.append(line)
+            continue
+
+        silent = match.group(1) or ""
+        pair = match.group(2)
+        merged_len = len("param set-default " + silent +
+                         " ".join(pending_pairs + [pair]))
+
+        if pending_pairs and (silent != pending_silent or
+                              len(pending_pairs) >= PARAM_COALESCE_MAX_PAIRS or
+                              merged_len > PARAM_COALESCE_MAX_LINELEN):
+            flush()
+
+        pending_silent = silent
+        pending_pairs.append(pair)
+
+    flush()
+    return result
+
 
 def main():
     # Parse commandline arguments
@@ -90,7 +139,7 @@ def main():
                 continue
 
             # read file line by line
-            pruned_content = ""
+            pruned_lines = []
             board_excluded = False
 
             with io.open(file_path, "r", newline=None) as f:
@@ -108,10 +157,15 @@ def main():
 
                     if not line.isspace() \
                             and not line.strip().startswith("#"):
-                        pruned_content += line.strip() + "\n"
+                        pruned_lines.append(line.strip())
             # delete the file if it doesn't contain the architecture
             # write out the pruned content else
             if not board_excluded:
+                pruned_content = "\n".join(coalesce_param_defaults(pruned_lines))
+
+                if pruned_content:
+                    pruned_content += "\n"
+
                 # overwrite old scratch file
                 with open(file_path, "wb") as f:
                     pruned_content = re.sub("\r\n", "\n", pruned_content)
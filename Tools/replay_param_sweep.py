@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+
+"""
+Run an EKF2 replay parameter sweep: replay the same ULog file N times in
+parallel, each run with a different set of parameter overrides, and collect the
+per-run estimator output logs.
+
+Each line of the sweep file describes one run as space-separated PARAM=VALUE
+pairs (empty lines and lines starting with '#' are ignored), e.g.:
+
+    EKF2_GYR_NOISE=0.01 EKF2_ACC_NOISE=0.30
+    EKF2_GYR_NOISE=0.02 EKF2_ACC_NOISE=0.30
+    EKF2_GYR_NOISE=0.02 EKF2_ACC_NOISE=0.35
+
+Requires a SITL build with replay enabled, e.g.:
+
+    replay=<log file> make px4_sitl_default
+
+Each worker is a separate PX4 process with its own working directory below
+<build dir>/replay_sweep/, so the runs don't share parameter or logger state.
+The first run also builds the <log file>.index sidecar (see the replay module);
+it is started alone so the remaining runs can reuse the index, and the log file
+itself is only read from disk once thanks to the page cache.
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+
+def parse_sweep_file(file_name):
+    """ parse the sweep file into a list of {param: value_string} dicts """
+    runs = []
+    with open(file_name) as f:
+        for line_nr, line in enumerate(f, start=1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            overrides = {}
+            for token in line.split():
+                if '=' not in token:
+                    print("{:}:{:}: expected PARAM=VALUE, got '{:}'".format(
+                        file_name, line_nr, token))
+                    sys.exit(1)
+                name, value = token.split('=', 1)
+                overrides[name] = value
+            runs.append(overrides)
+    return runs
+
+
+def setup_run_directory(sweep_dir, run_nr, overrides):
+    """ create the working directory for one run and write its parameter
+        overrides (applied by the replay module on top of the log's parameters)
+    """
+    run_dir = os.path.join(sweep_dir, 'run_{:03}'.format(run_nr))
+    if os.path.isdir(run_dir):
+        shutil.rmtree(run_dir)
+    os.makedirs(run_dir)
+    with open(os.path.join(run_dir, 'replay_params.txt'), 'w') as f:
+        for name, value in overrides.items():
+            f.write('{:} {:}\n'.format(name, value))
+    return run_dir
+
+
+def start_run(px4_bin, build_dir, run_dir, log_file):
+    """ start one PX4 replay process and return the Popen handle """
+    env = dict(os.environ)
+    env['replay'] = log_file
+    env['replay_mode'] = 'ekf2'
+    with open(os.path.join(run_dir, 'console.log'), 'w') as console:
+        return subprocess.Popen(
+            [px4_bin, '-d', os.path.join(build_dir, 'etc')],
+            cwd=run_dir, env=env, stdin=subprocess.DEVNULL,
+            stdout=console, stderr=subprocess.STDOUT)
+
+
+def output_log(run_dir):
+    """ find the estimator output log written by a finished run """
+    log_root = os.path.join(run_dir, 'log')
+    ulg_files = []
+    for session_dir, _, files in os.walk(log_root):
+        ulg_files += [os.path.join(session_dir, f)
+                      for f in files if f.endswith('.ulg')]
+    return sorted(ulg_files)[-1] if ulg_files else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('log_file', help='ULog file to replay')
+    parser.add_argument('sweep_file',
+                        help='sweep description, one run per line as PARAM=VALUE pairs')
+    parser.add_argument('--build-dir', default='build/px4_sitl_default',
+                        help='SITL build directory (default: %(default)s)')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(),
+                        help='number of parallel runs (default: number of CPUs)')
+    args = parser.parse_args()
+
+    log_file = os.path.abspath(args.log_file)
+    if not os.path.isfile(log_file):
+        print("Log file {:} not found".format(log_file))
+        sys.exit(1)
+
+    px4_bin = os.path.join(os.path.abspath(args.build_dir), 'bin', 'px4')
+    if not os.path.isfile(px4_bin):
+        print("PX4 binary {:} not found (build with 'make px4_sitl_default' first)"
+              .format(px4_bin))
+        sys.exit(1)
+
+    runs = parse_sweep_file(args.sweep_file)
+    if not runs:
+        print("No runs defined in {:}".format(args.sweep_file))
+        sys.exit(1)
+
+    sweep_dir = os.path.join(os.path.abspath(args.build_dir), 'replay_sweep')
+    run_dirs = [setup_run_directory(sweep_dir, run_nr, overrides)
+                for run_nr, overrides in enumerate(runs)]
+
+    print("Replaying {:} with {:} parameter sets, {:} in parallel".format(
+        log_file, len(runs), args.jobs))
+
+    # run the first replay alone: it builds the log's message index sidecar,
+    # which all later runs then load instead of re-scanning the log
+    if not os.path.isfile(log_file + '.index'):
+        print("[run_000] building message index...")
+        if start_run(px4_bin, args.build_dir, run_dirs[0], log_file).wait() != 0:
+            print("run_000 failed, see {:}".format(
+                os.path.join(run_dirs[0], 'console.log')))
+            sys.exit(1)
+        pending = list(enumerate(run_dirs))[1:]
+    else:
+        pending = list(enumerate(run_dirs))
+
+    active = {}  # Popen -> (run_nr, run_dir)
+    num_failed = 0
+    while pending or active:
+        while pending and len(active) < args.jobs:
+            run_nr, run_dir = pending.pop(0)
+            print("[run_{:03}] starting".format(run_nr))
+            active[start_run(px4_bin, args.build_dir, run_dir, log_file)] = \
+                (run_nr, run_dir)
+        # wait for any active run to finish
+        while not any(p.poll() is not None for p in active):
+            time.sleep(0.5)
+        for proc in [p for p in active if p.poll() is not None]:
+            run_nr, run_dir = active.pop(proc)
+            if proc.returncode != 0:
+                print("[run_{:03}] FAILED, see {:}".format(
+                    run_nr, os.path.join(run_dir, 'console.log')))
+                num_failed += 1
+            else:
+                print("[run_{:03}] done: {:}".format(run_nr, output_log(run_dir)))
+
+    if num_failed > 0:
+        print("{:} of {:} runs failed".format(num_failed, len(runs)))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+
+"""
+Run the on-target microbenchmark suite ('microbench' systemcmd) in SITL and
+compare the results against a JSON baseline under test/benchmark/.
+
+The benchmarks must run against a build without the lockstep scheduler, so the
+hrt measures wall-clock time (use 'make benchmark', which builds
+px4_sitl_nolockstep). On the first run the baseline file is created; later
+runs fail if a benchmark's average regresses by more than the tolerance, so a
+regression can be bisected with 'git bisect run make benchmark'. Re-record the
+baseline with --update after intentional changes or when moving to a new
+machine.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+
+# name: 100 events, 1234us elapsed, 12.34us avg, min 10us max 20us 1.234us rms
+PERF_RE = re.compile(
+    r'^(?P<name>.+?): (?P<events>\d+) events, (?:\d+us elapsed, )?'
+    r'(?P<avg>[\d.]+)us avg, min (?P<min>\d+)us max (?P<max>\d+)us')
+
+BENCHMARK_SCRIPT = """
+uorb start
+microbench all
+shutdown
+"""
+
+
+def run_benchmarks(build_dir):
+    """ run 'microbench all' in SITL and return {name: {avg_us, min_us, max_us}} """
+    px4_bin = os.path.join(build_dir, 'bin', 'px4')
+    if not os.path.isfile(px4_bin):
+        print("PX4 binary {:} not found".format(px4_bin))
+        sys.exit(1)
+
+    run_dir = os.path.join(build_dir, 'benchmark')
+    os.makedirs(run_dir, exist_ok=True)
+    script = os.path.join(run_dir, 'rc.benchmark')
+    with open(script, 'w') as f:
+        f.write(BENCHMARK_SCRIPT)
+
+    proc = subprocess.run(
+        [px4_bin, '-d', '-s', script, '-w', run_dir, os.path.join(build_dir, 'etc')],
+        stdout=subprocess.PIPE, stderr=subprocess.STDOUT, timeout=600)
+    output = proc.stdout.decode('utf-8', errors='replace')
+
+    results = {}
+    for line in output.splitlines():
+        m = PERF_RE.match(line.strip())
+        if m:
+            results[m.group('name')] = {
+                'avg_us': float(m.group('avg')),
+                'min_us': int(m.group('min')),
+                'max_us': int(m.group('max')),
+            }
+
+    if not results:
+        print("No benchmark results found in output:")
+        print(output)
+        sys.exit(1)
+
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--build-dir', default='build/px4_sitl_nolockstep',
+                        help='SITL build directory (default: %(default)s)')
+    parser.add_argument('--baseline', default='test/benchmark/baseline.json',
+                        help='baseline file (default: %(default)s)')
+    parser.add_argument('--tolerance', type=float, default=25.0,
+                        help='allowed average regression in percent (default: %(default)s)')
+    parser.add_argument('--update', action='store_true',
+                        help='overwrite the baseline with the current results')
+    args = parser.parse_args()
+
+    results = run_benchmarks(args.build_dir)
+    print("{:} benchmarks run".format(len(results)))
+
+    if args.update or not os.path.isfile(args.baseline):
+        os.makedirs(os.path.dirname(args.baseline), exist_ok=True)
+        with open(args.baseline, 'w') as f:
+            json.dump({
+                'host': platform.node(),
+                'machine': platform.machine(),
+                'date': datetime.date.today().isoformat(),
+                'benchmarks': results,
+            }, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print("Baseline written to {:}".format(args.baseline))
+        return
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    num_regressed = 0
+    for name, result in sorted(results.items()):
+        base = baseline['benchmarks'].get(name)
+        if base is None:
+            print("NEW        {:}: {:.2f}us avg (not in baseline)".format(name, result['avg_us']))
+            continue
+
+        change_pct = 100.0 * (result['avg_us'] - base['avg_us']) / base['avg_us'] \
+            if base['avg_us'] > 0.0 else 0.0
+        if change_pct > args.tolerance:
+            print("REGRESSED  {:}: {:.2f}us avg, baseline {:.2f}us ({:+.1f}%)".format(
+                name, result['avg_us'], base['avg_us'], change_pct))
+            num_regressed += 1
+        else:
+            print("ok         {:}: {:.2f}us avg ({:+.1f}%)".format(
+                name, result['avg_us'], change_pct))
+
+    if num_regressed > 0:
+        print("{:} benchmark(s) regressed more than {:.0f}% "
+              "(baseline from {:} on {:})".format(
+                  num_regressed, args.tolerance,
+                  baseline.get('date', '?'), baseline.get('host', '?')))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
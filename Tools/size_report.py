@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+""" Per-module flash/RAM size accounting with deltas against a stored baseline.
+
+Reads a manifest of module static libraries (generated by cmake/size_report.cmake),
+attributes .text/.data/.bss to each module with the toolchain size tool, writes a
+machine-readable JSON report and optionally compares it against a baseline,
+failing on flash budget regressions.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+
+def module_sizes(size_tool, library):
+    """ Sum text/data/bss over all members of a static library """
+    output = subprocess.check_output([size_tool, library]).decode()
+    text = data = bss = 0
+
+    for line in output.splitlines()[1:]:
+        fields = line.split()
+
+        if len(fields) >= 3 and fields[0].isdigit():
+            text += int(fields[0])
+            data += int(fields[1])
+            bss += int(fields[2])
+
+    return {'text': text, 'data': data, 'bss': bss}
+
+
+def flash(sizes):
+    return sizes['text'] + sizes['data']
+
+
+def ram(sizes):
+    return sizes['data'] + sizes['bss']
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--manifest', required=True,
+                        help='file with one module=library_path line per module')
+    parser.add_argument('--size-tool', default='size',
+                        help='size executable of the target toolchain (default: size)')
+    parser.add_argument('--output', required=True,
+                        help='JSON report output file')
+    parser.add_argument('--baseline', default=None,
+                        help='baseline JSON report to diff against')
+    parser.add_argument('--save-baseline', action='store_true',
+                        help='store the current report as the new baseline and exit')
+    parser.add_argument('--budget', type=int, default=512,
+                        help='allowed per-module flash growth in bytes (default: 512)')
+    parser.add_argument('--total-budget', type=int, default=2048,
+                        help='allowed total flash growth in bytes (default: 2048)')
+    args = parser.parse_args()
+
+    report = {'modules': {}}
+
+    with open(args.manifest) as f:
+        for line in f:
+            line = line.strip()
+
+            if not line:
+                continue
+
+            module, library = line.split('=', 1)
+
+            if os.path.isfile(library):
+                report['modules'][module] = module_sizes(args.size_tool, library)
+
+    report['total'] = {
+        'text': sum(m['text'] for m in report['modules'].values()),
+        'data': sum(m['data'] for m in report['modules'].values()),
+        'bss': sum(m['bss'] for m in report['modules'].values()),
+    }
+
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=1, sort_keys=True)
+        f.write('\n')
+
+    if args.save_baseline:
+        with open(args.baseline, 'w') as f:
+            json.dump(report, f, indent=1, sort_keys=True)
+            f.write('\n')
+
+        print('stored size baseline in {:}'.format(args.baseline))
+        return 0
+
+    print('{:<40} {:>8} {:>8} {:>8}'.format('module', 'text', 'data', 'bss'))
+
+    for module in sorted(report['modules']):
+        sizes = report['modules'][module]
+        print('{:<40} {:>8} {:>8} {:>8}'.format(module, sizes['text'], sizes['data'], sizes['bss']))
+
+    total = report['total']
+    print('{:<40} {:>8} {:>8} {:>8}'.format('total', total['text'], total['data'], total['bss']))
+
+    if args.baseline is None or not os.path.isfile(args.baseline):
+        print('\nno size baseline found, skipping budget check '
+              '(store one with the size-report-baseline target)')
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    over_budget = []
+    print('\ndeltas against baseline:')
+
+    for module in sorted(set(report['modules']) | set(baseline['modules'])):
+        current = report['modules'].get(module, {'text': 0, 'data': 0, 'bss': 0})
+        previous = baseline['modules'].get(module, {'text': 0, 'data': 0, 'bss': 0})
+        flash_delta = flash(current) - flash(previous)
+        ram_delta = ram(current) - ram(previous)
+
+        if flash_delta != 0 or ram_delta != 0:
+            print('{:<40} flash {:>+8} RAM {:>+8}'.format(module, flash_delta, ram_delta))
+
+        if flash_delta > args.budget:
+            over_budget.append('{:} flash grew by {:} bytes (budget: {:})'.format(
+                module, flash_delta, args.budget))
+
+    total_flash_delta = flash(report['total']) - flash(baseline['total'])
+    print('{:<40} flash {:>+8} RAM {:>+8}'.format(
+        'total', total_flash_delta, ram(report['total']) - ram(baseline['total'])))
+
+    if total_flash_delta > args.total_budget:
+        over_budget.append('total flash grew by {:} bytes (budget: {:})'.format(
+            total_flash_delta, args.total_budget))
+
+    if over_budget:
+        print('\nsize budget exceeded:', file=sys.stderr)
+
+        for entry in over_budget:
+            print(' - ' + entry, file=sys.stderr)
+
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
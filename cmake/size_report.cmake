@@ -0,0 +1,75 @@
+############################################################################
+#
+# Copyright (c) 2022 PX4 Development Team. All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name PX4 nor the names of its contributors may be
+#    used to endorse or promote products derived from this software
+#    without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+
+# per-module flash/RAM accounting: attribute .text/.data/.bss of every
+# px4_add_module library into a machine-readable report with deltas against a
+# stored per-board baseline, so size regressions fail before release crunch
+
+get_property(size_report_modules GLOBAL PROPERTY PX4_MODULE_LIBRARIES)
+get_property(size_report_kernel_modules GLOBAL PROPERTY PX4_KERNEL_MODULE_LIBRARIES)
+
+set(size_report_manifest)
+foreach(module ${size_report_modules} ${size_report_kernel_modules})
+	string(APPEND size_report_manifest "${module}=$<TARGET_FILE:${module}>\n")
+endforeach()
+file(GENERATE OUTPUT ${PX4_BINARY_DIR}/size_report_modules.txt CONTENT "${size_report_manifest}")
+
+if(CMAKE_SIZE)
+	set(SIZE_REPORT_TOOL ${CMAKE_SIZE})
+else()
+	set(SIZE_REPORT_TOOL size)
+endif()
+
+add_custom_target(size-report
+	COMMAND ${PYTHON_EXECUTABLE} ${PX4_SOURCE_DIR}/Tools/size_report.py
+		--manifest ${PX4_BINARY_DIR}/size_report_modules.txt
+		--size-tool ${SIZE_REPORT_TOOL}
+		--output ${PX4_BINARY_DIR}/size_report.json
+		--baseline ${PX4_BOARD_DIR}/size_baseline.json
+	DEPENDS px4
+	WORKING_DIRECTORY ${PX4_BINARY_DIR}
+	USES_TERMINAL
+	)
+
+# store the current sizes as the new per-board budget baseline
+add_custom_target(size-report-baseline
+	COMMAND ${PYTHON_EXECUTABLE} ${PX4_SOURCE_DIR}/Tools/size_report.py
+		--manifest ${PX4_BINARY_DIR}/size_report_modules.txt
+		--size-tool ${SIZE_REPORT_TOOL}
+		--output ${PX4_BINARY_DIR}/size_report.json
+		--baseline ${PX4_BOARD_DIR}/size_baseline.json
+		--save-baseline
+	DEPENDS px4
+	WORKING_DIRECTORY ${PX4_BINARY_DIR}
+	USES_TERMINAL
+	)
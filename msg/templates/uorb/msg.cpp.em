@@ -59,9 +59,17 @@ from px_generate_uorb_topic_helper import * # this is in Tools/
 uorb_struct = '%s_s'%spec.short_name
 topic_name = spec.short_name
 
-sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
+sorted_fields = sort_msg_fields(spec.parsed_fields(), file_name_in)
 struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
 topic_fields = ["%s %s" % (convert_type(field.type, True), field.name) for field in sorted_fields]
+
+# storage mode flags, selected via special constants in the .msg file
+topic_flags = []
+if any(constant.name == 'ORB_LOCK_FREE' and int(constant.val) == 1 for constant in spec.constants):
+    topic_flags.append('ORB_FLAG_LOCK_FREE')
+if any(constant.name == 'ORB_ADAPTIVE_QUEUE' and int(constant.val) == 1 for constant in spec.constants):
+    topic_flags.append('ORB_FLAG_ADAPTIVE_QUEUE')
+topic_flags_str = ' | '.join(topic_flags) if topic_flags else '0'
 }@
 
 #include <inttypes.h>
@@ -79,14 +87,52 @@ topic_fields = ["%s %s" % (convert_type(field.type, True), field.name) for field
 constexpr char __orb_@(topic_name)_fields[] = "@( ";".join(topic_fields) );";
 
 @[for multi_topic in topics]@
-ORB_DEFINE(@multi_topic, struct @uorb_struct, @(struct_size-padding_end_size), __orb_@(topic_name)_fields, static_cast<uint8_t>(ORB_ID::@multi_topic));
+ORB_DEFINE(@multi_topic, struct @uorb_struct, @(struct_size-padding_end_size), __orb_@(topic_name)_fields, static_cast<uint8_t>(ORB_ID::@multi_topic), @topic_flags_str);
 @[end for]
 
+@{
+all_builtin = all(field.is_builtin for field in spec.parsed_fields())
+
+def print_direct_statements():
+    # direct per-field print statements generated from the message definition
+    cast_map = {
+        'float32': '(double)', 'float64': '(double)',
+        'bool': '(unsigned)', 'uint8': '(unsigned)', 'uint16': '(unsigned)',
+        'int8': '(int)', 'int16': '(int)',
+        'int32': '', 'uint32': '', 'int64': '', 'uint64': '', 'char': '',
+    }
+    for field in sorted_fields:
+        if field.is_header or field.name.startswith('_padding'):
+            continue
+        bare = bare_name(field.type)
+        fmt = type_printf_map[bare]
+        cast = cast_map[bare]
+        if field.is_array:
+            if bare == 'char':
+                print('\tPX4_INFO_RAW("\\t%s: \\"%%.%ds\\"\\n", message.%s);' % (field.name, field.array_len, field.name))
+            else:
+                print('\tPX4_INFO_RAW("\\t%s: [");' % field.name)
+                print('\n\tfor (size_t i = 0; i < %d; i++) { PX4_INFO_RAW((i > 0) ? ", %s" : "%s", %smessage.%s[i]); }\n' % (field.array_len, fmt, fmt, cast, field.name))
+                print('\tPX4_INFO_RAW("]\\n");')
+        else:
+            print('\tPX4_INFO_RAW("\\t%s: %s\\n", %smessage.%s);' % (field.name, fmt, cast, field.name))
+}@
 void print_message(const orb_metadata *meta, const @uorb_struct& message)
 {
 	if (sizeof(message) != meta->o_size) {
 		printf("unexpected message size for %s: %zu != %i\n", meta->o_name, sizeof(message), meta->o_size);
 		return;
 	}
+@[if all_builtin]@
+#if defined(CONSTRAINED_FLASH)
+	orb_print_message_internal(meta, &message, true);
+#else
+	// direct printer generated from the message definition, faster than walking the
+	// runtime format string (orb_print_message_internal) at the cost of some flash
+	PX4_INFO_RAW(" %s\n", meta->o_name);
+@print_direct_statements()
+#endif // CONSTRAINED_FLASH
+@[else]@
 	orb_print_message_internal(meta, &message, true);
+@[end if]@
 }
@@ -92,10 +92,11 @@ for field in spec.parsed_fields():
 @##############################
 @{
 
+# sort fields (using a stable sort, '@hot' annotated fields lead their size class)
+sorted_fields = sort_msg_fields(spec.parsed_fields(), file_name_in)
+struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
+
 def print_parsed_fields():
-    # sort fields (using a stable sort)
-    sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
-    struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
     # loop over all fields and print the type and name
     for field in sorted_fields:
         if (not field.is_header):
@@ -127,6 +128,12 @@ for constant in spec.constants:
 #endif
 };
 
+#ifdef __cplusplus
+/* verify that the generator layout matches the compiler (no compiler inserted padding) */
+static_assert(sizeof(@uorb_struct) == @(struct_size), "@uorb_struct: unexpected compiler padding");
+static_assert(sizeof(@uorb_struct) % 8 == 0, "@uorb_struct: size must be a multiple of 8 bytes");
+#endif
+
 /* register this as object request broker structure */
 @[for multi_topic in topics]@
 ORB_DECLARE(@multi_topic);
@@ -75,3 +75,13 @@ const struct orb_metadata *get_orb_meta(ORB_ID id)
 
 	return uorb_topics_list[static_cast<uint8_t>(id)];
 }
+
+void orb_print_message(const struct orb_metadata *meta, const void *data)
+{
+	switch (static_cast<ORB_ID>(meta->o_id)) {
+@[for topic_name in topics_all]@
+	case ORB_ID::@(topic_name): print_message(meta, *static_cast<const @(topic_msgs[topic_name])_s *>(data)); break;
+@[end for]
+	case ORB_ID::INVALID: break;
+	}
+}
@@ -73,3 +73,8 @@ enum class ORB_ID : uint8_t {
 };
 
 const struct orb_metadata *get_orb_meta(ORB_ID id);
+
+/*
+ * Print a topic using the print routine generated for its message type
+ */
+void orb_print_message(const struct orb_metadata *meta, const void *data);
@@ -109,6 +109,12 @@ topic_pascal = topic.replace("_", " ").title().replace(" ", "")
 
 void SendTopicsSubs::update(uxrStreamId stream_id)
 {
+	// The subscriptions are generation-checked, so only topics with new data are
+	// copied and serialized. All pending topics are aggregated into the stream
+	// buffer and flushed in one go, so the per-packet session overhead is paid
+	// once per update pass instead of once per topic.
+	bool something_to_send = false;
+
 @[    for idx, topic in enumerate(send_topics)]@
 	{
 		@(send_base_types[idx])_s data;
@@ -116,15 +122,23 @@ void SendTopicsSubs::update(uxrStreamId stream_id)
 		if (@(topic)_sub.update(&data)) {
 			ucdrBuffer ub{};
 			uint32_t topic_size = ucdr_topic_size_@(send_base_types[idx])();
-			uxr_prepare_output_stream(session, stream_id, @(topic)_data_writer, &ub, topic_size);
+
+			if (uxr_prepare_output_stream(session, stream_id, @(topic)_data_writer, &ub, topic_size) == UXR_INVALID_REQUEST_ID) {
+				// stream buffer full: flush the aggregated submessages and retry
+				uxr_flash_output_streams(session);
+				uxr_prepare_output_stream(session, stream_id, @(topic)_data_writer, &ub, topic_size);
+			}
+
 			ucdr_serialize_@(send_base_types[idx])(data, ub);
-			// TODO: fill up the MTU and then flush, which reduces the packet overhead
-			uxr_flash_output_streams(session);
+			something_to_send = true;
 			num_payload_sent += topic_size;
 		}
 	}
 @[    end for]@
 
+	if (something_to_send) {
+		uxr_flash_output_streams(session);
+	}
 }
 
 static void on_topic_update(uxrSession* session, uxrObjectId object_id,
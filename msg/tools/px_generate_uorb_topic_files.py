@@ -461,10 +461,15 @@ def generate_topics_list_file(msgdir, outputdir, template_filename, templatedir)
     # generate cpp file with topics list
     msgs = get_msgs_list(msgdir)
     topics = []
+    topic_msgs = {}
     for msg in msgs:
         msg_filename = os.path.join(msgdir, msg)
-        topics.extend(get_topics(msg_filename, msg))
-    tl_globals = {"msgs": msgs, "topics": topics}
+        msg_name = msg.replace('.msg', '')
+        msg_topics = get_topics(msg_filename, msg_name)
+        topics.extend(msg_topics)
+        for topic in msg_topics:
+            topic_msgs[topic] = msg_name
+    tl_globals = {"msgs": msgs, "topics": topics, "topic_msgs": topic_msgs}
     tl_template_file = os.path.join(templatedir, template_filename)
     tl_out_file = os.path.join(outputdir, template_filename.replace(".em", ""))
     generate_by_template(tl_out_file, tl_template_file, tl_globals)
@@ -476,15 +481,19 @@ def generate_topics_list_file_from_files(files, outputdir, template_filename, te
 
     # Get topics used in messages
     topics = []
+    topic_msgs = {}
     for msg_filename in msg_filenames:
         msg_name = os.path.basename(msg_filename).replace('.msg', '')
-        topics.extend(get_topics(msg_filename, msg_name))
+        msg_topics = get_topics(msg_filename, msg_name)
+        topics.extend(msg_topics)
+        for topic in msg_topics:
+            topic_msgs[topic] = msg_name
 
     # Get only the message file name for "msgs" component
     msg_basenames = [os.path.basename(p) for p in msg_filenames]
 
     # Set the Template dictionary settings
-    tl_globals = {"msgs": msg_basenames, "topics": topics}
+    tl_globals = {"msgs": msg_basenames, "topics": topics, "topic_msgs": topic_msgs}
     tl_template_file = os.path.join(templatedir, template_filename)
     tl_out_file = os.path.join(outputdir, template_filename.replace(".em", ""))
     generate_by_template(tl_out_file, tl_template_file, tl_globals)
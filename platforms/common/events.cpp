@@ -32,16 +32,93 @@
  ****************************************************************************/
 
 #include <pthread.h>
+#include <string.h>
 
 #include <drivers/drv_hrt.h>
 #include <px4_platform_common/posix.h>
 #include <px4_platform_common/events.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <uORB/uORB.h>
 
 static orb_advert_t orb_event_pub = nullptr;
 static pthread_mutex_t publish_event_mutex = PTHREAD_MUTEX_INITIALIZER;
 static uint16_t event_sequence{events::initial_event_sequence};
 
+namespace
+{
+
+// Fixed retention pool between the event producers and the event uORB queue.
+// Events are published directly while the token bucket allows, matching what a
+// consumer polling at ~10 Hz can drain; bursts beyond that (arming denial
+// storms, sensor failure cascades) are parked here and delivered at the paced
+// rate by a low priority work item instead of overwriting the oldest queue
+// entries. When the pool itself overflows the entries with the least severe
+// external log level are evicted first; evicted events leave a gap in the
+// event sequence, which consumers already detect as lost events.
+
+class EventDrain : public px4::ScheduledWorkItem
+{
+public:
+	EventDrain() : ScheduledWorkItem("events", px4::wq_configurations::lp_default) {}
+
+private:
+	void Run() override;
+};
+
+static constexpr uint8_t EVENT_POOL_SIZE = 16;
+static constexpr unsigned EVENT_TOKENS_MAX = event_s::ORB_QUEUE_LENGTH - 1;
+static constexpr uint32_t EVENT_DRAIN_INTERVAL_US = 20000; // 1 token per interval once the burst allowance is used
+
+static events::EventType event_pool[EVENT_POOL_SIZE]; // index 0 is the oldest entry
+static uint8_t event_pool_count = 0;
+static uint16_t event_dropped = 0;
+static unsigned event_tokens = EVENT_TOKENS_MAX;
+static hrt_abstime event_last_refill = 0;
+static EventDrain *event_drain = nullptr;
+static bool event_drain_requested = false;
+
+// must be called with publish_event_mutex held
+static void event_refill_tokens()
+{
+	const hrt_abstime now = hrt_absolute_time();
+	const unsigned refill = (now - event_last_refill) / EVENT_DRAIN_INTERVAL_US;
+
+	if (refill > 0) {
+		event_tokens += refill;
+
+		if (event_tokens > EVENT_TOKENS_MAX) {
+			event_tokens = EVENT_TOKENS_MAX;
+		}
+
+		event_last_refill = now;
+	}
+}
+
+void EventDrain::Run()
+{
+	bool reschedule = false;
+
+	// publish under the mutex to keep the sequence numbers ordered in the queue
+	pthread_mutex_lock(&publish_event_mutex);
+	event_refill_tokens();
+
+	if ((event_pool_count > 0) && (event_tokens > 0)) {
+		event_tokens--;
+		orb_publish(ORB_ID(event), orb_event_pub, &event_pool[0]);
+		event_pool_count--;
+		memmove(&event_pool[0], &event_pool[1], event_pool_count * sizeof(events::EventType));
+	}
+
+	reschedule = (event_pool_count > 0);
+	pthread_mutex_unlock(&publish_event_mutex);
+
+	if (reschedule) {
+		ScheduleDelayed(EVENT_DRAIN_INTERVAL_US);
+	}
+}
+
+} // namespace
+
 namespace events
 {
 
@@ -49,6 +126,9 @@ void send(EventType &event)
 {
 	event.timestamp = hrt_absolute_time();
 
+	bool create_drain = false;
+	bool schedule = false;
+
 	// We need some synchronization here because:
 	// - modifying orb_event_pub
 	// - the update of event_sequence needs to be atomic
@@ -57,14 +137,64 @@ void send(EventType &event)
 	pthread_mutex_lock(&publish_event_mutex);
 	event.event_sequence = ++event_sequence; // Set the sequence here so we're able to detect uORB queue overflows
 
-	if (orb_event_pub != nullptr) {
-		orb_publish(ORB_ID(event), orb_event_pub, &event);
+	if (orb_event_pub == nullptr) {
+		orb_event_pub = orb_advertise_queue(ORB_ID(event), &event, event_s::ORB_QUEUE_LENGTH);
 
 	} else {
-		orb_event_pub = orb_advertise_queue(ORB_ID(event), &event, event_s::ORB_QUEUE_LENGTH);
+		event_refill_tokens();
+
+		if ((event_pool_count == 0) && (event_tokens > 0)) {
+			event_tokens--;
+			orb_publish(ORB_ID(event), orb_event_pub, &event);
+
+		} else {
+			if (event_pool_count == EVENT_POOL_SIZE) {
+				// evict the entry with the least severe external log level
+				// (numerically largest), oldest among equals
+				uint8_t worst = 0;
+
+				for (uint8_t i = 1; i < event_pool_count; i++) {
+					if ((event_pool[i].log_levels & 0xF) > (event_pool[worst].log_levels & 0xF)) {
+						worst = i;
+					}
+				}
+
+				event_dropped++;
+
+				if ((event.log_levels & 0xF) > (event_pool[worst].log_levels & 0xF)) {
+					// the incoming event is the least important one
+					pthread_mutex_unlock(&publish_event_mutex);
+					return;
+				}
+
+				memmove(&event_pool[worst], &event_pool[worst + 1],
+					(event_pool_count - worst - 1) * sizeof(EventType));
+				event_pool_count--;
+			}
+
+			event_pool[event_pool_count++] = event;
+
+			if (event_pool_count == 1) {
+				// first entry: kick off the paced drain (created lazily so the work queues exist)
+				if (!event_drain_requested) {
+					event_drain_requested = true;
+					create_drain = true;
+				}
+
+				schedule = true;
+			}
+		}
 	}
 
 	pthread_mutex_unlock(&publish_event_mutex);
+
+	if (create_drain) {
+		event_drain = new EventDrain();
+	}
+
+	if (schedule && (event_drain != nullptr)) {
+		event_drain->ScheduleDelayed(EVENT_DRAIN_INTERVAL_US);
+	}
 }
 
 } /* namespace events */
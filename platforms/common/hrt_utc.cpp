@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ * Copyright (C) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file hrt_utc.cpp
+ *
+ * Drift-corrected hrt -> UTC mapping, disciplined from GPS PPS edges.
+ *
+ * The mapping is a reference pair plus a frequency-error estimate; the hrt
+ * timebase itself is never stepped. Readers run on arbitrary threads, so the
+ * state is published through a sequence counter instead of a lock.
+ */
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+
+namespace
+{
+
+struct hrt_utc_state {
+	uint64_t utc_reference_us{0};
+	hrt_abstime hrt_reference{0};
+	int32_t drift_ppb{0};
+};
+
+hrt_utc_state _state;
+px4::atomic<uint32_t> _sequence{0};
+
+} // namespace
+
+void hrt_utc_set_reference(uint64_t utc_time_us, hrt_abstime hrt_time, float drift_ppm)
+{
+	// an odd sequence count marks the update in progress
+	const uint32_t seq = _sequence.load();
+	_sequence.store(seq + 1);
+
+	_state.utc_reference_us = utc_time_us;
+	_state.hrt_reference = hrt_time;
+	_state.drift_ppb = (int32_t)(drift_ppm * 1000.f);
+
+	_sequence.store(seq + 2);
+}
+
+int hrt_utc_time(uint64_t *utc_time_us, hrt_abstime hrt_time)
+{
+	hrt_utc_state state;
+	uint32_t seq;
+
+	do {
+		seq = _sequence.load();
+
+		if (seq == 0) {
+			// no PPS reference yet
+			return -1;
+		}
+
+		if (seq & 1) {
+			// update in progress
+			continue;
+		}
+
+		state = _state;
+	} while (_sequence.load() != seq);
+
+	// elapsed hrt time, rescaled by the frequency-error estimate
+	const int64_t elapsed = (int64_t)(hrt_time - state.hrt_reference);
+	*utc_time_us = state.utc_reference_us + elapsed - (elapsed * state.drift_ppb) / 1000000000;
+
+	return 0;
+}
+
+float hrt_utc_drift_ppm(void)
+{
+	int32_t drift_ppb;
+	uint32_t seq;
+
+	do {
+		seq = _sequence.load();
+
+		if (seq == 0) {
+			return 0.f;
+		}
+
+		if (seq & 1) {
+			continue;
+		}
+
+		drift_ppb = _state.drift_ppb;
+	} while (_sequence.load() != seq);
+
+	return drift_ppb * 1e-3f;
+}
@@ -50,15 +50,51 @@ public:
 		size_t total = 0;
 
 		for (const auto &x : _data) {
-			uint32_t y = x.load();
+			total += __builtin_popcount(x.load());
+		}
+
+		return total;
+	}
+
+	/**
+	 * Count the set bits before (excluding) a given position.
+	 * @param position bit position, must be < size()
+	 */
+	size_t count_before(size_t position) const
+	{
+		size_t total = 0;
+		const size_t last_index = array_index(position);
+
+		for (size_t i = 0; i < last_index; i++) {
+			total += __builtin_popcount(_data[i].load());
+		}
+
+		return total + __builtin_popcount(_data[last_index].load() & (element_mask(position) - 1));
+	}
+
+	/**
+	 * Find the position of the n-th (0-based) set bit.
+	 * @return the bit position, or -1 if fewer than n+1 bits are set
+	 */
+	int find_nth_set(size_t n) const
+	{
+		for (size_t i = 0; i < ARRAY_SIZE; i++) {
+			uint32_t word = _data[i].load();
+			const size_t bits_set = __builtin_popcount(word);
+
+			if (n < bits_set) {
+				// the bit is in this word: clear the n lowest set bits, then take the lowest remaining
+				for (size_t j = 0; j < n; j++) {
+					word &= word - 1;
+				}
 
-			while (y) {
-				total += y & 1;
-				y >>= 1;
+				return i * BITS_PER_ELEMENT + __builtin_ctz(word);
 			}
+
+			n -= bits_set;
 		}
 
-		return total;
+		return -1;
 	}
 
 	size_t size() const { return N; }
@@ -0,0 +1,82 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file crc.h
+ *
+ * Platform CRC-32 API.
+ *
+ * Same polynomial and running-value semantics as the C library crc32part()
+ * (IEEE 802.3, reflected, no final inversion). Architectures with a hardware
+ * CRC engine define PX4_CRC32_HW in their px4_arch/micro_hal.h and provide
+ * px4_arch_crc32part(); everywhere else the software table version is used.
+ * Intended for bulk paths (file checksums, the hash over the parameter set)
+ * where the per-byte table lookup is measurable.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <crc32.h>
+
+#include <px4_platform_common/micro_hal.h>
+
+#if defined(PX4_CRC32_HW)
+
+__BEGIN_DECLS
+/** architecture backend feeding the hardware CRC engine */
+__EXPORT uint32_t px4_arch_crc32part(const uint8_t *src, size_t len, uint32_t crc32val);
+__END_DECLS
+
+/** continue a CRC-32 over a buffer (crc32val: 0 to start, or the previous return value) */
+static inline uint32_t px4_crc32part(const uint8_t *src, size_t len, uint32_t crc32val)
+{
+	return px4_arch_crc32part(src, len, crc32val);
+}
+
+#else
+
+/** continue a CRC-32 over a buffer (crc32val: 0 to start, or the previous return value) */
+static inline uint32_t px4_crc32part(const uint8_t *src, size_t len, uint32_t crc32val)
+{
+	return crc32part(src, len, crc32val);
+}
+
+#endif // PX4_CRC32_HW
+
+/** CRC-32 of a complete buffer */
+static inline uint32_t px4_crc32(const uint8_t *src, size_t len)
+{
+	return px4_crc32part(src, len, 0);
+}
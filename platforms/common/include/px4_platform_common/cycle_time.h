@@ -1,6 +1,6 @@
 /****************************************************************************
  *
- *   Copyright (c) 2013-2020 PX4 Development Team. All rights reserved.
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -17,7 +17,7 @@
  *    without specific prior written permission.
  *
  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
- * AS IS AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
  * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
  * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
@@ -32,66 +32,39 @@
  ****************************************************************************/
 
 /**
- * @file uuv_pos_control_params.c
+ * @file cycle_time.h
  *
- * Parameters defined by the position control task for unmanned underwater vehicles (UUVs)
+ * Shared cycle timestamp service.
  *
- * This is a modification of the fixed wing/ground rover params and it is designed for ground rovers.
- * It has been developed starting from the fw  module, simplified and improved with dedicated items.
- *
- * All the ackowledgments and credits for the fw wing/rover app are reported in those files.
- *
- * @author Tim Hansen <t.hansen@jacobs-university.de>
- * @author Daniel Duecker <daniel.duecker@tuhh.de>
+ * The work queues stamp the time once per dispatched work item. Periodic
+ * housekeeping checks that only need dispatch-granular time (e.g.
+ * uORB::SubscriptionInterval) read the stamp instead of issuing another
+ * hrt_absolute_time() call, which is syscall-weight on some targets.
  */
 
-/*
- * Controller parameters, accessible via MAVLink
- *
- */
-/**
- * Gain of P controller X
- *
- * @group UUV Position Control
- */
-PARAM_DEFINE_FLOAT(UUV_GAIN_X_P, 1.0f);
-/**
- * Gain of P controller Y
- *
- * @group UUV Position Control
- */
-PARAM_DEFINE_FLOAT(UUV_GAIN_Y_P, 1.0f);
-/**
- * Gain of P controller Z
- *
- * @group UUV Position Control
- */
-PARAM_DEFINE_FLOAT(UUV_GAIN_Z_P, 1.0f);
+#pragma once
+
+#include <drivers/drv_hrt.h>
+
+__BEGIN_DECLS
 
 /**
- * Gain of D controller X
- *
- * @group UUV Position Control
- */
-PARAM_DEFINE_FLOAT(UUV_GAIN_X_D, 0.2f);
-/**
- * Gain of D controller Y
+ * Update the shared cycle timestamp.
  *
- * @group UUV Position Control
- */
-PARAM_DEFINE_FLOAT(UUV_GAIN_Y_D, 0.2f);
-/**
- * Gain of D controller Z
+ * Called by the work queue dispatch loop before each work item runs;
+ * task-based modules may additionally call this at the top of their own cycle.
  *
- * @group UUV Position Control
+ * @param now current time from hrt_absolute_time()
  */
-PARAM_DEFINE_FLOAT(UUV_GAIN_Z_D, 0.2f);
+void px4_cycle_time_update(hrt_abstime now);
 
 /**
- * Stabilization mode(1) or Position Control(0)
+ * Time of the most recent dispatch stamp.
  *
- * @value 0 Position Control
- * @value 1 Stabilization Mode
- * @group UUV Position Control
+ * Staleness is bounded by the longest currently running work item. Falls back
+ * to hrt_absolute_time() until the first stamp. Only use this where
+ * dispatch-granular time is sufficient.
  */
-PARAM_DEFINE_INT32(UUV_STAB_MODE, 1);
+hrt_abstime px4_cycle_time(void);
+
+__END_DECLS
@@ -0,0 +1,205 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file log_deferred.h
+ *
+ * Deferred-formatting log statements for hot paths.
+ *
+ * PX4_INFO_DEFERRED() and friends capture the format string pointer (which
+ * identifies the statement, since it lives in flash) plus the raw argument
+ * values into a lock-free ring, instead of running printf formatting on the
+ * caller's thread. A low priority work item renders the captured records
+ * later and delivers them through the regular log path (console and
+ * log_message), so a statement costs little more than a small copy at the
+ * call site and can stay in a hot loop permanently.
+ *
+ * Up to PX4_LOG_DEFERRED_MAX_ARGS arguments are captured; %s arguments are
+ * copied (and truncated) into a small per-record pool so the caller's buffer
+ * does not need to outlive the call. Excess arguments are dropped and excess
+ * conversions render as their literal spec, mirroring how mismatches stay
+ * visible with printf.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+#include <px4_platform_common/log.h>
+
+static constexpr unsigned PX4_LOG_DEFERRED_MAX_ARGS = 6;
+static constexpr unsigned PX4_LOG_DEFERRED_STRING_POOL = 48;
+
+enum class px4_log_deferred_arg_type : uint8_t {
+	NONE = 0,
+	INT,	///< signed integers, char, bool, enums
+	UINT,	///< unsigned integers, non-string pointers
+	DOUBLE,	///< float and double
+	STRING,	///< copied into the record's string pool
+};
+
+struct px4_log_deferred_args {
+	union value_u {
+		int64_t i;
+		uint64_t u;
+		double d;
+		uint8_t string_offset;
+	};
+
+	value_u values[PX4_LOG_DEFERRED_MAX_ARGS];
+	px4_log_deferred_arg_type types[PX4_LOG_DEFERRED_MAX_ARGS] {};
+	uint8_t count{0};
+	uint8_t string_used{0};
+	char strings[PX4_LOG_DEFERRED_STRING_POOL];
+};
+
+/**
+ * Enqueue a captured record. Lock-free; drops the record (counted) when the
+ * ring is full. Implemented next to the rest of the log machinery.
+ */
+__EXPORT void px4_log_deferred_push(int level, const char *module_name, const char *fmt,
+				    const px4_log_deferred_args &args);
+
+/**
+ * Render a captured record back into text. Pure, used by the log consumer
+ * and by tests.
+ *
+ * @return number of characters written (excluding the terminator)
+ */
+__EXPORT int px4_log_deferred_render(const char *fmt, const px4_log_deferred_args &args,
+				     char *out, size_t out_size);
+
+// capture overloads: one per value class, selected at compile time
+
+inline void px4_log_deferred_store(px4_log_deferred_args &args, float value)
+{
+	args.values[args.count].d = (double)value;
+	args.types[args.count++] = px4_log_deferred_arg_type::DOUBLE;
+}
+
+inline void px4_log_deferred_store(px4_log_deferred_args &args, double value)
+{
+	args.values[args.count].d = value;
+	args.types[args.count++] = px4_log_deferred_arg_type::DOUBLE;
+}
+
+inline void px4_log_deferred_store(px4_log_deferred_args &args, const char *value)
+{
+	const unsigned remaining = PX4_LOG_DEFERRED_STRING_POOL - args.string_used;
+
+	if (value == nullptr || remaining < 2) {
+		// keep the slot NONE, renders as the literal spec
+		args.types[args.count++] = px4_log_deferred_arg_type::NONE;
+		return;
+	}
+
+	args.values[args.count].string_offset = args.string_used;
+	args.types[args.count++] = px4_log_deferred_arg_type::STRING;
+
+	strncpy(&args.strings[args.string_used], value, remaining - 1);
+	args.strings[PX4_LOG_DEFERRED_STRING_POOL - 1] = '\0';
+	args.string_used += strlen(&args.strings[args.string_used]) + 1;
+}
+
+inline void px4_log_deferred_store(px4_log_deferred_args &args, char *value)
+{
+	px4_log_deferred_store(args, (const char *)value);
+}
+
+template<typename T>
+inline typename std::enable_if < std::is_integral<T>::value &&std::is_signed<T>::value, void >::type
+px4_log_deferred_store(px4_log_deferred_args &args, T value)
+{
+	args.values[args.count].i = (int64_t)value;
+	args.types[args.count++] = px4_log_deferred_arg_type::INT;
+}
+
+template<typename T>
+inline typename std::enable_if < std::is_integral<T>::value && !std::is_signed<T>::value, void >::type
+px4_log_deferred_store(px4_log_deferred_args &args, T value)
+{
+	args.values[args.count].u = (uint64_t)value;
+	args.types[args.count++] = px4_log_deferred_arg_type::UINT;
+}
+
+template<typename T>
+inline typename std::enable_if<std::is_enum<T>::value, void>::type
+px4_log_deferred_store(px4_log_deferred_args &args, T value)
+{
+	args.values[args.count].i = (int64_t)value;
+	args.types[args.count++] = px4_log_deferred_arg_type::INT;
+}
+
+template<typename T>
+inline typename std::enable_if < std::is_pointer<T>::value &&
+!std::is_convertible<T, const char *>::value, void >::type
+px4_log_deferred_store(px4_log_deferred_args &args, T value)
+{
+	args.values[args.count].u = (uint64_t)(uintptr_t)value;
+	args.types[args.count++] = px4_log_deferred_arg_type::UINT;
+}
+
+inline void px4_log_deferred_pack(px4_log_deferred_args &args)
+{
+	(void)args;
+}
+
+template<typename T, typename... Rest>
+inline void px4_log_deferred_pack(px4_log_deferred_args &args, const T &value, const Rest &...rest)
+{
+	if (args.count < PX4_LOG_DEFERRED_MAX_ARGS) {
+		px4_log_deferred_store(args, value);
+	}
+
+	px4_log_deferred_pack(args, rest...);
+}
+
+template<typename... Args>
+inline void px4_log_deferred(int level, const char *module_name, const char *fmt, const Args &...args)
+{
+	px4_log_deferred_args captured;
+	px4_log_deferred_pack(captured, args...);
+	px4_log_deferred_push(level, module_name, fmt, captured);
+}
+
+#define PX4_INFO_DEFERRED(FMT, ...)	px4_log_deferred(_PX4_LOG_LEVEL_INFO, MODULE_NAME, FMT, ##__VA_ARGS__)
+#define PX4_WARN_DEFERRED(FMT, ...)	px4_log_deferred(_PX4_LOG_LEVEL_WARN, MODULE_NAME, FMT, ##__VA_ARGS__)
+#define PX4_ERR_DEFERRED(FMT, ...)	px4_log_deferred(_PX4_LOG_LEVEL_ERROR, MODULE_NAME, FMT, ##__VA_ARGS__)
+
+#if defined(DEBUG_BUILD)
+#define PX4_DEBUG_DEFERRED(FMT, ...)	px4_log_deferred(_PX4_LOG_LEVEL_DEBUG, MODULE_NAME, FMT, ##__VA_ARGS__)
+#else
+#define PX4_DEBUG_DEFERRED(FMT, ...)	__px4_log_omit(_PX4_LOG_LEVEL_DEBUG, FMT, ##__VA_ARGS__)
+#endif
@@ -41,6 +41,7 @@
 #include <unistd.h>
 #include <stdbool.h>
 
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/time.h>
 #include <px4_platform_common/log.h>
@@ -148,6 +149,10 @@ public:
 			return stop_command();
 		}
 
+		if (strcmp(argv[1], "ready") == 0) {
+			return ready_command();
+		}
+
 		lock_module(); // Lock here, as the method could access _object.
 		int ret = T::custom_command(argc - 1, argv + 1);
 		unlock_module();
@@ -270,6 +275,27 @@ public:
 		return ret;
 	}
 
+	/**
+	 * @brief Handle 'command ready': wait until the module finished its initialization
+	 *        (_object is set from the module's thread). This allows a startup script to
+	 *        launch independent modules concurrently ('command start &') and use
+	 *        'command ready' as a synchronization barrier before starting anything that
+	 *        depends on them. The hrt-stamped completion message shows up in the boot
+	 *        console output, so the per-module startup cost ends up in the log.
+	 * @return Returns 0 iff the module is up and initialized, -1 on timeout.
+	 */
+	static int ready_command()
+	{
+		// Wait longer than wait_until_running()'s default: the backgrounded 'start'
+		// may not even have spawned the task yet when we get here.
+		if (wait_until_running(5000) < 0) {
+			return -1;
+		}
+
+		PX4_INFO("ready at %.3fs", (double)hrt_absolute_time() * 1e-6);
+		return 0;
+	}
+
 	/**
 	 * @brief Handle 'command status': check if running and call print_status() if it is
 	 * @return Returns 0 iff successful, -1 otherwise.
@@ -492,11 +518,12 @@ __EXPORT void PRINT_MODULE_USAGE_COMMAND_DESCR(const char *name, const char *des
 	PRINT_MODULE_USAGE_COMMAND_DESCR(name, NULL);
 
 /**
- * @brief Prints the default commands: stop & status.
+ * @brief Prints the default commands: stop, status & ready.
  */
 #define PRINT_MODULE_USAGE_DEFAULT_COMMANDS() \
 	PRINT_MODULE_USAGE_COMMAND("stop"); \
-	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "print status info");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "print status info"); \
+	PRINT_MODULE_USAGE_COMMAND_DESCR("ready", "wait until the module finished initializing");
 
 /**
  * Print default params for I2C or SPI drivers
@@ -119,7 +119,7 @@ public:
 	Param()
 	{
 		param_set_used(handle());
-		update();
+		force_update();
 	}
 
 	float get() const { return _val; }
@@ -149,14 +149,30 @@ public:
 	void reset()
 	{
 		param_reset_no_notification(handle());
-		update();
+		force_update();
 	}
 
-	bool update() { return param_get(handle(), &_val) == 0; }
+	/// Re-read the value only if it changed since the last read
+	bool update()
+	{
+		if (param_generation(handle()) == _generation) {
+			return true;
+		}
+
+		return force_update();
+	}
+
+	/// Unconditionally re-read the value from the parameter storage
+	bool force_update()
+	{
+		_generation = param_generation(handle());
+		return param_get(handle(), &_val) == 0;
+	}
 
 	param_t handle() const { return param_handle(p); }
 private:
 	float _val;
+	uint16_t _generation{0};
 };
 
 // external version
@@ -171,7 +187,7 @@ public:
 		: _val(external_val)
 	{
 		param_set_used(handle());
-		update();
+		force_update();
 	}
 
 	float get() const { return _val; }
@@ -201,14 +217,30 @@ public:
 	void reset()
 	{
 		param_reset_no_notification(handle());
-		update();
+		force_update();
+	}
+
+	/// Re-read the value only if it changed since the last read
+	bool update()
+	{
+		if (param_generation(handle()) == _generation) {
+			return true;
+		}
+
+		return force_update();
 	}
 
-	bool update() { return param_get(handle(), &_val) == 0; }
+	/// Unconditionally re-read the value from the parameter storage
+	bool force_update()
+	{
+		_generation = param_generation(handle());
+		return param_get(handle(), &_val) == 0;
+	}
 
 	param_t handle() const { return param_handle(p); }
 private:
 	float &_val;
+	uint16_t _generation{0};
 };
 
 template<px4::params p>
@@ -221,7 +253,7 @@ public:
 	Param()
 	{
 		param_set_used(handle());
-		update();
+		force_update();
 	}
 
 	int32_t get() const { return _val; }
@@ -251,14 +283,30 @@ public:
 	void reset()
 	{
 		param_reset_no_notification(handle());
-		update();
+		force_update();
 	}
 
-	bool update() { return param_get(handle(), &_val) == 0; }
+	/// Re-read the value only if it changed since the last read
+	bool update()
+	{
+		if (param_generation(handle()) == _generation) {
+			return true;
+		}
+
+		return force_update();
+	}
+
+	/// Unconditionally re-read the value from the parameter storage
+	bool force_update()
+	{
+		_generation = param_generation(handle());
+		return param_get(handle(), &_val) == 0;
+	}
 
 	param_t handle() const { return param_handle(p); }
 private:
 	int32_t _val;
+	uint16_t _generation{0};
 };
 
 //external version
@@ -273,7 +321,7 @@ public:
 		: _val(external_val)
 	{
 		param_set_used(handle());
-		update();
+		force_update();
 	}
 
 	int32_t get() const { return _val; }
@@ -303,14 +351,30 @@ public:
 	void reset()
 	{
 		param_reset_no_notification(handle());
-		update();
+		force_update();
 	}
 
-	bool update() { return param_get(handle(), &_val) == 0; }
+	/// Re-read the value only if it changed since the last read
+	bool update()
+	{
+		if (param_generation(handle()) == _generation) {
+			return true;
+		}
+
+		return force_update();
+	}
+
+	/// Unconditionally re-read the value from the parameter storage
+	bool force_update()
+	{
+		_generation = param_generation(handle());
+		return param_get(handle(), &_val) == 0;
+	}
 
 	param_t handle() const { return param_handle(p); }
 private:
 	int32_t &_val;
+	uint16_t _generation{0};
 };
 
 template<px4::params p>
@@ -323,7 +387,7 @@ public:
 	Param()
 	{
 		param_set_used(handle());
-		update();
+		force_update();
 	}
 
 	bool get() const { return _val; }
@@ -361,11 +425,24 @@ public:
 	void reset()
 	{
 		param_reset_no_notification(handle());
-		update();
+		force_update();
 	}
 
+	/// Re-read the value only if it changed since the last read
 	bool update()
 	{
+		if (param_generation(handle()) == _generation) {
+			return true;
+		}
+
+		return force_update();
+	}
+
+	/// Unconditionally re-read the value from the parameter storage
+	bool force_update()
+	{
+		_generation = param_generation(handle());
+
 		int32_t value_int;
 		int ret = param_get(handle(), &value_int);
 
@@ -380,6 +457,7 @@ public:
 	param_t handle() const { return param_handle(p); }
 private:
 	bool _val;
+	uint16_t _generation{0};
 };
 
 template <px4::params p>
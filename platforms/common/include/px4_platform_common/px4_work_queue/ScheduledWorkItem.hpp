@@ -61,6 +61,17 @@ public:
 	 */
 	void ScheduleOnInterval(uint32_t interval_us, uint32_t delay_us = 0);
 
+	/**
+	 * Schedule repeating run at a state-dependent rate.
+	 *
+	 * Only re-arms the hrt call when the interval differs from the currently
+	 * active one, so a module can declare its desired rate on every cycle and
+	 * only pays for a timer update on state transitions.
+	 *
+	 * @param interval_us		The interval in microseconds.
+	 */
+	void ScheduleOnIntervalAdaptive(uint32_t interval_us);
+
 	/**
 	 * Schedule next run at a specific time.
 	 *
@@ -38,6 +38,7 @@
 
 #include <containers/IntrusiveQueue.hpp>
 #include <containers/IntrusiveSortedList.hpp>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/defines.h>
 #include <drivers/drv_hrt.h>
 #include <lib/mathlib/mathlib.h>
@@ -70,6 +71,58 @@ public:
 		}
 	}
 
+	/**
+	 * Schedule the item unless it is already pending on the queue.
+	 *
+	 * Coalesces redundant wakeups when several sources (eg uORB callbacks on
+	 * multiple topics) target the same item: the first notification schedules
+	 * the run, further ones before it executes are no-ops.
+	 */
+	inline void ScheduleNowCoalesced()
+	{
+		if (_wq != nullptr) {
+			bool expected = false;
+
+			if (_sched_pending.compare_exchange(&expected, true)) {
+				_wq->Add(this);
+			}
+		}
+	}
+
+	/**
+	 * Allow an idle work queue thread of equal or lower priority to steal and
+	 * run this item when its own queue is saturated (requires work stealing
+	 * to be enabled globally, see WorkQueue::set_work_stealing_enabled()).
+	 * Only mark items whose Run() does not depend on which wq thread executes
+	 * it (no thread local state, no queue-affine driver access).
+	 */
+	void set_migratable(bool migratable) { _migratable = migratable; }
+	bool migratable() const { return _migratable; }
+
+	/** Time the item was last queued (set while latency tracing is enabled). */
+	hrt_abstime time_queued() const { return _time_queued; }
+	void set_time_queued(const hrt_abstime &now) { _time_queued = now; }
+
+	/**
+	 * Declare a relative execution deadline, applied every time the item is
+	 * queued. Items with a deadline are dispatched earliest-deadline-first,
+	 * ahead of queue (FIFO) order, so a latency-critical item (eg the rate
+	 * controller) is not delayed behind unrelated work queued before it.
+	 * 0 (the default) keeps plain FIFO ordering.
+	 */
+	void set_deadline_us(uint32_t deadline_us)
+	{
+		_relative_deadline_us = deadline_us;
+
+		if (deadline_us == 0) {
+			_deadline = 0;
+		}
+	}
+
+	bool has_deadline() const { return _relative_deadline_us > 0; }
+	hrt_abstime deadline() const { return _deadline; }
+	void stamp_deadline(const hrt_abstime &now) { _deadline = now + _relative_deadline_us; }
+
 	virtual void print_run_status();
 
 	/**
@@ -99,6 +152,20 @@ protected:
 
 	void RunPreamble()
 	{
+		// allow coalesced scheduling again; notifications arriving while
+		// Run() executes must trigger another cycle
+		_sched_pending.store(false);
+
+		if (WorkQueue::latency_tracing_enabled() && (_time_queued != 0)) {
+			const hrt_abstime latency = hrt_elapsed_time(&_time_queued);
+			_latency_sum += latency;
+			_latency_count++;
+
+			if (latency > _latency_max) {
+				_latency_max = latency;
+			}
+		}
+
 		if (_run_count == 0) {
 			_time_first_run = hrt_absolute_time();
 			_run_count = 1;
@@ -134,6 +201,20 @@ private:
 
 	WorkQueue	*_wq{nullptr};
 
+	px4::atomic<bool> _sched_pending{false}; /**< scheduled via ScheduleNowCoalesced() and not yet run */
+
+	bool _migratable{false}; /**< may be run by another wq thread via work stealing */
+
+	// earliest-deadline-first dispatch (see set_deadline_us())
+	uint32_t _relative_deadline_us{0};
+	hrt_abstime _deadline{0}; /**< absolute deadline of the pending run, 0 if none */
+
+	// scheduling latency tracing (see WorkQueue::set_latency_tracing())
+	hrt_abstime _time_queued{0};
+	uint64_t _latency_sum{0};
+	uint32_t _latency_count{0};
+	uint32_t _latency_max{0};
+
 };
 
 } // namespace px4
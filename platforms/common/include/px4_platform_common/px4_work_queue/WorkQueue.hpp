@@ -38,11 +38,14 @@
 #include <containers/BlockingList.hpp>
 #include <containers/List.hpp>
 #include <containers/IntrusiveQueue.hpp>
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/sem.h>
 #include <px4_platform_common/tasks.h>
 
+#include <string.h>
+
 namespace px4
 {
 
@@ -69,6 +72,58 @@ public:
 
 	void Run();
 
+	/**
+	 * Remove and return the first migratable item from the queue, so an idle
+	 * work queue thread can run it (work stealing). Returns nullptr when
+	 * nothing queued is migratable.
+	 */
+	WorkItem *TrySteal();
+
+	/**
+	 * Remove and return the next item to run: the queued item with the
+	 * earliest absolute deadline, or the queue head (FIFO) when nothing
+	 * pending declares one. Must be called with the work lock held.
+	 */
+	WorkItem *PopNextDue();
+
+	/** True while the worker thread is blocked waiting for work. */
+	bool idle() const { return _idle.load(); }
+
+	inline void SignalWorkerThread();
+
+	/**
+	 * Enable/disable work stealing globally: idle work queue threads of equal
+	 * or lower priority run queued WorkItems marked migratable from saturated
+	 * queues (see `work_queue steal`).
+	 */
+	static void set_work_stealing_enabled(bool enabled) { _work_stealing_enabled.store(enabled); }
+	static bool work_stealing_enabled() { return _work_stealing_enabled.load(); }
+
+	static constexpr uint8_t WQ_TRACE_HIST_BUCKETS = 8;
+
+	/**
+	 * Enable/disable scheduling latency tracing for all queues (see
+	 * `work_queue top`). While enabled, every queue records the delay between
+	 * queuing an item and the start of its Run(), plus a Run() duration
+	 * histogram (power-of-4 microsecond buckets), and items record their own
+	 * queue-to-run latency.
+	 */
+	static void set_latency_tracing(bool enabled) { _latency_tracing.store(enabled); }
+	static bool latency_tracing_enabled() { return _latency_tracing.load(); }
+
+	uint32_t traced_run_count() const { return _traced_run_count; }
+	uint32_t latency_mean_us() const { return (_traced_run_count > 0) ? (_latency_sum / _traced_run_count) : 0; }
+	uint32_t latency_max_us() const { return _latency_max; }
+	const uint32_t *run_duration_histogram() const { return _run_duration_hist; }
+
+	void reset_trace_statistics()
+	{
+		_traced_run_count = 0;
+		_latency_sum = 0;
+		_latency_max = 0;
+		memset(_run_duration_hist, 0, sizeof(_run_duration_hist));
+	}
+
 	void request_stop() { _should_exit.store(true); }
 
 	void print_status(bool last = false);
@@ -80,8 +135,6 @@ private:
 
 	bool should_exit() const { return _should_exit.load(); }
 
-	inline void SignalWorkerThread();
-
 #ifdef __PX4_NUTTX
 	// In NuttX work can be enqueued from an ISR
 	void work_lock() { _flags = enter_critical_section(); }
@@ -100,6 +153,18 @@ private:
 	const wq_config_t		&_config;
 	BlockingList<WorkItem *>	_work_items;
 	px4::atomic_bool		_should_exit{false};
+	px4::atomic_bool		_idle{false};
+
+	static px4::atomic_bool		_work_stealing_enabled;
+	static px4::atomic_bool		_latency_tracing;
+
+	// scheduling latency tracing, recorded by the worker thread while _latency_tracing is enabled
+	uint32_t			_traced_run_count{0};
+	uint64_t			_latency_sum{0};   /**< queue-to-run delay (us) */
+	uint32_t			_latency_max{0};
+	uint32_t			_run_duration_hist[WQ_TRACE_HIST_BUCKETS] {};
+
+	void RecordTracedRun(const hrt_abstime &time_queued, const hrt_abstime &run_start, const hrt_abstime &run_duration);
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 	int _lockstep_component {-1};
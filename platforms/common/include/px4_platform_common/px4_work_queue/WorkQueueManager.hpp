@@ -38,12 +38,19 @@
 namespace px4
 {
 
+class WorkItem; // forward declaration
 class WorkQueue; // forward declaration
 
 struct wq_config_t {
 	const char *name;
 	uint16_t stacksize;
 	int8_t relative_priority; // relative to max
+
+	// Bitmask of CPU cores the queue's thread may run on (bit 0 = CPU 0).
+	// 0 (the default) leaves placement to the scheduler. Only honored on
+	// POSIX builds with affinity support (Linux); set per board/companion
+	// to pin latency-critical queues (eg rate_ctrl, INS0) to isolated cores.
+	uint16_t cpu_affinity_mask{0};
 };
 
 namespace wq_configurations
@@ -91,6 +98,10 @@ static constexpr wq_config_t ttyUnknown{"wq:ttyUnknown", 1632, -32};
 
 static constexpr wq_config_t lp_default{"wq:lp_default", 1920, -50};
 
+// parameter autosave: below everything else so bulk configuration writes
+// (GCS param uploads) never delay co-scheduled work items
+static constexpr wq_config_t param_autosave{"wq:param_autosave", 1920, -51};
+
 static constexpr wq_config_t test1{"wq:test1", 2000, 0};
 static constexpr wq_config_t test2{"wq:test2", 2000, 0};
 
@@ -119,6 +130,35 @@ int WorkQueueManagerStatus();
  */
 WorkQueue *WorkQueueFindOrCreate(const wq_config_t &new_wq);
 
+/**
+ * Invoke a callback for each running work queue (eg to export statistics).
+ *
+ * @param callback		Called with each WorkQueue while the manager list is locked.
+ * @param context		Passed through to the callback.
+ * @return		PX4_OK, or PX4_ERROR if the manager is not running.
+ */
+int WorkQueueManagerForEach(void (*callback)(WorkQueue *wq, void *context), void *context);
+
+/**
+ * Steal a migratable queued WorkItem from another work queue (work stealing).
+ *
+ * Only queues of equal or higher priority than the thief are considered, so a
+ * saturated high priority queue can be helped by idle lower priority threads
+ * without inverting the relative queue priorities.
+ *
+ * @param thief		The idle work queue looking for work.
+ * @return		A WorkItem removed from another queue, or nullptr.
+ */
+WorkItem *WorkQueueStealWork(WorkQueue *thief);
+
+/**
+ * Wake one idle work queue thread of equal or lower priority than the victim,
+ * so it can steal from the victim's backlog.
+ *
+ * @param victim		The work queue with queued migratable work.
+ */
+void WorkQueueWakeIdleThief(WorkQueue *victim);
+
 /**
  * Map a PX4 driver device id to a work queue (by sensor bus).
  *
@@ -175,6 +175,15 @@ __EXPORT bool px4_task_is_running(const char *taskname);
 #ifdef __PX4_POSIX
 /** set process (and thread) options */
 __EXPORT int px4_prctl(int option, const char *arg2, px4_task_t pid);
+
+/**
+ * Pin a task to a set of CPU cores.
+ *
+ * @param pid task id returned by px4_task_spawn_cmd, or -1 for the calling thread
+ * @param cpu_mask bitmask of allowed cores (bit 0 = CPU 0)
+ * @return 0 on success, -ESRCH for an unknown task, -ENOSYS where unsupported (only implemented on Linux)
+ */
+__EXPORT int px4_task_set_cpu_affinity(px4_task_t pid, unsigned cpu_mask);
 #endif
 
 /** return the name of the current task */
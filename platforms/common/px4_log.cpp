@@ -32,6 +32,7 @@
  ****************************************************************************/
 
 #include <assert.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -40,8 +41,11 @@
 #define MODULE_NAME "log"
 #endif
 
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/log.h>
+#include <px4_platform_common/log_deferred.h>
 #include <px4_platform_common/log_history.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #if defined(__PX4_POSIX)
 #include <px4_daemon/server_io.h>
 #endif
@@ -57,6 +61,282 @@ static LogHistory g_log_history;
 
 static orb_advert_t orb_log_message_pub = nullptr;
 
+namespace
+{
+
+// Fixed retention pool between the log producers and the log_message uORB queue
+// (which is only log_message_s::ORB_QUEUE_LENGTH deep). Messages are published
+// directly while the token bucket allows, matching what a consumer polling at
+// ~10 Hz can drain; bursts beyond that are parked here and delivered at the
+// paced rate by a low priority work item instead of silently overwriting the
+// oldest queue entries. When the pool itself overflows the least severe entries
+// are evicted first (errors survive, debug drops first).
+
+class LogMessageDrain : public px4::ScheduledWorkItem
+{
+public:
+	LogMessageDrain() : ScheduledWorkItem("log_message", px4::wq_configurations::lp_default) {}
+
+private:
+	void Run() override;
+};
+
+static constexpr uint8_t LOG_MESSAGE_POOL_SIZE = 16;
+static constexpr unsigned LOG_MESSAGE_TOKENS_MAX = log_message_s::ORB_QUEUE_LENGTH - 1;
+static constexpr uint32_t LOG_MESSAGE_DRAIN_INTERVAL_US = 50000; // 1 token per interval once the burst allowance is used
+
+static pthread_mutex_t log_message_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static log_message_s log_message_pool[LOG_MESSAGE_POOL_SIZE]; // index 0 is the oldest entry
+static uint8_t log_message_pool_count = 0;
+static uint16_t log_message_dropped = 0;
+static unsigned log_message_tokens = LOG_MESSAGE_TOKENS_MAX;
+static hrt_abstime log_message_last_refill = 0;
+static LogMessageDrain *log_message_drain = nullptr;
+static bool log_message_drain_requested = false;
+
+// must be called with log_message_pool_mutex held
+static void log_message_refill_tokens()
+{
+	const hrt_abstime now = hrt_absolute_time();
+	const unsigned refill = (now - log_message_last_refill) / LOG_MESSAGE_DRAIN_INTERVAL_US;
+
+	if (refill > 0) {
+		log_message_tokens += refill;
+
+		if (log_message_tokens > LOG_MESSAGE_TOKENS_MAX) {
+			log_message_tokens = LOG_MESSAGE_TOKENS_MAX;
+		}
+
+		log_message_last_refill = now;
+	}
+}
+
+static void log_message_publish(log_message_s &log_message)
+{
+	bool publish_now = false;
+	bool create_drain = false;
+	bool schedule = false;
+
+	pthread_mutex_lock(&log_message_pool_mutex);
+	log_message_refill_tokens();
+
+	if ((log_message_pool_count == 0) && (log_message_tokens > 0)) {
+		log_message_tokens--;
+		publish_now = true;
+
+	} else {
+		if (log_message_pool_count == LOG_MESSAGE_POOL_SIZE) {
+			// evict the least severe entry (numerically largest severity), oldest among equals
+			uint8_t worst = 0;
+
+			for (uint8_t i = 1; i < log_message_pool_count; i++) {
+				if (log_message_pool[i].severity > log_message_pool[worst].severity) {
+					worst = i;
+				}
+			}
+
+			log_message_dropped++;
+
+			if (log_message.severity > log_message_pool[worst].severity) {
+				// the incoming message is the least important one
+				pthread_mutex_unlock(&log_message_pool_mutex);
+				return;
+			}
+
+			memmove(&log_message_pool[worst], &log_message_pool[worst + 1],
+				(log_message_pool_count - worst - 1) * sizeof(log_message_s));
+			log_message_pool_count--;
+		}
+
+		log_message_pool[log_message_pool_count++] = log_message;
+
+		if (log_message_pool_count == 1) {
+			// first entry: kick off the paced drain (created lazily so the work queues exist)
+			if (!log_message_drain_requested) {
+				log_message_drain_requested = true;
+				create_drain = true;
+			}
+
+			schedule = true;
+		}
+	}
+
+	pthread_mutex_unlock(&log_message_pool_mutex);
+
+	// publish outside the pool lock: uORB does its own locking and may log on error
+	if (publish_now) {
+		orb_publish(ORB_ID(log_message), orb_log_message_pub, &log_message);
+		return;
+	}
+
+	if (create_drain) {
+		log_message_drain = new LogMessageDrain();
+	}
+
+	if (schedule && (log_message_drain != nullptr)) {
+		log_message_drain->ScheduleDelayed(LOG_MESSAGE_DRAIN_INTERVAL_US);
+	}
+}
+
+void LogMessageDrain::Run()
+{
+	log_message_s log_message;
+	bool publish = false;
+	bool reschedule = false;
+	uint16_t dropped = 0;
+
+	pthread_mutex_lock(&log_message_pool_mutex);
+	log_message_refill_tokens();
+
+	if ((log_message_pool_count > 0) && (log_message_tokens > 0)) {
+		log_message_tokens--;
+		log_message = log_message_pool[0];
+		log_message_pool_count--;
+		memmove(&log_message_pool[0], &log_message_pool[1], log_message_pool_count * sizeof(log_message_s));
+		publish = true;
+	}
+
+	if ((log_message_pool_count == 0) && (log_message_dropped > 0)) {
+		// the burst is over, surface the overflow
+		dropped = log_message_dropped;
+		log_message_dropped = 0;
+	}
+
+	reschedule = (log_message_pool_count > 0);
+	pthread_mutex_unlock(&log_message_pool_mutex);
+
+	if (publish) {
+		orb_publish(ORB_ID(log_message), orb_log_message_pub, &log_message);
+	}
+
+	if (dropped > 0) {
+		log_message_s overflow{};
+		overflow.severity = 4; // warning
+		snprintf((char *)overflow.text, sizeof(overflow.text), "[%s] buffer overflow, %u messages dropped", MODULE_NAME,
+			 dropped);
+		overflow.timestamp = hrt_absolute_time();
+		orb_publish(ORB_ID(log_message), orb_log_message_pub, &overflow);
+	}
+
+	if (reschedule) {
+		ScheduleDelayed(LOG_MESSAGE_DRAIN_INTERVAL_US);
+	}
+}
+
+// Deferred-formatting log statements (PX4_INFO_DEFERRED() and friends): the
+// call site only copies the format string pointer and the raw argument values
+// into this lock-free ring; rendering and delivery happen here, on the same
+// low priority queue as the paced drain above. The ring and the work item are
+// created on first use so boards that never log deferred pay no RAM.
+
+class DeferredLogDrain : public px4::ScheduledWorkItem
+{
+public:
+	DeferredLogDrain() : ScheduledWorkItem("log_deferred", px4::wq_configurations::lp_default) {}
+
+private:
+	void Run() override;
+};
+
+struct DeferredLogRecord {
+	const char *fmt;
+	const char *module_name;
+	hrt_abstime timestamp;
+	int8_t level;
+	px4_log_deferred_args args;
+};
+
+static constexpr uint32_t DEFERRED_LOG_RING_SIZE = 16; // power of two
+static constexpr uint32_t DEFERRED_LOG_DRAIN_INTERVAL_US = 50000;
+
+static pthread_mutex_t deferred_log_mutex = PTHREAD_MUTEX_INITIALIZER; // only guards one-time creation
+static px4::atomic<DeferredLogRecord *> deferred_log_ring{nullptr};
+static px4::atomic<uint8_t> deferred_log_ready[DEFERRED_LOG_RING_SIZE];
+static px4::atomic<uint32_t> deferred_log_head{0};	///< next slot to claim
+static px4::atomic<uint32_t> deferred_log_tail{0};	///< next slot to consume
+static px4::atomic<uint16_t> deferred_log_dropped{0};
+static DeferredLogDrain *deferred_log_drain = nullptr;
+
+static void deferred_log_deliver(const DeferredLogRecord &record)
+{
+	static constexpr ssize_t max_length = sizeof(log_message_s::text);
+
+	char text[max_length];
+	px4_log_deferred_render(record.fmt, record.args, text, sizeof(text));
+
+	FILE *out = stdout;
+
+#if defined(__PX4_POSIX)
+	bool isatty_ = false;
+	out = get_stdout(&isatty_);
+#endif // __PX4_POSIX
+
+	fprintf(out, __px4__log_level_fmt, __px4_log_level_str[record.level]);
+	fprintf(out, __px4__log_modulename_pfmt, record.module_name);
+	fputs(text, out);
+	fputc('\n', out);
+
+	if (record.level >= _PX4_LOG_LEVEL_INFO && orb_log_message_pub) {
+		const uint8_t log_level_table[] = {
+			7, /* _PX4_LOG_LEVEL_DEBUG */
+			6, /* _PX4_LOG_LEVEL_INFO */
+			4, /* _PX4_LOG_LEVEL_WARN */
+			3, /* _PX4_LOG_LEVEL_ERROR */
+			0  /* _PX4_LOG_LEVEL_PANIC */
+		};
+
+		log_message_s log_message;
+		log_message.severity = log_level_table[record.level];
+		ssize_t pos = snprintf((char *)log_message.text, max_length, __px4__log_modulename_pfmt, record.module_name);
+		strncpy((char *)log_message.text + pos, text, math::max(max_length - pos, (ssize_t)0));
+		log_message.text[max_length - 1] = 0;
+		log_message.timestamp = record.timestamp;
+		log_message_publish(log_message);
+	}
+}
+
+void DeferredLogDrain::Run()
+{
+	DeferredLogRecord *ring = deferred_log_ring.load();
+
+	if (ring == nullptr) {
+		return;
+	}
+
+	uint32_t tail = deferred_log_tail.load();
+
+	while (tail != deferred_log_head.load()) {
+		const uint32_t index = tail % DEFERRED_LOG_RING_SIZE;
+
+		if (deferred_log_ready[index].load() == 0) {
+			// a producer claimed the slot but is still writing it
+			break;
+		}
+
+		const DeferredLogRecord record = ring[index];
+		deferred_log_ready[index].store(0);
+		deferred_log_tail.store(++tail);
+
+		deferred_log_deliver(record);
+	}
+
+	const uint16_t dropped = deferred_log_dropped.load();
+
+	if ((dropped > 0) && (tail == deferred_log_head.load())) {
+		// the burst is over, surface the overflow
+		deferred_log_dropped.fetch_sub(dropped);
+
+		log_message_s overflow{};
+		overflow.severity = 4; // warning
+		snprintf((char *)overflow.text, sizeof(overflow.text), "[%s] deferred log overflow, %u records dropped",
+			 MODULE_NAME, dropped);
+		overflow.timestamp = hrt_absolute_time();
+		log_message_publish(overflow);
+	}
+}
+
+} // namespace
+
 __EXPORT const char *__px4_log_level_str[_PX4_LOG_LEVEL_PANIC + 1] = { "DEBUG", "INFO", "WARN", "ERROR", "PANIC" };
 
 static constexpr const char *__px4_log_level_color[_PX4_LOG_LEVEL_PANIC + 1] {
@@ -77,6 +357,55 @@ void px4_log_initialize(void)
 	orb_log_message_pub = orb_advertise_queue(ORB_ID(log_message), &log_message, log_message_s::ORB_QUEUE_LENGTH);
 }
 
+__EXPORT void px4_log_deferred_push(int level, const char *module_name, const char *fmt,
+				    const px4_log_deferred_args &args)
+{
+	DeferredLogRecord *ring = deferred_log_ring.load();
+
+	if (ring == nullptr) {
+		// one-time setup, off the fast path (needs the work queues running)
+		pthread_mutex_lock(&deferred_log_mutex);
+
+		if (deferred_log_ring.load() == nullptr) {
+			if (deferred_log_drain == nullptr) {
+				deferred_log_drain = new DeferredLogDrain();
+			}
+
+			ring = new DeferredLogRecord[DEFERRED_LOG_RING_SIZE];
+
+			if ((deferred_log_drain != nullptr) && (ring != nullptr)) {
+				deferred_log_drain->ScheduleOnInterval(DEFERRED_LOG_DRAIN_INTERVAL_US);
+				deferred_log_ring.store(ring);
+			}
+		}
+
+		pthread_mutex_unlock(&deferred_log_mutex);
+		ring = deferred_log_ring.load();
+
+		if (ring == nullptr) {
+			return;
+		}
+	}
+
+	uint32_t pos = deferred_log_head.load();
+
+	do {
+		if (pos - deferred_log_tail.load() >= DEFERRED_LOG_RING_SIZE) {
+			// full: drop here rather than block or format on the caller's thread
+			deferred_log_dropped.fetch_add(1);
+			return;
+		}
+	} while (!deferred_log_head.compare_exchange(&pos, pos + 1));
+
+	DeferredLogRecord &record = ring[pos % DEFERRED_LOG_RING_SIZE];
+	record.fmt = fmt;
+	record.module_name = module_name;
+	record.timestamp = hrt_absolute_time();
+	record.level = (int8_t)level;
+	record.args = args;
+	deferred_log_ready[pos % DEFERRED_LOG_RING_SIZE].store(1);
+}
+
 __EXPORT void px4_log_modulename(int level, const char *module_name, const char *fmt, ...)
 {
 	static constexpr ssize_t max_length = sizeof(log_message_s::text);
@@ -199,7 +528,7 @@ __EXPORT void px4_log_modulename(int level, const char *module_name, const char
 		va_end(argptr);
 		log_message.text[max_length - 1] = 0; //ensure 0-termination
 		log_message.timestamp = hrt_absolute_time();
-		orb_publish(ORB_ID(log_message), orb_log_message_pub, &log_message);
+		log_message_publish(log_message);
 	}
 }
 
@@ -0,0 +1,289 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file px4_log_deferred.cpp
+ *
+ * Renderer for deferred log records: re-applies the captured arguments to
+ * the original printf format string. Kept free of uORB and work queue
+ * dependencies so it can run anywhere (device side log consumer, tests,
+ * offline tooling).
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <px4_platform_common/log_deferred.h>
+
+namespace
+{
+
+// conversion classes a spec can resolve to
+enum class conv_class { INTEGER, UNSIGNED, FLOAT, CHAR, STRING, POINTER, UNSUPPORTED };
+
+conv_class classify(char conversion)
+{
+	switch (conversion) {
+	case 'd':
+	case 'i':
+		return conv_class::INTEGER;
+
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+		return conv_class::UNSIGNED;
+
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		return conv_class::FLOAT;
+
+	case 'c':
+		return conv_class::CHAR;
+
+	case 's':
+		return conv_class::STRING;
+
+	case 'p':
+		return conv_class::POINTER;
+
+	default:
+		return conv_class::UNSUPPORTED;
+	}
+}
+
+// captured values are widened at the call site, coerce to what the spec needs
+long long as_signed(const px4_log_deferred_args::value_u &value, px4_log_deferred_arg_type type)
+{
+	switch (type) {
+	case px4_log_deferred_arg_type::UINT: return (long long)value.u;
+
+	case px4_log_deferred_arg_type::DOUBLE: return (long long)value.d;
+
+	default: return (long long)value.i;
+	}
+}
+
+unsigned long long as_unsigned(const px4_log_deferred_args::value_u &value, px4_log_deferred_arg_type type)
+{
+	switch (type) {
+	case px4_log_deferred_arg_type::INT: return (unsigned long long)value.i;
+
+	case px4_log_deferred_arg_type::DOUBLE: return (unsigned long long)value.d;
+
+	default: return (unsigned long long)value.u;
+	}
+}
+
+double as_double(const px4_log_deferred_args::value_u &value, px4_log_deferred_arg_type type)
+{
+	switch (type) {
+	case px4_log_deferred_arg_type::INT: return (double)value.i;
+
+	case px4_log_deferred_arg_type::UINT: return (double)value.u;
+
+	default: return value.d;
+	}
+}
+
+} // namespace
+
+int px4_log_deferred_render(const char *fmt, const px4_log_deferred_args &args, char *out, size_t out_size)
+{
+	if (out_size == 0) {
+		return 0;
+	}
+
+	size_t out_pos = 0;
+	unsigned arg_index = 0;
+	const char *p = fmt;
+
+	while (*p != '\0' && out_pos + 1 < out_size) {
+		if (*p != '%') {
+			out[out_pos++] = *p++;
+			continue;
+		}
+
+		const char *spec_start = p++;
+
+		if (*p == '%') {
+			out[out_pos++] = '%';
+			p++;
+			continue;
+		}
+
+		// rebuild the spec: keep flags, width and precision, drop length
+		// modifiers (arguments were widened at capture) and re-add the
+		// width of the stored type instead
+		char spec[24];
+		unsigned spec_len = 0;
+		spec[spec_len++] = '%';
+
+		while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+			if (spec_len < sizeof(spec) - 5) { spec[spec_len++] = *p; }
+
+			p++;
+		}
+
+		for (int part = 0; part < 2; part++) {
+			if (part == 1) {
+				if (*p != '.') { break; }
+
+				if (spec_len < sizeof(spec) - 5) { spec[spec_len++] = *p; }
+
+				p++;
+			}
+
+			if (*p == '*') {
+				// dynamic width/precision consumes an argument
+				int dynamic = 0;
+
+				if (arg_index < args.count) {
+					dynamic = (int)as_signed(args.values[arg_index], args.types[arg_index]);
+					arg_index++;
+				}
+
+				spec_len += snprintf(&spec[spec_len], sizeof(spec) - spec_len - 4, "%d", dynamic);
+				p++;
+
+			} else {
+				while (*p >= '0' && *p <= '9') {
+					if (spec_len < sizeof(spec) - 5) { spec[spec_len++] = *p; }
+
+					p++;
+				}
+			}
+		}
+
+		while (*p == 'h' || *p == 'l' || *p == 'j' || *p == 'z' || *p == 't' || *p == 'L') {
+			p++;
+		}
+
+		const char conversion = *p;
+
+		if (conversion == '\0') {
+			break;
+		}
+
+		p++;
+
+		const conv_class cls = classify(conversion);
+		const bool have_arg = (arg_index < args.count) && (args.types[arg_index] != px4_log_deferred_arg_type::NONE);
+
+		if (cls == conv_class::UNSUPPORTED || !have_arg) {
+			// keep the literal spec visible, like printf does for unknown
+			// conversions, instead of guessing
+			for (const char *q = spec_start; q < p && out_pos + 1 < out_size; q++) {
+				out[out_pos++] = *q;
+			}
+
+			if (arg_index < args.count) {
+				arg_index++;
+			}
+
+			continue;
+		}
+
+		const px4_log_deferred_args::value_u &value = args.values[arg_index];
+		const px4_log_deferred_arg_type type = args.types[arg_index];
+		arg_index++;
+
+		const size_t remaining = out_size - out_pos;
+		int written = 0;
+
+		switch (cls) {
+		case conv_class::INTEGER:
+			spec[spec_len++] = 'l';
+			spec[spec_len++] = 'l';
+			spec[spec_len++] = conversion;
+			spec[spec_len] = '\0';
+			written = snprintf(&out[out_pos], remaining, spec, as_signed(value, type));
+			break;
+
+		case conv_class::UNSIGNED:
+			spec[spec_len++] = 'l';
+			spec[spec_len++] = 'l';
+			spec[spec_len++] = conversion;
+			spec[spec_len] = '\0';
+			written = snprintf(&out[out_pos], remaining, spec, as_unsigned(value, type));
+			break;
+
+		case conv_class::FLOAT:
+			spec[spec_len++] = conversion;
+			spec[spec_len] = '\0';
+			written = snprintf(&out[out_pos], remaining, spec, as_double(value, type));
+			break;
+
+		case conv_class::CHAR:
+			spec[spec_len++] = conversion;
+			spec[spec_len] = '\0';
+			written = snprintf(&out[out_pos], remaining, spec, (int)as_signed(value, type));
+			break;
+
+		case conv_class::STRING:
+			spec[spec_len++] = conversion;
+			spec[spec_len] = '\0';
+
+			if (type == px4_log_deferred_arg_type::STRING) {
+				written = snprintf(&out[out_pos], remaining, spec, &args.strings[value.string_offset]);
+
+			} else {
+				written = snprintf(&out[out_pos], remaining, "(?)");
+			}
+
+			break;
+
+		case conv_class::POINTER:
+			spec[spec_len++] = conversion;
+			spec[spec_len] = '\0';
+			written = snprintf(&out[out_pos], remaining, spec, (void *)(uintptr_t)as_unsigned(value, type));
+			break;
+
+		default:
+			break;
+		}
+
+		if (written > 0) {
+			out_pos += ((size_t)written < remaining) ? (size_t)written : (remaining - 1);
+		}
+	}
+
+	out[out_pos] = '\0';
+	return (int)out_pos;
+}
@@ -0,0 +1,142 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <inttypes.h>
+
+#include <px4_platform_common/log_deferred.h>
+
+/**
+ * @file px4_log_deferred_test.cpp
+ *
+ * Unit tests for the deferred log capture templates and the renderer that
+ * re-applies captured arguments to the original format string.
+ */
+
+template<typename... Args>
+static px4_log_deferred_args capture(const Args &...args)
+{
+	px4_log_deferred_args captured;
+	px4_log_deferred_pack(captured, args...);
+	return captured;
+}
+
+template<typename... Args>
+static std::string render(const char *fmt, const Args &...args)
+{
+	const px4_log_deferred_args captured = capture(args...);
+	char out[128];
+	px4_log_deferred_render(fmt, captured, out, sizeof(out));
+	return out;
+}
+
+TEST(LogDeferredTest, rendersIntegers)
+{
+	EXPECT_EQ(render("got %d of %d", -3, 10), "got -3 of 10");
+	EXPECT_EQ(render("hex %04x", 0xabu), "hex 00ab");
+	EXPECT_EQ(render("wide %8lld", (long long) -42), "wide      -42");
+}
+
+TEST(LogDeferredTest, normalizesLengthModifiers)
+{
+	// arguments are widened at capture, the renderer drops the original
+	// length modifier and formats the stored 64 bit value
+	EXPECT_EQ(render("size %zu", (size_t)123), "size 123");
+	EXPECT_EQ(render("u64 %" PRIu64, (uint64_t)1ull << 40), "u64 1099511627776");
+	EXPECT_EQ(render("short %hd", (short) -7), "short -7");
+}
+
+TEST(LogDeferredTest, rendersFloats)
+{
+	EXPECT_EQ(render("alt %.2f m", 12.345), "alt 12.35 m");
+	EXPECT_EQ(render("ratio %.1f", 0.5f), "ratio 0.5");
+}
+
+TEST(LogDeferredTest, copiesStrings)
+{
+	char transient[16];
+	strcpy(transient, "mag_0");
+	px4_log_deferred_args captured = capture(static_cast<char *>(transient));
+	strcpy(transient, "overwritten");
+
+	char out[64];
+	px4_log_deferred_render("sensor %s failed", captured, out, sizeof(out));
+	EXPECT_STREQ(out, "sensor mag_0 failed");
+}
+
+TEST(LogDeferredTest, truncatesStringsToPool)
+{
+	std::string long_string(2 * PX4_LOG_DEFERRED_STRING_POOL, 'x');
+	const std::string rendered = render("%s", long_string.c_str());
+
+	EXPECT_EQ(rendered, std::string(PX4_LOG_DEFERRED_STRING_POOL - 1, 'x'));
+}
+
+TEST(LogDeferredTest, rendersCharAndPercent)
+{
+	EXPECT_EQ(render("load %d%%", 85), "load 85%");
+	EXPECT_EQ(render("axis %c", 'x'), "axis x");
+}
+
+TEST(LogDeferredTest, dynamicWidthConsumesArgument)
+{
+	EXPECT_EQ(render("val %*d", 5, 7), "val     7");
+}
+
+TEST(LogDeferredTest, keepsExcessConversionsVisible)
+{
+	// more conversions than captured arguments: the spec stays visible
+	EXPECT_EQ(render("a %d b %d", 1), "a 1 b %d");
+}
+
+TEST(LogDeferredTest, dropsExcessArguments)
+{
+	px4_log_deferred_args captured = capture(1, 2, 3, 4, 5, 6, 7, 8);
+	EXPECT_EQ(captured.count, PX4_LOG_DEFERRED_MAX_ARGS);
+}
+
+TEST(LogDeferredTest, coercesMismatchedTypes)
+{
+	// %d with a float argument still renders a number instead of garbage
+	EXPECT_EQ(render("n %d", 3.9), "n 3");
+}
+
+TEST(LogDeferredTest, respectsOutputBounds)
+{
+	const px4_log_deferred_args captured = capture(123456789);
+	char out[8];
+	const int written = px4_log_deferred_render("value %d tail", captured, out, sizeof(out));
+
+	EXPECT_LT(written, (int)sizeof(out));
+	EXPECT_EQ(strlen(out), (size_t)written);
+}
@@ -60,6 +60,13 @@ void ScheduledWorkItem::ScheduleOnInterval(uint32_t interval_us, uint32_t delay_
 	hrt_call_every(&_call, delay_us, interval_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
 }
 
+void ScheduledWorkItem::ScheduleOnIntervalAdaptive(uint32_t interval_us)
+{
+	if (_call.period != interval_us) {
+		ScheduleOnInterval(interval_us);
+	}
+}
+
 void ScheduledWorkItem::ScheduleAt(hrt_abstime time_us)
 {
 	hrt_call_at(&_call, time_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
@@ -102,6 +102,8 @@ void WorkItem::ScheduleClear()
 	if (_wq != nullptr) {
 		_wq->Remove(this);
 	}
+
+	_sched_pending.store(false);
 }
 
 float WorkItem::elapsed_time() const
@@ -134,10 +136,20 @@ float WorkItem::average_interval() const
 
 void WorkItem::print_run_status()
 {
-	PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us\n", _item_name, (double)average_rate(), (double)average_interval());
+	PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us", _item_name, (double)average_rate(), (double)average_interval());
+
+	if (_latency_count > 0) {
+		PX4_INFO_RAW("   latency avg %6lu us, max %6lu us", (unsigned long)(_latency_sum / _latency_count),
+			     (unsigned long)_latency_max);
+	}
+
+	PX4_INFO_RAW("\n");
 
 	// reset statistics
 	_run_count = 0;
+	_latency_sum = 0;
+	_latency_count = 0;
+	_latency_max = 0;
 }
 
 } // namespace px4
@@ -36,6 +36,7 @@
 
 #include <string.h>
 
+#include <px4_platform_common/cycle_time.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/time.h>
@@ -44,6 +45,9 @@
 namespace px4
 {
 
+px4::atomic_bool WorkQueue::_work_stealing_enabled{false};
+px4::atomic_bool WorkQueue::_latency_tracing{false};
+
 WorkQueue::WorkQueue(const wq_config_t &config) :
 	_config(config)
 {
@@ -54,6 +58,19 @@ WorkQueue::WorkQueue(const wq_config_t &config) :
 	pthread_setname_np(pthread_self(), _config.name);
 #endif
 
+#ifdef __PX4_LINUX
+
+	// pin this queue's thread to the configured cores
+	if (_config.cpu_affinity_mask != 0) {
+		int ret = px4_task_set_cpu_affinity(-1, _config.cpu_affinity_mask);
+
+		if (ret != 0) {
+			PX4_WARN("%s: failed to set cpu affinity 0x%x (%d)", _config.name, _config.cpu_affinity_mask, ret);
+		}
+	}
+
+#endif /* __PX4_LINUX */
+
 #ifndef __PX4_NUTTX
 	px4_sem_init(&_qlock, 0, 1);
 #endif /* __PX4_NUTTX */
@@ -138,10 +155,71 @@ void WorkQueue::Add(WorkItem *item)
 
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
+	if (latency_tracing_enabled()) {
+		item->set_time_queued(hrt_absolute_time());
+	}
+
+	if (item->has_deadline()) {
+		item->stamp_deadline(hrt_absolute_time());
+	}
+
+	// a migratable item queued behind other work is a candidate for stealing
+	const bool backlog = _work_stealing_enabled.load() && !_q.empty() && item->migratable();
+
 	_q.push(item);
 	work_unlock();
 
 	SignalWorkerThread();
+
+	if (backlog) {
+#ifdef __PX4_NUTTX
+
+		if (up_interrupt_context()) {
+			// waking a thief requires the manager list mutex, deferred to the thief's next idle pass
+			return;
+		}
+
+#endif /* __PX4_NUTTX */
+		WorkQueueWakeIdleThief(this);
+	}
+}
+
+WorkItem *WorkQueue::PopNextDue()
+{
+	// items with a deadline are dispatched earliest-deadline-first, ahead of FIFO order
+	WorkItem *earliest = nullptr;
+
+	for (WorkItem *item : _q) {
+		if ((item->deadline() != 0) && ((earliest == nullptr) || (item->deadline() < earliest->deadline()))) {
+			earliest = item;
+		}
+	}
+
+	if (earliest == nullptr) {
+		return _q.pop();
+	}
+
+	_q.remove(earliest);
+	return earliest;
+}
+
+WorkItem *WorkQueue::TrySteal()
+{
+	WorkItem *stolen = nullptr;
+
+	work_lock();
+
+	for (WorkItem *item : _q) {
+		if (item->migratable()) {
+			_q.remove(item);
+			stolen = item;
+			break;
+		}
+	}
+
+	work_unlock();
+
+	return stolen;
 }
 
 void WorkQueue::SignalWorkerThread()
@@ -174,19 +252,37 @@ void WorkQueue::Clear()
 void WorkQueue::Run()
 {
 	while (!should_exit()) {
+		_idle.store(true);
+
 		// loop as the wait may be interrupted by a signal
 		do {} while (px4_sem_wait(&_process_lock) != 0);
 
+		_idle.store(false);
+
 		work_lock();
 
 		// process queued work
 		while (!_q.empty()) {
-			WorkItem *work = _q.pop();
+			WorkItem *work = PopNextDue();
 
 			work_unlock(); // unlock work queue to run (item may requeue itself)
-			work->RunPreamble();
-			work->Run();
-			// Note: after Run() we cannot access work anymore, as it might have been deleted
+
+			if (latency_tracing_enabled()) {
+				const hrt_abstime time_queued = work->time_queued();
+				const hrt_abstime run_start = hrt_absolute_time();
+				px4_cycle_time_update(run_start);
+				work->RunPreamble();
+				work->Run();
+				// Note: after Run() we cannot access work anymore, as it might have been deleted
+				RecordTracedRun(time_queued, run_start, hrt_elapsed_time(&run_start));
+
+			} else {
+				px4_cycle_time_update(hrt_absolute_time());
+				work->RunPreamble();
+				work->Run();
+				// Note: after Run() we cannot access work anymore, as it might have been deleted
+			}
+
 			work_lock(); // re-lock
 		}
 
@@ -200,15 +296,67 @@ void WorkQueue::Run()
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
 		work_unlock();
+
+		// local queue drained: help out a saturated queue of equal or higher priority
+		while (_work_stealing_enabled.load()) {
+			WorkItem *stolen = WorkQueueStealWork(this);
+
+			if (stolen == nullptr) {
+				break;
+			}
+
+			px4_cycle_time_update(hrt_absolute_time());
+			stolen->RunPreamble();
+			stolen->Run();
+			// Note: after Run() we cannot access stolen anymore, as it might have been deleted
+
+			if (!_q.empty()) {
+				// our own work takes precedence again
+				break;
+			}
+		}
 	}
 
 	PX4_DEBUG("%s: exiting", _config.name);
 }
 
+void WorkQueue::RecordTracedRun(const hrt_abstime &time_queued, const hrt_abstime &run_start,
+				const hrt_abstime &run_duration)
+{
+	_traced_run_count++;
+
+	if ((time_queued != 0) && (run_start > time_queued)) {
+		const hrt_abstime latency = run_start - time_queued;
+		_latency_sum += latency;
+
+		if (latency > _latency_max) {
+			_latency_max = latency;
+		}
+	}
+
+	// power-of-4 bucket bounds: 1, 4, 16, 64, 256, 1024, 4096, >4096 us
+	uint8_t bucket = 0;
+	hrt_abstime bound = 1;
+
+	while ((bucket < WQ_TRACE_HIST_BUCKETS - 1) && (run_duration > bound)) {
+		bound *= 4;
+		bucket++;
+	}
+
+	_run_duration_hist[bucket]++;
+}
+
 void WorkQueue::print_status(bool last)
 {
 	const size_t num_items = _work_items.size();
-	PX4_INFO_RAW("%-16s\n", get_name());
+	PX4_INFO_RAW("%-16s", get_name());
+
+	if (latency_tracing_enabled() && (_traced_run_count > 0)) {
+		PX4_INFO_RAW(" (%lu runs, sched latency avg %lu us, max %lu us)", (unsigned long)_traced_run_count,
+			     (unsigned long)latency_mean_us(), (unsigned long)_latency_max);
+	}
+
+	PX4_INFO_RAW("\n");
 	unsigned i = 0;
 
 	for (WorkItem *item : _work_items) {
@@ -119,6 +119,64 @@ WorkQueueFindOrCreate(const wq_config_t &new_wq)
 	return wq;
 }
 
+int
+WorkQueueManagerForEach(void (*callback)(WorkQueue *wq, void *context), void *context)
+{
+	if ((_wq_manager_wqs_list == nullptr) || (callback == nullptr)) {
+		return PX4_ERROR;
+	}
+
+	LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+	for (WorkQueue *wq : *_wq_manager_wqs_list) {
+		callback(wq, context);
+	}
+
+	return PX4_OK;
+}
+
+WorkItem *
+WorkQueueStealWork(WorkQueue *thief)
+{
+	if ((_wq_manager_wqs_list == nullptr) || (thief == nullptr)) {
+		return nullptr;
+	}
+
+	LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+	for (WorkQueue *wq : *_wq_manager_wqs_list) {
+		// only steal from queues of equal or higher priority
+		if ((wq != thief) && (wq->get_config().relative_priority >= thief->get_config().relative_priority)) {
+			WorkItem *item = wq->TrySteal();
+
+			if (item != nullptr) {
+				return item;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+void
+WorkQueueWakeIdleThief(WorkQueue *victim)
+{
+	if ((_wq_manager_wqs_list == nullptr) || (victim == nullptr)) {
+		return;
+	}
+
+	LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+	for (WorkQueue *wq : *_wq_manager_wqs_list) {
+		// wake one idle thread of equal or lower priority to come and steal
+		if ((wq != victim) && wq->idle()
+		    && (wq->get_config().relative_priority <= victim->get_config().relative_priority)) {
+			wq->SignalWorkerThread();
+			return;
+		}
+	}
+}
+
 const wq_config_t &
 device_bus_to_wq(uint32_t device_id_int)
 {
@@ -210,7 +268,9 @@ serial_port_to_wq(const char *serial)
 
 const wq_config_t &ins_instance_to_wq(uint8_t instance)
 {
-	switch (instance) {
+	// instances beyond the available INS queues wrap so that multi-EKF setups with
+	// more instances than queues still distribute across all of them
+	switch (instance % 4) {
 	case 0: return wq_configurations::INS0;
 
 	case 1: return wq_configurations::INS1;
@@ -220,8 +280,6 @@ const wq_config_t &ins_instance_to_wq(uint8_t instance)
 	case 3: return wq_configurations::INS3;
 	}
 
-	PX4_WARN("no INS%d wq configuration, using INS0", instance);
-
 	return wq_configurations::INS0;
 }
 
@@ -33,125 +33,72 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include "uORBTopics.h"
+
+/**
+ * Set of uORB topics with static storage.
+ *
+ * Topics are stored as a bitmap keyed by their ORB_ID, so insert/find/erase
+ * are O(1) and no heap allocation or string duplication happens at runtime.
+ * The name-based methods resolve the name through the topic name hash index
+ * (see orb_get_topic_meta()); names that do not match any known topic are
+ * ignored.
+ */
 class ORBSet
 {
 public:
-	struct Node {
-		Node *next{nullptr};
-		const char *node_name{nullptr};
-	};
-
 	ORBSet() = default;
+	~ORBSet() = default;
 
-	~ORBSet()
+	void insert(const char *node_name)
 	{
-		while (_top != nullptr) {
-			unlinkNext(_top);
+		const orb_metadata *meta = orb_get_topic_meta(node_name);
 
-			if (_top->next == nullptr) {
-				free((void *)_top->node_name);
-				_top->node_name = nullptr;
-
-				delete _top;
-				_top = nullptr;
-			}
+		if (meta != nullptr) {
+			insert(static_cast<ORB_ID>(meta->o_id));
 		}
 	}
 
-	void insert(const char *node_name)
+	bool find(const char *node_name) const
 	{
-		Node **p;
-
-		if (_top == nullptr) {
-			p = &_top;
-
-		} else {
-			p = &_end->next;
-		}
-
-		*p = new Node();
-
-		if (_end) {
-			_end = _end->next;
-
-		} else {
-			_end = _top;
-		}
-
-		_end->next = nullptr;
-		_end->node_name = strdup(node_name);
+		const orb_metadata *meta = orb_get_topic_meta(node_name);
+		return (meta != nullptr) && find(static_cast<ORB_ID>(meta->o_id));
 	}
 
-	bool find(const char *node_name)
+	bool erase(const char *node_name)
 	{
-		Node *p = _top;
-
-		while (p) {
-			if (strcmp(p->node_name, node_name) == 0) {
-				return true;
-			}
+		const orb_metadata *meta = orb_get_topic_meta(node_name);
+		return (meta != nullptr) && erase(static_cast<ORB_ID>(meta->o_id));
+	}
 
-			p = p->next;
+	void insert(ORB_ID id)
+	{
+		if (id != ORB_ID::INVALID) {
+			_bitmap[word(id)] |= mask(id);
 		}
-
-		return false;
 	}
 
-	bool erase(const char *node_name)
+	bool find(ORB_ID id) const
 	{
-		Node *p = _top;
-
-		if (_top && (strcmp(_top->node_name, node_name) == 0)) {
-			p = _top->next;
-
-			if (_top->node_name) {
-				free((void *)_top->node_name);
-				_top->node_name = nullptr;
-			}
-
-			delete _top;
-			_top = p;
-
-			if (_top == nullptr) {
-				_end = nullptr;
-			}
+		return (id != ORB_ID::INVALID) && ((_bitmap[word(id)] & mask(id)) != 0);
+	}
 
+	bool erase(ORB_ID id)
+	{
+		if (find(id)) {
+			_bitmap[word(id)] &= ~mask(id);
 			return true;
 		}
 
-		while (p->next) {
-			if (strcmp(p->next->node_name, node_name) == 0) {
-				unlinkNext(p);
-				return true;
-			}
-		}
-
 		return false;
 	}
 
 private:
 
-	void unlinkNext(Node *a)
-	{
-		Node *b = a->next;
-
-		if (b != nullptr) {
-			if (_end == b) {
-				_end = a;
-			}
-
-			a->next = b->next;
-
-			if (b->node_name) {
-				free((void *)b->node_name);
-				b->node_name = nullptr;
-			}
-
-			delete b;
-			b = nullptr;
-		}
-	}
+	static constexpr size_t word(ORB_ID id) { return static_cast<size_t>(id) / 32; }
+	static constexpr uint32_t mask(ORB_ID id) { return 1u << (static_cast<size_t>(id) % 32); }
 
-	Node *_top{nullptr};
-	Node *_end{nullptr};
+	uint32_t _bitmap[(ORB_TOPICS_COUNT + 31) / 32] {};
 };
@@ -103,6 +103,48 @@ public:
 	}
 };
 
+/**
+ * uORB publication multi wrapper with a zero-copy lend/commit path.
+ *
+ * Multi-instance counterpart of PublicationLend: the publisher obtains a
+ * write slot with lend(), constructs the message in place and calls commit(),
+ * avoiding the publish-side memcpy. Where lending is not available (protected
+ * builds, allocation failure) lend() returns nullptr and the caller should
+ * fall back to publish().
+ */
+template<typename T, uint8_t QSIZE = DefaultQueueSize<T>::value>
+class PublicationMultiLend : public PublicationMulti<T, QSIZE>
+{
+	static_assert(QSIZE > 1, "lend/commit requires a queued topic (queue size > 1)");
+
+public:
+	PublicationMultiLend(ORB_ID id) : PublicationMulti<T, QSIZE>(id) {}
+	PublicationMultiLend(const orb_metadata *meta) : PublicationMulti<T, QSIZE>(meta) {}
+
+	/**
+	 * Obtain a write slot for in-place construction.
+	 * @return slot pointer, or nullptr if the caller must fall back to publish().
+	 */
+	T *lend()
+	{
+		if (!this->advertised()) {
+			this->advertise();
+		}
+
+		return this->advertised() ? static_cast<T *>(Manager::orb_lend(this->_handle)) : nullptr;
+	}
+
+	/**
+	 * Publish the slot previously obtained with lend().
+	 */
+	bool commit() { return (Manager::orb_commit(this->_handle) == PX4_OK); }
+
+	/**
+	 * Return the slot previously obtained with lend() without publishing it.
+	 */
+	void abort() { Manager::orb_lend_abort(this->_handle); }
+};
+
 /**
  * The publication multi class with data embedded.
  */
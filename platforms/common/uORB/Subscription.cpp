@@ -73,6 +73,37 @@ void Subscription::unsubscribe()
 	_last_generation = 0;
 }
 
+bool copy_group(Subscription **subs, void **dsts, bool *updated, unsigned count, unsigned max_retries)
+{
+	if ((subs == nullptr) || (dsts == nullptr) || (updated == nullptr) || (count == 0)) {
+		return false;
+	}
+
+	// first pass: copy everything that has an update
+	for (unsigned i = 0; i < count; i++) {
+		updated[i] = (subs[i] != nullptr) && subs[i]->update(dsts[i]);
+	}
+
+	// validation: the snapshot is consistent once no topic changed while it
+	// was being assembled
+	for (unsigned retry = 0; retry < max_retries; retry++) {
+		bool stable = true;
+
+		for (unsigned i = 0; i < count; i++) {
+			if ((subs[i] != nullptr) && subs[i]->update(dsts[i])) {
+				updated[i] = true;
+				stable = false;
+			}
+		}
+
+		if (stable) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool Subscription::ChangeInstance(uint8_t instance)
 {
 	if (instance != _instance) {
@@ -171,6 +171,51 @@ public:
 		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, false) : false;
 	}
 
+	/**
+	 * Drain up to max_n pending queue entries into dst with a single
+	 * synchronization section instead of one per sample (see
+	 * DeviceNode::copy_batch()).
+	 *
+	 * @param dst Destination array with room for max_n messages.
+	 * @param max_n Maximum number of messages to copy.
+	 * @return the number of messages copied.
+	 */
+	unsigned copy_batch(void *dst, unsigned max_n)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_copy_batch(_node, dst, _last_generation, max_n, get_topic()->o_size) : 0;
+	}
+
+	/**
+	 * Zero-copy read: return a const pointer to the next update without
+	 * copying it out of the node.
+	 *
+	 * The slot may be overwritten by a publisher while it is being consumed,
+	 * so the caller must check peek_valid() afterwards and re-read through
+	 * copy() if it fails. Returns nullptr where zero-copy reads are not
+	 * available (protected builds) or if there is no update.
+	 */
+	const void *peek()
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_read_ptr(_node, _last_generation, true) : nullptr;
+	}
+
+	/**
+	 * Check that the data consumed after the last peek() was not overwritten
+	 * while it was being read.
+	 */
+	bool peek_valid() const
+	{
+		return (_node != nullptr) && Manager::orb_read_ptr_valid(_node, _last_generation - 1);
+	}
+
 	/**
 	 * Change subscription instance
 	 * @param instance The new multi-Subscription instance
@@ -196,6 +241,27 @@ protected:
 	uint8_t _instance{0};
 };
 
+/**
+ * Copy a set of subscriptions as one coherent snapshot.
+ *
+ * Each updated subscription is copied into its destination buffer, then the
+ * whole set is validated: if any topic was republished while the pass ran,
+ * the changed topics are copied again (up to max_retries), so consumers
+ * reading many topics back to back (MAVLink streams, logger) get an epoch-
+ * consistent view with one validation pass instead of N independent locked
+ * copies.
+ *
+ * @param subs The subscriptions to copy.
+ * @param dsts One destination buffer per subscription.
+ * @param updated Out: set when the corresponding topic had an update.
+ * @param count Number of subscriptions.
+ * @param max_retries Re-copy passes before giving up on consistency.
+ * @return true if the snapshot is consistent, false if topics kept changing
+ *         (the buffers then hold the latest copies, but possibly from
+ *         different epochs).
+ */
+bool copy_group(Subscription **subs, void **dsts, bool *updated, unsigned count, unsigned max_retries = 3);
+
 // Subscription wrapper class with data
 template<class T>
 class SubscriptionData : public Subscription
@@ -35,13 +35,19 @@
 
 #include "SubscriptionCallback.hpp"
 
-#include <containers/LockGuard.hpp>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/sem.h>
 #include <px4_time.h>
 
 namespace uORB
 {
 
-// Subscription with callback that schedules a WorkItem
+// Subscription with a callback that wakes a blocked consumer thread.
+//
+// The publish path only bumps an atomic generation counter; the semaphore is
+// posted exclusively while a consumer is actually parked, so subscribers that
+// merely exist (or poll fast enough to never block) cost the publisher a
+// single atomic increment per publication.
 template<typename T>
 class SubscriptionBlocking : public SubscriptionCallback
 {
@@ -56,44 +62,30 @@ public:
 	SubscriptionBlocking(const orb_metadata *meta, uint32_t interval_us = 0, uint8_t instance = 0) :
 		SubscriptionCallback(meta, interval_us, instance)
 	{
-		// pthread_mutexattr_init
-		pthread_mutexattr_t attr;
-		int ret_attr_init = pthread_mutexattr_init(&attr);
+		int ret_sem_init = px4_sem_init(&_sem, 0, 0);
 
-		if (ret_attr_init != 0) {
-			PX4_ERR("pthread_mutexattr_init failed, status=%d", ret_attr_init);
-		}
-
-#if defined(PTHREAD_PRIO_NONE)
-		// pthread_mutexattr_settype
-		//  PTHREAD_PRIO_NONE not available on cygwin
-		int ret_mutexattr_settype = pthread_mutexattr_settype(&attr, PTHREAD_PRIO_NONE);
-
-		if (ret_mutexattr_settype != 0) {
-			PX4_ERR("pthread_mutexattr_settype failed, status=%d", ret_mutexattr_settype);
-		}
-
-#endif // PTHREAD_PRIO_NONE
+		if (ret_sem_init != 0) {
+			PX4_ERR("px4_sem_init failed, status=%d", ret_sem_init);
 
-		// pthread_mutex_init
-		int ret_mutex_init = pthread_mutex_init(&_mutex, &attr);
-
-		if (ret_mutex_init != 0) {
-			PX4_ERR("pthread_mutex_init failed, status=%d", ret_mutex_init);
+		} else {
+			px4_sem_setprotocol(&_sem, SEM_PRIO_NONE);
 		}
 	}
 
 	virtual ~SubscriptionBlocking()
 	{
-		pthread_mutex_destroy(&_mutex);
-		pthread_cond_destroy(&_cv);
+		px4_sem_destroy(&_sem);
 	}
 
 	void call() override
 	{
 		// signal immediately if no interval, otherwise only if interval has elapsed
 		if ((_interval_us == 0) || (hrt_elapsed_time(&_last_update) >= _interval_us)) {
-			pthread_cond_signal(&_cv);
+			_generation.fetch_add(1);
+
+			if (_waiter_parked.load()) {
+				px4_sem_post(&_sem);
+			}
 		}
 	}
 
@@ -112,37 +104,49 @@ public:
 		if (updated()) {
 			// return immediately if updated
 			return true;
+		}
 
-		} else {
-			// otherwise wait
+		// otherwise park and wait for the publisher to advance the generation
+		const uint32_t generation = _generation.load();
+		_waiter_parked.store(true);
 
-			LockGuard lg{_mutex};
+		// re-check so a publication between updated() and parking is not lost
+		if (_generation.load() != generation || updated()) {
+			_waiter_parked.store(false);
+			return updated();
+		}
 
-			if (timeout_us == 0) {
-				// wait with no timeout
-				if (pthread_cond_wait(&_cv, &_mutex) == 0) {
-					return updated();
+		if (timeout_us == 0) {
+			// wait with no timeout, looping over wake-ups left behind by
+			// posts that raced a previous timed-out wait
+			while (_generation.load() == generation) {
+				if (px4_sem_wait(&_sem) != 0) {
+					break;
 				}
+			}
 
-			} else {
-				// otherwise wait with timeout based on interval
-
-				// Calculate an absolute time in the future
-				struct timespec ts;
-				px4_clock_gettime(CLOCK_REALTIME, &ts);
-				uint64_t nsecs = ts.tv_nsec + (timeout_us * 1000);
-				static constexpr unsigned billion = (1000 * 1000 * 1000);
-				ts.tv_sec += nsecs / billion;
-				nsecs -= (nsecs / billion) * billion;
-				ts.tv_nsec = nsecs;
-
-				if (px4_pthread_cond_timedwait(&_cv, &_mutex, &ts) == 0) {
-					return updated();
+		} else {
+			// otherwise wait with timeout based on interval
+
+			// Calculate an absolute time in the future
+			struct timespec ts;
+			px4_clock_gettime(CLOCK_REALTIME, &ts);
+			uint64_t nsecs = ts.tv_nsec + (timeout_us * 1000);
+			static constexpr unsigned billion = (1000 * 1000 * 1000);
+			ts.tv_sec += nsecs / billion;
+			nsecs -= (nsecs / billion) * billion;
+			ts.tv_nsec = nsecs;
+
+			while (_generation.load() == generation) {
+				if (px4_sem_timedwait(&_sem, &ts) != 0) {
+					break;
 				}
 			}
 		}
 
-		return false;
+		_waiter_parked.store(false);
+
+		return updated();
 	}
 
 	/**
@@ -163,8 +167,10 @@ public:
 
 private:
 
-	pthread_mutex_t _mutex = PTHREAD_MUTEX_INITIALIZER;
-	pthread_cond_t	_cv = PTHREAD_COND_INITIALIZER;
+	px4_sem_t _sem;
+
+	px4::atomic<uint32_t> _generation{0};
+	px4::atomic<bool> _waiter_parked{false};
 
 };
 
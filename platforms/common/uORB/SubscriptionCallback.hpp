@@ -166,7 +166,12 @@ public:
 		if ((_required_updates == 0)
 		    || (Manager::updates_available(_subscription.get_node(), _subscription.get_last_generation()) >= _required_updates)) {
 			if (updated()) {
-				_work_item->ScheduleNow();
+				if (_coalesced) {
+					_work_item->ScheduleNowCoalesced();
+
+				} else {
+					_work_item->ScheduleNow();
+				}
 			}
 		}
 	}
@@ -182,10 +187,18 @@ public:
 		_required_updates = required_updates;
 	}
 
+	/**
+	 * Coalesce wakeups with other callbacks targeting the same WorkItem: a
+	 * burst of publications on several registered topics then schedules at
+	 * most one run instead of one per topic.
+	 */
+	void set_coalesced(bool coalesced) { _coalesced = coalesced; }
+
 private:
 	px4::WorkItem *_work_item;
 
 	uint8_t _required_updates{0};
+	bool _coalesced{false};
 };
 
 } // namespace uORB
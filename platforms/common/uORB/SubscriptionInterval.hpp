@@ -39,6 +39,7 @@
 #pragma once
 
 #include <uORB/uORB.h>
+#include <px4_platform_common/cycle_time.h>
 #include <px4_platform_common/defines.h>
 
 #include "uORBDeviceNode.hpp"
@@ -95,7 +96,7 @@ public:
 	 * */
 	bool updated()
 	{
-		if (advertised() && (hrt_elapsed_time(&_last_update) >= _interval_us)) {
+		if (advertised() && elapsed_interval()) {
 			return _subscription.updated();
 		}
 
@@ -124,9 +125,12 @@ public:
 	bool copy(void *dst)
 	{
 		if (_subscription.copy(dst)) {
-			const hrt_abstime now = hrt_absolute_time();
-			// shift last update time forward, but don't let it get further behind than the interval
-			_last_update = math::constrain(_last_update + _interval_us, now - _interval_us, now);
+			if (_interval_us > 0) {
+				const hrt_abstime now = px4_cycle_time();
+				// shift last update time forward, but don't let it get further behind than the interval
+				_last_update = math::constrain(_last_update + _interval_us, now - _interval_us, now);
+			}
+
 			return true;
 		}
 
@@ -159,6 +163,22 @@ public:
 	void		set_last_update(hrt_abstime t) { _last_update = t; }
 protected:
 
+	/**
+	 * Check whether the interval has elapsed using the cycle timestamp stamped
+	 * by the work queue dispatch, so polling many interval subscriptions per
+	 * cycle costs an integer compare instead of a timer read each.
+	 */
+	bool elapsed_interval() const
+	{
+		if (_interval_us == 0) {
+			return true;
+		}
+
+		// signed compare: the shared stamp may be marginally behind a _last_update
+		// taken from a newer dispatch on another work queue
+		return (int64_t)(px4_cycle_time() - _last_update) >= (int64_t)_interval_us;
+	}
+
 	Subscription	_subscription;
 	uint64_t	_last_update{0};	// last update in microseconds
 	uint32_t	_interval_us{0};	// maximum update interval in microseconds
@@ -64,7 +64,8 @@ public:
 	 *
 	 * @param id The uORB ORB_ID enum for the topic.
 	 */
-	explicit SubscriptionMultiArray(ORB_ID id)
+	explicit SubscriptionMultiArray(ORB_ID id) :
+		_orb_id(id)
 	{
 		for (uint8_t i = 0; i < SIZE; i++) {
 			_subscriptions[i] = Subscription{id, i};
@@ -84,26 +85,15 @@ public:
 	const Subscription *end() const { return _subscriptions + SIZE; }
 
 	// true if any instance is advertised
-	bool advertised()
-	{
-		for (auto &s : _subscriptions) {
-			if (s.advertised()) {
-				return true;
-			}
-		}
-
-		return false;
-	}
+	bool advertised() { return advertised_instances() != 0; }
 
 	// return the number of instances currently advertised
 	uint8_t advertised_count()
 	{
 		uint8_t count = 0;
 
-		for (auto &s : _subscriptions) {
-			if (s.advertised()) {
-				count++;
-			}
+		for (uint16_t advertised = advertised_instances(); advertised != 0; advertised &= advertised - 1) {
+			count++;
 		}
 
 		return count;
@@ -112,8 +102,10 @@ public:
 	// true if any instance is updated
 	bool updated()
 	{
-		for (auto &s : _subscriptions) {
-			if (s.updated()) {
+		// only probe instances that are advertised (a single word read);
+		// non-advertised instances never report updates anyway
+		for (uint16_t advertised = advertised_instances(); advertised != 0; advertised &= advertised - 1) {
+			if (_subscriptions[__builtin_ctz(advertised)].updated()) {
 				return true;
 			}
 		}
@@ -122,6 +114,14 @@ public:
 	}
 
 private:
+	// advertisement bitmask maintained by the uORB Manager, limited to this array's size
+	uint16_t advertised_instances() const
+	{
+		return Manager::orb_advertised_instances(_orb_id) & (uint16_t)((1u << SIZE) - 1);
+	}
+
+	const ORB_ID _orb_id;
+
 	Subscription _subscriptions[SIZE];
 };
 
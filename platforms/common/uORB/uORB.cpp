@@ -40,6 +40,11 @@
 
 #include "uORBManager.hpp"
 #include "uORBCommon.hpp"
+#include "uORBTopics.h"
+
+#include <pthread.h>
+
+#include <px4_platform_common/atomic.h>
 
 
 #include <lib/drivers/device/Device.hpp>
@@ -184,6 +189,65 @@ int orb_group_count(const struct orb_metadata *meta)
 	return instance;
 }
 
+const struct orb_metadata *orb_get_topic_meta(const char *name)
+{
+	// open-addressing hash index over the generated topic list, built once on
+	// first use (topic ids + 1 are stored so that 0 marks an empty slot)
+	static constexpr uint32_t INDEX_SIZE = 512; // power of two > 2x ORB_TOPICS_COUNT
+	static_assert(INDEX_SIZE > 2 * ORB_TOPICS_COUNT, "topic name hash index too small");
+	static uint16_t name_index[INDEX_SIZE] {};
+	static px4::atomic<bool> initialized{false};
+	static pthread_mutex_t init_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	// FNV-1a
+	const auto hash = [](const char *str) {
+		uint32_t h = 2166136261u;
+
+		while (*str != '\0') {
+			h ^= (uint8_t)*str++;
+			h *= 16777619u;
+		}
+
+		return h;
+	};
+
+	if (!initialized.load()) {
+		pthread_mutex_lock(&init_mutex);
+
+		if (!initialized.load()) {
+			const orb_metadata *const *topics = orb_get_topics();
+
+			for (size_t i = 0; i < orb_topics_count(); i++) {
+				uint32_t slot = hash(topics[i]->o_name) & (INDEX_SIZE - 1);
+
+				while (name_index[slot] != 0) {
+					slot = (slot + 1) & (INDEX_SIZE - 1);
+				}
+
+				name_index[slot] = i + 1;
+			}
+
+			initialized.store(true);
+		}
+
+		pthread_mutex_unlock(&init_mutex);
+	}
+
+	uint32_t slot = hash(name) & (INDEX_SIZE - 1);
+
+	while (name_index[slot] != 0) {
+		const orb_metadata *meta = orb_get_topics()[name_index[slot] - 1];
+
+		if (strcmp(meta->o_name, name) == 0) {
+			return meta;
+		}
+
+		slot = (slot + 1) & (INDEX_SIZE - 1);
+	}
+
+	return nullptr;
+}
+
 int orb_set_interval(int handle, unsigned interval)
 {
 	return uORB::Manager::get_instance()->orb_set_interval(handle, interval);
@@ -471,15 +535,7 @@ void orb_print_message_internal(const orb_metadata *meta, const void *data, bool
 			topic_name[topic_name_len] = '\0';
 
 			// find the metadata
-			const orb_metadata *const *topics = orb_get_topics();
-			const orb_metadata *found_topic = nullptr;
-
-			for (size_t i = 0; i < orb_topics_count(); i++) {
-				if (strcmp(topics[i]->o_name, topic_name) == 0) {
-					found_topic = topics[i];
-					break;
-				}
-			}
+			const orb_metadata *found_topic = orb_get_topic_meta(topic_name);
 
 			if (!found_topic) {
 				PX4_ERR("Topic %s did not match any known topics", topic_name);
@@ -52,8 +52,28 @@ struct orb_metadata {
 	const uint16_t o_size_no_padding;	/**< object size w/o padding at the end (for logger) */
 	const char *o_fields;		/**< semicolon separated list of fields (with type) */
 	uint8_t o_id;			/**< ORB_ID enum */
+	uint8_t o_flags;		/**< topic storage flags (ORB_FLAG_*) */
 };
 
+/**
+ * Store this topic in a lock-free seqlock ring so publishers never block
+ * subscribers (no interrupt lock on NuttX, no node lock on POSIX).
+ * Selected per-topic by declaring an ORB_LOCK_FREE = 1 constant in the .msg
+ * file. Publishers serialize among themselves with a spinlock, so topics
+ * published from interrupt context must not use this mode.
+ */
+#define ORB_FLAG_LOCK_FREE	(1 << 0)
+
+/**
+ * Let this topic's queue start small and grow on overflow up to the declared
+ * ORB_QUEUE_LENGTH, instead of reserving the worst-case buffer up front.
+ * Selected per-topic by declaring an ORB_ADAPTIVE_QUEUE = 1 constant in the
+ * .msg file. Samples may be dropped in the cycle that triggers a grow step,
+ * so bursty/droppable topics are the intended users. Not compatible with
+ * ORB_LOCK_FREE.
+ */
+#define ORB_FLAG_ADAPTIVE_QUEUE	(1 << 1)
+
 typedef const struct orb_metadata *orb_id_t;
 
 /**
@@ -101,14 +121,16 @@ typedef const struct orb_metadata *orb_id_t;
  * @param _size_no_padding	Struct size w/o padding at the end
  * @param _fields	All fields in a semicolon separated list e.g: "float[3] position;bool armed"
  * @param _orb_id_enum	ORB ID enum e.g.: ORB_ID::vehicle_status
+ * @param _flags	Topic storage flags (ORB_FLAG_*)
  */
-#define ORB_DEFINE(_name, _struct, _size_no_padding, _fields, _orb_id_enum)		\
+#define ORB_DEFINE(_name, _struct, _size_no_padding, _fields, _orb_id_enum, _flags)	\
 	const struct orb_metadata __orb_##_name = {	\
 		#_name,					\
 		sizeof(_struct),		\
 		_size_no_padding,			\
 		_fields,				\
-		_orb_id_enum				\
+		_orb_id_enum,				\
+		_flags					\
 	}; struct hack
 
 __BEGIN_DECLS
@@ -43,6 +43,11 @@
 #include <px4_platform_common/sem.hpp>
 #include <systemlib/px4_macros.h>
 
+#ifndef CONSTRAINED_MEMORY
+#include <uORB/Publication.hpp>
+#include <uORB/topics/orb_statistics.h>
+#endif
+
 #include <math.h>
 
 #ifndef __PX4_QURT // QuRT has no poll()
@@ -154,6 +159,11 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 
 			// add to the node map.
 			_node_list.add(node);
+
+			// link into the per-topic instance chain for O(1) by-ID lookup
+			node->set_next_topic_instance(_topic_heads[(uint8_t)node->id()]);
+			_topic_heads[(uint8_t)node->id()] = node;
+
 			_node_exists[node->get_instance()].set((uint8_t)node->id(), true);
 		}
 
@@ -269,10 +279,47 @@ int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node,
 
 #define CLEAR_LINE "\033[K"
 
+#ifndef CONSTRAINED_MEMORY
+/**
+ * Approximate a percentile from one of the DeviceNode latency histograms:
+ * returns the label of the bucket containing the requested fraction.
+ */
+static const char *hist_percentile_label(const uint32_t *hist, float percentile)
+{
+	static const char *labels[uORB::DeviceNode::ORB_LATENCY_HIST_BUCKETS] = {
+		"1us", "4us", "16us", "64us", "256us", "1ms", "4ms", ">4ms"
+	};
+
+	uint32_t total = 0;
+
+	for (uint8_t i = 0; i < uORB::DeviceNode::ORB_LATENCY_HIST_BUCKETS; ++i) {
+		total += hist[i];
+	}
+
+	if (total == 0) {
+		return "-";
+	}
+
+	const uint32_t threshold = roundf(total * percentile);
+	uint32_t cumulative = 0;
+
+	for (uint8_t i = 0; i < uORB::DeviceNode::ORB_LATENCY_HIST_BUCKETS; ++i) {
+		cumulative += hist[i];
+
+		if (cumulative >= threshold) {
+			return labels[i];
+		}
+	}
+
+	return labels[uORB::DeviceNode::ORB_LATENCY_HIST_BUCKETS - 1];
+}
+#endif // !CONSTRAINED_MEMORY
+
 void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 {
 	bool print_active_only = true;
 	bool only_once = false; // if true, run only once, then exit
+	bool latency_mode = false; // show per-node latency histograms (-l)
 
 	if (topic_filter && num_filters > 0) {
 		bool show_all = false;
@@ -283,6 +330,17 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 
 			} else if (!strcmp("-1", topic_filter[i])) {
 				only_once = true;
+
+			} else if (!strcmp("-l", topic_filter[i])) {
+				latency_mode = true;
+
+				// not a topic name filter: remove it from the list
+				for (int j = i; j < num_filters - 1; ++j) {
+					topic_filter[j] = topic_filter[j + 1];
+				}
+
+				--num_filters;
+				--i;
 			}
 		}
 
@@ -293,6 +351,24 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 		}
 	}
 
+#ifndef CONSTRAINED_MEMORY
+
+	uORB::Publication<orb_statistics_s> stats_pub{ORB_ID(orb_statistics)};
+
+	if (latency_mode) {
+		DeviceNode::set_latency_tracking(true);
+		stats_pub.advertise();
+	}
+
+#else
+
+	if (latency_mode) {
+		PX4_INFO("latency instrumentation not available on this board");
+		latency_mode = false;
+	}
+
+#endif // CONSTRAINED_MEMORY
+
 	PX4_INFO_RAW("\033[2J\n"); //clear screen
 
 	lock();
@@ -388,16 +464,52 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 
 			PX4_INFO_RAW(CLEAR_LINE "update: 1s, topics: %i, total publications: %i, %.1f kB/s\n",
 				     num_topics, total_msgs, (double)(total_size / 1000.f));
-			PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+
+			if (latency_mode) {
+				PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE LAT50 LAT99 CPY50\n", (int)max_topic_name_length - 2,
+					     "TOPIC NAME");
+
+			} else {
+				PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+			}
+
 			cur_node = first_node;
 
 			while (cur_node) {
 
 				if (!print_active_only || (cur_node->pub_msg_delta > 0 && cur_node->node->subscriber_count() > 0)) {
-					PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i \n", (int)max_topic_name_length,
-						     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
-						     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
-						     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size);
+#ifndef CONSTRAINED_MEMORY
+
+					if (latency_mode) {
+						const uint32_t *latency_hist = cur_node->node->latency_histogram();
+						const uint32_t *copy_hist = cur_node->node->copy_duration_histogram();
+
+						PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i %5s %5s %5s\n", (int)max_topic_name_length,
+							     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
+							     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
+							     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size,
+							     hist_percentile_label(latency_hist, 0.5f), hist_percentile_label(latency_hist, 0.99f),
+							     hist_percentile_label(copy_hist, 0.5f));
+
+						// make the statistics available in flight logs
+						orb_statistics_s stats{};
+						stats.orb_id = cur_node->node->get_meta()->o_id;
+						stats.instance = cur_node->node->get_instance();
+						stats.queue_size = cur_node->node->get_queue_size();
+						stats.publish_count = cur_node->node->updates_available(0);
+						memcpy(stats.latency_hist, latency_hist, sizeof(stats.latency_hist));
+						memcpy(stats.copy_duration_hist, copy_hist, sizeof(stats.copy_duration_hist));
+						stats.timestamp = hrt_absolute_time();
+						stats_pub.publish(stats);
+
+					} else
+#endif // !CONSTRAINED_MEMORY
+					{
+						PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i \n", (int)max_topic_name_length,
+							     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
+							     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
+							     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size);
+					}
 				}
 
 				cur_node = cur_node->next;
@@ -423,6 +535,14 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 		}
 	}
 
+#ifndef CONSTRAINED_MEMORY
+
+	if (latency_mode) {
+		DeviceNode::set_latency_tracking(false);
+	}
+
+#endif
+
 	//cleanup
 	cur_node = first_node;
 
@@ -453,8 +573,9 @@ uORB::DeviceNode *uORB::DeviceMaster::getDeviceNode(const char *nodepath)
 
 uORB::DeviceNode *uORB::DeviceMaster::getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance)
 {
-	for (uORB::DeviceNode *node : _node_list) {
-		if ((strcmp(node->get_name(), meta->o_name) == 0) && (node->get_instance() == instance)) {
+	// walk the per-topic instance chain (at most ORB_MULTI_MAX_INSTANCES entries)
+	for (uORB::DeviceNode *node = _topic_heads[meta->o_id]; node != nullptr; node = node->next_topic_instance()) {
+		if (node->get_instance() == instance) {
 			return node;
 		}
 	}
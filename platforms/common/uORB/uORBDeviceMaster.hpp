@@ -142,6 +142,13 @@ private:
 	IntrusiveSortedList<uORB::DeviceNode *> _node_list;
 	AtomicBitset<ORB_TOPICS_COUNT> _node_exists[ORB_MULTI_MAX_INSTANCES];
 
+	/**
+	 * Head of the per-topic instance chain, indexed by ORB_ID. Makes the
+	 * common by-ID lookup O(instances of one topic) instead of a string
+	 * compare against every existing node.
+	 */
+	uORB::DeviceNode *_topic_heads[ORB_TOPICS_COUNT] {};
+
 	px4_sem_t	_lock; /**< lock to protect access to all class members (also for derived classes) */
 
 	void		lock() { do {} while (px4_sem_wait(&_lock) != 0); }
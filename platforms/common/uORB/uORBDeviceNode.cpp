@@ -42,12 +42,20 @@
 #include "uORBCommunicator.hpp"
 #endif /* ORB_COMMUNICATOR */
 
+#include <px4_platform_common/time.h>
+
 #if defined(__PX4_NUTTX)
 #include <nuttx/mm/mm.h>
 #endif
 
 static uORB::SubscriptionInterval *filp_to_subscription(cdev::file_t *filp) { return static_cast<uORB::SubscriptionInterval *>(filp->f_priv); }
 
+#ifndef CONSTRAINED_MEMORY
+px4::atomic<bool> uORB::DeviceNode::_latency_tracking{false};
+#endif
+
+px4::atomic<uint16_t> uORB::DeviceNode::_advertised_instances[ORB_TOPICS_COUNT] {};
+
 // round up to nearest power of two
 // Such as 0 => 1, 1 => 1, 2 => 2 ,3 => 4, 10 => 16, 60 => 64, 65...255 => 128
 // Note: When the input value > 128, the output is always 128
@@ -78,8 +86,13 @@ uORB::DeviceNode::DeviceNode(const struct orb_metadata *meta, const uint8_t inst
 	CDev(strdup(path)), // success is checked in CDev::init
 	_meta(meta),
 	_instance(instance),
-	_queue_size(round_pow_of_two_8(queue_size))
+	_queue_size(round_pow_of_two_8(queue_size)),
+	_max_queue_size(_queue_size)
 {
+	if (is_adaptive_queue() && (_queue_size > 2)) {
+		// start at minimum depth; grow_queue() works back towards the declared length on overflow
+		_queue_size = 2;
+	}
 }
 
 uORB::DeviceNode::~DeviceNode()
@@ -209,6 +222,41 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		return -EIO;
 	}
 
+	if (_grow_pending) {
+		grow_queue();
+	}
+
+	if (is_lock_free()) {
+		/* seqlock ring: serialize among publishers only, subscribers are never blocked */
+		publisher_lock();
+
+		const unsigned generation = _generation.load();
+
+		_lock_free_seq.fetch_add(1); // odd: write in progress
+
+		memcpy(_data + (_meta->o_size * (generation % _queue_size)), buffer, _meta->o_size);
+		_generation.store(generation + 1);
+		_data_valid = true;
+
+		_lock_free_seq.fetch_add(1); // even: stable again
+
+#ifndef CONSTRAINED_MEMORY
+		record_publish_statistics();
+#endif
+
+		// callbacks (the publisher lock also guards the callback list on lock-free nodes)
+		for (auto item : _callbacks) {
+			item->call();
+		}
+
+		publisher_unlock();
+
+		/* notify any poll waiters */
+		poll_notify(POLLIN);
+
+		return _meta->o_size;
+	}
+
 	/* Perform an atomic copy. */
 	ATOMIC_ENTER;
 	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
@@ -216,6 +264,100 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 
 	memcpy(_data + (_meta->o_size * (generation % _queue_size)), buffer, _meta->o_size);
 
+#ifndef CONSTRAINED_MEMORY
+	record_publish_statistics();
+#endif
+
+	// callbacks
+	for (auto item : _callbacks) {
+		item->call();
+	}
+
+	/* Mark at least one data has been published */
+	_data_valid = true;
+
+	ATOMIC_LEAVE;
+
+	/* notify any poll waiters */
+	poll_notify(POLLIN);
+
+	return _meta->o_size;
+}
+
+void *
+uORB::DeviceNode::lend()
+{
+	/* a single-slot node cannot lend: subscribers would read the slot while it is filled.
+	 * Lock-free nodes use the seqlock write path instead. */
+	if ((_queue_size < 2) || is_lock_free()) {
+		return nullptr;
+	}
+
+	if (nullptr == _data) {
+
+#ifdef __PX4_NUTTX
+
+		if (up_interrupt_context()) {
+			return nullptr;
+		}
+
+#endif /* __PX4_NUTTX */
+
+		lock();
+
+		/* re-check size */
+		if (nullptr == _data) {
+			const size_t data_size = _meta->o_size * _queue_size;
+			_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+
+			if (_data != nullptr) {
+				memset(_data, 0, data_size);
+			}
+		}
+
+		unlock();
+
+		/* failed or could not allocate */
+		if (nullptr == _data) {
+			return nullptr;
+		}
+	}
+
+	ATOMIC_ENTER;
+
+	if (_lend_active) {
+		/* only one slot can be lent out at a time */
+		ATOMIC_LEAVE;
+		return nullptr;
+	}
+
+	/* the slot for the upcoming generation; excluded from readers until commit() */
+	_lend_active = true;
+	void *buffer = _data + (_meta->o_size * (_generation.load() % _queue_size));
+	ATOMIC_LEAVE;
+
+	return buffer;
+}
+
+ssize_t
+uORB::DeviceNode::commit()
+{
+	ATOMIC_ENTER;
+
+	if (!_lend_active) {
+		ATOMIC_LEAVE;
+		return -EINVAL;
+	}
+
+	_lend_active = false;
+
+	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
+	_generation.fetch_add(1);
+
+#ifndef CONSTRAINED_MEMORY
+	record_publish_statistics();
+#endif
+
 	// callbacks
 	for (auto item : _callbacks) {
 		item->call();
@@ -232,6 +374,113 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 	return _meta->o_size;
 }
 
+void
+uORB::DeviceNode::lend_abort()
+{
+	ATOMIC_ENTER;
+	_lend_active = false;
+	ATOMIC_LEAVE;
+}
+
+bool
+uORB::DeviceNode::lock_free_retry(unsigned &retries)
+{
+	// a few retries cover a writer running concurrently on another core
+	static constexpr unsigned SPIN_RETRIES = 16;
+	// overall bound: fail the copy instead of hanging the reader forever
+	static constexpr unsigned MAX_RETRIES = 1000;
+
+	if (++retries > MAX_RETRIES) {
+		return false;
+	}
+
+	if (retries > SPIN_RETRIES) {
+		// the writer was likely preempted mid-update; on strict-priority
+		// single-core schedulers only blocking lets it run again
+#ifdef __PX4_NUTTX
+
+		if (up_interrupt_context()) {
+			return false;
+		}
+
+#endif /* __PX4_NUTTX */
+		px4_usleep(1);
+	}
+
+	return true;
+}
+
+void
+uORB::DeviceNode::grow_queue()
+{
+	if (is_lock_free()) {
+		// seqlock readers walk _data without taking the lock, so the buffer
+		// must never be reallocated; is_adaptive_queue() already excludes
+		// lock-free nodes, this guards against a stray _grow_pending
+		_grow_pending = false;
+		return;
+	}
+
+#ifdef __PX4_NUTTX
+
+	if (up_interrupt_context()) {
+		// retried on the next write from task context
+		return;
+	}
+
+#endif /* __PX4_NUTTX */
+
+	_grow_pending = false;
+
+	if ((_data == nullptr) || (_queue_size >= _max_queue_size)) {
+		return;
+	}
+
+	uint8_t new_queue_size = _queue_size * 2;
+
+	if (new_queue_size > _max_queue_size) {
+		new_queue_size = _max_queue_size;
+	}
+
+	const size_t data_size = _meta->o_size * new_queue_size;
+	uint8_t *new_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+
+	if (new_data == nullptr) {
+		// out of memory: keep the current queue, a later overflow will retry
+		return;
+	}
+
+	memset(new_data, 0, data_size);
+
+	uint8_t *old_data = _data;
+
+	ATOMIC_ENTER;
+
+	if (_lend_active) {
+		// a slot of the old buffer is lent out; retry on the next write
+		ATOMIC_LEAVE;
+		free(new_data);
+		_grow_pending = true;
+		return;
+	}
+
+	/* re-map the entries still in the queue into their new slots; slot selection
+	 * uses generation % queue_size on both sides, so readers stay consistent */
+	const unsigned current_generation = _generation.load();
+
+	for (unsigned g = current_generation - _queue_size; g != current_generation; g++) {
+		memcpy(new_data + (_meta->o_size * (g % new_queue_size)),
+		       old_data + (_meta->o_size * (g % _queue_size)), _meta->o_size);
+	}
+
+	_data = new_data;
+	_queue_size = new_queue_size;
+
+	ATOMIC_LEAVE;
+
+	free(old_data);
+}
+
 int
 uORB::DeviceNode::ioctl(cdev::file_t *filp, int cmd, unsigned long arg)
 {
@@ -341,7 +590,7 @@ int uORB::DeviceNode::unadvertise(orb_advert_t handle)
 	 * of subscribers and publishers. But we also do not have a leak since future
 	 * publishers reuse the same DeviceNode object.
 	 */
-	devnode->_advertised = false;
+	devnode->mark_as_unadvertised();
 
 	return PX4_OK;
 }
@@ -402,9 +651,16 @@ uORB::DeviceNode::print_statistics(int max_topic_length)
 
 	unlock();
 
-	PX4_INFO_RAW("%-*s %2i %4i %2i %4i %s\n", max_topic_length, get_meta()->o_name, (int)instance, (int)sub_count,
+	PX4_INFO_RAW("%-*s %2i %4i %2i %4i %s", max_topic_length, get_meta()->o_name, (int)instance, (int)sub_count,
 		     queue_size, get_meta()->o_size, get_devname());
 
+	if (is_adaptive_queue()) {
+		PX4_INFO_RAW(" (adaptive queue %i/%i, high water %i, overflows %i)", queue_size, (int)_max_queue_size,
+			     (int)_queue_high_water, (int)_overflow_events);
+	}
+
+	PX4_INFO_RAW("\n");
+
 	return true;
 }
 
@@ -504,6 +760,11 @@ int uORB::DeviceNode::update_queue_size(unsigned int queue_size)
 	}
 
 	_queue_size = round_pow_of_two_8(queue_size);
+
+	if (_queue_size > _max_queue_size) {
+		_max_queue_size = _queue_size;
+	}
+
 	return PX4_OK;
 }
 
@@ -523,6 +784,23 @@ bool
 uORB::DeviceNode::register_callback(uORB::SubscriptionCallback *callback_sub)
 {
 	if (callback_sub != nullptr) {
+		if (is_lock_free()) {
+			// on lock-free nodes the callback list is guarded by the publisher lock
+			publisher_lock();
+
+			// prevent duplicate registrations
+			for (auto existing_callbacks : _callbacks) {
+				if (callback_sub == existing_callbacks) {
+					publisher_unlock();
+					return true;
+				}
+			}
+
+			_callbacks.add(callback_sub);
+			publisher_unlock();
+			return true;
+		}
+
 		ATOMIC_ENTER;
 
 		// prevent duplicate registrations
@@ -544,6 +822,13 @@ uORB::DeviceNode::register_callback(uORB::SubscriptionCallback *callback_sub)
 void
 uORB::DeviceNode::unregister_callback(uORB::SubscriptionCallback *callback_sub)
 {
+	if (is_lock_free()) {
+		publisher_lock();
+		_callbacks.remove(callback_sub);
+		publisher_unlock();
+		return;
+	}
+
 	ATOMIC_ENTER;
 	_callbacks.remove(callback_sub);
 	ATOMIC_LEAVE;
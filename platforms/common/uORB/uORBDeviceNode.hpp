@@ -36,10 +36,13 @@
 #include "uORBCommon.hpp"
 #include "uORBDeviceMaster.hpp"
 
+#include <uORB/topics/uORBTopics.hpp>
+
 #include <lib/cdev/CDev.hpp>
 
 #include <containers/IntrusiveSortedList.hpp>
 #include <containers/List.hpp>
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/atomic.h>
 
 namespace uORB
@@ -115,6 +118,35 @@ public:
 	 */
 	int ioctl(cdev::file_t *filp, int cmd, unsigned long arg) override;
 
+	/**
+	 * Lend the next write slot to a publisher for in-place construction.
+	 *
+	 * Avoids the publish-side memcpy of write() for large topics: the publisher
+	 * fills the returned buffer directly and then calls commit() to make it
+	 * visible to subscribers. Only available on queued nodes (queue size > 1),
+	 * where the slot being filled is never handed out to readers; single-slot
+	 * nodes must keep using write() so readers cannot observe a torn message.
+	 * Only a single publisher may have a slot lent at any one time.
+	 *
+	 * @return pointer to a buffer of o_size bytes, or nullptr if the node
+	 *         cannot lend (allocation failure or queue size 1).
+	 */
+	void *lend();
+
+	/**
+	 * Commit a slot previously obtained with lend(), making it visible to
+	 * subscribers and triggering callbacks and poll waiters.
+	 *
+	 * @return the topic size on success, -EINVAL if no slot was lent.
+	 */
+	ssize_t commit();
+
+	/**
+	 * Return a slot previously obtained with lend() without publishing it
+	 * (e.g. when the message turned out to be empty).
+	 */
+	void lend_abort();
+
 	/**
 	 * Method to publish a data to this node.
 	 */
@@ -171,7 +203,27 @@ public:
 	 * and publish to this node or if another node should be tried. */
 	bool is_advertised() const { return _advertised; }
 
-	void mark_as_advertised() { _advertised = true; }
+	void mark_as_advertised()
+	{
+		_advertised = true;
+		_advertised_instances[_meta->o_id].fetch_or(1u << _instance);
+	}
+
+	void mark_as_unadvertised()
+	{
+		_advertised = false;
+		_advertised_instances[_meta->o_id].fetch_and((uint16_t)~(1u << _instance));
+	}
+
+	/**
+	 * Bitmask of advertised instances of a topic, bit i set while instance i
+	 * is advertised. A single atomic load, so multi-instance consumers can
+	 * skip instances that do not exist instead of probing each one.
+	 */
+	static uint16_t advertised_instances(ORB_ID id)
+	{
+		return _advertised_instances[static_cast<uint8_t>(id)].load();
+	}
 
 	/**
 	 * Try to change the size of the queue. This can only be done as long as nobody published yet.
@@ -206,6 +258,21 @@ public:
 	 */
 	unsigned get_initial_generation();
 
+	/**
+	 * True if this node stores its data in the lock-free seqlock ring
+	 * (topic declared with ORB_LOCK_FREE = 1), where publishers never
+	 * block subscribers.
+	 */
+	bool is_lock_free() const { return _meta->o_flags & ORB_FLAG_LOCK_FREE; }
+
+	/**
+	 * True if this node's queue starts small and grows on overflow up to the
+	 * declared ORB_QUEUE_LENGTH (topic declared with ORB_ADAPTIVE_QUEUE = 1).
+	 */
+	bool is_adaptive_queue() const { return (_meta->o_flags & ORB_FLAG_ADAPTIVE_QUEUE) && !is_lock_free(); }
+
+	uint8_t get_max_queue_size() const { return _max_queue_size; }
+
 	const orb_metadata *get_meta() const { return _meta; }
 
 	ORB_ID id() const { return static_cast<ORB_ID>(_meta->o_id); }
@@ -214,6 +281,10 @@ public:
 
 	uint8_t get_instance() const { return _instance; }
 
+	/** Per-topic instance chain, maintained by DeviceMaster for O(1) by-ID lookup. */
+	DeviceNode *next_topic_instance() const { return _next_topic_instance; }
+	void set_next_topic_instance(DeviceNode *node) { _next_topic_instance = node; }
+
 	/**
 	 * Copies data and the corresponding generation
 	 * from a node to the buffer provided.
@@ -227,6 +298,66 @@ public:
 	 */
 	bool copy(void *dst, unsigned &generation)
 	{
+#ifndef CONSTRAINED_MEMORY
+
+		if (_latency_tracking.load()) {
+			const hrt_abstime copy_start = hrt_absolute_time();
+			const bool copied = copy_internal(dst, generation);
+
+			if (copied) {
+				record_copy_statistics(copy_start);
+			}
+
+			return copied;
+		}
+
+#endif // !CONSTRAINED_MEMORY
+
+		return copy_internal(dst, generation);
+	}
+
+	// add item to list of work items to schedule on node update
+	bool register_callback(SubscriptionCallback *callback_sub);
+
+	// remove item from list of work items
+	void unregister_callback(SubscriptionCallback *callback_sub);
+
+#ifndef CONSTRAINED_MEMORY
+	static constexpr uint8_t ORB_LATENCY_HIST_BUCKETS = 8;
+
+	/**
+	 * Enable/disable latency instrumentation for all nodes (see uorb top -l).
+	 * While enabled, every node records a publish-to-first-copy latency and a
+	 * copy duration histogram (power-of-4 microsecond buckets).
+	 */
+	static void set_latency_tracking(bool enabled) { _latency_tracking.store(enabled); }
+	static bool latency_tracking_enabled() { return _latency_tracking.load(); }
+
+	const uint32_t *latency_histogram() const { return _latency_hist; }
+	const uint32_t *copy_duration_histogram() const { return _copy_duration_hist; }
+
+	void reset_latency_statistics()
+	{
+		memset(_latency_hist, 0, sizeof(_latency_hist));
+		memset(_copy_duration_hist, 0, sizeof(_copy_duration_hist));
+	}
+#endif // !CONSTRAINED_MEMORY
+
+protected:
+
+	px4_pollevent_t poll_state(cdev::file_t *filp) override;
+
+	void poll_notify_one(px4_pollfd_struct_t *fds, px4_pollevent_t events) override;
+
+private:
+	friend uORBTest::UnitTest;
+
+	bool copy_internal(void *dst, unsigned &generation)
+	{
+		if (is_lock_free()) {
+			return copy_lock_free(dst, generation);
+		}
+
 		if ((dst != nullptr) && (_data != nullptr)) {
 			if (_queue_size == 1) {
 				ATOMIC_ENTER;
@@ -239,6 +370,10 @@ public:
 				ATOMIC_ENTER;
 				const unsigned current_generation = _generation.load();
 
+				if (is_adaptive_queue()) {
+					record_queue_depth(current_generation - generation);
+				}
+
 				if (current_generation == generation) {
 					/* The subscriber already read the latest message, but nothing new was published yet.
 					* Return the previous message
@@ -247,9 +382,18 @@ public:
 				}
 
 				// Compatible with normal and overflow conditions
-				if (!is_in_range(current_generation - _queue_size, generation, current_generation - 1)) {
+				// (while a slot is lent out the oldest entry is excluded, as it is being overwritten)
+				const uint8_t depth = reader_queue_depth();
+
+				if (!is_in_range(current_generation - depth, generation, current_generation - 1)) {
 					// Reader is too far behind: some messages are lost
-					generation = current_generation - _queue_size;
+					generation = current_generation - depth;
+
+					if (is_adaptive_queue()) {
+						// ask the publisher to grow the queue on its next write
+						_overflow_events++;
+						_grow_pending = true;
+					}
 				}
 
 				memcpy(dst, _data + (_meta->o_size * (generation % _queue_size)), _meta->o_size);
@@ -265,33 +409,323 @@ public:
 
 	}
 
-	// add item to list of work items to schedule on node update
-	bool register_callback(SubscriptionCallback *callback_sub);
+public:
 
-	// remove item from list of work items
-	void unregister_callback(SubscriptionCallback *callback_sub);
+	/**
+	 * Copies up to max_n pending updates and their generations out of the
+	 * queue in a single synchronization section, so consumers of FIFO-rate
+	 * topics can drain a burst with one lock round-trip instead of one per
+	 * sample.
+	 *
+	 * @param dst
+	 *   Destination array with room for max_n messages of o_size bytes.
+	 * @param generation
+	 *   The subscriber's generation, advanced past the copied messages.
+	 * @param max_n
+	 *   Maximum number of messages to copy.
+	 * @return the number of messages copied (0 if nothing is pending).
+	 */
+	unsigned copy_batch(void *dst, unsigned &generation, unsigned max_n)
+	{
+		if ((dst == nullptr) || (_data == nullptr) || (max_n == 0)) {
+			return 0;
+		}
 
-protected:
+		if (is_lock_free()) {
+			// seqlock reads never block publishers: drain per sample
+			unsigned n = 0;
+			uint8_t *out = static_cast<uint8_t *>(dst);
 
-	px4_pollevent_t poll_state(cdev::file_t *filp) override;
+			while ((n < max_n) && updates_available(generation)
+			       && copy_lock_free(out + (n * _meta->o_size), generation)) {
+				++n;
+			}
 
-	void poll_notify_one(px4_pollfd_struct_t *fds, px4_pollevent_t events) override;
+			return n;
+		}
+
+		ATOMIC_ENTER;
+		const unsigned current_generation = _generation.load();
+		unsigned available = current_generation - generation;
+
+		if (is_adaptive_queue()) {
+			record_queue_depth(available);
+		}
+
+		if (available == 0) {
+			ATOMIC_LEAVE;
+			return 0;
+		}
+
+		const uint8_t depth = reader_queue_depth();
+
+		if (available > depth) {
+			// Reader is too far behind: skip to the oldest entry still in the queue
+			generation = current_generation - depth;
+			available = depth;
+
+			if (is_adaptive_queue()) {
+				// ask the publisher to grow the queue on its next write
+				_overflow_events++;
+				_grow_pending = true;
+			}
+		}
+
+		const unsigned n = (available < max_n) ? available : max_n;
+		uint8_t *out = static_cast<uint8_t *>(dst);
+
+		for (unsigned i = 0; i < n; i++) {
+			memcpy(out + (i * _meta->o_size), _data + (_meta->o_size * (generation % _queue_size)), _meta->o_size);
+			++generation;
+		}
+
+		ATOMIC_LEAVE;
+
+		return n;
+	}
+
+	/**
+	 * Returns a const pointer into the node's buffer for the given generation,
+	 * advancing it like copy() but without copying the data out.
+	 *
+	 * The pointed-to slot may be overwritten by a publisher at any time, so the
+	 * caller must verify the read with read_ptr_valid() after consuming the data
+	 * and fall back to copy() if it fails.
+	 *
+	 * @param generation The generation that was read, advanced as in copy().
+	 * @return pointer to the message, or nullptr if nothing was published yet.
+	 */
+	const void *read_ptr(unsigned &generation)
+	{
+		if (_data != nullptr) {
+			ATOMIC_ENTER;
+			const unsigned current_generation = _generation.load();
+
+			if (current_generation == generation) {
+				// nothing new was published yet: return the previous message
+				--generation;
+			}
+
+			const uint8_t depth = reader_queue_depth();
+
+			if (!is_in_range(current_generation - depth, generation, current_generation - 1)) {
+				// Reader is too far behind: some messages are lost
+				generation = current_generation - depth;
+			}
+
+			const void *ptr = _data + (_meta->o_size * (generation % _queue_size));
+			ATOMIC_LEAVE;
+
+			++generation;
+
+			return ptr;
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Check that a slot previously returned by read_ptr() has not been reused
+	 * by a publisher in the meantime.
+	 *
+	 * @param generation The generation value read through read_ptr() (i.e. the
+	 *                   advanced value minus one).
+	 */
+	bool read_ptr_valid(unsigned generation) const
+	{
+		const unsigned current_generation = _generation.load();
+		return is_in_range(current_generation - reader_queue_depth(), generation, current_generation - 1);
+	}
 
 private:
-	friend uORBTest::UnitTest;
 
 	const orb_metadata *_meta; /**< object metadata information */
 
 	uint8_t *_data{nullptr};   /**< allocated object buffer */
+	DeviceNode *_next_topic_instance{nullptr}; /**< next instance of the same topic (see DeviceMaster) */
 	bool _data_valid{false}; /**< At least one valid data */
 	px4::atomic<unsigned>  _generation{0};  /**< object generation count */
 	List<uORB::SubscriptionCallback *>	_callbacks;
 
+	/** per-topic bitmask of advertised instances (see advertised_instances()) */
+	static px4::atomic<uint16_t> _advertised_instances[ORB_TOPICS_COUNT];
+
 	const uint8_t _instance; /**< orb multi instance identifier */
 	bool _advertised{false};  /**< has ever been advertised (not necessarily published data yet) */
-	uint8_t _queue_size; /**< maximum number of elements in the queue */
+	uint8_t _queue_size; /**< current number of elements in the queue */
+	uint8_t _max_queue_size; /**< declared queue length; adaptive queues grow towards it */
 	int8_t _subscriber_count{0};
+	bool _lend_active{false}; /**< a write slot is currently lent out (lend()/commit()) */
+
+	// adaptive queue bookkeeping (ORB_FLAG_ADAPTIVE_QUEUE)
+	bool _grow_pending{false}; /**< an overflow was seen; grow on the next write from task context */
+	uint8_t _queue_high_water{0}; /**< deepest backlog observed by any reader */
+	uint16_t _overflow_events{0}; /**< reads that found messages already overwritten */
+
+	/**
+	 * Track the deepest backlog any reader has seen, for `uorb status` reporting
+	 * and queue length tuning. Called with the node synchronization held.
+	 */
+	void record_queue_depth(unsigned pending)
+	{
+		const unsigned depth = (pending > _queue_size) ? _queue_size : pending;
+
+		if (depth > _queue_high_water) {
+			_queue_high_water = depth;
+		}
+	}
+
+	/**
+	 * Double the queue towards _max_queue_size after a reader reported overflow.
+	 * Runs on the publisher's task context (never from interrupt context).
+	 */
+	void grow_queue();
+
+#ifndef CONSTRAINED_MEMORY
+	// latency instrumentation (uorb top -l), recorded while _latency_tracking is enabled
+	static px4::atomic<bool> _latency_tracking;
+
+	hrt_abstime _last_publish_time{0}; /**< timestamp of the most recent publication */
+	bool _first_copy_pending{false};   /**< latest publication has not been copied out yet */
+	uint32_t _latency_hist[ORB_LATENCY_HIST_BUCKETS] {};       /**< publish-to-first-copy latency */
+	uint32_t _copy_duration_hist[ORB_LATENCY_HIST_BUCKETS] {}; /**< copy() duration */
+
+	/** Histogram bucket for an elapsed time: power-of-4 bounds 1, 4, 16, 64, 256, 1024, 4096, >4096 us. */
+	static uint8_t latency_bucket(hrt_abstime elapsed)
+	{
+		uint8_t bucket = 0;
+		hrt_abstime bound = 1;
+
+		while ((bucket < ORB_LATENCY_HIST_BUCKETS - 1) && (elapsed > bound)) {
+			bound *= 4;
+			++bucket;
+		}
+
+		return bucket;
+	}
+
+	void record_publish_statistics()
+	{
+		if (_latency_tracking.load()) {
+			_last_publish_time = hrt_absolute_time();
+			_first_copy_pending = true;
+		}
+	}
+
+	void record_copy_statistics(const hrt_abstime &copy_start)
+	{
+		_copy_duration_hist[latency_bucket(hrt_elapsed_time(&copy_start))]++;
 
+		if (_first_copy_pending) {
+			_first_copy_pending = false;
+			_latency_hist[latency_bucket((copy_start > _last_publish_time) ? (copy_start - _last_publish_time) : 0)]++;
+		}
+	}
+#endif // !CONSTRAINED_MEMORY
+
+	// lock-free (seqlock) storage mode (ORB_FLAG_LOCK_FREE)
+	px4::atomic<unsigned> _lock_free_seq{0}; /**< sequence counter, odd while a write is in progress */
+	px4::atomic<bool> _publisher_lock{false}; /**< serializes publishers (and the callback list) among themselves */
+
+	/** Spin until the publisher lock is acquired. Publishers only ever contend
+	 *  with other publishers here, never with subscribers. */
+	void publisher_lock()
+	{
+		bool expected = false;
+
+		while (!_publisher_lock.compare_exchange(&expected, true)) {
+			expected = false;
+		}
+	}
+
+	void publisher_unlock() { _publisher_lock.store(false); }
+
+	/**
+	 * Back off between seqlock read retries.
+	 *
+	 * A reader that preempts the writer between the two sequence increments
+	 * would otherwise spin forever on strict-priority single-core schedulers
+	 * (the lower-priority writer never runs again): after a short spin the
+	 * reader sleeps so the writer can complete, and eventually gives up.
+	 *
+	 * @return false when the retry bound is exhausted
+	 */
+	bool lock_free_retry(unsigned &retries);
+
+	/**
+	 * Seqlock read for lock-free nodes: copy the data out, then retry if a
+	 * publisher modified the ring while it was being read.
+	 */
+	bool copy_lock_free(void *dst, unsigned &generation)
+	{
+		if ((dst == nullptr) || (_data == nullptr)) {
+			return false;
+		}
+
+		unsigned retries = 0;
+
+		while (true) {
+			const unsigned seq = _lock_free_seq.load();
+
+			if (seq & 1) {
+				// write in progress
+				if (!lock_free_retry(retries)) {
+					return false;
+				}
+
+				continue;
+			}
+
+			const unsigned current_generation = _generation.load();
+
+			if (_queue_size == 1) {
+				memcpy(dst, _data, _meta->o_size);
+
+				if (_lock_free_seq.load() == seq) {
+					generation = current_generation;
+					return true;
+				}
+
+				if (!lock_free_retry(retries)) {
+					return false;
+				}
+
+				continue;
+			}
+
+			unsigned g = generation;
+
+			if (current_generation == g) {
+				/* The subscriber already read the latest message, but nothing new was published yet.
+				* Return the previous message
+				*/
+				--g;
+			}
+
+			// Compatible with normal and overflow conditions
+			if (!is_in_range(current_generation - _queue_size, g, current_generation - 1)) {
+				// Reader is too far behind: some messages are lost
+				g = current_generation - _queue_size;
+			}
+
+			memcpy(dst, _data + (_meta->o_size * (g % _queue_size)), _meta->o_size);
+
+			if (_lock_free_seq.load() == seq) {
+				generation = g + 1;
+				return true;
+			}
+
+			if (!lock_free_retry(retries)) {
+				return false;
+			}
+		}
+	}
+
+	/**
+	 * Number of queue entries readers may access. While a slot is lent out the
+	 * oldest entry is being overwritten in place and is excluded.
+	 */
+	uint8_t reader_queue_depth() const { return _lend_active ? _queue_size - 1 : _queue_size; }
 
 // Determine the data range
 	static inline bool is_in_range(unsigned left, unsigned value, unsigned right)
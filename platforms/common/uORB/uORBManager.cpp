@@ -276,7 +276,7 @@ int uORB::Manager::orb_exists(const struct orb_metadata *meta, int instance)
 	ret = px4_access(path, F_OK);
 
 	if (ret == -1) {
-		if (_remote_topics.find(meta->o_name)) {
+		if (_remote_topics.find(static_cast<ORB_ID>(meta->o_id))) {
 			ret = 0;
 		}
 	}
@@ -503,6 +503,51 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return static_cast<DeviceNode *>(node_handle)->copy(dst, generation);
 }
 
+unsigned uORB::Manager::orb_data_copy_batch(void *node_handle, void *dst, unsigned &generation, unsigned max_n,
+		size_t o_size)
+{
+	DeviceNode *node = static_cast<DeviceNode *>(node_handle);
+
+	if (!is_advertised(node_handle) || (o_size != node->get_meta()->o_size)) {
+		return 0;
+	}
+
+	return node->copy_batch(dst, generation, max_n);
+}
+
+void *uORB::Manager::orb_lend(void *node_handle)
+{
+	return static_cast<DeviceNode *>(node_handle)->lend();
+}
+
+int uORB::Manager::orb_commit(void *node_handle)
+{
+	return (static_cast<DeviceNode *>(node_handle)->commit() > 0) ? PX4_OK : PX4_ERROR;
+}
+
+void uORB::Manager::orb_lend_abort(void *node_handle)
+{
+	static_cast<DeviceNode *>(node_handle)->lend_abort();
+}
+
+const void *uORB::Manager::orb_read_ptr(void *node_handle, unsigned &generation, bool only_if_updated)
+{
+	if (!is_advertised(node_handle)) {
+		return nullptr;
+	}
+
+	if (only_if_updated && !static_cast<const uORB::DeviceNode *>(node_handle)->updates_available(generation)) {
+		return nullptr;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->read_ptr(generation);
+}
+
+bool uORB::Manager::orb_read_ptr_valid(const void *node_handle, unsigned generation)
+{
+	return static_cast<const DeviceNode *>(node_handle)->read_ptr_valid(generation);
+}
+
 // add item to list of work items to schedule on node update
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
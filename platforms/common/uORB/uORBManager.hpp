@@ -446,12 +446,50 @@ public:
 
 	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated);
 
+	/**
+	 * Drain up to max_n pending queue entries in a single synchronization
+	 * section (see DeviceNode::copy_batch()).
+	 * @return the number of messages copied.
+	 */
+	static unsigned orb_data_copy_batch(void *node_handle, void *dst, unsigned &generation, unsigned max_n,
+					    size_t o_size);
+
+	/**
+	 * Lend the next write slot of a node to a publisher for in-place
+	 * construction (see DeviceNode::lend()). Not available across protection
+	 * domains; callers must fall back to orb_publish() on nullptr.
+	 */
+	static void *orb_lend(void *node_handle);
+
+	/** Commit a slot previously obtained with orb_lend(). */
+	static int orb_commit(void *node_handle);
+
+	/** Return a slot previously obtained with orb_lend() without publishing it. */
+	static void orb_lend_abort(void *node_handle);
+
+	/**
+	 * Zero-copy subscriber read (see DeviceNode::read_ptr()). The read must be
+	 * validated with orb_read_ptr_valid() after the data has been consumed.
+	 * Not available across protection domains; callers must fall back to
+	 * orb_data_copy() on nullptr.
+	 */
+	static const void *orb_read_ptr(void *node_handle, unsigned &generation, bool only_if_updated);
+
+	static bool orb_read_ptr_valid(const void *node_handle, unsigned generation);
+
 	static bool register_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
 	static void unregister_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
 	static uint8_t orb_get_instance(const void *node_handle);
 
+	/**
+	 * Bitmask of advertised instances of a topic (bit i set for instance i),
+	 * readable in a single atomic load. Lets multi-instance consumers iterate
+	 * only over instances that exist instead of probing each slot.
+	 */
+	static uint16_t orb_advertised_instances(ORB_ID id) { return DeviceNode::advertised_instances(id); }
+
 #if defined(CONFIG_BUILD_FLAT)
 	/* These are optimized by inlining in NuttX Flat build */
 	static unsigned updates_available(const void *node_handle, unsigned last_generation) { return is_advertised(node_handle) ? static_cast<const DeviceNode *>(node_handle)->updates_available(last_generation) : 0; }
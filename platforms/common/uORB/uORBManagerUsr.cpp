@@ -312,6 +312,45 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return data.ret;
 }
 
+unsigned uORB::Manager::orb_data_copy_batch(void *node_handle, void *dst, unsigned &generation, unsigned max_n,
+		size_t o_size)
+{
+	// drain sample by sample: each copy is a boardctl round-trip here
+	unsigned n = 0;
+
+	while ((n < max_n) && orb_data_copy(node_handle, static_cast<uint8_t *>(dst) + (n * o_size), generation, true)) {
+		++n;
+	}
+
+	return n;
+}
+
+void *uORB::Manager::orb_lend(void *node_handle)
+{
+	// zero-copy lending is not possible across the user/kernel boundary
+	return nullptr;
+}
+
+int uORB::Manager::orb_commit(void *node_handle)
+{
+	return PX4_ERROR;
+}
+
+void uORB::Manager::orb_lend_abort(void *node_handle)
+{
+}
+
+const void *uORB::Manager::orb_read_ptr(void *node_handle, unsigned &generation, bool only_if_updated)
+{
+	// zero-copy reads are not possible across the user/kernel boundary
+	return nullptr;
+}
+
+bool uORB::Manager::orb_read_ptr_valid(const void *node_handle, unsigned generation)
+{
+	return false;
+}
+
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
 	orbiocdevregcallback_t data = {node_handle, callback_sub, false};
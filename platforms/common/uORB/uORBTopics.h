@@ -36,15 +36,15 @@
 
 #include <uORB/uORB.h>
 
-/*
- * Returns count of all declared topics.
- * It is equal to size of array from orb_get_topics()
- */
-extern size_t orb_topics_count() __EXPORT;
+// orb_topics_count(), orb_get_topics() and the ORB_ID enum come from the
+// generated topic list
+#include <uORB/topics/uORBTopics.hpp>
 
 /*
- * Returns array of topics metadata
+ * Returns the metadata for a given topic name, or nullptr if no topic matches.
+ * The name is resolved through a hash index over the topic list, so repeated
+ * lookups do not scan or compare all topic names.
  */
-extern const struct orb_metadata *const *orb_get_topics() __EXPORT;
+extern const struct orb_metadata *orb_get_topic_meta(const char *name) __EXPORT;
 
 #endif /* MODULES_UORB_UORBTOPICS_H_ */
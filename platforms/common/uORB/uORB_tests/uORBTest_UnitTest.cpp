@@ -40,6 +40,7 @@
 #include <math.h>
 #include <lib/cdev/CDev.hpp>
 #include <uORB/PublicationMulti.hpp>
+#include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
 
 uORBTest::UnitTest &uORBTest::UnitTest::instance()
@@ -206,9 +207,86 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
+	ret = test_copy_group();
+
+	if (ret != OK) {
+		return ret;
+	}
+
 	return test_queue_poll_notify();
 }
 
+int uORBTest::UnitTest::test_copy_group()
+{
+	test_note("try copy_group snapshot support");
+
+	orb_test_s t{};
+	t.val = 11;
+	orb_advert_t ptopic = orb_advertise(ORB_ID(orb_test), &t);
+
+	if (ptopic == nullptr) {
+		return test_fail("advertise failed: %d", errno);
+	}
+
+	orb_test_medium_s m{};
+	m.val = 22;
+	orb_advert_t ptopic_medium = orb_advertise(ORB_ID(orb_test_medium), &m);
+
+	if (ptopic_medium == nullptr) {
+		return test_fail("advertise (medium) failed: %d", errno);
+	}
+
+	uORB::Subscription sub_test{ORB_ID(orb_test)};
+	uORB::Subscription sub_medium{ORB_ID(orb_test_medium)};
+
+	uORB::Subscription *subs[2] {&sub_test, &sub_medium};
+	orb_test_s t_out{};
+	orb_test_medium_s m_out{};
+	void *dsts[2] {&t_out, &m_out};
+	bool updated[2] {};
+
+	if (!uORB::copy_group(subs, dsts, updated, 2)) {
+		return test_fail("copy_group failed");
+	}
+
+	if (!updated[0] || !updated[1]) {
+		return test_fail("copy_group missing updates (%i %i)", updated[0], updated[1]);
+	}
+
+	if ((t_out.val != 11) || (m_out.val != 22)) {
+		return test_fail("copy_group mismatch: %d %d", t_out.val, m_out.val);
+	}
+
+	// no new publications: nothing may be flagged as updated
+	if (!uORB::copy_group(subs, dsts, updated, 2)) {
+		return test_fail("copy_group (2) failed");
+	}
+
+	if (updated[0] || updated[1]) {
+		return test_fail("copy_group spurious updates (%i %i)", updated[0], updated[1]);
+	}
+
+	// only one topic republished
+	t.val = 33;
+
+	if (PX4_OK != orb_publish(ORB_ID(orb_test), ptopic, &t)) {
+		return test_fail("publish failed");
+	}
+
+	if (!uORB::copy_group(subs, dsts, updated, 2)) {
+		return test_fail("copy_group (3) failed");
+	}
+
+	if (!updated[0] || updated[1] || (t_out.val != 33)) {
+		return test_fail("copy_group partial update mismatch (%i %i %d)", updated[0], updated[1], t_out.val);
+	}
+
+	orb_unadvertise(ptopic);
+	orb_unadvertise(ptopic_medium);
+
+	return test_note("PASS copy_group snapshot test");
+}
+
 int uORBTest::UnitTest::test_unadvertise()
 {
 	test_note("Testing unadvertise");
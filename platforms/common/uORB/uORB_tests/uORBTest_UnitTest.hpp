@@ -110,6 +110,8 @@ private:
 
 	/* queuing tests */
 	int test_queue();
+
+	int test_copy_group();
 	static int pub_test_queue_entry(int argc, char *argv[]);
 	int pub_test_queue_main();
 	int test_queue_poll_notify();
@@ -27,6 +27,7 @@ find_program(CMAKE_NM ${TOOLCHAIN_PREFIX}-gcc-nm)
 find_program(CMAKE_OBJCOPY ${TOOLCHAIN_PREFIX}-objcopy)
 find_program(CMAKE_OBJDUMP ${TOOLCHAIN_PREFIX}-objdump)
 find_program(CMAKE_RANLIB ${TOOLCHAIN_PREFIX}-gcc-ranlib)
+find_program(CMAKE_SIZE ${TOOLCHAIN_PREFIX}-size)
 find_program(CMAKE_STRIP ${TOOLCHAIN_PREFIX}-strip)
 
 set(CMAKE_FIND_ROOT_PATH get_file_component(${CMAKE_C_COMPILER} PATH))
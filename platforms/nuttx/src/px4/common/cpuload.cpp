@@ -53,6 +53,96 @@ __EXPORT struct system_load_s system_load;
 
 static px4::atomic_int cpuload_monitor_all_count{0};
 
+// pid -> task table slot index so the scheduler hooks cost a short hash probe
+// instead of a table scan on every context switch. Open addressing with
+// tombstones, sized to twice the task table to keep probe chains short;
+// rebuilt when the tombstones from task churn crowd out the free entries.
+static constexpr int PID_HASH_SIZE = 2 * CONFIG_FS_PROCFS_MAX_TASKS;
+static constexpr int16_t PID_HASH_FREE = -1;
+static constexpr int16_t PID_HASH_TOMBSTONE = -2;
+
+struct pid_hash_entry_s {
+	pid_t pid{0};
+	int16_t slot{PID_HASH_FREE};	///< index into system_load.tasks, PID_HASH_FREE or PID_HASH_TOMBSTONE
+};
+
+static pid_hash_entry_s pid_hash[PID_HASH_SIZE];
+static int pid_hash_tombstones = 0;
+
+static inline unsigned pid_hash_index(pid_t pid) { return (unsigned)pid % PID_HASH_SIZE; }
+
+static void pid_hash_rebuild();
+
+static void pid_hash_insert(pid_t pid, int16_t slot)
+{
+	for (int n = 0; n < PID_HASH_SIZE; n++) {
+		pid_hash_entry_s &entry = pid_hash[(pid_hash_index(pid) + n) % PID_HASH_SIZE];
+
+		if ((entry.slot == PID_HASH_FREE) || (entry.slot == PID_HASH_TOMBSTONE)) {
+			if (entry.slot == PID_HASH_TOMBSTONE) {
+				pid_hash_tombstones--;
+			}
+
+			entry.pid = pid;
+			entry.slot = slot;
+			return;
+		}
+	}
+}
+
+static void pid_hash_remove(pid_t pid)
+{
+	for (int n = 0; n < PID_HASH_SIZE; n++) {
+		pid_hash_entry_s &entry = pid_hash[(pid_hash_index(pid) + n) % PID_HASH_SIZE];
+
+		if (entry.slot == PID_HASH_FREE) {
+			return; // not present
+		}
+
+		if ((entry.slot >= 0) && (entry.pid == pid)) {
+			entry.slot = PID_HASH_TOMBSTONE;
+
+			if (++pid_hash_tombstones > CONFIG_FS_PROCFS_MAX_TASKS) {
+				pid_hash_rebuild();
+			}
+
+			return;
+		}
+	}
+}
+
+static int16_t pid_hash_lookup(pid_t pid)
+{
+	for (int n = 0; n < PID_HASH_SIZE; n++) {
+		const pid_hash_entry_s &entry = pid_hash[(pid_hash_index(pid) + n) % PID_HASH_SIZE];
+
+		if (entry.slot == PID_HASH_FREE) {
+			return -1;
+		}
+
+		if ((entry.slot >= 0) && (entry.pid == pid)) {
+			return entry.slot;
+		}
+	}
+
+	return -1;
+}
+
+static void pid_hash_rebuild()
+{
+	for (auto &entry : pid_hash) {
+		entry.slot = PID_HASH_FREE;
+	}
+
+	pid_hash_tombstones = 0;
+
+	for (int slot = 0; slot < CONFIG_FS_PROCFS_MAX_TASKS; slot++) {
+		if (system_load.tasks[slot].valid && (system_load.tasks[slot].tcb != nullptr)) {
+			pid_hash_insert(system_load.tasks[slot].tcb->pid, slot);
+		}
+	}
+}
+
 void cpuload_monitor_start()
 {
 	if (cpuload_monitor_all_count.fetch_add(1) == 0) {
@@ -105,6 +195,8 @@ void cpuload_initialize_once()
 		system_load.tasks[system_load.total_count].valid = true;
 	}
 
+	pid_hash_rebuild();
+
 	system_load.initialized = true;
 }
 
@@ -112,7 +204,9 @@ void sched_note_start(FAR struct tcb_s *tcb)
 {
 	// find first free slot
 	if (system_load.initialized) {
-		for (auto &task : system_load.tasks) {
+		for (int i = 0; i < CONFIG_FS_PROCFS_MAX_TASKS; i++) {
+			auto &task = system_load.tasks[i];
+
 			if (!task.valid) {
 				// slot is available
 				task.total_runtime = 0;
@@ -120,6 +214,7 @@ void sched_note_start(FAR struct tcb_s *tcb)
 				task.tcb = tcb;
 				task.valid = true;
 				system_load.total_count++;
+				pid_hash_insert(tcb->pid, i);
 				break;
 			}
 		}
@@ -129,16 +224,17 @@ void sched_note_start(FAR struct tcb_s *tcb)
 void sched_note_stop(FAR struct tcb_s *tcb)
 {
 	if (system_load.initialized) {
-		for (auto &task : system_load.tasks) {
-			if (task.tcb && task.tcb->pid == tcb->pid) {
-				// mark slot as free
-				task.valid = false;
-				task.total_runtime = 0;
-				task.curr_start_time = 0;
-				task.tcb = nullptr;
-				system_load.total_count--;
-				break;
-			}
+		const int16_t slot = pid_hash_lookup(tcb->pid);
+
+		if (slot >= 0) {
+			auto &task = system_load.tasks[slot];
+			// mark slot as free
+			task.valid = false;
+			task.total_runtime = 0;
+			task.curr_start_time = 0;
+			task.tcb = nullptr;
+			system_load.total_count--;
+			pid_hash_remove(tcb->pid);
 		}
 	}
 }
@@ -156,13 +252,16 @@ void sched_note_suspend(FAR struct tcb_s *tcb)
 			}
 		}
 
-		for (auto &task : system_load.tasks) {
+		const int16_t slot = pid_hash_lookup(tcb->pid);
+
+		if (slot >= 0) {
+			auto &task = system_load.tasks[slot];
+
 			// Task ending its current scheduling run
 			if (task.valid && (task.curr_start_time > 0)
 			    && task.tcb && task.tcb->pid == tcb->pid) {
 
 				task.total_runtime += hrt_elapsed_time(&task.curr_start_time);
-				break;
 			}
 		}
 	}
@@ -181,12 +280,15 @@ void sched_note_resume(FAR struct tcb_s *tcb)
 			}
 		}
 
-		for (auto &task : system_load.tasks) {
+		const int16_t slot = pid_hash_lookup(tcb->pid);
+
+		if (slot >= 0) {
+			auto &task = system_load.tasks[slot];
+
 			if (task.valid && task.tcb && task.tcb->pid == tcb->pid) {
 				// curr_start_time is accessed from an IRQ handler (in logger), so we need
 				// to make the update atomic
 				hrt_store_absolute_time(&task.curr_start_time);
-				break;
 			}
 		}
 	}
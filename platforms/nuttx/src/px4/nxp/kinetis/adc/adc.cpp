@@ -176,6 +176,22 @@ uint32_t px4_arch_adc_sample(uint32_t base_address, unsigned channel)
 	return result;
 }
 
+int px4_arch_adc_sample_group(uint32_t base_address, unsigned count, const uint8_t *channels, uint32_t *values)
+{
+	/* the ADC has a single result register, convert the channels one at a time */
+	int ret = 0;
+
+	for (unsigned i = 0; i < count; i++) {
+		values[i] = px4_arch_adc_sample(base_address, channels[i]);
+
+		if (values[i] == UINT32_MAX) {
+			ret = -1;
+		}
+	}
+
+	return ret;
+}
+
 float px4_arch_adc_reference_v()
 {
 	return BOARD_ADC_POS_REF_V;	// TODO: provide true vref
@@ -63,6 +63,25 @@ int up_pwm_servo_set(unsigned channel, uint16_t value)
 	return io_timer_set_ccr(channel, value);
 }
 
+int up_pwm_servo_set_multi(uint32_t channel_mask, const uint16_t *values)
+{
+	int ret = OK;
+
+	for (unsigned channel = 0; channel_mask != 0 && channel < MAX_TIMER_IO_CHANNELS; channel++) {
+		if (channel_mask & (1 << channel)) {
+			int set_ret = io_timer_set_ccr(channel, values[channel]);
+
+			if (set_ret != OK) {
+				ret = set_ret;
+			}
+
+			channel_mask &= ~(1 << channel);
+		}
+	}
+
+	return ret;
+}
+
 uint16_t up_pwm_servo_get(unsigned channel)
 {
 	return io_channel_get_ccr(channel);
@@ -228,6 +228,100 @@ uint32_t px4_arch_adc_sample(uint32_t base_address, unsigned channel)
 	return result;
 }
 
+int px4_arch_adc_sample_group(uint32_t base_address, unsigned count, const uint8_t *channels, uint32_t *values)
+{
+#ifdef ADC_CR2_EOCS
+
+	/* the regular sequence holds at most 16 conversions */
+	if (count == 0 || count > 16) {
+		return -1;
+	}
+
+	/* pack the channel list into the sequence registers, 5 bits per rank */
+	uint32_t sqr1 = (uint32_t)(count - 1) << ADC_SQR1_L_SHIFT;
+	uint32_t sqr2 = 0;
+	uint32_t sqr3 = 0;
+
+	for (unsigned i = 0; i < count; i++) {
+		if (i < 6) {
+			sqr3 |= (uint32_t)channels[i] << (5 * i);
+
+		} else if (i < 12) {
+			sqr2 |= (uint32_t)channels[i] << (5 * (i - 6));
+
+		} else {
+			sqr1 |= (uint32_t)channels[i] << (5 * (i - 12));
+		}
+	}
+
+	int ret = 0;
+
+	irqstate_t flags = px4_enter_critical_section();
+
+	/* clear any previous EOC */
+	if (rSR(base_address) & ADC_SR_EOC) {
+		rSR(base_address) &= ~ADC_SR_EOC;
+	}
+
+	/* convert the whole sequence from one software trigger, with EOC raised after every conversion */
+	rCR1(base_address) |= ADC_CR1_SCAN;
+	rCR2(base_address) |= ADC_CR2_EOCS;
+	rSQR1(base_address) = sqr1;
+	rSQR2(base_address) = sqr2;
+	rSQR3(base_address) = sqr3;
+	rCR2(base_address) |= ADC_CR2_SWSTART;
+
+	for (unsigned i = 0; i < count; i++) {
+
+		/* wait for the conversion to complete */
+		const hrt_abstime now = hrt_absolute_time();
+
+		while (!(rSR(base_address) & ADC_SR_EOC)) {
+
+			/* don't wait for more than 50us, since that means something broke - should reset here if we see this */
+			if ((hrt_absolute_time() - now) > 50) {
+				for (; i < count; i++) {
+					values[i] = UINT32_MAX;
+				}
+
+				ret = -1;
+				goto out;
+			}
+		}
+
+		/* read the result, clearing EOC and letting the sequencer advance */
+		values[i] = rDR(base_address);
+	}
+
+out:
+
+	/* restore the single-channel configuration px4_arch_adc_sample() expects */
+	rCR1(base_address) &= ~ADC_CR1_SCAN;
+	rCR2(base_address) &= ~ADC_CR2_EOCS;
+	rSQR1(base_address) = 0;
+	rSQR2(base_address) = 0;
+
+	px4_leave_critical_section(flags);
+
+	return ret;
+
+#else
+
+	/* F1 has no per-conversion EOC in scan mode, convert the channels one at a time */
+	int ret = 0;
+
+	for (unsigned i = 0; i < count; i++) {
+		values[i] = px4_arch_adc_sample(base_address, channels[i]);
+
+		if (values[i] == UINT32_MAX) {
+			ret = -1;
+		}
+	}
+
+	return ret;
+#endif
+}
+
 float px4_arch_adc_reference_v()
 {
 	return BOARD_ADC_POS_REF_V;	// TODO: provide true vref
@@ -332,6 +332,97 @@ uint32_t px4_arch_adc_sample(uint32_t base_address, unsigned channel)
 	return result;
 }
 
+int px4_arch_adc_sample_group(uint32_t base_address, unsigned count, const uint8_t *channels, uint32_t *values)
+{
+	/* the regular sequence holds at most 16 conversions */
+	if (count == 0 || count > 16) {
+		return -1;
+	}
+
+	int ret = 0;
+
+	/* The internal temperature sense is remapped onto ADC3, so it cannot
+	 * ride along in the regular sequence of this ADC - convert it through
+	 * the remapping in px4_arch_adc_sample() and sequence the rest.
+	 */
+	uint32_t sqr[4] {};
+	uint32_t pcsel = 0;
+	uint8_t rank_index[16];
+	unsigned ranks = 0;
+
+	for (unsigned i = 0; i < count; i++) {
+		if (channels[i] == PX4_ADC_INTERNAL_TEMP_SENSOR_CHANNEL) {
+			values[i] = px4_arch_adc_sample(base_address, channels[i]);
+
+			if (values[i] == UINT32_MAX) {
+				ret = -1;
+			}
+
+			continue;
+		}
+
+		/* ranks are 6 bits apart, rank 1 starting at SQR1[6], rank 5 at SQR2[0] */
+		const unsigned rank = ranks + 1;
+		sqr[rank / 5] |= (uint32_t)channels[i] << (6 * (rank % 5));
+		pcsel |= 1 << channels[i];
+		rank_index[ranks++] = i;
+	}
+
+	if (ranks > 0) {
+		irqstate_t flags = px4_enter_critical_section();
+
+		/* clear any previous EOC */
+
+		if (rISR(base_address) & ADC_INT_EOC) {
+			rISR(base_address) &= ~ADC_INT_EOC;
+		}
+
+		/* convert the whole sequence from one software trigger, EOC is raised after every conversion */
+
+		rPCSEL(base_address) |= pcsel;
+		sqr[0] |= ranks - 1;	/* L: sequence length */
+		rSQR1(base_address) = sqr[0];
+		rSQR2(base_address) = sqr[1];
+		rSQR3(base_address) = sqr[2];
+		rSQR4(base_address) = sqr[3];
+		rCR(base_address) |= ADC_CR_ADSTART;
+
+		for (unsigned r = 0; r < ranks; r++) {
+
+			/* wait for the conversion to complete */
+			const hrt_abstime now = hrt_absolute_time();
+
+			while (!(rISR(base_address) & ADC_INT_EOC)) {
+
+				/* don't wait for more than 50us, since that means something broke - should reset here if we see this */
+				if ((hrt_absolute_time() - now) > 50) {
+					for (; r < ranks; r++) {
+						values[rank_index[r]] = UINT32_MAX;
+					}
+
+					ret = -1;
+					goto out;
+				}
+			}
+
+			/* read the result, clearing EOC and letting the sequencer advance */
+			values[rank_index[r]] = rDR(base_address);
+		}
+
+out:
+
+		/* restore the single-conversion sequence px4_arch_adc_sample() expects */
+		rSQR1(base_address) = 0;
+		rSQR2(base_address) = 0;
+		rSQR3(base_address) = 0;
+		rSQR4(base_address) = 0;
+
+		px4_leave_critical_section(flags);
+	}
+
+	return ret;
+}
+
 float px4_arch_adc_reference_v()
 {
 	return BOARD_ADC_POS_REF_V;	// TODO: provide true vref
@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file px4_crc.c
+ *
+ * CRC-32 on the STM32H7 CRC unit (RM0433). The engine is configured for the
+ * IEEE 802.3 polynomial with reflected input and output, which makes its
+ * running value bit-compatible with the software crc32part() table state, so
+ * callers can freely mix partial computations.
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/crc.h>
+
+#include <nuttx/config.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "arm_internal.h"
+#include "chip.h"
+#include "stm32_rcc.h"
+
+/* CRC unit register map (RM0433) */
+
+#define STM32_CRC_DR		(STM32_CRC_BASE + 0x00)
+#define STM32_CRC_CR		(STM32_CRC_BASE + 0x08)
+#define STM32_CRC_INIT		(STM32_CRC_BASE + 0x10)
+#define STM32_CRC_POL		(STM32_CRC_BASE + 0x14)
+
+#define CRC_CR_RESET		(1 << 0)	/* reload INIT into the data register */
+#define CRC_CR_REV_IN_BYTE	(1 << 5)	/* bit reversal per input byte */
+#define CRC_CR_REV_IN_WORD	(3 << 5)	/* byte swap + bit reversal per input word */
+#define CRC_CR_REV_OUT		(1 << 7)	/* bit reversal of the output */
+
+#define CRC32_POLY		0x04c11db7	/* IEEE 802.3, non-reflected form */
+
+/* the engine is a single shared unit */
+static sem_t _crc_sem = SEM_INITIALIZER(1);
+static bool _crc_enabled = false;
+
+static inline uint32_t bitrev32(uint32_t value)
+{
+	uint32_t result;
+	__asm__ volatile ("rbit %0, %1" : "=r"(result) : "r"(value));
+	return result;
+}
+
+uint32_t
+px4_arch_crc32part(const uint8_t *src, size_t len, uint32_t crc32val)
+{
+	if (len < 32) {
+		/* engine setup and locking do not pay off for short buffers */
+		return crc32part(src, len, crc32val);
+	}
+
+	while (sem_wait(&_crc_sem) != 0) {
+	}
+
+	if (!_crc_enabled) {
+		modifyreg32(STM32_RCC_AHB4ENR, 0, RCC_AHB4ENR_CRCEN);
+		putreg32(CRC32_POLY, STM32_CRC_POL);
+		_crc_enabled = true;
+	}
+
+	/* With REV_OUT set the data register reads back the reflected remainder,
+	 * which is exactly the running value of the software table algorithm, so
+	 * seeding INIT with the bit-reversed running value continues the stream.
+	 */
+	putreg32(bitrev32(crc32val), STM32_CRC_INIT);
+	putreg32(CRC_CR_REV_IN_BYTE | CRC_CR_REV_OUT | CRC_CR_RESET, STM32_CRC_CR);
+
+	/* head: byte feed up to word alignment */
+	while ((((uintptr_t)src & 3) != 0) && (len > 0)) {
+		putreg8(*src++, STM32_CRC_DR);
+		len--;
+	}
+
+	/* bulk: one AHB write per four bytes; word input reversal processes the
+	 * bytes of the little-endian word in memory order
+	 */
+	putreg32(CRC_CR_REV_IN_WORD | CRC_CR_REV_OUT, STM32_CRC_CR);
+
+	while (len >= 4) {
+		putreg32(*(const uint32_t *)src, STM32_CRC_DR);
+		src += 4;
+		len -= 4;
+	}
+
+	/* tail */
+	putreg32(CRC_CR_REV_IN_BYTE | CRC_CR_REV_OUT, STM32_CRC_CR);
+
+	while (len > 0) {
+		putreg8(*src++, STM32_CRC_DR);
+		len--;
+	}
+
+	const uint32_t result = getreg32(STM32_CRC_DR);
+
+	sem_post(&_crc_sem);
+
+	return result;
+}
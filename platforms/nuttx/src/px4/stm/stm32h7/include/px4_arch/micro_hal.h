@@ -64,5 +64,6 @@ int stm32h7_flash_unlock(size_t addr);
 int stm32h7_flash_writeprotect(size_t block, bool enabled);
 #define  stm32_flash_lock() stm32h7_flash_lock(PX4_FLASH_BASE)
 #define PX4_ADC_INTERNAL_TEMP_SENSOR_CHANNEL (20) //Valid for ADC3 on H7x3
+#define PX4_CRC32_HW 1 // CRC unit on AHB4, used by px4_crc32part()
 
 __END_DECLS
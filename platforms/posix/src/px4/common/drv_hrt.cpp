@@ -61,9 +61,22 @@ static constexpr unsigned HRT_INTERVAL_MIN = 50;
 static constexpr unsigned HRT_INTERVAL_MAX = 50000000;
 
 /*
- * Queue of callout entries.
+ * Callout entries are kept in a hierarchical timer wheel: level 0 slots are
+ * 128 us wide and each coarser level covers 64x the span of the one below.
+ * Insert and cancel are O(1), and a timer tick only touches the slots that
+ * are due instead of scanning one sorted list of all entries.
  */
-static struct sq_queue_s	callout_queue;
+static constexpr int		HRT_WHEEL_LEVELS = 4;
+static constexpr int		HRT_WHEEL_SLOT_BITS = 6;
+static constexpr int		HRT_WHEEL_SLOTS = 1 << HRT_WHEEL_SLOT_BITS;
+static constexpr int		HRT_WHEEL_SLOT_MASK = HRT_WHEEL_SLOTS - 1;
+static constexpr int		HRT_WHEEL_TICK_SHIFT = 7;	/* 128 us per level-0 slot */
+static constexpr uint64_t	HRT_WHEEL_SPAN_TICKS = 1ULL << (HRT_WHEEL_LEVELS * HRT_WHEEL_SLOT_BITS);
+
+static struct sq_queue_s	callout_wheel[HRT_WHEEL_LEVELS][HRT_WHEEL_SLOTS];
+
+/* wheel time: every queued entry expires at or after this tick */
+static uint64_t			callout_base_tick;
 
 /* latency baseline (last compare value applied) */
 static uint64_t			latency_baseline;
@@ -95,6 +108,91 @@ static void hrt_unlock()
 	px4_sem_post(&_hrt_lock);
 }
 
+/*
+ * Find the wheel bucket for an entry expiring at the given tick.
+ * Must be called with the lock held.
+ */
+static struct sq_queue_s *
+hrt_wheel_slot(uint64_t tick)
+{
+	if (tick < callout_base_tick) {
+		/* already expired: file into the current slot */
+		tick = callout_base_tick;
+	}
+
+	const uint64_t delta = tick - callout_base_tick;
+	int level = 0;
+	uint64_t level_span = HRT_WHEEL_SLOTS;
+
+	while (level < HRT_WHEEL_LEVELS - 1 && delta >= level_span) {
+		level++;
+		level_span <<= HRT_WHEEL_SLOT_BITS;
+	}
+
+	if (delta >= level_span) {
+		/* beyond the wheel horizon: park in the furthest top-level slot,
+		 * it will be re-filed whenever that slot cascades */
+		tick = callout_base_tick + level_span - 1;
+	}
+
+	return &callout_wheel[level][(tick >> (level * HRT_WHEEL_SLOT_BITS)) & HRT_WHEEL_SLOT_MASK];
+}
+
+static void
+hrt_wheel_insert(struct hrt_call *entry)
+{
+	struct sq_queue_s *slot = hrt_wheel_slot(entry->deadline >> HRT_WHEEL_TICK_SHIFT);
+
+	entry->wheel_slot = slot;
+	sq_addfirst(&entry->link, slot);
+}
+
+static void
+hrt_wheel_remove(struct hrt_call *entry)
+{
+	/* only touch buckets this wheel owns: entries that were never entered can
+	 * carry uninitialised state (see the note in hrt_call_internal) */
+	const uintptr_t slot = (uintptr_t)entry->wheel_slot;
+
+	if (slot >= (uintptr_t)&callout_wheel[0][0]
+	    && slot <= (uintptr_t)&callout_wheel[HRT_WHEEL_LEVELS - 1][HRT_WHEEL_SLOTS - 1]) {
+		sq_rem(&entry->link, entry->wheel_slot);
+	}
+
+	entry->wheel_slot = nullptr;
+}
+
+/*
+ * Restart the wheel at the given tick and re-file all entries. Only needed
+ * when the clock jumps forward by more than the wheel span (e.g. when the
+ * simulator sets the lockstep time on startup), where the tick-wise advance
+ * in hrt_call_invoke would be unreasonably slow.
+ */
+static void
+hrt_wheel_rebase(uint64_t now_tick)
+{
+	struct sq_queue_s pending;
+	sq_init(&pending);
+
+	for (int level = 0; level < HRT_WHEEL_LEVELS; level++) {
+		for (int i = 0; i < HRT_WHEEL_SLOTS; i++) {
+			struct sq_entry_s *item;
+
+			while ((item = sq_remfirst(&callout_wheel[level][i])) != nullptr) {
+				sq_addfirst(item, &pending);
+			}
+		}
+	}
+
+	callout_base_tick = now_tick;
+
+	struct sq_entry_s *item;
+
+	while ((item = sq_remfirst(&pending)) != nullptr) {
+		hrt_wheel_insert((struct hrt_call *)item);
+	}
+}
+
 /*
  * Get absolute time.
  */
@@ -138,7 +236,7 @@ bool	hrt_called(struct hrt_call *entry)
 void	hrt_cancel(struct hrt_call *entry)
 {
 	hrt_lock();
-	sq_rem(&entry->link, &callout_queue);
+	hrt_wheel_remove(entry);
 	entry->deadline = 0;
 
 	/* if this is a periodic call being removed by the callout, prevent it from
@@ -191,7 +289,16 @@ void	hrt_call_delay(struct hrt_call *entry, hrt_abstime delay)
  */
 void	hrt_init()
 {
-	sq_init(&callout_queue);
+	for (int level = 0; level < HRT_WHEEL_LEVELS; level++) {
+		for (int i = 0; i < HRT_WHEEL_SLOTS; i++) {
+			sq_init(&callout_wheel[level][i]);
+		}
+	}
+
+	callout_base_tick = hrt_absolute_time() >> HRT_WHEEL_TICK_SHIFT;
+
+	/* no timer event is scheduled yet: the first hrt_call_enter sets one up */
+	latency_baseline = UINT64_MAX;
 
 	int sem_ret = px4_sem_init(&_hrt_lock, 0, 1);
 
@@ -205,26 +312,11 @@ void	hrt_init()
 static void
 hrt_call_enter(struct hrt_call *entry)
 {
-	struct hrt_call	*call, *next;
+	hrt_wheel_insert(entry);
 
-	call = (struct hrt_call *)sq_peek(&callout_queue);
-
-	if ((call == nullptr) || (entry->deadline < call->deadline)) {
-		sq_addfirst(&entry->link, &callout_queue);
-		//if (call != nullptr) PX4_INFO("call enter at head, reschedule (%lu %lu)", entry->deadline, call->deadline);
-		/* we changed the next deadline, reschedule the timer event */
+	if (entry->deadline < latency_baseline) {
+		/* the entry is due before the next timer event, reschedule it */
 		hrt_call_reschedule();
-
-	} else {
-		do {
-			next = (struct hrt_call *)sq_next(&call->link);
-
-			if ((next == nullptr) || (entry->deadline < next->deadline)) {
-				//lldbg("call enter after head\n");
-				sq_addafter(&call->link, &entry->link, &callout_queue);
-				break;
-			}
-		} while ((call = next) != nullptr);
 	}
 }
 
@@ -258,36 +350,86 @@ hrt_tim_isr(void *p)
  *
  * This routine must be called with interrupts disabled.
  */
+/**
+ * Find the time of the next timer event the wheel needs.
+ *
+ * For entries within the current level-0 round this is the exact earliest
+ * deadline. Entries further out are represented by the time their coarser
+ * slot cascades into the finer levels; the timer event then re-files them
+ * and reschedules precisely.
+ *
+ * @return 0 if no entry is queued
+ */
+static hrt_abstime
+hrt_wheel_next_deadline()
+{
+	hrt_abstime next = 0;
+
+	/* level 0: slots hold at most one tick each, scan for the earliest deadline */
+	for (int d = 0; d < HRT_WHEEL_SLOTS; d++) {
+		struct sq_queue_s *slot = &callout_wheel[0][(callout_base_tick + d) & HRT_WHEEL_SLOT_MASK];
+		struct hrt_call *call = (struct hrt_call *)sq_peek(slot);
+
+		if (call != nullptr) {
+			next = call->deadline;
+
+			while ((call = (struct hrt_call *)sq_next(&call->link)) != nullptr) {
+				if (call->deadline < next) {
+					next = call->deadline;
+				}
+			}
+
+			break;
+		}
+	}
+
+	/* coarser levels: a pending cascade may precede the earliest level-0 deadline */
+	for (int level = 1; level < HRT_WHEEL_LEVELS; level++) {
+		const int level_shift = level * HRT_WHEEL_SLOT_BITS;
+		const uint64_t level_index = callout_base_tick >> level_shift;
+
+		/* distance 64 is the current index again: entries one full level round out */
+		for (int d = 1; d <= HRT_WHEEL_SLOTS; d++) {
+			if (sq_peek(&callout_wheel[level][(level_index + d) & HRT_WHEEL_SLOT_MASK]) != nullptr) {
+				const hrt_abstime cascade_time = ((level_index + d) << level_shift) << HRT_WHEEL_TICK_SHIFT;
+
+				if (next == 0 || cascade_time < next) {
+					next = cascade_time;
+				}
+
+				break;
+			}
+		}
+	}
+
+	return next;
+}
+
 static void
 hrt_call_reschedule()
 {
 	hrt_abstime	now = hrt_absolute_time();
 	hrt_abstime	delay = HRT_INTERVAL_MAX;
-	struct hrt_call	*next = (struct hrt_call *)sq_peek(&callout_queue);
+	hrt_abstime	next = hrt_wheel_next_deadline();
 	hrt_abstime	deadline = now + HRT_INTERVAL_MAX;
 
 	/*
 	 * Determine what the next deadline will be.
 	 *
-	 * Note that we ensure that this will be within the counter
-	 * period, so that when we truncate all but the low 16 bits
-	 * the next time the compare matches it will be the deadline
-	 * we want.
-	 *
-	 * It is important for accurate timekeeping that the compare
-	 * interrupt fires sufficiently often that the base_time update in
-	 * hrt_absolute_time runs at least once per timer period.
+	 * It is important for accurate timekeeping that the timer event fires
+	 * sufficiently often, so the delay is bounded by HRT_INTERVAL_MAX even
+	 * with an empty wheel.
 	 */
-	if (next != nullptr) {
+	if (next != 0) {
 		//lldbg("entry in queue\n");
-		if (next->deadline <= (now + HRT_INTERVAL_MIN)) {
+		if (next <= (now + HRT_INTERVAL_MIN)) {
 			//lldbg("pre-expired\n");
 			/* set a minimal deadline so that we call ASAP */
 			delay = HRT_INTERVAL_MIN;
 
-		} else if (next->deadline < deadline) {
+		} else if (next < deadline) {
 			//lldbg("due soon\n");
-			delay = next->deadline - now;
+			delay = next - now;
 		}
 	}
 
@@ -311,15 +453,15 @@ hrt_call_internal(struct hrt_call *entry, hrt_abstime deadline, hrt_abstime inte
 
 	//PX4_INFO("hrt_call_internal after lock");
 	/* if the entry is currently queued, remove it */
-	/* note that we are using a potentially uninitialised
-	   entry->link here, but it is safe as sq_rem() doesn't
-	   dereference the passed node unless it is found in the
-	   list. So we potentially waste a bit of time searching the
-	   queue for the uninitialised entry->link but we don't do
-	   anything actually unsafe.
+	/* note that the entry may never have been entered and then carries an
+	   uninitialised wheel_slot pointer; hrt_wheel_remove() only dereferences
+	   it if it points into the wheel, and sq_rem() doesn't dereference the
+	   passed node unless it is found in the list. So we potentially waste a
+	   bit of time searching a bucket for the uninitialised entry->link but
+	   we don't do anything actually unsafe.
 	*/
 	if (entry->deadline != 0) {
-		sq_rem(&entry->link, &callout_queue);
+		hrt_wheel_remove(entry);
 	}
 
 #if 1
@@ -382,56 +524,95 @@ void	hrt_call_at(struct hrt_call *entry, hrt_abstime calltime, hrt_callout callo
 static void
 hrt_call_invoke()
 {
-	struct hrt_call	*call;
-	hrt_abstime deadline;
-
 	hrt_lock();
 
+	/* a large forward clock jump (e.g. the simulator setting the lockstep
+	 * time on startup) would make the tick-wise advance below too slow */
+	if ((hrt_absolute_time() >> HRT_WHEEL_TICK_SHIFT) - callout_base_tick >= HRT_WHEEL_SPAN_TICKS) {
+		hrt_wheel_rebase(hrt_absolute_time() >> HRT_WHEEL_TICK_SHIFT);
+	}
+
 	while (true) {
 		/* get the current time */
 		hrt_abstime now = hrt_absolute_time();
 
-		call = (struct hrt_call *)sq_peek(&callout_queue);
+		/* run all due entries in the current level-0 slot */
+		struct sq_queue_s *slot = &callout_wheel[0][callout_base_tick & HRT_WHEEL_SLOT_MASK];
+		struct hrt_call *call = (struct hrt_call *)sq_peek(slot);
+		bool invoked = false;
 
-		if (call == nullptr) {
-			break;
-		}
+		while (call != nullptr) {
+			struct hrt_call *next = (struct hrt_call *)sq_next(&call->link);
 
-		if (call->deadline > now) {
-			break;
-		}
+			if (call->deadline <= now) {
+				sq_rem(&call->link, slot);
+				call->wheel_slot = nullptr;
+				//PX4_INFO("call pop");
+
+				/* save the intended deadline for periodic calls */
+				hrt_abstime deadline = call->deadline;
+
+				/* zero the deadline, as the call has occurred */
+				call->deadline = 0;
+
+				/* invoke the callout (if there is one) */
+				if (call->callout) {
+					// Unlock so we don't deadlock in callback
+					hrt_unlock();
+
+					//PX4_INFO("call %p: %p(%p)", call, call->callout, call->arg);
+					call->callout(call->arg);
+
+					hrt_lock();
+				}
+
+				/* if the callout has a non-zero period, it has to be re-entered */
+				if (call->period != 0) {
+					// re-check call->deadline to allow for
+					// callouts to re-schedule themselves
+					// using hrt_call_delay()
+					if (call->deadline <= now) {
+						call->deadline = deadline + call->period;
+						//PX4_INFO("call deadline set to %lu now=%lu", call->deadline,  now);
+					}
+
+					hrt_call_enter(call);
+				}
+
+				/* the slot may have changed while unlocked: restart the scan */
+				invoked = true;
+				break;
+			}
 
-		sq_rem(&call->link, &callout_queue);
-		//PX4_INFO("call pop");
+			call = next;
+		}
 
-		/* save the intended deadline for periodic calls */
-		deadline = call->deadline;
+		if (invoked) {
+			continue;
+		}
 
-		/* zero the deadline, as the call has occurred */
-		call->deadline = 0;
+		/* nothing due in the current slot: advance the wheel towards 'now',
+		 * but never past it - the remaining entries are not due yet */
+		if (callout_base_tick >= (now >> HRT_WHEEL_TICK_SHIFT)) {
+			break;
+		}
 
-		/* invoke the callout (if there is one) */
-		if (call->callout) {
-			// Unlock so we don't deadlock in callback
-			hrt_unlock();
+		callout_base_tick++;
 
-			//PX4_INFO("call %p: %p(%p)", call, call->callout, call->arg);
-			call->callout(call->arg);
+		/* each time a coarser level's slot index advances, re-file that
+		 * level's new current slot into the finer levels (cascade) */
+		for (int level = 1; level < HRT_WHEEL_LEVELS; level++) {
+			if ((callout_base_tick & ((1ULL << (level * HRT_WHEEL_SLOT_BITS)) - 1)) != 0) {
+				break;
+			}
 
-			hrt_lock();
-		}
+			struct sq_queue_s *cascade_slot =
+				&callout_wheel[level][(callout_base_tick >> (level * HRT_WHEEL_SLOT_BITS)) & HRT_WHEEL_SLOT_MASK];
+			struct sq_entry_s *item;
 
-		/* if the callout has a non-zero period, it has to be re-entered */
-		if (call->period != 0) {
-			// re-check call->deadline to allow for
-			// callouts to re-schedule themselves
-			// using hrt_call_delay()
-			if (call->deadline <= now) {
-				call->deadline = deadline + call->period;
-				//PX4_INFO("call deadline set to %lu now=%lu", call->deadline,  now);
+			while ((item = sq_remfirst(cascade_slot)) != nullptr) {
+				hrt_wheel_insert((struct hrt_call *)item);
 			}
-
-			hrt_call_enter(call);
 		}
 	}
 
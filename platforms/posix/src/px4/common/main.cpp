@@ -175,6 +175,12 @@ int main(int argc, char **argv)
 		argv[0] += path_length + strlen(prefix);
 
 		px4_daemon::Client client(instance);
+
+		if (argc == 1 && strcmp(argv[0], "session") == 0) {
+			/* Persistent session: submit commands read from stdin over a single connection. */
+			return client.process_session();
+		}
+
 		return client.process_args(argc, (const char **)argv);
 
 	} else {
@@ -605,6 +611,8 @@ void print_usage()
 	printf("\n");
 	printf("    px4-MODULE [--instance <instance>] command using symlink.\n");
 	printf("        e.g.: px4-commander status\n");
+	printf("    px4-session [--instance <instance>] runs commands read from stdin (one per line)\n");
+	printf("        over a single connection, e.g. for scripted interaction.\n");
 }
 
 bool is_server_running(int instance, bool server)
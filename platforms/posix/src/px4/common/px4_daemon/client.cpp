@@ -62,7 +62,7 @@ Client::Client(int instance_id) :
 {}
 
 int
-Client::process_args(const int argc, const char **argv)
+Client::_connect()
 {
 	std::string sock_path = get_socket_path(_instance_id);
 
@@ -82,6 +82,16 @@ Client::process_args(const int argc, const char **argv)
 		return -1;
 	}
 
+	return 0;
+}
+
+int
+Client::process_args(const int argc, const char **argv)
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
 	int ret = _send_cmds(argc, argv);
 
 	if (ret != 0) {
@@ -92,6 +102,40 @@ Client::process_args(const int argc, const char **argv)
 	return _listen();
 }
 
+int
+Client::process_session()
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
+	char line[1024];
+	int retval = 0;
+
+	while (fgets(line, sizeof(line), stdin) != nullptr) {
+		size_t len = strlen(line);
+
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+			line[--len] = '\0';
+		}
+
+		if (len == 0) {
+			continue;
+		}
+
+		if (_send_session_cmd(line, len) != 0) {
+			PX4_ERR("Could not send command");
+			return -1;
+		}
+
+		if (_listen_session(retval) != 0) {
+			return -1;
+		}
+	}
+
+	return retval;
+}
+
 int
 Client::_send_cmds(const int argc, const char **argv)
 {
@@ -128,6 +172,81 @@ Client::_send_cmds(const int argc, const char **argv)
 	return 0;
 }
 
+int
+Client::_send_session_cmd(const char *line, size_t len)
+{
+	std::string cmd_buf(line, len);
+
+	// Last byte is the terminator: bit 0 is 'isatty', bit 1 signals that more
+	// commands will follow on this connection.
+	cmd_buf.push_back(2 | (isatty(STDOUT_FILENO) ? 1 : 0));
+
+	size_t n = cmd_buf.size();
+	const char *buf = cmd_buf.data();
+
+	while (n > 0) {
+		int n_sent = write(_fd, buf, n);
+
+		if (n_sent < 0) {
+			PX4_ERR("write() failed: %s", strerror(errno));
+			return -1;
+		}
+
+		n -= n_sent;
+		buf += n_sent;
+	}
+
+	return 0;
+}
+
+int
+Client::_listen_session(int &retval)
+{
+	char buffer[1024];
+
+	// The response to each command ends in {0, retval}. Unlike the one-shot
+	// case we cannot wait for the end of the stream, so we treat the first
+	// 0-byte as the end of the command output (which is text and does not
+	// contain 0-bytes).
+	while (true) {
+		ssize_t n_read = read(_fd, buffer, sizeof buffer);
+
+		if (n_read <= 0) {
+			PX4_ERR("unable to read from socket");
+			return -1;
+		}
+
+		const char *end = (const char *)memchr(buffer, 0, n_read);
+
+		if (end == nullptr) {
+			fwrite(buffer, n_read, 1, stdout);
+			continue;
+		}
+
+		if (end != buffer) {
+			fwrite(buffer, end - buffer, 1, stdout);
+		}
+
+		fflush(stdout);
+
+		// The return value follows the 0-byte.
+		if (end + 1 < buffer + n_read) {
+			retval = end[1];
+			return 0;
+		}
+
+		char retval_char;
+
+		if (read(_fd, &retval_char, 1) != 1) {
+			PX4_ERR("unable to read from socket");
+			return -1;
+		}
+
+		retval = retval_char;
+		return 0;
+	}
+}
+
 int
 Client::_listen()
 {
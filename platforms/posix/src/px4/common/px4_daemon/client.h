@@ -37,6 +37,11 @@
  * the server. It will then close its half of the connection, and read back the
  * stdout stream of the process that it started, followed by its return value.
  *
+ * In session mode the connection stays open and multiple commands (read from
+ * stdin, one per line) are submitted back-to-back over the same socket. This
+ * avoids a process spawn plus connect() round-trip per command, which matters
+ * for scripted interaction issuing thousands of commands.
+ *
  * It the client dies, the connection gets closed automatically and the corresponding
  * thread in the server gets cancelled.
  *
@@ -76,9 +81,21 @@ public:
 	 */
 	int process_args(const int argc, const char **argv);
 
+	/**
+	 * Run a persistent session: read commands from stdin (one per line) and
+	 * submit each over a single connection to the server.
+	 *
+	 * @return the return value of the last executed command, or -1 on a
+	 *         communication error
+	 */
+	int process_session();
+
 private:
+	int _connect();
 	int _send_cmds(const int argc, const char **argv);
+	int _send_session_cmd(const char *line, size_t len);
 	int _listen();
+	int _listen_session(int &retval);
 
 	int _fd;
 	int _instance_id; ///< instance ID for running multiple instances of the px4 server
@@ -237,59 +237,64 @@ void
 	FILE *out = (FILE *)arg;
 	int fd = fileno(out);
 
-	// Read until the end of the incoming stream.
-	std::string cmd;
+	bool session = false;
 
-	while (true) {
-		size_t n = cmd.size();
-		cmd.resize(n + 1024);
-		ssize_t n_read = read(fd, &cmd[n], cmd.size() - n);
+	do {
+		// Read until the end of the incoming command.
+		std::string cmd;
 
-		if (n_read <= 0) {
-			_cleanup(fd);
-			return nullptr;
-		}
+		while (true) {
+			size_t n = cmd.size();
+			cmd.resize(n + 1024);
+			ssize_t n_read = read(fd, &cmd[n], cmd.size() - n);
 
-		cmd.resize(n + n_read);
+			if (n_read <= 0) {
+				_cleanup(fd);
+				return nullptr;
+			}
 
-		// Command ends in 0x00 (no tty) or 0x01 (tty).
-		if (!cmd.empty() && cmd.back() < 2) {
-			break;
+			cmd.resize(n + n_read);
+
+			// Command ends in a terminator byte: bit 0 is 'isatty', bit 1
+			// signals that more commands will follow on this connection.
+			if (!cmd.empty() && cmd.back() < 4) {
+				break;
+			}
 		}
-	}
 
-	if (cmd.size() < 2) {
-		_cleanup(fd);
-		return nullptr;
-	}
+		if (cmd.size() < 2) {
+			_cleanup(fd);
+			return nullptr;
+		}
 
-	// Last byte is 'isatty'.
-	uint8_t isatty = cmd.back();
-	cmd.pop_back();
+		uint8_t terminator = cmd.back();
+		cmd.pop_back();
+		session = terminator & 2;
 
-	// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
-	CmdThreadSpecificData *thread_data_ptr;
+		// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
+		CmdThreadSpecificData *thread_data_ptr;
 
-	if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
-		thread_data_ptr = new CmdThreadSpecificData;
-		thread_data_ptr->thread_stdout = out;
-		thread_data_ptr->is_atty = isatty;
+		if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
+			thread_data_ptr = new CmdThreadSpecificData;
+			thread_data_ptr->thread_stdout = out;
+			thread_data_ptr->is_atty = terminator & 1;
 
-		(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
-	}
+			(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
+		}
 
-	// Run the actual command.
-	int retval = Pxh::process_line(cmd, true);
+		// Run the actual command.
+		int retval = Pxh::process_line(cmd, true);
 
-	// Report return value.
-	char buf[2] = {0, (char)retval};
+		// Report return value.
+		char buf[2] = {0, (char)retval};
 
-	if (fwrite(buf, sizeof buf, 1, out) != 1) {
-		// Don't care it went wrong, as we're cleaning up anyway.
-	}
+		if (fwrite(buf, sizeof buf, 1, out) != 1) {
+			// Don't care it went wrong, as we're cleaning up anyway.
+		}
 
-	// Flush the FILE*'s buffer before we shut down the connection.
-	fflush(out);
+		// Flush the FILE*'s buffer so the client sees the complete response.
+		fflush(out);
+	} while (session);
 
 	_cleanup(fd);
 	return nullptr;
@@ -39,6 +39,9 @@
  * The server will return the stdout of the executing command, as well as the return
  * value to the client.
  *
+ * A client in session mode keeps its connection open and sends further commands
+ * after each response, so that one connection serves a whole scripted session.
+ *
  * There should only every be one server running, therefore the static instance.
  * The Singleton implementation is not complete, but it should be obvious not
  * to instantiate multiple servers.
@@ -422,6 +422,43 @@ const char *px4_get_taskname()
 	return prog_name;
 }
 
+int px4_task_set_cpu_affinity(px4_task_t pid, unsigned cpu_mask)
+{
+#ifdef __PX4_LINUX
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+
+	for (unsigned cpu = 0; cpu < sizeof(cpu_mask) * 8; cpu++) {
+		if (cpu_mask & (1u << cpu)) {
+			CPU_SET(cpu, &cpuset);
+		}
+	}
+
+	pthread_t thread;
+
+	if (pid < 0) {
+		thread = pthread_self();
+
+	} else {
+		pthread_mutex_lock(&task_mutex);
+
+		if ((pid >= PX4_MAX_TASKS) || !taskmap[pid].isused) {
+			pthread_mutex_unlock(&task_mutex);
+			return -ESRCH;
+		}
+
+		thread = taskmap[pid].pid;
+		pthread_mutex_unlock(&task_mutex);
+	}
+
+	int rv = pthread_setaffinity_np(thread, sizeof(cpuset), &cpuset);
+
+	return (rv > 0) ? -rv : rv;
+#else
+	return -ENOSYS;
+#endif
+}
+
 int px4_prctl(int option, const char *arg2, px4_task_t pid)
 {
 	int rv = -1;
@@ -60,15 +60,20 @@ ADC::ADC(uint32_t base_address, uint32_t channels, bool publish_adc_report) :
 	}
 
 	_samples = new px4_adc_msg_t[_channel_count];
+	_channel_list = new uint8_t[_channel_count];
+	_raw = new uint32_t[_channel_count];
+	_accum = new uint32_t[_channel_count];
+	_accum_count = new uint8_t[_channel_count];
 
-	/* prefill the channel numbers in the sample array */
-	if (_samples != nullptr) {
+	/* prefill the channel numbers in the sample array and the scan list */
+	if (_samples != nullptr && _channel_list != nullptr) {
 		unsigned index = 0;
 
 		for (unsigned i = 0; i < ADC_TOTAL_CHANNELS; i++) {
 			if (channels & (1 << i)) {
 				_samples[index].am_channel = i;
 				_samples[index].am_data = 0;
+				_channel_list[index] = i;
 				index++;
 			}
 		}
@@ -83,6 +88,11 @@ ADC::~ADC()
 		delete _samples;
 	}
 
+	delete[] _channel_list;
+	delete[] _raw;
+	delete[] _accum;
+	delete[] _accum_count;
+
 	perf_free(_sample_perf);
 	px4_arch_adc_uninit(_base_address);
 	close_gpio_devices();
@@ -112,10 +122,8 @@ void ADC::Run()
 
 	hrt_abstime now = hrt_absolute_time();
 
-	/* scan the channel set and sample each */
-	for (unsigned i = 0; i < _channel_count; i++) {
-		_samples[i].am_data = sample(_samples[i].am_channel);
-	}
+	/* convert the whole channel set as oversampled scan groups */
+	sample_all();
 
 	if (_publish_adc_report) {
 		update_adc_report(now);
@@ -290,17 +298,37 @@ void ADC::update_system_power(hrt_abstime now)
 #endif // BOARD_ADC_USB_CONNECTED
 }
 
-uint32_t ADC::sample(unsigned channel)
+void ADC::sample_all()
 {
 	perf_begin(_sample_perf);
-	uint32_t result = px4_arch_adc_sample(_base_address, channel);
 
-	if (result == UINT32_MAX) {
-		PX4_ERR("sample timeout");
+	memset(_accum, 0, _channel_count * sizeof(_accum[0]));
+	memset(_accum_count, 0, _channel_count * sizeof(_accum_count[0]));
+
+	for (unsigned s = 0; s < kOVERSAMPLING; s++) {
+		if (px4_arch_adc_sample_group(_base_address, _channel_count, _channel_list, _raw) < 0) {
+			PX4_ERR("sample timeout");
+		}
+
+		for (unsigned i = 0; i < _channel_count; i++) {
+			if (_raw[i] != UINT32_MAX) {
+				_accum[i] += _raw[i];
+				_accum_count[i]++;
+			}
+		}
+	}
+
+	/* decimate: one pass over the accumulators, rounding to nearest */
+	for (unsigned i = 0; i < _channel_count; i++) {
+		if (_accum_count[i] > 0) {
+			_samples[i].am_data = (_accum[i] + _accum_count[i] / 2) / _accum_count[i];
+
+		} else {
+			_samples[i].am_data = UINT32_MAX;
+		}
 	}
 
 	perf_end(_sample_perf);
-	return result;
 }
 
 int ADC::test()
@@ -86,12 +86,10 @@ private:
 	void		Run() override;
 
 	/**
-	 * Sample a single channel and return the measured value.
-	 *
-	 * @param channel		The channel to sample.
-	 * @return			The sampled value, or UINT32_MAX if sampling failed.
+	 * Convert the whole channel set kOVERSAMPLING times as hardware scan
+	 * groups and decimate the accumulated conversions into _samples.
 	 */
-	uint32_t		sample(unsigned channel);
+	void			sample_all();
 
 	void			update_adc_report(hrt_abstime now);
 	void			update_system_power(hrt_abstime now);
@@ -102,6 +100,8 @@ private:
 
 	static const hrt_abstime	kINTERVAL{10_ms};	/**< 100Hz base rate */
 
+	static constexpr unsigned	kOVERSAMPLING{4};	/**< conversions averaged per published sample */
+
 	const bool 			_publish_adc_report;
 
 	perf_counter_t			_sample_perf;
@@ -109,6 +109,10 @@ private:
 	unsigned			_channel_count{0};
 	const uint32_t			_base_address;
 	px4_adc_msg_t			*_samples{nullptr};	/**< sample buffer */
+	uint8_t				*_channel_list{nullptr};	/**< channel numbers in scan order */
+	uint32_t			*_raw{nullptr};		/**< one scan group of conversions */
+	uint32_t			*_accum{nullptr};	/**< per-channel oversampling accumulators */
+	uint8_t				*_accum_count{nullptr};	/**< valid conversions per accumulator */
 
 	uORB::Publication<adc_report_s>		_to_adc_report{ORB_ID(adc_report)};
 	uORB::Publication<system_power_s>	_to_system_power{ORB_ID(system_power)};
@@ -89,111 +89,142 @@ BATT_SMBUS::~BATT_SMBUS()
 
 void BATT_SMBUS::RunImpl()
 {
-	int ret = PX4_OK;
+	// Collection is split into short phases with at most a couple of bus
+	// transactions each. The work queue is yielded between phases, so a slow
+	// battery controller no longer stalls co-scheduled devices on the bus for
+	// the duration of a full report.
 
 	// Temporary variable for storing SMBUS reads.
 	uint16_t result;
 
-	// Read data from sensor.
-	battery_status_s new_report = {};
+	switch (_phase) {
+	case Phase::VOLTAGE_CURRENT: {
+			// Start a new report.
+			_report_in_progress = {};
+			_phase_ret = PX4_OK;
 
-	// TODO(hyonlim): this driver should support multiple SMBUS going forward.
-	new_report.id = 1;
+			// TODO(hyonlim): this driver should support multiple SMBUS going forward.
+			_report_in_progress.id = 1;
 
-	// Set time of reading.
-	new_report.timestamp = hrt_absolute_time();
+			_report_in_progress.connected = true;
 
-	new_report.connected = true;
+			_phase_ret |= _interface->read_word(BATT_SMBUS_VOLTAGE, result);
 
-	ret |= _interface->read_word(BATT_SMBUS_VOLTAGE, result);
+			// Convert millivolts to volts.
+			_report_in_progress.voltage_v = ((float)result) / 1000.0f;
+			_report_in_progress.voltage_filtered_v = _report_in_progress.voltage_v;
 
-	ret |= get_cell_voltages();
+			// Read current.
+			_phase_ret |= _interface->read_word(BATT_SMBUS_CURRENT, result);
 
-	for (int i = 0; i < _cell_count; i++) {
-		new_report.voltage_cell_v[i] = _cell_voltages[i];
-	}
+			_report_in_progress.current_a = (-1.0f * ((float)(*(int16_t *)&result)) / 1000.0f) * _c_mult;
+			_report_in_progress.current_filtered_a = _report_in_progress.current_a;
+
+			// Read average current.
+			_phase_ret |= _interface->read_word(BATT_SMBUS_AVERAGE_CURRENT, result);
 
-	// Convert millivolts to volts.
-	new_report.voltage_v = ((float)result) / 1000.0f;
-	new_report.voltage_filtered_v = new_report.voltage_v;
+			float average_current = (-1.0f * ((float)(*(int16_t *)&result)) / 1000.0f) * _c_mult;
 
-	// Read current.
-	ret |= _interface->read_word(BATT_SMBUS_CURRENT, result);
+			_report_in_progress.current_average_a = average_current;
+
+			// If current is high, turn under voltage protection off. This is neccessary to prevent
+			// a battery from cutting off while flying with high current near the end of the packs capacity.
+			set_undervoltage_protection(average_current);
+
+			_phase = Phase::CELL_VOLTAGES;
+			break;
+		}
 
-	new_report.current_a = (-1.0f * ((float)(*(int16_t *)&result)) / 1000.0f) * _c_mult;
-	new_report.current_filtered_a = new_report.current_a;
+	case Phase::CELL_VOLTAGES:
+		_phase_ret |= get_cell_voltages();
 
-	// Read average current.
-	ret |= _interface->read_word(BATT_SMBUS_AVERAGE_CURRENT, result);
+		for (int i = 0; i < _cell_count; i++) {
+			_report_in_progress.voltage_cell_v[i] = _cell_voltages[i];
+		}
 
-	float average_current = (-1.0f * ((float)(*(int16_t *)&result)) / 1000.0f) * _c_mult;
+		_phase = Phase::CAPACITY;
+		break;
 
-	new_report.current_average_a = average_current;
+	case Phase::CAPACITY:
+		// Read run time to empty (minutes).
+		_phase_ret |= _interface->read_word(BATT_SMBUS_RUN_TIME_TO_EMPTY, result);
+		_report_in_progress.time_remaining_s = result * 60;
 
-	// If current is high, turn under voltage protection off. This is neccessary to prevent
-	// a battery from cutting off while flying with high current near the end of the packs capacity.
-	set_undervoltage_protection(average_current);
+		// Read average time to empty (minutes).
+		_phase_ret |= _interface->read_word(BATT_SMBUS_AVERAGE_TIME_TO_EMPTY, result);
+		_report_in_progress.average_time_to_empty = result;
 
-	// Read run time to empty (minutes).
-	ret |= _interface->read_word(BATT_SMBUS_RUN_TIME_TO_EMPTY, result);
-	new_report.time_remaining_s = result * 60;
+		// Read remaining capacity.
+		_phase_ret |= _interface->read_word(BATT_SMBUS_REMAINING_CAPACITY, result);
 
-	// Read average time to empty (minutes).
-	ret |= _interface->read_word(BATT_SMBUS_AVERAGE_TIME_TO_EMPTY, result);
-	new_report.average_time_to_empty = result;
+		// Calculate total discharged amount in mah.
+		_report_in_progress.discharged_mah = _batt_startup_capacity - (float)result * _c_mult;
 
-	// Read remaining capacity.
-	ret |= _interface->read_word(BATT_SMBUS_REMAINING_CAPACITY, result);
+		_phase = Phase::STATUS_PUBLISH;
+		break;
 
-	// Calculate total discharged amount in mah.
-	new_report.discharged_mah = _batt_startup_capacity - (float)result * _c_mult;
+	case Phase::STATUS_PUBLISH:
+		// Read Relative SOC.
+		_phase_ret |= _interface->read_word(BATT_SMBUS_RELATIVE_SOC, result);
 
-	// Read Relative SOC.
-	ret |= _interface->read_word(BATT_SMBUS_RELATIVE_SOC, result);
+		// Normalize 0.0 to 1.0
+		_report_in_progress.remaining = (float)result / 100.0f;
 
-	// Normalize 0.0 to 1.0
-	new_report.remaining = (float)result / 100.0f;
+		// Read Max Error
+		_phase_ret |= _interface->read_word(BATT_SMBUS_MAX_ERROR, result);
+		_report_in_progress.max_error = result;
 
-	// Read Max Error
-	ret |= _interface->read_word(BATT_SMBUS_MAX_ERROR, result);
-	new_report.max_error = result;
+		// Read battery temperature and covert to Celsius.
+		_phase_ret |= _interface->read_word(BATT_SMBUS_TEMP, result);
+		_report_in_progress.temperature = ((float)result / 10.0f) + CONSTANTS_ABSOLUTE_NULL_CELSIUS;
 
-	// Read battery temperature and covert to Celsius.
-	ret |= _interface->read_word(BATT_SMBUS_TEMP, result);
-	new_report.temperature = ((float)result / 10.0f) + CONSTANTS_ABSOLUTE_NULL_CELSIUS;
+		// Only publish if no errors.
+		if (_phase_ret == PX4_OK) {
+			_report_in_progress.capacity = _batt_capacity;
+			_report_in_progress.cycle_count = _cycle_count;
+			_report_in_progress.serial_number = _serial_number;
+			_report_in_progress.max_cell_voltage_delta = _max_cell_voltage_delta;
+			_report_in_progress.cell_count = _cell_count;
+			_report_in_progress.state_of_health = _state_of_health;
 
-	// Only publish if no errors.
-	if (ret == PX4_OK) {
-		new_report.capacity = _batt_capacity;
-		new_report.cycle_count = _cycle_count;
-		new_report.serial_number = _serial_number;
-		new_report.max_cell_voltage_delta = _max_cell_voltage_delta;
-		new_report.cell_count = _cell_count;
-		new_report.state_of_health = _state_of_health;
+			// Check if max lifetime voltage delta is greater than allowed.
+			if (_lifetime_max_delta_cell_voltage > BATT_CELL_VOLTAGE_THRESHOLD_FAILED) {
+				_report_in_progress.warning = battery_status_s::BATTERY_WARNING_CRITICAL;
 
-		// Check if max lifetime voltage delta is greater than allowed.
-		if (_lifetime_max_delta_cell_voltage > BATT_CELL_VOLTAGE_THRESHOLD_FAILED) {
-			new_report.warning = battery_status_s::BATTERY_WARNING_CRITICAL;
+			} else if (_report_in_progress.remaining > _low_thr) {
+				_report_in_progress.warning = battery_status_s::BATTERY_WARNING_NONE;
 
-		} else if (new_report.remaining > _low_thr) {
-			new_report.warning = battery_status_s::BATTERY_WARNING_NONE;
+			} else if (_report_in_progress.remaining > _crit_thr) {
+				_report_in_progress.warning = battery_status_s::BATTERY_WARNING_LOW;
 
-		} else if (new_report.remaining > _crit_thr) {
-			new_report.warning = battery_status_s::BATTERY_WARNING_LOW;
+			} else if (_report_in_progress.remaining > _emergency_thr) {
+				_report_in_progress.warning = battery_status_s::BATTERY_WARNING_CRITICAL;
 
-		} else if (new_report.remaining > _emergency_thr) {
-			new_report.warning = battery_status_s::BATTERY_WARNING_CRITICAL;
+			} else {
+				_report_in_progress.warning = battery_status_s::BATTERY_WARNING_EMERGENCY;
+			}
 
-		} else {
-			new_report.warning = battery_status_s::BATTERY_WARNING_EMERGENCY;
+			_report_in_progress.interface_error = perf_event_count(_interface->_interface_errors);
+
+			// Set time of reading.
+			_report_in_progress.timestamp = hrt_absolute_time();
+
+			int instance = 0;
+			orb_publish_auto(ORB_ID(battery_status), &_batt_topic, &_report_in_progress, &instance);
+
+			_last_report = _report_in_progress;
 		}
 
-		new_report.interface_error = perf_event_count(_interface->_interface_errors);
+		_phase = Phase::VOLTAGE_CURRENT;
+		break;
+	}
 
-		int instance = 0;
-		orb_publish_auto(ORB_ID(battery_status), &_batt_topic, &new_report, &instance);
+	if (_phase == Phase::VOLTAGE_CURRENT) {
+		// report complete, start the next one after the measurement interval
+		ScheduleDelayed(BATT_SMBUS_MEASUREMENT_INTERVAL_US);
 
-		_last_report = new_report;
+	} else {
+		ScheduleDelayed(BATT_SMBUS_PHASE_GAP_US);
 	}
 }
 
@@ -204,7 +235,8 @@ void BATT_SMBUS::suspend()
 
 void BATT_SMBUS::resume()
 {
-	ScheduleOnInterval(BATT_SMBUS_MEASUREMENT_INTERVAL_US);
+	_phase = Phase::VOLTAGE_CURRENT;
+	ScheduleNow();
 }
 
 int BATT_SMBUS::get_cell_voltages()
@@ -214,21 +246,35 @@ int BATT_SMBUS::get_cell_voltages()
 	int ret = PX4_OK;
 
 	if (_device_type == SMBUS_DEVICE_TYPE::BQ40Z50) {
-		ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_1_VOLTAGE, result);
-		// Convert millivolts to volts.
-		_cell_voltages[0] = ((float)result) / 1000.0f;
+		uint8_t DAstatus1[32 + 2] = {}; // 32 bytes of data and 2 bytes of address
 
-		ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_2_VOLTAGE, result);
-		// Convert millivolts to volts.
-		_cell_voltages[1] = ((float)result) / 1000.0f;
+		// one DAStatus1 block read covers all four cells instead of four word reads
+		if (PX4_OK == manufacturer_read(BATT_SMBUS_DASTATUS1, DAstatus1, sizeof(DAstatus1))) {
+			// Convert millivolts to volts.
+			_cell_voltages[0] = ((float)((DAstatus1[1] << 8) | DAstatus1[0]) / 1000.0f);
+			_cell_voltages[1] = ((float)((DAstatus1[3] << 8) | DAstatus1[2]) / 1000.0f);
+			_cell_voltages[2] = ((float)((DAstatus1[5] << 8) | DAstatus1[4]) / 1000.0f);
+			_cell_voltages[3] = ((float)((DAstatus1[7] << 8) | DAstatus1[6]) / 1000.0f);
 
-		ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_3_VOLTAGE, result);
-		// Convert millivolts to volts.
-		_cell_voltages[2] = ((float)result) / 1000.0f;
+		} else {
+			// fall back to the individual cell voltage registers
+			ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_1_VOLTAGE, result);
+			// Convert millivolts to volts.
+			_cell_voltages[0] = ((float)result) / 1000.0f;
+
+			ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_2_VOLTAGE, result);
+			// Convert millivolts to volts.
+			_cell_voltages[1] = ((float)result) / 1000.0f;
+
+			ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_3_VOLTAGE, result);
+			// Convert millivolts to volts.
+			_cell_voltages[2] = ((float)result) / 1000.0f;
+
+			ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_4_VOLTAGE, result);
+			// Convert millivolts to volts.
+			_cell_voltages[3] = ((float)result) / 1000.0f;
+		}
 
-		ret |= _interface->read_word(BATT_SMBUS_BQ40Z50_CELL_4_VOLTAGE, result);
-		// Convert millivolts to volts.
-		_cell_voltages[3] = ((float)result) / 1000.0f;
 		_cell_voltages[4] = 0;
 		_cell_voltages[5] = 0;
 		_cell_voltages[6] = 0;
@@ -555,7 +601,7 @@ I2CSPIDriverBase *BATT_SMBUS::instantiate(const I2CSPIDriverConfig &config, int
 		return nullptr;
 	}
 
-	instance->ScheduleOnInterval(BATT_SMBUS_MEASUREMENT_INTERVAL_US);
+	instance->ScheduleDelayed(BATT_SMBUS_MEASUREMENT_INTERVAL_US);
 
 	return instance;
 }
@@ -59,6 +59,7 @@
 using namespace time_literals;
 
 #define BATT_SMBUS_MEASUREMENT_INTERVAL_US              100_ms         ///< time in microseconds, measure at 10Hz
+#define BATT_SMBUS_PHASE_GAP_US                         1_ms           ///< yield time between collection phases
 
 #define MAC_DATA_BUFFER_SIZE                            32
 
@@ -226,6 +227,27 @@ private:
 
 	SMBUS_DEVICE_TYPE _device_type{SMBUS_DEVICE_TYPE::UNDEFINED};
 
+	/**
+	 * Collection phases. Each phase performs at most a couple of bus
+	 * transactions and yields the work queue before the next one, so a slow
+	 * battery controller does not stall co-scheduled devices on the bus for
+	 * the duration of a full report.
+	 */
+	enum class Phase : uint8_t {
+		VOLTAGE_CURRENT = 0,
+		CELL_VOLTAGES,
+		CAPACITY,
+		STATUS_PUBLISH,
+	};
+
+	Phase _phase{Phase::VOLTAGE_CURRENT};
+
+	/** @param _report_in_progress Report assembled over the collection phases. */
+	battery_status_s _report_in_progress{};
+
+	/** @param _phase_ret Accumulated read errors of the current collection cycle. */
+	int _phase_ret{PX4_OK};
+
 	perf_counter_t _cycle{perf_alloc(PC_ELAPSED, "batt_smbus_cycle")};
 
 	static const uint8_t MAX_NUM_OF_CELLS = 7;
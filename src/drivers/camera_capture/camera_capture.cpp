@@ -95,11 +95,34 @@ CameraCapture::~CameraCapture()
 	camera_capture::g_camera_capture = nullptr;
 }
 
+void
+CameraCapture::push_edge(uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state, uint32_t overflow)
+{
+	const uint32_t head = _edge_head.load();
+	const uint32_t next = (head + 1) % EDGE_RING_SIZE;
+
+	if (next != _edge_tail.load()) {
+		_trig_s &slot = _edge_ring[head];
+		slot.chan_index = chan_index;
+		slot.hrt_edge_time = edge_time;
+		slot.edge_state = edge_state;
+		slot.overflow = overflow;
+		slot.edge_seq = _edge_seq_counter;
+		_edge_head.store(next);
+	}
+
+	// The edge count advances even when the ring is full, so the drain side
+	// sees the sequence gap instead of silently losing the capture.
+	_edge_seq_counter++;
+
+	work_queue(HPWORK, &_work_publisher, (worker_t)&CameraCapture::publish_trigger_trampoline, this, 0);
+}
+
 void
 CameraCapture::capture_callback(uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state, uint32_t overflow)
 {
 	// Maximum acceptable rate is 5kHz
-	if ((edge_time - _trigger.hrt_edge_time) < 200_us) {
+	if ((edge_time - _last_edge_time) < 200_us) {
 		++_trigger_rate_exceeded_counter;
 
 		if (_trigger_rate_exceeded_counter > 100) {
@@ -113,12 +136,9 @@ CameraCapture::capture_callback(uint32_t chan_index, hrt_abstime edge_time, uint
 		--_trigger_rate_exceeded_counter;
 	}
 
-	_trigger.chan_index = chan_index;
-	_trigger.hrt_edge_time = edge_time;
-	_trigger.edge_state = edge_state;
-	_trigger.overflow = overflow;
+	_last_edge_time = edge_time;
 
-	work_queue(HPWORK, &_work_publisher, (worker_t)&CameraCapture::publish_trigger_trampoline, this, 0);
+	push_edge(chan_index, edge_time, edge_state, overflow);
 }
 
 int
@@ -126,12 +146,7 @@ CameraCapture::gpio_interrupt_routine(int irq, void *context, void *arg)
 {
 	CameraCapture *dev = static_cast<CameraCapture *>(arg);
 
-	dev->_trigger.chan_index = 0;
-	dev->_trigger.hrt_edge_time = hrt_absolute_time();
-	dev->_trigger.edge_state = 0;
-	dev->_trigger.overflow = 0;
-
-	work_queue(HPWORK, &_work_publisher, (worker_t)&CameraCapture::publish_trigger_trampoline, dev, 0);
+	dev->push_edge(0, hrt_absolute_time(), 0, 0);
 
 	return PX4_OK;
 }
@@ -147,8 +162,6 @@ CameraCapture::publish_trigger_trampoline(void *arg)
 void
 CameraCapture::publish_trigger()
 {
-	bool publish = false;
-
 	if (_trigger_rate_failure.load()) {
 		mavlink_log_warning(&_mavlink_log_pub, "Hardware fault: Camera capture disabled\t");
 		events::send(events::ID("camera_capture_trigger_rate_exceeded"),
@@ -156,37 +169,63 @@ CameraCapture::publish_trigger()
 		_trigger_rate_failure.store(false);
 	}
 
+	// Drain every edge the ISR queued since the last run
+	while (true) {
+		const uint32_t tail = _edge_tail.load();
+
+		if (tail == _edge_head.load()) {
+			break;
+		}
+
+		const _trig_s edge = _edge_ring[tail];
+		_edge_tail.store((tail + 1) % EDGE_RING_SIZE);
+
+		if (edge.edge_seq > _edge_last_seq + 1) {
+			_edge_gaps += edge.edge_seq - _edge_last_seq - 1;
+		}
+
+		_edge_last_seq = edge.edge_seq;
+
+		process_edge(edge);
+	}
+}
+
+void
+CameraCapture::process_edge(const _trig_s &edge)
+{
+	bool publish = false;
+
 	camera_trigger_s trigger{};
 
 	// MODES 1 and 2 are not fully tested
 	if (_camera_capture_mode == 0 || _gpio_capture) {
-		trigger.timestamp = _trigger.hrt_edge_time - uint64_t(1000 * _strobe_delay);
+		trigger.timestamp = edge.hrt_edge_time - uint64_t(1000 * _strobe_delay);
 		trigger.seq = _capture_seq++;
 		_last_trig_time = trigger.timestamp;
 
 		publish = true;
 
 	} else if (_camera_capture_mode == 1) { // Get timestamp of mid-exposure (active high)
-		if (_trigger.edge_state == 1) {
-			_last_trig_begin_time = _trigger.hrt_edge_time - uint64_t(1000 * _strobe_delay);
+		if (edge.edge_state == 1) {
+			_last_trig_begin_time = edge.hrt_edge_time - uint64_t(1000 * _strobe_delay);
 
-		} else if (_trigger.edge_state == 0 && _last_trig_begin_time > 0) {
-			trigger.timestamp = _trigger.hrt_edge_time - ((_trigger.hrt_edge_time - _last_trig_begin_time) / 2);
+		} else if (edge.edge_state == 0 && _last_trig_begin_time > 0) {
+			trigger.timestamp = edge.hrt_edge_time - ((edge.hrt_edge_time - _last_trig_begin_time) / 2);
 			trigger.seq = _capture_seq++;
-			_last_exposure_time = _trigger.hrt_edge_time - _last_trig_begin_time;
+			_last_exposure_time = edge.hrt_edge_time - _last_trig_begin_time;
 			_last_trig_time = trigger.timestamp;
 			publish = true;
 			_capture_seq++;
 		}
 
 	} else { // Get timestamp of mid-exposure (active low)
-		if (_trigger.edge_state == 0) {
-			_last_trig_begin_time = _trigger.hrt_edge_time - uint64_t(1000 * _strobe_delay);
+		if (edge.edge_state == 0) {
+			_last_trig_begin_time = edge.hrt_edge_time - uint64_t(1000 * _strobe_delay);
 
-		} else if (_trigger.edge_state == 1 && _last_trig_begin_time > 0) {
-			trigger.timestamp = _trigger.hrt_edge_time - ((_trigger.hrt_edge_time - _last_trig_begin_time) / 2);
+		} else if (edge.edge_state == 1 && _last_trig_begin_time > 0) {
+			trigger.timestamp = edge.hrt_edge_time - ((edge.hrt_edge_time - _last_trig_begin_time) / 2);
 			trigger.seq = _capture_seq++;
-			_last_exposure_time = _trigger.hrt_edge_time - _last_trig_begin_time;
+			_last_exposure_time = edge.hrt_edge_time - _last_trig_begin_time;
 			_last_trig_time = trigger.timestamp;
 			publish = true;
 		}
@@ -194,7 +233,7 @@ CameraCapture::publish_trigger()
 	}
 
 	trigger.feedback = true;
-	_capture_overflows = _trigger.overflow;
+	_capture_overflows = edge.overflow;
 
 	if (!publish) {
 		return;
@@ -326,6 +365,7 @@ CameraCapture::reset_statistics(bool reset_seq)
 	_last_exposure_time = 0;
 	_last_trig_time = 0;
 	_capture_overflows = 0;
+	_edge_gaps = 0;
 }
 
 int
@@ -383,6 +423,7 @@ CameraCapture::status()
 	}
 
 	PX4_INFO("Number of overflows : %" PRIu32, _capture_overflows);
+	PX4_INFO("Edges lost to ring overruns : %" PRIu32, _edge_gaps);
 
 	if (_gpio_capture) {
 		PX4_INFO("Using board GPIO pin");
@@ -106,13 +106,31 @@ private:
 	uORB::Subscription				_command_sub{ORB_ID(vehicle_command)};
 	uORB::Subscription				_pps_capture_sub{ORB_ID(pps_capture)};
 
-	// Trigger Buffer
+	// Edge ring buffer, written from the capture ISR and drained in batch from the
+	// work queue, so bursts at high frame rates do not overwrite edges while the
+	// worker is busy. The ISR is the only writer and the worker the only reader,
+	// which makes single atomic head/tail indices sufficient.
+	static constexpr unsigned EDGE_RING_SIZE = 32;
+
 	struct _trig_s {
 		uint32_t chan_index;
 		hrt_abstime hrt_edge_time;
 		uint32_t edge_state;
 		uint32_t overflow;
-	} _trigger{};
+		uint32_t edge_seq;	///< monotonic edge count, for gap detection on the drain side
+	};
+
+	_trig_s			_edge_ring[EDGE_RING_SIZE] {};
+	px4::atomic<uint32_t>	_edge_head{0};		///< next slot the ISR writes
+	px4::atomic<uint32_t>	_edge_tail{0};		///< next slot the worker reads
+
+	// ISR-side state
+	uint32_t		_edge_seq_counter{0};
+	hrt_abstime		_last_edge_time{0};
+
+	// Drain-side gap statistics
+	uint32_t		_edge_last_seq{0};
+	uint32_t		_edge_gaps{0};		///< edges lost because the ring was full
 
 	bool			_capture_enabled{false};
 	bool			_gpio_capture{false};
@@ -142,6 +160,12 @@ private:
 	// Signal capture callback
 	void			capture_callback(uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state, uint32_t overflow);
 
+	// Push an edge into the ring (interrupt context)
+	void			push_edge(uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state, uint32_t overflow);
+
+	// Per-edge trigger processing (work queue context)
+	void			process_edge(const _trig_s &edge);
+
 	// GPIO interrupt routine
 	static int		gpio_interrupt_routine(int irq, void *context, void *arg);
 
@@ -58,6 +58,7 @@
 
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/camera_trigger.h>
 #include <uORB/topics/pps_capture.h>
 #include <uORB/topics/vehicle_command.h>
@@ -187,7 +188,7 @@ private:
 	uint32_t		_target_system{0};
 	uint32_t		_target_component{0};
 
-	uORB::Subscription	_command_sub{ORB_ID(vehicle_command)};
+	uORB::SubscriptionCallbackWorkItem	_command_sub{this, ORB_ID(vehicle_command)};
 	uORB::Subscription	_lpos_sub{ORB_ID(vehicle_local_position)};
 	uORB::Subscription	_pps_capture_sub{ORB_ID(pps_capture)};
 
@@ -463,7 +464,11 @@ CameraTrigger::start()
 		_trigger_enabled = true;
 	}
 
-	// start to monitor at high rate for trigger enable command
+	// commands wake the work item through the subscription callback,
+	// no periodic polling needed for them
+	_command_sub.registerCallback();
+
+	// evaluate the initial state
 	ScheduleNow();
 
 	return true;
@@ -472,6 +477,7 @@ CameraTrigger::start()
 void
 CameraTrigger::stop()
 {
+	_command_sub.unregisterCallback();
 	ScheduleClear();
 
 	hrt_cancel(&_engagecall);
@@ -776,7 +782,18 @@ unknown_cmd:
 		_cmd_ack_pub.publish(command_ack);
 	}
 
-	ScheduleDelayed(poll_interval_usec);
+	// the trigger pulses themselves run on hrt callouts and commands wake us
+	// through the subscription callback; keep the periodic schedule only while
+	// it is actually needed
+	if (_turning_on || _one_shot) {
+		ScheduleDelayed(poll_interval_usec);
+
+	} else if (_trigger_enabled && !_trigger_paused &&
+		   (_trigger_mode == TRIGGER_MODE_DISTANCE_ON_CMD ||
+		    _trigger_mode == TRIGGER_MODE_DISTANCE_ALWAYS_ON)) {
+		// distance based triggering needs periodic position checks
+		ScheduleDelayed(poll_interval_usec);
+	}
 }
 
 void
@@ -56,8 +56,128 @@
 
 O1HeapInstance *cyphal_allocator{nullptr};
 
-static void *memAllocate(CanardInstance *const ins, const size_t amount) { return o1heapAllocate(cyphal_allocator, amount); }
-static void memFree(CanardInstance *const ins, void *const pointer) { o1heapFree(cyphal_allocator, pointer); }
+/*
+ * Fixed block pools in front of the o1heap arena. The per-transfer
+ * allocations made by libcanard fall into two size classes: frame-sized
+ * blocks (TX queue items, RX session states and single-frame payloads) and
+ * extent-sized payload buffers for multi-frame transfers. Serving those from
+ * free lists makes the RX/TX fast path allocation a pointer pop/push;
+ * o1heap remains as fallback for oversized requests or exhausted pools, so
+ * behaviour under overload is unchanged.
+ *
+ * All allocator calls are made from the cyphal thread only (same assumption
+ * o1heap relies on today), so the free lists need no locking.
+ */
+class CanardBlockPool
+{
+public:
+	void init(uint8_t *memory, size_t block_size, unsigned num_blocks)
+	{
+		_memory = memory;
+		_block_size = block_size;
+		_num_blocks = num_blocks;
+		_free_head = nullptr;
+
+		for (unsigned i = 0; i < num_blocks; ++i) {
+			Block *block = reinterpret_cast<Block *>(_memory + i * block_size);
+			block->next = _free_head;
+			_free_head = block;
+		}
+	}
+
+	bool contains(const void *pointer) const
+	{
+		return (const uint8_t *)pointer >= _memory && (const uint8_t *)pointer < _memory + _block_size * _num_blocks;
+	}
+
+	void *allocate()
+	{
+		if (_free_head == nullptr) {
+			return nullptr;
+		}
+
+		Block *block = _free_head;
+		_free_head = block->next;
+		++_used;
+
+		if (_used > _peak_used) {
+			_peak_used = _used;
+		}
+
+		return block;
+	}
+
+	void free(void *pointer)
+	{
+		Block *block = static_cast<Block *>(pointer);
+		block->next = _free_head;
+		_free_head = block;
+		--_used;
+	}
+
+	unsigned used() const { return _used; }
+	unsigned peakUsed() const { return _peak_used; }
+	unsigned numBlocks() const { return _num_blocks; }
+
+private:
+	struct Block {
+		Block *next;
+	};
+
+	uint8_t *_memory{nullptr};
+	Block *_free_head{nullptr};
+	size_t _block_size{0};
+	unsigned _num_blocks{0};
+	unsigned _used{0};
+	unsigned _peak_used{0};
+};
+
+// frame class: large enough for a TX queue item carrying a CAN FD frame
+static constexpr size_t FramePoolBlockSize = (sizeof(CanardTxQueueItem) + CANARD_MTU_CAN_FD + (O1HEAP_ALIGNMENT - 1)) &
+		~(O1HEAP_ALIGNMENT - 1);
+static constexpr unsigned FramePoolNumBlocks = 32;
+// payload class: multi-frame RX payload buffers, sized for the largest subscribed extent
+static constexpr size_t PayloadPoolBlockSize = 512;
+static constexpr unsigned PayloadPoolNumBlocks = 8;
+
+alignas(O1HEAP_ALIGNMENT) static uint8_t frame_pool_memory[FramePoolBlockSize * FramePoolNumBlocks];
+alignas(O1HEAP_ALIGNMENT) static uint8_t payload_pool_memory[PayloadPoolBlockSize * PayloadPoolNumBlocks];
+
+static CanardBlockPool frame_pool;
+static CanardBlockPool payload_pool;
+
+static void *memAllocate(CanardInstance *const ins, const size_t amount)
+{
+	if (amount <= FramePoolBlockSize) {
+		void *pointer = frame_pool.allocate();
+
+		if (pointer != nullptr) {
+			return pointer;
+		}
+
+	} else if (amount <= PayloadPoolBlockSize) {
+		void *pointer = payload_pool.allocate();
+
+		if (pointer != nullptr) {
+			return pointer;
+		}
+	}
+
+	return o1heapAllocate(cyphal_allocator, amount);
+}
+
+static void memFree(CanardInstance *const ins, void *const pointer)
+{
+	if (frame_pool.contains(pointer)) {
+		frame_pool.free(pointer);
+
+	} else if (payload_pool.contains(pointer)) {
+		payload_pool.free(pointer);
+
+	} else {
+		o1heapFree(cyphal_allocator, pointer);
+	}
+}
 
 
 CanardHandle::CanardHandle(uint32_t node_id, const size_t capacity, const size_t mtu_bytes)
@@ -69,6 +189,9 @@ CanardHandle::CanardHandle(uint32_t node_id, const size_t capacity, const size_t
 		PX4_ERR("o1heapInit failed with size %u", HeapSize);
 	}
 
+	frame_pool.init(frame_pool_memory, FramePoolBlockSize, FramePoolNumBlocks);
+	payload_pool.init(payload_pool_memory, PayloadPoolBlockSize, PayloadPoolNumBlocks);
+
 	_canard_instance = canardInit(&memAllocate, &memFree);
 
 	_canard_instance.node_id = node_id; // Defaults to anonymous; can be set up later at any point.
@@ -207,6 +330,13 @@ O1HeapDiagnostics CanardHandle::getO1HeapDiagnostics()
 	return o1heapGetDiagnostics(cyphal_allocator);
 }
 
+void CanardHandle::printPoolStatus()
+{
+	PX4_INFO("Frame pool %u/%u blocks of %zu (peak %u), payload pool %u/%u blocks of %zu (peak %u)",
+		 frame_pool.used(), frame_pool.numBlocks(), FramePoolBlockSize, frame_pool.peakUsed(),
+		 payload_pool.used(), payload_pool.numBlocks(), PayloadPoolBlockSize, payload_pool.peakUsed());
+}
+
 int32_t CanardHandle::mtu()
 {
 	return _queue.mtu_bytes;
@@ -70,6 +70,7 @@ public:
 			     const CanardPortID       port_id);
 	CanardTreeNode *getRxSubscriptions(CanardTransferKind kind);
 	O1HeapDiagnostics getO1HeapDiagnostics();
+	void printPoolStatus();
 
 	int32_t mtu();
 	CanardNodeID node_id();
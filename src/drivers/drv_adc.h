@@ -84,6 +84,22 @@ void px4_arch_adc_uninit(uint32_t base_address);
  */
 uint32_t px4_arch_adc_sample(uint32_t base_address, unsigned channel);
 
+/**
+ * Read a group of channels from the ADC
+ *
+ * Where the hardware has a sequencer the whole group is converted
+ * back-to-back from a single trigger, so the inter-channel skew is one
+ * conversion time rather than one call per channel. Architectures
+ * without sequencer support convert the channels one at a time.
+ *
+ * @param base_address architecture-specific address to specify the ADC
+ * @param count number of channels to convert
+ * @param channels the channel number for each entry in values
+ * @param values one sample per channel, 0xffffffff on conversion error
+ * @return 0 on success, <0 if any conversion failed
+ */
+int px4_arch_adc_sample_group(uint32_t base_address, unsigned count, const uint8_t *channels, uint32_t *values);
+
 /**
  * Get the ADC positive reference voltage
  * N.B This assume that all ADC channels share the same vref.
@@ -80,6 +80,9 @@ typedef struct hrt_call {
 	hrt_abstime		period;
 	hrt_callout		callout;
 	void			*arg;
+#if defined(__PX4_POSIX)
+	struct sq_queue_s	*wheel_slot;	/* timer wheel bucket this entry is currently queued in */
+#endif
 #if defined(__PX4_NUTTX) && !defined(CONFIG_BUILD_FLAT)
 	hrt_callout		usr_callout;
 	void			*usr_arg;
@@ -172,6 +175,36 @@ static inline hrt_abstime hrt_elapsed_time(const hrt_abstime *then)
  */
 __EXPORT extern void hrt_store_absolute_time(volatile hrt_abstime *time);
 
+/**
+ * Update the drift-corrected hrt -> UTC mapping.
+ *
+ * Called by the PPS capture driver once per disciplined pulse. The mapping
+ * extrapolates between updates using the supplied frequency error, so the
+ * hrt timebase itself is never stepped.
+ *
+ * @param utc_time_us UTC time in microseconds at the reference edge
+ * @param hrt_time hrt timestamp of the same edge
+ * @param drift_ppm hrt frequency error relative to GPS time, in parts per
+ *                  million (positive when the hrt clock runs fast)
+ */
+__EXPORT extern void hrt_utc_set_reference(uint64_t utc_time_us, hrt_abstime hrt_time, float drift_ppm);
+
+/**
+ * Convert an hrt timestamp to UTC microseconds using the PPS-disciplined mapping.
+ *
+ * @param utc_time_us set to the UTC time corresponding to hrt_time
+ * @param hrt_time hrt timestamp to convert
+ * @return 0 on success, -1 while no PPS reference has been set
+ */
+__EXPORT extern int hrt_utc_time(uint64_t *utc_time_us, hrt_abstime hrt_time);
+
+/**
+ * Get the current hrt frequency-error estimate in parts per million.
+ *
+ * @return the estimate, or 0 while the mapping is undisciplined
+ */
+__EXPORT extern float hrt_utc_drift_ppm(void);
+
 #ifdef __PX4_QURT
 /**
  * Set a time offset to hrt_absolute_time on the DSP.
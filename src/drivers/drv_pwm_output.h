@@ -209,6 +209,15 @@ __EXPORT extern void up_pwm_update(unsigned channel_mask);
  */
 __EXPORT extern int	up_pwm_servo_set(unsigned channel, uint16_t value);
 
+/**
+ * Set the current output value for a whole bank of channels in one call.
+ *
+ * @param channel_mask	Bitmask of channels to set.
+ * @param values	The output pulse widths in microseconds, indexed by channel.
+ * @return		OK, or the last error returned for an individual channel.
+ */
+__EXPORT extern int	up_pwm_servo_set_multi(uint32_t channel_mask, const uint16_t *values);
+
 /**
  * Get the current output value for a channel.
  *
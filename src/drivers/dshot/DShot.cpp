@@ -57,6 +57,7 @@ DShot::~DShot()
 	up_dshot_arm(false);
 
 	perf_free(_cycle_perf);
+	perf_free(_telemetry_perf);
 	delete _telemetry;
 }
 
@@ -462,7 +463,10 @@ void DShot::Run()
 	}
 
 	if (_telemetry) {
+		// time spent reading & decoding telemetry, as it shares the cycle with the output update
+		perf_begin(_telemetry_perf);
 		int telem_update = _telemetry->handler.update();
+		perf_end(_telemetry_perf);
 
 		// Are we waiting for ESC info?
 		if (_waiting_for_esc_info) {
@@ -706,6 +710,7 @@ int DShot::print_status()
 	PX4_INFO("Outputs used: 0x%" PRIx32, _output_mask);
 	PX4_INFO("Outputs on: %s", _outputs_on ? "yes" : "no");
 	perf_print_counter(_cycle_perf);
+	perf_print_counter(_telemetry_perf);
 	_mixing_output.printStatus();
 
 	if (_telemetry) {
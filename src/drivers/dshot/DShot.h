@@ -163,6 +163,7 @@ private:
 	uint32_t _output_mask{0};
 
 	perf_counter_t	_cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
+	perf_counter_t	_telemetry_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": telemetry update")};
 
 	Command _current_command{};
 
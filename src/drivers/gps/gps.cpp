@@ -51,6 +51,7 @@
 #include <drivers/drv_sensor.h>
 #include <lib/drivers/device/Device.hpp>
 #include <lib/parameters/param.h>
+#include <lib/perf/perf_counter.h>
 #include <mathlib/mathlib.h>
 #include <matrix/math.hpp>
 #include <px4_platform_common/atomic.h>
@@ -196,6 +197,9 @@ private:
 	hrt_abstime			_last_rtcm_injection_time{0};			///< time of last rtcm injection
 	uint8_t				_selected_rtcm_instance{0};			///< uorb instance that is being used for RTCM corrections
 
+	hrt_abstime			_last_read_timestamp{0};			///< time of the last burst read from the UART
+	perf_counter_t			_publish_latency_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": publish latency")};	///< UART burst read to sensor_gps publication
+
 	const Instance 			_instance;
 
 	uORB::Subscription		     _orb_inject_data_sub{ORB_ID(gps_inject_data)};
@@ -374,6 +378,8 @@ GPS::~GPS()
 	delete _dump_to_device;
 	delete _dump_from_device;
 	delete _helper;
+
+	perf_free(_publish_latency_perf);
 }
 
 int GPS::callback(GPSCallbackType type, void *data1, int data2, void *user)
@@ -464,6 +470,9 @@ int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 	if (ret > 0) {
 		/* if we have new data from GPS, go handle it */
 		if (fds[0].revents & POLLIN) {
+			/* the UART went from idle to data available: reference for the publish latency */
+			_last_read_timestamp = hrt_absolute_time();
+
 			/*
 			 * We are here because poll says there is some data, so this
 			 * won't block even on a blocking device. But don't read immediately
@@ -484,6 +493,16 @@ int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 				px4_usleep(sleeptime);
 			}
 
+#elif defined(FIONREAD)
+			/* The serial driver accumulates whole bursts (with RX DMA/idle detection where
+			 * the kernel supports it); if one is already buffered read it immediately
+			 * instead of waiting another character time. */
+			int bytes_available = 0;
+
+			if (::ioctl(_serial_fd, FIONREAD, &bytes_available) != 0 || bytes_available < (int)character_count) {
+				px4_usleep(sleeptime);
+			}
+
 #else
 			px4_usleep(sleeptime);
 #endif
@@ -1126,6 +1145,7 @@ GPS::print_status()
 
 		PX4_INFO("rate publication:\t\t%6.2f Hz", (double)_rate);
 		PX4_INFO("rate RTCM injection:\t%6.2f Hz", (double)_rate_rtcm_injection);
+		perf_print_counter(_publish_latency_perf);
 
 		print_message(ORB_ID(sensor_gps), _report_gps_pos);
 	}
@@ -1184,6 +1204,11 @@ GPS::publish()
 		// The uORB message definition requires this data to be set to a NAN if no new valid data is available.
 		_report_gps_pos.heading = NAN;
 		_is_gps_main_advertised.store(true);
+
+		if (_last_read_timestamp != 0) {
+			// latency from the UART burst that completed the message to its publication
+			perf_set_elapsed(_publish_latency_perf, hrt_elapsed_time(&_last_read_timestamp));
+		}
 	}
 }
 
@@ -221,24 +221,57 @@ void Heater::Run()
 			_temperature_last = sensor_accel.temperature;
 		}
 
-		_proportional_value = temperature_delta * _param_sens_imu_temp_p.get();
-		_integrator_value += temperature_delta * _param_sens_imu_temp_i.get();
+		if ((_param_sens_imu_temp_wub.get() > FLT_EPSILON) && (temperature_delta > _param_sens_imu_temp_wub.get())) {
+			// Warm-up: this far below the setpoint the thermal model demands saturation
+			// anyway, so drive full duty instead of waiting for the integrator to wind
+			// up. Preset the integrator for a bumpless handover to the PI loop at the
+			// edge of the warm-up band.
+			_proportional_value = temperature_delta * _param_sens_imu_temp_p.get();
+			_integrator_value = math::constrain(1.0f - _param_sens_imu_temp_ff.get() - _proportional_value, -0.25f, 0.25f);
 
-		_integrator_value = math::constrain(_integrator_value, -0.25f, 0.25f);
+			_controller_time_on_usec = _controller_period_usec;
 
-		_controller_time_on_usec = static_cast<int>((_param_sens_imu_temp_ff.get() + _proportional_value +
-					   _integrator_value) * static_cast<float>(_controller_period_usec));
+		} else {
+			_proportional_value = temperature_delta * _param_sens_imu_temp_p.get();
+			_integrator_value += temperature_delta * _param_sens_imu_temp_i.get();
+
+			_integrator_value = math::constrain(_integrator_value, -0.25f, 0.25f);
+
+			_controller_time_on_usec = static_cast<int>((_param_sens_imu_temp_ff.get() + _proportional_value +
+						   _integrator_value) * static_cast<float>(_controller_period_usec));
 
-		_controller_time_on_usec = math::constrain(_controller_time_on_usec, 0, _controller_period_usec);
+			_controller_time_on_usec = math::constrain(_controller_time_on_usec, 0, _controller_period_usec);
+		}
 
 		if (abs(temperature_delta) < TEMPERATURE_TARGET_THRESHOLD) {
 			_temperature_target_met = true;
 
+			if (_target_met_since == 0) {
+				_target_met_since = hrt_absolute_time();
+			}
+
 		} else {
 
 			_temperature_target_met = false;
+			_target_met_since = 0;
 		}
 
+		// Predict the remaining warm-up time from the first order thermal model so the
+		// preflight checks can report when the IMU will be ready instead of just that
+		// it is not. Readiness additionally requires the temperature to have stayed
+		// inside the target band for a settling time.
+		if (_temperature_target_met || (temperature_delta <= TEMPERATURE_TARGET_THRESHOLD)
+		    || (_param_sens_imu_temp_tau.get() < FLT_EPSILON)) {
+			_estimated_time_to_ready = 0.f;
+
+		} else {
+			_estimated_time_to_ready = _param_sens_imu_temp_tau.get()
+						   * logf(temperature_delta / TEMPERATURE_TARGET_THRESHOLD);
+		}
+
+		_temperature_stable = _temperature_target_met && (_target_met_since != 0)
+				      && (hrt_elapsed_time(&_target_met_since) > TEMPERATURE_STABLE_TIME_US);
+
 		_heater_on = true;
 		heater_on();
 		ScheduleDelayed(_controller_time_on_usec);
@@ -255,6 +288,8 @@ void Heater::publish_status()
 	status.temperature_sensor      = _temperature_last;
 	status.temperature_target      = _param_sens_imu_temp.get();
 	status.temperature_target_met  = _temperature_target_met;
+	status.temperature_stable      = _temperature_stable;
+	status.estimated_time_to_ready = _estimated_time_to_ready;
 	status.controller_period_usec  = _controller_period_usec;
 	status.controller_time_on_usec = _controller_time_on_usec;
 	status.proportional_value      = _proportional_value;
@@ -42,6 +42,7 @@
 
 #pragma once
 
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/getopt.h>
 #include <px4_platform_common/module.h>
@@ -59,6 +60,7 @@ using namespace time_literals;
 
 #define CONTROLLER_PERIOD_DEFAULT    10000
 #define TEMPERATURE_TARGET_THRESHOLD 2.5f
+#define TEMPERATURE_STABLE_TIME_US   10_s
 
 class Heater : public ModuleBase<Heater>, public ModuleParams, public px4::ScheduledWorkItem
 {
@@ -141,6 +143,11 @@ private:
 	bool _heater_initialized     = false;
 	bool _heater_on              = false;
 	bool _temperature_target_met = false;
+	bool _temperature_stable     = false;
+
+	hrt_abstime _target_met_since{0};
+
+	float _estimated_time_to_ready{0.f};
 
 	int _controller_period_usec = CONTROLLER_PERIOD_DEFAULT;
 	int _controller_time_on_usec = 0;
@@ -159,10 +166,12 @@ private:
 	float _temperature_last{NAN};
 
 	DEFINE_PARAMETERS(
-		(ParamFloat<px4::params::SENS_IMU_TEMP_FF>) _param_sens_imu_temp_ff,
-		(ParamFloat<px4::params::SENS_IMU_TEMP_I>)  _param_sens_imu_temp_i,
-		(ParamFloat<px4::params::SENS_IMU_TEMP_P>)  _param_sens_imu_temp_p,
-		(ParamFloat<px4::params::SENS_IMU_TEMP>)    _param_sens_imu_temp,
-		(ParamInt<px4::params::SENS_TEMP_ID>)       _param_sens_temp_id
+		(ParamFloat<px4::params::SENS_IMU_TEMP_FF>)  _param_sens_imu_temp_ff,
+		(ParamFloat<px4::params::SENS_IMU_TEMP_I>)   _param_sens_imu_temp_i,
+		(ParamFloat<px4::params::SENS_IMU_TEMP_P>)   _param_sens_imu_temp_p,
+		(ParamFloat<px4::params::SENS_IMU_TEMP_TAU>) _param_sens_imu_temp_tau,
+		(ParamFloat<px4::params::SENS_IMU_TEMP_WUB>) _param_sens_imu_temp_wub,
+		(ParamFloat<px4::params::SENS_IMU_TEMP>)     _param_sens_imu_temp,
+		(ParamInt<px4::params::SENS_TEMP_ID>)        _param_sens_temp_id
 	)
 };
@@ -95,3 +95,37 @@ PARAM_DEFINE_FLOAT(SENS_IMU_TEMP_I, 0.025f);
  * @decimal 3
  */
 PARAM_DEFINE_FLOAT(SENS_IMU_TEMP_P, 1.0f);
+
+/**
+ * IMU heater warm-up band.
+ *
+ * Below setpoint minus this band the heater is driven at full duty
+ * instead of through the PI loop; PI takes over for the final approach.
+ * The identified thermal model demands saturation that far from the
+ * setpoint anyway, so this only removes the integrator wind-up time.
+ * Set to 0 to disable the full duty warm-up.
+ *
+ * @category system
+ * @group Sensors
+ * @unit celcius
+ * @min 0
+ * @max 50.0
+ * @decimal 1
+ */
+PARAM_DEFINE_FLOAT(SENS_IMU_TEMP_WUB, 5.0f);
+
+/**
+ * IMU heater thermal time constant.
+ *
+ * First order time constant of the heated IMU identified once per board
+ * design, used to predict the remaining warm-up time reported in
+ * heater_status for preflight checks.
+ *
+ * @category system
+ * @group Sensors
+ * @unit s
+ * @min 1.0
+ * @max 600.0
+ * @decimal 0
+ */
+PARAM_DEFINE_FLOAT(SENS_IMU_TEMP_TAU, 120.0f);
@@ -645,10 +645,12 @@ uint16_t ADIS16448::RegisterRead(Register reg)
 	uint16_t cmd[1];
 	cmd[0] = (static_cast<uint16_t>(reg) << 8);
 
-	transferhword(cmd, nullptr, 1);
-	px4_udelay(SPI_STALL_PERIOD);
-	transferhword(nullptr, cmd, 1);
-	px4_udelay(SPI_STALL_PERIOD);
+	// chain address and data frames into one bus transaction, with the required stall periods
+	TransferSegment segments[2] {
+		{cmd, nullptr, 1, SPI_STALL_PERIOD},
+		{nullptr, cmd, 1, SPI_STALL_PERIOD},
+	};
+	transfer_batchhword(segments, 2);
 
 	return cmd[0];
 }
@@ -676,10 +678,12 @@ void ADIS16448::RegisterWrite(Register reg, uint16_t value)
 	cmd[0] = (((static_cast<uint16_t>(reg))     | DIR_WRITE) << 8) | ((0x00FF & value));
 	cmd[1] = (((static_cast<uint16_t>(reg) + 1) | DIR_WRITE) << 8) | ((0xFF00 & value) >> 8);
 
-	transferhword(cmd, nullptr, 1);
-	px4_udelay(SPI_STALL_PERIOD);
-	transferhword(cmd + 1, nullptr, 1);
-	px4_udelay(SPI_STALL_PERIOD);
+	// chain the two write frames into one bus transaction, with the required stall periods
+	TransferSegment segments[2] {
+		{cmd, nullptr, 1, SPI_STALL_PERIOD},
+		{cmd + 1, nullptr, 1, SPI_STALL_PERIOD},
+	};
+	transfer_batchhword(segments, 2);
 }
 
 void ADIS16448::RegisterSetAndClearBits(Register reg, uint16_t setbits, uint16_t clearbits)
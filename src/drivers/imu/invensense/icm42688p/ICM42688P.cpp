@@ -690,7 +690,8 @@ void ICM42688P::ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DA
 
 void ICM42688P::ProcessGyro(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples)
 {
-	sensor_gyro_fifo_s gyro{};
+	// assemble the message directly in the uORB queue slot where possible (zero-copy publication)
+	sensor_gyro_fifo_s &gyro = _px4_gyro.fifoBuffer();
 	gyro.timestamp_sample = timestamp_sample;
 	gyro.samples = 0;
 	gyro.dt = FIFO_SAMPLE_DT;
@@ -755,9 +756,8 @@ void ICM42688P::ProcessGyro(const hrt_abstime &timestamp_sample, const FIFO::DAT
 	_px4_gyro.set_error_count(perf_event_count(_bad_register_perf) + perf_event_count(_bad_transfer_perf) +
 				  perf_event_count(_fifo_empty_perf) + perf_event_count(_fifo_overflow_perf));
 
-	if (gyro.samples > 0) {
-		_px4_gyro.updateFIFO(gyro);
-	}
+	// publishes if there are samples, otherwise returns the lent queue slot
+	_px4_gyro.updateFIFO(gyro);
 }
 
 bool ICM42688P::ProcessTemperature(const FIFO::DATA fifo[], const uint8_t samples)
@@ -44,6 +44,7 @@
 #include <parameters/param.h>
 #include <px4_platform_common/events.h>
 #include <systemlib/mavlink_log.h>
+#include <math.h>
 
 PPSCapture::PPSCapture() :
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::hp_default)
@@ -135,6 +136,10 @@ void PPSCapture::Run()
 
 	_pps_capture_pub.publish(pps_capture);
 
+	if (_last_gps_utc_timestamp > 0) {
+		update_clock_discipline(pps_capture.rtc_timestamp);
+	}
+
 	if (_pps_rate_failure.load()) {
 		mavlink_log_warning(&_mavlink_log_pub, "Hardware fault: GPS PPS disabled\t");
 		events::send(events::ID("pps_capture_pps_rate_exceeded"),
@@ -143,6 +148,38 @@ void PPSCapture::Run()
 	}
 }
 
+void PPSCapture::update_clock_discipline(uint64_t pps_utc_time)
+{
+	if (_last_pps_hrt_timestamp > 0 && pps_utc_time > _last_pps_utc_timestamp) {
+		const int64_t utc_interval = pps_utc_time - _last_pps_utc_timestamp;
+		const int64_t hrt_interval = _hrt_timestamp - _last_pps_hrt_timestamp;
+
+		// The edges sit on whole seconds of GPS time, so a missed pulse only lengthens
+		// the measurement baseline. Beyond a few seconds the sample is too stale to trust.
+		if (utc_interval >= (int64_t)USEC_PER_SEC && utc_interval <= 10 * (int64_t)USEC_PER_SEC) {
+			const float ppm_sample = (float)(hrt_interval - utc_interval) * 1e6f / (float)utc_interval;
+
+			// a second miscounted by the rounding in Run() shows up as ~1e5 ppm and is dropped here
+			if (fabsf(ppm_sample) < MAX_DRIFT_PPM) {
+				if (_drift_valid) {
+					_drift_ppm += DRIFT_FILTER_GAIN * (ppm_sample - _drift_ppm);
+
+				} else {
+					_drift_ppm = ppm_sample;
+					_drift_valid = true;
+				}
+			}
+		}
+	}
+
+	_last_pps_utc_timestamp = pps_utc_time;
+	_last_pps_hrt_timestamp = _hrt_timestamp;
+
+	if (_drift_valid) {
+		hrt_utc_set_reference(pps_utc_time, _hrt_timestamp, _drift_ppm);
+	}
+}
+
 int PPSCapture::gpio_interrupt_callback(int irq, void *context, void *arg)
 {
 	PPSCapture *instance = static_cast<PPSCapture *>(arg);
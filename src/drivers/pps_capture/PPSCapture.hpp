@@ -69,6 +69,20 @@ public:
 private:
 	void Run() override;
 
+	/**
+	 * Update the hrt frequency-error estimate from the latest PPS edge and
+	 * refresh the drift-corrected hrt -> UTC mapping in drv_hrt.h.
+	 *
+	 * @param pps_utc_time UTC time of the captured edge [us]
+	 */
+	void update_clock_discipline(uint64_t pps_utc_time);
+
+	/** smoothing gain for the per-edge frequency-error samples */
+	static constexpr float DRIFT_FILTER_GAIN = 0.1f;
+
+	/** oscillator error beyond this is a measurement fault, not drift [ppm] */
+	static constexpr float MAX_DRIFT_PPM = 500.f;
+
 	int _channel{-1};
 	uint32_t _pps_capture_gpio{0};
 	uORB::Publication<pps_capture_s>	_pps_capture_pub{ORB_ID(pps_capture)};
@@ -79,6 +93,12 @@ private:
 
 	hrt_abstime	_last_gps_timestamp{0};
 	uint64_t		_last_gps_utc_timestamp{0};
+
+	hrt_abstime	_last_pps_hrt_timestamp{0};
+	uint64_t		_last_pps_utc_timestamp{0};
+	float				_drift_ppm{0.f};
+	bool				_drift_valid{false};
+
 	uint8_t			_pps_rate_exceeded_counter{0};
 	px4::atomic<bool>			_pps_rate_failure{false};
 };
@@ -135,11 +135,10 @@ bool PWMOut::updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
 				// do not run any signal on disabled channels
 				outputs[i] = 0;
 			}
-
-			if (_pwm_mask & (1 << i)) {
-				up_pwm_servo_set(i, outputs[i]);
-			}
 		}
+
+		// whole-bank update in a single call into the platform layer
+		up_pwm_servo_set_multi(_pwm_mask, outputs);
 	}
 
 	/* Trigger all timer's channels in Oneshot mode to fire
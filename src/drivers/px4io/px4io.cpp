@@ -46,6 +46,7 @@
 #include <px4_platform_common/sem.hpp>
 
 #include <crc32.h>
+#include <string.h>
 
 #include <drivers/device/device.h>
 #include <drivers/drv_hrt.h>
@@ -195,6 +196,12 @@ private:
 	uint16_t		_setup_arming{0};	///< last arming setup state
 	uint16_t		_last_written_arming_s{0};	///< the last written arming state reg
 	uint16_t		_last_written_arming_c{0};	///< the last written arming state reg
+	bool			_setup_arming_dirty{true};	///< re-read PX4IO_P_SETUP_ARMING on the next status poll
+
+	uint16_t		_last_disarmed_pwm[PX4IO_MAX_ACTUATORS] {};	///< disarmed values last synced to IO
+	uint16_t		_last_failsafe_pwm[PX4IO_MAX_ACTUATORS] {};	///< failsafe values last synced to IO
+	bool			_disarmed_pwm_synced{false};
+	bool			_failsafe_pwm_synced{false};
 
 	uORB::Subscription	_t_actuator_armed{ORB_ID(actuator_armed)};		///< system armed control topic
 	uORB::Subscription	_t_vehicle_command{ORB_ID(vehicle_command)};	///< vehicle command topic
@@ -490,7 +497,15 @@ void PX4IO::updateDisarmed()
 		values[i] = _mixing_output.disarmedValue(i);
 	}
 
-	io_reg_set(PX4IO_PAGE_DISARMED_PWM, 0, values, _max_actuators);
+	// delta sync: skip the transfer if IO already has these values
+	if (_disarmed_pwm_synced && memcmp(values, _last_disarmed_pwm, sizeof(values)) == 0) {
+		return;
+	}
+
+	if (io_reg_set(PX4IO_PAGE_DISARMED_PWM, 0, values, _max_actuators) == OK) {
+		memcpy(_last_disarmed_pwm, values, sizeof(values));
+		_disarmed_pwm_synced = true;
+	}
 }
 
 void PX4IO::updateFailsafe()
@@ -501,7 +516,15 @@ void PX4IO::updateFailsafe()
 		values[i] = _mixing_output.actualFailsafeValue(i);
 	}
 
-	io_reg_set(PX4IO_PAGE_FAILSAFE_PWM, 0, values, _max_actuators);
+	// delta sync: skip the transfer if IO already has these values
+	if (_failsafe_pwm_synced && memcmp(values, _last_failsafe_pwm, sizeof(values)) == 0) {
+		return;
+	}
+
+	if (io_reg_set(PX4IO_PAGE_FAILSAFE_PWM, 0, values, _max_actuators) == OK) {
+		memcpy(_last_failsafe_pwm, values, sizeof(values));
+		_failsafe_pwm_synced = true;
+	}
 }
 
 void PX4IO::Run()
@@ -818,6 +841,7 @@ PX4IO::io_set_arming_state()
 	if (_last_written_arming_s != set || _last_written_arming_c != clear) {
 		_last_written_arming_s = set;
 		_last_written_arming_c = clear;
+		_setup_arming_dirty = true;
 		return io_reg_modify(PX4IO_PAGE_SETUP, PX4IO_P_SETUP_ARMING, clear, set);
 	}
 
@@ -947,7 +971,18 @@ int PX4IO::io_get_status()
 		_analog_rc_rssi_stable = true;
 	}
 
-	const uint16_t SETUP_ARMING = io_reg_get(PX4IO_PAGE_SETUP, PX4IO_P_SETUP_ARMING);
+	// Only re-read the arming setup register when we changed it or for the periodic
+	// publication refresh: the FMU is the only writer of this register.
+	uint16_t SETUP_ARMING = _setup_arming;
+
+	if (_setup_arming_dirty || hrt_elapsed_time(&_last_status_publish) >= 1_s) {
+		const uint32_t reg = io_reg_get(PX4IO_PAGE_SETUP, PX4IO_P_SETUP_ARMING);
+
+		if (reg != _io_reg_get_error) {
+			SETUP_ARMING = reg;
+			_setup_arming_dirty = false;
+		}
+	}
 
 	if ((hrt_elapsed_time(&_last_status_publish) >= 1_s)
 	    || (_status != STATUS_FLAGS)
@@ -991,25 +1026,55 @@ int PX4IO::io_get_status()
 		status.arming_force_failsafe       = SETUP_ARMING & PX4IO_P_SETUP_ARMING_FORCE_FAILSAFE;
 		status.arming_termination_failsafe = SETUP_ARMING & PX4IO_P_SETUP_ARMING_TERMINATION_FAILSAFE;
 
-		for (unsigned i = 0; i < _max_actuators; i++) {
-			status.pwm[i] = io_reg_get(PX4IO_PAGE_SERVOS, i);
-			status.pwm_disarmed[i] = io_reg_get(PX4IO_PAGE_DISARMED_PWM, i);
-			status.pwm_failsafe[i] = io_reg_get(PX4IO_PAGE_FAILSAFE_PWM, i);
+		// coalesce the page reads into one transfer each instead of one per register
+		uint16_t pwm_regs[PX4IO_MAX_ACTUATORS] {};
+
+		if (io_reg_get(PX4IO_PAGE_SERVOS, 0, pwm_regs, _max_actuators) == OK) {
+			for (unsigned i = 0; i < _max_actuators; i++) {
+				status.pwm[i] = pwm_regs[i];
+			}
+		}
+
+		if (io_reg_get(PX4IO_PAGE_DISARMED_PWM, 0, pwm_regs, _max_actuators) == OK) {
+			for (unsigned i = 0; i < _max_actuators; i++) {
+				status.pwm_disarmed[i] = pwm_regs[i];
+			}
+		}
+
+		if (io_reg_get(PX4IO_PAGE_FAILSAFE_PWM, 0, pwm_regs, _max_actuators) == OK) {
+			for (unsigned i = 0; i < _max_actuators; i++) {
+				status.pwm_failsafe[i] = pwm_regs[i];
+			}
 		}
 
 		{
-			int i = 0;
+			// This is a bit different than below, reading the groups, not the channels
+			uint16_t rate_regs[PX4IO_P_SETUP_PWM_RATE_GROUP3 - PX4IO_P_SETUP_PWM_RATE_GROUP0 + 1] {};
 
-			for (uint8_t offset = PX4IO_P_SETUP_PWM_RATE_GROUP0; offset <= PX4IO_P_SETUP_PWM_RATE_GROUP3; ++offset) {
-				// This is a bit different than below, setting the groups, not the channels
-				status.pwm_rate_hz[i++] = io_reg_get(PX4IO_PAGE_SETUP, offset);
+			if (io_reg_get(PX4IO_PAGE_SETUP, PX4IO_P_SETUP_PWM_RATE_GROUP0, rate_regs,
+				       sizeof(rate_regs) / sizeof(rate_regs[0])) == OK) {
+				for (unsigned i = 0; i < sizeof(rate_regs) / sizeof(rate_regs[0]); i++) {
+					status.pwm_rate_hz[i] = rate_regs[i];
+				}
 			}
 		}
 
 		uint16_t raw_inputs = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_COUNT);
 
-		for (unsigned i = 0; (i < raw_inputs) && (i < _max_rc_input); i++) {
-			status.raw_inputs[i] = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_BASE + i);
+		if (raw_inputs > _max_rc_input) {
+			raw_inputs = _max_rc_input;
+		}
+
+		uint16_t raw_input_regs[sizeof(status.raw_inputs) / sizeof(status.raw_inputs[0])] {};
+
+		if (raw_inputs > sizeof(raw_input_regs) / sizeof(raw_input_regs[0])) {
+			raw_inputs = sizeof(raw_input_regs) / sizeof(raw_input_regs[0]);
+		}
+
+		if ((raw_inputs > 0) && (io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_BASE, raw_input_regs, raw_inputs) == OK)) {
+			for (unsigned i = 0; i < raw_inputs; i++) {
+				status.raw_inputs[i] = raw_input_regs[i];
+			}
 		}
 
 		status.timestamp = hrt_absolute_time();
@@ -511,8 +511,58 @@ void RCInput::Run()
 							   false, false, frame_drops, dsm_rssi);
 						_rc_scan_locked = true;
 					}
+
+					// DSM, ST24 and SUMD share the same port configuration: while
+					// autodetecting, classify the same bytes against the other two
+					// protocols in this pass instead of giving each its own scan window
+					if (!rc_updated && !_rc_scan_locked && (_param_rc_input_proto.get() < 0)) {
+						uint8_t st24_rssi = input_rc_s::RSSI_MAX;
+						uint8_t lost_count = 0;
+						bool st24_updated = false;
+
+						for (unsigned i = 0; i < (unsigned)newBytes; i++) {
+							st24_updated = (OK == st24_decode(_rcs_buf[i], &st24_rssi, &lost_count,
+											  &_raw_rc_count, _raw_rc_values, input_rc_s::RC_INPUT_MAX_CHANNELS));
+						}
+
+						if (st24_updated && (lost_count == 0)) {
+							// structural match: lock onto ST24 directly
+							_rc_in.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_ST24;
+							fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
+								   false, false, frame_drops, st24_rssi);
+							_rc_scan_state = RC_SCAN_ST24;
+							_rc_scan_locked = true;
+							rc_updated = true;
+						}
+					}
+
+					if (!rc_updated && !_rc_scan_locked && (_param_rc_input_proto.get() < 0)) {
+						uint8_t sumd_rssi = input_rc_s::RSSI_MAX;
+						uint8_t rx_count = 0;
+						bool sumd_failsafe = false;
+						bool sumd_updated = false;
+
+						for (unsigned i = 0; i < (unsigned)newBytes; i++) {
+							sumd_updated = (OK == sumd_decode(_rcs_buf[i], &sumd_rssi, &rx_count,
+											  &_raw_rc_count, _raw_rc_values, input_rc_s::RC_INPUT_MAX_CHANNELS, &sumd_failsafe));
+						}
+
+						if (sumd_updated) {
+							// structural match: lock onto SUMD directly
+							_rc_in.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_SUMD;
+							fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
+								   false, sumd_failsafe, frame_drops, sumd_rssi);
+							_rc_scan_state = RC_SCAN_SUMD;
+							_rc_scan_locked = true;
+							rc_updated = true;
+						}
+					}
 				}
 
+			} else if (_param_rc_input_proto.get() < 0) {
+				// ST24 and SUMD were already covered in this window, scan PPM next
+				set_rc_scan_state(RC_SCAN_PPM);
+
 			} else {
 				// Scan the next protocol
 				set_rc_scan_state(RC_SCAN_ST24);
@@ -688,8 +738,37 @@ void RCInput::Run()
 							_crsf_telemetry->update(cycle_timestamp);
 						}
 					}
+
+					// CRSF and GHST share the same port configuration: check the
+					// same bytes for GHST frames while autodetecting
+					if (!rc_updated && !_rc_scan_locked && (_param_rc_input_proto.get() < 0)) {
+						int8_t ghst_rssi = -1;
+
+						if (ghst_parse(cycle_timestamp, &_rcs_buf[0], newBytes, &_raw_rc_values[0], &ghst_rssi,
+							       &_raw_rc_count, input_rc_s::RC_INPUT_MAX_CHANNELS)) {
+							// structural match: lock onto GHST directly
+							_rc_in.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_GHST;
+							fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp, false, false, 0, ghst_rssi);
+
+#ifdef BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT
+
+							if (!_ghst_telemetry) {
+								_ghst_telemetry = new GHSTTelemetry(_rcs_fd);
+							}
+
+#endif /* BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT */
+
+							_rc_scan_state = RC_SCAN_GHST;
+							_rc_scan_locked = true;
+							rc_updated = true;
+						}
+					}
 				}
 
+			} else if (_param_rc_input_proto.get() < 0) {
+				// GHST was already covered in this window, restart the scan at SBUS
+				set_rc_scan_state(RC_SCAN_SBUS);
+
 			} else {
 				// Scan the next protocol
 				set_rc_scan_state(RC_SCAN_GHST);
@@ -46,6 +46,11 @@ static constexpr uint64_t TRAJECTORY_STREAM_TIMEOUT_US = 500_ms;
 /** If Flighttask fails, keep 0.5 seconds the current setpoint before going into failsafe land */
 static constexpr uint64_t TIME_BEFORE_FAILSAFE = 500_ms;
 static constexpr uint64_t Z_PROGRESS_TIMEOUT_US = 2_s;
+/** Age up to which a trajectory point is injected as-is; older points get extrapolated */
+static constexpr uint64_t POINT_FRESH_AGE_US = 100_ms;
+/** Maximum stream gap bridged by constant-velocity extrapolation of the last point;
+ * beyond this the companion exceeded its latency budget and gets bypassed */
+static constexpr uint64_t EXTRAPOLATION_HORIZON_US = 300_ms;
 
 ObstacleAvoidance::ObstacleAvoidance(ModuleParams *parent) :
 	ModuleParams(parent)
@@ -57,6 +62,11 @@ ObstacleAvoidance::ObstacleAvoidance(ModuleParams *parent) :
 
 }
 
+ObstacleAvoidance::~ObstacleAvoidance()
+{
+	perf_free(_rtt_perf);
+}
+
 void ObstacleAvoidance::injectAvoidanceSetpoints(Vector3f &pos_sp, Vector3f &vel_sp, float &yaw_sp,
 		float &yaw_speed_sp)
 {
@@ -67,6 +77,15 @@ void ObstacleAvoidance::injectAvoidanceSetpoints(Vector3f &pos_sp, Vector3f &vel
 	const auto &wp_msg = _sub_vehicle_trajectory_waypoint.get();
 	const auto &bezier_msg = _sub_vehicle_trajectory_bezier.get();
 
+	// measure the companion round trip: desired waypoint sent -> next trajectory response
+	if (wp_msg.timestamp != _last_response_timestamp) {
+		if (_last_response_timestamp != 0 && _desired_wp_sent_time != 0 && wp_msg.timestamp > _desired_wp_sent_time) {
+			perf_set_elapsed(_rtt_perf, wp_msg.timestamp - _desired_wp_sent_time);
+		}
+
+		_last_response_timestamp = wp_msg.timestamp;
+	}
+
 	const bool avoidance_data_timeout =
 		hrt_elapsed_time((hrt_abstime *)&wp_msg.timestamp) > TRAJECTORY_STREAM_TIMEOUT_US &&
 		hrt_elapsed_time((hrt_abstime *)&bezier_msg.timestamp) > hrt_abstime(bezier_msg.control_points[bezier_msg.bezier_order -
@@ -87,6 +106,7 @@ void ObstacleAvoidance::injectAvoidanceSetpoints(Vector3f &pos_sp, Vector3f &vel
 
 	if (avoidance_invalid) {
 		PX4_WARN("Obstacle Avoidance system failed, loitering");
+		_companion_bypass_active = false;
 		_publishVehicleCmdDoLoiter();
 
 		if (!PX4_ISFINITE(_failsafe_position(0)) || !PX4_ISFINITE(_failsafe_position(1))
@@ -107,13 +127,46 @@ void ObstacleAvoidance::injectAvoidanceSetpoints(Vector3f &pos_sp, Vector3f &vel
 
 	if (avoidance_point_valid) {
 		const auto &point0 = wp_msg.waypoints[vehicle_trajectory_waypoint_s::POINT_0];
+		const hrt_abstime point_age = hrt_elapsed_time((hrt_abstime *)&wp_msg.timestamp);
+
+		if (point_age >= EXTRAPOLATION_HORIZON_US) {
+			// the companion exceeded its latency budget: keep the setpoints computed
+			// locally by the FlightTask until the stream recovers or times out
+			if (!_companion_bypass_active) {
+				PX4_WARN("Obstacle Avoidance stream stale, flying on local setpoints");
+				_companion_bypass_active = true;
+			}
+
+			return;
+		}
+
+		_companion_bypass_active = false;
+
 		pos_sp = Vector3f(point0.position);
 		vel_sp = Vector3f(point0.velocity);
+		float yaw = point0.yaw;
+		float yaw_speed = point0.yaw_speed;
+
+		if (point_age > POINT_FRESH_AGE_US) {
+			// short stream gap: predict with constant velocity instead of freezing
+			// on the stale point, which visibly perturbs the position loop
+			const float dt = (float)point_age * 1e-6f;
+
+			for (int i = 0; i < 3; i++) {
+				if (PX4_ISFINITE(pos_sp(i)) && PX4_ISFINITE(vel_sp(i))) {
+					pos_sp(i) += vel_sp(i) * dt;
+				}
+			}
+
+			if (PX4_ISFINITE(yaw) && PX4_ISFINITE(yaw_speed)) {
+				yaw = matrix::wrap_pi(yaw + yaw_speed * dt);
+			}
+		}
 
 		if (!_ext_yaw_active) {
 			// inject yaw setpoints only if weathervane isn't active
-			yaw_sp =  point0.yaw;
-			yaw_speed_sp = point0.yaw_speed;
+			yaw_sp = yaw;
+			yaw_speed_sp = yaw_speed;
 		}
 
 	} else if (avoidance_bezier_valid) {
@@ -198,6 +251,7 @@ void ObstacleAvoidance::updateAvoidanceDesiredSetpoints(const Vector3f &pos_sp,
 	_desired_waypoint.waypoints[vehicle_trajectory_waypoint_s::POINT_0].point_valid = true;
 
 	_pub_traj_wp_avoidance_desired.publish(_desired_waypoint);
+	_desired_wp_sent_time = hrt_absolute_time();
 
 	_desired_waypoint = empty_trajectory_waypoint;
 }
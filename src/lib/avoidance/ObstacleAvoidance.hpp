@@ -56,6 +56,7 @@
 #include <uORB/topics/position_setpoint.h>
 
 #include <lib/hysteresis/hysteresis.h>
+#include <lib/perf/perf_counter.h>
 
 #include <matrix/matrix/math.hpp>
 
@@ -72,7 +73,7 @@ class ObstacleAvoidance : public ModuleParams
 {
 public:
 	ObstacleAvoidance(ModuleParams *parent);
-	~ObstacleAvoidance() = default;
+	~ObstacleAvoidance();
 
 	/**
 	 * Inject setpoints from obstacle avoidance system into FlightTasks.
@@ -137,6 +138,12 @@ protected:
 
 	bool _ext_yaw_active = false; /**< true, if external yaw handling is active */
 
+	hrt_abstime _desired_wp_sent_time{0}; /**< when the last desired waypoint was sent to the companion */
+	hrt_abstime _last_response_timestamp{0}; /**< timestamp of the newest trajectory response seen */
+	bool _companion_bypass_active{false}; /**< true while stale companion setpoints are bypassed */
+
+	perf_counter_t _rtt_perf{perf_alloc(PC_ELAPSED, "avoidance: companion round trip")}; /**< measured companion round trip time */
+
 	/**
 	 * Publishes vehicle command.
 	 */
@@ -37,6 +37,7 @@
 
 
 using namespace matrix;
+using namespace time_literals;
 // to run: make tests TESTFILTER=ObstacleAvoidance
 
 class ObstacleAvoidanceTest : public ::testing::Test
@@ -241,3 +242,75 @@ TEST_F(ObstacleAvoidanceTest, oa_desired)
 	EXPECT_TRUE(_sub_traj_wp_avoidance_desired.get().waypoints[vehicle_trajectory_waypoint_s::POINT_2].point_valid);
 
 }
+
+TEST_F(ObstacleAvoidanceTest, oa_stale_point_extrapolated)
+{
+	// GIVEN: the flight controller setpoints from FlightTaskAuto and a slightly stale
+	// vehicle_trajectory_waypoint message with a valid velocity
+	TestObstacleAvoidance oa;
+
+	vehicle_trajectory_waypoint_s message = empty_trajectory_waypoint;
+	message.timestamp = hrt_absolute_time() - 150_ms;
+	message.type = vehicle_trajectory_waypoint_s::MAV_TRAJECTORY_REPRESENTATION_WAYPOINTS;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].position[0] = 2.6f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].position[1] = 2.4f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].position[2] = 2.7f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].velocity[0] = 1.f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].velocity[1] = -2.f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].velocity[2] = 0.f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].point_valid = true;
+
+	// GIVEN: and we publish the vehicle_trajectory_waypoint message and vehicle status message
+	uORB::Publication<vehicle_trajectory_waypoint_s> vehicle_trajectory_waypoint_pub{ORB_ID(vehicle_trajectory_waypoint)};
+	vehicle_trajectory_waypoint_pub.publish(message);
+
+	vehicle_status_s vehicle_status{};
+	vehicle_status.nav_state = vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION;
+	uORB::Publication<vehicle_status_s> vehicle_status_pub{ORB_ID(vehicle_status)};
+	vehicle_status_pub.publish(vehicle_status);
+
+	// WHEN: we inject the vehicle_trajectory_waypoint in the interface
+	oa.injectAvoidanceSetpoints(pos_sp, vel_sp, yaw_sp, yaw_speed_sp);
+
+	// THEN: the position setpoint should be extrapolated along the velocity over the
+	// message age instead of frozen on the stale point (tolerance for the test runtime)
+	EXPECT_NEAR(2.6f + 1.f * 0.15f, pos_sp(0), 0.05f);
+	EXPECT_NEAR(2.4f - 2.f * 0.15f, pos_sp(1), 0.1f);
+	EXPECT_FLOAT_EQ(2.7f, pos_sp(2));
+	EXPECT_FLOAT_EQ(1.f, vel_sp(0));
+	EXPECT_FLOAT_EQ(-2.f, vel_sp(1));
+}
+
+TEST_F(ObstacleAvoidanceTest, oa_latency_budget_exceeded_bypassed)
+{
+	// GIVEN: the flight controller setpoints from FlightTaskAuto and a trajectory point
+	// older than the extrapolation horizon but younger than the stream timeout
+	TestObstacleAvoidance oa;
+
+	vehicle_trajectory_waypoint_s message = empty_trajectory_waypoint;
+	message.timestamp = hrt_absolute_time() - 350_ms;
+	message.type = vehicle_trajectory_waypoint_s::MAV_TRAJECTORY_REPRESENTATION_WAYPOINTS;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].position[0] = 2.6f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].position[1] = 2.4f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].position[2] = 2.7f;
+	message.waypoints[vehicle_trajectory_waypoint_s::POINT_0].point_valid = true;
+
+	// GIVEN: and we publish the vehicle_trajectory_waypoint message and vehicle status message
+	uORB::Publication<vehicle_trajectory_waypoint_s> vehicle_trajectory_waypoint_pub{ORB_ID(vehicle_trajectory_waypoint)};
+	vehicle_trajectory_waypoint_pub.publish(message);
+
+	vehicle_status_s vehicle_status{};
+	vehicle_status.nav_state = vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION;
+	uORB::Publication<vehicle_status_s> vehicle_status_pub{ORB_ID(vehicle_status)};
+	vehicle_status_pub.publish(vehicle_status);
+
+	// WHEN: we inject the vehicle_trajectory_waypoint in the interface
+	oa.injectAvoidanceSetpoints(pos_sp, vel_sp, yaw_sp, yaw_speed_sp);
+
+	// THEN: the stale companion setpoints should be bypassed, keeping the FlightTask setpoints
+	EXPECT_FLOAT_EQ(1.f, pos_sp(0));
+	EXPECT_FLOAT_EQ(1.2f, pos_sp(1));
+	EXPECT_FLOAT_EQ(0.1f, pos_sp(2));
+	EXPECT_FLOAT_EQ(0.3f, vel_sp(0));
+	EXPECT_FLOAT_EQ(0.123f, yaw_sp);
+}
@@ -47,16 +47,20 @@
 
 using namespace time_literals;
 
+// The voltage based state of charge model moves on a seconds timescale, no need to
+// re-evaluate it at the full sample rate.
+static constexpr hrt_abstime SOC_ESTIMATE_INTERVAL_US = 1_s;
+
 Battery::Battery(int index, ModuleParams *parent, const int sample_interval_us, const uint8_t source) :
 	ModuleParams(parent),
 	_index(index < 1 || index > 9 ? 1 : index),
 	_source(source)
 {
-	const float expected_filter_dt = static_cast<float>(sample_interval_us) / 1_s;
-	_voltage_filter_v.setParameters(expected_filter_dt, 1.f);
-	_current_filter_a.setParameters(expected_filter_dt, .5f);
-	_current_average_filter_a.setParameters(expected_filter_dt, 50.f);
-	_throttle_filter.setParameters(expected_filter_dt, 1.f);
+	_expected_filter_dt = static_cast<float>(sample_interval_us) / 1_s;
+	_voltage_filter_v.setParameters(_expected_filter_dt, 1.f);
+	_current_filter_a.setParameters(_expected_filter_dt, .5f);
+	_current_average_filter_a.setParameters(_expected_filter_dt, 50.f);
+	_throttle_filter.setParameters(_expected_filter_dt, 1.f);
 
 	if (index > 9 || index < 1) {
 		PX4_ERR("Battery index must be between 1 and 9 (inclusive). Received %d. Defaulting to 1.", index);
@@ -119,8 +123,25 @@ void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 	}
 
 	sumDischarged(timestamp, _current_a);
-	estimateStateOfCharge(_voltage_filter_v.getState(), _current_filter_a.getState());
-	computeScale();
+
+	// fast path: apply the capacity slope at the full sample rate so that the published
+	// state of charge stays smooth between model updates
+	if (_params.capacity > 0.f && _battery_initialized) {
+		_state_of_charge = math::max(_state_of_charge - _discharged_mah_loop * _inv_capacity, 0.f);
+	}
+
+	// slow path: voltage based state of charge model and remaining time estimation
+	if (!_battery_initialized || (_last_soc_estimate == 0)
+	    || (timestamp >= _last_soc_estimate + SOC_ESTIMATE_INTERVAL_US)) {
+
+		const float dt = (_last_soc_estimate != 0) ? (timestamp - _last_soc_estimate) / 1e6f : _expected_filter_dt;
+
+		estimateStateOfCharge(_voltage_filter_v.getState(), _current_filter_a.getState(), dt);
+		computeScale();
+		_time_remaining_s = computeRemainingTime(_current_a, dt);
+
+		_last_soc_estimate = timestamp;
+	}
 
 	if (_connected && _battery_initialized) {
 		_warning = determineWarning(_state_of_charge);
@@ -145,7 +166,7 @@ battery_status_s Battery::getBatteryStatus()
 	battery_status.discharged_mah = _discharged_mah;
 	battery_status.remaining = _state_of_charge;
 	battery_status.scale = _scale;
-	battery_status.time_remaining_s = computeRemainingTime(_current_a);
+	battery_status.time_remaining_s = _time_remaining_s;
 	battery_status.temperature = NAN;
 	battery_status.cell_count = _params.n_cells;
 	battery_status.connected = _connected;
@@ -192,10 +213,10 @@ void Battery::sumDischarged(const hrt_abstime &timestamp, float current_a)
 	_last_timestamp = timestamp;
 }
 
-void Battery::estimateStateOfCharge(const float voltage_v, const float current_a)
+void Battery::estimateStateOfCharge(const float voltage_v, const float current_a, const float dt)
 {
 	// remaining battery capacity based on voltage
-	float cell_voltage = voltage_v / _params.n_cells;
+	float cell_voltage = voltage_v * _inv_cell_count;
 
 	// correct battery voltage locally for load drop to avoid estimation fluctuations
 	if (_params.r_internal >= 0.f && current_a > FLT_EPSILON) {
@@ -205,6 +226,9 @@ void Battery::estimateStateOfCharge(const float voltage_v, const float current_a
 		actuator_controls_s actuator_controls{};
 		_actuator_controls_0_sub.copy(&actuator_controls);
 		const float throttle = actuator_controls.control[actuator_controls_s::INDEX_THROTTLE];
+
+		// keep the filter time constant independent of the update rate
+		_throttle_filter.setParameters(dt, 1.f);
 		_throttle_filter.update(throttle);
 
 		if (!_battery_initialized) {
@@ -221,13 +245,13 @@ void Battery::estimateStateOfCharge(const float voltage_v, const float current_a
 	if (_params.capacity > 0.f && _battery_initialized) {
 		// if battery capacity is known, fuse voltage measurement with used capacity
 		// The lower the voltage the more adjust the estimate with it to avoid deep discharge
-		const float weight_v = 3e-4f * (1 - _state_of_charge_volt_based);
+		// The weight is scaled with the elapsed time to keep the fusion rate independent of the update rate
+		const float weight_v = math::min(3e-4f * (1 - _state_of_charge_volt_based) * (dt / _expected_filter_dt), 1.f);
 		_state_of_charge = (1 - weight_v) * _state_of_charge + weight_v * _state_of_charge_volt_based;
-		// directly apply current capacity slope calculated using current
-		_state_of_charge -= _discharged_mah_loop / _params.capacity;
+		// the current capacity slope is already applied at full rate in updateBatteryStatus()
 		_state_of_charge = math::max(_state_of_charge, 0.f);
 
-		const float state_of_charge_current_based = math::max(1.f - _discharged_mah / _params.capacity, 0.f);
+		const float state_of_charge_current_based = math::max(1.f - _discharged_mah * _inv_capacity, 0.f);
 		_state_of_charge = math::min(state_of_charge_current_based, _state_of_charge);
 
 	} else {
@@ -268,7 +292,7 @@ void Battery::computeScale()
 	}
 }
 
-float Battery::computeRemainingTime(float current_a)
+float Battery::computeRemainingTime(float current_a, const float dt)
 {
 	float time_remaining_s = NAN;
 
@@ -285,7 +309,9 @@ float Battery::computeRemainingTime(float current_a)
 	}
 
 	if (_armed && PX4_ISFINITE(current_a)) {
-		// only update with positive numbers
+		// only update with positive numbers,
+		// keep the averaging time constant independent of the update rate
+		_current_average_filter_a.setParameters(dt, 50.f);
 		_current_average_filter_a.update(fmaxf(current_a, 0.f));
 	}
 
@@ -313,6 +339,10 @@ void Battery::updateParams()
 	param_get(_param_handles.emergen_thr, &_params.emergen_thr);
 	param_get(_param_handles.bat_avrg_current, &_params.bat_avrg_current);
 
+	// constants derived from the parameters once, so that the sample rate path avoids the divisions
+	_inv_cell_count = (_params.n_cells > 0) ? 1.f / _params.n_cells : 0.f;
+	_inv_capacity = (_params.capacity > 0.f) ? 1.f / _params.capacity : 0.f;
+
 	ModuleParams::updateParams();
 
 	_first_parameter_update = false;
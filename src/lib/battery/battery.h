@@ -144,10 +144,10 @@ protected:
 
 private:
 	void sumDischarged(const hrt_abstime &timestamp, float current_a);
-	void estimateStateOfCharge(const float voltage_v, const float current_a);
+	void estimateStateOfCharge(const float voltage_v, const float current_a, const float dt);
 	uint8_t determineWarning(float state_of_charge);
 	void computeScale();
-	float computeRemainingTime(float current_a);
+	float computeRemainingTime(float current_a, const float dt);
 
 	uORB::Subscription _actuator_controls_0_sub{ORB_ID(actuator_controls_0)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
@@ -168,7 +168,12 @@ private:
 	float _state_of_charge_volt_based{-1.f}; // [0,1]
 	float _state_of_charge{-1.f}; // [0,1]
 	float _scale{1.f};
+	float _time_remaining_s{NAN};
 	uint8_t _warning{battery_status_s::BATTERY_WARNING_NONE};
 	hrt_abstime _last_timestamp{0};
+	hrt_abstime _last_soc_estimate{0};
+	float _expected_filter_dt{1.f};
+	float _inv_cell_count{0.f}; ///< derived from the parameters, updated in updateParams()
+	float _inv_capacity{0.f};   ///< derived from the parameters, updated in updateParams()
 	bool _armed{false};
 };
@@ -59,6 +59,7 @@ void BezierQuad<Tp>::setBezier(const Vector3_t &pt0, const Vector3_t &ctrl, cons
 	_pt1 = pt1;
 	_duration = duration;
 	_cached_resolution = (Tp)(-1);
+	_coefs_valid = false;
 }
 
 template<typename Tp>
@@ -69,24 +70,51 @@ void BezierQuad<Tp>::getBezier(Vector3_t &pt0, Vector3_t &ctrl, Vector3_t &pt1)
 	pt1 = _pt1;
 }
 
+template<typename Tp>
+void BezierQuad<Tp>::_updateCoefs()
+{
+	// convert the bernstein basis to monomial form:
+	// point(t) = _pt0 + _coef1 * s + _coef2 * s^2 with s = t / duration
+	_coef1 = (_ctrl - _pt0) * (Tp)2;
+	_coef2 = _pt0 - _ctrl * (Tp)2 + _pt1;
+
+	// derivative coefficients with respect to t
+	_vel_coef0 = _coef1 / _duration;
+	_vel_coef1 = _coef2 * (Tp)2 / (_duration * _duration);
+
+	_coefs_valid = true;
+}
+
 template<typename Tp>
 matrix::Vector<Tp, 3> BezierQuad<Tp>::getPoint(const Tp t)
 {
-	return (_pt0 * ((Tp)1 - t / _duration) * ((Tp)1 - t / _duration) + _ctrl * (Tp)2 * ((
-				Tp)1 - t / _duration) * t / _duration +   _pt1 *
-		t / _duration * t / _duration);
+	if (!_coefs_valid) {
+		_updateCoefs();
+	}
+
+	// horner evaluation of the monomial form
+	Tp s = t / _duration;
+	return (_pt0 + (_coef1 + _coef2 * s) * s);
 }
 
 template<typename Tp>
 matrix::Vector<Tp, 3> BezierQuad<Tp>::getVelocity(const Tp t)
 {
-	return (((_ctrl - _pt0) * _duration + (_pt0 - _ctrl * (Tp)2 + _pt1) * t) * (Tp)2 / (_duration * _duration));
+	if (!_coefs_valid) {
+		_updateCoefs();
+	}
+
+	return (_vel_coef0 + _vel_coef1 * t);
 }
 
 template<typename Tp>
 matrix::Vector<Tp, 3> BezierQuad<Tp>::getAcceleration()
 {
-	return ((_pt0 - _ctrl * (Tp)2 + _pt1) * (Tp)2 / (_duration * _duration));
+	if (!_coefs_valid) {
+		_updateCoefs();
+	}
+
+	return _vel_coef1;
 }
 
 template<typename Tp>
@@ -119,6 +147,29 @@ void BezierQuad<Tp>::setBezFromVel(const Vector3_t &ctrl, const Vector3_t &vel0,
 	_pt0 = _ctrl - vel0 * _duration / (Tp)2;
 	_pt1 = _ctrl + vel1 * _duration / (Tp)2;
 	_cached_resolution = (Tp)(-1);
+	_coefs_valid = false;
+}
+
+template<typename Tp>
+void BezierQuad<Tp>::sampleStates(Vector3_t points[], Vector3_t vels[], Vector3_t accs[], const int n)
+{
+	if (n < 2) {
+		return;
+	}
+
+	if (!_coefs_valid) {
+		_updateCoefs();
+	}
+
+	Tp dt = _duration / (Tp)(n - 1);
+
+	for (int i = 0; i < n; i++) {
+		Tp t = dt * (Tp)i;
+		Tp s = t / _duration;
+		points[i] = _pt0 + (_coef1 + _coef2 * s) * s;
+		vels[i] = _vel_coef0 + _vel_coef1 * t;
+		accs[i] = _vel_coef1;
+	}
 }
 
 template<typename Tp>
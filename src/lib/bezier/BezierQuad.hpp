@@ -109,7 +109,7 @@ public:
 	 *
 	 * @param time is the total time it takes to travel along the bezier spline.
 	 */
-	void setDuration(const Tp time) {_duration = time;}
+	void setDuration(const Tp time) {_duration = time; _coefs_valid = false;}
 
 	/**
 	 * Return point on bezier point corresponding to time t
@@ -175,6 +175,20 @@ public:
 	 */
 	Tp getArcLength(const Tp resolution);
 
+	/*
+	 * Sample n states spaced evenly in time along the entire spline
+	 *
+	 * All samples share the compiled monomial coefficients, which makes this
+	 * the cheapest way to extract a whole trajectory: each state costs a
+	 * handful of multiply-adds. The first and last samples fall on pt0 and pt1.
+	 *
+	 * @param points array of at least n sampled positions
+	 * @param vels array of at least n sampled velocities
+	 * @param accs array of at least n sampled accelerations
+	 * @param n number of samples, has to be at least 2
+	 */
+	void sampleStates(Vector3_t points[], Vector3_t vels[], Vector3_t accs[], const int n);
+
 private:
 
 	Vector3_t _pt0; /**< Bezier starting point */
@@ -186,6 +200,18 @@ private:
 	Tp _cached_resolution = (Tp)(-1); /**< The resolution used to compute the arc length.
 									Negative number means that cache is not up to date. */
 
+	Vector3_t _coef1; /**< Compiled monomial coefficient of t/duration */
+	Vector3_t _coef2; /**< Compiled monomial coefficient of (t/duration)^2 */
+	Vector3_t _vel_coef0; /**< Velocity at the start of the spline */
+	Vector3_t _vel_coef1; /**< Velocity slope (= the constant acceleration) */
+	bool _coefs_valid = false; /**< False whenever the bezier points or the duration changed */
+
+	/*
+	 * Convert the bezier points to monomial (Horner) form and cache the
+	 * derivative coefficients
+	 */
+	void _updateCoefs();
+
 	/*
 	 * Golden section search
 	 */
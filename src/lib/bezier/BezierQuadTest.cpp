@@ -0,0 +1,152 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the compiled-coefficient evaluation of the quadratic bezier
+ * Run this test only using make tests TESTFILTER=BezierQuad
+ */
+
+#include <gtest/gtest.h>
+#include <matrix/matrix/math.hpp>
+
+#include "BezierQuad.hpp"
+
+using Vector3_t = matrix::Vector<float, 3>;
+
+// direct bernstein evaluation used as reference for the compiled monomial form
+static Vector3_t bernstein(const Vector3_t &pt0, const Vector3_t &ctrl,
+			   const Vector3_t &pt1, float duration, float t)
+{
+	float s = t / duration;
+	return pt0 * (1.f - s) * (1.f - s) + ctrl * 2.f * (1.f - s) * s + pt1 * s * s;
+}
+
+static float normDiff(const Vector3_t &a, const Vector3_t &b)
+{
+	return Vector3_t(a - b).norm();
+}
+
+TEST(BezierQuad_getPoint, matches_bernstein_form)
+{
+	// GIVEN: a bezier with distinct points and a non-unit duration
+	matrix::Vector3f pt0(1, 2, 3);
+	matrix::Vector3f ctrl(5, 0, 1);
+	matrix::Vector3f pt1(9, -8, 1);
+	float duration = 2.5f;
+	bezier::BezierQuad_f bz(pt0, ctrl, pt1, duration);
+
+	// WHEN: we evaluate along the spline
+	// THEN: the compiled monomial form should match the bernstein form
+	for (int i = 0; i <= 10; i++) {
+		float t = duration * i / 10.f;
+		EXPECT_NEAR(normDiff(bz.getPoint(t), bernstein(pt0, ctrl, pt1, duration, t)), 0.f, 1e-5f);
+	}
+
+	// AND: the end points should be reproduced
+	EXPECT_NEAR(normDiff(bz.getPoint(0.f), pt0), 0.f, 1e-6f);
+	EXPECT_NEAR(normDiff(bz.getPoint(duration), pt1), 0.f, 1e-5f);
+}
+
+TEST(BezierQuad_getVelocity, consistent_with_position)
+{
+	// GIVEN: a bezier in a curve
+	matrix::Vector3f pt0(1, 2, 3);
+	matrix::Vector3f ctrl(5, 0, 1);
+	matrix::Vector3f pt1(19, -8, 1);
+	float duration = 3.f;
+	bezier::BezierQuad_f bz(pt0, ctrl, pt1, duration);
+
+	// WHEN: we compare the cached derivative against a central difference of the position
+	const float h = 1e-3f;
+
+	for (int i = 1; i < 10; i++) {
+		float t = duration * i / 10.f;
+		Vector3_t vel_numerical((bz.getPoint(t + h) - bz.getPoint(t - h)) / (2.f * h));
+
+		// THEN: they should agree
+		EXPECT_NEAR(normDiff(bz.getVelocity(t), vel_numerical), 0.f, 1e-2f);
+	}
+
+	// AND: the acceleration should be the constant velocity slope
+	Vector3_t acc_numerical(bz.getVelocity(1.f) - bz.getVelocity(0.f));
+	EXPECT_NEAR(normDiff(bz.getAcceleration(), acc_numerical), 0.f, 1e-4f);
+}
+
+TEST(BezierQuad_setBezier, recompiles_coefficients)
+{
+	// GIVEN: a bezier that has already been evaluated (coefficients compiled)
+	bezier::BezierQuad_f bz(matrix::Vector3f(1, 2, 3), matrix::Vector3f(5, 0, 1),
+				matrix::Vector3f(9, -2, -1), 1.f);
+	bz.getPoint(0.5f);
+
+	// WHEN: the points change
+	matrix::Vector3f pt0(0, 0, 0);
+	matrix::Vector3f ctrl(1, 1, 1);
+	matrix::Vector3f pt1(2, 0, 2);
+	bz.setBezier(pt0, ctrl, pt1, 2.f);
+
+	// THEN: evaluation should reflect the new points
+	EXPECT_NEAR(normDiff(bz.getPoint(1.f), bernstein(pt0, ctrl, pt1, 2.f, 1.f)), 0.f, 1e-5f);
+
+	// WHEN: only the duration changes
+	bz.setDuration(4.f);
+
+	// THEN: the start velocity should scale accordingly
+	EXPECT_NEAR(normDiff(bz.getVelocity(0.f), (ctrl - pt0) * 2.f / 4.f), 0.f, 1e-5f);
+}
+
+TEST(BezierQuad_sampleStates, matches_single_state_interface)
+{
+	// GIVEN: a bezier in a curve
+	bezier::BezierQuad_f bz(matrix::Vector3f(1, 2, 3), matrix::Vector3f(5, 0, 1),
+				matrix::Vector3f(19, -8, 1), 2.f);
+
+	// WHEN: we sample a batch of states
+	constexpr int n = 11;
+	Vector3_t points[n], vels[n], accs[n];
+	bz.sampleStates(points, vels, accs, n);
+
+	// THEN: every sample should match the single-state interface
+	for (int i = 0; i < n; i++) {
+		float t = 2.f * i / (n - 1);
+		Vector3_t point, vel, acc;
+		bz.getStates(point, vel, acc, t);
+		EXPECT_NEAR(normDiff(points[i], point), 0.f, 1e-5f);
+		EXPECT_NEAR(normDiff(vels[i], vel), 0.f, 1e-5f);
+		EXPECT_NEAR(normDiff(accs[i], acc), 0.f, 1e-5f);
+	}
+
+	// AND: the first and last samples should fall on the end points
+	EXPECT_NEAR(normDiff(points[0], bz.getPt0()), 0.f, 1e-6f);
+	EXPECT_NEAR(normDiff(points[n - 1], bz.getPt1()), 0.f, 1e-5f);
+}
@@ -285,13 +285,7 @@ CDev::poll(file_t *filep, px4_pollfd_struct_t *fds, bool setup)
 			 * Check to see whether we should send a poll notification
 			 * immediately.
 			 */
-			fds->revents |= fds->events & poll_state(filep);
-
-			/* yes? post the notification */
-			if (fds->revents != 0) {
-				px4_sem_post(fds->sem);
-			}
-
+			poll_notify_one(fds, poll_state(filep));
 		}
 
 		ATOMIC_LEAVE;
@@ -308,6 +302,16 @@ CDev::poll(file_t *filep, px4_pollfd_struct_t *fds, bool setup)
 	return ret;
 }
 
+void
+CDev::poll_refresh(px4_pollfd_struct_t *fds)
+{
+	PX4_DEBUG("CDev::poll_refresh");
+
+	ATOMIC_ENTER;
+	poll_notify_one(fds, poll_state((file_t *)fds->priv));
+	ATOMIC_LEAVE;
+}
+
 void
 CDev::poll_notify(px4_pollevent_t events)
 {
@@ -330,12 +334,13 @@ CDev::poll_notify_one(px4_pollfd_struct_t *fds, px4_pollevent_t events)
 {
 	PX4_DEBUG("CDev::poll_notify_one");
 
-	/* update the reported event set */
-	fds->revents |= fds->events & events;
+	/* update the reported event set; atomic because a waiter staying
+	 * registered across wait calls takes the accumulated events concurrently */
+	const px4_pollevent_t revents = __atomic_or_fetch(&fds->revents, fds->events & events, __ATOMIC_RELAXED);
 
-	PX4_DEBUG(" Events fds=%p %0x %0x %0x", fds, fds->revents, fds->events, events);
+	PX4_DEBUG(" Events fds=%p %0x %0x %0x", fds, revents, fds->events, events);
 
-	if (fds->revents != 0) {
+	if (revents != 0) {
 		px4_sem_post(fds->sem);
 	}
 }
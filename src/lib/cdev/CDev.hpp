@@ -161,6 +161,17 @@ public:
 	 */
 	int	poll(file_t *filep, px4_pollfd_struct_t *fds, bool setup);
 
+	/**
+	 * Re-check an already registered poll waiter against the current device
+	 * state, posting its semaphore if events are pending.
+	 *
+	 * This preserves level-triggered poll semantics for waiters that stay
+	 * registered across wait calls.
+	 *
+	 * @param fds		Poll descriptor registered via poll(..., true).
+	 */
+	void	poll_refresh(px4_pollfd_struct_t *fds);
+
 	/**
 	 * Get the device name.
 	 *
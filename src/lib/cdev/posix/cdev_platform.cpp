@@ -40,6 +40,7 @@
 #include <px4_platform_common/posix.h>
 #include <px4_platform_common/time.h>
 
+#include <pthread.h>
 #include <stdlib.h>
 
 const cdev::px4_file_operations_t cdev::CDev::fops = {};
@@ -111,6 +112,150 @@ static cdev::CDev *getFile(int fd)
 	return dev;
 }
 
+/*
+ * Per-task poll aggregation.
+ *
+ * Each polling thread owns one wait object (a semaphore) and a heap-allocated
+ * shadow copy of its pollfd set. The shadow entries stay registered with the
+ * devices across px4_poll() calls, so re-polling the same fd set - the common
+ * module loop pattern - costs no per-fd setup/teardown and no semaphore
+ * init/destroy. Readiness accumulates in the shadow entries between calls and
+ * is delivered in one batch; only a changed fd set pays the registration scan.
+ */
+struct px4_pollset_t {
+	px4_sem_t sem;
+	px4_pollfd_struct_t *shadow{nullptr};
+	unsigned nfds{0};
+	unsigned capacity{0};
+	bool registered{false};
+	px4_pollset_t *next{nullptr};	// global list, needed to purge closed fds
+};
+
+static pthread_mutex_t pollsetmutex = PTHREAD_MUTEX_INITIALIZER;
+static px4_pollset_t *pollsets = nullptr;
+
+static pthread_key_t pollset_key;
+static pthread_once_t pollset_key_once = PTHREAD_ONCE_INIT;
+
+// unregister all shadow entries from their devices (pollsetmutex must be held)
+static void pollset_teardown(px4_pollset_t *ps)
+{
+	if (!ps->registered) {
+		return;
+	}
+
+	for (unsigned i = 0; i < ps->nfds; ++i) {
+		cdev::CDev *dev = getFile(ps->shadow[i].fd);
+
+		if (dev) {
+			dev->poll(&filemap[ps->shadow[i].fd], &ps->shadow[i], false);
+		}
+	}
+
+	ps->registered = false;
+}
+
+static void pollset_destructor(void *arg)
+{
+	px4_pollset_t *ps = (px4_pollset_t *)arg;
+
+	pthread_mutex_lock(&pollsetmutex);
+
+	for (px4_pollset_t **p = &pollsets; *p; p = &(*p)->next) {
+		if (*p == ps) {
+			*p = ps->next;
+			break;
+		}
+	}
+
+	pollset_teardown(ps);
+	pthread_mutex_unlock(&pollsetmutex);
+
+	px4_sem_destroy(&ps->sem);
+	delete[](ps->shadow);
+	delete ps;
+}
+
+static void pollset_key_create()
+{
+	pthread_key_create(&pollset_key, &pollset_destructor);
+}
+
+static px4_pollset_t *get_pollset()
+{
+	pthread_once(&pollset_key_once, &pollset_key_create);
+
+	px4_pollset_t *ps = (px4_pollset_t *)pthread_getspecific(pollset_key);
+
+	if (ps == nullptr) {
+		ps = new px4_pollset_t();
+
+		if (ps == nullptr) {
+			return nullptr;
+		}
+
+		px4_sem_init(&ps->sem, 0, 0);
+
+		// sem use case is a signal
+		px4_sem_setprotocol(&ps->sem, SEM_PRIO_NONE);
+
+		pthread_setspecific(pollset_key, ps);
+
+		pthread_mutex_lock(&pollsetmutex);
+		ps->next = pollsets;
+		pollsets = ps;
+		pthread_mutex_unlock(&pollsetmutex);
+	}
+
+	return ps;
+}
+
+// detach a closing fd from any task pollset it is still registered with
+static void pollset_purge_fd(int fd)
+{
+	pthread_mutex_lock(&pollsetmutex);
+
+	for (px4_pollset_t *ps = pollsets; ps; ps = ps->next) {
+		if (!ps->registered) {
+			continue;
+		}
+
+		for (unsigned i = 0; i < ps->nfds; ++i) {
+			if (ps->shadow[i].fd == fd) {
+				cdev::CDev *dev = getFile(fd);
+
+				if (dev) {
+					dev->poll(&filemap[fd], &ps->shadow[i], false);
+				}
+
+				ps->shadow[i].fd = -1;	// forces re-registration on the owner's next poll
+			}
+		}
+	}
+
+	pthread_mutex_unlock(&pollsetmutex);
+}
+
+// batch-deliver the readiness accumulated in the shadow entries
+static int pollset_deliver(px4_pollset_t *ps, px4_pollfd_struct_t *fds, unsigned int nfds)
+{
+	int count = 0;
+
+	for (unsigned int i = 0; i < nfds; ++i) {
+		// atomically take the accumulated events; bits set concurrently by
+		// poll_notify_one() survive in the shadow entry for the next call
+		px4_pollevent_t revents = __atomic_exchange_n(&ps->shadow[i].revents, 0, __ATOMIC_RELAXED);
+
+		fds[i].revents = revents;
+
+		if (revents != 0) {
+			++count;
+		}
+	}
+
+	return count;
+}
+
 extern "C" {
 
 	int register_driver(const char *name, const cdev::px4_file_operations_t *fops, cdev::mode_t mode, void *data)
@@ -251,6 +396,9 @@ extern "C" {
 		cdev::CDev *dev = getFile(fd);
 
 		if (dev) {
+			// remove any poll registrations that would otherwise dangle
+			pollset_purge_fd(fd);
+
 			pthread_mutex_lock(&filemutex);
 			ret = dev->close(&filemap[fd]);
 
@@ -336,58 +484,105 @@ extern "C" {
 			return -1;
 		}
 
-		px4_sem_t sem;
+		px4_pollset_t *ps = get_pollset();
+
+		if (ps == nullptr) {
+			return -1;
+		}
+
 		int count = 0;
 		int ret = -1;
 
-		const unsigned NAMELEN = 32;
-		char thread_name[NAMELEN] {};
+		PX4_DEBUG("Called px4_poll timeout = %d", timeout);
+
+		pthread_mutex_lock(&pollsetmutex);
 
-#ifndef __PX4_QURT
-		int nret = pthread_getname_np(pthread_self(), thread_name, NAMELEN);
+		// Check whether the registered shadow set still matches the request
+		bool same = ps->registered && (ps->nfds == nfds);
 
-		if (nret || thread_name[0] == 0) {
-			PX4_WARN("failed getting thread name");
+		for (unsigned int i = 0; same && (i < nfds); ++i) {
+			same = (ps->shadow[i].fd == fds[i].fd) && (ps->shadow[i].events == fds[i].events);
 		}
 
-#endif
+		bool fd_pollable = same;
 
-		PX4_DEBUG("Called px4_poll timeout = %d", timeout);
+		if (!same) {
+			pollset_teardown(ps);
 
-		px4_sem_init(&sem, 0, 0);
+			if (nfds > ps->capacity) {
+				delete[](ps->shadow);
+				ps->shadow = new px4_pollfd_struct_t[nfds];
 
-		// sem use case is a signal
-		px4_sem_setprotocol(&sem, SEM_PRIO_NONE);
+				if (ps->shadow == nullptr) {
+					ps->capacity = 0;
+					ps->nfds = 0;
+					pthread_mutex_unlock(&pollsetmutex);
+					return -1;
+				}
 
-		// Go through all fds and check them for a pollable state
-		bool fd_pollable = false;
+				ps->capacity = nfds;
+			}
 
-		for (unsigned int i = 0; i < nfds; ++i) {
-			fds[i].sem     = &sem;
-			fds[i].revents = 0;
-			fds[i].priv    = nullptr;
+			// discard wakeups left over from the previous registration
+			while (px4_sem_trywait(&ps->sem) == 0) {}
 
-			cdev::CDev *dev = getFile(fds[i].fd);
+			ps->nfds = nfds;
 
-			// If fd is valid
-			if (dev) {
-				PX4_DEBUG("%s: px4_poll: CDev->poll(setup) %d", thread_name, fds[i].fd);
-				ret = dev->poll(&filemap[fds[i].fd], &fds[i], true);
+			for (unsigned int i = 0; i < nfds; ++i) {
+				ps->shadow[i].fd      = fds[i].fd;
+				ps->shadow[i].events  = fds[i].events;
+				ps->shadow[i].revents = 0;
+				ps->shadow[i].sem     = &ps->sem;
+				ps->shadow[i].priv    = nullptr;
+			}
 
-				if (ret < 0) {
-					PX4_WARN("%s: px4_poll() error: %s", thread_name, strerror(errno));
-					break;
+			ps->registered = true;
+
+			// Go through all fds and check them for a pollable state
+			for (unsigned int i = 0; i < nfds; ++i) {
+				cdev::CDev *dev = getFile(fds[i].fd);
+
+				// If fd is valid
+				if (dev) {
+					PX4_DEBUG("px4_poll: CDev->poll(setup) %d", fds[i].fd);
+					ret = dev->poll(&filemap[fds[i].fd], &ps->shadow[i], true);
+
+					if (ret < 0) {
+						PX4_WARN("px4_poll() error: %s", strerror(errno));
+						break;
+					}
+
+					if (ret >= 0) {
+						fd_pollable = true;
+					}
 				}
+			}
+		}
+
+		pthread_mutex_unlock(&pollsetmutex);
 
-				if (ret >= 0) {
-					fd_pollable = true;
+		// Deliver the readiness accumulated since the last call
+		count = pollset_deliver(ps, fds, nfds);
+
+		if (same && (count == 0)) {
+			// level-triggered semantics: readiness can predate the edge
+			// notifications accumulated since the last call (e.g. queued
+			// samples not yet drained), so re-check the device state once.
+			// A fresh registration already did this through poll(setup).
+			for (unsigned int i = 0; i < nfds; ++i) {
+				cdev::CDev *dev = getFile(ps->shadow[i].fd);
+
+				if (dev) {
+					dev->poll_refresh(&ps->shadow[i]);
 				}
 			}
+
+			count = pollset_deliver(ps, fds, nfds);
 		}
 
-		// If any FD can be polled, lock the semaphore and
-		// check for new data
-		if (fd_pollable) {
+		if (fd_pollable && (count == 0)) {
+			ret = 0;
+
 			if (timeout > 0) {
 				// Get the current time
 				struct timespec ts;
@@ -402,40 +597,28 @@ extern "C" {
 				nsecs -= (nsecs / billion) * billion;
 				ts.tv_nsec = nsecs;
 
-				ret = px4_sem_timedwait(&sem, &ts);
+				ret = px4_sem_timedwait(&ps->sem, &ts);
 
 				if (ret && errno != ETIMEDOUT) {
-					PX4_WARN("%s: px4_poll() sem error: %s", thread_name, strerror(errno));
+					PX4_WARN("px4_poll() sem error: %s", strerror(errno));
 				}
 
-			} else if (timeout < 0) {
-				px4_sem_wait(&sem);
-			}
-
-			// We have waited now (or not, depending on timeout),
-			// go through all fds and count how many have data
-			for (unsigned int i = 0; i < nfds; ++i) {
-
-				cdev::CDev *dev = getFile(fds[i].fd);
+				if (ret == 0) {
+					count = pollset_deliver(ps, fds, nfds);
+				}
 
-				// If fd is valid
-				if (dev) {
-					PX4_DEBUG("%s: px4_poll: CDev->poll(teardown) %d", thread_name, fds[i].fd);
-					ret = dev->poll(&filemap[fds[i].fd], &fds[i], false);
+				ret = 0;
 
-					if (ret < 0) {
-						PX4_WARN("%s: px4_poll() 2nd poll fail", thread_name);
-						break;
-					}
-
-					if (fds[i].revents) {
-						count += 1;
-					}
-				}
+			} else if (timeout < 0) {
+				px4_sem_wait(&ps->sem);
+				count = pollset_deliver(ps, fds, nfds);
 			}
-		}
 
-		px4_sem_destroy(&sem);
+		} else if (count > 0) {
+			// consume the wakeups matching the events just delivered; events
+			// arriving concurrently keep their shadow bits for the next call
+			while (px4_sem_trywait(&ps->sem) == 0) {}
+		}
 
 		// Return the positive count if present,
 		// return the negative error number if failed
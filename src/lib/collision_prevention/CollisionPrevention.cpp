@@ -87,6 +87,11 @@ CollisionPrevention::CollisionPrevention(ModuleParams *parent) :
 		_data_maxranges[i] = 0;
 		_data_fov[i] = 0;
 		_obstacle_map_body_frame.distances[i] = UINT16_MAX;
+
+		// the bin angles are fixed, so the per-bin unit vectors only have to be computed once
+		const float bin_angle_rad = math::radians((float)i * INTERNAL_MAP_INCREMENT_DEG +
+					    _obstacle_map_body_frame.angle_offset);
+		_bin_directions_body[i] = {cosf(bin_angle_rad), sinf(bin_angle_rad)};
 	}
 }
 
@@ -115,53 +120,52 @@ bool CollisionPrevention::is_active()
 void
 CollisionPrevention::_addObstacleSensorData(const obstacle_distance_s &obstacle, const matrix::Quatf &vehicle_attitude)
 {
-	int msg_index = 0;
-	float vehicle_orientation_deg = math::degrees(Eulerf(vehicle_attitude).psi());
-	float increment_factor = 1.f / obstacle.increment;
+	float vehicle_orientation_deg = 0.f;
 
 	if (obstacle.frame == obstacle.MAV_FRAME_GLOBAL || obstacle.frame == obstacle.MAV_FRAME_LOCAL_NED) {
 		// Obstacle message arrives in local_origin frame (north aligned)
-		// corresponding data index (convert to world frame and shift by msg offset)
+		// data indices get converted to world frame and shifted by the msg offset
+		vehicle_orientation_deg = math::degrees(Eulerf(vehicle_attitude).psi());
+
+	} else if (obstacle.frame != obstacle.MAV_FRAME_BODY_FRD) {
+		mavlink_log_critical(&_mavlink_log_pub, "Obstacle message received in unsupported frame %i\t",
+				     obstacle.frame);
+		events::send<uint8_t>(events::ID("col_prev_unsup_frame"), events::Log::Error,
+				      "Obstacle message received in unsupported frame {1}", obstacle.frame);
+		return;
+	}
+
+	// The bin to message index mapping only depends on the orientation and the message
+	// geometry, so it is cached and only recomputed when one of the inputs changed.
+	// For body frame messages (front aligned) that is only the first message.
+	if (vehicle_orientation_deg != _msg_map_orientation_deg || obstacle.angle_offset != _msg_map_angle_offset
+	    || obstacle.increment != _msg_map_increment) {
+
+		const float increment_factor = 1.f / obstacle.increment;
+
 		for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) {
 			float bin_angle_deg = (float)i * INTERNAL_MAP_INCREMENT_DEG + _obstacle_map_body_frame.angle_offset;
-			msg_index = ceil(wrap_360(vehicle_orientation_deg + bin_angle_deg - obstacle.angle_offset) * increment_factor);
-
-			//add all data points inside to FOV
-			if (obstacle.distances[msg_index] != UINT16_MAX) {
-				if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[msg_index] * 0.01f)) {
-					_obstacle_map_body_frame.distances[i] = obstacle.distances[msg_index];
-					_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
-					_data_maxranges[i] = obstacle.max_distance;
-					_data_fov[i] = 1;
-				}
-			}
+			_msg_index_map[i] = ceil(wrap_360(vehicle_orientation_deg + bin_angle_deg - obstacle.angle_offset) *
+						 increment_factor);
 		}
 
-	} else if (obstacle.frame == obstacle.MAV_FRAME_BODY_FRD) {
-		// Obstacle message arrives in body frame (front aligned)
-		// corresponding data index (shift by msg offset)
-		for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) {
-			float bin_angle_deg = (float)i * INTERNAL_MAP_INCREMENT_DEG +
-					      _obstacle_map_body_frame.angle_offset;
-			msg_index = ceil(wrap_360(bin_angle_deg - obstacle.angle_offset) * increment_factor);
-
-			//add all data points inside to FOV
-			if (obstacle.distances[msg_index] != UINT16_MAX) {
-
-				if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[msg_index] * 0.01f)) {
-					_obstacle_map_body_frame.distances[i] = obstacle.distances[msg_index];
-					_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
-					_data_maxranges[i] = obstacle.max_distance;
-					_data_fov[i] = 1;
-				}
+		_msg_map_orientation_deg = vehicle_orientation_deg;
+		_msg_map_angle_offset = obstacle.angle_offset;
+		_msg_map_increment = obstacle.increment;
+	}
+
+	for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) {
+		const int msg_index = _msg_index_map[i];
+
+		//add all data points inside to FOV
+		if (obstacle.distances[msg_index] != UINT16_MAX) {
+			if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[msg_index] * 0.01f)) {
+				_obstacle_map_body_frame.distances[i] = obstacle.distances[msg_index];
+				_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
+				_data_maxranges[i] = obstacle.max_distance;
+				_data_fov[i] = 1;
 			}
 		}
-
-	} else {
-		mavlink_log_critical(&_mavlink_log_pub, "Obstacle message received in unsupported frame %i\t",
-				     obstacle.frame);
-		events::send<uint8_t>(events::ID("col_prev_unsup_frame"), events::Log::Error,
-				      "Obstacle message received in unsupported frame {1}", obstacle.frame);
 	}
 }
 
@@ -330,9 +334,11 @@ CollisionPrevention::_adaptSetpointDirection(Vector2f &setpoint_dir, int &setpoi
 
 	//only change setpoint direction if it was moved to a different bin
 	if (new_sp_index != setpoint_index) {
-		float angle = math::radians((float)new_sp_index * INTERNAL_MAP_INCREMENT_DEG + _obstacle_map_body_frame.angle_offset);
-		angle = wrap_2pi(vehicle_yaw_angle_rad + angle);
-		setpoint_dir = {cosf(angle), sinf(angle)};
+		// rotate the precomputed body frame bin direction into the local frame
+		const Vector2f &dir_body = _bin_directions_body[new_sp_index];
+		const float cos_yaw = cosf(vehicle_yaw_angle_rad);
+		const float sin_yaw = sinf(vehicle_yaw_angle_rad);
+		setpoint_dir = {cos_yaw * dir_body(0) - sin_yaw * dir_body(1), sin_yaw * dir_body(0) + cos_yaw * dir_body(1)};
 		setpoint_index = new_sp_index;
 	}
 }
@@ -419,30 +425,32 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 			// change setpoint direction slightly (max by _param_cp_guide_ang degrees) to help guide through narrow gaps
 			_adaptSetpointDirection(setpoint_dir, sp_index, vehicle_yaw_angle_rad);
 
-			// limit speed for safe flight
-			for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) { // disregard unused bins at the end of the message
-
-				// delete stale values
-				const hrt_abstime data_age = constrain_time - _data_timestamps[i];
+			// the bin directions only rotate with the vehicle yaw, so the trig is evaluated once
+			// and the precomputed body frame unit vectors get rotated into the local frame per bin
+			const float cos_yaw = cosf(vehicle_yaw_angle_rad);
+			const float sin_yaw = sinf(vehicle_yaw_angle_rad);
 
-				if (data_age > RANGE_STREAM_TIMEOUT_US) {
+			// delete stale values and count the bins inside the field of view in one simple pass
+			for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) {
+				if ((constrain_time - _data_timestamps[i]) > RANGE_STREAM_TIMEOUT_US) {
 					_obstacle_map_body_frame.distances[i] = UINT16_MAX;
 				}
 
-				const float distance = _obstacle_map_body_frame.distances[i] * 0.01f; // convert to meters
-				const float max_range = _data_maxranges[i] * 0.01f; // convert to meters
-				float angle = math::radians((float)i * INTERNAL_MAP_INCREMENT_DEG + _obstacle_map_body_frame.angle_offset);
-
-				// convert from body to local frame in the range [0, 2*pi]
-				angle = wrap_2pi(vehicle_yaw_angle_rad + angle);
-
-				// get direction of current bin
-				const Vector2f bin_direction = {cosf(angle), sinf(angle)};
-
-				//count number of bins in the field of valid_new
 				if (_obstacle_map_body_frame.distances[i] < UINT16_MAX) {
 					num_fov_bins ++;
 				}
+			}
+
+			// limit speed for safe flight
+			for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) { // disregard unused bins at the end of the message
+
+				const hrt_abstime data_age = constrain_time - _data_timestamps[i];
+				const float distance = _obstacle_map_body_frame.distances[i] * 0.01f; // convert to meters
+				const float max_range = _data_maxranges[i] * 0.01f; // convert to meters
+
+				// get direction of current bin in the local frame
+				const Vector2f bin_direction{cos_yaw * _bin_directions_body[i](0) - sin_yaw * _bin_directions_body[i](1),
+							     sin_yaw * _bin_directions_body[i](0) + cos_yaw * _bin_directions_body[i](1)};
 
 				if (_obstacle_map_body_frame.distances[i] > _obstacle_map_body_frame.min_distance
 				    && _obstacle_map_body_frame.distances[i] < UINT16_MAX) {
@@ -89,6 +89,8 @@ protected:
 	uint64_t _data_timestamps[sizeof(_obstacle_map_body_frame.distances) / sizeof(_obstacle_map_body_frame.distances[0])];
 	uint16_t _data_maxranges[sizeof(_obstacle_map_body_frame.distances) / sizeof(
 										    _obstacle_map_body_frame.distances[0])]; /**< in cm */
+	matrix::Vector2f _bin_directions_body[sizeof(_obstacle_map_body_frame.distances) / sizeof(
+				_obstacle_map_body_frame.distances[0])]; /**< per-bin unit vectors in body frame, precomputed from the fixed bin angles */
 
 	void _addDistanceSensorData(distance_sensor_s &distance_sensor, const matrix::Quatf &vehicle_attitude);
 
@@ -135,6 +137,16 @@ private:
 	uORB::SubscriptionData<vehicle_attitude_s> _sub_vehicle_attitude{ORB_ID(vehicle_attitude)};
 	uORB::SubscriptionMultiArray<distance_sensor_s> _distance_sensor_subs{ORB_ID::distance_sensor};
 
+	/**
+	 * Mapping from internal map bin to index into the last obstacle message.
+	 * It only depends on the vehicle orientation and the message geometry and
+	 * is therefore cached between messages and recomputed when those changed.
+	 */
+	uint16_t _msg_index_map[sizeof(_obstacle_map_body_frame.distances) / sizeof(_obstacle_map_body_frame.distances[0])];
+	float _msg_map_orientation_deg{NAN};
+	float _msg_map_angle_offset{NAN};
+	float _msg_map_increment{-1.f};
+
 	static constexpr uint64_t RANGE_STREAM_TIMEOUT_US{500_ms};
 	static constexpr uint64_t TIMEOUT_HOLD_US{5_s};
 
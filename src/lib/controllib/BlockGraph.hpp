@@ -0,0 +1,263 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file BlockGraph.hpp
+ *
+ * Compile-time composition for controller block graphs.
+ *
+ * The classes in control::graph mirror the update equations of the Block
+ * classes but carry no parent/name registration, no virtual calls and no
+ * BlockParam handles: parameters are plain members that the owning module
+ * pushes in from its ModuleParams cache when parameters change, and dt is
+ * passed through the update call. Series<> assembles stages into a single
+ * flattened update function the compiler can inline end to end.
+ *
+ * The Block API remains the place to prototype a graph; once its shape is
+ * settled, production graphs can be moved here for zero-indirection
+ * execution. The equations are kept identical to the Block versions and
+ * pinned against them in the controllib test.
+ */
+
+#pragma once
+
+#include <px4_platform_common/defines.h>
+#include <math.h>
+#include <type_traits>
+
+namespace control
+{
+namespace graph
+{
+
+/**
+ * A low pass filter, @see BlockLowPass
+ */
+class LowPass
+{
+public:
+	float update(float input, float dt)
+	{
+		if (!PX4_ISFINITE(_state)) {
+			_state = input;
+		}
+
+		const float b = 2.f * float(M_PI) * _fcut * dt;
+		const float a = b / (1.f + b);
+		_state = a * input + (1.f - a) * _state;
+		return _state;
+	}
+
+	void setFCut(float fcut) { _fcut = fcut; }
+	float getState() const { return _state; }
+	void setState(float state) { _state = state; }
+
+private:
+	float _fcut{0.f};
+	float _state{NAN}; // initialize to invalid val, force into is_finite() check on first call
+};
+
+/**
+ * A high pass filter, @see BlockHighPass
+ */
+class HighPass
+{
+public:
+	float update(float input, float dt)
+	{
+		const float b = 2.f * float(M_PI) * _fcut * dt;
+		const float a = 1.f / (1.f + b);
+		_y = a * (_y + input - _u);
+		_u = input;
+		return _y;
+	}
+
+	void setFCut(float fcut) { _fcut = fcut; }
+	float getU() const { return _u; }
+	void setU(float u) { _u = u; }
+	float getY() const { return _y; }
+	void setY(float y) { _y = y; }
+
+private:
+	float _fcut{0.f};
+	float _u{0.f};
+	float _y{0.f};
+};
+
+/**
+ * A simple derivative approximation with built in low pass filter,
+ * @see BlockDerivative
+ */
+class Derivative
+{
+public:
+	float update(float input, float dt)
+	{
+		float output;
+
+		if (_initialized) {
+			output = _lowpass.update((input - _u) / dt, dt);
+
+		} else {
+			// no valid derivative on the first call to update
+			_lowpass.update(0.f, dt);
+			output = 0.f;
+			_initialized = true;
+		}
+
+		_u = input;
+		return output;
+	}
+
+	void setLPFCut(float fcut) { _lowpass.setFCut(fcut); }
+	float getU() const { return _u; }
+
+private:
+	LowPass _lowpass;
+	float _u{0.f};
+	bool _initialized{false};
+};
+
+/**
+ * A symmetric limiter, @see BlockLimitSym
+ */
+class LimitSym
+{
+public:
+	float update(float input, float)
+	{
+		if (input > _max) {
+			input = _max;
+
+		} else if (input < -_max) {
+			input = -_max;
+		}
+
+		return input;
+	}
+
+	void setMax(float max) { _max = max; }
+	float getMax() const { return _max; }
+
+private:
+	float _max{0.f};
+};
+
+/**
+ * An integrator with built in symmetric limit, @see BlockIntegral
+ */
+class Integral
+{
+public:
+	float update(float input, float dt)
+	{
+		_y = _limit.update(_y + input * dt, dt);
+		return _y;
+	}
+
+	void setMax(float max) { _limit.setMax(max); }
+	float getY() const { return _y; }
+	void setY(float y) { _y = y; }
+
+private:
+	LimitSym _limit;
+	float _y{0.f};
+};
+
+/**
+ * A proportional gain, @see BlockP
+ */
+class P
+{
+public:
+	float update(float input, float) { return _kp * input; }
+
+	void setKP(float kp) { _kp = kp; }
+	float getKP() const { return _kp; }
+
+private:
+	float _kp{0.f};
+};
+
+/**
+ * A chain of stages flattened into one update function.
+ *
+ * Each stage provides float update(float input, float dt); the compiler sees
+ * all stage bodies and inlines the whole chain into the caller. Individual
+ * stages are reachable through get<I>() for parameter updates.
+ */
+template<typename... Stages>
+class Series;
+
+template<typename Stage>
+class Series<Stage>
+{
+public:
+	float update(float input, float dt) { return _stage.update(input, dt); }
+
+	template<unsigned I>
+	Stage &get()
+	{
+		static_assert(I == 0, "stage index out of range");
+		return _stage;
+	}
+
+private:
+	Stage _stage;
+};
+
+template<typename First, typename... Rest>
+class Series<First, Rest...>
+{
+public:
+	float update(float input, float dt) { return _rest.update(_first.update(input, dt), dt); }
+
+	template<unsigned I, typename std::enable_if<I == 0, int>::type = 0>
+	First &get()
+	{
+		return _first;
+	}
+
+	template<unsigned I, typename std::enable_if<I != 0, int>::type = 0>
+	auto &get()
+	{
+		return _rest.template get < I - 1 > ();
+	}
+
+private:
+	First _first;
+	Series<Rest...> _rest;
+};
+
+} // namespace graph
+} // namespace control
@@ -42,6 +42,7 @@
 #include <float.h>
 
 #include <controllib/blocks.hpp>
+#include <controllib/BlockGraph.hpp>
 
 #define ASSERT_CL(T) if (!(T)) { printf("FAIL\n"); return -1; }
 
@@ -66,6 +67,7 @@ int blockRandUniformTest();
 int blockRandGaussTest();
 int blockStatsTest();
 int blockDelayTest();
+int blockGraphTest();
 
 int basicBlocksTest()
 {
@@ -87,6 +89,7 @@ int basicBlocksTest()
 	// blockRandGaussTest();
 	blockStatsTest();
 	blockDelayTest();
+	blockGraphTest();
 	return 0;
 }
 
@@ -527,4 +530,36 @@ int blockDelayTest()
 	return 0;
 }
 
+int blockGraphTest()
+{
+	printf("Test BlockGraph\t\t\t: ");
+	// graph kernels must reproduce the Block update equations exactly
+	graph::LowPass lowPass;
+	lowPass.setFCut(10.0f);
+	lowPass.setState(1.0f);
+	ASSERT_CL(equal(1.8626974f, lowPass.update(2.0f, 0.1f)));
+	graph::HighPass highPass;
+	highPass.setFCut(10.0f);
+	highPass.setU(1.0f);
+	highPass.setY(1.0f);
+	ASSERT_CL(equal(0.2746051f, highPass.update(2.0f, 0.1f)));
+	graph::Derivative derivative;
+	derivative.setLPFCut(10.0f);
+	ASSERT_CL(equal(0.0f, derivative.update(1.0f, 0.1f))); // no valid derivative yet
+	ASSERT_CL(equal(8.626974f, derivative.update(2.0f, 0.1f)));
+	graph::Integral integral;
+	integral.setMax(1.0f);
+	ASSERT_CL(equal(0.1f, integral.update(1.0f, 0.1f)));
+	ASSERT_CL(equal(1.0f, integral.update(100.0f, 0.1f)));
+	// a series flattens into a single update call
+	graph::Series<graph::LowPass, graph::LimitSym> series;
+	series.get<0>().setFCut(10.0f);
+	series.get<0>().setState(1.0f);
+	series.get<1>().setMax(1.5f);
+	ASSERT_CL(equal(1.5f, series.update(2.0f, 0.1f)));
+	ASSERT_CL(equal(1.8626974f, series.get<0>().getState()));
+	printf("PASS\n");
+	return 0;
+}
+
 } // namespace control
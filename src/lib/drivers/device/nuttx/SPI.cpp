@@ -231,5 +231,100 @@ SPI::_transferhword(uint16_t *send, uint16_t *recv, unsigned len)
 	return PX4_OK;
 }
 
+int
+SPI::transfer_batch(TransferSegment *segments, unsigned count)
+{
+	int result;
+
+	if ((segments == nullptr) || (count == 0)) {
+		return -EINVAL;
+	}
+
+	LockMode mode = up_interrupt_context() ? LOCK_NONE : _locking_mode;
+
+	/* lock the bus as required */
+	switch (mode) {
+	default:
+	case LOCK_PREEMPTION: {
+			irqstate_t state = px4_enter_critical_section();
+			result = _transfer_batch(segments, count, 8);
+			px4_leave_critical_section(state);
+		}
+		break;
+
+	case LOCK_THREADS:
+		SPI_LOCK(_dev, true);
+		result = _transfer_batch(segments, count, 8);
+		SPI_LOCK(_dev, false);
+		break;
+
+	case LOCK_NONE:
+		result = _transfer_batch(segments, count, 8);
+		break;
+	}
+
+	return result;
+}
+
+int
+SPI::transfer_batchhword(TransferSegment *segments, unsigned count)
+{
+	int result;
+
+	if ((segments == nullptr) || (count == 0)) {
+		return -EINVAL;
+	}
+
+	LockMode mode = up_interrupt_context() ? LOCK_NONE : _locking_mode;
+
+	/* lock the bus as required */
+	switch (mode) {
+	default:
+	case LOCK_PREEMPTION: {
+			irqstate_t state = px4_enter_critical_section();
+			result = _transfer_batch(segments, count, 16);
+			px4_leave_critical_section(state);
+		}
+		break;
+
+	case LOCK_THREADS:
+		SPI_LOCK(_dev, true);
+		result = _transfer_batch(segments, count, 16);
+		SPI_LOCK(_dev, false);
+		break;
+
+	case LOCK_NONE:
+		result = _transfer_batch(segments, count, 16);
+		break;
+	}
+
+	return result;
+}
+
+int
+SPI::_transfer_batch(TransferSegment *segments, unsigned count, int bits)
+{
+	/* the bus is configured once for the whole batch */
+	SPI_SETFREQUENCY(_dev, _frequency);
+	SPI_SETMODE(_dev, _mode);
+	SPI_SETBITS(_dev, bits);
+
+	for (unsigned i = 0; i < count; i++) {
+		SPI_SELECT(_dev, _device, true);
+
+		/* do the transfer */
+		SPI_EXCHANGE(_dev, segments[i].send, segments[i].recv, segments[i].len);
+
+		SPI_SELECT(_dev, _device, false);
+
+		/* stall with chip select deasserted if the device requires it */
+		if (segments[i].delay_usecs > 0) {
+			up_udelay(segments[i].delay_usecs);
+		}
+	}
+
+	return PX4_OK;
+}
+
 } // namespace device
 #endif // CONFIG_SPI
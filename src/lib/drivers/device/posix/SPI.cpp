@@ -195,6 +195,66 @@ SPI::transferhword(uint16_t *send, uint16_t *recv, unsigned len)
 	return PX4_OK;
 }
 
+int
+SPI::transfer_batch(TransferSegment *segments, unsigned count)
+{
+	return _transfer_batch(segments, count, 8);
+}
+
+int
+SPI::transfer_batchhword(TransferSegment *segments, unsigned count)
+{
+	return _transfer_batch(segments, count, 16);
+}
+
+int
+SPI::_transfer_batch(TransferSegment *segments, unsigned count, int bits)
+{
+	if ((segments == nullptr) || (count == 0) || (count > MAX_TRANSFER_SEGMENTS)) {
+		return -EINVAL;
+	}
+
+	// set write mode of SPI
+	int result = ::ioctl(_fd, SPI_IOC_WR_MODE, &_mode);
+
+	if (result == -1) {
+		PX4_ERR("can’t set spi mode");
+		return PX4_ERROR;
+	}
+
+	result = ::ioctl(_fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+
+	if (result == -1) {
+		PX4_ERR("can’t set %d bit spi mode", bits);
+		return PX4_ERROR;
+	}
+
+	// chain the segments into a single message, sequenced by the kernel
+	spi_ioc_transfer spi_transfer[MAX_TRANSFER_SEGMENTS] {};
+	unsigned total_len = 0;
+
+	for (unsigned i = 0; i < count; i++) {
+		spi_transfer[i].tx_buf = (uint64_t)segments[i].send;
+		spi_transfer[i].rx_buf = (uint64_t)segments[i].recv;
+		spi_transfer[i].len = segments[i].len * (bits / 8);
+		spi_transfer[i].speed_hz = _frequency;
+		spi_transfer[i].delay_usecs = segments[i].delay_usecs;
+		// deassert chip select between the segments (the last one ends the message)
+		spi_transfer[i].cs_change = (i + 1 < count);
+
+		total_len += spi_transfer[i].len;
+	}
+
+	result = ::ioctl(_fd, SPI_IOC_MESSAGE(count), spi_transfer);
+
+	if (result != (int)total_len) {
+		PX4_ERR("write failed. Reported %d bytes written (%s)", result, strerror(errno));
+		return PX4_ERROR;
+	}
+
+	return PX4_OK;
+}
+
 } // namespace device
 
 #endif // __PX4_LINUX
@@ -151,6 +151,50 @@ protected:
 	 */
 	int		transferhword(uint16_t *send, uint16_t *recv, unsigned len);
 
+	/**
+	 * One chip-select framed segment of a batched transfer.
+	 */
+	struct TransferSegment {
+		void		*send;		/**< data to send, or nullptr if no data is to be sent */
+		void		*recv;		/**< receive buffer, or nullptr if no data is to be received */
+		unsigned	len;		/**< number of words to transfer (bytes for transfer_batch(),
+						     16 bit words for transfer_batchhword()) */
+		unsigned	delay_usecs;	/**< stall time after deasserting chip select, for devices
+						     which require one between accesses (e.g. the ADIS series) */
+	};
+
+	/** maximum number of segments per batch */
+	static constexpr unsigned MAX_TRANSFER_SEGMENTS = 8;
+
+	/**
+	 * Perform a batch of chip-select framed transfers as a single bus
+	 * transaction.
+	 *
+	 * The segments are chained into a single spidev message, so the kernel
+	 * sequences them back-to-back without a syscall and bus setup per
+	 * transfer, and no other device on a shared bus can be interleaved
+	 * between the segments.
+	 *
+	 * @param segments	Segments to transfer, each framed by its own
+	 *			chip select cycle (at most
+	 *			MAX_TRANSFER_SEGMENTS).
+	 * @param count		Number of segments.
+	 * @return		OK if the batch was successful, -errno
+	 *			otherwise.
+	 */
+	int		transfer_batch(TransferSegment *segments, unsigned count);
+
+	/**
+	 * Perform a batch of chip-select framed 16 bit transfers as a single
+	 * bus transaction (see transfer_batch()).
+	 *
+	 * @param segments	Segments to transfer, lengths in 16 bit words.
+	 * @param count		Number of segments.
+	 * @return		OK if the batch was successful, -errno
+	 *			otherwise.
+	 */
+	int		transfer_batchhword(TransferSegment *segments, unsigned count);
+
 	/**
 	 * Set the SPI bus frequency
 	 * This is used to change frequency on the fly. Some sensors
@@ -186,6 +230,8 @@ protected:
 
 	int	_transferhword(uint16_t *send, uint16_t *recv, unsigned len);
 
+	int	_transfer_batch(TransferSegment *segments, unsigned count, int bits);
+
 	virtual bool	external() const override { return px4_spi_bus_external(get_device_bus()); }
 
 };
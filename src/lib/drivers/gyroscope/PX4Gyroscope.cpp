@@ -134,11 +134,33 @@ void PX4Gyroscope::update(const hrt_abstime &timestamp_sample, float x, float y,
 	_sensor_pub.publish(report);
 }
 
+sensor_gyro_fifo_s &PX4Gyroscope::fifoBuffer()
+{
+	// construct the message directly in the uORB queue slot where possible,
+	// otherwise stage it locally and pay the copy in publish()
+	_lent_fifo = _sensor_fifo_pub.lend();
+
+	sensor_gyro_fifo_s &buffer = (_lent_fifo != nullptr) ? *_lent_fifo : _fifo_fallback;
+	buffer = {};
+
+	return buffer;
+}
+
 void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 {
-	// rotate all raw samples and publish fifo
 	const uint8_t N = sample.samples;
 
+	if (N == 0) {
+		// nothing to publish, return a lent queue slot
+		if (&sample == _lent_fifo) {
+			_sensor_fifo_pub.abort();
+			_lent_fifo = nullptr;
+		}
+
+		return;
+	}
+
+	// rotate all raw samples
 	for (int n = 0; n < N; n++) {
 		rotate_3i(_rotation, sample.x[n], sample.y[n], sample.z[n]);
 	}
@@ -146,10 +168,9 @@ void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 	sample.device_id = _device_id;
 	sample.scale = _scale;
 	sample.timestamp = hrt_absolute_time();
-	_sensor_fifo_pub.publish(sample);
-
 
-	// publish
+	// derive the integrated sensor_gyro sample before the fifo message is
+	// committed (a lent slot must not be read once it is visible to subscribers)
 	sensor_gyro_s report;
 	report.timestamp_sample = sample.timestamp_sample;
 	report.device_id = _device_id;
@@ -172,6 +193,15 @@ void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 	report.samples = N;
 	report.timestamp = hrt_absolute_time();
 
+	// publish fifo
+	if (&sample == _lent_fifo) {
+		_sensor_fifo_pub.commit();
+		_lent_fifo = nullptr;
+
+	} else {
+		_sensor_fifo_pub.publish(sample);
+	}
+
 	_sensor_pub.publish(report);
 }
 
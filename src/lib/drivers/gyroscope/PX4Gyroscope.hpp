@@ -58,6 +58,13 @@ public:
 
 	void update(const hrt_abstime &timestamp_sample, float x, float y, float z);
 
+	/**
+	 * Obtain a zeroed buffer to assemble FIFO samples in, to be passed to updateFIFO().
+	 * Where possible this is the uORB queue slot itself, so the driver constructs the
+	 * message in place and publication is zero-copy.
+	 */
+	sensor_gyro_fifo_s &fifoBuffer();
+
 	void updateFIFO(sensor_gyro_fifo_s &sample);
 
 	int get_instance() { return _sensor_pub.get_instance(); };
@@ -66,7 +73,10 @@ private:
 	void UpdateClipLimit();
 
 	uORB::PublicationMulti<sensor_gyro_s> _sensor_pub{ORB_ID(sensor_gyro)};
-	uORB::PublicationMulti<sensor_gyro_fifo_s>  _sensor_fifo_pub{ORB_ID(sensor_gyro_fifo)};
+	uORB::PublicationMultiLend<sensor_gyro_fifo_s>  _sensor_fifo_pub{ORB_ID(sensor_gyro_fifo)};
+
+	sensor_gyro_fifo_s	_fifo_fallback{};       // staging buffer when no queue slot can be lent
+	sensor_gyro_fifo_s	*_lent_fifo{nullptr};   // queue slot currently handed out by fifoBuffer()
 
 	uint32_t		_device_id{0};
 	const enum Rotation	_rotation;
@@ -58,16 +58,6 @@ using matrix::wrap_2pi;
  * formulas according to: http://mathworld.wolfram.com/AzimuthalEquidistantProjection.html
  */
 
-void MapProjection::initReference(double lat_0, double lon_0, uint64_t timestamp)
-{
-	_ref_timestamp = timestamp;
-	_ref_lat = math::radians(lat_0);
-	_ref_lon = math::radians(lon_0);
-	_ref_sin_lat = sin(_ref_lat);
-	_ref_cos_lat = cos(_ref_lat);
-	_ref_init_done = true;
-}
-
 void MapProjection::project(double lat, double lon, float &x, float &y) const
 {
 	const double lat_rad = math::radians(lat);
@@ -113,6 +103,66 @@ void MapProjection::reproject(float x, float y, double &lat, double &lon) const
 	}
 }
 
+void MapProjection::project(const double lats[], const double lons[], float xs[], float ys[], size_t count) const
+{
+	// hoist the reference values into locals: the compiler cannot prove the
+	// input arrays don't alias the members and would reload them per point
+	const double ref_lon = _ref_lon;
+	const double ref_sin_lat = _ref_sin_lat;
+	const double ref_cos_lat = _ref_cos_lat;
+
+	for (size_t i = 0; i < count; i++) {
+		const double lat_rad = math::radians(lats[i]);
+		const double lon_rad = math::radians(lons[i]);
+
+		const double sin_lat = sin(lat_rad);
+		const double cos_lat = cos(lat_rad);
+
+		const double cos_d_lon = cos(lon_rad - ref_lon);
+
+		const double arg = math::constrain(ref_sin_lat * sin_lat + ref_cos_lat * cos_lat * cos_d_lon, -1.0,  1.0);
+		const double c = acos(arg);
+
+		double k = 1.0;
+
+		if (fabs(c) > 0) {
+			k = (c / sin(c));
+		}
+
+		xs[i] = static_cast<float>(k * (ref_cos_lat * sin_lat - ref_sin_lat * cos_lat * cos_d_lon) * CONSTANTS_RADIUS_OF_EARTH);
+		ys[i] = static_cast<float>(k * cos_lat * sin(lon_rad - ref_lon) * CONSTANTS_RADIUS_OF_EARTH);
+	}
+}
+
+void MapProjection::reproject(const float xs[], const float ys[], double lats[], double lons[], size_t count) const
+{
+	const double ref_lat = _ref_lat;
+	const double ref_lon = _ref_lon;
+	const double ref_sin_lat = _ref_sin_lat;
+	const double ref_cos_lat = _ref_cos_lat;
+
+	for (size_t i = 0; i < count; i++) {
+		const double x_rad = (double)xs[i] / CONSTANTS_RADIUS_OF_EARTH;
+		const double y_rad = (double)ys[i] / CONSTANTS_RADIUS_OF_EARTH;
+		const double c = sqrt(x_rad * x_rad + y_rad * y_rad);
+
+		if (fabs(c) > 0) {
+			const double sin_c = sin(c);
+			const double cos_c = cos(c);
+
+			const double lat_rad = asin(cos_c * ref_sin_lat + (x_rad * sin_c * ref_cos_lat) / c);
+			const double lon_rad = (ref_lon + atan2(y_rad * sin_c, c * ref_cos_lat * cos_c - x_rad * ref_sin_lat * sin_c));
+
+			lats[i] = math::degrees(lat_rad);
+			lons[i] = math::degrees(lon_rad);
+
+		} else {
+			lats[i] = math::degrees(ref_lat);
+			lons[i] = math::degrees(ref_lon);
+		}
+	}
+}
+
 float get_distance_to_next_waypoint(double lat_now, double lon_now, double lat_next, double lon_next)
 {
 	const double lat_now_rad = math::radians(lat_now);
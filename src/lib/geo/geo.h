@@ -46,6 +46,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <drivers/drv_hrt.h>
@@ -190,7 +191,7 @@ public:
 	/**
 	 * @brief Construct and initialize a new Map Projection object
 	 */
-	MapProjection(double lat_0, double lon_0, uint64_t timestamp)
+	constexpr MapProjection(double lat_0, double lon_0, uint64_t timestamp)
 	{
 		initReference(lat_0, lon_0, timestamp);
 	}
@@ -200,10 +201,21 @@ public:
 	 *
 	 * Initializes the transformation between the geographic coordinate system and
 	 * the azimuthal equidistant plane
+	 *
+	 * constexpr, so that a projection with a reference origin known at compile
+	 * time folds the sin/cos of the reference latitude into constants
 	 * @param lat in degrees (47.1234567°, not 471234567°)
 	 * @param lon in degrees (8.1234567°, not 81234567°)
 	 */
-	void initReference(double lat_0, double lon_0, uint64_t timestamp);
+	constexpr void initReference(double lat_0, double lon_0, uint64_t timestamp)
+	{
+		_ref_timestamp = timestamp;
+		_ref_lat = math::radians(lat_0);
+		_ref_lon = math::radians(lon_0);
+		_ref_sin_lat = sin(_ref_lat);
+		_ref_cos_lat = cos(_ref_lat);
+		_ref_init_done = true;
+	}
 
 	/**
 	 * Initialize the map transformation
@@ -272,4 +284,31 @@ public:
 	 * @param lon in degrees (8.1234567°, not 81234567°)
 	 */
 	void reproject(float x, float y, double &lat, double &lon) const;
+
+	/**
+	 * Transform an array of points in the geographic coordinate system to the
+	 * local azimuthal equidistant plane using the projection
+	 *
+	 * Batched version of project() for iterating over many waypoints or fence
+	 * vertices: the reference values are loaded once instead of per point.
+	 * @param lats latitudes in degrees (47.1234567°, not 471234567°)
+	 * @param lons longitudes in degrees (8.1234567°, not 81234567°)
+	 * @param xs north coordinates out
+	 * @param ys east coordinates out
+	 * @param count number of points
+	 */
+	void project(const double lats[], const double lons[], float xs[], float ys[], size_t count) const;
+
+	/**
+	 * Transform an array of points in the local azimuthal equidistant plane to
+	 * the geographic coordinate system using the projection
+	 *
+	 * Batched version of reproject() (@see project())
+	 * @param xs north coordinates
+	 * @param ys east coordinates
+	 * @param lats latitudes out in degrees (47.1234567°, not 471234567°)
+	 * @param lons longitudes out in degrees (8.1234567°, not 81234567°)
+	 * @param count number of points
+	 */
+	void reproject(const float xs[], const float ys[], double lats[], double lons[], size_t count) const;
 };
@@ -92,6 +92,36 @@ TEST_F(GeoTest, projectReproject)
 	EXPECT_FLOAT_EQ(lon, lon_new);
 }
 
+TEST_F(GeoTest, projectReprojectBatched)
+{
+	// GIVEN: a set of points around the reference
+	const double lats[4] = {47.3566, 47.3570, 47.3550, 47.3580};
+	const double lons[4] = {8.5190, 8.5200, 8.5180, 8.5210};
+	float xs[4];
+	float ys[4];
+	double lats_new[4];
+	double lons_new[4];
+
+	// WHEN: projecting and reprojecting them in one batch
+	proj.project(lats, lons, xs, ys, 4);
+	proj.reproject(xs, ys, lats_new, lons_new, 4);
+
+	// THEN: each point matches the result of the single-point API
+	for (int i = 0; i < 4; i++) {
+		float x;
+		float y;
+		proj.project(lats[i], lons[i], x, y);
+		EXPECT_FLOAT_EQ(xs[i], x);
+		EXPECT_FLOAT_EQ(ys[i], y);
+
+		double lat;
+		double lon;
+		proj.reproject(xs[i], ys[i], lat, lon);
+		EXPECT_DOUBLE_EQ(lats_new[i], lat);
+		EXPECT_DOUBLE_EQ(lons_new[i], lon);
+	}
+}
+
 TEST_F(GeoTest, waypoint_from_heading_and_zero_distance)
 {
 	// GIVEN: a starting waypoint, a heading and a distance of 0
@@ -92,19 +92,30 @@ ECL_L1_Pos_Controller::navigate_waypoints(const Vector2f &vector_A, const Vector
 	/* calculate the L1 length required for the desired period */
 	_L1_distance = _L1_ratio * ground_speed;
 
-	/* calculate vector from A to B */
-	Vector2f vector_AB = vector_B - vector_A;
+	/* calculate unit vector and length from A to B; the segment only changes on
+	 * waypoint advance, so the normalization is cached between calls */
+	if ((_segment_length < 0.0f)
+	    || (vector_A(0) != _segment_A(0)) || (vector_A(1) != _segment_A(1))
+	    || (vector_B(0) != _segment_B(0)) || (vector_B(1) != _segment_B(1))) {
+
+		_segment_A = vector_A;
+		_segment_B = vector_B;
+
+		const Vector2f vector_A_to_B = vector_B - vector_A;
+		_segment_length = vector_A_to_B.length();
+		_segment_unit = (_segment_length > 1.0e-6f) ? vector_A_to_B / _segment_length : Vector2f{};
+	}
+
+	Vector2f vector_AB = _segment_unit;
 
 	/*
 	 * check if waypoints are on top of each other. If yes,
 	 * skip A and directly continue to B
 	 */
-	if (vector_AB.length() < 1.0e-6f) {
-		vector_AB = vector_B - vector_curr_position;
+	if (_segment_length < 1.0e-6f) {
+		vector_AB = Vector2f(vector_B - vector_curr_position).normalized();
 	}
 
-	vector_AB.normalize();
-
 	/* calculate the vector from waypoint A to the aircraft */
 	Vector2f vector_A_to_airplane = vector_curr_position - vector_A;
 
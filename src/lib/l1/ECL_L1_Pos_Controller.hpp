@@ -222,6 +222,11 @@ private:
 	float _K_L1{2.0f};			///< L1 control gain for _L1_damping
 	float _heading_omega{1.0f};		///< Normalized frequency
 
+	matrix::Vector2f _segment_A{};		///< waypoint segment start the cached direction was computed for
+	matrix::Vector2f _segment_B{};		///< waypoint segment end the cached direction was computed for
+	matrix::Vector2f _segment_unit{};	///< cached unit vector from segment start to end
+	float _segment_length{-1.0f};		///< cached segment length in meters, -1 if nothing cached yet
+
 	float _roll_lim_rad{math::radians(30.0f)};  ///<maximum roll angle in radians
 	float _roll_setpoint{0.0f};	///< current roll angle setpoint in radians
 	float _roll_slew_rate{0.0f};	///< roll angle setpoint slew rate limit in rad/s
@@ -0,0 +1,94 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file LatencyTrace.hpp
+ *
+ * Distributed end-to-end latency tracing for the gyro to actuator output
+ * pipeline. Every pipeline message already carries the gyro sample timestamp
+ * in its timestamp_sample field, so that timestamp doubles as the trace
+ * token: each participating stage owns a LatencyTracePublisher and reports
+ * the elapsed time from the gyro sample to its own publication. Matching
+ * trace points by token in the flight log yields the per-hop deltas.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <uORB/Publication.hpp>
+#include <uORB/topics/latency_trace.h>
+
+namespace latency_trace
+{
+
+// Spacing between traced samples. Each stage derives the sampling decision
+// from the token alone, so all stages trace the same samples without any
+// extra fields in the pipeline messages.
+static constexpr hrt_abstime TRACE_INTERVAL_US = 100000;
+
+class LatencyTracePublisher
+{
+public:
+	/**
+	 * Record a trace point if the sample is selected for tracing.
+	 *
+	 * The first sample of every trace interval is published, all others are
+	 * ignored. Call this after publishing the stage's output.
+	 *
+	 * @param hop one of latency_trace_s::HOP_*
+	 * @param token gyro sample timestamp (timestamp_sample) of the processed data
+	 */
+	void publish(uint8_t hop, const hrt_abstime &token)
+	{
+		if (token / TRACE_INTERVAL_US == _last_interval) {
+			return;
+		}
+
+		_last_interval = token / TRACE_INTERVAL_US;
+
+		const hrt_abstime now = hrt_absolute_time();
+
+		latency_trace_s trace{};
+		trace.token = token;
+		trace.hop = hop;
+		trace.elapsed_us = (now > token) ? (now - token) : 0;
+		trace.timestamp = now;
+		_pub.publish(trace);
+	}
+
+private:
+	uORB::Publication<latency_trace_s> _pub{ORB_ID(latency_trace)};
+	uint64_t _last_interval{0};
+};
+
+} // namespace latency_trace
@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <lzss/lzss.h>
+
+#include <cstring>
+#include <vector>
+
+class LzssTest : public ::testing::Test
+{
+public:
+	std::vector<uint8_t> compress(const std::vector<uint8_t> &in, size_t out_max)
+	{
+		std::vector<uint8_t> out(out_max);
+		const size_t n = lzss::compress(in.data(), in.size(), out.data(), out.size(), _hash_table.data());
+		out.resize(n);
+		return out;
+	}
+
+	std::vector<uint8_t> decompress(const std::vector<uint8_t> &in, size_t out_max)
+	{
+		std::vector<uint8_t> out(out_max);
+		const size_t n = lzss::decompress(in.data(), in.size(), out.data(), out.size());
+		out.resize(n);
+		return out;
+	}
+
+private:
+	std::vector<uint16_t> _hash_table{std::vector<uint16_t>(lzss::HASH_TABLE_ENTRIES)};
+};
+
+TEST_F(LzssTest, roundTripRepetitiveData)
+{
+	// repeated message-like records, as found in a ulog data section
+	std::vector<uint8_t> in;
+
+	for (int i = 0; i < 100; i++) {
+		const uint8_t record[] = {0x20, 0x00, 'D', (uint8_t)(i & 3), 0x00, 0x12, 0x34, 0x56, 0x78,
+					  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, (uint8_t)i
+					 };
+		in.insert(in.end(), record, record + sizeof(record));
+	}
+
+	const std::vector<uint8_t> compressed = compress(in, in.size() - 1);
+	ASSERT_GT(compressed.size(), 0u);
+	EXPECT_LT(compressed.size(), in.size() / 2);
+
+	EXPECT_EQ(decompress(compressed, in.size()), in);
+}
+
+TEST_F(LzssTest, roundTripLongRuns)
+{
+	// runs longer than the maximum match length exercise overlapping copies
+	std::vector<uint8_t> in(1000, 0xaa);
+	in.resize(in.size() + 500, 0x55);
+
+	const std::vector<uint8_t> compressed = compress(in, in.size() - 1);
+	ASSERT_GT(compressed.size(), 0u);
+
+	EXPECT_EQ(decompress(compressed, in.size()), in);
+}
+
+TEST_F(LzssTest, incompressibleDataIsRejected)
+{
+	// pseudo-random bytes don't compress, so an output limit of in_len - 1 must fail
+	std::vector<uint8_t> in(4096);
+	uint32_t state = 12345;
+
+	for (auto &b : in) {
+		state = state * 1664525 + 1013904223;
+		b = (uint8_t)(state >> 24);
+	}
+
+	EXPECT_EQ(compress(in, in.size() - 1).size(), 0u);
+
+	// with enough output space the data still round trips
+	const std::vector<uint8_t> compressed = compress(in, 2 * in.size());
+	ASSERT_GT(compressed.size(), 0u);
+	EXPECT_EQ(decompress(compressed, in.size()), in);
+}
+
+TEST_F(LzssTest, corruptInputIsRejected)
+{
+	std::vector<uint8_t> in;
+
+	for (int i = 0; i < 200; i++) {
+		in.push_back((uint8_t)(i & 7));
+	}
+
+	std::vector<uint8_t> compressed = compress(in, in.size() - 1);
+	ASSERT_GT(compressed.size(), 2u);
+
+	// a match token pointing before the start of the output must be detected
+	compressed[0] = 0x01; // first item is a match
+	compressed[1] = 0xff;
+	compressed[2] = 0x07; // maximum distance, nothing decompressed yet
+
+	EXPECT_EQ(decompress(compressed, in.size()).size(), 0u);
+
+	// output that would exceed the expected size must be detected as well
+	const std::vector<uint8_t> valid = compress(in, in.size() - 1);
+	EXPECT_EQ(decompress(valid, in.size() / 2).size(), 0u);
+}
+
+TEST_F(LzssTest, emptyInput)
+{
+	EXPECT_EQ(compress({}, 16).size(), 0u);
+	EXPECT_EQ(decompress({}, 16).size(), 0u);
+}
@@ -0,0 +1,168 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "lzss.h"
+
+#include <string.h>
+
+namespace lzss
+{
+
+static constexpr uint16_t INVALID_POS = 0xffff;
+
+/** hash the next 3 input bytes into a hash table index */
+static inline uint32_t hash3(const uint8_t *p)
+{
+	const uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
+	return (v * 2654435761u) >> (32u - 11u); // 11 bits -> HASH_TABLE_ENTRIES
+}
+
+size_t compress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_max, uint16_t *hash_table)
+{
+	if (in_len == 0 || in_len >= INVALID_POS) {
+		return 0;
+	}
+
+	memset(hash_table, 0xff, HASH_TABLE_ENTRIES * sizeof(uint16_t));
+
+	size_t ip = 0;
+	size_t op = 0;
+
+	size_t flag_pos = 0;
+	unsigned flag_bit = 8; // force a new flag byte on the first item
+
+	while (ip < in_len) {
+		if (flag_bit == 8) {
+			if (op >= out_max) {
+				return 0;
+			}
+
+			flag_pos = op;
+			out[op++] = 0;
+			flag_bit = 0;
+		}
+
+		size_t match_len = 0;
+		size_t match_pos = 0;
+
+		if (ip + MIN_MATCH <= in_len) {
+			// single-candidate hash chain: check only the most recent position
+			// with the same 3-byte prefix, which keeps the search O(1) per byte
+			const uint32_t h = hash3(&in[ip]);
+			const uint16_t candidate = hash_table[h];
+			hash_table[h] = (uint16_t)ip;
+
+			if ((candidate != INVALID_POS) && (candidate < ip) && (ip - candidate <= WINDOW_SIZE)) {
+				const size_t max_len = (in_len - ip < MAX_MATCH) ? in_len - ip : MAX_MATCH;
+				size_t len = 0;
+
+				while ((len < max_len) && (in[candidate + len] == in[ip + len])) {
+					++len;
+				}
+
+				if (len >= MIN_MATCH) {
+					match_len = len;
+					match_pos = candidate;
+				}
+			}
+		}
+
+		if (match_len > 0) {
+			if (op + 2 > out_max) {
+				return 0;
+			}
+
+			const uint16_t token = (uint16_t)((ip - match_pos - 1) | ((match_len - MIN_MATCH) << 11));
+			out[op++] = (uint8_t)(token & 0xff);
+			out[op++] = (uint8_t)(token >> 8);
+			out[flag_pos] |= (uint8_t)(1u << flag_bit);
+			ip += match_len;
+
+		} else {
+			if (op >= out_max) {
+				return 0;
+			}
+
+			out[op++] = in[ip++];
+		}
+
+		++flag_bit;
+	}
+
+	return op;
+}
+
+size_t decompress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_max)
+{
+	size_t ip = 0;
+	size_t op = 0;
+
+	while (ip < in_len) {
+		const uint8_t flags = in[ip++];
+
+		for (unsigned flag_bit = 0; (flag_bit < 8) && (ip < in_len); ++flag_bit) {
+			if (flags & (1u << flag_bit)) {
+				if (ip + 2 > in_len) {
+					return 0;
+				}
+
+				const uint16_t token = in[ip] | (in[ip + 1] << 8);
+				ip += 2;
+
+				const size_t distance = (size_t)(token & (WINDOW_SIZE - 1)) + 1;
+				const size_t len = (size_t)(token >> 11) + MIN_MATCH;
+
+				if ((distance > op) || (op + len > out_max)) {
+					return 0;
+				}
+
+				// byte-wise copy: source and destination may overlap for short distances
+				for (size_t i = 0; i < len; ++i) {
+					out[op] = out[op - distance];
+					++op;
+				}
+
+			} else {
+				if (op >= out_max) {
+					return 0;
+				}
+
+				out[op++] = in[ip++];
+			}
+		}
+	}
+
+	return op;
+}
+
+} // namespace lzss
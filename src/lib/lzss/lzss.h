@@ -0,0 +1,84 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file lzss.h
+ *
+ * Small byte-oriented LZSS codec for compressing log data chunks on the flight
+ * controller. Each call compresses one chunk independently (no state is carried
+ * between chunks), so a reader can resynchronize at any chunk boundary.
+ *
+ * The format is a flag byte followed by up to 8 items, LSB first: a cleared
+ * flag bit is a literal byte, a set bit is a 16-bit little-endian match token
+ * with an 11-bit backwards distance and a 5-bit length.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace lzss
+{
+
+static constexpr size_t WINDOW_SIZE = 2048; ///< maximum match distance (11 bits)
+static constexpr size_t MIN_MATCH = 3;
+static constexpr size_t MAX_MATCH = MIN_MATCH + 31; ///< 5-bit match length
+
+/** number of uint16_t entries the caller must provide as match-search scratch */
+static constexpr size_t HASH_TABLE_ENTRIES = 2048;
+
+/**
+ * Compress a chunk of data.
+ * @param in input data
+ * @param in_len input length in bytes (must be < 65536)
+ * @param out output buffer
+ * @param out_max output buffer size; compression is abandoned when the output
+ *        would exceed this, so pass in_len - 1 to only accept a net gain
+ * @param hash_table caller-provided scratch of HASH_TABLE_ENTRIES uint16_t's
+ *        (too large for the stack of small NuttX tasks)
+ * @return number of bytes written to out, or 0 if the data does not fit in out_max
+ */
+size_t compress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_max, uint16_t *hash_table);
+
+/**
+ * Decompress a chunk previously produced by compress().
+ * @param in compressed data
+ * @param in_len compressed length in bytes
+ * @param out output buffer
+ * @param out_max output buffer size (the expected uncompressed size)
+ * @return number of bytes written to out, or 0 if the input is corrupt or out_max is exceeded
+ */
+size_t decompress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_max);
+
+} // namespace lzss
@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file Kernels.hpp
+ *
+ * Consolidated hot-path numeric kernels shared by the controllers.
+ *
+ * The same few numeric patterns recur across the rate, attitude and position
+ * controllers and the estimators. Each kernel here is a single-pass scalar
+ * loop whose intermediate terms stay in FPU registers (and which the compiler
+ * can auto-vectorize on targets that support it), so an optimization lands
+ * once and every caller inherits it. KernelsTest.cpp pins the results to the
+ * generic matrix-lib formulations and the microbench matrix target tracks
+ * their cost.
+ */
+
+#pragma once
+
+#include <matrix/math.hpp>
+
+namespace math
+{
+namespace kernels
+{
+
+/**
+ * Single-pass 3-axis PID update with feed forward.
+ *
+ * out(i) = gain_p(i) * error(i) + integral(i) - gain_d(i) * derivative(i) + gain_ff(i) * setpoint(i)
+ *
+ * Evaluated per axis in one pass, so no Vector3f temporary is materialized
+ * per term as with the equivalent emult() expression.
+ */
+inline matrix::Vector3f pid3(const matrix::Vector3f &error, const matrix::Vector3f &integral,
+			     const matrix::Vector3f &derivative, const matrix::Vector3f &setpoint,
+			     const matrix::Vector3f &gain_p, const matrix::Vector3f &gain_d,
+			     const matrix::Vector3f &gain_ff)
+{
+	matrix::Vector3f out;
+
+	for (int i = 0; i < 3; i++) {
+		out(i) = gain_p(i) * error(i) + integral(i) - gain_d(i) * derivative(i) + gain_ff(i) * setpoint(i);
+	}
+
+	return out;
+}
+
+/**
+ * One step of a first-order low-pass on a 3-vector, in place.
+ *
+ * state += alpha * (sample - state) -- the AlphaFilter update without the
+ * per-instance class.
+ */
+inline void lowpass3(matrix::Vector3f &state, const matrix::Vector3f &sample, float alpha)
+{
+	for (int i = 0; i < 3; i++) {
+		state(i) += alpha * (sample(i) - state(i));
+	}
+}
+
+/**
+ * One step of a chain of N identical first-order low-pass sections on a 3-vector.
+ *
+ * The output of each section feeds the next; states[N - 1] is the chain output.
+ */
+template<unsigned N>
+inline void lowpass_chain3(matrix::Vector3f (&states)[N], const matrix::Vector3f &sample, float alpha)
+{
+	const matrix::Vector3f *in = &sample;
+
+	for (unsigned s = 0; s < N; s++) {
+		lowpass3(states[s], *in, alpha);
+		in = &states[s];
+	}
+}
+
+/**
+ * Wrap an angle to [-pi, pi), optimized for inputs within one turn of the range.
+ *
+ * Controller error signals are the difference of two wrapped angles and
+ * therefore always within (-2pi, 2pi), where a single conditional add
+ * replaces the iteration in matrix::wrap_pi(). Inputs farther out (and
+ * non-finite values) fall back to the generic version.
+ */
+inline float wrap_pi_fast(float angle)
+{
+	if (angle >= float(M_PI)) {
+		angle -= 2.f * float(M_PI);
+
+	} else if (angle < -float(M_PI)) {
+		angle += 2.f * float(M_PI);
+	}
+
+	if (angle >= -float(M_PI) && angle < float(M_PI)) {
+		return angle;
+	}
+
+	return matrix::wrap_pi(angle);
+}
+
+} // namespace kernels
+} // namespace math
@@ -63,6 +63,31 @@ public:
 		_M2 = matrix::max(_M2, {});
 	}
 
+	// Combine the statistics of another accumulator into this one (Chan et al.
+	// parallel algorithm), as if all its samples had been added here
+	void merge(const WelfordMean &other)
+	{
+		if (other._count == 0) {
+			return;
+		}
+
+		if (_count == 0) {
+			*this = other;
+			return;
+		}
+
+		const matrix::Vector<Type, N> delta{other._mean - _mean};
+		const unsigned total = _count + other._count;
+
+		_mean += delta * ((Type)other._count / (Type)total);
+		_M2 += other._M2 + delta.emult(delta) * ((Type)_count * (Type)other._count / (Type)total);
+
+		// protect against floating point precision causing negative variances
+		_M2 = matrix::max(_M2, {});
+
+		_count = total;
+	}
+
 	bool valid() const { return _count > 2; }
 	unsigned count() const { return _count; }
 
@@ -64,3 +64,42 @@ TEST(WelfordMeanTest, NoisySignal)
 	EXPECT_NEAR(var(1), var_real, 0.1f);
 	EXPECT_NEAR(var(2), var_real, 0.1f);
 }
+
+TEST(WelfordMeanTest, Merge)
+{
+	std::normal_distribution<float> standard_normal_distribution{0.f, 3.f};
+	std::default_random_engine random_generator{}; // Pseudo-random generator with constant seed
+	random_generator.seed(42);
+
+	WelfordMean<float, 3> all{};
+	WelfordMean<float, 3> first{};
+	WelfordMean<float, 3> second{};
+
+	for (int i = 0; i < 80; i++) {
+		const float noisy_value = standard_normal_distribution(random_generator);
+		const Vector3f value{noisy_value, noisy_value - 1.f, noisy_value + 1.f};
+		all.update(value);
+
+		if (i < 50) {
+			first.update(value);
+
+		} else {
+			second.update(value);
+		}
+	}
+
+	// merging into an empty accumulator copies the statistics
+	WelfordMean<float, 3> merged{};
+	merged.merge(first);
+	merged.merge(second);
+
+	// merging an empty accumulator changes nothing
+	merged.merge(WelfordMean<float, 3> {});
+
+	EXPECT_EQ(merged.count(), all.count());
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_NEAR(merged.mean()(i), all.mean()(i), 1e-5f);
+		EXPECT_NEAR(merged.variance()(i), all.variance()(i), 1e-4f);
+	}
+}
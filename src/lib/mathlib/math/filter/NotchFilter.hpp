@@ -82,9 +82,40 @@ public:
 			_initialized = true;
 		}
 
+		// copy state and coefficients to locals so that the compiler can keep them in
+		// registers across the loop (samples[] may alias the members)
+		const float a1{_a1};
+		const float a2{_a2};
+		const float b0{_b0};
+		const float b1{_b1};
+		const float b2{_b2};
+
+		T delay_element_1{_delay_element_1};
+		T delay_element_2{_delay_element_2};
+		T delay_element_output_1{_delay_element_output_1};
+		T delay_element_output_2{_delay_element_output_2};
+
 		for (int n = 0; n < num_samples; n++) {
-			samples[n] = applyInternal(samples[n]);
+			const T sample{samples[n]};
+
+			const T output = b0 * sample + b1 * delay_element_1 + b2 * delay_element_2 - a1 * delay_element_output_1 - a2 *
+					 delay_element_output_2;
+
+			// shift inputs
+			delay_element_2 = delay_element_1;
+			delay_element_1 = sample;
+
+			// shift outputs
+			delay_element_output_2 = delay_element_output_1;
+			delay_element_output_1 = output;
+
+			samples[n] = output;
 		}
+
+		_delay_element_1 = delay_element_1;
+		_delay_element_2 = delay_element_2;
+		_delay_element_output_1 = delay_element_output_1;
+		_delay_element_output_2 = delay_element_output_2;
 	}
 
 	float getNotchFreq() const { return _notch_freq; }
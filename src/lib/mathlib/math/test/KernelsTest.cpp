@@ -0,0 +1,111 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file KernelsTest.cpp
+ *
+ * @brief Unit tests pinning the hot-path kernels to the generic matrix-lib formulations
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <matrix/math.hpp>
+
+#include <lib/mathlib/math/Kernels.hpp>
+#include <lib/mathlib/math/filter/AlphaFilter.hpp>
+
+using namespace matrix;
+
+TEST(KernelsTest, Pid3MatchesVectorExpression)
+{
+	const Vector3f error(0.3f, -1.2f, 0.05f);
+	const Vector3f integral(-0.01f, 0.04f, 0.2f);
+	const Vector3f derivative(2.5f, -0.7f, 0.f);
+	const Vector3f setpoint(1.f, 0.5f, -0.25f);
+	const Vector3f gain_p(0.15f, 0.2f, 0.1f);
+	const Vector3f gain_d(0.003f, 0.004f, 0.f);
+	const Vector3f gain_ff(0.05f, 0.f, 0.3f);
+
+	const Vector3f out = math::kernels::pid3(error, integral, derivative, setpoint, gain_p, gain_d, gain_ff);
+	const Vector3f reference = gain_p.emult(error) + integral - gain_d.emult(derivative) + gain_ff.emult(setpoint);
+
+	EXPECT_TRUE(isEqual(out, reference));
+}
+
+TEST(KernelsTest, Lowpass3MatchesAlphaFilter)
+{
+	AlphaFilter<Vector3f> reference_filter;
+	reference_filter.setAlpha(0.1f);
+
+	Vector3f state{};
+
+	for (int i = 0; i < 100; i++) {
+		const Vector3f sample(sinf(0.1f * i), cosf(0.2f * i), 0.5f * i);
+
+		math::kernels::lowpass3(state, sample, 0.1f);
+		reference_filter.update(sample);
+
+		EXPECT_TRUE(isEqual(state, reference_filter.getState()));
+	}
+}
+
+TEST(KernelsTest, LowpassChainCascades)
+{
+	Vector3f chain[3] {};
+	Vector3f sections[3] {};
+
+	for (int i = 0; i < 100; i++) {
+		const Vector3f sample(sinf(0.3f * i), -1.f + 0.02f * i, cosf(0.05f * i));
+
+		math::kernels::lowpass_chain3(chain, sample, 0.25f);
+
+		// reference: three independent sections applied in series
+		math::kernels::lowpass3(sections[0], sample, 0.25f);
+		math::kernels::lowpass3(sections[1], sections[0], 0.25f);
+		math::kernels::lowpass3(sections[2], sections[1], 0.25f);
+
+		EXPECT_TRUE(isEqual(chain[2], sections[2]));
+	}
+}
+
+TEST(KernelsTest, WrapPiFastMatchesWrapPi)
+{
+	// the fast path covers (-2pi, 2pi), the sweep extends well beyond to hit the fallback
+	for (float angle = -20.f; angle < 20.f; angle += 0.01f) {
+		const float wrapped = math::kernels::wrap_pi_fast(angle);
+
+		EXPECT_NEAR(wrapped, matrix::wrap_pi(angle), 1e-5f) << "angle: " << angle;
+		EXPECT_GE(wrapped, -float(M_PI));
+		EXPECT_LT(wrapped, float(M_PI));
+	}
+}
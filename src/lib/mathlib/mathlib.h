@@ -43,6 +43,7 @@
 
 #include "math/Limits.hpp"
 #include "math/Functions.hpp"
+#include "math/Kernels.hpp"
 #include "math/SearchMin.hpp"
 #include "math/TrajMath.hpp"
 #include "math/Utilities.hpp"
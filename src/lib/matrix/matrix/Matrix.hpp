@@ -17,6 +17,12 @@
 #include <iomanip>
 #endif // defined(SUPPORT_STDIOSTREAM)
 
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
 #include "math.hpp"
 
 namespace matrix
@@ -152,10 +158,84 @@ public:
 		const Matrix<Type, M, N> &self = *this;
 		Matrix<Type, M, P> res{};
 
+		// accumulate into the result row by row: the inner loop walks both the
+		// result and the other matrix with unit stride, which the compiler can
+		// vectorize (the classic i-k-j order strides through other column-wise)
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j < N; j++) {
+				const Type self_ij = self(i, j);
+
+				for (size_t k = 0; k < P; k++) {
+					res(i, k) += self_ij * other(j, k);
+				}
+			}
+		}
+
+		return res;
+	}
+
+	/**
+	 * Fused multiply-accumulate: this += a * b
+	 *
+	 * Computes the product directly into this matrix instead of materializing
+	 * it in a temporary first, so compound expressions like covariance updates
+	 * compile into a single loop nest. This matrix must not alias a or b.
+	 */
+	template<size_t P>
+	void multiplyAccumulate(const Matrix<Type, M, P> &a, const Matrix<Type, P, N> &b)
+	{
+		Matrix<Type, M, N> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t k = 0; k < N; k++) {
+				Type acc = self(i, k);
+
+				for (size_t j = 0; j < P; j++) {
+					acc += a(i, j) * b(j, k);
+				}
+
+				self(i, k) = acc;
+			}
+		}
+	}
+
+	/**
+	 * Fused multiply-subtract: this -= a * b
+	 *
+	 * Counterpart of multiplyAccumulate() for expressions like P - K * HP.
+	 * This matrix must not alias a or b.
+	 */
+	template<size_t P>
+	void multiplySubtract(const Matrix<Type, M, P> &a, const Matrix<Type, P, N> &b)
+	{
+		Matrix<Type, M, N> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t k = 0; k < N; k++) {
+				Type acc = self(i, k);
+
+				for (size_t j = 0; j < P; j++) {
+					acc -= a(i, j) * b(j, k);
+				}
+
+				self(i, k) = acc;
+			}
+		}
+	}
+
+	/**
+	 * this * other^T without materializing the transposed matrix
+	 */
+	template<size_t P>
+	Matrix<Type, M, P> multiplyByTranspose(const Matrix<Type, P, N> &other) const
+	{
+		const Matrix<Type, M, N> &self = *this;
+		Matrix<Type, M, P> res{};
+
 		for (size_t i = 0; i < M; i++) {
 			for (size_t k = 0; k < P; k++) {
 				for (size_t j = 0; j < N; j++) {
-					res(i, k) += self(i, j) * other(j, k);
+					res(i, k) += self(i, j) * other(k, j);
 				}
 			}
 		}
@@ -596,6 +676,56 @@ public:
 	}
 };
 
+#if defined(__ARM_NEON)
+
+// hand-vectorized kernel for the dominant 4x4 float multiply: broadcast each
+// element of a row and fuse multiply-add over whole rows of the other matrix.
+// The generic loop remains the reference implementation for all other shapes.
+template<> template<>
+inline Matrix<float, 4, 4> Matrix<float, 4, 4>::operator*(const Matrix<float, 4, 4> &other) const
+{
+	Matrix<float, 4, 4> res;
+	const float32x4_t b0 = vld1q_f32(other._data[0]);
+	const float32x4_t b1 = vld1q_f32(other._data[1]);
+	const float32x4_t b2 = vld1q_f32(other._data[2]);
+	const float32x4_t b3 = vld1q_f32(other._data[3]);
+
+	for (size_t i = 0; i < 4; i++) {
+		float32x4_t r = vmulq_n_f32(b0, _data[i][0]);
+		r = vmlaq_n_f32(r, b1, _data[i][1]);
+		r = vmlaq_n_f32(r, b2, _data[i][2]);
+		r = vmlaq_n_f32(r, b3, _data[i][3]);
+		vst1q_f32(res._data[i], r);
+	}
+
+	return res;
+}
+
+#elif defined(__SSE__)
+
+// SSE variant of the 4x4 float kernel above (SITL and Linux x86 boards)
+template<> template<>
+inline Matrix<float, 4, 4> Matrix<float, 4, 4>::operator*(const Matrix<float, 4, 4> &other) const
+{
+	Matrix<float, 4, 4> res;
+	const __m128 b0 = _mm_loadu_ps(other._data[0]);
+	const __m128 b1 = _mm_loadu_ps(other._data[1]);
+	const __m128 b2 = _mm_loadu_ps(other._data[2]);
+	const __m128 b3 = _mm_loadu_ps(other._data[3]);
+
+	for (size_t i = 0; i < 4; i++) {
+		__m128 r = _mm_mul_ps(b0, _mm_set1_ps(_data[i][0]));
+		r = _mm_add_ps(r, _mm_mul_ps(b1, _mm_set1_ps(_data[i][1])));
+		r = _mm_add_ps(r, _mm_mul_ps(b2, _mm_set1_ps(_data[i][2])));
+		r = _mm_add_ps(r, _mm_mul_ps(b3, _mm_set1_ps(_data[i][3])));
+		_mm_storeu_ps(res._data[i], r);
+	}
+
+	return res;
+}
+
+#endif // __ARM_NEON / __SSE__
+
 template<typename Type, size_t M, size_t N>
 Matrix<Type, M, N> zeros()
 {
@@ -487,10 +487,13 @@ public:
 	 */
 	Vector3<Type> rotateVector(const Vector3<Type> &vec) const
 	{
+		// Rodrigues form of q * v * q^-1: two cross products instead of two
+		// full quaternion products. The division by the squared norm keeps it
+		// exact for non-normalized quaternions, like the quaternion products.
 		const Quaternion &q = *this;
-		Quaternion v(Type(0), vec(0), vec(1), vec(2));
-		Quaternion res = q * v * q.inversed();
-		return Vector3<Type>(res(1), res(2), res(3));
+		const Vector3<Type> qv(q(1), q(2), q(3));
+		const Vector3<Type> t = qv % vec;
+		return vec + (t * q(0) + (qv % t)) * (Type(2) / q.norm_squared());
 	}
 
 	/**
@@ -504,10 +507,11 @@ public:
 	 */
 	Vector3<Type> rotateVectorInverse(const Vector3<Type> &vec) const
 	{
+		// Rodrigues form of q^-1 * v * q (@see rotateVector())
 		const Quaternion &q = *this;
-		Quaternion v(Type(0), vec(0), vec(1), vec(2));
-		Quaternion res = q.inversed() * v * q;
-		return Vector3<Type>(res(1), res(2), res(3));
+		const Vector3<Type> qv(q(1), q(2), q(3));
+		const Vector3<Type> t = qv % vec;
+		return vec + ((qv % t) - t * q(0)) * (Type(2) / q.norm_squared());
 	}
 
 	/**
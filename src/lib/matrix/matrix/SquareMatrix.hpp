@@ -138,6 +138,25 @@ public:
 		return res;
 	}
 
+	/**
+	 * Symmetric rank-1 update: this += scale * v * v^T
+	 *
+	 * Only the upper triangle is computed and then mirrored, so the matrix
+	 * stays exactly symmetric and no temporary outer product is materialized.
+	 */
+	void rankUpdate(const Vector<Type, M> &v, Type scale = Type(1))
+	{
+		SquareMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				const Type res = self(i, j) + scale * v(i) * v(j);
+				self(i, j) = res;
+				self(j, i) = res;
+			}
+		}
+	}
+
 	// zero all offdiagonal elements and keep corresponding diagonal elements
 	template <size_t Width>
 	void uncorrelateCovariance(size_t first)
@@ -0,0 +1,283 @@
+/**
+ * @file SymmetricMatrix.hpp
+ *
+ * A symmetric square matrix with packed triangular storage: only the upper
+ * right triangle is stored, halving the memory footprint compared to a
+ * SquareMatrix of the same size. Intended for covariance matrices, where the
+ * reduced working-set size matters for cache residency.
+ */
+
+#pragma once
+
+#include "math.hpp"
+
+namespace matrix
+{
+
+template <typename Type, size_t M, size_t N>
+class Matrix;
+
+template <typename Type, size_t M>
+class Vector;
+
+template <typename Type, size_t  M>
+class SymmetricMatrix
+{
+	// packed upper right triangle, row-major (same ordering as
+	// SquareMatrix::upper_right_triangle())
+	Type _data[M * (M + 1) / 2] {};
+
+	static size_t packedIndex(size_t i, size_t j)
+	{
+		if (i > j) {
+			const size_t tmp = i;
+			i = j;
+			j = tmp;
+		}
+
+		// row i starts after the i preceding (shrinking) rows
+		return i * M - i * (i - 1) / 2 + (j - i);
+	}
+
+public:
+	SymmetricMatrix() = default;
+
+	explicit SymmetricMatrix(const Type data_[M * (M + 1) / 2])
+	{
+		for (size_t i = 0; i < M * (M + 1) / 2; i++) {
+			_data[i] = data_[i];
+		}
+	}
+
+	// takes the upper right triangle, the lower left one is ignored
+	explicit SymmetricMatrix(const Matrix<Type, M, M> &other)
+	{
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				_data[packedIndex(i, j)] = other(i, j);
+			}
+		}
+	}
+
+	/**
+	 * Accessors/ Assignment etc.
+	 */
+
+	inline const Type &operator()(size_t i, size_t j) const
+	{
+		assert(i < M);
+		assert(j < M);
+
+		return _data[packedIndex(i, j)];
+	}
+
+	// both (i, j) and (j, i) refer to the same stored element, so writes
+	// through this reference cannot break the symmetry
+	inline Type &operator()(size_t i, size_t j)
+	{
+		assert(i < M);
+		assert(j < M);
+
+		return _data[packedIndex(i, j)];
+	}
+
+	// expand into a full square row-major array
+	void copyTo(Type dst[M * M]) const
+	{
+		const SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j < M; j++) {
+				dst[M * i + j] = self(i, j);
+			}
+		}
+	}
+
+	SquareMatrix<Type, M> squareMatrix() const
+	{
+		SquareMatrix<Type, M> res;
+		const SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				res(i, j) = res(j, i) = self(i, j);
+			}
+		}
+
+		return res;
+	}
+
+	// dense copy of a sub-block, mirroring the Matrix::slice() call sites
+	template<size_t P, size_t Q>
+	Matrix<Type, P, Q> slice(size_t x0, size_t y0) const
+	{
+		assert(x0 + P <= M);
+		assert(y0 + Q <= M);
+
+		const SymmetricMatrix<Type, M> &self = *this;
+		Matrix<Type, P, Q> res;
+
+		for (size_t i = 0; i < P; i++) {
+			for (size_t j = 0; j < Q; j++) {
+				res(i, j) = self(x0 + i, y0 + j);
+			}
+		}
+
+		return res;
+	}
+
+	Vector<Type, M> diag() const
+	{
+		Vector<Type, M> res;
+		const SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			res(i) = self(i, i);
+		}
+
+		return res;
+	}
+
+	Type trace() const
+	{
+		Type res = 0;
+		const SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			res += self(i, i);
+		}
+
+		return res;
+	}
+
+	void setZero()
+	{
+		memset(_data, 0, sizeof(_data));
+	}
+
+	inline void zero()
+	{
+		setZero();
+	}
+
+	void setAll(Type val)
+	{
+		for (size_t i = 0; i < M * (M + 1) / 2; i++) {
+			_data[i] = val;
+		}
+	}
+
+	void setIdentity()
+	{
+		setZero();
+		SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			self(i, i) = 1;
+		}
+	}
+
+	inline void identity()
+	{
+		setIdentity();
+	}
+
+	void operator+=(const SymmetricMatrix<Type, M> &other)
+	{
+		for (size_t i = 0; i < M * (M + 1) / 2; i++) {
+			_data[i] += other._data[i];
+		}
+	}
+
+	void operator-=(const SymmetricMatrix<Type, M> &other)
+	{
+		for (size_t i = 0; i < M * (M + 1) / 2; i++) {
+			_data[i] -= other._data[i];
+		}
+	}
+
+	void operator*=(Type scalar)
+	{
+		for (size_t i = 0; i < M * (M + 1) / 2; i++) {
+			_data[i] *= scalar;
+		}
+	}
+
+	bool operator==(const SymmetricMatrix<Type, M> &other) const
+	{
+		for (size_t i = 0; i < M * (M + 1) / 2; i++) {
+			if (!isEqualF(_data[i], other._data[i])) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool operator!=(const SymmetricMatrix<Type, M> &other) const
+	{
+		return !(*this == other);
+	}
+
+	/**
+	 * Fusion-oriented operations
+	 */
+
+	// this * v, e.g. P * H^T for a sparse observation
+	Vector<Type, M> operator*(const Vector<Type, M> &v) const
+	{
+		const SymmetricMatrix<Type, M> &self = *this;
+		Vector<Type, M> res;
+
+		for (size_t i = 0; i < M; i++) {
+			Type acc = Type(0);
+
+			for (size_t j = 0; j < M; j++) {
+				acc += self(i, j) * v(j);
+			}
+
+			res(i) = acc;
+		}
+
+		return res;
+	}
+
+	// v^T * this * v, e.g. the innovation variance H * P * H^T
+	Type quadraticForm(const Vector<Type, M> &v) const
+	{
+		const SymmetricMatrix<Type, M> &self = *this;
+		Type res = Type(0);
+
+		// the off-diagonal terms appear twice with the same value
+		for (size_t i = 0; i < M; i++) {
+			res += self(i, i) * v(i) * v(i);
+
+			for (size_t j = i + 1; j < M; j++) {
+				res += Type(2) * self(i, j) * v(i) * v(j);
+			}
+		}
+
+		return res;
+	}
+
+	/**
+	 * Symmetric rank-1 update: this += scale * v * v^T
+	 *
+	 * Only the stored triangle is touched, so the update runs on half the
+	 * elements of the SquareMatrix equivalent and cannot break symmetry.
+	 */
+	void rankUpdate(const Vector<Type, M> &v, Type scale = Type(1))
+	{
+		SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				self(i, j) += scale * v(i) * v(j);
+			}
+		}
+	}
+};
+
+using SymmetricMatrix3f = SymmetricMatrix<float, 3>;
+
+} // namespace matrix
@@ -6,6 +6,7 @@
 
 #include "Matrix.hpp"
 #include "SquareMatrix.hpp"
+#include "SymmetricMatrix.hpp"
 #include "Slice.hpp"
 #include "Vector.hpp"
 #include "Vector2.hpp"
@@ -98,3 +98,68 @@ TEST(MatrixMultiplicationTest, Multiplication)
 	Matrix<float, 4, 2> m42_plus2 = m42 - (-2);
 	EXPECT_EQ(m42_plus2, m42_plus2_check);
 }
+
+TEST(MatrixMultiplicationTest, Multiplication4x4Kernel)
+{
+	// operator* may use a vectorized kernel for the 4x4 float shape:
+	// check it against a plainly written scalar reference
+	float data_a[16] = {1, 2, 3, 4,
+			    5, 6, 7, 8,
+			    9, 10, 11, 12,
+			    13, 14, 15, 16
+			   };
+	float data_b[16] = {16, 15, 14, 13,
+			    12, 11, 10, 9,
+			    8, 7, 6, 5,
+			    4, 3, 2, 1
+			   };
+	Matrix<float, 4, 4> A(data_a);
+	Matrix<float, 4, 4> B(data_b);
+
+	Matrix<float, 4, 4> ref;
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t k = 0; k < 4; k++) {
+			for (size_t j = 0; j < 4; j++) {
+				ref(i, k) += A(i, j) * B(j, k);
+			}
+		}
+	}
+
+	EXPECT_EQ(A * B, ref);
+}
+
+TEST(MatrixMultiplicationTest, FusedMultiplication)
+{
+	float data_43[12] = {1, 3, 2,
+			     2, 2, 1,
+			     5, 2, 1,
+			     2, 3, 4
+			    };
+	float data_32[6] = {2, 3,
+			    1, 7,
+			    5, 4
+			   };
+
+	Matrix<float, 4, 3> m43(data_43);
+	Matrix<float, 3, 2> m32(data_32);
+
+	// fused accumulate matches the unfused expression
+	Matrix<float, 4, 2> acc;
+	acc.setAll(1.f);
+	Matrix<float, 4, 2> acc_check = acc + m43 * m32;
+	acc.multiplyAccumulate(m43, m32);
+	EXPECT_EQ(acc, acc_check);
+
+	// fused subtract matches the unfused expression
+	Matrix<float, 4, 2> sub;
+	sub.setAll(1.f);
+	Matrix<float, 4, 2> sub_check = sub - m43 * m32;
+	sub.multiplySubtract(m43, m32);
+	EXPECT_EQ(sub, sub_check);
+
+	// multiplication by a transpose without materializing it
+	Matrix<float, 2, 3> m23 = m32.transpose();
+	Matrix<float, 4, 2> mt = m43.multiplyByTranspose(m23);
+	EXPECT_EQ(mt, m43 * m32);
+}
@@ -175,3 +175,27 @@ TEST(MatrixSquareTest, Square)
 	SquareMatrix<float, 4> K(data_K);
 	EXPECT_FALSE(K.isRowColSymmetric<1>(2));
 }
+
+TEST(MatrixSquareTest, RankUpdate)
+{
+	float data[9] = {1, 2, 3,
+			 2, 4, 5,
+			 3, 5, 6
+			};
+	SquareMatrix<float, 3> P(data);
+
+	const Vector3f v(1.f, -2.f, 3.f);
+	const float scale = 0.5f;
+
+	const Matrix<float, 3, 1> v_mat = v;
+	SquareMatrix<float, 3> P_check = P + (v_mat * v_mat.transpose()) * scale;
+	P.rankUpdate(v, scale);
+	EXPECT_EQ(P, P_check);
+
+	// the result stays exactly symmetric
+	for (size_t i = 0; i < 3; i++) {
+		for (size_t j = 0; j < 3; j++) {
+			EXPECT_EQ(P(i, j), P(j, i));
+		}
+	}
+}
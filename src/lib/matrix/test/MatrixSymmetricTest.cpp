@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+TEST(MatrixSymmetricTest, PackedStorage)
+{
+	float data[9] = {1, 2, 3,
+			 2, 4, 5,
+			 3, 5, 6
+			};
+	SquareMatrix<float, 3> square(data);
+	SymmetricMatrix<float, 3> sym(square);
+
+	// half the dense storage
+	static_assert(sizeof(sym) == 6 * sizeof(float), "packed storage expected");
+
+	// (i, j) and (j, i) refer to the same element
+	for (size_t i = 0; i < 3; i++) {
+		for (size_t j = 0; j < 3; j++) {
+			EXPECT_EQ(sym(i, j), square(i, j));
+			EXPECT_EQ(sym(i, j), sym(j, i));
+		}
+	}
+
+	// writes through either index keep the matrix symmetric
+	sym(2, 0) = 10.f;
+	EXPECT_EQ(sym(0, 2), 10.f);
+
+	// construction from the packed triangle of a square matrix
+	float packed[6];
+	square.upper_right_triangle().copyTo(packed);
+	SymmetricMatrix<float, 3> sym_packed(packed);
+	EXPECT_EQ(sym_packed, (SymmetricMatrix<float, 3>(square)));
+
+	// round trip back to a dense matrix
+	EXPECT_EQ(sym_packed.squareMatrix(), square);
+
+	float dense[9];
+	sym_packed.copyTo(dense);
+
+	for (size_t i = 0; i < 9; i++) {
+		EXPECT_EQ(dense[i], data[i]);
+	}
+
+	// dense sub-block copy
+	Matrix<float, 2, 2> block = sym_packed.slice<2, 2>(1, 0);
+	EXPECT_EQ(block, (Matrix<float, 2, 2>(square.slice<2, 2>(1, 0))));
+
+	EXPECT_EQ(sym_packed.diag(), square.diag());
+	EXPECT_EQ(sym_packed.trace(), square.trace());
+
+	SymmetricMatrix<float, 3> identity;
+	identity.setIdentity();
+	EXPECT_EQ(identity.trace(), 3.f);
+	EXPECT_EQ(identity(0, 1), 0.f);
+}
+
+TEST(MatrixSymmetricTest, FusionOperations)
+{
+	float data[9] = {4, 1, 0,
+			 1, 3, 1,
+			 0, 1, 2
+			};
+	SquareMatrix<float, 3> P_dense(data);
+	SymmetricMatrix<float, 3> P(P_dense);
+
+	const Vector3f h(0.5f, -1.f, 2.f);
+
+	// P * v matches the dense product
+	EXPECT_EQ(P * h, Vector3f(P_dense * h));
+
+	// v^T P v, e.g. innovation variance
+	const float s_check = (h.transpose() * P_dense * h)(0, 0);
+	EXPECT_FLOAT_EQ(P.quadraticForm(h), s_check);
+
+	// symmetric rank-1 update matches the dense computation
+	SquareMatrix<float, 3> P_dense_updated = P_dense;
+	P_dense_updated.rankUpdate(h, 0.5f);
+	P.rankUpdate(h, 0.5f);
+	EXPECT_EQ(P.squareMatrix(), P_dense_updated);
+
+	// in-place element-wise operations
+	SymmetricMatrix<float, 3> sum(P_dense);
+	sum += SymmetricMatrix<float, 3>(P_dense);
+	sum *= 0.5f;
+	EXPECT_EQ(sum.squareMatrix(), P_dense);
+}
@@ -73,6 +73,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data[(int)func - (int)OutputFunction::Offboard_Actuator_Set1]; }
+	const float *valuePtr(OutputFunction func) const override { return &_data[(int)func - (int)OutputFunction::Offboard_Actuator_Set1]; }
 
 private:
 	static constexpr int max_num_actuators = 6;
@@ -44,7 +44,11 @@ public:
 	static FunctionProviderBase *allocate(const Context &context) { return new FunctionConstantMax(); }
 
 	float value(OutputFunction func) override { return 1.f; }
+	const float *valuePtr(OutputFunction func) const override { return &_value; }
 	void update() override { }
 
 	float defaultFailsafeValue(OutputFunction func) const override { return 1.f; }
+
+private:
+	const float _value{1.f};
 };
@@ -61,6 +61,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data; }
+	const float *valuePtr(OutputFunction func) const override { return &_data; }
 
 private:
 	uORB::Subscription _topic{ORB_ID(landing_gear)};
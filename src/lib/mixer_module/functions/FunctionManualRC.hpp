@@ -72,6 +72,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data[(int)func - (int)OutputFunction::RC_Roll]; }
+	const float *valuePtr(OutputFunction func) const override { return &_data[(int)func - (int)OutputFunction::RC_Roll]; }
 
 private:
 	static constexpr int num_data_points = 11;
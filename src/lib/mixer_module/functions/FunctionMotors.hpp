@@ -67,6 +67,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data.control[(int)func - (int)OutputFunction::Motor1]; }
+	const float *valuePtr(OutputFunction func) const override { return &_data.control[(int)func - (int)OutputFunction::Motor1]; }
 
 	bool allowPrearmControl() const override { return false; }
 
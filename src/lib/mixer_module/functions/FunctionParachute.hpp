@@ -46,5 +46,9 @@ public:
 
 	void update() override {}
 	float value(OutputFunction func) override { return -1.f; }
+	const float *valuePtr(OutputFunction func) const override { return &_value; }
 	float defaultFailsafeValue(OutputFunction func) const override { return 1.f; }
+
+private:
+	const float _value{-1.f};
 };
@@ -61,6 +61,15 @@ public:
 	 */
 	virtual float value(OutputFunction func) = 0;
 
+	/**
+	 * Get a pointer to the storage behind value(), stable for the lifetime of
+	 * the provider. It is resolved once at configuration into the precompiled
+	 * channel plan, so the per-cycle loop reads the value directly instead of
+	 * going through a virtual lookup per channel.
+	 * @return nullptr if the value has no stable storage
+	 */
+	virtual const float *valuePtr(OutputFunction func) const { return nullptr; }
+
 	virtual float defaultFailsafeValue(OutputFunction func) const { return NAN; }
 	virtual bool allowPrearmControl() const { return true; }
 
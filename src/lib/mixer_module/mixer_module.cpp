@@ -209,6 +209,8 @@ void MixingOutput::cleanupFunctions()
 		delete _function_allocated[i];
 		_function_allocated[i] = nullptr;
 		_functions[i] = nullptr;
+		_function_value[i] = nullptr;
+		_function_allow_prearm[i] = false;
 	}
 }
 
@@ -313,6 +315,14 @@ bool MixingOutput::updateSubscriptions(bool allow_wq_switch, bool limit_callback
 		}
 	}
 
+	// precompile the channel plan now that the functions are resolved
+	for (int i = 0; i < _max_num_outputs; ++i) {
+		if (_functions[i]) {
+			_function_value[i] = _functions[i]->valuePtr(_function_assignment[i]);
+			_function_allow_prearm[i] = _functions[i]->allowPrearmControl();
+		}
+	}
+
 	hrt_abstime fixed_rate_scheduling_interval = 4_ms; // schedule at 250Hz
 
 	if (_max_topic_update_interval_us > fixed_rate_scheduling_interval) {
@@ -440,8 +450,9 @@ bool MixingOutput::update()
 		if (_functions[i]) {
 			all_disabled = false;
 
-			if (_armed.armed || (_armed.prearmed && _functions[i]->allowPrearmControl())) {
-				outputs[i] = _functions[i]->value(_function_assignment[i]);
+			if (_armed.armed || (_armed.prearmed && _function_allow_prearm[i])) {
+				// read through the precompiled channel plan where possible
+				outputs[i] = _function_value[i] ? *_function_value[i] : _functions[i]->value(_function_assignment[i]);
 
 			} else {
 				outputs[i] = NAN;
@@ -679,6 +690,8 @@ MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_output
 
 		if (_function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
 			perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - timestamp_sample);
+
+			_latency_trace.publish(latency_trace_s::HOP_ACTUATOR_OUTPUTS, timestamp_sample);
 		}
 	}
 }
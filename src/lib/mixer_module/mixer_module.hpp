@@ -48,6 +48,7 @@
 
 #include <board_config.h>
 #include <drivers/drv_pwm_output.h>
+#include <lib/latency_trace/LatencyTrace.hpp>
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
@@ -277,9 +278,16 @@ private:
 
 	perf_counter_t _control_latency_perf;
 
+	latency_trace::LatencyTracePublisher _latency_trace{};
+
 	FunctionProviderBase *_function_allocated[MAX_ACTUATORS] {}; ///< unique allocated functions
 	FunctionProviderBase *_functions[MAX_ACTUATORS] {}; ///< currently assigned functions
 	OutputFunction _function_assignment[MAX_ACTUATORS] {};
+
+	// precompiled channel plan, resolved once in updateSubscriptions() so the
+	// per-cycle output loop runs on flat arrays instead of per-channel virtual lookups
+	const float *_function_value[MAX_ACTUATORS] {}; ///< direct pointer to the function source value (can be null)
+	bool _function_allow_prearm[MAX_ACTUATORS] {};
 	bool _need_function_update{true};
 	bool _has_backup_schedule{false};
 	const char *const _param_prefix;
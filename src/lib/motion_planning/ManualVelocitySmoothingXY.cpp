@@ -81,9 +81,8 @@ void ManualVelocitySmoothingXY::updateTrajectories(float dt)
 
 void ManualVelocitySmoothingXY::updateTrajDurations(const Vector2f &velocity_target)
 {
-	for (int i = 0; i < 2; ++i) {
-		_trajectory[i].updateDurations(velocity_target(i));
-	}
+	const float velocity_targets[2] = {velocity_target(0), velocity_target(1)};
+	VelocitySmoothing::updateDurations(_trajectory, 2, velocity_targets);
 
 	VelocitySmoothing::timeSynchronization(_trajectory, 2);
 }
@@ -298,9 +298,8 @@ void PositionSmoothing::_generateTrajectory(
 		out_setpoints.position(i) = _trajectory[i].getCurrentPosition();
 	}
 
-	for (int i = 0; i < 3; ++i) {
-		_trajectory[i].updateDurations(velocity_setpoint(i));
-	}
+	const float velocity_setpoints[3] = {velocity_setpoint(0), velocity_setpoint(1), velocity_setpoint(2)};
+	VelocitySmoothing::updateDurations(_trajectory, 3, velocity_setpoints);
 
 	VelocitySmoothing::timeSynchronization(_trajectory, 3);
 }
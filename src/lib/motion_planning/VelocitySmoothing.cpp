@@ -53,6 +53,8 @@ void VelocitySmoothing::reset(float accel, float vel, float pos)
 	_state.x = pos;
 
 	_state_init = _state;
+
+	_durations_valid = false;
 }
 
 float VelocitySmoothing::saturateT1ForAccel(float a0, float j_max, float T1, float a_max) const
@@ -166,6 +168,25 @@ void VelocitySmoothing::updateDurations(float vel_setpoint)
 	_local_time = 0.f;
 	_state_init = _state;
 
+	// The durations are fully determined by the constrained setpoint, the current state
+	// and the constraints. While tracking steadily those repeat between cycles and the
+	// previously computed profile stays valid (NAN inputs always fail the comparison).
+	if (_durations_valid
+	    && _vel_sp == _last_vel_sp
+	    && _state.a == _last_state_a
+	    && _state.v == _last_state_v
+	    && _max_jerk == _last_max_jerk
+	    && _max_accel == _last_max_accel) {
+		return;
+	}
+
+	_last_vel_sp = _vel_sp;
+	_last_state_a = _state.a;
+	_last_state_v = _state.v;
+	_last_max_jerk = _max_jerk;
+	_last_max_accel = _max_accel;
+	_durations_valid = true;
+
 	_direction = computeDirection();
 
 	if (_direction != 0) {
@@ -176,6 +197,13 @@ void VelocitySmoothing::updateDurations(float vel_setpoint)
 	}
 }
 
+void VelocitySmoothing::updateDurations(VelocitySmoothing *traj, int n_traj, const float *vel_setpoints)
+{
+	for (int i = 0; i < n_traj; i++) {
+		traj[i].updateDurations(vel_setpoints[i]);
+	}
+}
+
 int VelocitySmoothing::computeDirection() const
 {
 	// Compute the velocity at which the trajectory will be
@@ -289,6 +317,9 @@ void VelocitySmoothing::timeSynchronization(VelocitySmoothing *traj, int n_traj)
 
 void VelocitySmoothing::updateDurationsGivenTotalTime(float T123)
 {
+	// the stretched durations no longer match the memoized time-optimal solution
+	_durations_valid = false;
+
 	float jerk_max_T1 = _direction * _max_jerk;
 	float delta_v = _vel_sp - _state.v;
 
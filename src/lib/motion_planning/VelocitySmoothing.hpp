@@ -75,10 +75,20 @@ public:
 	/**
 	 * Compute T1, T2, T3 depending on the current state and velocity setpoint. This should be called on every cycle
 	 * and before updateTraj().
+	 * The result is memoized: if the setpoint, state and constraints are unchanged since the
+	 * last call (the common steady-tracking case), the previous profile is kept.
 	 * @param vel_setpoint velocity setpoint input
 	 */
 	void updateDurations(float vel_setpoint);
 
+	/**
+	 * Compute the durations of several axes in one batch.
+	 * @param traj an array of VelocitySmoothing objects
+	 * @param n_traj the number of trajectories
+	 * @param vel_setpoints array of velocity setpoint inputs, one per trajectory
+	 */
+	static void updateDurations(VelocitySmoothing *traj, int n_traj, const float *vel_setpoints);
+
 	/**
 	 * Generate the trajectory (acceleration, velocity and position) by integrating the current jerk
 	 * @param dt integration period
@@ -212,4 +222,12 @@ private:
 	float _T3 = 0.f; ///< Decreasing acceleration [s]
 
 	float _local_time = 0.f; ///< Current local time
+
+	/* Memoization of the last duration computation (see updateDurations) */
+	bool _durations_valid{false};
+	float _last_vel_sp{0.f};
+	float _last_state_a{0.f};
+	float _last_state_v{0.f};
+	float _last_max_jerk{0.f};
+	float _last_max_accel{0.f};
 };
@@ -189,6 +189,19 @@ __EXPORT bool		param_value_is_default(param_t param);
  */
 __EXPORT bool		param_value_unsaved(param_t param);
 
+/**
+ * Read the modification generation counter of a parameter.
+ *
+ * The counter advances every time the effective value of the parameter changes
+ * (set, reset or a runtime default update), so a cached copy of the value is
+ * still current as long as the generation it was read at matches. Consumers
+ * must compare generations for inequality only: the counter wraps.
+ *
+ * @param param		A handle returned by param_find or passed by param_foreach.
+ * @return		The generation counter, or 0 if the handle is invalid.
+ */
+__EXPORT uint16_t	param_generation(param_t param);
+
 /**
  * Obtain the type of a parameter.
  *
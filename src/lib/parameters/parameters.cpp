@@ -88,18 +88,35 @@ inline static int flash_param_import() { return -1; }
 static char *param_default_file = nullptr;
 static char *param_backup_file = nullptr;
 
-#include <px4_platform_common/workqueue.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+
 /* autosaving variables */
+class ParamAutosave;
 static hrt_abstime last_autosave_timestamp = 0;
-static struct work_s autosave_work {};
+static ParamAutosave *autosave_instance = nullptr;	///< created on first use (needs the work queues running)
 static px4::atomic_bool autosave_scheduled{false};
 static bool autosave_disabled = false;
 
+/* incremental persistence: unsaved params are appended to a journal next to the
+ * param file and the full rewrite is deferred until the journal grows too large */
+static int param_journal_records = 0;			///< records in the journal since the last full export
+static constexpr int param_journal_compact_records = 32;	///< full export once the journal holds this many records
+static constexpr unsigned param_journal_max_dirty = 8;	///< append at most this many params per save, otherwise rewrite
+
 static px4::AtomicBitset<param_info_count> params_active;  // params found
 static px4::AtomicBitset<param_info_count> params_changed; // params non-default
 static px4::Bitset<param_info_count> params_custom_default; // params with runtime default value
 static px4::AtomicBitset<param_info_count> params_unsaved;
 
+// Per-parameter modification generation counters: bumped (under the writer
+// lock) whenever the effective value of a parameter changes, read lock-free.
+// Module parameter caches (@see ModuleParams/DEFINE_PARAMETERS) use these to
+// skip re-reading parameters whose value did not move, so a single param
+// change no longer triggers a param_get for every declared parameter of every
+// module. Wrapping is harmless as consumers only compare for inequality.
+static uint16_t param_generations[param_info_count] {};
+
 // Storage for modified parameters.
 struct param_wbuf_s {
 	union param_value_u val;
@@ -112,6 +129,18 @@ UT_array *param_custom_default_values{nullptr};
 
 const UT_icd param_icd = {sizeof(param_wbuf_s), nullptr, nullptr, nullptr};
 
+// Read-copy-update access to the modified values: writers publish an immutable
+// sorted copy of param_values, readers in param_get() only load the snapshot
+// pointer and never touch the reader lock. This keeps a parameter refresh storm
+// across all modules (after a parameter_update) free of lock contention.
+struct param_snapshot_s {
+	param_wbuf_s *values;		///< sorted copy, allocated behind this struct
+	unsigned count;
+};
+
+static px4::atomic<param_snapshot_s *> param_snapshot{nullptr};
+static px4::atomic<int> param_snapshot_readers{0};	///< readers currently inside the snapshot (grace period accounting)
+
 /** parameter update topic handle */
 static orb_advert_t param_topic = nullptr;
 static unsigned int param_instance = 0;
@@ -246,6 +275,45 @@ param_find_changed(param_t param)
 	return nullptr;
 }
 
+/**
+ * Publish a new immutable snapshot of the modified values and retire the old
+ * one once all readers have left it.
+ *
+ * Must be called with the writer lock held after any mutation of param_values.
+ * If the allocation fails nothing is published and readers fall back to the
+ * locked path, which is correct but slower.
+ */
+static void
+param_update_snapshot()
+{
+	param_assert_locked();
+
+	const unsigned count = (param_values != nullptr) ? utarray_len(param_values) : 0;
+	param_snapshot_s *snapshot = nullptr;
+
+	if (count > 0) {
+		snapshot = (param_snapshot_s *)malloc(sizeof(param_snapshot_s) + count * sizeof(param_wbuf_s));
+
+		if (snapshot != nullptr) {
+			snapshot->values = (param_wbuf_s *)(snapshot + 1);
+			snapshot->count = count;
+			memcpy(snapshot->values, utarray_front(param_values), count * sizeof(param_wbuf_s));
+		}
+	}
+
+	param_snapshot_s *previous = param_snapshot.load();
+	param_snapshot.store(snapshot);
+
+	// grace period: any reader counted here entered before the new snapshot was
+	// visible and might still use the old one. Sleep rather than spin so a
+	// preempted lower priority reader can get the CPU to finish.
+	while (param_snapshot_readers.load() != 0) {
+		px4_usleep(50);
+	}
+
+	free(previous);
+}
+
 void
 param_notify_changes()
 {
@@ -268,37 +336,90 @@ param_notify_changes()
 	}
 }
 
+/**
+ * Compile-time hash index over the generated parameter names.
+ *
+ * The open-addressed table is built by the compiler from px4::parameters, so
+ * it lives in flash next to the info table and param_find() resolves a name
+ * with on average one hash computation and one string compare, instead of the
+ * ~11 string compares of a binary search over 1300+ parameters.
+ */
+static constexpr uint32_t param_hash(const char *name)
+{
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+
+	while (*name != '\0') {
+		hash ^= (uint32_t)(unsigned char)*name++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+static constexpr uint32_t param_hash_table_size()
+{
+	// smallest power of two with a load factor of at most 1/2,
+	// keeping the probe sequences short
+	uint32_t size = 1;
+
+	while (size < 2u * param_info_count) {
+		size <<= 1;
+	}
+
+	return size;
+}
+
+struct param_hash_table_s {
+	uint16_t index[param_hash_table_size()];
+};
+
+static constexpr param_hash_table_s param_build_hash_table()
+{
+	constexpr uint32_t mask = param_hash_table_size() - 1;
+	param_hash_table_s table{};
+
+	for (uint32_t i = 0; i < param_hash_table_size(); i++) {
+		table.index[i] = UINT16_MAX;
+	}
+
+	for (uint16_t i = 0; i < param_info_count; i++) {
+		uint32_t slot = param_hash(px4::parameters[i].name) & mask;
+
+		// linear probing
+		while (table.index[slot] != UINT16_MAX) {
+			slot = (slot + 1) & mask;
+		}
+
+		table.index[slot] = i;
+	}
+
+	return table;
+}
+
+static constexpr param_hash_table_s param_hash_table = param_build_hash_table();
+
 static param_t param_find_internal(const char *name, bool notification)
 {
 	perf_count(param_find_perf);
 
-	param_t middle;
-	param_t front = 0;
-	param_t last = param_info_count;
+	const uint32_t mask = param_hash_table_size() - 1;
+	uint32_t slot = param_hash(name) & mask;
 
-	/* perform a binary search of the known parameters */
+	/* probe until an empty slot terminates the cluster */
 
-	while (front <= last) {
-		middle = front + (last - front) / 2;
-		int ret = strcmp(name, param_name(middle));
+	while (param_hash_table.index[slot] != UINT16_MAX) {
+		const param_t candidate = param_hash_table.index[slot];
 
-		if (ret == 0) {
+		if (strcmp(name, param_name(candidate)) == 0) {
 			if (notification) {
-				param_set_used(middle);
+				param_set_used(candidate);
 			}
 
-			return middle;
-
-		} else if (middle == front) {
-			/* An end point has been hit, but there has been no match */
-			break;
-
-		} else if (ret < 0) {
-			last = middle;
-
-		} else {
-			front = middle;
+			return candidate;
 		}
+
+		slot = (slot + 1) & mask;
 	}
 
 	/* not found */
@@ -322,20 +443,13 @@ unsigned param_count_used()
 
 param_t param_for_used_index(unsigned index)
 {
-	// walk all params and count used params
 	if (index < param_info_count) {
-		unsigned used_count = 0;
-
-		for (int i = 0; i < params_active.size(); i++) {
-			if (params_active[i]) {
-				// we found the right used count,
-				//  return the param value
-				if (index == used_count) {
-					return static_cast<param_t>(i);
-				}
+		// word-wise select of the index-th used param, so a full param dump
+		// does not walk the whole bitset bit by bit for every message
+		int i = params_active.find_nth_set(index);
 
-				used_count++;
-			}
+		if (i >= 0) {
+			return static_cast<param_t>(i);
 		}
 	}
 
@@ -349,21 +463,8 @@ int param_get_used_index(param_t param)
 		return -1;
 	}
 
-	/* walk all params and count, now knowing that it has a valid index */
-	int used_count = 0;
-
-	for (int i = 0; i < params_active.size(); i++) {
-		if (params_active[i]) {
-
-			if (param == i) {
-				return used_count;
-			}
-
-			used_count++;
-		}
-	}
-
-	return -1;
+	/* the used index is the number of used params preceding this one */
+	return params_active.count_before(param);
 }
 
 bool
@@ -372,6 +473,12 @@ param_value_unsaved(param_t param)
 	return handle_in_range(param) ? params_unsaved[param] : false;
 }
 
+uint16_t
+param_generation(param_t param)
+{
+	return handle_in_range(param) ? param_generations[param] : 0;
+}
+
 /**
  * Obtain a pointer to the storage allocated for a parameter.
  *
@@ -447,6 +554,33 @@ param_get(param_t param, void *val)
 			}
 		}
 
+		if (params_changed[param]) {
+			// wait-free read from the immutable snapshot (RCU), no reader lock taken
+			param_snapshot_readers.fetch_add(1);
+			const param_snapshot_s *snapshot = param_snapshot.load();
+			bool found = false;
+
+			if (snapshot != nullptr) {
+				param_wbuf_s key{};
+				key.param = param;
+				const param_wbuf_s *s = (const param_wbuf_s *)bsearch(&key, snapshot->values, snapshot->count,
+							sizeof(param_wbuf_s), param_compare_values);
+
+				if (s != nullptr) {
+					memcpy(val, &s->val, param_size(param));
+					found = true;
+				}
+			}
+
+			param_snapshot_readers.fetch_sub(1);
+
+			if (found) {
+				return PX4_OK;
+			}
+
+			// not yet published (the value is being set concurrently): fall through to the locked read
+		}
+
 		param_lock_reader();
 		const void *v = param_get_value_ptr(param);
 
@@ -582,22 +716,41 @@ bool param_value_is_default(param_t param)
 	return true;
 }
 
+static int param_save_journal();
+
 /**
- * worker callback method to save the parameters
- * @param arg unused
+ * Dedicated lowest priority work item performing the deferred saves, so a
+ * burst of param_set() calls (eg a GCS bulk upload) never adds work to the
+ * queues flight-critical items share. While a save is deferred because the
+ * vehicle is armed, the actuator_armed callback forces a flush right after
+ * disarming instead of waiting out the poll interval.
  */
-static void
-autosave_worker(void *arg)
+class ParamAutosave : public px4::ScheduledWorkItem
+{
+public:
+	ParamAutosave() : ScheduledWorkItem("param_autosave", px4::wq_configurations::param_autosave) {}
+
+private:
+	void Run() override;
+
+	uORB::SubscriptionCallbackWorkItem _armed_sub{this, ORB_ID(actuator_armed)};
+};
+
+void ParamAutosave::Run()
 {
 	bool disabled = false;
 
+	_armed_sub.unregisterCallback();
+
 	if (!param_get_default_file()) {
 		// In case we save to FLASH, defer param writes until disarmed,
 		// as writing to FLASH can stall the entire CPU (in rare cases around 300ms on STM32F7)
 		uORB::SubscriptionData<actuator_armed_s> armed_sub{ORB_ID(actuator_armed)};
 
 		if (armed_sub.get().armed) {
-			work_queue(LPWORK, &autosave_work, (worker_t)&autosave_worker, nullptr, USEC2TICK(1_s));
+			// the callback flushes right after disarming, the delayed schedule is only a fallback
+			_armed_sub.registerCallback();
+			ScheduleDelayed(1_s);
 			return;
 		}
 	}
@@ -613,7 +766,14 @@ autosave_worker(void *arg)
 	}
 
 	PX4_DEBUG("Autosaving params");
-	int ret = param_save_default();
+
+	// append the few changed params to the journal; fall back to a full
+	// export when that is not applicable (which also compacts the journal)
+	int ret = param_save_journal();
+
+	if (ret != 0) {
+		ret = param_save_default();
+	}
 
 	if (ret != 0) {
 		PX4_ERR("param auto save failed (%i)", ret);
@@ -624,7 +784,7 @@ autosave_worker(void *arg)
  * Automatically save the parameters after a timeout and limited rate.
  *
  * This needs to be called with the writer lock held (it's not necessary that it's the writer lock, but it
- * needs to be the same lock as autosave_worker() and param_control_autosave() use).
+ * needs to be the same lock as ParamAutosave::Run() and param_control_autosave() use).
  */
 static void
 param_autosave()
@@ -633,6 +793,14 @@ param_autosave()
 		return;
 	}
 
+	if (autosave_instance == nullptr) {
+		autosave_instance = new ParamAutosave();
+
+		if (autosave_instance == nullptr) {
+			return;
+		}
+	}
+
 	// wait at least 300ms before saving, because:
 	// - tasks often call param_set() for multiple params, so this avoids unnecessary save calls
 	// - the logger stores changed params. He gets notified on a param change via uORB and then
@@ -647,7 +815,7 @@ param_autosave()
 	}
 
 	autosave_scheduled.store(true);
-	work_queue(LPWORK, &autosave_work, (worker_t)&autosave_worker, nullptr, USEC2TICK(delay));
+	autosave_instance->ScheduleDelayed(delay);
 }
 
 void
@@ -656,7 +824,7 @@ param_control_autosave(bool enable)
 	param_lock_writer();
 
 	if (!enable && autosave_scheduled.load()) {
-		work_cancel(LPWORK, &autosave_work);
+		autosave_instance->ScheduleClear();
 		autosave_scheduled.store(false);
 	}
 
@@ -749,8 +917,13 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 			}
 		}
 
-		if ((result == PX4_OK) && param_changed && !mark_saved) { // this is false when importing parameters
-			param_autosave();
+		if ((result == PX4_OK) && param_changed) {
+			++param_generations[param];
+			param_update_snapshot();
+
+			if (!mark_saved) { // this is false when importing parameters
+				param_autosave();
+			}
 		}
 	}
 
@@ -904,6 +1077,11 @@ int param_set_default_value(param_t param, const void *val)
 		}
 	}
 
+	if ((result == PX4_OK) && !params_changed[param]) {
+		// the effective value moves with the default while the param is unmodified
+		++param_generations[param];
+	}
+
 	param_unlock_writer();
 
 	if ((result == PX4_OK) && param_used(param)) {
@@ -929,6 +1107,8 @@ static int param_reset_internal(param_t param, bool notify = true)
 		if (s != nullptr) {
 			int pos = utarray_eltidx(param_values, s);
 			utarray_erase(param_values, pos, 1);
+			++param_generations[param];
+			param_update_snapshot();
 		}
 
 		params_changed.set(param, false);
@@ -962,8 +1142,14 @@ param_reset_all_internal(bool auto_save)
 		params_changed.reset();
 	}
 
+	// all values potentially reverted, invalidate every cached copy
+	for (param_t param = 0; handle_in_range(param); param++) {
+		++param_generations[param];
+	}
+
 	/* mark as reset / deleted */
 	param_values = nullptr;
+	param_update_snapshot();
 
 	if (auto_save) {
 		param_autosave();
@@ -1093,6 +1279,9 @@ const char *param_get_backup_file()
 
 static int param_export_internal(int fd, param_filter_func filter);
 static int param_verify(int fd);
+static int param_journal_path(char *buf, size_t len);
+static int param_journal_append(int fd, param_t param);
+static int param_journal_replay(int fd);
 
 int param_save_default()
 {
@@ -1153,6 +1342,15 @@ int param_save_default()
 	} else {
 		params_unsaved.reset();
 
+		// the full export supersedes the journal
+		char journal_path[64];
+
+		if (param_journal_path(journal_path, sizeof(journal_path)) == 0) {
+			::unlink(journal_path);
+		}
+
+		param_journal_records = 0;
+
 		// backup file
 		if (param_backup_file) {
 			int fd_backup_file = ::open(param_backup_file, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
@@ -1184,6 +1382,183 @@ int param_save_default()
 	return res;
 }
 
+/**
+ * Build the path of the parameter journal file ("<default file>.jrnl").
+ * @return 0 on success, -1 when there is no default file or the path doesn't fit
+ */
+static int param_journal_path(char *buf, size_t len)
+{
+	const char *filename = param_get_default_file();
+
+	if (filename == nullptr) {
+		return -1;
+	}
+
+	int n = snprintf(buf, len, "%s.jrnl", filename);
+
+	if (n < 0 || (size_t)n >= len) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * Append one parameter as a self-contained BSON document to the journal.
+ *
+ * The record is encoded into a stack buffer and written with a single write()
+ * call (bson_encoder_fini() on a file encoder rewrites the document size at
+ * file offset 0, which would corrupt an append-only stream).
+ *
+ * Caller is responsible for locking.
+ */
+static int param_journal_append(int fd, param_t param)
+{
+	bson_encoder_s encoder{};
+	uint8_t record[64];
+
+	if (bson_encoder_init_buf(&encoder, &record, sizeof(record)) != 0) {
+		return -1;
+	}
+
+	const char *name = param_name(param);
+	const param_wbuf_s *s = param_find_changed(param);
+
+	switch (param_type(param)) {
+	case PARAM_TYPE_INT32: {
+			int32_t i = 0;
+
+			if (s) {
+				i = s->val.i;
+
+			} else {
+				// a reset to default must be journaled explicitly
+				param_get_default_value_internal(param, &i);
+			}
+
+			if (bson_encoder_append_int32(&encoder, name, i) != 0) {
+				return -1;
+			}
+		}
+		break;
+
+	case PARAM_TYPE_FLOAT: {
+			float f = 0.f;
+
+			if (s) {
+				f = s->val.f;
+
+			} else {
+				param_get_default_value_internal(param, &f);
+			}
+
+			if (bson_encoder_append_double(&encoder, name, (double)f) != 0) {
+				return -1;
+			}
+		}
+		break;
+
+	default:
+		PX4_ERR("%s unrecognized parameter type %d, not journaled", name, param_type(param));
+		return -1;
+	}
+
+	if (bson_encoder_fini(&encoder) != 0) {
+		return -1;
+	}
+
+	const int size = bson_encoder_buf_size(&encoder);
+
+	if (::write(fd, record, size) != size) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * Append the currently unsaved parameters to the journal file instead of
+ * rewriting the whole parameter file.
+ *
+ * Each parameter becomes a separate single-entry BSON document, so a power
+ * loss mid-append at worst truncates the last record. The journal is replayed
+ * on top of the parameter file at boot and deleted by the next full export.
+ *
+ * @return 0 on success, nonzero when a full export should be done instead
+ */
+static int param_save_journal()
+{
+	char journal_path[64];
+
+	if (param_journal_path(journal_path, sizeof(journal_path)) != 0) {
+		// no file backend (e.g. FLASH based params): always do a full save
+		return 1;
+	}
+
+	const size_t dirty = params_unsaved.count();
+
+	if ((dirty == 0) || (dirty > param_journal_max_dirty)
+	    || (param_journal_records + (int)dirty > param_journal_compact_records)) {
+		// nothing journalable, or the journal would grow too large: compact with a full export
+		return 1;
+	}
+
+	int shutdown_lock_ret = px4_shutdown_lock();
+
+	if (shutdown_lock_ret != 0) {
+		PX4_ERR("px4_shutdown_lock() failed (%i)", shutdown_lock_ret);
+	}
+
+	// take the file lock
+	do {} while (px4_sem_wait(&param_sem_save) != 0);
+
+	param_lock_reader();
+
+	int res = PX4_ERROR;
+	int fd = ::open(journal_path, O_WRONLY | O_CREAT | O_APPEND, PX4_O_MODE_666);
+
+	if (fd > -1) {
+		perf_begin(param_export_perf);
+		res = PX4_OK;
+
+		for (param_t param = 0; handle_in_range(param); param++) {
+			if (!params_unsaved[param]) {
+				continue;
+			}
+
+			if (param_journal_append(fd, param) == PX4_OK) {
+				params_unsaved.set(param, false);
+				param_journal_records++;
+
+			} else {
+				// incomplete journal, the fallback full export will supersede it
+				res = PX4_ERROR;
+				break;
+			}
+		}
+
+		if ((res == PX4_OK) && (::fsync(fd) != 0)) {
+			res = PX4_ERROR;
+		}
+
+		perf_end(param_export_perf);
+		::close(fd);
+	}
+
+	param_unlock_reader();
+	px4_sem_post(&param_sem_save);
+
+	if (shutdown_lock_ret == 0) {
+		px4_shutdown_unlock();
+	}
+
+	if (res != PX4_OK) {
+		PX4_DEBUG("journal append to %s failed", journal_path);
+	}
+
+	return res;
+}
+
 /**
  * @return 0 on success, 1 if all params have not yet been stored, -1 if device open failed, -2 if writing parameters failed
  */
@@ -1217,6 +1592,22 @@ param_load_default()
 		return -2;
 	}
 
+	// apply any parameter saves journaled since the last full export
+	char journal_path[64];
+
+	if (param_journal_path(journal_path, sizeof(journal_path)) == 0) {
+		int fd_journal = ::open(journal_path, O_RDONLY);
+
+		if (fd_journal > -1) {
+			param_journal_records = param_journal_replay(fd_journal);
+			::close(fd_journal);
+
+			if (param_journal_records > 0) {
+				PX4_INFO("replayed %d journaled parameter saves", param_journal_records);
+			}
+		}
+	}
+
 	return res;
 }
 
@@ -1226,6 +1617,11 @@ static int param_verify_callback(bson_decoder_t decoder, bson_node_t node)
 		return 0;
 	}
 
+	// handle hints are import metadata, not a parameter
+	if (node->type == BSON_BINDATA) {
+		return 1;
+	}
+
 	// find the parameter this node represents
 	param_t param = param_find_no_notification(node->name);
 
@@ -1364,6 +1760,41 @@ param_export(const char *filename, param_filter_func filter)
 	return result;
 }
 
+// returns true if an entry is left out of the export (filtered out or at its default value)
+static bool param_export_skip(const param_wbuf_s *s, param_filter_func filter)
+{
+	if (filter && !filter(s->param)) {
+		return true;
+	}
+
+	// don't export default values
+	switch (param_type(s->param)) {
+	case PARAM_TYPE_INT32: {
+			int32_t default_value = 0;
+			param_get_default_value_internal(s->param, &default_value);
+
+			if (s->val.i == default_value) {
+				PX4_DEBUG("skipping %s %" PRIi32 " export", param_name(s->param), default_value);
+				return true;
+			}
+		}
+		break;
+
+	case PARAM_TYPE_FLOAT: {
+			float default_value = 0;
+			param_get_default_value_internal(s->param, &default_value);
+
+			if (fabsf(s->val.f - default_value) <= FLT_EPSILON) {
+				PX4_DEBUG("skipping %s %.3f export", param_name(s->param), (double)default_value);
+				return true;
+			}
+		}
+		break;
+	}
+
+	return false;
+}
+
 // internal parameter export, caller is responsible for locking
 static int param_export_internal(int fd, param_filter_func filter)
 {
@@ -1371,6 +1802,8 @@ static int param_export_internal(int fd, param_filter_func filter)
 
 	int result = -1;
 	param_wbuf_s *s = nullptr;
+	uint16_t *handles = nullptr;
+	unsigned handle_count = 0;
 	bson_encoder_s encoder{};
 	uint8_t bson_buffer[256];
 
@@ -1389,34 +1822,30 @@ static int param_export_internal(int fd, param_filter_func filter)
 		goto out;
 	}
 
-	while ((s = (struct param_wbuf_s *)utarray_next(param_values, s)) != nullptr) {
-		if (filter && !filter(s->param)) {
-			continue;
-		}
+	// lead with the handle of each following entry so the importer can skip
+	// the name lookup, falling back to it if the parameter set has changed
+	handles = (uint16_t *)malloc(utarray_len(param_values) * sizeof(uint16_t));
 
-		// don't export default values
-		switch (param_type(s->param)) {
-		case PARAM_TYPE_INT32: {
-				int32_t default_value = 0;
-				param_get_default_value_internal(s->param, &default_value);
-
-				if (s->val.i == default_value) {
-					PX4_DEBUG("skipping %s %" PRIi32 " export", param_name(s->param), default_value);
-					continue;
-				}
+	if (handles != nullptr) {
+		while ((s = (struct param_wbuf_s *)utarray_next(param_values, s)) != nullptr) {
+			if (!param_export_skip(s, filter)) {
+				handles[handle_count++] = (uint16_t)s->param;
 			}
-			break;
+		}
 
-		case PARAM_TYPE_FLOAT: {
-				float default_value = 0;
-				param_get_default_value_internal(s->param, &default_value);
+		s = nullptr;
 
-				if (fabsf(s->val.f - default_value) <= FLT_EPSILON) {
-					PX4_DEBUG("skipping %s %.3f export", param_name(s->param), (double)default_value);
-					continue;
-				}
-			}
-			break;
+		if ((handle_count > 0)
+		    && (bson_encoder_append_binary(&encoder, "_handles", BSON_BIN_BINARY,
+						   handle_count * sizeof(uint16_t), handles) != 0)) {
+			PX4_ERR("BSON append failed for '_handles'");
+			goto out;
+		}
+	}
+
+	while ((s = (struct param_wbuf_s *)utarray_next(param_values, s)) != nullptr) {
+		if (param_export_skip(s, filter)) {
+			continue;
 		}
 
 		const char *name = param_name(s->param);
@@ -1454,6 +1883,7 @@ static int param_export_internal(int fd, param_filter_func filter)
 	result = 0;
 
 out:
+	free(handles);
 
 	if (result == 0) {
 		if (bson_encoder_fini(&encoder) != PX4_OK) {
@@ -1465,6 +1895,21 @@ out:
 	return result;
 }
 
+/**
+ * Handle hints decoded from an imported document's "_handles" node: the
+ * handle of each exported entry, in file order. A hint only short-circuits
+ * the name lookup when the name at that handle still matches, so importing
+ * a file exported by different firmware degrades to the name path.
+ */
+struct param_import_hints {
+	static constexpr unsigned MAX_HANDLES = 512;
+	uint16_t handles[MAX_HANDLES];
+	unsigned count{0};
+	unsigned next{0};
+};
+
+static param_import_hints *param_import_active_hints{nullptr};
+
 static int
 param_import_callback(bson_decoder_t decoder, bson_node_t node)
 {
@@ -1477,10 +1922,40 @@ param_import_callback(bson_decoder_t decoder, bson_node_t node)
 		return 0;
 	}
 
+	param_import_hints *hints = param_import_active_hints;
+
+	if (node->type == BSON_BINDATA) {
+		// "_handles" carries the handle of each following entry
+		const size_t size = bson_decoder_data_pending(decoder);
+
+		if ((hints != nullptr) && (strcmp(node->name, "_handles") == 0)
+		    && (size % sizeof(uint16_t) == 0) && (size <= sizeof(hints->handles))) {
+			if (bson_decoder_copy_data(decoder, hints->handles) == 0) {
+				hints->count = size / sizeof(uint16_t);
+				hints->next = 0;
+			}
+		}
+
+		return 1;
+	}
+
 	param_modify_on_import(node);
 
-	// Find the parameter this node represents.  If we don't know it, ignore the node.
-	param_t param = param_find_no_notification(node->name);
+	// Find the parameter this node represents, preferring the exported handle
+	// hint over scanning by name. If we don't know it, ignore the node.
+	param_t param = PARAM_INVALID;
+
+	if ((hints != nullptr) && (hints->next < hints->count)) {
+		const param_t candidate = hints->handles[hints->next++];
+
+		if (handle_in_range(candidate) && (strcmp(param_name(candidate), node->name) == 0)) {
+			param = candidate;
+		}
+	}
+
+	if (param == PARAM_INVALID) {
+		param = param_find_no_notification(node->name);
+	}
 
 	if (param == PARAM_INVALID) {
 		PX4_WARN("ignoring unrecognised parameter '%s'", node->name);
@@ -1541,6 +2016,10 @@ param_dump_callback(bson_decoder_t decoder, bson_node_t node)
 		PX4_INFO_RAW("BSON_INT32:  %s = %" PRIi32 "\n", node->name, node->i32);
 		return 1;
 
+	case BSON_BINDATA:
+		PX4_INFO_RAW("BSON_BINDATA: %s (%zu bytes)\n", node->name, bson_decoder_data_pending(decoder));
+		return 1;
+
 	case BSON_INT64:
 		PX4_INFO_RAW("BSON_INT64:  %s = %" PRIi64 "\n", node->name, node->i64);
 		return 1;
@@ -1558,10 +2037,47 @@ param_import_internal(int fd)
 {
 	static constexpr int MAX_ATTEMPTS = 3;
 
+	// decode from a single in-memory arena when the document fits: one read
+	// instead of a syscall per BSON field, which dominates import time on NuttX
+	static constexpr off_t ARENA_SIZE_MAX = 16 * 1024;
+
+	param_import_hints *hints = new param_import_hints();
+	param_import_active_hints = hints; // may be nullptr, the callback copes
+
 	for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
 		bson_decoder_s decoder{};
+		uint8_t *arena = nullptr;
+		int init_ret = -1;
+
+		if (hints != nullptr) {
+			hints->count = 0;
+			hints->next = 0;
+		}
 
-		if (bson_decoder_init_file(&decoder, fd, param_import_callback) == 0) {
+		const off_t file_size = lseek(fd, 0, SEEK_END);
+
+		if ((file_size > 0) && (file_size <= ARENA_SIZE_MAX)) {
+			arena = (uint8_t *)malloc(file_size);
+		}
+
+		if ((arena != nullptr) && (lseek(fd, 0, SEEK_SET) == 0)
+		    && (::read(fd, arena, file_size) == (ssize_t)file_size)) {
+			init_ret = bson_decoder_init_buf(&decoder, arena, file_size, param_import_callback);
+		}
+
+		if (init_ret != 0) {
+			// fall back to decoding straight from the file
+			free(arena);
+			arena = nullptr;
+
+			if (lseek(fd, 0, SEEK_SET) == 0) {
+				init_ret = bson_decoder_init_file(&decoder, fd, param_import_callback);
+			}
+		}
+
+		bool done = false;
+
+		if (init_ret == 0) {
 			int result = -1;
 
 			do {
@@ -1575,7 +2091,7 @@ param_import_internal(int fd)
 						 decoder.total_document_size, decoder.total_decoded_size,
 						 decoder.count_node_int32, decoder.count_node_double);
 
-					return 0;
+					done = true;
 
 				} else {
 					PX4_ERR("BSON document size (%" PRId32 ") doesn't match bytes decoded (%" PRId32 ")",
@@ -1586,7 +2102,7 @@ param_import_internal(int fd)
 				// silently retry as a precaution unless this is our last attempt
 				if (attempt == MAX_ATTEMPTS) {
 					PX4_DEBUG("BSON: no data");
-					return 0;
+					done = true;
 				}
 
 			} else {
@@ -1597,6 +2113,14 @@ param_import_internal(int fd)
 			PX4_ERR("param import bson decoder init failed (attempt %d)", attempt);
 		}
 
+		free(arena);
+
+		if (done) {
+			param_import_active_hints = nullptr;
+			delete hints;
+			return 0;
+		}
+
 		if (attempt != MAX_ATTEMPTS) {
 			if (lseek(fd, 0, SEEK_SET) != 0) {
 				PX4_ERR("import lseek failed (%d)", errno);
@@ -1606,9 +2130,59 @@ param_import_internal(int fd)
 		}
 	}
 
+	param_import_active_hints = nullptr;
+	delete hints;
 	return -1;
 }
 
+/**
+ * Replay journal records on top of the already loaded parameters.
+ *
+ * The journal is a sequence of single-parameter BSON documents appended by
+ * param_save_journal(); the file decoder reads sequentially, so consecutive
+ * documents can be decoded back to back. A torn record at the tail (power
+ * loss during an append) ends the replay; everything before it is applied.
+ *
+ * @return the number of records applied
+ */
+static int param_journal_replay(int fd)
+{
+	int records = 0;
+
+	while (true) {
+		// stop cleanly at the end of the file (a document is at least its size field plus the terminator)
+		const off_t pos = lseek(fd, 0, SEEK_CUR);
+		const off_t end = lseek(fd, 0, SEEK_END);
+
+		if ((pos < 0) || (end < 0) || (end - pos < (off_t)(sizeof(int32_t) + 1)) || (lseek(fd, pos, SEEK_SET) != pos)) {
+			break;
+		}
+
+		bson_decoder_s decoder{};
+
+		if (bson_decoder_init_file(&decoder, fd, param_import_callback) != 0) {
+			break;
+		}
+
+		int result = -1;
+
+		do {
+			result = bson_decoder_next(&decoder);
+
+		} while (result > 0);
+
+		if ((result != 0) || (decoder.total_document_size != decoder.total_decoded_size)) {
+			// torn record at the tail, keep what was applied so far
+			PX4_WARN("incomplete parameter journal record ignored");
+			break;
+		}
+
+		records++;
+	}
+
+	return records;
+}
+
 int
 param_import(int fd)
 {
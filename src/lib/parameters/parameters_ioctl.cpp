@@ -190,6 +190,12 @@ int	param_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case PARAMIOCGENERATION: {
+			paramiocgeneration_t *data = (paramiocgeneration_t *)arg;
+			data->ret = param_generation(data->param);
+		}
+		break;
+
 	default:
 		ret = -ENOTTY;
 		break;
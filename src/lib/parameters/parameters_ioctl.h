@@ -160,4 +160,10 @@ typedef struct paramiochash {
 	uint32_t ret;
 } paramiochash_t;
 
+#define PARAMIOCGENERATION	_PARAMIOC(19)
+typedef struct paramiocgeneration {
+	const param_t param;
+	uint16_t ret;
+} paramiocgeneration_t;
+
 int param_ioctl(unsigned int cmd, unsigned long arg);
@@ -515,6 +515,10 @@ bson_encoder_fini(bson_encoder_t encoder)
 		} else {
 			CODER_KILL(encoder, "write error");
 		}
+
+	} else if (encoder->fd == -1 && encoder->buf != nullptr) {
+		/* pure buffer encoder: the document is exactly the bytes buffered */
+		encoder->total_document_size = encoder->bufpos;
 	}
 
 	// record document size
@@ -95,6 +95,14 @@ param_value_unsaved(param_t param)
 	return data.ret;
 }
 
+uint16_t
+param_generation(param_t param)
+{
+	paramiocgeneration_t data = {param, 0};
+	boardctl(PARAMIOCGENERATION, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
 int
 param_get(param_t param, void *val)
 {
@@ -38,6 +38,7 @@
  */
 
 #include <inttypes.h>
+#include <new>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -46,8 +47,27 @@
 #include <pthread.h>
 #include <systemlib/err.h>
 
+#if defined(__PX4_LINUX)
+#include <sched.h>
+#endif
+
 #include "perf_counter.h"
 
+/**
+ * Number of per-CPU shards for PC_ELAPSED counters. On SMP POSIX builds
+ * perf_begin/perf_end from work queues on different cores otherwise bounce
+ * the counter cache line between cores; each core updates its own shard and
+ * the shards are merged when the counter is read. The flight controller
+ * targets are single core, one shard degenerates to the previous layout.
+ */
+#if defined(__PX4_POSIX)
+static constexpr unsigned PERF_ELAPSED_SHARDS = 4;
+#define PERF_SHARD_ALIGN __attribute__((aligned(64)))
+#else
+static constexpr unsigned PERF_ELAPSED_SHARDS = 1;
+#define PERF_SHARD_ALIGN
+#endif
+
 /**
  * Header common to all counters.
  */
@@ -65,16 +85,23 @@ struct perf_ctr_count : public perf_ctr_header {
 };
 
 /**
- * PC_ELAPSED counter.
+ * Per-CPU shard of a PC_ELAPSED counter.
  */
-struct perf_ctr_elapsed : public perf_ctr_header {
+struct perf_elapsed_shard {
 	uint64_t		event_count{0};
-	uint64_t		time_start{0};
 	uint64_t		time_total{0};
 	uint32_t		time_least{0};
 	uint32_t		time_most{0};
 	float			mean{0.0f};
 	float			M2{0.0f};
+} PERF_SHARD_ALIGN;
+
+/**
+ * PC_ELAPSED counter.
+ */
+struct perf_ctr_elapsed : public perf_ctr_header {
+	uint64_t		time_start{0};
+	perf_elapsed_shard	shard[PERF_ELAPSED_SHARDS];
 };
 
 /**
@@ -107,37 +134,115 @@ pthread_mutex_t perf_counters_mutex = PTHREAD_MUTEX_INITIALIZER;
 // The same holds for shared perf counters (perf_alloc_once), that can be updated
 // concurrently (this affects the 'ctrl_latency' counter).
 
+/**
+ * Preallocated arena backing perf_alloc(). Counters are created at module and
+ * driver startup and essentially never freed, so carve them out of a static
+ * pool instead of the heap: perf_alloc stays cheap on hot startup paths and
+ * does not fragment the heap. Falls back to the heap once the pool is full.
+ */
+static constexpr size_t perf_arena_slot_size()
+{
+	return (sizeof(perf_ctr_elapsed) > sizeof(perf_ctr_interval))
+	       ? ((sizeof(perf_ctr_elapsed) > sizeof(perf_ctr_count)) ? sizeof(perf_ctr_elapsed) : sizeof(perf_ctr_count))
+	       : ((sizeof(perf_ctr_interval) > sizeof(perf_ctr_count)) ? sizeof(perf_ctr_interval) : sizeof(perf_ctr_count));
+}
+
+#if defined(__PX4_POSIX)
+static constexpr size_t PERF_ARENA_SLOTS = 256;
+#else
+static constexpr size_t PERF_ARENA_SLOTS = 64;
+#endif
+
+struct perf_arena_slot {
+	union {
+		perf_arena_slot *next_free;	// freelist linkage while the slot is unused
+		alignas(alignof(perf_ctr_elapsed)) uint8_t storage[perf_arena_slot_size()];
+	};
+};
+
+static perf_arena_slot perf_arena[PERF_ARENA_SLOTS];
+static size_t perf_arena_used = 0;
+static perf_arena_slot *perf_arena_free_list = nullptr;
+
+// must be called with perf_counters_mutex held
+static void *perf_arena_alloc()
+{
+	if (perf_arena_free_list != nullptr) {
+		perf_arena_slot *slot = perf_arena_free_list;
+		perf_arena_free_list = slot->next_free;
+		return slot->storage;
+	}
+
+	if (perf_arena_used < PERF_ARENA_SLOTS) {
+		return perf_arena[perf_arena_used++].storage;
+	}
+
+	return nullptr;
+}
+
+static bool perf_is_arena_ptr(const void *p)
+{
+	return (p >= perf_arena) && (p < perf_arena + PERF_ARENA_SLOTS);
+}
 
 perf_counter_t
 perf_alloc(enum perf_counter_type type, const char *name)
 {
 	perf_counter_t ctr = nullptr;
 
-	switch (type) {
-	case PC_COUNT:
-		ctr = new perf_ctr_count();
-		break;
+	pthread_mutex_lock(&perf_counters_mutex);
+	void *mem = perf_arena_alloc();
+
+	if (mem == nullptr) {
+		// arena exhausted, fall back to the heap
+#if defined(__PX4_POSIX)
+		// the elapsed counter shards are cache line aligned
+		if (posix_memalign(&mem, alignof(perf_ctr_elapsed), perf_arena_slot_size()) != 0) {
+			mem = nullptr;
+		}
 
-	case PC_ELAPSED:
-		ctr = new perf_ctr_elapsed();
-		break;
+#else
+		mem = malloc(perf_arena_slot_size());
+#endif
+	}
 
-	case PC_INTERVAL:
-		ctr = new perf_ctr_interval();
-		break;
+	if (mem != nullptr) {
+		switch (type) {
+		case PC_COUNT:
+			ctr = new (mem) perf_ctr_count();
+			break;
 
-	default:
-		break;
+		case PC_ELAPSED:
+			ctr = new (mem) perf_ctr_elapsed();
+			break;
+
+		case PC_INTERVAL:
+			ctr = new (mem) perf_ctr_interval();
+			break;
+
+		default:
+			// unknown type, return the memory
+			if (perf_is_arena_ptr(mem)) {
+				perf_arena_slot *slot = (perf_arena_slot *)mem;
+				slot->next_free = perf_arena_free_list;
+				perf_arena_free_list = slot;
+
+			} else {
+				free(mem);
+			}
+
+			break;
+		}
 	}
 
 	if (ctr != nullptr) {
 		ctr->type = type;
 		ctr->name = name;
-		pthread_mutex_lock(&perf_counters_mutex);
 		sq_addfirst(&ctr->link, &perf_counters);
-		pthread_mutex_unlock(&perf_counters_mutex);
 	}
 
+	pthread_mutex_unlock(&perf_counters_mutex);
+
 	return ctr;
 }
 
@@ -179,9 +284,76 @@ perf_free(perf_counter_t handle)
 
 	pthread_mutex_lock(&perf_counters_mutex);
 	sq_rem(&handle->link, &perf_counters);
-	pthread_mutex_unlock(&perf_counters_mutex);
 
-	delete handle;
+	if (perf_is_arena_ptr(handle)) {
+		// the counter structs are trivially destructible, recycle the slot
+		perf_arena_slot *slot = (perf_arena_slot *)(void *)handle;
+		slot->next_free = perf_arena_free_list;
+		perf_arena_free_list = slot;
+		pthread_mutex_unlock(&perf_counters_mutex);
+
+	} else {
+		pthread_mutex_unlock(&perf_counters_mutex);
+		free(handle);
+	}
+}
+
+// select the elapsed counter shard for the current CPU
+static inline perf_elapsed_shard &perf_elapsed_current_shard(perf_ctr_elapsed *pce)
+{
+#if defined(__PX4_LINUX)
+	const int cpu = sched_getcpu();
+	return pce->shard[(cpu >= 0) ? (unsigned)cpu % PERF_ELAPSED_SHARDS : 0];
+#else
+	return pce->shard[0];
+#endif
+}
+
+// merge all shards of an elapsed counter into one aggregate for reading
+static void perf_elapsed_merge(const perf_ctr_elapsed *pce, perf_elapsed_shard &out)
+{
+	for (unsigned i = 0; i < PERF_ELAPSED_SHARDS; i++) {
+		const perf_elapsed_shard &s = pce->shard[i];
+
+		if (s.event_count == 0) {
+			continue;
+		}
+
+		if (out.event_count == 0) {
+			out = s;
+			continue;
+		}
+
+		// combine the Knuth/Welford mean and M2 of two shards (Chan et al.)
+		const uint64_t n = out.event_count + s.event_count;
+		const float delta = s.mean - out.mean;
+		out.M2 += s.M2 + delta * delta * ((float)out.event_count * (float)s.event_count / (float)n);
+		out.mean += delta * ((float)s.event_count / (float)n);
+
+		out.time_total += s.time_total;
+
+		if ((out.time_least == 0) || ((s.time_least != 0) && (s.time_least < out.time_least))) {
+			out.time_least = s.time_least;
+		}
+
+		if (s.time_most > out.time_most) {
+			out.time_most = s.time_most;
+		}
+
+		out.event_count = n;
+	}
+}
+
+// increment an event count shared between threads (perf_alloc_once)
+static inline void perf_event_count_increment(uint64_t &event_count)
+{
+#if defined(__PX4_POSIX)
+	// plain atomic add so that concurrent counting on SMP does not lose events
+	__atomic_fetch_add(&event_count, 1, __ATOMIC_RELAXED);
+#else
+	// single core, and a 64 bit atomic would cost a critical section here
+	event_count++;
+#endif
 }
 
 void
@@ -193,7 +365,7 @@ perf_count(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_COUNT:
-		((struct perf_ctr_count *)handle)->event_count++;
+		perf_event_count_increment(((struct perf_ctr_count *)handle)->event_count);
 		break;
 
 	case PC_INTERVAL:
@@ -256,23 +428,24 @@ perf_set_elapsed(perf_counter_t handle, int64_t elapsed)
 			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
 
 			if (elapsed >= 0) {
-				pce->event_count++;
-				pce->time_total += elapsed;
+				perf_elapsed_shard &shard = perf_elapsed_current_shard(pce);
+				shard.event_count++;
+				shard.time_total += elapsed;
 
-				if ((pce->time_least > (uint32_t)elapsed) || (pce->time_least == 0)) {
-					pce->time_least = elapsed;
+				if ((shard.time_least > (uint32_t)elapsed) || (shard.time_least == 0)) {
+					shard.time_least = elapsed;
 				}
 
-				if (pce->time_most < (uint32_t)elapsed) {
-					pce->time_most = elapsed;
+				if (shard.time_most < (uint32_t)elapsed) {
+					shard.time_most = elapsed;
 				}
 
 				// maintain mean and variance of the elapsed time in seconds
 				// Knuth/Welford recursive mean and variance of update intervals (via Wikipedia)
 				float dt = elapsed / 1e6f;
-				float delta_intvl = dt - pce->mean;
-				pce->mean += delta_intvl / pce->event_count;
-				pce->M2 += delta_intvl * (dt - pce->mean);
+				float delta_intvl = dt - shard.mean;
+				shard.mean += delta_intvl / shard.event_count;
+				shard.M2 += delta_intvl * (dt - shard.mean);
 
 				pce->time_start = 0;
 			}
@@ -391,11 +564,12 @@ perf_reset(perf_counter_t handle)
 
 	case PC_ELAPSED: {
 			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			pce->event_count = 0;
 			pce->time_start = 0;
-			pce->time_total = 0;
-			pce->time_least = 0;
-			pce->time_most = 0;
+
+			for (unsigned i = 0; i < PERF_ELAPSED_SHARDS; i++) {
+				pce->shard[i] = perf_elapsed_shard{};
+			}
+
 			break;
 		}
 
@@ -437,16 +611,17 @@ perf_print_counter_fd(int fd, perf_counter_t handle)
 		break;
 
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			float rms = sqrtf(pce->M2 / (pce->event_count - 1));
+			perf_elapsed_shard agg{};
+			perf_elapsed_merge((struct perf_ctr_elapsed *)handle, agg);
+			float rms = sqrtf(agg.M2 / (agg.event_count - 1));
 			dprintf(fd, "%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, min %" PRIu32 "us max %" PRIu32
 				"us %5.3fus rms\n",
 				handle->name,
-				pce->event_count,
-				pce->time_total,
-				(pce->event_count == 0) ? 0 : (double)pce->time_total / (double)pce->event_count,
-				pce->time_least,
-				pce->time_most,
+				agg.event_count,
+				agg.time_total,
+				(agg.event_count == 0) ? 0 : (double)agg.time_total / (double)agg.event_count,
+				agg.time_least,
+				agg.time_most,
 				(double)(1e6f * rms));
 			break;
 		}
@@ -488,16 +663,17 @@ perf_print_counter_buffer(char *buffer, int length, perf_counter_t handle)
 		break;
 
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			float rms = sqrtf(pce->M2 / (pce->event_count - 1));
+			perf_elapsed_shard agg{};
+			perf_elapsed_merge((struct perf_ctr_elapsed *)handle, agg);
+			float rms = sqrtf(agg.M2 / (agg.event_count - 1));
 			num_written = snprintf(buffer, length,
 					       "%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, min %" PRIu32 "us max %" PRIu32 "us %5.3fus rms",
 					       handle->name,
-					       pce->event_count,
-					       pce->time_total,
-					       (pce->event_count == 0) ? 0 : (double)pce->time_total / (double)pce->event_count,
-					       pce->time_least,
-					       pce->time_most,
+					       agg.event_count,
+					       agg.time_total,
+					       (agg.event_count == 0) ? 0 : (double)agg.time_total / (double)agg.event_count,
+					       agg.time_least,
+					       agg.time_most,
 					       (double)(1e6f * rms));
 			break;
 		}
@@ -538,7 +714,13 @@ perf_event_count(perf_counter_t handle)
 
 	case PC_ELAPSED: {
 			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			return pce->event_count;
+			uint64_t event_count = 0;
+
+			for (unsigned i = 0; i < PERF_ELAPSED_SHARDS; i++) {
+				event_count += pce->shard[i].event_count;
+			}
+
+			return event_count;
 		}
 
 	case PC_INTERVAL: {
@@ -562,8 +744,9 @@ perf_mean(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			return pce->mean;
+			perf_elapsed_shard agg{};
+			perf_elapsed_merge((struct perf_ctr_elapsed *)handle, agg);
+			return agg.mean;
 		}
 
 	case PC_INTERVAL: {
@@ -46,6 +46,150 @@
 namespace pid_design
 {
 
+namespace detail
+{
+
+// Minimal constexpr math used to fill the pole tables at build time
+// (<cmath> is not constexpr in C++14)
+constexpr double constexprSqrt(double x)
+{
+	if (x <= 0.0) {
+		return 0.0;
+	}
+
+	double guess = x > 1.0 ? x : 1.0;
+
+	for (int i = 0; i < 32; i++) {
+		guess = 0.5 * (guess + x / guess);
+	}
+
+	return guess;
+}
+
+constexpr double constexprExp(double x)
+{
+	double term = 1.0;
+	double sum = 1.0;
+
+	for (int i = 1; i < 30; i++) {
+		term *= x / static_cast<double>(i);
+		sum += term;
+	}
+
+	return sum;
+}
+
+constexpr double constexprCos(double x)
+{
+	const double x2 = x * x;
+	double term = 1.0;
+	double sum = 1.0;
+
+	for (int i = 1; i < 12; i++) {
+		term *= -x2 / static_cast<double>((2 * i - 1) * (2 * i));
+		sum += term;
+	}
+
+	return sum;
+}
+
+struct PoleTerms {
+	float p1;
+	float p2;
+	float g; ///< (1 + p1 + p2) / rho^2: the sum is O(rho^2) and cancels catastrophically
+	///< in float, so it is computed in double and stored normalized by rho^2
+};
+
+constexpr PoleTerms computePoles(double rho, double mu)
+{
+	const double p1 = -2.0 * constexprExp(-rho / (2.0 * mu))
+			  * constexprCos(constexprSqrt(4.0 * mu - 1.0) * rho / (2.0 * mu));
+	const double p2 = constexprExp(-rho / mu);
+
+	// lim rho->0 of (1 + p1 + p2) / rho^2 is 1 / mu
+	const double g = (rho > 0.0) ? ((1.0 + p1 + p2) / (rho * rho)) : (1.0 / mu);
+
+	return PoleTerms{static_cast<float>(p1), static_cast<float>(p2), static_cast<float>(g)};
+}
+
+// Grid over the normalized sampling rate rho = dt / sigma and the inverse
+// damping index w = 1 / mu. The poles only depend on mu through rho / mu, so
+// they are nearly polynomial in w and a coarse grid suffices on that axis.
+// The gain formulas divide by small differences of the pole locations, so
+// both axes use cubic interpolation.
+static constexpr unsigned kRhoSteps = 65;
+static constexpr unsigned kWSteps = 9;
+static constexpr float kRhoMax = 0.5f;
+static constexpr float kWMin = 1.f / 0.51f;
+static constexpr float kWMax = 1.f / 0.25f;
+
+struct PoleTable {
+	PoleTerms poles[kWSteps][kRhoSteps] {};
+};
+
+constexpr PoleTable generatePoleTable()
+{
+	PoleTable table{};
+
+	for (unsigned i = 0; i < kWSteps; i++) {
+		const double w = static_cast<double>(kWMin)
+				 + static_cast<double>(kWMax - kWMin) * static_cast<double>(i) / static_cast<double>(kWSteps - 1);
+
+		for (unsigned j = 0; j < kRhoSteps; j++) {
+			const double rho = kRhoMax * static_cast<double>(j) / static_cast<double>(kRhoSteps - 1);
+			table.poles[i][j] = computePoles(rho, 1.0 / w);
+		}
+	}
+
+	return table;
+}
+
+static constexpr PoleTable kPoleTable = generatePoleTable();
+
+// Cubic Lagrange weights through 4 consecutive grid nodes, evaluated at
+// t in [0, 3] relative to the first node of the stencil
+inline void cubicWeights(float t, float w[4])
+{
+	w[0] = -(t - 1.f) * (t - 2.f) * (t - 3.f) / 6.f;
+	w[1] = t * (t - 2.f) * (t - 3.f) * 0.5f;
+	w[2] = -t * (t - 1.f) * (t - 3.f) * 0.5f;
+	w[3] = t * (t - 1.f) * (t - 2.f) / 6.f;
+}
+
+// Translate the closed-loop pole locations into PID gains (common tail of the
+// direct and the table-driven synthesis)
+inline matrix::Vector3f gainsFromPoles(float p1, float p2, float s, const matrix::Vector3f &num,
+				       const matrix::Vector3f &den, float dt, float lbda)
+{
+	const float a1 = den(1);
+	const float a2 = den(2);
+	const float b0 = num(0);
+	const float b1 = num(1);
+	const float b2 = num(2);
+
+	const float e1 = -a1 + p1 + 1.f;
+	const float f1 = a1 * e1 - a2 * e1 + a2;
+	const float f2 = a2 * e1;
+
+	// Translate to PID gains
+	const float nu = lbda + (e1 + 1.f) * (b0 + b1 + b2);
+
+	if (fabsf(nu) < FLT_EPSILON) {
+		return matrix::Vector3f();
+	}
+
+	const float kc = -(f1 + 2.f * f2) / nu;
+	// f0 + f1 + f2 reduces to s = 1 + p1 + p2, which is passed in separately
+	// as it is O(rho^2) and would cancel catastrophically at fast sampling
+	float ki = -s / (dt * (f1 + 2.f * f2));
+	ki /= 5.f; // This is not part of the original implementation but is required to produce reasonable gains
+	const float kd = -dt * f2 / (f1 + 2.f * f2);
+
+	return matrix::Vector3f(kc, ki, kd);
+}
+
+} // namespace detail
+
 /*
 * Compute a set of PID gains using General Minimum Variance Control law design
 *
@@ -72,34 +216,66 @@ inline matrix::Vector3f computePidGmvc(const matrix::Vector3f &num, const matrix
 	delta = math::constrain(delta, 0.f, 1.f);
 	lbda = math::constrain(lbda, 0.f, 10.f);
 
-	const float a1 = den(1);
-	const float a2 = den(2);
-	const float b0 = num(0);
-	const float b1 = num(1);
-	const float b2 = num(2);
-
 	// Solve GMVC law (see derivation in pid_synthesis_symbolic.py)
 	const float rho = dt / sigma;
 	const float mu = 0.25f * (1.f - delta) + 0.51f * delta; // mu is in the interval [0.25 0.51]
 	const float p1 = -2.f * expf(-rho / (2.f * mu)) * cosf(sqrtf(4.f * mu - 1.f) * rho / (2.f * mu));
 	const float p2 = expf(-rho / mu);
-	const float e1 = -a1 + p1 + 1.f;
-	const float f0 = -a1 * e1 + a1 - a2 + e1 + p2;
-	const float f1 = a1 * e1 - a2 * e1 + a2;
-	const float f2 = a2 * e1;
 
-	// Translate to PID gains
-	const float nu = lbda + (e1 + 1.f) * (b0 + b1 + b2);
+	return detail::gainsFromPoles(p1, p2, 1.f + p1 + p2, num, den, dt, lbda);
+}
 
-	if (fabsf(nu) < FLT_EPSILON) {
-		return matrix::Vector3f();
+/*
+* Table-driven variant of computePidGmvc
+*
+* The closed-loop pole locations are precomputed over a (rho, 1/mu) grid at
+* build time and interpolated with a bicubic stencil, so proposing gains
+* costs a handful of multiplies and no transcendental functions. This is
+* cheap enough to run on every sample of an autotune maneuver. Falls back to
+* the closed-form computation outside the tabulated range.
+*/
+inline matrix::Vector3f computePidGmvcTabulated(const matrix::Vector3f &num, const matrix::Vector3f &den, float dt,
+		float sigma = 0.1f, float delta = 1.f, float lbda = 0.5f)
+{
+	sigma = math::constrain(sigma, 0.01f, 1.f);
+	delta = math::constrain(delta, 0.f, 1.f);
+	lbda = math::constrain(lbda, 0.f, 10.f);
+
+	const float rho = dt / sigma;
+
+	if (rho > detail::kRhoMax) {
+		return computePidGmvc(num, den, dt, sigma, delta, lbda);
 	}
 
-	const float kc = -(f1 + 2.f * f2) / nu;
-	float ki = -(f0 + f1 + f2) / (dt * (f1 + 2.f * f2));
-	ki /= 5.f; // This is not part of the original implementation but is required to produce reasonable gains
-	const float kd = -dt * f2 / (f1 + 2.f * f2);
+	const float mu = 0.25f * (1.f - delta) + 0.51f * delta; // mu is in the interval [0.25 0.51]
+	const float w = 1.f / mu;
 
-	return matrix::Vector3f(kc, ki, kd);
+	const float rho_pos = rho / detail::kRhoMax * static_cast<float>(detail::kRhoSteps - 1);
+	const float w_pos = (w - detail::kWMin) / (detail::kWMax - detail::kWMin)
+			    * static_cast<float>(detail::kWSteps - 1);
+
+	// 4-point stencil base indices, shifted inwards at the grid edges
+	const unsigned j = math::constrain(static_cast<int>(rho_pos) - 1, 0, static_cast<int>(detail::kRhoSteps) - 4);
+	const unsigned i = math::constrain(static_cast<int>(w_pos) - 1, 0, static_cast<int>(detail::kWSteps) - 4);
+
+	float wj[4];
+	float wi[4];
+	detail::cubicWeights(rho_pos - static_cast<float>(j), wj);
+	detail::cubicWeights(math::constrain(w_pos, 0.f, static_cast<float>(detail::kWSteps - 1)) - static_cast<float>(i),
+			     wi);
+
+	float p1 = 0.f;
+	float p2 = 0.f;
+	float g = 0.f;
+
+	for (unsigned row = 0; row < 4; row++) {
+		const detail::PoleTerms *line = &detail::kPoleTable.poles[i + row][j];
+
+		p1 += wi[row] * (wj[0] * line[0].p1 + wj[1] * line[1].p1 + wj[2] * line[2].p1 + wj[3] * line[3].p1);
+		p2 += wi[row] * (wj[0] * line[0].p2 + wj[1] * line[1].p2 + wj[2] * line[2].p2 + wj[3] * line[3].p2);
+		g += wi[row] * (wj[0] * line[0].g + wj[1] * line[1].g + wj[2] * line[2].g + wj[3] * line[3].g);
+	}
+
+	return detail::gainsFromPoles(p1, p2, g * rho * rho, num, den, dt, lbda);
 }
 } // namespace pid_design
@@ -56,3 +56,24 @@ TEST(PidDesignTest, testImpl)
 	EXPECT_NEAR(kid(1), 11.911f / 5.f, .001f);
 	EXPECT_NEAR(kid(2), 0.0463f, .0001f);
 }
+
+TEST(PidDesignTest, testTabulated)
+{
+	const Vector3f num(.0098f, -0.162f, .147f);
+	const Vector3f den(1.f, -1.814f, .822f);
+
+	// The table-driven synthesis matches the closed-form computation over the
+	// range of sampling times and rise times used by the autotuners
+	for (float dt = 0.002f; dt < 0.02f; dt += 0.002f) {
+		for (float sigma = 0.05f; sigma < 0.3f; sigma += 0.05f) {
+			for (float delta = 0.f; delta <= 1.f; delta += 0.25f) {
+				const Vector3f kid = computePidGmvc(num, den, dt, sigma, delta, 0.5f);
+				const Vector3f kid_tab = computePidGmvcTabulated(num, den, dt, sigma, delta, 0.5f);
+
+				EXPECT_NEAR(kid_tab(0), kid(0), 0.0001f);
+				EXPECT_NEAR(kid_tab(1), kid(1), 0.01f);
+				EXPECT_NEAR(kid_tab(2), kid(2), 0.0005f);
+			}
+		}
+	}
+}
@@ -60,8 +60,8 @@ Vector3f RateControl::update(const Vector3f &rate, const Vector3f &rate_sp, cons
 	// angular rates error
 	Vector3f rate_error = rate_sp - rate;
 
-	// PID control with feed forward
-	const Vector3f torque = _gain_p.emult(rate_error) + _rate_int - _gain_d.emult(angular_accel) + _gain_ff.emult(rate_sp);
+	// PID control with feed forward, evaluated in a single pass per axis
+	Vector3f torque = math::kernels::pid3(rate_error, _rate_int, angular_accel, rate_sp, _gain_p, _gain_d, _gain_ff);
 
 	// update integral only if we are not landed
 	if (!landed) {
@@ -35,6 +35,8 @@
  * @file SlewRate.hpp
  *
  * Library limit the rate of change of a value with a maximum slew rate.
+ * The templated type can also be a matrix::Vector to limit multiple
+ * axes with individual rates in one batched update.
  *
  * @author Matthias Grob <maetugr@gmail.com>
  */
@@ -80,12 +82,23 @@ public:
 		// Limit the rate of change of the value
 		const Type dvalue_desired = new_value - _value;
 		const Type dvalue_max = _slew_rate * deltatime;
-		const Type dvalue = math::constrain(dvalue_desired, -dvalue_max, dvalue_max);
+		const Type dvalue = limit(dvalue_desired, dvalue_max);
 		_value += dvalue;
 		return _value;
 	}
 
 protected:
+	static float limit(const float value, const float max_abs)
+	{
+		return math::constrain(value, -max_abs, max_abs);
+	}
+
+	template<typename T, size_t M, size_t N>
+	static matrix::Matrix<T, M, N> limit(const matrix::Matrix<T, M, N> &value, const matrix::Matrix<T, M, N> &max_abs)
+	{
+		return matrix::constrain(value, -max_abs, max_abs);
+	}
+
 	Type _slew_rate{}; ///< maximum rate of change for the value
 	Type _value{}; ///< state to keep last value of the slew rate
 };
@@ -56,6 +56,19 @@ TEST(SlewRateTest, SlewDownLimited)
 	}
 }
 
+TEST(SlewRateTest, SlewVectorBatched)
+{
+	SlewRate<matrix::Vector2f> _slew_rate;
+	_slew_rate.setSlewRate(matrix::Vector2f(.1f, 1.f));
+	_slew_rate.setForcedValue(matrix::Vector2f(0.f, 0.f));
+
+	for (int i = 1; i <= 10; i++) {
+		const matrix::Vector2f limited = _slew_rate.update(matrix::Vector2f(20.f, -20.f), .2f);
+		EXPECT_FLOAT_EQ(limited(0), i * .02f);
+		EXPECT_FLOAT_EQ(limited(1), -i * .2f);
+	}
+}
+
 TEST(SlewRateTest, ReachValueSlewed)
 {
 	SlewRate<float> _slew_rate;
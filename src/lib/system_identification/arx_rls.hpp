@@ -88,9 +88,16 @@ public:
 	{
 		/* _P.uncorrelateCovarianceSetVariance<N + M + 1>(0, 10e3f); // does not work */
 		_P.setZero();
+		_R.setZero();
+		_b.setZero();
 
 		for (size_t i = 0; i < (N + M + 1); i++) {
 			_P(i, i) = 10e3f;
+
+			// seed the normal equations with the matching prior so that the
+			// batch solution starts from the same regularization and estimate
+			_R(i, i) = 1.f / _P(i, i);
+			_b(i) = _R(i, i) * theta_init(i);
 		}
 
 		_diff_theta_hat.setZero();
@@ -111,8 +118,6 @@ public:
 
 	void update(float u, float y)
 	{
-		const matrix::Vector < float, N + M + 1 > theta_prev = _theta_hat;
-
 		addInputOutput(u, y);
 
 		if (!isBufferFull()) {
@@ -121,20 +126,111 @@ public:
 			return;
 		}
 
-		const matrix::Vector < float, N + M + 1 > phi = constructDesignVector();
-		const matrix::Matrix < float, 1, N + M + 1 > phi_t = phi.transpose();
+		float phi[N + M + 1];
+		constructDesignVector(phi);
+
+		// streaming form: the update is computed in place with fixed-size
+		// arrays instead of matrix expressions building temporaries
+		float P_phi[N + M + 1];
+		float phi_P_phi = 0.f;
+		float phi_theta = 0.f;
+
+		for (size_t i = 0; i < (N + M + 1); i++) {
+			float acc = 0.f;
+
+			for (size_t j = 0; j < (N + M + 1); j++) {
+				acc += _P(i, j) * phi[j];
+			}
+
+			P_phi[i] = acc;
+			phi_P_phi += phi[i] * acc;
+			phi_theta += phi[i] * _theta_hat(i);
+		}
 
-		_P = (_P - _P * phi * phi_t * _P / (_lambda + (phi_t * _P * phi)(0, 0))) / _lambda;
-		_innovation = _y[N] - (phi_t * _theta_hat)(0, 0);
-		_theta_hat = _theta_hat + _P * phi * _innovation;
+		const float denom = _lambda + phi_P_phi;
+		_innovation = _y[N] - phi_theta;
 
-		for (size_t i = 0; i < N + M + 1; i++) {
-			_diff_theta_hat(i) = fabsf(_theta_hat(i) - theta_prev(i));
+		// the gain with the updated covariance reduces to P*phi / denom, so the
+		// estimate can be corrected without re-multiplying the updated matrix
+		for (size_t i = 0; i < (N + M + 1); i++) {
+			const float dtheta = P_phi[i] * _innovation / denom;
+			_theta_hat(i) += dtheta;
+			_diff_theta_hat(i) = fabsf(dtheta);
+
+			for (size_t j = 0; j <= i; j++) {
+				const float p = (_P(i, j) - P_phi[i] * P_phi[j] / denom) / _lambda;
+				_P(i, j) = p;
+				_P(j, i) = p;
+			}
 		}
 
 		/* fixCovarianceErrors(); // TODO: this could help against ill-conditioned matrix but needs more testing*/
 	}
 
+	/*
+	 * Accumulate the sample into the forgetting-weighted normal equations
+	 * without updating the estimate. Together with solve() this allows
+	 * decimated batch updates: accumulate every sample at loop rate (one outer
+	 * product) and solve once every couple of samples.
+	 */
+	void accumulate(float u, float y)
+	{
+		addInputOutput(u, y);
+
+		if (!isBufferFull()) {
+			return;
+		}
+
+		float phi[N + M + 1];
+		constructDesignVector(phi);
+
+		float phi_theta = 0.f;
+
+		for (size_t i = 0; i < (N + M + 1); i++) {
+			for (size_t j = 0; j <= i; j++) {
+				const float r = _lambda * _R(i, j) + phi[i] * phi[j];
+				_R(i, j) = r;
+				_R(j, i) = r;
+			}
+
+			_b(i) = _lambda * _b(i) + phi[i] * _y[N];
+			phi_theta += phi[i] * _theta_hat(i);
+		}
+
+		_innovation = _y[N] - phi_theta;
+	}
+
+	/*
+	 * Solve the accumulated normal equations. With the same samples and
+	 * forgetting factor the result matches the recursive update: the
+	 * information matrix is the inverse of the RLS covariance.
+	 *
+	 * @return true if the accumulated system was solvable
+	 */
+	bool solve()
+	{
+		matrix::SquareMatrix < float, N + M + 1 > R_inv;
+
+		if (!matrix::inv(_R, R_inv)) {
+			return false;
+		}
+
+		for (size_t i = 0; i < (N + M + 1); i++) {
+			float acc = 0.f;
+
+			for (size_t j = 0; j < (N + M + 1); j++) {
+				acc += R_inv(i, j) * _b(j);
+			}
+
+			_diff_theta_hat(i) = fabsf(acc - _theta_hat(i));
+			_theta_hat(i) = acc;
+		}
+
+		_P = R_inv;
+
+		return true;
+	}
+
 private:
 	void addInputOutput(float u, float y)
 	{
@@ -160,22 +256,18 @@ private:
 
 	bool isBufferFull() const { return _nb_samples > (M + N + D); }
 
-	matrix::Vector < float, N + M + 1 > constructDesignVector() const
+	void constructDesignVector(float phi[N + M + 1]) const
 	{
-		matrix::Vector < float, N + M + 1 > phi;
-
 		for (size_t i = 0; i < N; i++) {
-			phi(i) = -_y[N - i - 1];
+			phi[i] = -_y[N - i - 1];
 		}
 
 		int j = 0;
 
 		for (size_t i = N; i < (N + M + 1); i++) {
-			phi(i) = _u[M - j];
+			phi[i] = _u[M - j];
 			j++;
 		}
-
-		return phi;
 	}
 
 	void fixCovarianceErrors()
@@ -198,6 +290,8 @@ private:
 	}
 
 	matrix::SquareMatrix < float, N + M + 1 > _P;
+	matrix::SquareMatrix < float, N + M + 1 > _R; ///< accumulated normal equations (information matrix)
+	matrix::Vector < float, N + M + 1 > _b;
 	matrix::Vector < float, N + M + 1 > _theta_hat;
 	matrix::Vector < float, N + M + 1 > _diff_theta_hat;
 	float _innovation{};
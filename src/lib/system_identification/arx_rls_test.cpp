@@ -90,6 +90,32 @@ TEST_F(ArxRlsTest, test221)
 	coefficients_check.print();
 }
 
+TEST_F(ArxRlsTest, batchAccumulation)
+{
+	// GIVEN: two identical estimators, one updated recursively on every sample,
+	// the other accumulating the normal equations and solving once at the end,
+	// both fed the same persistently exciting input sequence
+	ArxRls<2, 2, 1> rls_recursive;
+	ArxRls<2, 2, 1> rls_batch;
+
+	float u = 0.f;
+	float y = 0.f;
+
+	for (int k = 0; k < 40; k++) {
+		u = (k % 5) - 2.f + 0.3f * (k % 3);
+		y = 0.6f * y + 0.5f * u + 0.1f;
+		rls_recursive.update(u, y);
+		rls_batch.accumulate(u, y);
+	}
+
+	// WHEN: solving the accumulated system
+	EXPECT_TRUE(rls_batch.solve());
+
+	// THEN: both estimates are the solution of the same weighted least-squares problem
+	EXPECT_TRUE((rls_batch.getCoefficients() - rls_recursive.getCoefficients()).abs().max() < 1e-2f);
+	EXPECT_TRUE((rls_batch.getVariances() - rls_recursive.getVariances()).abs().max() < 0.1f);
+}
+
 TEST_F(ArxRlsTest, resetTest)
 {
 	ArxRls<2, 2, 1> _rls;
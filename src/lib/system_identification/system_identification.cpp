@@ -50,6 +50,7 @@ void SystemIdentification::reset(const matrix::Vector<float, 5> &id_state_init)
 	_y_prev = 0.f;
 	_fitness_lpf.reset(10.f);
 	_are_filters_initialized = false;
+	_sample_count = 0;
 }
 
 void SystemIdentification::update(float u, float y)
@@ -60,8 +61,21 @@ void SystemIdentification::update(float u, float y)
 
 void SystemIdentification::update()
 {
-	_rls.update(_u_hpf, _y_hpf);
-	updateFitness();
+	if (_update_decimation > 1) {
+		_rls.accumulate(_u_hpf, _y_hpf);
+
+		if (++_sample_count >= _update_decimation) {
+			_sample_count = 0;
+
+			if (_rls.solve()) {
+				updateFitness();
+			}
+		}
+
+	} else {
+		_rls.update(_u_hpf, _y_hpf);
+		updateFitness();
+	}
 }
 
 void SystemIdentification::updateFilters(float u, float y)
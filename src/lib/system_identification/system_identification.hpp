@@ -73,6 +73,13 @@ public:
 	void setHpfCutoffFrequency(float sample_freq, float cutoff) { _alpha_hpf = sample_freq / (sample_freq + 2.f * M_PI_F * cutoff); }
 
 	void setForgettingFactor(float time_constant, float dt) { _rls.setForgettingFactor(time_constant, dt); }
+
+	/**
+	 * Decimate the model update: accumulate the normal equations on every sample
+	 * and only solve for the coefficients every n samples (1 = recursive update
+	 * on every sample). The estimate is identical, only its refresh rate drops.
+	 */
+	void setUpdateDecimation(unsigned n) { _update_decimation = math::max(n, 1u); }
 	void setFitnessLpfTimeConstant(float time_constant, float dt)
 	{
 		_fitness_lpf.setParameters(dt, time_constant);
@@ -97,6 +104,9 @@ private:
 
 	bool _are_filters_initialized{false};
 
+	unsigned _update_decimation{1};
+	unsigned _sample_count{0};
+
 	AlphaFilter<float> _fitness_lpf;
 	float _dt{0.1f};
 };
@@ -51,56 +51,14 @@ static constexpr float DT_MAX = 1.0f;	///< max value of _dt allowed before a fil
  */
 
 /*
- * This function implements a complementary filter to estimate the climb rate when
- * inertial nav data is not available. It also calculates a true airspeed derivative
- * which is used by the airspeed complimentary filter.
+ * This function implements a second order complementary filter to obtain a smoothed
+ * true airspeed estimate from the equivalent airspeed measurement and the raw true
+ * airspeed derivative supplied to update_pitch_throttle().
  */
-void TECS::update_vehicle_state_estimates(float equivalent_airspeed, const float speed_deriv_forward,
-		bool altitude_lock, float altitude, float vz)
-{
-	// calculate the time lapsed since the last update
-	uint64_t now = hrt_absolute_time();
-	float dt = fmaxf((now - _state_update_timestamp) * 1e-6f, DT_MIN);
-
-	bool reset_altitude = false;
-
-	if (_state_update_timestamp == 0 || dt > DT_MAX) {
-		dt = DT_DEFAULT;
-		reset_altitude = true;
-	}
-
-	if (!altitude_lock) {
-		reset_altitude = true;
-	}
-
-	if (reset_altitude) {
-		_states_initialized = false;
-	}
-
-	_state_update_timestamp = now;
-	_EAS = equivalent_airspeed;
-
-	// Set the velocity and position state to the the INS data
-	_vert_vel_state = -vz;
-	_vert_pos_state = altitude;
-
-	// Update and average speed rate of change if airspeed is being measured
-	if (PX4_ISFINITE(equivalent_airspeed) && airspeed_sensor_enabled()) {
-		_tas_rate_raw = speed_deriv_forward;
-		// Apply some noise filtering
-		_TAS_rate_filter.update(speed_deriv_forward);
-		_tas_rate_filtered = _TAS_rate_filter.getState();
-
-	} else {
-		_tas_rate_raw = 0.0f;
-		_tas_rate_filtered = 0.0f;
-	}
-}
-
-void TECS::_update_speed_states(float equivalent_airspeed_setpoint, float equivalent_airspeed, float EAS2TAS)
+void TECS::_update_speed_states(float equivalent_airspeed_setpoint, float equivalent_airspeed, float EAS2TAS,
+				uint64_t now)
 {
 	// Calculate the time in seconds since the last update and use the default time step value if out of bounds
-	uint64_t now = hrt_absolute_time();
 	const float dt = constrain((now - _speed_update_timestamp) * 1.0e-6f, DT_MIN, DT_MAX);
 
 	// Convert equivalent airspeed quantities to true airspeed
@@ -566,12 +524,36 @@ void TECS::update_pitch_throttle(float pitch, float baro_altitude, float hgt_set
 				 float EAS_setpoint, float equivalent_airspeed, float eas_to_tas, bool climb_out_setpoint, float pitch_min_climbout,
 				 float throttle_min, float throttle_max, float throttle_trim,
 				 float pitch_limit_min, float pitch_limit_max,
-				 float target_climbrate, float target_sinkrate, float hgt_rate_sp)
+				 float target_climbrate, float target_sinkrate,
+				 const float speed_deriv_forward, bool altitude_lock, float vz, float hgt_rate_sp)
 {
 	// Calculate the time since last update (seconds)
 	uint64_t now = hrt_absolute_time();
 	_dt = fmaxf((now - _pitch_update_timestamp) * 1e-6f, DT_MIN);
 
+	// Capture the vehicle state estimates (previously a separate per-cycle pass)
+	if (_pitch_update_timestamp == 0 || _dt > DT_MAX || !altitude_lock) {
+		_states_initialized = false;
+	}
+
+	_EAS = equivalent_airspeed;
+
+	// Set the velocity and position state to the the INS data
+	_vert_vel_state = -vz;
+	_vert_pos_state = baro_altitude;
+
+	// Update and average speed rate of change if airspeed is being measured
+	if (PX4_ISFINITE(equivalent_airspeed) && airspeed_sensor_enabled()) {
+		_tas_rate_raw = speed_deriv_forward;
+		// Apply some noise filtering
+		_TAS_rate_filter.update(speed_deriv_forward);
+		_tas_rate_filtered = _TAS_rate_filter.getState();
+
+	} else {
+		_tas_rate_raw = 0.0f;
+		_tas_rate_filtered = 0.0f;
+	}
+
 	// Set class variables from inputs
 	_throttle_setpoint_max = throttle_max;
 	_throttle_setpoint_min = throttle_min;
@@ -586,7 +568,7 @@ void TECS::update_pitch_throttle(float pitch, float baro_altitude, float hgt_set
 	_updateTrajectoryGenerationConstraints();
 
 	// Update the true airspeed state estimate
-	_update_speed_states(EAS_setpoint, equivalent_airspeed, eas_to_tas);
+	_update_speed_states(EAS_setpoint, equivalent_airspeed, eas_to_tas, now);
 
 	// Calculate rate limits for specific total energy
 	_update_STE_rate_lim();
@@ -73,23 +73,18 @@ public:
 	 */
 	void enable_airspeed(bool enabled) { _airspeed_enabled = enabled; }
 
-	/**
-	 * Updates the following vehicle kineamtic state estimates:
-	 * Vertical position, velocity and acceleration.
-	 * Speed derivative
-	 * Must be called prior to udating tecs control loops
-	 * Must be called at 50Hz or greater
-	 */
-	void update_vehicle_state_estimates(float equivalent_airspeed, const float speed_deriv_forward, bool altitude_lock,
-					    float altitude, float vz);
-
 	/**
 	 * Update the control loop calculations
+	 *
+	 * Captures the vehicle kinematic state estimates (vertical position, velocity and
+	 * speed derivative) and runs the control loop calculations in a single pass.
+	 * Must be called at 50Hz or greater
 	 */
 	void update_pitch_throttle(float pitch, float baro_altitude, float hgt_setpoint,
 				   float EAS_setpoint, float equivalent_airspeed, float eas_to_tas, bool climb_out_setpoint, float pitch_min_climbout,
 				   float throttle_min, float throttle_setpoint_max, float throttle_trim,
-				   float pitch_limit_min, float pitch_limit_max, float target_climbrate, float target_sinkrate, float hgt_rate_sp = NAN);
+				   float pitch_limit_min, float pitch_limit_max, float target_climbrate, float target_sinkrate,
+				   const float speed_deriv_forward, bool altitude_lock, float vz, float hgt_rate_sp = NAN);
 
 	float get_throttle_setpoint() { return _last_throttle_setpoint; }
 	float get_pitch_setpoint() { return _last_pitch_setpoint; }
@@ -228,7 +223,6 @@ private:
 	enum ECL_TECS_MODE _tecs_mode {ECL_TECS_MODE_NORMAL};
 
 	// timestamps
-	uint64_t _state_update_timestamp{0};				///< last timestamp of the 50 Hz function call
 	uint64_t _speed_update_timestamp{0};				///< last timestamp of the speed function call
 	uint64_t _pitch_update_timestamp{0};				///< last timestamp of the pitch function call
 
@@ -331,7 +325,7 @@ private:
 	/**
 	 * Update the airspeed internal state using a second order complementary filter
 	 */
-	void _update_speed_states(float airspeed_setpoint, float equivalent_airspeed, float cas_to_tas);
+	void _update_speed_states(float airspeed_setpoint, float equivalent_airspeed, float cas_to_tas, uint64_t now);
 
 	/**
 	 * Update the desired airspeed
@@ -0,0 +1,316 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "TerrainCache.hpp"
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <px4_platform_common/defines.h>
+
+using namespace time_literals;
+
+namespace terrain
+{
+
+static constexpr const char *TERRAIN_STORE_DIR = PX4_STORAGEDIR "/terrain";
+
+// meters per degree of latitude (and of longitude at the equator)
+static constexpr double M_PER_DEG = 111320.0;
+
+// a tile in the RAM hot set is re-read at most this often when a query hits a
+// post that has no data yet (new TERRAIN_DATA may have landed on disk meanwhile)
+static constexpr hrt_abstime TILE_REFRESH_INTERVAL = 10_s;
+
+static inline int32_t lat_to_idx(double lat) { return (int32_t)floor((lat + 90.0) / TILE_SIZE_DEG); }
+static inline int32_t lon_to_idx(double lon) { return (int32_t)floor((lon + 180.0) / TILE_SIZE_DEG); }
+
+static inline int post_index(double value_deg, double offset, int32_t tile_idx)
+{
+	// nearest post within the tile
+	const double frac = (value_deg + offset) / TILE_SIZE_DEG - tile_idx;
+	int post = (int)(frac * TILE_GRID_DIM + 0.5);
+
+	if (post < 0) { post = 0; }
+
+	if (post > TILE_GRID_DIM - 1) { post = TILE_GRID_DIM - 1; }
+
+	return post;
+}
+
+TerrainCache::TerrainCache() :
+	WorkItem("terrain_cache", px4::wq_configurations::lp_default)
+{
+}
+
+TerrainCache::~TerrainCache()
+{
+	pthread_mutex_destroy(&_mutex);
+}
+
+TerrainCache::CacheSlot *TerrainCache::findResident(int32_t lat_idx, int32_t lon_idx)
+{
+	for (auto &slot : _slots) {
+		if (slot.valid && (slot.tile.lat_idx == lat_idx) && (slot.tile.lon_idx == lon_idx)) {
+			return &slot;
+		}
+	}
+
+	return nullptr;
+}
+
+void TerrainCache::requestLoad(int32_t lat_idx, int32_t lon_idx)
+{
+	// single pending request: the most recent query wins, earlier hints are
+	// re-issued by their callers on the next evaluation anyway
+	_pending_lat_idx = lat_idx;
+	_pending_lon_idx = lon_idx;
+	_pending = true;
+	ScheduleNow();
+}
+
+bool TerrainCache::lookup(double lat, double lon, float &elevation_amsl_m)
+{
+	const int32_t lat_idx = lat_to_idx(lat);
+	const int32_t lon_idx = lon_to_idx(lon);
+
+	bool found = false;
+	bool load = false;
+
+	pthread_mutex_lock(&_mutex);
+	CacheSlot *slot = findResident(lat_idx, lon_idx);
+
+	if (slot != nullptr) {
+		slot->last_used = hrt_absolute_time();
+
+		const int row = post_index(lat, 90.0, lat_idx);
+		const int col = post_index(lon, 180.0, lon_idx);
+
+		if (slot->tile.valid[row] & (1u << col)) {
+			elevation_amsl_m = slot->tile.elevation_m[row][col];
+			found = true;
+
+		} else if (hrt_elapsed_time(&slot->loaded_time) > TILE_REFRESH_INTERVAL) {
+			// the post may have arrived on disk since the tile was loaded
+			requestLoad(lat_idx, lon_idx);
+			load = true;
+		}
+
+	} else {
+		requestLoad(lat_idx, lon_idx);
+		load = true;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	(void)load;
+	return found;
+}
+
+void TerrainCache::prefetch(double lat, double lon)
+{
+	const int32_t lat_idx = lat_to_idx(lat);
+	const int32_t lon_idx = lon_to_idx(lon);
+
+	pthread_mutex_lock(&_mutex);
+
+	if (findResident(lat_idx, lon_idx) == nullptr) {
+		requestLoad(lat_idx, lon_idx);
+	}
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+void TerrainCache::Run()
+{
+	pthread_mutex_lock(&_mutex);
+
+	if (!_pending) {
+		pthread_mutex_unlock(&_mutex);
+		return;
+	}
+
+	const int32_t lat_idx = _pending_lat_idx;
+	const int32_t lon_idx = _pending_lon_idx;
+	_pending = false;
+	pthread_mutex_unlock(&_mutex);
+
+	// SD I/O outside the lock: queries keep running against the current hot set
+	TerrainTile tile{};
+
+	if (!readTileFile(lat_idx, lon_idx, tile)) {
+		return;
+	}
+
+	pthread_mutex_lock(&_mutex);
+	CacheSlot *slot = findResident(lat_idx, lon_idx);
+
+	if (slot == nullptr) {
+		// evict the least recently used slot
+		slot = &_slots[0];
+
+		for (auto &candidate : _slots) {
+			if (!candidate.valid) {
+				slot = &candidate;
+				break;
+			}
+
+			if (candidate.last_used < slot->last_used) {
+				slot = &candidate;
+			}
+		}
+	}
+
+	slot->tile = tile;
+	slot->last_used = hrt_absolute_time();
+	slot->loaded_time = slot->last_used;
+	slot->valid = true;
+	pthread_mutex_unlock(&_mutex);
+}
+
+void TerrainCache::store(double lat_sw, double lon_sw, float grid_spacing_m, const int16_t elevations[16])
+{
+	const double lat_spacing_deg = grid_spacing_m / M_PER_DEG;
+	const double lon_spacing_deg = grid_spacing_m / (M_PER_DEG * cos(lat_sw * M_PI / 180.0));
+
+	TerrainTile tile{};
+	bool tile_loaded = false;
+	bool tile_dirty = false;
+
+	for (int r = 0; r < 4; r++) {
+		for (int c = 0; c < 4; c++) {
+			const double lat = lat_sw + r * lat_spacing_deg;
+			const double lon = lon_sw + c * lon_spacing_deg;
+
+			const int32_t lat_idx = lat_to_idx(lat);
+			const int32_t lon_idx = lon_to_idx(lon);
+
+			if (!tile_loaded || (tile.lat_idx != lat_idx) || (tile.lon_idx != lon_idx)) {
+				if (tile_dirty) {
+					writeTileFile(tile);
+					tile_dirty = false;
+				}
+
+				if (!readTileFile(lat_idx, lon_idx, tile)) {
+					memset(&tile, 0, sizeof(tile));
+					tile.lat_idx = lat_idx;
+					tile.lon_idx = lon_idx;
+				}
+
+				tile_loaded = true;
+			}
+
+			const int row = post_index(lat, 90.0, lat_idx);
+			const int col = post_index(lon, 180.0, lon_idx);
+			const int16_t elevation = elevations[r * 4 + c];
+
+			if (tile.valid[row] & (1u << col)) {
+				// several incoming posts can map to one stored post: keep the
+				// highest, the consumers use the data for clearance planning
+				if (elevation > tile.elevation_m[row][col]) {
+					tile.elevation_m[row][col] = elevation;
+					tile_dirty = true;
+				}
+
+			} else {
+				tile.elevation_m[row][col] = elevation;
+				tile.valid[row] |= (1u << col);
+				tile_dirty = true;
+			}
+		}
+	}
+
+	if (tile_dirty) {
+		writeTileFile(tile);
+	}
+
+	if (tile_loaded) {
+		// drop any stale RAM copy, the next lookup reloads the updated file
+		pthread_mutex_lock(&_mutex);
+		CacheSlot *slot = findResident(tile.lat_idx, tile.lon_idx);
+
+		if (slot != nullptr) {
+			slot->valid = false;
+		}
+
+		pthread_mutex_unlock(&_mutex);
+	}
+}
+
+int TerrainCache::tilePath(int32_t lat_idx, int32_t lon_idx, char *buf, size_t len)
+{
+	return snprintf(buf, len, "%s/%ld_%ld.dat", TERRAIN_STORE_DIR, (long)lat_idx, (long)lon_idx);
+}
+
+bool TerrainCache::readTileFile(int32_t lat_idx, int32_t lon_idx, TerrainTile &tile)
+{
+	char path[64];
+	tilePath(lat_idx, lon_idx, path, sizeof(path));
+
+	const int fd = open(path, O_RDONLY);
+
+	if (fd < 0) {
+		return false;
+	}
+
+	const bool ok = (read(fd, &tile, sizeof(tile)) == sizeof(tile))
+			&& (tile.lat_idx == lat_idx) && (tile.lon_idx == lon_idx);
+	close(fd);
+
+	return ok;
+}
+
+bool TerrainCache::writeTileFile(const TerrainTile &tile)
+{
+	mkdir(TERRAIN_STORE_DIR, 0777); // no-op if it already exists
+
+	char path[64];
+	tilePath(tile.lat_idx, tile.lon_idx, path, sizeof(path));
+
+	const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+	if (fd < 0) {
+		return false;
+	}
+
+	const bool ok = (write(fd, &tile, sizeof(tile)) == sizeof(tile));
+	close(fd);
+
+	return ok;
+}
+
+} // namespace terrain
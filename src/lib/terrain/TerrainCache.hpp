@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TerrainCache.hpp
+ *
+ * Memory-budgeted terrain tile cache backed by the SD card.
+ *
+ * Tiles cover TILE_SIZE_DEG x TILE_SIZE_DEG and hold a fixed grid of
+ * elevation posts; they are filled from mavlink TERRAIN_DATA blocks and kept
+ * under PX4_STORAGEDIR/terrain. A small RAM hot set answers queries without
+ * touching the SD card: cache misses only schedule an asynchronous load on
+ * the low priority work queue and report "unknown", so callers on the
+ * navigator path never block on storage. Callers prefetch the tiles they
+ * will need (e.g. around the RTL destination) ahead of time.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+namespace terrain
+{
+
+static constexpr double TILE_SIZE_DEG = 0.1;	///< tile extent, ~11 km at the equator
+static constexpr int TILE_GRID_DIM = 32;	///< elevation posts per tile edge (~350 m post spacing)
+static constexpr int CACHE_MAX_TILES = 4;	///< RAM hot set budget (~2.2 KiB per tile)
+
+/** tile payload, also the on-disk format under PX4_STORAGEDIR/terrain */
+struct TerrainTile {
+	int32_t lat_idx;	///< floor((latitude + 90) / TILE_SIZE_DEG)
+	int32_t lon_idx;	///< floor((longitude + 180) / TILE_SIZE_DEG)
+	uint32_t valid[TILE_GRID_DIM];	///< per-row bitmask of posts that hold data
+	int16_t elevation_m[TILE_GRID_DIM][TILE_GRID_DIM];	///< AMSL, [south->north][west->east]
+};
+
+class TerrainCache : public px4::WorkItem
+{
+public:
+	TerrainCache();
+	~TerrainCache() override;
+
+	/**
+	 * Query the terrain elevation at a position (nearest stored post, so up to
+	 * half a post spacing off - callers add their own clearance margins).
+	 * Non-blocking: a miss schedules the tile load in the background and
+	 * returns false, a later call is answered from RAM.
+	 */
+	bool lookup(double lat, double lon, float &elevation_amsl_m);
+
+	/** Asynchronously bring the tile containing the position into the hot set. */
+	void prefetch(double lat, double lon);
+
+	/**
+	 * Merge a block of elevation posts (mavlink TERRAIN_DATA layout: 4x4 posts,
+	 * grid_spacing_m apart, from the south-west corner) into the on-disk store.
+	 * Performs SD I/O and must not be called from the navigator path.
+	 */
+	void store(double lat_sw, double lon_sw, float grid_spacing_m, const int16_t elevations[16]);
+
+private:
+	struct CacheSlot {
+		TerrainTile tile {};
+		hrt_abstime last_used{0};
+		hrt_abstime loaded_time{0};
+		bool valid{false};
+	};
+
+	void Run() override;
+
+	/** must be called with _mutex held */
+	CacheSlot *findResident(int32_t lat_idx, int32_t lon_idx);
+
+	void requestLoad(int32_t lat_idx, int32_t lon_idx);
+
+	static int tilePath(int32_t lat_idx, int32_t lon_idx, char *buf, size_t len);
+	static bool readTileFile(int32_t lat_idx, int32_t lon_idx, TerrainTile &tile);
+	static bool writeTileFile(const TerrainTile &tile);
+
+	CacheSlot _slots[CACHE_MAX_TILES] {};
+
+	int32_t _pending_lat_idx{0};
+	int32_t _pending_lon_idx{0};
+	bool _pending{false};
+
+	pthread_mutex_t _mutex = PTHREAD_MUTEX_INITIALIZER;
+};
+
+} // namespace terrain
@@ -70,14 +70,15 @@ float WeatherVane::getWeathervaneYawrate()
 	matrix::Vector3f body_z_sp(matrix::Quatf(vehicle_attitude_setpoint.q_d).dcm_z()); // attitude setpoint body z axis
 
 	// rotate desired body z axis into new frame which is rotated in z by the current
-	// heading of the vehicle. we refer to this as the heading frame.
+	// heading of the vehicle. we refer to this as the heading frame. only the y-component
+	// of the rotated axis is needed to recover the roll setpoint, so avoid constructing
+	// the full rotation matrix.
 	vehicle_local_position_s vehicle_local_position{};
 	_vehicle_local_position_sub.copy(&vehicle_local_position);
-	matrix::Dcmf R_yaw = matrix::Eulerf(0.0f, 0.0f, -vehicle_local_position.heading);
-	body_z_sp = R_yaw * body_z_sp;
-	body_z_sp.normalize();
+	const float body_z_sp_y_heading_frame = (cosf(vehicle_local_position.heading) * body_z_sp(1)
+			- sinf(vehicle_local_position.heading) * body_z_sp(0)) / body_z_sp.norm();
 
-	float roll_sp = -asinf(body_z_sp(1));
+	float roll_sp = -asinf(body_z_sp_y_heading_frame);
 
 	float roll_exceeding_treshold = 0.0f;
 	float min_roll_rad = math::radians(_param_wv_roll_min.get());
@@ -165,8 +165,9 @@ WindEstimator::fuse_airspeed(uint64_t time_now, const float true_airspeed, const
 	_state(INDEX_W_E) += _tas_innov * K(1, 0);
 	_state(INDEX_TAS_SCALE) += _tas_innov * K(2, 0);
 
-	// update covariance matrix
-	_P = _P - K * H_tas * _P;
+	// update covariance matrix as a rank-1 correction, evaluating the row vector
+	// H * P first avoids forming the intermediate 3x3 product K * H
+	_P = _P - K * (H_tas * _P);
 
 	run_sanity_checks();
 }
@@ -216,11 +217,14 @@ WindEstimator::fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const
 	H_beta(0, 1) = HB15 * (HB12 - HB7 + HB8) + HB16 * HB5;
 	H_beta(0, 2) = 0;
 
+	// project the covariance once, innovation covariance and Kalman gain both derive from it
+	const matrix::Matrix<float, 3, 1> PHt = _P * H_beta.transpose();
+
 	// compute innovation covariance S
-	const matrix::Matrix<float, 1, 1> S = H_beta * _P * H_beta.transpose() + _beta_var;
+	const matrix::Matrix<float, 1, 1> S = H_beta * PHt + _beta_var;
 
 	// compute Kalman gain
-	matrix::Matrix<float, 3, 1> K = _P * H_beta.transpose();
+	matrix::Matrix<float, 3, 1> K = PHt;
 	K /= S(0, 0);
 
 	// compute predicted side slip angle
@@ -260,8 +264,9 @@ WindEstimator::fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const
 	_state(INDEX_W_E) += _beta_innov * K(1, 0);
 	_state(INDEX_TAS_SCALE) += _beta_innov * K(2, 0);
 
-	// update covariance matrix
-	_P = _P - K * H_beta * _P;
+	// update covariance matrix as a rank-1 correction, K * H_beta * _P equals
+	// K * PHt^T for the symmetric _P so the projection can be reused
+	_P = _P - K * PHt.transpose();
 
 	run_sanity_checks();
 }
@@ -101,6 +101,79 @@ static constexpr float get_table_data(float lat, float lon, const int16_t table[
 	return lat_scale * (data_max - data_min) + data_min;
 }
 
+static float cell_eval(const float coef[4], float dlat, float dlon)
+{
+	return coef[0] + (coef[1] * dlat) + (coef[2] * dlon) + (coef[3] * dlat * dlon);
+}
+
+static void cell_coefficients(unsigned min_lat_index, unsigned min_lon_index, float scale,
+			      const int16_t table[LAT_DIM][LON_DIM], float coef[4])
+{
+	const float data_sw = table[min_lat_index][min_lon_index];
+	const float data_se = table[min_lat_index][min_lon_index + 1];
+	const float data_ne = table[min_lat_index + 1][min_lon_index + 1];
+	const float data_nw = table[min_lat_index + 1][min_lon_index];
+
+	// expansion of the bilinear interpolation around the south-west corner
+	coef[0] = data_sw * scale;
+	coef[1] = (data_nw - data_sw) * scale / SAMPLING_RES;
+	coef[2] = (data_se - data_sw) * scale / SAMPLING_RES;
+	coef[3] = (data_ne - data_se - data_nw + data_sw) * scale / (SAMPLING_RES * SAMPLING_RES);
+}
+
+void get_mag_declination_inclination_strength(float lat, float lon, float &declination_rad,
+		float &inclination_rad, float &strength_gauss, GeoMagCellCache &cache)
+{
+	lat = constrain(lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
+
+	if (lon > SAMPLING_MAX_LON) {
+		lon -= 360;
+	}
+
+	if (lon < SAMPLING_MIN_LON) {
+		lon += 360;
+	}
+
+	if (!cache.valid
+	    || (lat < cache.min_lat) || (lat > cache.min_lat + SAMPLING_RES)
+	    || (lon < cache.min_lon) || (lon > cache.min_lon + SAMPLING_RES)) {
+
+		/* round down to nearest sampling resolution */
+		float min_lat = floorf(lat / SAMPLING_RES) * SAMPLING_RES;
+		float min_lon = floorf(lon / SAMPLING_RES) * SAMPLING_RES;
+
+		/* find index of nearest low sampling point */
+		const unsigned min_lat_index = get_lookup_table_index(&min_lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
+		const unsigned min_lon_index = get_lookup_table_index(&min_lon, SAMPLING_MIN_LON, SAMPLING_MAX_LON);
+
+		cell_coefficients(min_lat_index, min_lon_index, 1e-4f, declination_table, cache.declination_coef);
+		cell_coefficients(min_lat_index, min_lon_index, 1e-4f, inclination_table, cache.inclination_coef);
+		cell_coefficients(min_lat_index, min_lon_index, 1e-4f, strength_table, cache.strength_coef);
+
+		cache.min_lat = min_lat;
+		cache.min_lon = min_lon;
+		cache.valid = true;
+	}
+
+	const float dlat = constrain(lat - cache.min_lat, 0.f, SAMPLING_RES);
+	const float dlon = constrain(lon - cache.min_lon, 0.f, SAMPLING_RES);
+
+	declination_rad = cell_eval(cache.declination_coef, dlat, dlon);
+	inclination_rad = cell_eval(cache.inclination_coef, dlat, dlon);
+	strength_gauss = cell_eval(cache.strength_coef, dlat, dlon);
+}
+
+void get_mag_declination_inclination_strength_batch(const float lat[], const float lon[], unsigned count,
+		float declination_rad[], float inclination_rad[], float strength_gauss[])
+{
+	GeoMagCellCache cache{};
+
+	for (unsigned i = 0; i < count; i++) {
+		get_mag_declination_inclination_strength(lat[i], lon[i], declination_rad[i], inclination_rad[i],
+				strength_gauss[i], cache);
+	}
+}
+
 float get_mag_declination_radians(float lat, float lon)
 {
 	return get_table_data(lat, lon, declination_table) * 1e-4f; // declination table stored as 10^-4 radians
@@ -41,6 +41,43 @@
 
 #pragma once
 
+/**
+ * Cached WMM grid cell.
+ *
+ * The table lookup is a bilinear interpolation, so within one grid cell each
+ * quantity is exactly value = coef[0] + coef[1] * dlat + coef[2] * dlon +
+ * coef[3] * dlat * dlon, with dlat/dlon the offsets in degrees from the
+ * south-west cell corner. The cache stores these coefficients for
+ * declination, inclination and strength together, already scaled to the
+ * output units, and stays valid until the queried position leaves the cell
+ * (the grid resolution is 10 degrees, so in practice for the whole flight).
+ */
+struct GeoMagCellCache {
+	float declination_coef[4] {};	///< radians
+	float inclination_coef[4] {};	///< radians
+	float strength_coef[4] {};	///< Gauss
+	float min_lat{0.f};		///< south-west cell corner (degrees)
+	float min_lon{0.f};
+	bool valid{false};
+};
+
+/**
+ * Look up declination (radians), inclination (radians) and strength (Gauss)
+ * for one position, reusing the caller-owned cache when the position is still
+ * inside the cached grid cell. The cached answer is identical to the table
+ * interpolation, not an approximation.
+ */
+void get_mag_declination_inclination_strength(float lat, float lon, float &declination_rad,
+		float &inclination_rad, float &strength_gauss, GeoMagCellCache &cache);
+
+/**
+ * Batched lookup over a list of positions (e.g. all waypoints of a plan).
+ * Consecutive positions usually share a grid cell, so this amortizes the table
+ * indexing over the whole batch.
+ */
+void get_mag_declination_inclination_strength_batch(const float lat[], const float lon[], unsigned count,
+		float declination_rad[], float inclination_rad[], float strength_gauss[]);
+
 // Return magnetic declination in degrees or radians
 float get_mag_declination_degrees(float lat, float lon);
 float get_mag_declination_radians(float lat, float lon);
@@ -5086,3 +5086,40 @@ TEST(GeoLookupTest, strength)
 	EXPECT_NEAR(get_mag_strength_tesla(60, 175) * 1e9, 54135.9, 145 + 500);
 	EXPECT_NEAR(get_mag_strength_tesla(60, 180) * 1e9, 53921, 145 + 500);
 }
+
+TEST(GeoLookupTest, cachedLookupMatchesTables)
+{
+	// the cached cell evaluation must reproduce the table interpolation exactly,
+	// including across cell changes, pole clamping and date line wrapping
+	GeoMagCellCache cache{};
+
+	for (float lat = -90.f; lat <= 90.f; lat += 3.3f) {
+		for (float lon = -195.f; lon <= 195.f; lon += 7.7f) {
+			float declination_rad = NAN;
+			float inclination_rad = NAN;
+			float strength_gauss = NAN;
+			get_mag_declination_inclination_strength(lat, lon, declination_rad, inclination_rad, strength_gauss, cache);
+
+			EXPECT_NEAR(declination_rad, get_mag_declination_radians(lat, lon), 1e-6f);
+			EXPECT_NEAR(inclination_rad, get_mag_inclination_radians(lat, lon), 1e-6f);
+			EXPECT_NEAR(strength_gauss, get_mag_strength_gauss(lat, lon), 1e-6f);
+		}
+	}
+}
+
+TEST(GeoLookupTest, batchLookup)
+{
+	const float lat[3] {47.4f, 47.5f, 63.1f};
+	const float lon[3] {8.5f, 8.6f, -21.9f};
+	float declination_rad[3] {};
+	float inclination_rad[3] {};
+	float strength_gauss[3] {};
+
+	get_mag_declination_inclination_strength_batch(lat, lon, 3, declination_rad, inclination_rad, strength_gauss);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_NEAR(declination_rad[i], get_mag_declination_radians(lat[i], lon[i]), 1e-6f);
+		EXPECT_NEAR(inclination_rad[i], get_mag_inclination_radians(lat[i], lon[i]), 1e-6f);
+		EXPECT_NEAR(strength_gauss[i], get_mag_strength_gauss(lat[i], lon[i]), 1e-6f);
+	}
+}
@@ -126,22 +126,28 @@ AirspeedValidator::update_CAS_scale_validated(bool lpos_valid, const matrix::Vec
 	const float course_over_ground_rad = matrix::wrap_2pi(atan2f(vI(0), vI(1)));
 	const int segment_index = int(SCALE_CHECK_SAMPLES * course_over_ground_rad / (2.f * M_PI_F));
 
+	// maintain the segment sums incrementally: replace the previous sample of this course
+	// segment instead of re-summing the whole buffer on every sample
+	if (PX4_ISFINITE(_scale_check_groundspeed(segment_index))) {
+		_scale_check_groundspeed_sum -= _scale_check_groundspeed(segment_index);
+		_scale_check_TAS_sum -= _scale_check_TAS(segment_index);
+
+	} else {
+		_scale_check_filled_segments++;
+	}
+
 	_scale_check_groundspeed(segment_index) = vI.norm();
 	_scale_check_TAS(segment_index) = airspeed_true_raw;
+	_scale_check_groundspeed_sum += _scale_check_groundspeed(segment_index);
+	_scale_check_TAS_sum += _scale_check_TAS(segment_index);
 
 	// run check if all segments are filled
-	if (PX4_ISFINITE(_scale_check_groundspeed.norm_squared())) {
-
-		float ground_speed_sum = 0.f;
-		float TAS_sum = 0.f;
-
-		for (int i = 0; i < SCALE_CHECK_SAMPLES; i++) {
-			ground_speed_sum += _scale_check_groundspeed(i);
-			TAS_sum += _scale_check_TAS(i);
-		}
+	if (_scale_check_filled_segments == SCALE_CHECK_SAMPLES) {
 
-		const float TAS_to_grounspeed_error_current = ground_speed_sum - TAS_sum * _CAS_scale_validated;
-		const float TAS_to_grounspeed_error_new = ground_speed_sum - TAS_sum * _wind_estimator.get_tas_scale();
+		const float TAS_to_grounspeed_error_current = _scale_check_groundspeed_sum - _scale_check_TAS_sum *
+				_CAS_scale_validated;
+		const float TAS_to_grounspeed_error_new = _scale_check_groundspeed_sum - _scale_check_TAS_sum *
+				_wind_estimator.get_tas_scale();
 
 		// check passes if the average airspeed with the scale applied is closer to groundspeed than without
 		if (fabsf(TAS_to_grounspeed_error_new) < fabsf(TAS_to_grounspeed_error_current)) {
@@ -163,6 +169,9 @@ AirspeedValidator::reset_CAS_scale_check()
 
 	_scale_check_groundspeed.setAll(NAN);
 	_scale_check_TAS.setAll(NAN);
+	_scale_check_groundspeed_sum = 0.f;
+	_scale_check_TAS_sum = 0.f;
+	_scale_check_filled_segments = 0;
 
 	_begin_current_scale_check = hrt_absolute_time();
 }
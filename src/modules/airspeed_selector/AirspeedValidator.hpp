@@ -183,6 +183,9 @@ private:
 
 	matrix::Vector<float, SCALE_CHECK_SAMPLES> _scale_check_TAS {};
 	matrix::Vector<float, SCALE_CHECK_SAMPLES> _scale_check_groundspeed {};
+	float _scale_check_TAS_sum{0.f}; ///< running sum over all filled course segments
+	float _scale_check_groundspeed_sum{0.f}; ///< running sum over all filled course segments
+	uint8_t _scale_check_filled_segments{0}; ///< number of course segments holding a sample
 
 	void update_in_fixed_wing_flight(bool in_fixed_wing_flight) { _in_fixed_wing_flight = in_fixed_wing_flight; }
 
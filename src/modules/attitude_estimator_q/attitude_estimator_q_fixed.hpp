@@ -0,0 +1,426 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file attitude_estimator_q_fixed.hpp
+ *
+ * Fixed-point implementation of the complementary filter core, selected with
+ * the ATTITUDE_ESTIMATOR_Q_FIXED_POINT option in the module CMakeLists. It is
+ * intended for FPU-less cores or builds where the estimator competes with the
+ * control loop for the FPU context: the per-sample hot path (quaternion
+ * rotation, heading error extraction, vector normalization, integration) is
+ * integer-only; floats only appear at the API boundary where sensor data and
+ * parameters are converted into the fixed formats.
+ *
+ * Formats:
+ *  - quaternion components and unit vectors: Q30 (range +-2)
+ *  - angular rates, angles, weights, dt, gyro bias: Q20 (range +-2048,
+ *    resolution ~1e-6, plenty for rad and rad/s quantities)
+ *  - accelerations: Q24 (range +-128 m/s^2)
+ *  - magnetic field: Q26 (range +-32 gauss)
+ *
+ * The heading error uses a 5th order minimax atan2 approximation
+ * (max error ~0.6 mrad); since the correction is a feedback gain path the
+ * approximation error shows up as a tiny gain variation, not as a steady
+ * state heading offset.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace att_q_fixed
+{
+
+static constexpr int FRAC_Q = 30;	///< quaternions, unit vectors
+static constexpr int FRAC_W = 20;	///< rates, angles, weights, dt
+static constexpr int FRAC_A = 24;	///< accelerations
+static constexpr int FRAC_M = 26;	///< magnetic field
+
+static constexpr int32_t PI_Q20 = 3294199;
+static constexpr int32_t TWO_PI_Q20 = 6588397;
+
+/// Q30*Q30 -> Q30 (and other symmetric products)
+static inline int32_t mul_q30(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 30); }
+static inline int32_t mul_q20(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 20); }
+
+static inline int32_t to_fx(float v, int frac) { return (int32_t)(v * (float)(1 << frac)); }
+static inline float from_fx(int32_t v, int frac) { return (float)v / (float)(1 << frac); }
+
+/// wrap a Q20 angle obtained from sums/differences of atan2 results to +-pi
+static inline int32_t wrap_pi_q20(int32_t a)
+{
+	if (a > PI_Q20) { a -= TWO_PI_Q20; }
+
+	if (a < -PI_Q20) { a += TWO_PI_Q20; }
+
+	return a;
+}
+
+/**
+ * atan2 in Q20 radians; scale invariant, so y and x may be in any common
+ * fixed format. 5th order minimax polynomial on the reduced octant.
+ */
+static inline int32_t atan2_q20(int32_t y, int32_t x)
+{
+	if (y == 0 && x == 0) {
+		return 0;
+	}
+
+	const int32_t ay = (y < 0) ? -y : y;
+	const int32_t ax = (x < 0) ? -x : x;
+	const int32_t n = (ay < ax) ? ay : ax;
+	const int32_t d = (ay < ax) ? ax : ay;
+
+	// z in [0, 1] Q30
+	const int32_t z = (int32_t)(((int64_t)n << 30) / d);
+
+	// atan(z) ~ z*(c1 - z^2*(c2 - c3*z^2)), coefficients in Q30
+	const int32_t z2 = mul_q30(z, z);
+	int32_t a = mul_q30(z, 1068753219 - mul_q30(z2, 309966716 - mul_q30(85181013, z2)));
+
+	a >>= (30 - FRAC_W);	// Q30 -> Q20
+
+	if (ay > ax) { a = (PI_Q20 / 2) - a; }	// octant above 45 deg
+
+	if (x < 0) { a = PI_Q20 - a; }		// left half plane
+
+	return (y < 0) ? -a : a;
+}
+
+/// 64 bit integer square root (result such that r*r <= n)
+static inline uint32_t isqrt64(uint64_t n)
+{
+	uint64_t r = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+
+	while (bit > n) { bit >>= 2; }
+
+	while (bit != 0) {
+		if (n >= r + bit) {
+			n -= r + bit;
+			r = (r >> 1) + bit;
+
+		} else {
+			r >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	return (uint32_t)r;
+}
+
+/**
+ * Normalize a vector of fixed-point components in place to unit Q30 and
+ * return false if it is degenerate. The input format does not matter since
+ * the scale cancels; internally the components are shifted into a narrow
+ * range so a table seeded Newton iteration can compute 1/sqrt.
+ */
+template<int N>
+static inline bool normalize_q30(int32_t (&v)[N])
+{
+	// 1/sqrt seed, indexed with the Q28 norm squared >> 26 (value/4)
+	static constexpr int32_t inv_sqrt_seed[12] = {
+		759250125, 438353264, 339546978, 286969573, 253083375, 228922526,
+		210578097, 196037539, 184145204, 174183925, 165681960, 158314595
+	};
+
+	int32_t max_abs = 0;
+
+	for (int i = 0; i < N; i++) {
+		const int32_t a = (v[i] < 0) ? -v[i] : v[i];
+
+		if (a > max_abs) { max_abs = a; }
+	}
+
+	if (max_abs == 0) {
+		return false;
+	}
+
+	// shift the largest component into [2^27, 2^28) so the norm squared in
+	// Q28 lands in [0.25, N)
+	int shift = 0;
+
+	if (max_abs < (1 << 27)) {
+		while ((max_abs << shift) < (1 << 27)) { shift++; }
+
+	} else {
+		while ((max_abs >> -shift) >= (1 << 28)) { shift--; }
+	}
+
+	int64_t sum = 0;
+
+	for (int i = 0; i < N; i++) {
+		v[i] = (shift >= 0) ? (v[i] << shift) : (v[i] >> -shift);
+		sum += (int64_t)v[i] * v[i];
+	}
+
+	const int32_t n_q28 = (int32_t)(sum >> 28);
+	int32_t y = inv_sqrt_seed[(n_q28 >> 26) < 11 ? (n_q28 >> 26) : 11];
+
+	// four Newton iterations: y = y*(3 - n*y^2)/2
+	for (int k = 0; k < 4; k++) {
+		int32_t t = (int32_t)(((int64_t)n_q28 * y) >> 28);
+		t = (int32_t)(((int64_t)t * y) >> 28);
+		y = (int32_t)(((int64_t)y * ((3 << 28) - t)) >> 29);
+	}
+
+	// v/|v| in Q30: |v| = sqrt(n_q28 * 2^28) and y = 2^28/sqrt(n_q28/2^28),
+	// so v*y/2^26 = v * 2^30 / |v|
+	for (int i = 0; i < N; i++) {
+		v[i] = (int32_t)(((int64_t)v[i] * y) >> 26);
+	}
+
+	return true;
+}
+
+/**
+ * @class FilterCore
+ * Integer state and per-sample update of the complementary filter.
+ * Mirrors AttitudeEstimatorQ::update(); the caller keeps doing the sensor
+ * bookkeeping, heading source selection and parameter handling.
+ */
+class FilterCore
+{
+public:
+	/// (re)seed the integer state from the float estimate
+	void reset(const float q[4], const float gyro_bias[3])
+	{
+		for (int i = 0; i < 4; i++) { _q[i] = to_fx(q[i], FRAC_Q); }
+
+		for (int i = 0; i < 3; i++) { _bias[i] = to_fx(gyro_bias[i], FRAC_W); }
+	}
+
+	void get_q(float q[4]) const
+	{
+		for (int i = 0; i < 4; i++) { q[i] = from_fx(_q[i], FRAC_Q); }
+	}
+
+	void get_gyro_bias(float b[3]) const
+	{
+		for (int i = 0; i < 3; i++) { b[i] = from_fx(_bias[i], FRAC_W); }
+	}
+
+	/**
+	 * One filter step.
+	 * @param ext_hdg external heading vector in body frame, used instead of
+	 *        the magnetometer when use_ext_hdg is set
+	 * @param acc_comp true when the accel vector (minus pos_acc) should be
+	 *        fused regardless of its norm (GPS velocity compensation active)
+	 * @param rates_out bias corrected body rates
+	 * @return false if the state became degenerate (restored to the last
+	 *         good quaternion, rates and bias zeroed), like the float path
+	 */
+	bool update(const float gyro[3], const float accel[3], const float pos_acc[3],
+		    const float mag[3], const float ext_hdg[3], bool use_ext_hdg,
+		    bool acc_comp, float mag_decl,
+		    float w_acc, float w_mag, float w_ext_hdg, float w_gyro_bias,
+		    float bias_max, float dt, float rates_out[3])
+	{
+		int32_t q_last[4] = {_q[0], _q[1], _q[2], _q[3]};
+
+		int32_t g[3], corr[3] = {0, 0, 0};
+
+		for (int i = 0; i < 3; i++) { g[i] = to_fx(gyro[i], FRAC_W); }
+
+		// spin rate gating works on the squared norm to avoid the sqrt
+		const int64_t spin_sq_q20 = ((int64_t)g[0] * g[0] + (int64_t)g[1] * g[1]
+					     + (int64_t)g[2] * g[2]) >> FRAC_W;
+
+		// rotation matrix rows from the quaternion, Q30; R * v rotates body
+		// to earth, the transpose earth to body
+		int32_t R[3][3];
+		rotation_matrix(R);
+
+		if (use_ext_hdg) {
+			// external heading correction: heading vector to earth frame,
+			// extract the XY direction error and rotate it back down to the
+			// body z axis (third row of R)
+			int32_t h[3], he[3];
+
+			for (int i = 0; i < 3; i++) { h[i] = to_fx(ext_hdg[i], FRAC_Q); }
+
+			rotate(R, h, he);
+			const int32_t hdg_err = atan2_q20(he[1], he[0]);
+			const int32_t wz = mul_q20(-hdg_err, to_fx(w_ext_hdg, FRAC_W));
+
+			for (int i = 0; i < 3; i++) { corr[i] += mul_q30(R[2][i], wz); }
+
+		} else {
+			// magnetometer correction
+			int32_t m[3], me[3];
+
+			for (int i = 0; i < 3; i++) { m[i] = to_fx(mag[i], FRAC_M); }
+
+			rotate(R, m, me);
+			const int32_t mag_err = wrap_pi_q20(atan2_q20(me[1], me[0]) - to_fx(mag_decl, FRAC_W));
+
+			// above 50 dps the mag gain is scaled up with the spin rate
+			int32_t gain_mult = 1 << FRAC_W;
+			const int32_t fifty_dps = 915407;	// 0.873 rad/s Q20
+
+			if (spin_sq_q20 > (int64_t)mul_q20(fifty_dps, fifty_dps)) {
+				const int32_t spin = (int32_t)isqrt64((uint64_t)spin_sq_q20 << FRAC_W);
+				gain_mult = (int32_t)(((int64_t)spin << FRAC_W) / fifty_dps);
+
+				if (gain_mult > (10 << FRAC_W)) { gain_mult = 10 << FRAC_W; }
+			}
+
+			const int32_t wz = mul_q20(-mag_err, mul_q20(to_fx(w_mag, FRAC_W), gain_mult));
+
+			for (int i = 0; i < 3; i++) { corr[i] += mul_q30(R[2][i], wz); }
+		}
+
+		if (!normalize_q30(_q)) {
+			restore(q_last, rates_out);
+			return false;
+		}
+
+		rotation_matrix(R);
+
+		// accelerometer correction; the third row of R is the earth z (down)
+		// unit vector in body frame
+		int32_t a[3];
+		int64_t acc_sq_q20 = 0;
+
+		for (int i = 0; i < 3; i++) {
+			a[i] = to_fx(accel[i] - pos_acc[i], FRAC_A);
+			const int64_t ai = (int64_t)to_fx(accel[i], FRAC_A);
+			acc_sq_q20 += (ai * ai) >> (2 * FRAC_A - FRAC_W);
+		}
+
+		// without GPS velocity compensation only fuse accel around 1 g
+		const int64_t acc_sq_lo = 81681985;	// (0.9 g)^2 Q20
+		const int64_t acc_sq_hi = 122018768;	// (1.1 g)^2 Q20
+
+		if (acc_comp || (acc_sq_q20 > acc_sq_lo && acc_sq_q20 < acc_sq_hi)) {
+			if (normalize_q30(a)) {
+				const int32_t w = to_fx(w_acc, FRAC_W);
+				// k x a (both unit Q30), scaled by the accel weight into Q20
+				corr[0] += mul_q30(mul_q30(R[2][1], a[2]) - mul_q30(R[2][2], a[1]), w);
+				corr[1] += mul_q30(mul_q30(R[2][2], a[0]) - mul_q30(R[2][0], a[2]), w);
+				corr[2] += mul_q30(mul_q30(R[2][0], a[1]) - mul_q30(R[2][1], a[0]), w);
+			}
+		}
+
+		// gyro bias estimation below 10 dps
+		const int64_t spin_bias_sq = 32113;	// (0.175 rad/s)^2 Q20
+
+		if (spin_sq_q20 < spin_bias_sq) {
+			const int32_t w_dt = mul_q20(to_fx(w_gyro_bias, FRAC_W), to_fx(dt, FRAC_W));
+			const int32_t b_max = to_fx(bias_max, FRAC_W);
+
+			for (int i = 0; i < 3; i++) {
+				_bias[i] += mul_q20(corr[i], w_dt);
+
+				if (_bias[i] > b_max) { _bias[i] = b_max; }
+
+				if (_bias[i] < -b_max) { _bias[i] = -b_max; }
+			}
+		}
+
+		// feed forward the bias corrected rates
+		for (int i = 0; i < 3; i++) {
+			const int32_t rate = g[i] + _bias[i];
+			rates_out[i] = from_fx(rate, FRAC_W);
+			corr[i] += rate;
+		}
+
+		// q += 0.5 * q o (0, corr) * dt  (the >> (FRAC_W + 1) folds in the 0.5)
+		const int32_t h_dt = to_fx(dt, FRAC_W);
+		const int64_t dq[4] = {
+			-(int64_t)_q[1] * corr[0] - (int64_t)_q[2] * corr[1] - (int64_t)_q[3] * corr[2],
+			(int64_t)_q[0] * corr[0] + (int64_t)_q[2] * corr[2] - (int64_t)_q[3] * corr[1],
+			(int64_t)_q[0] * corr[1] - (int64_t)_q[1] * corr[2] + (int64_t)_q[3] * corr[0],
+			(int64_t)_q[0] * corr[2] + (int64_t)_q[1] * corr[1] - (int64_t)_q[2] * corr[0]
+		};
+
+		for (int i = 0; i < 4; i++) {
+			_q[i] += (int32_t)(((dq[i] >> (FRAC_W + 1)) * h_dt) >> FRAC_W);
+		}
+
+		if (!normalize_q30(_q)) {
+			restore(q_last, rates_out);
+			return false;
+		}
+
+		return true;
+	}
+
+private:
+	/// body to earth rotation matrix from _q, Q30
+	void rotation_matrix(int32_t (&R)[3][3]) const
+	{
+		const int32_t aa = mul_q30(_q[0], _q[0]);
+		const int32_t ab = mul_q30(_q[0], _q[1]);
+		const int32_t ac = mul_q30(_q[0], _q[2]);
+		const int32_t ad = mul_q30(_q[0], _q[3]);
+		const int32_t bb = mul_q30(_q[1], _q[1]);
+		const int32_t bc = mul_q30(_q[1], _q[2]);
+		const int32_t bd = mul_q30(_q[1], _q[3]);
+		const int32_t cc = mul_q30(_q[2], _q[2]);
+		const int32_t cd = mul_q30(_q[2], _q[3]);
+		const int32_t dd = mul_q30(_q[3], _q[3]);
+
+		R[0][0] = aa + bb - cc - dd;
+		R[0][1] = 2 * (bc - ad);
+		R[0][2] = 2 * (ac + bd);
+		R[1][0] = 2 * (bc + ad);
+		R[1][1] = aa - bb + cc - dd;
+		R[1][2] = 2 * (cd - ab);
+		R[2][0] = 2 * (bd - ac);
+		R[2][1] = 2 * (ab + cd);
+		R[2][2] = aa - bb - cc + dd;
+	}
+
+	/// v_out = R * v, preserving the format of v
+	static void rotate(const int32_t (&R)[3][3], const int32_t v[3], int32_t v_out[3])
+	{
+		for (int i = 0; i < 3; i++) {
+			v_out[i] = mul_q30(R[i][0], v[0]) + mul_q30(R[i][1], v[1]) + mul_q30(R[i][2], v[2]);
+		}
+	}
+
+	void restore(const int32_t q_last[4], float rates_out[3])
+	{
+		for (int i = 0; i < 4; i++) { _q[i] = q_last[i]; }
+
+		for (int i = 0; i < 3; i++) { _bias[i] = 0; rates_out[i] = 0.f; }
+	}
+
+	int32_t _q[4] {1 << FRAC_Q, 0, 0, 0};	///< attitude quaternion, Q30
+	int32_t _bias[3] {};			///< gyro bias, Q20 rad/s
+};
+
+} // namespace att_q_fixed
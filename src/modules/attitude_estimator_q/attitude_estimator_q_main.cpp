@@ -62,6 +62,10 @@
 #include <uORB/topics/vehicle_magnetometer.h>
 #include <uORB/topics/vehicle_odometry.h>
 
+#if defined(ATTITUDE_ESTIMATOR_Q_FIXED_POINT)
+#include "attitude_estimator_q_fixed.hpp"
+#endif
+
 using matrix::Dcmf;
 using matrix::Eulerf;
 using matrix::Quatf;
@@ -157,6 +161,10 @@ private:
 	bool        _ext_hdg_good{false};
 	bool        _initialized{false};
 
+#if defined(ATTITUDE_ESTIMATOR_Q_FIXED_POINT)
+	att_q_fixed::FilterCore _filter_core;	/**< integer filter state, seeded from _q whenever it is set directly */
+#endif
+
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::ATT_W_ACC>)       _param_att_w_acc,
 		(ParamFloat<px4::params::ATT_W_MAG>)       _param_att_w_mag,
@@ -446,6 +454,13 @@ bool AttitudeEstimatorQ::init_attitude_q()
 	    _q.length() > 0.95f && _q.length() < 1.05f) {
 		_initialized = true;
 
+#if defined(ATTITUDE_ESTIMATOR_Q_FIXED_POINT)
+		float q[4], bias[3];
+		_q.copyTo(q);
+		_gyro_bias.copyTo(bias);
+		_filter_core.reset(q, bias);
+#endif
+
 	} else {
 		_initialized = false;
 	}
@@ -464,6 +479,35 @@ bool AttitudeEstimatorQ::update(float dt)
 		return init_attitude_q();
 	}
 
+#if defined(ATTITUDE_ESTIMATOR_Q_FIXED_POINT)
+	// integer filter core; the heading source selection stays up here and
+	// the chosen vector is handed down, everything else mirrors the float
+	// path below
+	const bool use_ext_hdg = _param_att_ext_hdg_m.get() > 0 && _ext_hdg_good;
+	const Vector3f &ext_hdg = (_param_att_ext_hdg_m.get() == 2) ? _mocap_hdg : _vision_hdg;
+
+	float gyro[3], accel[3], pos_acc[3], mag[3], hdg[3], rates[3];
+	_gyro.copyTo(gyro);
+	_accel.copyTo(accel);
+	_pos_acc.copyTo(pos_acc);
+	_mag.copyTo(mag);
+	ext_hdg.copyTo(hdg);
+
+	const bool ok = _filter_core.update(gyro, accel, pos_acc, mag, hdg, use_ext_hdg,
+					    _param_att_acc_comp.get(), _mag_decl,
+					    _param_att_w_acc.get(), _param_att_w_mag.get(),
+					    _param_att_w_ext_hdg.get(), _param_att_w_gyro_bias.get(),
+					    _bias_max, dt, rates);
+
+	float q[4], bias[3];
+	_filter_core.get_q(q);
+	_filter_core.get_gyro_bias(bias);
+	_q = Quatf(q);
+	_gyro_bias = Vector3f(bias);
+	_rates = Vector3f(rates);
+
+	return ok;
+#else
 	Quatf q_last = _q;
 
 	// Angular rate of correction
@@ -563,6 +607,7 @@ bool AttitudeEstimatorQ::update(float dt)
 	}
 
 	return true;
+#endif // ATTITUDE_ESTIMATOR_Q_FIXED_POINT
 }
 
 void AttitudeEstimatorQ::update_mag_declination(float new_declination)
@@ -576,6 +621,13 @@ void AttitudeEstimatorQ::update_mag_declination(float new_declination)
 		Quatf decl_rotation = Eulerf(0.0f, 0.0f, new_declination - _mag_decl);
 		_q = _q * decl_rotation;
 		_mag_decl = new_declination;
+
+#if defined(ATTITUDE_ESTIMATOR_Q_FIXED_POINT)
+		float q[4], bias[3];
+		_q.copyTo(q);
+		_gyro_bias.copyTo(bias);
+		_filter_core.reset(q, bias);
+#endif
 	}
 }
 
@@ -47,7 +47,9 @@ CameraFeedback::CameraFeedback() :
 bool
 CameraFeedback::init()
 {
-	if (!_trigger_sub.registerCallback()) {
+	if (!_trigger_sub.registerCallback() ||
+	    !_gpos_sub.registerCallback() ||
+	    !_att_sub.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -62,25 +64,26 @@ CameraFeedback::Run()
 {
 	if (should_exit()) {
 		_trigger_sub.unregisterCallback();
+		_gpos_sub.unregisterCallback();
+		_att_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
 
-	camera_trigger_s trig{};
-
-	while (_trigger_sub.update(&trig)) {
+	// store new samples in the state history rings
+	while (_att_sub.update(&_att_ring[_att_ring_next])) {
+		_att_ring_next = (_att_ring_next + 1) % ATT_RING_SIZE;
+	}
 
-		// update geotagging subscriptions
-		vehicle_global_position_s gpos{};
-		_gpos_sub.copy(&gpos);
+	while (_gpos_sub.update(&_gpos_ring[_gpos_ring_next])) {
+		_gpos_ring_next = (_gpos_ring_next + 1) % GPOS_RING_SIZE;
+	}
 
-		vehicle_attitude_s att{};
-		_att_sub.copy(&att);
+	camera_trigger_s trig{};
 
-		if (trig.timestamp == 0 ||
-		    gpos.timestamp == 0 ||
-		    att.timestamp == 0) {
+	while (_trigger_sub.update(&trig)) {
 
+		if (trig.timestamp == 0) {
 			// reject until we have valid data
 			continue;
 		}
@@ -90,6 +93,15 @@ CameraFeedback::Run()
 			continue;
 		}
 
+		// correlate the image with the buffered vehicle state closest to the capture time
+		const vehicle_global_position_s *gpos = find_closest(_gpos_ring, trig.timestamp);
+		const vehicle_attitude_s *att = find_closest(_att_ring, trig.timestamp);
+
+		if (gpos == nullptr || att == nullptr) {
+			// reject until we have valid data
+			continue;
+		}
+
 		camera_capture_s capture{};
 
 		// Fill timestamps
@@ -100,12 +112,12 @@ CameraFeedback::Run()
 		capture.seq = trig.seq;
 
 		// Fill position data
-		capture.lat = gpos.lat;
-		capture.lon = gpos.lon;
-		capture.alt = gpos.alt;
+		capture.lat = gpos->lat;
+		capture.lon = gpos->lon;
+		capture.alt = gpos->alt;
 
-		if (gpos.terrain_alt_valid) {
-			capture.ground_distance = gpos.alt - gpos.terrain_alt;
+		if (gpos->terrain_alt_valid) {
+			capture.ground_distance = gpos->alt - gpos->terrain_alt;
 
 		} else {
 			capture.ground_distance = -1.0f;
@@ -113,10 +125,10 @@ CameraFeedback::Run()
 
 		// Fill attitude data
 		// TODO : this needs to be rotated by camera orientation or set to gimbal orientation when available
-		capture.q[0] = att.q[0];
-		capture.q[1] = att.q[1];
-		capture.q[2] = att.q[2];
-		capture.q[3] = att.q[3];
+		capture.q[0] = att->q[0];
+		capture.q[1] = att->q[1];
+		capture.q[2] = att->q[2];
+		capture.q[3] = att->q[3];
 		capture.result = 1;
 
 		_capture_pub.publish(capture);
@@ -40,6 +40,7 @@
 
 #pragma once
 
+#include <drivers/drv_hrt.h>
 #include <lib/mathlib/mathlib.h>
 #include <lib/parameters/param.h>
 #include <px4_platform_common/px4_config.h>
@@ -77,10 +78,50 @@ private:
 
 	void Run() override;
 
+	/**
+	 * Find the ring entry closest in time to the given capture timestamp.
+	 * @return nullptr if the ring holds no valid sample yet
+	 */
+	template <typename T, unsigned N>
+	static const T *find_closest(const T(&ring)[N], const hrt_abstime timestamp)
+	{
+		const T *closest = nullptr;
+		hrt_abstime closest_diff = UINT64_MAX;
+
+		for (unsigned i = 0; i < N; i++) {
+			if (ring[i].timestamp == 0) {
+				continue;
+			}
+
+			const hrt_abstime diff = (ring[i].timestamp > timestamp)
+						 ? ring[i].timestamp - timestamp
+						 : timestamp - ring[i].timestamp;
+
+			if (diff < closest_diff) {
+				closest_diff = diff;
+				closest = &ring[i];
+			}
+		}
+
+		return closest;
+	}
+
 	uORB::SubscriptionCallbackWorkItem _trigger_sub{this, ORB_ID(camera_trigger)};
 
-	uORB::Subscription	_gpos_sub{ORB_ID(vehicle_global_position)};
-	uORB::Subscription	_att_sub{ORB_ID(vehicle_attitude)};
+	uORB::SubscriptionCallbackWorkItem	_gpos_sub{this, ORB_ID(vehicle_global_position)};
+	uORB::SubscriptionCallbackWorkItem	_att_sub{this, ORB_ID(vehicle_attitude)};
+
+	/* preallocated state history rings: every new attitude/position sample is
+	 * stored here so an image can be correlated with the vehicle state at its
+	 * capture timestamp, which may be noticeably in the past when the trigger
+	 * comes from capture feedback */
+	static constexpr unsigned ATT_RING_SIZE = 32;
+	static constexpr unsigned GPOS_RING_SIZE = 8;
+
+	vehicle_attitude_s		_att_ring[ATT_RING_SIZE] {};
+	vehicle_global_position_s	_gpos_ring[GPOS_RING_SIZE] {};
+	unsigned			_att_ring_next{0};
+	unsigned			_gpos_ring_next{0};
 
 	uORB::Publication<camera_capture_s>	_capture_pub{ORB_ID(camera_capture)};
 
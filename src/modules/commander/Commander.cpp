@@ -1769,6 +1769,35 @@ Commander::run()
 
 	arm_auth_init(&_mavlink_log_pub, &_vehicle_status.system_id);
 
+	// wake-up sources for the event-driven wait while disarmed: anything that can
+	// trigger an arming or mode change. Everything else is handled at the
+	// housekeeping rate given by the poll timeout.
+	const struct orb_metadata *wakeup_metas[] = {
+		ORB_ID(vehicle_command),
+		ORB_ID(action_request),
+		ORB_ID(manual_control_setpoint),
+		ORB_ID(safety_button),
+		ORB_ID(power_button_state),
+		ORB_ID(vehicle_land_detected),
+		ORB_ID(parameter_update),
+	};
+	static constexpr unsigned num_wakeup_fds = sizeof(wakeup_metas) / sizeof(wakeup_metas[0]);
+	px4_pollfd_struct_t wakeup_fds[num_wakeup_fds] {};
+
+	for (unsigned i = 0; i < num_wakeup_fds; i++) {
+		wakeup_fds[i].fd = orb_subscribe(wakeup_metas[i]);
+		wakeup_fds[i].events = POLLIN;
+
+		// rate limit the high-rate sources, they only need to wake us for the
+		// stick gesture and mode switch detection
+		if (wakeup_metas[i] == ORB_ID(manual_control_setpoint)) {
+			orb_set_interval(wakeup_fds[i].fd, 50);
+
+		} else if (wakeup_metas[i] == ORB_ID(vehicle_land_detected)) {
+			orb_set_interval(wakeup_fds[i].fd, 200);
+		}
+	}
+
 	while (!should_exit()) {
 
 		perf_begin(_loop_perf);
@@ -2285,10 +2314,43 @@ Commander::run()
 
 		// sleep if there are no vehicle_commands or action_requests to process
 		if (!_vehicle_command_sub.updated() && !_action_request_sub.updated()) {
-			px4_usleep(COMMANDER_MONITORING_INTERVAL);
+			if (_arm_state_machine.isArmed()) {
+				// keep the fixed monitoring rate while armed: failsafe and failure
+				// detection must not depend on a wake-up event
+				px4_usleep(COMMANDER_MONITORING_INTERVAL);
+
+			} else {
+				// disarmed: block until one of the wake-up topics updates, the timeout
+				// serves the remaining time-based checks
+				int poll_ret = px4_poll(wakeup_fds, num_wakeup_fds, COMMANDER_DISARMED_WAKEUP_INTERVAL / 1000);
+
+				if (poll_ret > 0) {
+					// consume the data so the next poll blocks again (the class
+					// subscriptions read the topics independently)
+					union {
+						vehicle_command_s vehicle_command;
+						action_request_s action_request;
+						manual_control_setpoint_s manual_control_setpoint;
+						button_event_s button_event;
+						power_button_state_s power_button_state;
+						vehicle_land_detected_s vehicle_land_detected;
+						parameter_update_s parameter_update;
+					} wakeup_buf;
+
+					for (unsigned i = 0; i < num_wakeup_fds; i++) {
+						if (wakeup_fds[i].revents & POLLIN) {
+							orb_copy(wakeup_metas[i], wakeup_fds[i].fd, &wakeup_buf);
+						}
+					}
+				}
+			}
 		}
 	}
 
+	for (unsigned i = 0; i < num_wakeup_fds; i++) {
+		orb_unsubscribe(wakeup_fds[i].fd);
+	}
+
 	rgbled_set_color_and_mode(led_control_s::COLOR_WHITE, led_control_s::MODE_OFF);
 
 	/* close fds */
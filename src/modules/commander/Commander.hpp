@@ -274,6 +274,10 @@ private:
 	static constexpr uint64_t COMMANDER_MONITORING_INTERVAL{10_ms};
 	static constexpr uint64_t INAIR_RESTART_HOLDOFF_INTERVAL{500_ms};
 
+	/* While disarmed the loop blocks on the wake-up topics instead of running at the
+	 * monitoring rate; this is the timeout serving the remaining time-based checks */
+	static constexpr uint64_t COMMANDER_DISARMED_WAKEUP_INTERVAL{100_ms};
+
 	ArmStateMachine _arm_state_machine{};
 
 	bool		_geofence_loiter_on{false};
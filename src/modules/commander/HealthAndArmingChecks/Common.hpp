@@ -398,5 +398,14 @@ public:
 
 	virtual void checkAndReport(const Context &context, Report &reporter) = 0;
 
+	/**
+	 * Declare the input topics of the check: return true if any of them updated
+	 * since the last sweep (generation compare, without consuming the update).
+	 * The framework skips a sweep when no check has new inputs, with transitions
+	 * and a periodic full sweep covering everything else, so checks whose inputs
+	 * are context, parameters or high-rate sensor data keep the default.
+	 */
+	virtual bool inputsUpdated() { return false; }
+
 	void updateParams() override { ModuleParams::updateParams(); }
 };
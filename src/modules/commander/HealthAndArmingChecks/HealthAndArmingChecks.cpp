@@ -43,6 +43,32 @@ HealthAndArmingChecks::HealthAndArmingChecks(ModuleParams *parent, vehicle_statu
 
 bool HealthAndArmingChecks::update(bool force_reporting)
 {
+	// Skip the sweep while nothing changed: no new check inputs, no arming or
+	// vehicle type transition, and the last full sweep recent enough for the
+	// time-based conditions inside the checks (data timeouts, hysteresis).
+	const hrt_abstime now = hrt_absolute_time();
+
+	bool run_checks = force_reporting
+			  || (_context.isArmed() != _last_sweep_armed)
+			  || (_context.status().vehicle_type != _last_sweep_vehicle_type)
+			  || (now - _last_sweep_time > FULL_SWEEP_INTERVAL);
+
+	for (unsigned i = 0; !run_checks && i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
+		if (!_checks[i]) {
+			break;
+		}
+
+		run_checks = _checks[i]->inputsUpdated();
+	}
+
+	if (!run_checks) {
+		return false;
+	}
+
+	_last_sweep_time = now;
+	_last_sweep_armed = _context.isArmed();
+	_last_sweep_vehicle_type = _context.status().vehicle_type;
+
 	_reporter.reset();
 
 	_reporter.prepare(_context.status().vehicle_type);
@@ -100,4 +126,7 @@ void HealthAndArmingChecks::updateParams()
 
 		_checks[i]->updateParams();
 	}
+
+	// parameters are check inputs as well: force the next sweep
+	_last_sweep_time = 0;
 }
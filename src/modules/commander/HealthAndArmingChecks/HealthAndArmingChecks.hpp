@@ -87,10 +87,18 @@ public:
 protected:
 	void updateParams() override;
 private:
+	/// maximum time between two full sweeps, covering the time-based conditions
+	/// of checks that declare no (or only part of their) input topics
+	static constexpr hrt_abstime FULL_SWEEP_INTERVAL{500_ms};
+
 	Context _context;
 	Report _reporter;
 	orb_advert_t _mavlink_log_pub{nullptr};
 
+	hrt_abstime _last_sweep_time{0};
+	bool _last_sweep_armed{false};
+	uint8_t _last_sweep_vehicle_type{0};
+
 	uORB::Publication<health_report_s> _health_report_pub{ORB_ID(health_report)};
 
 	// all checks
@@ -48,6 +48,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsUpdated() override { return _battery_status_subs.updated() || _rtl_time_estimate_sub.updated(); }
+
 private:
 	void rtlEstimateCheck(const Context &context, Report &reporter, float worst_battery_time_s);
 
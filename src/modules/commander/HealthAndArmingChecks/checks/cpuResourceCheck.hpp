@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsUpdated() override { return _cpuload_sub.updated(); }
+
 private:
 	uORB::Subscription _cpuload_sub{ORB_ID(cpuload)};
 
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsUpdated() override { return _esc_status_sub.updated(); }
+
 private:
 	void checkEscStatus(const Context &context, Report &reporter, const esc_status_s &esc_status);
 
@@ -58,6 +58,13 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	// only the state-bearing topics are declared; the high-rate position and
+	// attitude topics are covered by the periodic full sweep
+	bool inputsUpdated() override
+	{
+		return _estimator_selector_status_sub.updated() || _estimator_status_flags_sub.updated();
+	}
+
 private:
 	void checkEstimatorStatus(const Context &context, Report &reporter, const estimator_status_s &estimator_status,
 				  NavModes required_groups);
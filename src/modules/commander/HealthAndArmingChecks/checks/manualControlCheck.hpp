@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsUpdated() override { return _manual_control_switches_sub.updated(); }
+
 private:
 	uORB::Subscription _manual_control_switches_sub{ORB_ID(manual_control_switches)};
 };
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsUpdated() override { return _system_power_sub.updated(); }
+
 private:
 	uORB::Subscription _system_power_sub{ORB_ID(system_power)};
 
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsUpdated() override { return _actuator_armed_sub.updated(); }
+
 private:
 	uORB::Subscription _actuator_armed_sub{ORB_ID(actuator_armed)};
 
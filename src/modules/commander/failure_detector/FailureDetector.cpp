@@ -337,7 +337,28 @@ void FailureDetector::updateImbalancedPropStatus()
 				const float metric = (std_x + std_y) / 2.f - std_z;
 				const float metric_lpf = _imbalanced_prop_lpf.update(metric);
 
-				const bool is_imbalanced = metric_lpf > _param_fd_imb_prop_thr.get();
+				bool is_imbalanced = metric_lpf > _param_fd_imb_prop_thr.get();
+
+				// An imbalanced propeller vibrates laterally at exactly once per revolution. When the
+				// gyro FFT is running and knows the motor rotation frequency, only confirm the failure
+				// if the fundamental stands out of the spectral background, so that broadband vibration
+				// (e.g. turbulence) raising the accel variance alone does not trigger it.
+				_sensor_gyro_fft_sub.update(&_sensor_gyro_fft);
+
+				if (is_imbalanced
+				    && (hrt_absolute_time() - _sensor_gyro_fft.timestamp < 1_s)
+				    && (_sensor_gyro_fft.base_frequency_hz > FLT_EPSILON)) {
+
+					const float background = math::max(_sensor_gyro_fft.mean_bin_magnitude[0],
+									   _sensor_gyro_fft.mean_bin_magnitude[1], FLT_EPSILON);
+					const float fundamental = math::max(_sensor_gyro_fft.harmonic_magnitude_x[0],
+									    _sensor_gyro_fft.harmonic_magnitude_y[0]);
+
+					if (PX4_ISFINITE(fundamental) && (fundamental < _imbalanced_prop_fundamental_ratio * background)) {
+						is_imbalanced = false;
+					}
+				}
+
 				_status.flags.imbalanced_prop = is_imbalanced;
 			}
 		}
@@ -52,32 +52,46 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 
 	matrix::SquareMatrix<float, 4> JTJ;
 	float JTFI[4] {};
-	float residual = 0.0f;
+
+	// hoist the parameter reads out of the sample loops: the samples are laid out
+	// as struct-of-arrays and with all invariants in locals the loop bodies only
+	// carry the accumulator dependencies, which the compiler can vectorize
+	const float diag0 = params.diag(0);
+	const float diag1 = params.diag(1);
+	const float diag2 = params.diag(2);
+	const float offdiag0 = params.offdiag(0);
+	const float offdiag1 = params.offdiag(1);
+	const float offdiag2 = params.offdiag(2);
+	const float offset0 = params.offset(0);
+	const float offset1 = params.offset(1);
+	const float offset2 = params.offset(2);
 
 	// Gauss Newton Part common for all kind of extensions including LM
 	for (uint16_t k = 0; k < samples_collected; k++) {
 
-		float sphere_jacob[4];
+		const float dx = x[k] - offset0;
+		const float dy = y[k] - offset1;
+		const float dz = z[k] - offset2;
+
 		//Calculate Jacobian
-		float A = (params.diag(0)    * (x[k] - params.offset(0))) + (params.offdiag(0) * (y[k] - params.offset(1))) +
-			  (params.offdiag(1) * (z[k] - params.offset(2)));
-		float B = (params.offdiag(0) * (x[k] - params.offset(0))) + (params.diag(1)    * (y[k] - params.offset(1))) +
-			  (params.offdiag(2) * (z[k] - params.offset(2)));
-		float C = (params.offdiag(1) * (x[k] - params.offset(0))) + (params.offdiag(2) * (y[k] - params.offset(1))) +
-			  (params.diag(2)    * (z[k] - params.offset(2)));
-		float length = sqrtf(A * A + B * B + C * C);
+		const float A = (diag0    * dx) + (offdiag0 * dy) + (offdiag1 * dz);
+		const float B = (offdiag0 * dx) + (diag1    * dy) + (offdiag2 * dz);
+		const float C = (offdiag1 * dx) + (offdiag2 * dy) + (diag2    * dz);
+		const float length = sqrtf(A * A + B * B + C * C);
+		const float inv_length = 1.0f / length;
 
+		float sphere_jacob[4];
 		// 0: partial derivative (radius wrt fitness fn) fn operated on sample
 		sphere_jacob[0] = 1.0f;
 		// 1-3: partial derivative (offsets wrt fitness fn) fn operated on sample
-		sphere_jacob[1] = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
-		sphere_jacob[2] = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
-		sphere_jacob[3] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
-		residual = params.radius - length;
+		sphere_jacob[1] = ((diag0    * A) + (offdiag0 * B) + (offdiag1 * C)) * inv_length;
+		sphere_jacob[2] = ((offdiag0 * A) + (diag1    * B) + (offdiag2 * C)) * inv_length;
+		sphere_jacob[3] = ((offdiag1 * A) + (offdiag2 * B) + (diag2    * C)) * inv_length;
+		const float residual = params.radius - length;
 
+		// JTJ is symmetric: accumulate the upper triangle only
 		for (uint8_t i = 0; i < 4; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 4; j++) {
+			for (uint8_t j = i; j < 4; j++) {
 				JTJ(i, j) += sphere_jacob[i] * sphere_jacob[j];
 			}
 
@@ -85,13 +99,18 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 		}
 	}
 
+	// mirror the lower triangle (replaces the (JTJ + JTJ^T) / 2 symmetry fix-up)
+	for (uint8_t i = 1; i < 4; i++) {
+		for (uint8_t j = 0; j < i; j++) {
+			JTJ(i, j) = JTJ(j, i);
+		}
+	}
 
 	//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
 	// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
 	float fit1_params[4] = {params.radius, params.offset(0), params.offset(1), params.offset(2)};
 	float fit2_params[4];
 	memcpy(fit2_params, fit1_params, sizeof(fit1_params));
-	JTJ = (JTJ + JTJ.transpose()) * 0.5f; // fix numerical issues
 	matrix::SquareMatrix<float, 4> JTJ2 = JTJ;
 
 	for (uint8_t i = 0; i < 4; i++) {
@@ -117,27 +136,33 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 		}
 	}
 
-	// Calculate mean squared residuals
+	// Calculate mean squared residuals for both candidate steps in a single pass
+	const float fit1_offset0 = fit1_params[1];
+	const float fit1_offset1 = fit1_params[2];
+	const float fit1_offset2 = fit1_params[3];
+	const float fit2_offset0 = fit2_params[1];
+	const float fit2_offset1 = fit2_params[2];
+	const float fit2_offset2 = fit2_params[3];
+
 	for (uint16_t k = 0; k < samples_collected; k++) {
-		float A = (params.diag(0)    * (x[k] - fit1_params[1])) + (params.offdiag(0) * (y[k] - fit1_params[2])) +
-			  (params.offdiag(1) *
-			   (z[k] + fit1_params[3]));
-		float B = (params.offdiag(0) * (x[k] - fit1_params[1])) + (params.diag(1)    * (y[k] - fit1_params[2])) +
-			  (params.offdiag(2) *
-			   (z[k] + fit1_params[3]));
-		float C = (params.offdiag(1) * (x[k] - fit1_params[1])) + (params.offdiag(2) * (y[k] - fit1_params[2])) + (params.diag(
-					2)    *
-				(z[k] - fit1_params[3]));
+		float dx = x[k] - fit1_offset0;
+		float dy = y[k] - fit1_offset1;
+		float dz = z[k] - fit1_offset2;
+
+		float A = (diag0    * dx) + (offdiag0 * dy) + (offdiag1 * dz);
+		float B = (offdiag0 * dx) + (diag1    * dy) + (offdiag2 * dz);
+		float C = (offdiag1 * dx) + (offdiag2 * dy) + (diag2    * dz);
 		float length = sqrtf(A * A + B * B + C * C);
-		residual = fit1_params[0] - length;
+		float residual = fit1_params[0] - length;
 		fit1 += residual * residual;
 
-		A = (params.diag(0)    * (x[k] - fit2_params[1])) + (params.offdiag(0) * (y[k] - fit2_params[2])) + (params.offdiag(1) *
-				(z[k] - fit2_params[3]));
-		B = (params.offdiag(0) * (x[k] - fit2_params[1])) + (params.diag(1)    * (y[k] - fit2_params[2])) + (params.offdiag(2) *
-				(z[k] - fit2_params[3]));
-		C = (params.offdiag(1) * (x[k] - fit2_params[1])) + (params.offdiag(2) * (y[k] - fit2_params[2])) + (params.diag(2)    *
-				(z[k] - fit2_params[3]));
+		dx = x[k] - fit2_offset0;
+		dy = y[k] - fit2_offset1;
+		dz = z[k] - fit2_offset2;
+
+		A = (diag0    * dx) + (offdiag0 * dy) + (offdiag1 * dz);
+		B = (offdiag0 * dx) + (diag1    * dy) + (offdiag2 * dz);
+		C = (offdiag1 * dx) + (offdiag2 * dy) + (diag2    * dz);
 		length = sqrtf(A * A + B * B + C * C);
 		residual = fit2_params[0] - length;
 		fit2 += residual * residual;
@@ -184,38 +209,48 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 
 	matrix::SquareMatrix<float, 9> JTJ;
 	float JTFI[9] {};
-	float residual = 0.0f;
 	float ellipsoid_jacob[9];
 
+	const float diag0 = params.diag(0);
+	const float diag1 = params.diag(1);
+	const float diag2 = params.diag(2);
+	const float offdiag0 = params.offdiag(0);
+	const float offdiag1 = params.offdiag(1);
+	const float offdiag2 = params.offdiag(2);
+	const float offset0 = params.offset(0);
+	const float offset1 = params.offset(1);
+	const float offset2 = params.offset(2);
+
 	// Gauss Newton Part common for all kind of extensions including LM
 	for (uint16_t k = 0; k < samples_collected; k++) {
 
+		const float dx = x[k] - offset0;
+		const float dy = y[k] - offset1;
+		const float dz = z[k] - offset2;
+
 		// Calculate Jacobian
-		float A = (params.diag(0)    * (x[k] - params.offset(0))) + (params.offdiag(0) * (y[k] - params.offset(1))) +
-			  (params.offdiag(1) * (z[k] - params.offset(2)));
-		float B = (params.offdiag(0) * (x[k] - params.offset(0))) + (params.diag(1)    * (y[k] - params.offset(1))) +
-			  (params.offdiag(2) * (z[k] - params.offset(2)));
-		float C = (params.offdiag(1) * (x[k] - params.offset(0))) + (params.offdiag(2) * (y[k] - params.offset(1))) +
-			  (params.diag(2)    * (z[k] - params.offset(2)));
-		float length = sqrtf(A * A + B * B + C * C);
-		residual = params.radius - length;
-		fit1 += residual * residual;
+		const float A = (diag0    * dx) + (offdiag0 * dy) + (offdiag1 * dz);
+		const float B = (offdiag0 * dx) + (diag1    * dy) + (offdiag2 * dz);
+		const float C = (offdiag1 * dx) + (offdiag2 * dy) + (diag2    * dz);
+		const float length = sqrtf(A * A + B * B + C * C);
+		const float inv_length = 1.0f / length;
+		const float residual = params.radius - length;
 		// 0-2: partial derivative (offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[0] = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
-		ellipsoid_jacob[1] = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
-		ellipsoid_jacob[2] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
+		ellipsoid_jacob[0] = ((diag0    * A) + (offdiag0 * B) + (offdiag1 * C)) * inv_length;
+		ellipsoid_jacob[1] = ((offdiag0 * A) + (diag1    * B) + (offdiag2 * C)) * inv_length;
+		ellipsoid_jacob[2] = ((offdiag1 * A) + (offdiag2 * B) + (diag2    * C)) * inv_length;
 		// 3-5: partial derivative (diag offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[3] = -1.0f * ((x[k] - params.offset(0)) * A) / length;
-		ellipsoid_jacob[4] = -1.0f * ((y[k] - params.offset(1)) * B) / length;
-		ellipsoid_jacob[5] = -1.0f * ((z[k] - params.offset(2)) * C) / length;
+		ellipsoid_jacob[3] = -(dx * A) * inv_length;
+		ellipsoid_jacob[4] = -(dy * B) * inv_length;
+		ellipsoid_jacob[5] = -(dz * C) * inv_length;
 		// 6-8: partial derivative (off-diag offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[6] = -1.0f * (((y[k] - params.offset(1)) * A) + ((x[k] - params.offset(0)) * B)) / length;
-		ellipsoid_jacob[7] = -1.0f * (((z[k] - params.offset(2)) * A) + ((x[k] - params.offset(0)) * C)) / length;
-		ellipsoid_jacob[8] = -1.0f * (((z[k] - params.offset(2)) * B) + ((y[k] - params.offset(1)) * C)) / length;
+		ellipsoid_jacob[6] = -((dy * A) + (dx * B)) * inv_length;
+		ellipsoid_jacob[7] = -((dz * A) + (dx * C)) * inv_length;
+		ellipsoid_jacob[8] = -((dz * B) + (dy * C)) * inv_length;
 
+		// JTJ is symmetric: accumulate the upper triangle only
 		for (uint8_t i = 0; i < 9; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 9; j++) {
+			for (uint8_t j = i; j < 9; j++) {
 				JTJ(i, j) += ellipsoid_jacob[i] * ellipsoid_jacob[j];
 			}
 
@@ -223,6 +258,12 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 		}
 	}
 
+	// mirror the lower triangle
+	for (uint8_t i = 1; i < 9; i++) {
+		for (uint8_t j = 0; j < i; j++) {
+			JTJ(i, j) = JTJ(j, i);
+		}
+	}
 
 	//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
 	// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -254,24 +295,26 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 		}
 	}
 
-	// Calculate mean squared residuals
+	// Calculate mean squared residuals for both candidate steps in a single pass
 	for (uint16_t k = 0; k < samples_collected; k++) {
-		float A = (fit1_params[3]    * (x[k] - fit1_params[0])) + (fit1_params[6] * (y[k] - fit1_params[1])) + (fit1_params[7] *
-				(z[k] - fit1_params[2]));
-		float B = (fit1_params[6] * (x[k] - fit1_params[0])) + (fit1_params[4]   * (y[k] - fit1_params[1])) + (fit1_params[8] *
-				(z[k] - fit1_params[2]));
-		float C = (fit1_params[7] * (x[k] - fit1_params[0])) + (fit1_params[8] * (y[k] - fit1_params[1])) + (fit1_params[5]    *
-				(z[k] - fit1_params[2]));
+		float dx = x[k] - fit1_params[0];
+		float dy = y[k] - fit1_params[1];
+		float dz = z[k] - fit1_params[2];
+
+		float A = (fit1_params[3] * dx) + (fit1_params[6] * dy) + (fit1_params[7] * dz);
+		float B = (fit1_params[6] * dx) + (fit1_params[4] * dy) + (fit1_params[8] * dz);
+		float C = (fit1_params[7] * dx) + (fit1_params[8] * dy) + (fit1_params[5] * dz);
 		float length = sqrtf(A * A + B * B + C * C);
-		residual = params.radius - length;
+		float residual = params.radius - length;
 		fit1 += residual * residual;
 
-		A = (fit2_params[3]    * (x[k] - fit2_params[0])) + (fit2_params[6] * (y[k] - fit2_params[1])) + (fit2_params[7] *
-				(z[k] - fit2_params[2]));
-		B = (fit2_params[6] * (x[k] - fit2_params[0])) + (fit2_params[4]   * (y[k] - fit2_params[1])) + (fit2_params[8] *
-				(z[k] - fit2_params[2]));
-		C = (fit2_params[7] * (x[k] - fit2_params[0])) + (fit2_params[8] * (y[k] - fit2_params[1])) + (fit2_params[5]    *
-				(z[k] - fit2_params[2]));
+		dx = x[k] - fit2_params[0];
+		dy = y[k] - fit2_params[1];
+		dz = z[k] - fit2_params[2];
+
+		A = (fit2_params[3] * dx) + (fit2_params[6] * dy) + (fit2_params[7] * dz);
+		B = (fit2_params[6] * dx) + (fit2_params[4] * dy) + (fit2_params[8] * dz);
+		C = (fit2_params[7] * dx) + (fit2_params[8] * dy) + (fit2_params[5] * dz);
 		length = sqrtf(A * A + B * B + C * C);
 		residual = params.radius - length;
 		fit2 += residual * residual;
@@ -330,6 +373,7 @@ int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int s
 	iter.gradient_damping = 1;
 
 	bool success = false;
+	float last_cost = iter.cost;
 
 	for (int i = 0; i < max_iterations; i++) {
 		if (full_ellipsoid) {
@@ -341,10 +385,20 @@ int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int s
 
 		if (iter.result == iteration_result::STATUS::SUCCESS
 		    && min_radius < params.radius && params.radius < max_radius
-		    && i > min_iterations && (iter.cost < cost_threshold || iter.gradient_damping < step_threshold)) {
-			success = true;
-			break;
+		    && (iter.cost < cost_threshold || iter.gradient_damping < step_threshold)) {
+
+			// with a warm start from the stored calibration the fit converges in a
+			// handful of iterations: stop as soon as an accepted step below the cost
+			// threshold no longer measurably improves the cost
+			const bool stalled = (last_cost - iter.cost) < (1e-6f * last_cost);
+
+			if (i > min_iterations || stalled) {
+				success = true;
+				break;
+			}
 		}
+
+		last_cost = iter.cost;
 	}
 
 	if (success) {
@@ -353,4 +407,3 @@ int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int s
 
 	return 1;
 }
-
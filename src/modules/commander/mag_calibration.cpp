@@ -571,6 +571,19 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 		sphere[cur_mag].zero();
 		diag[cur_mag] = Vector3f{1.f, 1.f, 1.f};
 		offdiag[cur_mag].zero();
+
+		// warm start the fit from the stored calibration: the samples are raw in a
+		// full calibration, so the previous offsets and scales are a much better
+		// initial guess than zero/identity and save most of the LM iterations
+		// (when appending, the samples are already corrected and the identity
+		// starting point is the right one)
+		if (!worker_data.append_to_existing_calibration && (worker_data.calibration[cur_mag].device_id() != 0)) {
+			const Matrix3f &scale = worker_data.calibration[cur_mag].scale();
+
+			sphere[cur_mag] = worker_data.calibration[cur_mag].offset();
+			diag[cur_mag] = Vector3f{scale(0, 0), scale(1, 1), scale(2, 2)};
+			offdiag[cur_mag] = Vector3f{scale(0, 1), scale(0, 2), scale(1, 2)};
+		}
 	}
 
 	if (result == calibrate_return_ok) {
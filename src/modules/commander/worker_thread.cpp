@@ -52,7 +52,7 @@ using namespace time_literals;
 
 WorkerThread::~WorkerThread()
 {
-	if (_state.load() == (int)State::Running) {
+	if ((_state.load() == (int)State::Running) && !isParamRequest(_request)) {
 		/* wait for thread to complete */
 		int ret = pthread_join(_thread_handle, nullptr);
 
@@ -60,6 +60,11 @@ WorkerThread::~WorkerThread()
 			PX4_ERR("join failed: %d", ret);
 		}
 	}
+
+	if (_param_work != nullptr) {
+		_param_work->wait();
+		delete _param_work;
+	}
 }
 
 void WorkerThread::startTask(Request request)
@@ -70,6 +75,25 @@ void WorkerThread::startTask(Request request)
 
 	_request = request;
 
+	if (isParamRequest(request)) {
+		/* param requests don't sleep internally: run them as a single-shot work
+		 * item instead of paying for a thread setup and teardown every time */
+		if (_param_work == nullptr) {
+			_param_work = new px4::WorkItemSingleShot(px4::wq_configurations::lp_default, paramWorkTrampoline, this);
+		}
+
+		if (_param_work == nullptr) {
+			PX4_ERR("alloc failed");
+			_ret_value = -1;
+			_state.store((int)State::Finished);
+			return;
+		}
+
+		_state.store((int)State::Running);
+		_param_work->ScheduleNow();
+		return;
+	}
+
 	/* initialize low priority thread */
 	pthread_attr_t low_prio_attr;
 	pthread_attr_init(&low_prio_attr);
@@ -149,6 +173,23 @@ void WorkerThread::threadEntry()
 		_ret_value = do_baro_calibration(&_mavlink_log_pub);
 		break;
 
+	default:
+		// param requests are handled in paramWork()
+		break;
+	}
+
+	_state.store((int)State::Finished); // set this last to signal the main thread we're done
+}
+
+void WorkerThread::paramWorkTrampoline(void *arg)
+{
+	WorkerThread *worker_thread = (WorkerThread *)arg;
+	worker_thread->paramWork();
+}
+
+void WorkerThread::paramWork()
+{
+	switch (_request) {
 	case Request::ParamLoadDefault:
 		_ret_value = param_load_default();
 
@@ -194,6 +235,10 @@ void WorkerThread::threadEntry()
 			_ret_value = 0;
 			break;
 		}
+
+	default:
+		// calibrations are handled in threadEntry()
+		break;
 	}
 
 	_state.store((int)State::Finished); // set this last to signal the main thread we're done
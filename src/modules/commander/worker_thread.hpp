@@ -36,14 +36,19 @@
 
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/posix.h>
+#include <px4_platform_common/px4_work_queue/WorkItemSingleShot.hpp>
 #include <systemlib/mavlink_log.h>
 #include <uORB/uORB.h>
 
 /**
  * @class WorkerThread
- * low priority background thread, started on demand, used for:
- * - calibration
- * - param saving
+ * Deferred maintenance operations:
+ * - calibrations run on a low priority background thread, started on demand
+ *   (the calibration routines sleep and poll internally, so they need to own
+ *   a thread for their whole duration)
+ * - param requests do not sleep and run as a single-shot item on the low
+ *   priority work queue instead, avoiding the thread setup cost on the
+ *   latency sensitive save path
  */
 class WorkerThread
 {
@@ -85,11 +90,17 @@ private:
 		Finished
 	};
 
+	static bool isParamRequest(Request request) { return (int)request >= (int)Request::ParamLoadDefault; }
+
 	static void *threadEntryTrampoline(void *arg);
 	void threadEntry();
 
+	static void paramWorkTrampoline(void *arg);
+	void paramWork();
+
 	px4::atomic_int _state{(int)State::Idle};
 	pthread_t _thread_handle{};
+	px4::WorkItemSingleShot *_param_work{nullptr};
 	int _ret_value{};
 	Request _request;
 	orb_advert_t _mavlink_log_pub{nullptr};
@@ -47,10 +47,28 @@ ControlAllocationPseudoInverse::setEffectivenessMatrix(
 	const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 	bool update_normalization_scale)
 {
+	// Dynamic effectiveness sources (e.g. tiltrotors, airspeed scaling) push the matrix
+	// periodically even while its content is unchanged. The pseudo-inverse only depends on
+	// the matrix itself, so skip the expensive recomputation in that case (exact comparison:
+	// any real change, including zeroed columns after an actuator failure, invalidates it).
+	bool recompute_mix = update_normalization_scale || (num_actuators != _num_actuators);
+
+	for (int i = 0; i < NUM_AXES && !recompute_mix; i++) {
+		for (int j = 0; j < NUM_ACTUATORS; j++) {
+			if (effectiveness(i, j) != _effectiveness(i, j)) {
+				recompute_mix = true;
+				break;
+			}
+		}
+	}
+
 	ControlAllocation::setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, num_actuators,
 			update_normalization_scale);
-	_mix_update_needed = true;
-	_normalization_needs_update = update_normalization_scale;
+
+	if (recompute_mix) {
+		_mix_update_needed = true;
+		_normalization_needs_update = update_normalization_scale;
+	}
 }
 
 void
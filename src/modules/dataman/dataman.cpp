@@ -52,6 +52,15 @@
 #include <lib/perf/perf_counter.h>
 #include <stdlib.h>
 
+#if defined(__PX4_POSIX)
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+__BEGIN_DECLS
+#include <lib/systemlib/crc.h>
+__END_DECLS
+#endif
+
 #include "dataman.h"
 
 __BEGIN_DECLS
@@ -74,6 +83,15 @@ static int  _ram_clear(dm_item_t item);
 static int _ram_initialize(unsigned max_offset);
 static void _ram_shutdown();
 
+#if defined(__PX4_POSIX)
+/* Private memory mapped file Operations */
+static ssize_t _mmap_write(dm_item_t item, unsigned index, const void *buf, size_t count);
+static ssize_t _mmap_read(dm_item_t item, unsigned index, void *buf, size_t count);
+static int  _mmap_clear(dm_item_t item);
+static int _mmap_initialize(unsigned max_offset);
+static void _mmap_shutdown();
+#endif
+
 typedef struct dm_operations_t {
 	ssize_t (*write)(dm_item_t item, unsigned index, const void *buf, size_t count);
 	ssize_t (*read)(dm_item_t item, unsigned index, void *buf, size_t count);
@@ -101,6 +119,17 @@ static constexpr dm_operations_t dm_ram_operations = {
 	.wait = px4_sem_wait,
 };
 
+#if defined(__PX4_POSIX)
+static constexpr dm_operations_t dm_mmap_operations = {
+	.write   = _mmap_write,
+	.read    = _mmap_read,
+	.clear   = _mmap_clear,
+	.initialize = _mmap_initialize,
+	.shutdown = _mmap_shutdown,
+	.wait = px4_sem_wait,
+};
+#endif
+
 static const dm_operations_t *g_dm_ops;
 
 static struct {
@@ -117,11 +146,48 @@ static struct {
 	bool silence = false;
 } dm_operations_data;
 
+/* table of maximum number of instances for each item type */
+static const unsigned g_per_item_max_index[DM_KEY_NUM_KEYS] = {
+	DM_KEY_SAFE_POINTS_MAX,
+	DM_KEY_FENCE_POINTS_MAX,
+	DM_KEY_WAYPOINTS_OFFBOARD_0_MAX,
+	DM_KEY_WAYPOINTS_OFFBOARD_1_MAX,
+	DM_KEY_MISSION_STATE_MAX,
+	DM_KEY_COMPAT_MAX
+};
+
+#define DM_SECTOR_HDR_SIZE 4	/* data manager per item header overhead */
+
+/* Table of the len of each item type */
+static constexpr size_t g_per_item_size[DM_KEY_NUM_KEYS] = {
+	sizeof(struct mission_safe_point_s) + DM_SECTOR_HDR_SIZE,
+	sizeof(struct mission_fence_point_s) + DM_SECTOR_HDR_SIZE,
+	sizeof(struct mission_item_s) + DM_SECTOR_HDR_SIZE,
+	sizeof(struct mission_item_s) + DM_SECTOR_HDR_SIZE,
+	sizeof(struct mission_s) + DM_SECTOR_HDR_SIZE,
+	sizeof(struct dataman_compat_s) + DM_SECTOR_HDR_SIZE
+};
+
+/* largest user payload of any item type, sizes the per work item data copy for asynchronous writes */
+static constexpr size_t per_item_max_payload()
+{
+	size_t result = 0;
+
+	for (size_t size : g_per_item_size) {
+		if (size > result) {
+			result = size;
+		}
+	}
+
+	return result - DM_SECTOR_HDR_SIZE;
+}
+
 /** Types of function calls supported by the worker task */
 typedef enum {
 	dm_write_func = 0,
 	dm_read_func,
 	dm_clear_func,
+	dm_flush_func,		/**< flush the write-behind state (waypoint cache or mmap store) to the media */
 	dm_number_of_funcs
 } dm_function_t;
 
@@ -131,6 +197,9 @@ typedef struct {
 	px4_sem_t wait_sem;
 	unsigned char first;
 	unsigned char func;
+	bool notify;		/**< caller waits on wait_sem; if false the worker destroys the item when done */
+	dm_callback_t callback;	/**< optional completion callback, invoked on the worker thread */
+	void *callback_arg;
 	ssize_t result;
 	union {
 		struct {
@@ -149,6 +218,7 @@ typedef struct {
 			dm_item_t item;
 		} clear_params;
 	};
+	uint8_t data[per_item_max_payload()];	/**< copy of the caller data for asynchronous writes */
 } work_q_item_t;
 
 const size_t k_work_item_allocation_chunk_size = 8;
@@ -156,28 +226,6 @@ const size_t k_work_item_allocation_chunk_size = 8;
 /* Usage statistics */
 static unsigned g_func_counts[dm_number_of_funcs];
 
-/* table of maximum number of instances for each item type */
-static const unsigned g_per_item_max_index[DM_KEY_NUM_KEYS] = {
-	DM_KEY_SAFE_POINTS_MAX,
-	DM_KEY_FENCE_POINTS_MAX,
-	DM_KEY_WAYPOINTS_OFFBOARD_0_MAX,
-	DM_KEY_WAYPOINTS_OFFBOARD_1_MAX,
-	DM_KEY_MISSION_STATE_MAX,
-	DM_KEY_COMPAT_MAX
-};
-
-#define DM_SECTOR_HDR_SIZE 4	/* data manager per item header overhead */
-
-/* Table of the len of each item type */
-static constexpr size_t g_per_item_size[DM_KEY_NUM_KEYS] = {
-	sizeof(struct mission_safe_point_s) + DM_SECTOR_HDR_SIZE,
-	sizeof(struct mission_fence_point_s) + DM_SECTOR_HDR_SIZE,
-	sizeof(struct mission_item_s) + DM_SECTOR_HDR_SIZE,
-	sizeof(struct mission_item_s) + DM_SECTOR_HDR_SIZE,
-	sizeof(struct mission_s) + DM_SECTOR_HDR_SIZE,
-	sizeof(struct dataman_compat_s) + DM_SECTOR_HDR_SIZE
-};
-
 /* Table of offset for index 0 of each item type */
 static unsigned int g_key_offsets[DM_KEY_NUM_KEYS];
 
@@ -197,9 +245,78 @@ static enum {
 	BACKEND_NONE = 0,
 	BACKEND_FILE,
 	BACKEND_RAM,
+#if defined(__PX4_POSIX)
+	BACKEND_MMAP,
+#endif
 	BACKEND_LAST
 } backend = BACKEND_NONE;
 
+#if defined(__PX4_POSIX)
+/* Memory mapped file backend (POSIX only).
+ *
+ * The whole store is one file mapping: reads and writes complete in the
+ * caller's context as plain memory accesses and the worker thread msyncs the
+ * mapping behind them, giving RAM-backend speed with file-backend durability.
+ * The spare header bytes of each item carry a CRC of its payload, so an item
+ * torn by a crash between a write and its write-back is detected on read.
+ */
+static struct {
+	uint8_t *data;
+	unsigned size;
+	int fd;
+	bool flush_queued;	/**< an msync work item is pending, don't queue another */
+	px4_sem_t mutex;	/**< keeps single item accesses atomic */
+} g_mmap;
+#endif
+
+/* Write-behind RAM cache for the mission waypoint item types (file backend only).
+ *
+ * The leading slots of DM_KEY_WAYPOINTS_OFFBOARD_0/1 are mirrored in RAM in the
+ * on-disk layout. Reads of mirrored slots are served from memory in the caller's
+ * context, writes update the mirror, return immediately and are flushed to the
+ * file by the worker thread, so neither mission uploads nor mission item reads
+ * during flight wait for SD card I/O. Slots beyond the mirror (very long
+ * missions) keep the synchronous path; each slot uses exactly one path, so the
+ * per slot write ordering is preserved.
+ */
+#if defined(MEMORY_CONSTRAINED_SYSTEM)
+static constexpr unsigned k_wp_cache_slots = 0;		/* cache disabled, the RAM is needed elsewhere */
+#elif defined(__PX4_POSIX)
+static constexpr unsigned k_wp_cache_slots = 500;	/* covers any mission QGC will upload */
+#else
+static constexpr unsigned k_wp_cache_slots = 100;
+#endif
+
+static_assert(k_wp_cache_slots <= DM_KEY_WAYPOINTS_OFFBOARD_0_MAX, "waypoint cache larger than the item type");
+
+static struct {
+	uint8_t *data;				/**< mirror of the leading waypoint slots, on-disk layout */
+	bool dirty[2 * (k_wp_cache_slots ? k_wp_cache_slots : 1)];	/**< per slot: mirror is newer than the file */
+	bool flush_queued;			/**< a flush work item is pending, don't queue another */
+	bool enabled;
+	px4_sem_t mutex;			/**< protects data, dirty and flush_queued */
+} g_wp_cache;
+
+static bool
+wp_cache_applies(dm_item_t item, unsigned index)
+{
+	return g_wp_cache.enabled && (item == DM_KEY_WAYPOINTS_OFFBOARD_0 || item == DM_KEY_WAYPOINTS_OFFBOARD_1)
+	       && (index < k_wp_cache_slots);
+}
+
+/* slot number within the cache (both item types back to back) */
+static unsigned
+wp_cache_slot(dm_item_t item, unsigned index)
+{
+	return ((item == DM_KEY_WAYPOINTS_OFFBOARD_0) ? 0 : k_wp_cache_slots) + index;
+}
+
+static uint8_t *
+wp_cache_buffer(dm_item_t item, unsigned index)
+{
+	return &g_wp_cache.data[wp_cache_slot(item, index) * g_per_item_size[item]];
+}
+
 /* The data manager work queues */
 
 typedef struct {
@@ -287,6 +404,10 @@ create_work_item()
 		/* item->wait_sem use case is a signal */
 
 		px4_sem_setprotocol(&item->wait_sem, SEM_PRIO_NONE);
+
+		item->notify = true;
+		item->callback = nullptr;
+		item->callback_arg = nullptr;
 	}
 
 	/* return the item pointer, or nullptr if all failed */
@@ -327,8 +448,8 @@ dequeue_work_item()
 	return work;
 }
 
-static int
-enqueue_work_item_and_wait_for_result(work_q_item_t *item)
+static void
+enqueue_work_item(work_q_item_t *item)
 {
 	/* put the work item at the end of the work queue */
 	lock_queue(&g_work_q);
@@ -343,6 +464,12 @@ enqueue_work_item_and_wait_for_result(work_q_item_t *item)
 
 	/* tell the work thread that work is available */
 	px4_sem_post(&g_work_queued_sema);
+}
+
+static int
+enqueue_work_item_and_wait_for_result(work_q_item_t *item)
+{
+	enqueue_work_item(item);
 
 	/* wait for the result */
 	px4_sem_wait(&item->wait_sem);
@@ -382,8 +509,8 @@ calculate_offset(dm_item_t item, unsigned index)
  *
  * byte 0: Length of user data item
  * byte 1: Unused (previously persistence of this data item)
- * byte 2: Unused (for future use)
- * byte 3: Unused (for future use)
+ * byte 2: Unused (mmap backend: payload CRC, low byte)
+ * byte 3: Unused (mmap backend: payload CRC, high byte)
  * byte DM_SECTOR_HDR_SIZE... : data item value
  *
  * The total size must not exceed g_per_item_max_index[item]
@@ -787,6 +914,408 @@ _ram_shutdown()
 	dm_operations_data.running = false;
 }
 
+#if defined(__PX4_POSIX)
+
+/* write to the memory mapped store, in the caller's context */
+static ssize_t
+_mmap_write(dm_item_t item, unsigned index, const void *buf, size_t count)
+{
+	/* Get the offset for this item */
+	const int offset = calculate_offset(item, index);
+
+	/* If item type or index out of range, return error */
+	if (offset < 0) {
+		return -1;
+	}
+
+	/* Make sure caller has not given us more data than we can handle */
+	if (count > (g_per_item_size[item] - DM_SECTOR_HDR_SIZE)) {
+		return -E2BIG;
+	}
+
+	const uint16_t crc = crc16_signature(CRC16_INITIAL, count, (const uint8_t *)buf);
+
+	px4_sem_wait(&g_mmap.mutex);
+
+	uint8_t *buffer = &g_mmap.data[offset];
+
+	/* Write out the data, prefixed with length and the payload CRC */
+	buffer[0] = count;
+	buffer[1] = 0;
+	buffer[2] = crc & 0xFF;
+	buffer[3] = crc >> 8;
+
+	if (count > 0) {
+		memcpy(buffer + DM_SECTOR_HDR_SIZE, buf, count);
+	}
+
+	px4_sem_post(&g_mmap.mutex);
+
+	/* All is well... return the number of user data written */
+	return count;
+}
+
+/* Retrieve straight from the mapping, verifying the item CRC */
+static ssize_t
+_mmap_read(dm_item_t item, unsigned index, void *buf, size_t count)
+{
+	/* Get the offset for this item */
+	const int offset = calculate_offset(item, index);
+
+	/* If item type or index out of range, return error */
+	if (offset < 0) {
+		return -1;
+	}
+
+	/* Make sure the caller hasn't asked for more data than we can handle */
+	if (count > (g_per_item_size[item] - DM_SECTOR_HDR_SIZE)) {
+		return -E2BIG;
+	}
+
+	px4_sem_wait(&g_mmap.mutex);
+
+	const uint8_t *buffer = &g_mmap.data[offset];
+	const ssize_t len = buffer[0];
+
+	/* A zero length entry is a empty entry */
+	if (len == 0) {
+		px4_sem_post(&g_mmap.mutex);
+		return 0;
+	}
+
+	/* We got more than requested!!! */
+	if (len > (ssize_t)count) {
+		px4_sem_post(&g_mmap.mutex);
+		return -1;
+	}
+
+	/* An item whose payload does not match its CRC was torn by a crash between
+	 * the write and its write-back and is treated as lost */
+	const uint16_t crc_stored = buffer[2] | (buffer[3] << 8);
+
+	if (crc16_signature(CRC16_INITIAL, len, buffer + DM_SECTOR_HDR_SIZE) != crc_stored) {
+		px4_sem_post(&g_mmap.mutex);
+
+		if (!dm_operations_data.silence) {
+			PX4_ERR("CRC mismatch, item %d index %u dropped", item, index);
+		}
+
+		return -1;
+	}
+
+	/* Looks good, copy it to the caller's buffer */
+	memcpy(buf, buffer + DM_SECTOR_HDR_SIZE, len);
+	px4_sem_post(&g_mmap.mutex);
+
+	/* Return the number of bytes of caller data read */
+	return len;
+}
+
+static int
+_mmap_clear(dm_item_t item)
+{
+	/* Get the offset of 1st item of this type */
+	int offset = calculate_offset(item, 0);
+
+	/* Check for item type out of range */
+	if (offset < 0) {
+		return -1;
+	}
+
+	px4_sem_wait(&g_mmap.mutex);
+
+	/* Clear all items of this type */
+	for (unsigned i = 0; i < g_per_item_max_index[item]; i++) {
+		g_mmap.data[offset] = 0;
+		offset += g_per_item_size[item];
+	}
+
+	px4_sem_post(&g_mmap.mutex);
+
+	return 0;
+}
+
+static int
+_mmap_initialize(unsigned max_offset)
+{
+	/* Open or create the data manager file */
+	g_mmap.fd = open(k_data_manager_device_path, O_RDWR | O_CREAT | O_BINARY, PX4_O_MODE_666);
+
+	if (g_mmap.fd < 0) {
+		PX4_WARN("Could not open data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	/* Size the file to the full layout up front, the mapping cannot grow it */
+	struct stat st;
+	const bool size_ok = (fstat(g_mmap.fd, &st) == 0) && (st.st_size == (off_t)max_offset);
+
+	if (!size_ok && (ftruncate(g_mmap.fd, max_offset) != 0)) {
+		close(g_mmap.fd);
+		PX4_WARN("Could not size data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	g_mmap.data = (uint8_t *)mmap(nullptr, max_offset, PROT_READ | PROT_WRITE, MAP_SHARED, g_mmap.fd, 0);
+
+	if (g_mmap.data == MAP_FAILED) {
+		close(g_mmap.fd);
+		PX4_WARN("Could not map data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	g_mmap.size = max_offset;
+	g_mmap.flush_queued = false;
+	px4_sem_init(&g_mmap.mutex, 1, 1);
+
+	/* Check the compat item; a changed layout (or a store written without CRCs)
+	 * invalidates the whole store */
+	struct dataman_compat_s compat_state;
+	dm_operations_data.silence = true;
+	int ret = _mmap_read(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state));
+	dm_operations_data.silence = false;
+
+	if ((ret != sizeof(compat_state)) || (compat_state.key != DM_COMPAT_KEY)) {
+		memset(g_mmap.data, 0, g_mmap.size);
+
+		compat_state.key = DM_COMPAT_KEY;
+		ret = _mmap_write(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state));
+
+		if (ret != sizeof(compat_state)) {
+			PX4_ERR("Failed writing compat: %d", ret);
+		}
+
+		msync(g_mmap.data, g_mmap.size, MS_SYNC);
+	}
+
+	dm_operations_data.running = true;
+
+	return 0;
+}
+
+static void
+_mmap_shutdown()
+{
+	msync(g_mmap.data, g_mmap.size, MS_SYNC);
+	munmap(g_mmap.data, g_mmap.size);
+	close(g_mmap.fd);
+	px4_sem_destroy(&g_mmap.mutex);
+	dm_operations_data.running = false;
+}
+
+/* Write back the mapping. Worker thread only; the kernel only writes the dirty pages. */
+static void
+_mmap_flush()
+{
+	/* writes from here on queue a new msync */
+	px4_sem_wait(&g_mmap.mutex);
+	g_mmap.flush_queued = false;
+	px4_sem_post(&g_mmap.mutex);
+
+	if (msync(g_mmap.data, g_mmap.size, MS_SYNC) != 0) {
+		PX4_ERR("msync failed %d", errno);
+	}
+}
+
+/* Queue a fire-and-forget msync work item unless one is already pending */
+static void
+_mmap_queue_flush()
+{
+	px4_sem_wait(&g_mmap.mutex);
+	const bool already_queued = g_mmap.flush_queued;
+	g_mmap.flush_queued = true;
+	px4_sem_post(&g_mmap.mutex);
+
+	if (already_queued) {
+		return;
+	}
+
+	work_q_item_t *work = create_work_item();
+
+	if (work == nullptr) {
+		/* the data stays in the mapping, retry with the next write */
+		px4_sem_wait(&g_mmap.mutex);
+		g_mmap.flush_queued = false;
+		px4_sem_post(&g_mmap.mutex);
+		return;
+	}
+
+	work->func = dm_flush_func;
+	work->notify = false;
+	enqueue_work_item(work);
+}
+
+#endif /* __PX4_POSIX */
+
+/* Serve a read of a mirrored waypoint slot from RAM, same semantics as the backend read */
+static ssize_t
+wp_cache_read(dm_item_t item, unsigned index, void *buf, size_t count)
+{
+	if (count > (g_per_item_size[item] - DM_SECTOR_HDR_SIZE)) {
+		return -E2BIG;
+	}
+
+	px4_sem_wait(&g_wp_cache.mutex);
+
+	const uint8_t *buffer = wp_cache_buffer(item, index);
+	const ssize_t len = buffer[0];
+
+	if (len > (ssize_t)count) {
+		px4_sem_post(&g_wp_cache.mutex);
+		return -1;
+	}
+
+	if (len > 0) {
+		memcpy(buf, buffer + DM_SECTOR_HDR_SIZE, len);
+	}
+
+	px4_sem_post(&g_wp_cache.mutex);
+	return len;
+}
+
+/* Update a mirrored waypoint slot and mark it for the next flush */
+static ssize_t
+wp_cache_write(dm_item_t item, unsigned index, const void *buf, size_t count)
+{
+	if (count > (g_per_item_size[item] - DM_SECTOR_HDR_SIZE)) {
+		return -E2BIG;
+	}
+
+	px4_sem_wait(&g_wp_cache.mutex);
+
+	uint8_t *buffer = wp_cache_buffer(item, index);
+
+	/* Write out the data, prefixed with length */
+	buffer[0] = count;
+	buffer[1] = 0;
+	buffer[2] = 0;
+	buffer[3] = 0;
+
+	if (count > 0) {
+		memcpy(buffer + DM_SECTOR_HDR_SIZE, buf, count);
+	}
+
+	g_wp_cache.dirty[wp_cache_slot(item, index)] = true;
+	px4_sem_post(&g_wp_cache.mutex);
+
+	return count;
+}
+
+/* Queue a fire-and-forget flush work item unless one is already pending */
+static void
+wp_cache_queue_flush()
+{
+	px4_sem_wait(&g_wp_cache.mutex);
+	const bool already_queued = g_wp_cache.flush_queued;
+	g_wp_cache.flush_queued = true;
+	px4_sem_post(&g_wp_cache.mutex);
+
+	if (already_queued) {
+		return;
+	}
+
+	work_q_item_t *work = create_work_item();
+
+	if (work == nullptr) {
+		/* the data stays dirty in the mirror, retry with the next write */
+		px4_sem_wait(&g_wp_cache.mutex);
+		g_wp_cache.flush_queued = false;
+		px4_sem_post(&g_wp_cache.mutex);
+		return;
+	}
+
+	work->func = dm_flush_func;
+	work->notify = false;
+	enqueue_work_item(work);
+}
+
+/* Write all dirty mirror slots to the backend. Worker thread only. */
+static void
+wp_cache_flush()
+{
+	uint8_t buffer[g_per_item_size[DM_KEY_WAYPOINTS_OFFBOARD_0]];
+
+	/* writes marking slots dirty from here on queue a new flush */
+	px4_sem_wait(&g_wp_cache.mutex);
+	g_wp_cache.flush_queued = false;
+	px4_sem_post(&g_wp_cache.mutex);
+
+	for (unsigned slot = 0; slot < 2 * k_wp_cache_slots; slot++) {
+		const dm_item_t item = (slot < k_wp_cache_slots) ? DM_KEY_WAYPOINTS_OFFBOARD_0 : DM_KEY_WAYPOINTS_OFFBOARD_1;
+		const unsigned index = (slot < k_wp_cache_slots) ? slot : (slot - k_wp_cache_slots);
+
+		px4_sem_wait(&g_wp_cache.mutex);
+
+		if (!g_wp_cache.dirty[slot]) {
+			px4_sem_post(&g_wp_cache.mutex);
+			continue;
+		}
+
+		memcpy(buffer, wp_cache_buffer(item, index), g_per_item_size[item]);
+		g_wp_cache.dirty[slot] = false;
+		px4_sem_post(&g_wp_cache.mutex);
+
+		if (g_dm_ops->write(item, index, buffer + DM_SECTOR_HDR_SIZE, buffer[0]) != buffer[0]) {
+			PX4_ERR("wp cache flush failed, item %d index %u", item, index);
+		}
+	}
+}
+
+/* Allocate the waypoint mirror and populate it from the file. Worker thread, during init. */
+static void
+wp_cache_init()
+{
+	g_wp_cache.enabled = false;
+
+	if ((k_wp_cache_slots == 0) || (backend != BACKEND_FILE)) {
+		return;		/* the RAM backend is memory already */
+	}
+
+	const size_t size = 2 * k_wp_cache_slots * g_per_item_size[DM_KEY_WAYPOINTS_OFFBOARD_0];
+	g_wp_cache.data = (uint8_t *)malloc(size);
+
+	if (g_wp_cache.data == nullptr) {
+		PX4_WARN("could not allocate %zu bytes for the waypoint cache", size);
+		return;
+	}
+
+	memset(g_wp_cache.data, 0, size);
+	memset(g_wp_cache.dirty, 0, sizeof(g_wp_cache.dirty));
+	g_wp_cache.flush_queued = false;
+
+	/* preload both mirrored regions, a short read leaves empty (zeroed) slots */
+	for (int t = 0; t < 2; t++) {
+		const dm_item_t item = (t == 0) ? DM_KEY_WAYPOINTS_OFFBOARD_0 : DM_KEY_WAYPOINTS_OFFBOARD_1;
+		const int offset = calculate_offset(item, 0);
+
+		if ((offset >= 0) && (lseek(dm_operations_data.file.fd, offset, SEEK_SET) == offset)) {
+			read(dm_operations_data.file.fd, wp_cache_buffer(item, 0), k_wp_cache_slots * g_per_item_size[item]);
+		}
+	}
+
+	px4_sem_init(&g_wp_cache.mutex, 1, 1);
+	g_wp_cache.enabled = true;
+}
+
+/* Flush the remaining dirty slots and release the mirror. Worker thread, on exit. */
+static void
+wp_cache_shutdown()
+{
+	if (!g_wp_cache.enabled) {
+		return;
+	}
+
+	wp_cache_flush();
+
+	g_wp_cache.enabled = false;
+	px4_sem_destroy(&g_wp_cache.mutex);
+	free(g_wp_cache.data);
+	g_wp_cache.data = nullptr;
+}
+
 /** Write to the data manager file */
 __EXPORT ssize_t
 dm_write(dm_item_t item, unsigned index, const void *buf, size_t count)
@@ -800,6 +1329,34 @@ dm_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 
 	perf_begin(_dm_write_perf);
 
+#if defined(__PX4_POSIX)
+
+	/* the memory mapped backend completes in the caller's context, the worker msyncs behind it */
+	if (backend == BACKEND_MMAP) {
+		ssize_t ret = _mmap_write(item, index, buf, count);
+
+		if (ret >= 0) {
+			_mmap_queue_flush();
+		}
+
+		perf_end(_dm_write_perf);
+		return ret;
+	}
+
+#endif
+
+	/* mirrored waypoint slots are written behind: update RAM now, the worker flushes to the file */
+	if (wp_cache_applies(item, index)) {
+		ssize_t ret = wp_cache_write(item, index, buf, count);
+
+		if (ret >= 0) {
+			wp_cache_queue_flush();
+		}
+
+		perf_end(_dm_write_perf);
+		return ret;
+	}
+
 	/* get a work item and queue up a write request */
 	if ((work = create_work_item()) == nullptr) {
 		PX4_ERR("dm_write create_work_item failed");
@@ -832,6 +1389,24 @@ dm_read(dm_item_t item, unsigned index, void *buf, size_t count)
 
 	perf_begin(_dm_read_perf);
 
+#if defined(__PX4_POSIX)
+
+	/* the memory mapped backend reads straight from the mapping, no worker round trip */
+	if (backend == BACKEND_MMAP) {
+		ssize_t ret = _mmap_read(item, index, buf, count);
+		perf_end(_dm_read_perf);
+		return ret;
+	}
+
+#endif
+
+	/* mirrored waypoint slots are read straight from RAM, no worker round trip */
+	if (wp_cache_applies(item, index)) {
+		ssize_t ret = wp_cache_read(item, index, buf, count);
+		perf_end(_dm_read_perf);
+		return ret;
+	}
+
 	/* get a work item and queue up a read request */
 	if ((work = create_work_item()) == nullptr) {
 		PX4_ERR("dm_read create_work_item failed");
@@ -862,6 +1437,21 @@ dm_clear(dm_item_t item)
 		return -1;
 	}
 
+#if defined(__PX4_POSIX)
+
+	/* the memory mapped backend completes in the caller's context, the worker msyncs behind it */
+	if (backend == BACKEND_MMAP) {
+		int ret = _mmap_clear(item);
+
+		if (ret == 0) {
+			_mmap_queue_flush();
+		}
+
+		return ret;
+	}
+
+#endif
+
 	/* get a work item and queue up a clear request */
 	if ((work = create_work_item()) == nullptr) {
 		PX4_ERR("dm_clear create_work_item failed");
@@ -871,10 +1461,148 @@ dm_clear(dm_item_t item)
 	work->func = dm_clear_func;
 	work->clear_params.item = item;
 
+	/* mirrored waypoint types: wipe the mirror now, the worker clears the backend behind it */
+	if (g_wp_cache.enabled && ((item == DM_KEY_WAYPOINTS_OFFBOARD_0) || (item == DM_KEY_WAYPOINTS_OFFBOARD_1))) {
+		px4_sem_wait(&g_wp_cache.mutex);
+
+		for (unsigned i = 0; i < k_wp_cache_slots; i++) {
+			wp_cache_buffer(item, i)[0] = 0;
+			g_wp_cache.dirty[wp_cache_slot(item, i)] = false;	/* the backend clear wipes the whole type */
+		}
+
+		px4_sem_post(&g_wp_cache.mutex);
+
+		work->notify = false;
+		enqueue_work_item(work);
+		return 0;
+	}
+
 	/* Enqueue the item on the work queue and wait for the worker thread to complete processing it */
 	return enqueue_work_item_and_wait_for_result(work);
 }
 
+__EXPORT int
+dm_read_async(dm_item_t item, unsigned index, void *buffer, size_t buflen, dm_callback_t callback, void *arg)
+{
+	/* Make sure data manager has been started and is not shutting down */
+	if (!is_running() || g_task_should_exit) {
+		return -1;
+	}
+
+#if defined(__PX4_POSIX)
+
+	/* the memory mapped backend completes in the caller's context */
+	if (backend == BACKEND_MMAP) {
+		ssize_t result = _mmap_read(item, index, buffer, buflen);
+
+		if (callback) {
+			callback(result, arg);
+		}
+
+		return 0;
+	}
+
+#endif
+
+	/* mirrored waypoint slots complete in the caller's context */
+	if (wp_cache_applies(item, index)) {
+		ssize_t result = wp_cache_read(item, index, buffer, buflen);
+
+		if (callback) {
+			callback(result, arg);
+		}
+
+		return 0;
+	}
+
+	work_q_item_t *work = create_work_item();
+
+	if (work == nullptr) {
+		PX4_ERR("dm_read_async create_work_item failed");
+		return -1;
+	}
+
+	work->func = dm_read_func;
+	work->read_params.item = item;
+	work->read_params.index = index;
+	work->read_params.buf = buffer;
+	work->read_params.count = buflen;
+	work->notify = false;
+	work->callback = callback;
+	work->callback_arg = arg;
+
+	enqueue_work_item(work);
+	return 0;
+}
+
+__EXPORT int
+dm_write_async(dm_item_t item, unsigned index, const void *buffer, size_t buflen, dm_callback_t callback, void *arg)
+{
+	/* Make sure data manager has been started and is not shutting down */
+	if (!is_running() || g_task_should_exit) {
+		return -1;
+	}
+
+	if (buflen > per_item_max_payload()) {
+		return -1;
+	}
+
+#if defined(__PX4_POSIX)
+
+	/* the memory mapped backend completes in the caller's context */
+	if (backend == BACKEND_MMAP) {
+		ssize_t result = _mmap_write(item, index, buffer, buflen);
+
+		if (result >= 0) {
+			_mmap_queue_flush();
+		}
+
+		if (callback) {
+			callback(result, arg);
+		}
+
+		return 0;
+	}
+
+#endif
+
+	if (wp_cache_applies(item, index)) {
+		ssize_t result = wp_cache_write(item, index, buffer, buflen);
+
+		if (result >= 0) {
+			wp_cache_queue_flush();
+		}
+
+		if (callback) {
+			callback(result, arg);
+		}
+
+		return 0;
+	}
+
+	work_q_item_t *work = create_work_item();
+
+	if (work == nullptr) {
+		PX4_ERR("dm_write_async create_work_item failed");
+		return -1;
+	}
+
+	/* the request owns a copy of the data, the caller's buffer may go away */
+	memcpy(work->data, buffer, buflen);
+
+	work->func = dm_write_func;
+	work->write_params.item = item;
+	work->write_params.index = index;
+	work->write_params.buf = work->data;
+	work->write_params.count = buflen;
+	work->notify = false;
+	work->callback = callback;
+	work->callback_arg = arg;
+
+	enqueue_work_item(work);
+	return 0;
+}
+
 __EXPORT int
 dm_lock(dm_item_t item)
 {
@@ -950,6 +1678,13 @@ task_main(int argc, char *argv[])
 		g_dm_ops = &dm_ram_operations;
 		break;
 
+#if defined(__PX4_POSIX)
+
+	case BACKEND_MMAP:
+		g_dm_ops = &dm_mmap_operations;
+		break;
+#endif
+
 	default:
 		PX4_WARN("No valid backend set.");
 		return -1;
@@ -1013,10 +1748,19 @@ task_main(int argc, char *argv[])
 		PX4_INFO("data manager RAM size is %u bytes", max_offset);
 		break;
 
+#if defined(__PX4_POSIX)
+
+	case BACKEND_MMAP:
+		PX4_INFO("data manager file '%s' mapped, size is %u bytes", k_data_manager_device_path, max_offset);
+		break;
+#endif
+
 	default:
 		break;
 	}
 
+	wp_cache_init();
+
 	/* Tell startup that the worker thread has completed its initialization */
 	px4_sem_post(&g_init_sema);
 
@@ -1051,13 +1795,37 @@ task_main(int argc, char *argv[])
 				work->result = g_dm_ops->clear(work->clear_params.item);
 				break;
 
+			case dm_flush_func:
+				g_func_counts[dm_flush_func]++;
+				work->result = 0;
+
+#if defined(__PX4_POSIX)
+
+				if (backend == BACKEND_MMAP) {
+					_mmap_flush();
+					break;
+				}
+
+#endif
+				wp_cache_flush();
+				break;
+
 			default: /* should never happen */
 				work->result = -1;
 				break;
 			}
 
-			/* Inform the caller that work is done */
-			px4_sem_post(&work->wait_sem);
+			if (work->callback) {
+				work->callback(work->result, work->callback_arg);
+			}
+
+			/* Inform the caller that work is done, or dispose of the fire-and-forget item */
+			if (work->notify) {
+				px4_sem_post(&work->wait_sem);
+
+			} else {
+				destroy_work_item(work);
+			}
 		}
 
 		/* time to go???? */
@@ -1066,19 +1834,30 @@ task_main(int argc, char *argv[])
 		}
 	}
 
+	wp_cache_shutdown();
+
 	g_dm_ops->shutdown();
 
-	/* The work queue is now empty, empty the free queue */
+	/* The work queue is now empty, empty the free queue. Items were allocated in
+	 * chunks, so unlink everything first and only then free the chunk heads,
+	 * otherwise a freed chunk may still have siblings linked in the queue. */
+	sq_queue_t chunk_heads;
+	sq_init(&chunk_heads);
+
 	for (;;) {
 		if ((work = (work_q_item_t *)sq_remfirst(&(g_free_q.q))) == nullptr) {
 			break;
 		}
 
 		if (work->first) {
-			free(work);
+			sq_addfirst(&work->link, &chunk_heads);
 		}
 	}
 
+	while ((work = (work_q_item_t *)sq_remfirst(&chunk_heads))) {
+		free(work);
+	}
+
 end:
 	backend = BACKEND_NONE;
 	destroy_q(&g_work_q);
@@ -1130,7 +1909,20 @@ status()
 	PX4_INFO("Writes   %u", g_func_counts[dm_write_func]);
 	PX4_INFO("Reads    %u", g_func_counts[dm_read_func]);
 	PX4_INFO("Clears   %u", g_func_counts[dm_clear_func]);
+	PX4_INFO("Flushes  %u", g_func_counts[dm_flush_func]);
 	PX4_INFO("Max Q lengths work %u, free %u", g_work_q.max_size, g_free_q.max_size);
+
+	if (g_wp_cache.enabled) {
+		unsigned dirty = 0;
+		px4_sem_wait(&g_wp_cache.mutex);
+
+		for (bool d : g_wp_cache.dirty) {
+			dirty += d ? 1 : 0;
+		}
+
+		px4_sem_post(&g_wp_cache.mutex);
+		PX4_INFO("WP cache %u slots per item type, %u dirty", k_wp_cache_slots, dirty);
+	}
 	perf_print_counter(_dm_read_perf);
 	perf_print_counter(_dm_write_perf);
 }
@@ -1153,6 +1945,7 @@ Module to provide persistent storage for the rest of the system in form of a sim
 Multiple backends are supported:
 - a file (eg. on the SD card)
 - RAM (this is obviously not persistent)
+- a memory-mapped file (POSIX only: persistent, with reads and writes at RAM speed)
 
 It is used to store structured data of different types: mission waypoints, mission state and geofence polygons.
 Each type has a specific type and a fixed maximum amount of storage items, so that fast random access is possible.
@@ -1161,6 +1954,15 @@ Each type has a specific type and a fixed maximum amount of storage items, so th
 Reading and writing a single item is always atomic. If multiple items need to be read/modified atomically, there is
 an additional lock per item type via `dm_lock`.
 
+With the file backend the leading mission waypoint items are mirrored in a RAM write-behind cache: reads are served
+from memory and writes return once the mirror is updated, the worker thread flushes them to the file in the
+background. `dm_read_async`/`dm_write_async` provide a non-blocking request/completion interface for the other item
+types.
+
+The memory-mapped backend serves all reads and writes directly from the mapping in the caller's context and the worker
+thread msyncs the modified pages in the background. Each item stores a CRC of its payload, so an item torn by a power
+loss before the write-back completed is detected and reported as lost on the next read.
+
 **DM_KEY_FENCE_POINTS** and **DM_KEY_SAFE_POINTS** items: the first data element is a `mission_stats_entry_s` struct,
 which stores the number of items for these types. These items are always updated atomically in one transaction (from
 the mavlink mission manager). During that time, navigator will try to acquire the geofence item lock, fail, and will not
@@ -1171,15 +1973,16 @@ check for geofence violations.
 	PRINT_MODULE_USAGE_NAME("dataman", "system");
 	PRINT_MODULE_USAGE_COMMAND("start");
 	PRINT_MODULE_USAGE_PARAM_STRING('f', nullptr, "<file>", "Storage file", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('m', nullptr, "<file>", "Storage file, memory mapped (POSIX only)", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('r', "Use RAM backend (NOT persistent)", true);
-	PRINT_MODULE_USAGE_PARAM_COMMENT("The options -f and -r are mutually exclusive. If nothing is specified, a file 'dataman' is used");
+	PRINT_MODULE_USAGE_PARAM_COMMENT("The options -f, -m and -r are mutually exclusive. If nothing is specified, a file 'dataman' is used");
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
 }
 
 static int backend_check()
 {
 	if (backend != BACKEND_NONE) {
-		PX4_WARN("-f and -r are mutually exclusive");
+		PX4_WARN("-f, -m and -r are mutually exclusive");
 		usage();
 		return -1;
 	}
@@ -1208,7 +2011,7 @@ dataman_main(int argc, char *argv[])
 
 		/* jump over start and look at options first */
 
-		while ((ch = px4_getopt(argc, argv, "f:r", &dmoptind, &dmoptarg)) != EOF) {
+		while ((ch = px4_getopt(argc, argv, "f:m:r", &dmoptind, &dmoptarg)) != EOF) {
 			switch (ch) {
 			case 'f':
 				if (backend_check()) {
@@ -1220,6 +2023,21 @@ dataman_main(int argc, char *argv[])
 				PX4_INFO("dataman file set to: %s", k_data_manager_device_path);
 				break;
 
+			case 'm':
+				if (backend_check()) {
+					return -1;
+				}
+
+#if defined(__PX4_POSIX)
+				backend = BACKEND_MMAP;
+				k_data_manager_device_path = strdup(dmoptarg);
+				PX4_INFO("dataman mapped file set to: %s", k_data_manager_device_path);
+				break;
+#else
+				PX4_ERR("the memory mapped backend is only available on POSIX");
+				return -1;
+#endif
+
 			case 'r':
 				if (backend_check()) {
 					return -1;
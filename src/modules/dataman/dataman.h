@@ -108,6 +108,42 @@ dm_write(
 	size_t buflen			/* Length in bytes of data to retrieve */
 );
 
+/** Completion callback of the asynchronous API. Invoked on the dataman worker
+ *  thread (or in the caller's context when a request completes immediately),
+ *  so it must not block. result is what the synchronous call would return. */
+typedef void (*dm_callback_t)(ssize_t result, void *arg);
+
+/**
+ * Retrieve from the data manager store without waiting for the worker thread.
+ * The buffer must stay valid until the callback reports completion.
+ * @return 0 if the request was queued or completed, -1 on error (callback not invoked)
+ */
+__EXPORT int
+dm_read_async(
+	dm_item_t item,			/* The item type to retrieve */
+	unsigned index,			/* The index of the item */
+	void *buffer,			/* Pointer to caller data buffer */
+	size_t buflen,			/* Length in bytes of data to retrieve */
+	dm_callback_t callback,		/* Completion callback, may be NULL (fire and forget) */
+	void *arg			/* Opaque argument passed to the callback */
+);
+
+/**
+ * Write to the data manager store without waiting for the worker thread.
+ * The data is copied into the request, so the caller's buffer can be reused
+ * as soon as this call returns.
+ * @return 0 if the request was queued or completed, -1 on error (callback not invoked)
+ */
+__EXPORT int
+dm_write_async(
+	dm_item_t  item,		/* The item type to store */
+	unsigned index,			/* The index of the item */
+	const void *buffer,		/* Pointer to caller data buffer */
+	size_t buflen,			/* Length in bytes of data to store */
+	dm_callback_t callback,		/* Completion callback, may be NULL (fire and forget) */
+	void *arg			/* Opaque argument passed to the callback */
+);
+
 /**
  * Lock all items of a type. Can be used for atomic updates of multiple items (single items are always updated
  * atomically).
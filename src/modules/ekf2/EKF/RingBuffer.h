@@ -40,14 +40,77 @@
 #include <inttypes.h>
 #include <cstdio>
 #include <cstring>
+#include <new>
+
+// One contiguous block of memory shared by the ring buffers of an estimator
+// instance. All storage is carved from a single up-front allocation so that
+// buffer creation cannot fragment the heap and allocation failure is a single
+// check at initialisation time.
+class BufferArena
+{
+public:
+	BufferArena() = default;
+	~BufferArena() { delete[] _memory; }
+
+	// no copy, assignment, move, move assignment
+	BufferArena(const BufferArena &) = delete;
+	BufferArena &operator=(const BufferArena &) = delete;
+	BufferArena(BufferArena &&) = delete;
+	BufferArena &operator=(BufferArena &&) = delete;
+
+	// reserve the backing memory, the capacity can only change while no buffer is using it
+	bool reserve(size_t capacity)
+	{
+		if (_used != 0) {
+			return (capacity <= _capacity);
+		}
+
+		if (capacity != _capacity) {
+			delete[] _memory;
+			_memory = new uint8_t[capacity];
+			_capacity = (_memory != nullptr) ? capacity : 0;
+		}
+
+		return (_memory != nullptr);
+	}
+
+	// returns nullptr when the arena is not reserved or exhausted
+	void *allocate(size_t bytes)
+	{
+		const size_t aligned = align_up(bytes);
+
+		if ((_memory == nullptr) || ((_used + aligned) > _capacity)) {
+			return nullptr;
+		}
+
+		void *mem = _memory + _used;
+		_used += aligned;
+		return mem;
+	}
+
+	static constexpr size_t align_up(size_t bytes) { return (bytes + 7u) & ~static_cast<size_t>(7); }
+
+	size_t capacity() const { return _capacity; }
+	size_t used() const { return _used; }
+
+private:
+	uint8_t *_memory{nullptr};
+	size_t _capacity{0};
+	size_t _used{0};
+};
 
 template <typename data_type>
 class RingBuffer
 {
 public:
-	explicit RingBuffer(size_t size) { allocate(size); }
+	explicit RingBuffer(size_t size, BufferArena *arena = nullptr) { allocate(size, arena); }
 	RingBuffer() = delete;
-	~RingBuffer() { delete[] _buffer; }
+	~RingBuffer()
+	{
+		if (_owns_buffer) {
+			delete[] _buffer;
+		}
+	}
 
 	// no copy, assignment, move, move assignment
 	RingBuffer(const RingBuffer &) = delete;
@@ -55,7 +118,10 @@ public:
 	RingBuffer(RingBuffer &&) = delete;
 	RingBuffer &operator=(RingBuffer &&) = delete;
 
-	bool allocate(uint8_t size)
+	// arena storage required for a buffer of the given length
+	static constexpr size_t storage_bytes(uint8_t size) { return BufferArena::align_up(sizeof(data_type) * size); }
+
+	bool allocate(uint8_t size, BufferArena *arena = nullptr)
 	{
 		if (valid() && (size == _size)) {
 			// no change
@@ -66,11 +132,32 @@ public:
 			return false;
 		}
 
-		if (_buffer != nullptr) {
+		if ((_buffer != nullptr) && _owns_buffer) {
 			delete[] _buffer;
 		}
 
-		_buffer = new data_type[size] {};
+		_buffer = nullptr;
+
+		if (arena != nullptr) {
+			void *mem = arena->allocate(sizeof(data_type) * size);
+
+			if (mem != nullptr) {
+				// the arena owns the memory, the sample types are trivially destructible
+				_buffer = static_cast<data_type *>(mem);
+
+				for (uint8_t i = 0; i < size; i++) {
+					new (&_buffer[i]) data_type{};
+				}
+
+				_owns_buffer = false;
+			}
+		}
+
+		if (_buffer == nullptr) {
+			// no arena provided or it is exhausted, fall back to the heap
+			_buffer = new data_type[size] {};
+			_owns_buffer = true;
+		}
 
 		if (_buffer == nullptr) {
 			return false;
@@ -176,4 +263,5 @@ private:
 	uint8_t _size{0};
 
 	bool _first_write{true};
+	bool _owns_buffer{true};
 };
@@ -495,7 +495,7 @@ void Ekf::predictCovariance()
 
 
 	// covariance update
-	SquareMatrix24f nextP;
+	alignas(16) SquareMatrix24f nextP;
 
 	// calculate variances and upper diagonal covariances for quaternion, velocity, position and gyro bias states
 
@@ -875,11 +875,16 @@ void Ekf::predictCovariance()
 
 	}
 
+	// the magnetic field and wind states are only predicted when active; the rows and
+	// columns of P for inactive states are held at zero by fixCovarianceErrors() so the
+	// copy back can be limited to the active leading block
+	const unsigned last_active_state = numActiveStates();
+
 	// stop position covariance growth if our total position variance reaches 100m
 	// this can happen if we lose gps for some time
 	if ((P(7, 7) + P(8, 8)) > 1e4f) {
 		for (uint8_t i = 7; i <= 8; i++) {
-			for (uint8_t j = 0; j < _k_num_states; j++) {
+			for (uint8_t j = 0; j < last_active_state; j++) {
 				nextP(i, j) = P(i, j);
 				nextP(j, i) = P(j, i);
 			}
@@ -887,14 +892,14 @@ void Ekf::predictCovariance()
 	}
 
 	// covariance matrix is symmetrical, so copy upper half to lower half
-	for (unsigned row = 1; row < _k_num_states; row++) {
+	for (unsigned row = 1; row < last_active_state; row++) {
 		for (unsigned column = 0 ; column < row; column++) {
 			P(row, column) = P(column, row) = nextP(column, row);
 		}
 	}
 
 	// copy variances (diagonals)
-	for (unsigned i = 0; i < _k_num_states; i++) {
+	for (unsigned i = 0; i < last_active_state; i++) {
 		P(i, i) = nextP(i, i);
 	}
 
@@ -125,28 +125,43 @@ bool Ekf::update()
 bool Ekf::initialiseFilter()
 {
 	// Filter accel for tilt initialization
-	const imuSample &imu_init = _imu_buffer.get_newest();
+	// batch replay the buffered IMU history instead of consuming one sample per update
+	// cycle, so initialisation after a reset completes as soon as the data allows
+	const uint8_t imu_len = _imu_buffer.get_length();
+	const uint8_t imu_oldest = _imu_buffer.get_oldest_index();
+
+	for (uint8_t i = 0; i < imu_len; i++) {
+		const imuSample &imu_init = _imu_buffer[(imu_oldest + i) % imu_len];
+
+		// skip samples already consumed and protect against zero data
+		if ((imu_init.time_us <= _init_last_imu_time_us)
+		    || (imu_init.delta_vel_dt < 1e-4f) || (imu_init.delta_ang_dt < 1e-4f)) {
+			continue;
+		}
 
-	// protect against zero data
-	if (imu_init.delta_vel_dt < 1e-4f || imu_init.delta_ang_dt < 1e-4f) {
-		return false;
+		if (_is_first_imu_sample) {
+			_accel_lpf.reset(imu_init.delta_vel / imu_init.delta_vel_dt);
+			_gyro_lpf.reset(imu_init.delta_ang / imu_init.delta_ang_dt);
+			_is_first_imu_sample = false;
+
+		} else {
+			_accel_lpf.update(imu_init.delta_vel / imu_init.delta_vel_dt);
+			_gyro_lpf.update(imu_init.delta_ang / imu_init.delta_ang_dt);
+		}
+
+		_init_last_imu_time_us = imu_init.time_us;
 	}
 
 	if (_is_first_imu_sample) {
-		_accel_lpf.reset(imu_init.delta_vel / imu_init.delta_vel_dt);
-		_gyro_lpf.reset(imu_init.delta_ang / imu_init.delta_ang_dt);
-		_is_first_imu_sample = false;
-
-	} else {
-		_accel_lpf.update(imu_init.delta_vel / imu_init.delta_vel_dt);
-		_gyro_lpf.update(imu_init.delta_ang / imu_init.delta_ang_dt);
+		// no usable IMU data yet
+		return false;
 	}
 
-	// Sum the magnetometer measurements
+	// Sum the magnetometer measurements, draining everything up to the fusion time horizon
 	if (_mag_buffer) {
 		magSample mag_sample;
 
-		if (_mag_buffer->pop_first_older_than(_imu_sample_delayed.time_us, &mag_sample)) {
+		while (_mag_buffer->pop_first_older_than(_imu_sample_delayed.time_us, &mag_sample)) {
 			if (mag_sample.time_us != 0) {
 				if (_mag_counter == 0) {
 					_mag_lpf.reset(mag_sample.mag);
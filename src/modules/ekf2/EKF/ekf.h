@@ -524,7 +524,9 @@ private:
 	bool _synthetic_mag_z_active{false};	///< true if we are generating synthetic magnetometer Z measurements
 	bool _is_yaw_fusion_inhibited{false};		///< true when yaw sensor use is being inhibited
 
-	SquareMatrix24f P{};	///< state covariance matrix
+	// 16-byte alignment keeps every 24-float row vector-load aligned for the
+	// vectorized covariance prediction build (see EKF2_VECTORIZED_COVARIANCE)
+	alignas(16) SquareMatrix24f P{};	///< state covariance matrix
 
 	Vector3f _delta_vel_bias_var_accum{};		///< kahan summation algorithm accumulator for delta velocity bias variance
 	Vector3f _delta_angle_bias_var_accum{};	///< kahan summation algorithm accumulator for delta angle bias variance
@@ -603,6 +605,7 @@ private:
 
 	// Variables used by the initial filter alignment
 	bool _is_first_imu_sample{true};
+	uint64_t _init_last_imu_time_us{0};	///< newest buffered IMU sample already consumed by the initialisation batch replay (uSec)
 	uint32_t _baro_counter{0};		///< number of baro samples read during initialisation
 	uint32_t _mag_counter{0};		///< number of magnetometer samples read during initialisation
 	AlphaFilter<Vector3f> _accel_lpf{0.1f};	///< filtered accelerometer measurement used to align tilt (m/s/s)
@@ -1044,6 +1047,14 @@ private:
 
 	void resetZDeltaAngBiasCov();
 
+	// number of leading covariance states currently being estimated; rows and columns of P
+	// beyond this are held at zero by fixCovarianceErrors() while the magnetic field and
+	// wind states are inactive, so the prediction and fusion loops can skip them
+	uint8_t numActiveStates() const
+	{
+		return _control_status.flags.wind ? 24 : (_control_status.flags.mag_3D ? 22 : 16);
+	}
+
 	// uncorrelate quaternion states from other states
 	void uncorrelateQuatFromOtherStates();
 
@@ -99,7 +99,7 @@ void EstimatorInterface::setMagData(const magSample &mag_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_mag_buffer == nullptr) {
-		_mag_buffer = new RingBuffer<magSample>(_obs_buffer_length);
+		_mag_buffer = new RingBuffer<magSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_mag_buffer == nullptr || !_mag_buffer->valid()) {
 			delete _mag_buffer;
@@ -135,7 +135,7 @@ void EstimatorInterface::setGpsData(const gpsMessage &gps)
 
 	// Allocate the required buffer size if not previously done
 	if (_gps_buffer == nullptr) {
-		_gps_buffer = new RingBuffer<gpsSample>(_obs_buffer_length);
+		_gps_buffer = new RingBuffer<gpsSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_gps_buffer == nullptr || !_gps_buffer->valid()) {
 			delete _gps_buffer;
@@ -202,7 +202,7 @@ void EstimatorInterface::setBaroData(const baroSample &baro_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_baro_buffer == nullptr) {
-		_baro_buffer = new RingBuffer<baroSample>(_obs_buffer_length);
+		_baro_buffer = new RingBuffer<baroSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_baro_buffer == nullptr || !_baro_buffer->valid()) {
 			delete _baro_buffer;
@@ -239,7 +239,7 @@ void EstimatorInterface::setAirspeedData(const airspeedSample &airspeed_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_airspeed_buffer == nullptr) {
-		_airspeed_buffer = new RingBuffer<airspeedSample>(_obs_buffer_length);
+		_airspeed_buffer = new RingBuffer<airspeedSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_airspeed_buffer == nullptr || !_airspeed_buffer->valid()) {
 			delete _airspeed_buffer;
@@ -274,7 +274,7 @@ void EstimatorInterface::setRangeData(const rangeSample &range_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_range_buffer == nullptr) {
-		_range_buffer = new RingBuffer<rangeSample>(_obs_buffer_length);
+		_range_buffer = new RingBuffer<rangeSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_range_buffer == nullptr || !_range_buffer->valid()) {
 			delete _range_buffer;
@@ -310,7 +310,7 @@ void EstimatorInterface::setOpticalFlowData(const flowSample &flow)
 
 	// Allocate the required buffer size if not previously done
 	if (_flow_buffer == nullptr) {
-		_flow_buffer = new RingBuffer<flowSample>(_imu_buffer_length);
+		_flow_buffer = new RingBuffer<flowSample>(_imu_buffer_length, &_buffer_arena);
 
 		if (_flow_buffer == nullptr || !_flow_buffer->valid()) {
 			delete _flow_buffer;
@@ -346,7 +346,7 @@ void EstimatorInterface::setExtVisionData(const extVisionSample &evdata)
 
 	// Allocate the required buffer size if not previously done
 	if (_ext_vision_buffer == nullptr) {
-		_ext_vision_buffer = new RingBuffer<extVisionSample>(_obs_buffer_length);
+		_ext_vision_buffer = new RingBuffer<extVisionSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_ext_vision_buffer == nullptr || !_ext_vision_buffer->valid()) {
 			delete _ext_vision_buffer;
@@ -383,7 +383,7 @@ void EstimatorInterface::setAuxVelData(const auxVelSample &auxvel_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_auxvel_buffer == nullptr) {
-		_auxvel_buffer = new RingBuffer<auxVelSample>(_obs_buffer_length);
+		_auxvel_buffer = new RingBuffer<auxVelSample>(_obs_buffer_length, &_buffer_arena);
 
 		if (_auxvel_buffer == nullptr || !_auxvel_buffer->valid()) {
 			delete _auxvel_buffer;
@@ -418,7 +418,7 @@ void EstimatorInterface::setDragData(const imuSample &imu)
 
 		// Allocate the required buffer size if not previously done
 		if (_drag_buffer == nullptr) {
-			_drag_buffer = new RingBuffer<dragSample>(_obs_buffer_length);
+			_drag_buffer = new RingBuffer<dragSample>(_obs_buffer_length, &_buffer_arena);
 
 			if (_drag_buffer == nullptr || !_drag_buffer->valid()) {
 				delete _drag_buffer;
@@ -516,6 +516,41 @@ bool EstimatorInterface::initialise_interface(uint64_t timestamp)
 
 	ECL_DEBUG("EKF max time delay %.1f ms, OBS length %d\n", (double)ekf_delay_ms, _obs_buffer_length);
 
+	// reserve one contiguous block for the observation buffers of the configured
+	// sensor set so that bring-up performs a single allocation per instance and the
+	// delayed-horizon replay walks adjacent storage. A sensor appearing later that
+	// was not accounted for here falls back to the heap.
+	size_t arena_capacity = RingBuffer<magSample>::storage_bytes(_obs_buffer_length)
+				+ RingBuffer<gpsSample>::storage_bytes(_obs_buffer_length)
+				+ RingBuffer<baroSample>::storage_bytes(_obs_buffer_length)
+				+ RingBuffer<auxVelSample>::storage_bytes(_obs_buffer_length);
+
+	if (_params.arsp_thr > FLT_EPSILON) {
+		arena_capacity += RingBuffer<airspeedSample>::storage_bytes(_obs_buffer_length);
+	}
+
+	if (_params.rng_ctrl != RngCtrl::DISABLED) {
+		arena_capacity += RingBuffer<rangeSample>::storage_bytes(_obs_buffer_length);
+	}
+
+	if (_params.fusion_mode & SensorFusionMask::USE_OPT_FLOW) {
+		arena_capacity += RingBuffer<flowSample>::storage_bytes(_imu_buffer_length);
+	}
+
+	if (_params.fusion_mode & (SensorFusionMask::USE_EXT_VIS_POS | SensorFusionMask::USE_EXT_VIS_YAW |
+				   SensorFusionMask::USE_EXT_VIS_VEL)) {
+		arena_capacity += RingBuffer<extVisionSample>::storage_bytes(_obs_buffer_length);
+	}
+
+	if (_params.fusion_mode & SensorFusionMask::USE_DRAG) {
+		arena_capacity += RingBuffer<dragSample>::storage_bytes(_obs_buffer_length);
+	}
+
+	if (!_buffer_arena.reserve(arena_capacity)) {
+		printBufferAllocationFailed("buffer arena");
+		return false;
+	}
+
 	if (!_imu_buffer.allocate(_imu_buffer_length) || !_output_buffer.allocate(_imu_buffer_length)
 	    || !_output_vert_buffer.allocate(_imu_buffer_length)) {
 
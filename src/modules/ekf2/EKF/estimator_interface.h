@@ -69,6 +69,7 @@
 #include "utils.hpp"
 
 #include <lib/geo/geo.h>
+#include <lib/world_magnetic_model/geo_mag_declination.h>
 #include <matrix/math.hpp>
 #include <mathlib/mathlib.h>
 #include <mathlib/math/filter/AlphaFilter.hpp>
@@ -365,6 +366,10 @@ protected:
 	RingBuffer<outputSample> _output_buffer{12};
 	RingBuffer<outputVert> _output_vert_buffer{12};
 
+	// contiguous storage shared by the observation buffers below, reserved up-front
+	// for the configured sensor set in initialise_interface()
+	BufferArena _buffer_arena{};
+
 	RingBuffer<gpsSample> *_gps_buffer{nullptr};
 	RingBuffer<magSample> *_mag_buffer{nullptr};
 	RingBuffer<baroSample> *_baro_buffer{nullptr};
@@ -393,6 +398,8 @@ protected:
 	float _mag_inclination_gps{NAN};	  // magnetic inclination returned by the geo library using the last valid GPS position (rad)
 	float _mag_strength_gps{NAN};	          // magnetic strength returned by the geo library using the last valid GPS position (T)
 
+	GeoMagCellCache _wmm_cache{};		  // cached world magnetic model grid cell for the lookups above
+
 	// this is the current status of the filter control modes
 	filter_control_status_u _control_status{};
 
@@ -103,6 +103,39 @@ bool Ekf::fuseMag(const Vector3f &mag, estimator_aid_source_3d_s &aid_src_mag, b
 
 	const float HKX24 = 1.0F/aid_src_mag.innovation_variance[0];
 
+	// rotate magnetometer earth field state into body frame
+	const Dcmf R_to_body = quatToInverseRotMat(_state.quat_nominal);
+	const Vector3f mag_I_rot = R_to_body * _state.mag_I;
+
+	// compute magnetometer innovations
+	const Vector3f mag_observation = mag - _state.mag_B;
+	Vector3f mag_innov = mag_I_rot - mag_observation;
+
+	// do not use the synthesized measurement for the magnetomter Z component for 3D fusion
+	if (_control_status.flags.synthetic_mag_z) {
+		mag_innov(2) = 0.0f;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		aid_src_mag.observation[i] = mag_observation(i);
+		aid_src_mag.observation_variance[i] = R_MAG;
+		aid_src_mag.innovation[i] = mag_innov(i);
+		aid_src_mag.fusion_enabled[i] = _control_status.flags.mag_3D && update_all_states;
+	}
+
+	const float innov_gate = math::max(_params.mag_innov_gate, 1.f);
+
+	// check the X axis innovation gate first: a rejected axis aborts the fusion of all
+	// three axes, so there is no need to evaluate the more expensive Y and Z axis
+	// innovation variance terms for a sample that is going to be rejected anyway
+	aid_src_mag.test_ratio[0] = sq(aid_src_mag.innovation[0]) / (sq(innov_gate) * aid_src_mag.innovation_variance[0]);
+	aid_src_mag.innovation_rejected[0] = !PX4_ISFINITE(aid_src_mag.test_ratio[0]) || (aid_src_mag.test_ratio[0] > 1.f);
+
+	if (aid_src_mag.innovation_rejected[0]) {
+		_innov_check_fail_status.flags.reject_mag_x = true;
+		return false;
+	}
+
 	// intermediate variables for calculation of innovations variances for Y and Z axes
 	// don't calculate all terms needed for observation jacobians and Kalman gains because
 	// these will have to be recalculated when the X and Y axes are fused
@@ -154,35 +187,13 @@ bool Ekf::fuseMag(const Vector3f &mag, estimator_aid_source_3d_s &aid_src_mag, b
 
 	_fault_status.flags.bad_mag_z = false;
 
-	// rotate magnetometer earth field state into body frame
-	const Dcmf R_to_body = quatToInverseRotMat(_state.quat_nominal);
-	const Vector3f mag_I_rot = R_to_body * _state.mag_I;
-
-	// compute magnetometer innovations
-	const Vector3f mag_observation = mag - _state.mag_B;
-	Vector3f mag_innov = mag_I_rot - mag_observation;
-
-	// do not use the synthesized measurement for the magnetomter Z component for 3D fusion
-	if (_control_status.flags.synthetic_mag_z) {
-		mag_innov(2) = 0.0f;
-	}
-
-	for (int i = 0; i < 3; i++) {
-		aid_src_mag.observation[i] = mag_observation(i);
-		aid_src_mag.observation_variance[i] = R_MAG;
-		aid_src_mag.innovation[i] = mag_innov(i);
-		aid_src_mag.fusion_enabled[i] = _control_status.flags.mag_3D && update_all_states;
-	}
+	setEstimatorAidStatusTestRatio(aid_src_mag, innov_gate);
 
 	// do not use the synthesized measurement for the magnetomter Z component for 3D fusion
 	if (_control_status.flags.synthetic_mag_z) {
-		aid_src_mag.innovation[2] = 0.0f;
 		aid_src_mag.innovation_rejected[2] = false;
 	}
 
-	const float innov_gate = math::max(_params.mag_innov_gate, 1.f);
-	setEstimatorAidStatusTestRatio(aid_src_mag, innov_gate);
-
 	// Perform an innovation consistency check and report the result
 	_innov_check_fail_status.flags.reject_mag_x = aid_src_mag.innovation_rejected[0];
 	_innov_check_fail_status.flags.reject_mag_y = aid_src_mag.innovation_rejected[1];
@@ -643,14 +654,18 @@ bool Ekf::fuseYaw(const float innovation, const float variance, estimator_aid_so
 	SquareMatrix24f KHP;
 	float KH[4];
 
-	for (unsigned row = 0; row < _k_num_states; row++) {
+	// rows and columns of P for inactive states are zero so the covariance correction
+	// only needs to be computed for the active leading block
+	const unsigned n_states = numActiveStates();
+
+	for (unsigned row = 0; row < n_states; row++) {
 
 		KH[0] = Kfusion(row) * H_YAW(0);
 		KH[1] = Kfusion(row) * H_YAW(1);
 		KH[2] = Kfusion(row) * H_YAW(2);
 		KH[3] = Kfusion(row) * H_YAW(3);
 
-		for (unsigned column = 0; column < _k_num_states; column++) {
+		for (unsigned column = 0; column < n_states; column++) {
 			float tmp = KH[0] * P(0, column);
 			tmp += KH[1] * P(1, column);
 			tmp += KH[2] * P(2, column);
@@ -261,15 +261,19 @@ bool Ekf::fuseVelPosHeight(const float innov, const float innov_var, const int o
 	Vector24f Kfusion;  // Kalman gain vector for any single observation - sequential fusion is used.
 	const unsigned state_index = obs_index + 4;  // we start with vx and this is the 4. state
 
+	// rows and columns of P for inactive states are zero so the gain and covariance
+	// correction only need to be computed for the active leading block
+	const unsigned n_states = numActiveStates();
+
 	// calculate kalman gain K = PHS, where S = 1/innovation variance
-	for (int row = 0; row < _k_num_states; row++) {
+	for (unsigned row = 0; row < n_states; row++) {
 		Kfusion(row) = P(row, state_index) / innov_var;
 	}
 
 	SquareMatrix24f KHP;
 
-	for (unsigned row = 0; row < _k_num_states; row++) {
-		for (unsigned column = 0; column < _k_num_states; column++) {
+	for (unsigned row = 0; row < n_states; row++) {
+		for (unsigned column = 0; column < n_states; column++) {
 			KHP(row, column) = Kfusion(row) * P(state_index, column);
 		}
 	}
@@ -2283,7 +2283,9 @@ int EKF2::task_spawn(int argc, char *argv[])
 					if ((vehicle_mag_sub.advertised() || mag == 0) && (vehicle_imu_sub.advertised())) {
 
 						if (!ekf2_instance_created[imu][mag]) {
-							EKF2 *ekf2_inst = new EKF2(true, px4::ins_instance_to_wq(imu), false);
+							// spread the instances round-robin across the INS queues so they
+							// execute in parallel instead of serializing on a shared queue
+							EKF2 *ekf2_inst = new EKF2(true, px4::ins_instance_to_wq(multi_instances_allocated), false);
 
 							if (ekf2_inst && ekf2_inst->multi_init(imu, mag)) {
 								int actual_instance = ekf2_inst->instance(); // match uORB instance numbering
@@ -43,6 +43,8 @@ EKF2Selector::EKF2Selector() :
 	ModuleParams(nullptr),
 	ScheduledWorkItem("ekf2_selector", px4::wq_configurations::nav_and_controllers)
 {
+	updateParams();
+
 	_estimator_selector_status_pub.advertise();
 	_sensor_selection_pub.advertise();
 	_vehicle_attitude_pub.advertise();
@@ -67,6 +69,19 @@ void EKF2Selector::Stop()
 	ScheduleClear();
 }
 
+void EKF2Selector::updateParams()
+{
+	ModuleParams::updateParams();
+
+	// cache the parameter derived thresholds so the per-sample error accumulation
+	// doesn't redo the unit conversions on every scoring pass
+	_imu_angle_rate_threshold = radians(_param_ekf2_sel_imu_angle_rate.get());
+	_imu_angle_threshold = radians(_param_ekf2_sel_imu_angle.get());
+	_imu_accel_threshold = _param_ekf2_sel_imu_accel.get();
+	_imu_velocity_threshold = _param_ekf2_sel_imu_velocity.get();
+	_error_reduction_threshold = fmaxf(_param_ekf2_sel_err_red.get(), 0.05f);
+}
+
 void EKF2Selector::PrintInstanceChange(const uint8_t old_instance, uint8_t new_instance)
 {
 	const char *old_reason = nullptr;
@@ -118,9 +133,9 @@ bool EKF2Selector::SelectInstance(uint8_t ekf_instance)
 		_sensor_selection_pub.publish(sensor_selection);
 
 		if (_selected_instance != INVALID_INSTANCE) {
-			// switch callback registration
+			// switch attitude callback registration (status callbacks stay registered for
+			// every available instance)
 			_instance[_selected_instance].estimator_attitude_sub.unregisterCallback();
-			_instance[_selected_instance].estimator_status_sub.unregisterCallback();
 
 			PrintInstanceChange(_selected_instance, ekf_instance);
 		}
@@ -161,8 +176,6 @@ bool EKF2Selector::UpdateErrorScores()
 			_last_update_us = sensors_status_imu.timestamp;
 
 			{
-				const float angle_rate_threshold = radians(_param_ekf2_sel_imu_angle_rate.get());
-				const float angle_threshold = radians(_param_ekf2_sel_imu_angle.get());
 				uint8_t n_gyros = 0;
 				uint8_t n_gyro_exceedances = 0;
 				float largest_accumulated_gyro_error = 0.0f;
@@ -172,10 +185,11 @@ bool EKF2Selector::UpdateErrorScores()
 					// check for gyros with excessive difference to mean using accumulated error
 					if (sensors_status_imu.gyro_device_ids[i] != 0) {
 						n_gyros++;
-						_accumulated_gyro_error[i] += (sensors_status_imu.gyro_inconsistency_rad_s[i] - angle_rate_threshold) * time_step_s;
+						_accumulated_gyro_error[i] += (sensors_status_imu.gyro_inconsistency_rad_s[i] - _imu_angle_rate_threshold) *
+									      time_step_s;
 						_accumulated_gyro_error[i] = fmaxf(_accumulated_gyro_error[i], 0.f);
 
-						if (_accumulated_gyro_error[i] > angle_threshold) {
+						if (_accumulated_gyro_error[i] > _imu_angle_threshold) {
 							n_gyro_exceedances++;
 						}
 
@@ -204,8 +218,6 @@ bool EKF2Selector::UpdateErrorScores()
 			}
 
 			{
-				const float accel_threshold = _param_ekf2_sel_imu_accel.get();
-				const float velocity_threshold = _param_ekf2_sel_imu_velocity.get();
 				uint8_t n_accels = 0;
 				uint8_t n_accel_exceedances = 0;
 				float largest_accumulated_accel_error = 0.0f;
@@ -215,10 +227,11 @@ bool EKF2Selector::UpdateErrorScores()
 					// check for accelerometers with excessive difference to mean using accumulated error
 					if (sensors_status_imu.accel_device_ids[i] != 0) {
 						n_accels++;
-						_accumulated_accel_error[i] += (sensors_status_imu.accel_inconsistency_m_s_s[i] - accel_threshold) * time_step_s;
+						_accumulated_accel_error[i] += (sensors_status_imu.accel_inconsistency_m_s_s[i] - _imu_accel_threshold) *
+									       time_step_s;
 						_accumulated_accel_error[i] = fmaxf(_accumulated_accel_error[i], 0.f);
 
-						if (_accumulated_accel_error[i] > velocity_threshold) {
+						if (_accumulated_accel_error[i] > _imu_velocity_threshold) {
 							n_accel_exceedances++;
 						}
 
@@ -257,6 +270,7 @@ bool EKF2Selector::UpdateErrorScores()
 	// calculate individual error scores
 	for (uint8_t i = 0; i < EKF2_MAX_INSTANCES; i++) {
 		const bool prev_healthy = _instance[i].healthy.get_state();
+		const bool prev_warning = _instance[i].warning;
 
 		estimator_status_s status;
 
@@ -272,6 +286,10 @@ bool EKF2Selector::UpdateErrorScores()
 			if ((i + 1) > _available_instances) {
 				_available_instances = i + 1;
 				updated = true;
+
+				// register for status updates from every discovered instance so a health or
+				// test ratio change on a non-primary wakes the selector immediately
+				_instance[i].estimator_status_sub.registerCallback();
 			}
 
 			if (i == _selected_instance) {
@@ -333,6 +351,11 @@ bool EKF2Selector::UpdateErrorScores()
 				_instance[i].healthy_count++;
 			}
 		}
+
+		if (prev_warning != _instance[i].warning) {
+			updated = true;
+			_selector_status_publish = true;
+		}
 	}
 
 	// update relative test ratios if primary has updated
@@ -343,12 +366,19 @@ bool EKF2Selector::UpdateErrorScores()
 				const float error_delta = _instance[i].combined_test_ratio - _instance[_selected_instance].combined_test_ratio;
 
 				// reduce error only if its better than the primary instance by at least EKF2_SEL_ERR_RED to prevent unnecessary selection changes
-				const float threshold = _gyro_fault_detected ? 0.0f : fmaxf(_param_ekf2_sel_err_red.get(), 0.05f);
+				const float threshold = _gyro_fault_detected ? 0.0f : _error_reduction_threshold;
 
 				if (error_delta > 0 || error_delta < -threshold) {
+					const float relative_test_ratio_prev = _instance[i].relative_test_ratio;
+
 					_instance[i].relative_test_ratio += error_delta;
 					_instance[i].relative_test_ratio = constrain(_instance[i].relative_test_ratio, -_rel_err_score_lim, _rel_err_score_lim);
 
+					// an instance crossing the switching threshold is a selection event
+					if ((relative_test_ratio_prev > -_rel_err_thresh) && (_instance[i].relative_test_ratio <= -_rel_err_thresh)) {
+						updated = true;
+					}
+
 					if ((error_delta < -threshold) && (_instance[i].relative_test_ratio < 1.f)) {
 						// increase status publication rate if there's movement towards a potential instance change
 						_selector_status_publish = true;
@@ -358,7 +388,11 @@ bool EKF2Selector::UpdateErrorScores()
 		}
 	}
 
-	return (primary_updated || updated);
+	// only report a change when relative health actually moved (new instance, health or
+	// warning transition, switching threshold crossing) - routine primary updates no
+	// longer trigger the full selection scan, the periodic audit sweep covers the
+	// time-gated switching conditions
+	return updated;
 }
 
 void EKF2Selector::PublishVehicleAttitude()
@@ -684,8 +718,50 @@ void EKF2Selector::Run()
 		updateParams();
 	}
 
-	// update combined test ratio for all estimators
-	const bool updated = UpdateErrorScores();
+	// barrier: the instances run in parallel on separate INS queues and publish at
+	// slightly different times. When woken by a fresh primary output give the other
+	// healthy instances one short deferral to publish so the error scores compare
+	// outputs computed from the same sensor update.
+	if (!_sync_deferred && (_available_instances > 1) && (_selected_instance != INVALID_INSTANCE)
+	    && _instance[_selected_instance].estimator_status_sub.updated()) {
+
+		for (int i = 0; i < _available_instances; i++) {
+			if ((i != _selected_instance) && _instance[i].healthy.get_state() && !_instance[i].timeout
+			    && !_instance[i].estimator_status_sub.updated()) {
+
+				_sync_deferred = true;
+				ScheduleDelayed(1_ms);
+				return;
+			}
+		}
+	}
+
+	_sync_deferred = false;
+
+	// scoring is event driven: skip the per-instance pass entirely unless new
+	// estimator_status or IMU consistency data is pending, with a slow periodic audit
+	// sweep catching instances that stopped publishing and re-checking the time-gated
+	// switching conditions
+	const bool audit_elapsed = (hrt_elapsed_time(&_last_error_scores_audit) >= ERROR_SCORES_AUDIT_INTERVAL)
+				   || (_selected_instance == INVALID_INSTANCE)
+				   || (_request_instance.load() != INVALID_INSTANCE);
+
+	bool scoring_required = audit_elapsed || _sensors_status_imu.updated();
+
+	for (int i = 0; (i < EKF2_MAX_INSTANCES) && !scoring_required; i++) {
+		scoring_required = _instance[i].estimator_status_sub.updated();
+	}
+
+	bool updated = false;
+
+	if (scoring_required) {
+		// update combined test ratio for all estimators
+		updated = UpdateErrorScores() || audit_elapsed;
+
+		if (audit_elapsed) {
+			_last_error_scores_audit = hrt_absolute_time();
+		}
+	}
 
 	// if no valid instance then force select first instance with valid IMU
 	if (_selected_instance == INVALID_INSTANCE) {
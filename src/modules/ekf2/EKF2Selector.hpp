@@ -80,8 +80,14 @@ private:
 	static constexpr uint8_t INVALID_INSTANCE{UINT8_MAX};
 	static constexpr uint64_t FILTER_UPDATE_PERIOD{10_ms};
 
+	// slow audit sweep interval: catches instances that stopped publishing and
+	// re-evaluates the time-gated switching conditions when no status event fires
+	static constexpr uint64_t ERROR_SCORES_AUDIT_INTERVAL{100_ms};
+
 	void Run() override;
 
+	void updateParams() override;
+
 	void PrintInstanceChange(const uint8_t old_instance, uint8_t new_instance);
 
 	void PublishEstimatorSelectorStatus();
@@ -108,6 +114,10 @@ private:
 			estimator_wind_sub{ORB_ID(estimator_wind), i},
 			instance(i)
 		{
+			// coalesce wakeups: one estimator output burst should trigger a single selector run
+			estimator_attitude_sub.set_coalesced(true);
+			estimator_status_sub.set_coalesced(true);
+
 			healthy.set_hysteresis_time_from(false, 1_s);
 		}
 
@@ -189,6 +199,15 @@ private:
 
 	hrt_abstime _last_status_publish{0};
 	bool _selector_status_publish{false};
+	bool _sync_deferred{false};
+	hrt_abstime _last_error_scores_audit{0};
+
+	// parameter derived thresholds cached on parameter update (used every scoring pass)
+	float _imu_angle_rate_threshold{0.f};     ///< radians(EKF2_SEL_IMU_RAT)
+	float _imu_angle_threshold{0.f};          ///< radians(EKF2_SEL_IMU_ANG)
+	float _imu_accel_threshold{0.f};          ///< EKF2_SEL_IMU_ACC
+	float _imu_velocity_threshold{0.f};       ///< EKF2_SEL_IMU_VEL
+	float _error_reduction_threshold{0.05f};  ///< max(EKF2_SEL_ERR_RED, 0.05)
 
 	// vehicle_attitude: reset counters
 	vehicle_attitude_s _attitude_last{};
@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * EKF performance harness: replays the recorded sensor corpora used by the
+ * change_indication tests through a bare Ekf instance and reports the wall
+ * clock cost per filter update and the peak RSS.
+ *
+ * Build with `make ekf2_bench` in a test build directory, then:
+ *
+ *   ekf2_bench                      report only
+ *   ekf2_bench <baseline_file>      fail when a scenario regresses past its baseline
+ *   ekf2_bench --update <file>      write the current results (+25% margin) as baseline
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <sys/resource.h>
+
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+struct BenchResult {
+	std::string name;
+	float duration_s;
+	uint64_t wall_us;
+	uint64_t updates;
+
+	float us_per_update() const { return (updates > 0) ? (float)wall_us / updates : 0.f; }
+};
+
+static BenchResult runScenario(const char *name, const char *file, float duration_s)
+{
+	std::shared_ptr<Ekf> ekf{std::make_shared<Ekf>()};
+	SensorSimulator sensor_simulator(ekf);
+	EkfWrapper ekf_wrapper(ekf);
+
+	sensor_simulator.loadSensorDataFromFile(file);
+	sensor_simulator.startGps();
+	ekf_wrapper.enableGpsFusion();
+
+	const float filter_update_period_s = ekf->getParamHandle()->filter_update_interval_us * 1e-6f;
+
+	const auto start = std::chrono::steady_clock::now();
+	sensor_simulator.runReplaySeconds(duration_s);
+	const auto stop = std::chrono::steady_clock::now();
+
+	BenchResult result;
+	result.name = name;
+	result.duration_s = duration_s;
+	result.wall_us = std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count();
+	result.updates = (uint64_t)(duration_s / filter_update_period_s);
+	return result;
+}
+
+static long peakRssKb()
+{
+	struct rusage usage {};
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+}
+
+static std::map<std::string, float> readBaseline(const char *path)
+{
+	std::map<std::string, float> baseline;
+	FILE *fp = fopen(path, "r");
+
+	if (fp != nullptr) {
+		char name[64] {};
+		float us_per_update = 0.f;
+
+		while (fscanf(fp, "%63[^,],%f\n", name, &us_per_update) == 2) {
+			baseline[name] = us_per_update;
+		}
+
+		fclose(fp);
+	}
+
+	return baseline;
+}
+
+static bool writeBaseline(const char *path, const BenchResult *results, size_t count)
+{
+	FILE *fp = fopen(path, "w");
+
+	if (fp == nullptr) {
+		fprintf(stderr, "cannot write baseline file %s\n", path);
+		return false;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		// store with margin so run-to-run noise does not fail the comparison
+		fprintf(fp, "%s,%.2f\n", results[i].name.c_str(), (double)(results[i].us_per_update() * 1.25f));
+	}
+
+	fclose(fp);
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	const bool update_baseline = (argc == 3) && (strcmp(argv[1], "--update") == 0);
+	const char *baseline_path = update_baseline ? argv[2] : ((argc == 2) ? argv[1] : nullptr);
+
+	const BenchResult results[] = {
+		runScenario("iris_gps", TEST_DATA_PATH"/replay_data/iris_gps.csv", 35.f),
+		runScenario("ekf_gsf_reset", TEST_DATA_PATH"/replay_data/ekf_gsf_reset.csv", 39.f),
+	};
+
+	const size_t count = sizeof(results) / sizeof(results[0]);
+
+	printf("%-16s %10s %12s %14s\n", "scenario", "sim [s]", "wall [ms]", "us/update");
+
+	for (size_t i = 0; i < count; i++) {
+		printf("%-16s %10.1f %12.1f %14.2f\n", results[i].name.c_str(), (double)results[i].duration_s,
+		       (double)results[i].wall_us * 1e-3, (double)results[i].us_per_update());
+	}
+
+	printf("peak RSS: %ld kB\n", peakRssKb());
+
+	if (update_baseline) {
+		return writeBaseline(baseline_path, results, count) ? 0 : 1;
+	}
+
+	int ret = 0;
+
+	if (baseline_path != nullptr) {
+		const std::map<std::string, float> baseline = readBaseline(baseline_path);
+
+		for (size_t i = 0; i < count; i++) {
+			const auto it = baseline.find(results[i].name);
+
+			if (it == baseline.end()) {
+				fprintf(stderr, "%s: no baseline entry\n", results[i].name.c_str());
+				ret = 1;
+
+			} else if (results[i].us_per_update() > it->second) {
+				fprintf(stderr, "%s: regression, %.2f us/update exceeds baseline %.2f\n",
+					results[i].name.c_str(), (double)results[i].us_per_update(), (double)it->second);
+				ret = 1;
+			}
+		}
+	}
+
+	return ret;
+}
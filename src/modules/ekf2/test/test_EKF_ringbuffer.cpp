@@ -158,3 +158,48 @@ TEST_F(EkfRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+TEST_F(EkfRingBufferTest, arenaBackedBuffer)
+{
+	// GIVEN: an arena reserved for exactly two buffers of three samples
+	BufferArena arena;
+	ASSERT_EQ(true, arena.reserve(2 * RingBuffer<sample>::storage_bytes(3)));
+
+	// WHEN: buffers are allocated from the arena
+	RingBuffer<sample> first(3, &arena);
+	RingBuffer<sample> second(3, &arena);
+
+	// THEN: both are valid and behave like heap backed buffers
+	ASSERT_EQ(true, first.valid());
+	ASSERT_EQ(true, second.valid());
+	EXPECT_EQ(arena.used(), arena.capacity());
+
+	first.push(_x);
+	first.push(_y);
+	second.push(_z);
+
+	EXPECT_EQ(_y.time_us, first.get_newest().time_us);
+	EXPECT_EQ(_x.time_us, first.get_oldest().time_us);
+	EXPECT_EQ(_z.time_us, second.get_newest().time_us);
+}
+
+TEST_F(EkfRingBufferTest, arenaExhaustedFallsBackToHeap)
+{
+	// GIVEN: an arena with room for a single buffer
+	BufferArena arena;
+	ASSERT_EQ(true, arena.reserve(RingBuffer<sample>::storage_bytes(3)));
+
+	RingBuffer<sample> first(3, &arena);
+	ASSERT_EQ(true, first.valid());
+
+	// WHEN: a second buffer is requested from the exhausted arena
+	RingBuffer<sample> second(3, &arena);
+
+	// THEN: it falls back to the heap and is still usable
+	ASSERT_EQ(true, second.valid());
+	second.push(_x);
+	EXPECT_EQ(_x.time_us, second.get_newest().time_us);
+
+	// AND: the arena capacity cannot change while its memory is in use
+	EXPECT_EQ(false, arena.reserve(2 * RingBuffer<sample>::storage_bytes(3)));
+}
@@ -94,6 +94,9 @@ public:
 	void overrideCruiseSpeed(const float cruise_speed_m_s) override;
 
 protected:
+	/** the trajectory smoothing needs the velocity setpoint feedback for initialization */
+	uint8_t _sharedComputations() const override { return SharedComputation::SetpointFeedback; }
+
 	matrix::Vector2f _getTargetVelocityXY(); /**< only used for follow-me and only here because of legacy reason.*/
 	void _updateInternalWaypoints(); /**< Depending on state of vehicle, the internal waypoints might differ from target (for instance if offtrack). */
 	bool _compute_heading_from_2D_vector(float &heading, matrix::Vector2f v); /**< Computes and sets heading a 2D vector */
@@ -35,9 +35,21 @@ bool FlightTask::updateInitialize()
 	_sub_vehicle_local_position.update();
 	_sub_home_position.update();
 
+	const uint8_t shared_computations = _sharedComputations();
+
 	_evaluateVehicleLocalPosition();
-	_evaluateVehicleLocalPositionSetpoint();
+
+	if (shared_computations & SetpointFeedback) {
+		_evaluateVehicleLocalPositionSetpoint();
+	}
+
 	_evaluateDistanceToGround();
+
+	if (shared_computations & YawTrig) {
+		_yaw_sin = PX4_ISFINITE(_yaw) ? sinf(_yaw) : 0.f;
+		_yaw_cos = PX4_ISFINITE(_yaw) ? cosf(_yaw) : 1.f;
+	}
+
 	return true;
 }
 
@@ -143,7 +155,8 @@ void FlightTask::_evaluateVehicleLocalPosition()
 		}
 
 		// global frame reference coordinates to enable conversions
-		if (_sub_vehicle_local_position.get().xy_global && _sub_vehicle_local_position.get().z_global) {
+		if ((_sharedComputations() & GlobalFrameProjection)
+		    && _sub_vehicle_local_position.get().xy_global && _sub_vehicle_local_position.get().z_global) {
 			if (!_geo_projection.isInitialized()
 			    || (_geo_projection.getProjectionReferenceTimestamp() != _sub_vehicle_local_position.get().ref_timestamp)) {
 
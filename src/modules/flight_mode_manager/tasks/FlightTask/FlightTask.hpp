@@ -184,6 +184,21 @@ protected:
 	void _evaluateVehicleLocalPositionSetpoint();
 	void _evaluateDistanceToGround();
 
+	/**
+	 * Shared per-cycle computations.
+	 * Quantities several tasks derive from the same inputs are evaluated at most
+	 * once per cycle in updateInitialize() and only for the task that declared
+	 * them, such that deriving tasks and their helper classes can reuse them.
+	 */
+	enum SharedComputation : uint8_t {
+		YawTrig = (1 << 0), ///< sine and cosine of the current vehicle yaw (_yaw_sin, _yaw_cos)
+		SetpointFeedback = (1 << 1), ///< input and output of the velocity controller (_velocity_setpoint_feedback, _acceleration_setpoint_feedback)
+		GlobalFrameProjection = (1 << 2), ///< local <-> global projection of the estimator reference (_geo_projection, _global_local_alt0)
+	};
+
+	/** Bitmask of SharedComputation entries the task needs each cycle */
+	virtual uint8_t _sharedComputations() const { return 0; }
+
 	/** Set constraints to default values */
 	virtual void _setDefaultConstraints();
 
@@ -219,6 +234,8 @@ protected:
 	matrix::Vector3f _velocity; /**< current vehicle velocity */
 
 	float _yaw{}; /**< current vehicle yaw heading */
+	float _yaw_sin{0.f}; /**< sine of the current vehicle yaw, cached with SharedComputation::YawTrig */
+	float _yaw_cos{1.f}; /**< cosine of the current vehicle yaw, cached with SharedComputation::YawTrig */
 	bool _is_yaw_good_for_control{}; /**< true if the yaw estimate can be used for yaw control */
 	float _dist_to_bottom{}; /**< current height above ground level if dist_bottom is valid */
 	float _dist_to_ground{}; /**< equals _dist_to_bottom if available, height above home otherwise */
@@ -287,10 +287,13 @@ void FlightTaskManualAltitude::_respectGroundSlowdown()
 
 void FlightTaskManualAltitude::_rotateIntoHeadingFrame(Vector2f &v)
 {
-	const float yaw_rotate = PX4_ISFINITE(_yaw_setpoint) ? _yaw_setpoint : _yaw;
-	Vector3f v_r = Vector3f(Dcmf(Eulerf(0.0f, 0.0f, yaw_rotate)) * Vector3f(v(0), v(1), 0.0f));
-	v(0) = v_r(0);
-	v(1) = v_r(1);
+	if (PX4_ISFINITE(_yaw_setpoint)) {
+		Sticks::rotateIntoHeadingFrameXY(v, _yaw, _yaw_setpoint);
+
+	} else {
+		// rotate around the current yaw with the trig cached in updateInitialize()
+		v = Vector2f(_yaw_cos * v(0) - _yaw_sin * v(1), _yaw_sin * v(0) + _yaw_cos * v(1));
+	}
 }
 
 void FlightTaskManualAltitude::_updateHeadingSetpoints()
@@ -54,6 +54,9 @@ public:
 	bool update() override;
 
 protected:
+	/** stick inputs are rotated into the heading frame every cycle */
+	uint8_t _sharedComputations() const override { return SharedComputation::YawTrig; }
+
 	void _updateHeadingSetpoints(); /**< sets yaw or yaw speed */
 	void _ekfResetHandlerHeading(float delta_psi) override; /**< adjust heading setpoint in case of EKF reset event */
 	virtual void _updateSetpoints(); /**< updates all setpoints */
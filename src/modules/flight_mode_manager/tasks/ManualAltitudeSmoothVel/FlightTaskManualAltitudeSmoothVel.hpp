@@ -51,6 +51,12 @@ public:
 	bool activate(const trajectory_setpoint_s &last_setpoint) override;
 
 protected:
+	/** the smoothing additionally needs the velocity setpoint feedback for initialization */
+	uint8_t _sharedComputations() const override
+	{
+		return FlightTaskManualAltitude::_sharedComputations() | SharedComputation::SetpointFeedback;
+	}
+
 	virtual void _updateSetpoints() override;
 
 	/** Reset position or velocity setpoints in case of EKF reset event */
@@ -61,6 +61,12 @@ public:
 	bool update() override;
 
 protected:
+	/** the orbit center is commanded and reported in the global frame */
+	uint8_t _sharedComputations() const override
+	{
+		return FlightTaskManualAltitudeSmoothVel::_sharedComputations() | SharedComputation::GlobalFrameProjection;
+	}
+
 	/**
 	 * Send out telemetry information for the log and MAVLink.
 	 * @return true on success, false on error
@@ -36,7 +36,8 @@
  */
 
 #include "FlightTaskTransition.hpp"
-#include "Sticks.hpp"
+
+#include <mathlib/mathlib.h>
 
 FlightTaskTransition::FlightTaskTransition()
 {
@@ -99,9 +100,8 @@ bool FlightTaskTransition::update()
 	_position_setpoint.setAll(NAN);
 
 	// calculate a horizontal acceleration vector which corresponds to an attitude composed of pitch up by _param_pitch_cruise_degrees
-	// and zero roll angle
-	matrix::Vector2f tmp(-1.0f, 0.0f);
-	Sticks::rotateIntoHeadingFrameXY(tmp, _yaw, NAN);
+	// and zero roll angle, rotated into the heading frame with the cached yaw trig
+	const matrix::Vector2f tmp(-_yaw_cos, -_yaw_sin);
 	_acceleration_setpoint.xy() = tmp * tanf(math::radians(_param_pitch_cruise_degrees)) * CONSTANTS_ONE_G;
 
 	// slowly move vertical velocity setpoint to zero
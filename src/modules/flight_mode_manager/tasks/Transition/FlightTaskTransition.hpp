@@ -59,6 +59,8 @@ public:
 	bool update() override;
 
 private:
+	/** the acceleration setpoint is rotated by the current yaw every cycle */
+	uint8_t _sharedComputations() const override { return SharedComputation::YawTrig; }
 
 	static constexpr float _vel_z_filter_time_const = 2.0f;
 
@@ -66,8 +66,7 @@ void StickAccelerationXY::resetVelocity(const matrix::Vector2f &velocity)
 
 void StickAccelerationXY::resetAcceleration(const matrix::Vector2f &acceleration)
 {
-	_acceleration_slew_rate_x.setForcedValue(acceleration(0));
-	_acceleration_slew_rate_y.setForcedValue(acceleration(1));
+	_acceleration_slew_rate.setForcedValue(acceleration);
 }
 
 void StickAccelerationXY::generateSetpoints(Vector2f stick_xy, const float yaw, const float yaw_sp, const Vector3f &pos,
@@ -132,12 +131,8 @@ void StickAccelerationXY::applyJerkLimit(const float dt)
 	// Scale each jerk limit with the normalized projection of the acceleration
 	// setpoint increment to produce a synchronized motion
 	const Vector2f dir = Vector2f(_acceleration_setpoint - _acceleration_setpoint_prev).unit_or_zero();
-	const float jerk_max_x = fabsf(dir(0)) * _param_mpc_jerk_max.get();
-	const float jerk_max_y = fabsf(dir(1)) * _param_mpc_jerk_max.get();
-	_acceleration_slew_rate_x.setSlewRate(jerk_max_x);
-	_acceleration_slew_rate_y.setSlewRate(jerk_max_y);
-	_acceleration_setpoint(0) = _acceleration_slew_rate_x.update(_acceleration_setpoint(0), dt);
-	_acceleration_setpoint(1) = _acceleration_slew_rate_y.update(_acceleration_setpoint(1), dt);
+	_acceleration_slew_rate.setSlewRate(dir.abs() * _param_mpc_jerk_max.get());
+	_acceleration_setpoint = _acceleration_slew_rate.update(_acceleration_setpoint, dt);
 }
 
 Vector2f StickAccelerationXY::calculateDrag(Vector2f drag_coefficient, const float dt, const Vector2f &stick_xy,
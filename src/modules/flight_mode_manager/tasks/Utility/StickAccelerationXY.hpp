@@ -70,8 +70,7 @@ private:
 
 	uORB::Subscription _takeoff_status_sub{ORB_ID(takeoff_status)};
 
-	SlewRate<float> _acceleration_slew_rate_x;
-	SlewRate<float> _acceleration_slew_rate_y;
+	SlewRate<matrix::Vector2f> _acceleration_slew_rate;
 	AlphaFilter<float> _brake_boost_filter;
 
 	matrix::Vector2f _position_setpoint;
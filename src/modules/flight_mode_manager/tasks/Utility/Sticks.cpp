@@ -101,7 +101,8 @@ void Sticks::limitStickUnitLengthXY(Vector2f &v)
 
 void Sticks::rotateIntoHeadingFrameXY(Vector2f &v, const float yaw, const float yaw_setpoint)
 {
-	Vector3f v3(v(0), v(1), 0.f);
 	const float yaw_rotate = PX4_ISFINITE(yaw_setpoint) ? yaw_setpoint : yaw;
-	v = Vector2f(Dcmf(Eulerf(0.0f, 0.0f, yaw_rotate)) * v3);
+	const float sin_yaw = sinf(yaw_rotate);
+	const float cos_yaw = cosf(yaw_rotate);
+	v = Vector2f(cos_yaw * v(0) - sin_yaw * v(1), sin_yaw * v(0) + cos_yaw * v(1));
 }
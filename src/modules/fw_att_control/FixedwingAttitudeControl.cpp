@@ -107,10 +107,89 @@ FixedwingAttitudeControl::parameters_update()
 		// set FF gains to 0 as we add the FF control outside of the rate controller
 		Vector3f(0.f, 0.f, 0.f));
 
+	update_airspeed_schedule();
 
 	return PX4_OK;
 }
 
+void
+FixedwingAttitudeControl::update_airspeed_schedule()
+{
+	const float airspeed_stall = _param_fw_airspd_stall.get();
+	const float airspeed_trim = _param_fw_airspd_trim.get();
+	const float airspeed_max = _param_fw_airspd_max.get();
+
+	// breakpoints run from stall to max with trim as the center entry, so the trim increment
+	// schedule (piecewise linear with its knee at trim) is reproduced exactly and the
+	// interpolation error of the hyperbolic actuator scaling stays well below 1%
+	static constexpr int HALF = SCHEDULE_TABLE_SIZE / 2;
+
+	for (int i = 0; i < SCHEDULE_TABLE_SIZE; i++) {
+		float airspeed;
+
+		if (i <= HALF) {
+			airspeed = airspeed_stall + (airspeed_trim - airspeed_stall) * i / HALF;
+
+		} else {
+			airspeed = airspeed_trim + (airspeed_max - airspeed_trim) * (i - HALF) / HALF;
+		}
+
+		AirspeedScheduleEntry &entry = _airspeed_schedule[i];
+		entry.airspeed = airspeed;
+
+		const float airspeed_constrained = constrain(constrain(airspeed, airspeed_stall, airspeed_max), 0.1f, 1000.0f);
+		entry.airspeed_scaling = _param_fw_arsp_scale_en.get() ? (airspeed_trim / airspeed_constrained) : 1.0f;
+
+		if (airspeed < airspeed_trim) {
+			entry.dtrim_roll = interpolate(airspeed, airspeed_stall, airspeed_trim, _param_fw_dtrim_r_vmin.get(), 0.0f);
+			entry.dtrim_pitch = interpolate(airspeed, airspeed_stall, airspeed_trim, _param_fw_dtrim_p_vmin.get(), 0.0f);
+			entry.dtrim_yaw = interpolate(airspeed, airspeed_stall, airspeed_trim, _param_fw_dtrim_y_vmin.get(), 0.0f);
+
+		} else {
+			entry.dtrim_roll = interpolate(airspeed, airspeed_trim, airspeed_max, 0.0f, _param_fw_dtrim_r_vmax.get());
+			entry.dtrim_pitch = interpolate(airspeed, airspeed_trim, airspeed_max, 0.0f, _param_fw_dtrim_p_vmax.get());
+			entry.dtrim_yaw = interpolate(airspeed, airspeed_trim, airspeed_max, 0.0f, _param_fw_dtrim_y_vmax.get());
+		}
+	}
+}
+
+FixedwingAttitudeControl::AirspeedScheduleEntry
+FixedwingAttitudeControl::interpolate_airspeed_schedule(float airspeed) const
+{
+	if (!(airspeed > _airspeed_schedule[0].airspeed)) {
+		return _airspeed_schedule[0];
+	}
+
+	if (!(airspeed < _airspeed_schedule[SCHEDULE_TABLE_SIZE - 1].airspeed)) {
+		return _airspeed_schedule[SCHEDULE_TABLE_SIZE - 1];
+	}
+
+	int upper = 1;
+
+	while (airspeed > _airspeed_schedule[upper].airspeed) {
+		upper++;
+	}
+
+	const AirspeedScheduleEntry &lo = _airspeed_schedule[upper - 1];
+	const AirspeedScheduleEntry &hi = _airspeed_schedule[upper];
+	const float span = hi.airspeed - lo.airspeed;
+
+	if (span < FLT_EPSILON) {
+		return hi;
+	}
+
+	const float t = (airspeed - lo.airspeed) / span;
+
+	AirspeedScheduleEntry out;
+	out.airspeed = airspeed;
+	out.airspeed_scaling = lo.airspeed_scaling + t * (hi.airspeed_scaling - lo.airspeed_scaling);
+	out.dtrim_roll = lo.dtrim_roll + t * (hi.dtrim_roll - lo.dtrim_roll);
+	out.dtrim_pitch = lo.dtrim_pitch + t * (hi.dtrim_pitch - lo.dtrim_pitch);
+	out.dtrim_yaw = lo.dtrim_yaw + t * (hi.dtrim_yaw - lo.dtrim_yaw);
+
+	return out;
+}
+
 void
 FixedwingAttitudeControl::vehicle_control_mode_poll()
 {
@@ -239,12 +318,11 @@ float FixedwingAttitudeControl::get_airspeed_and_update_scaling()
 	 * speed doesn't make any sense - its the strongest reasonable deflection we
 	 * want to do in flight and it's the baseline a human pilot would choose.
 	 *
-	 * Forcing the scaling to this value allows reasonable handheld tests.
+	 * The schedule table is clamped to the [stall, max] envelope, so interpolating
+	 * it also forces the scaling to this range and allows reasonable handheld tests.
 	 */
-	const float airspeed_constrained = constrain(constrain(airspeed, _param_fw_airspd_stall.get(),
-					   _param_fw_airspd_max.get()), 0.1f, 1000.0f);
-
-	_airspeed_scaling = (_param_fw_arsp_scale_en.get()) ? (_param_fw_airspd_trim.get() / airspeed_constrained) : 1.0f;
+	_scheduled_gains = interpolate_airspeed_schedule(airspeed);
+	_airspeed_scaling = _scheduled_gains.airspeed_scaling;
 
 	return airspeed;
 }
@@ -483,30 +561,10 @@ void FixedwingAttitudeControl::Run()
 
 			_flag_control_attitude_enabled_last = _vcontrol_mode.flag_control_attitude_enabled;
 
-			/* bi-linear interpolation over airspeed for actuator trim scheduling */
-			float trim_roll = _param_trim_roll.get();
-			float trim_pitch = _param_trim_pitch.get();
-			float trim_yaw = _param_trim_yaw.get();
-
-			if (airspeed < _param_fw_airspd_trim.get()) {
-				trim_roll += interpolate(airspeed, _param_fw_airspd_stall.get(), _param_fw_airspd_trim.get(),
-							 _param_fw_dtrim_r_vmin.get(),
-							 0.0f);
-				trim_pitch += interpolate(airspeed, _param_fw_airspd_stall.get(), _param_fw_airspd_trim.get(),
-							  _param_fw_dtrim_p_vmin.get(),
-							  0.0f);
-				trim_yaw += interpolate(airspeed, _param_fw_airspd_stall.get(), _param_fw_airspd_trim.get(),
-							_param_fw_dtrim_y_vmin.get(),
-							0.0f);
-
-			} else {
-				trim_roll += interpolate(airspeed, _param_fw_airspd_trim.get(), _param_fw_airspd_max.get(), 0.0f,
-							 _param_fw_dtrim_r_vmax.get());
-				trim_pitch += interpolate(airspeed, _param_fw_airspd_trim.get(), _param_fw_airspd_max.get(), 0.0f,
-							  _param_fw_dtrim_p_vmax.get());
-				trim_yaw += interpolate(airspeed, _param_fw_airspd_trim.get(), _param_fw_airspd_max.get(), 0.0f,
-							_param_fw_dtrim_y_vmax.get());
-			}
+			/* actuator trim scheduling, interpolated from the airspeed gain schedule table */
+			float trim_roll = _param_trim_roll.get() + _scheduled_gains.dtrim_roll;
+			float trim_pitch = _param_trim_pitch.get() + _scheduled_gains.dtrim_pitch;
+			float trim_yaw = _param_trim_yaw.get() + _scheduled_gains.dtrim_yaw;
 
 			/* add trim increment if flaps are deployed  */
 			trim_roll += _flaps_setpoint_with_slewrate.getState() * _param_fw_dtrim_r_flps.get();
@@ -157,6 +157,21 @@ private:
 
 	float _airspeed_scaling{1.0f};
 
+	// airspeed gain schedule: actuator scaling and trim increments precomputed over the
+	// airspeed envelope at parameter load, the per-cycle path does one table interpolation
+	struct AirspeedScheduleEntry {
+		float airspeed{0.f};		///< [m/s] breakpoint this entry was computed at
+		float airspeed_scaling{1.f};	///< actuator scaling relative to trim airspeed
+		float dtrim_roll{0.f};		///< roll trim increment
+		float dtrim_pitch{0.f};		///< pitch trim increment
+		float dtrim_yaw{0.f};		///< yaw trim increment
+	};
+
+	static constexpr int SCHEDULE_TABLE_SIZE = 9; ///< odd so the trim airspeed is a breakpoint
+
+	AirspeedScheduleEntry _airspeed_schedule[SCHEDULE_TABLE_SIZE] {};
+	AirspeedScheduleEntry _scheduled_gains{}; ///< schedule interpolated at the current airspeed
+
 	bool _landed{true};
 
 	float _battery_scale{1.0f};
@@ -277,4 +292,14 @@ private:
 	void		vehicle_land_detected_poll();
 
 	float 		get_airspeed_and_update_scaling();
+
+	/**
+	 * Rebuild the airspeed gain schedule table from the current parameters.
+	 */
+	void		update_airspeed_schedule();
+
+	/**
+	 * Interpolate the gain schedule table at the given airspeed.
+	 */
+	AirspeedScheduleEntry interpolate_airspeed_schedule(float airspeed) const;
 };
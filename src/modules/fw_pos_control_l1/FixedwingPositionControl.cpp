@@ -2485,10 +2485,6 @@ FixedwingPositionControl::tecs_update_pitch_throttle(const float control_interva
 		_tecs.resetTrajectoryGenerators(_current_altitude);
 	}
 
-	/* update TECS vehicle state estimates */
-	_tecs.update_vehicle_state_estimates(_airspeed, _body_acceleration(0), (_local_pos.timestamp > 0), _current_altitude,
-					     _local_pos.vz);
-
 	const float throttle_trim_comp = compensateTrimThrottleForDensityAndWeight(_param_fw_thr_trim.get(), throttle_min,
 					 throttle_max);
 
@@ -2507,6 +2503,9 @@ FixedwingPositionControl::tecs_update_pitch_throttle(const float control_interva
 				    pitch_max_rad - radians(_param_fw_psp_off.get()),
 				    _param_climbrate_target.get(),
 				    desired_max_sinkrate,
+				    _body_acceleration(0),
+				    (_local_pos.timestamp > 0),
+				    _local_pos.vz,
 				    hgt_rate_sp);
 
 	tecs_status_publish();
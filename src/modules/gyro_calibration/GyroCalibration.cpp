@@ -154,9 +154,22 @@ void GyroCalibration::Run()
 
 			if (_gyro_calibration[gyro].device_id() == sensor_gyro.device_id) {
 				const Vector3f val{Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z} - _gyro_calibration[gyro].thermal_offset()};
-				_gyro_mean[gyro].update(val);
+				_gyro_mean_recent[gyro].update(val);
 				_gyro_last_update[gyro] = sensor_gyro.timestamp;
 
+				// commit the block once complete and still, otherwise discard only the block
+				if (_gyro_mean_recent[gyro].count() >= COMMIT_BLOCK_SAMPLES) {
+					if (_gyro_mean_recent[gyro].variance().longerThan(0.001f)) {
+						PX4_DEBUG("gyro %d block variance longer than 0.001f (%.3f), rolling back",
+							  gyro, (double)_gyro_mean_recent[gyro].variance().length());
+						Rollback();
+
+					} else {
+						_gyro_mean[gyro].merge(_gyro_mean_recent[gyro]);
+						_gyro_mean_recent[gyro].reset();
+					}
+				}
+
 			} else {
 				// setting device id, reset all
 				_gyro_calibration[gyro].set_device_id(sensor_gyro.device_id);
@@ -181,15 +194,15 @@ void GyroCalibration::Run()
 			const Vector3f acceleration{sensor_accel.x, sensor_accel.y, sensor_accel.z};
 
 			if ((acceleration - _acceleration[accel]).longerThan(0.5f)) {
-				// reset all on any change
-				PX4_DEBUG("accel %d changed, resetting all %.5f", accel, (double)(acceleration - _acceleration[accel]).length());
+				// discard the uncommitted block on any change, the committed blocks were still
+				PX4_DEBUG("accel %d changed, rolling back %.5f", accel, (double)(acceleration - _acceleration[accel]).length());
 
 				_acceleration[accel] = acceleration;
-				Reset();
+				Rollback();
 				return;
 
 			} else if (acceleration.longerThan(CONSTANTS_ONE_G * 1.3f)) {
-				Reset();
+				Rollback();
 				return;
 			}
 		}
@@ -201,21 +214,9 @@ void GyroCalibration::Run()
 
 	for (int gyro = 0; gyro < _sensor_gyro_subs.size(); gyro++) {
 		if ((_gyro_calibration[gyro].device_id() != 0) && _gyro_mean[gyro].valid()) {
-			// periodically check variance
-			if (_gyro_mean[gyro].count() % 100 == 0) {
-				PX4_DEBUG("gyro %d (%" PRIu32 ") variance, [%.9f, %.9f, %.9f] %.9f", gyro, _gyro_calibration[gyro].device_id(),
-					  (double)_gyro_mean[gyro].variance()(0), (double)_gyro_mean[gyro].variance()(1), (double)_gyro_mean[gyro].variance()(2),
-					  (double)_gyro_mean[gyro].variance().length());
-
-				if (_gyro_mean[gyro].variance().longerThan(0.001f)) {
-					// reset all
-					PX4_DEBUG("gyro %d variance longer than 0.001f (%.3f), resetting all",
-						  gyro, (double)_gyro_mean[gyro].variance().length());
-					Reset();
-					return;
-				}
-			}
-
+			// every committed block already passed the stillness check, only the
+			// combined variance (catching mean drift between blocks) is verified
+			// once more before saving
 			if (_gyro_mean[gyro].count() > 5000) {
 				sufficient_samples = true;
 
@@ -76,6 +76,10 @@ private:
 	static constexpr hrt_abstime INTERVAL_US = 20000_us;
 	static constexpr int MAX_SENSORS = 4;
 
+	// samples are accumulated in blocks of this size and only committed to the
+	// long term statistics once the whole block passed the stillness check
+	static constexpr unsigned COMMIT_BLOCK_SAMPLES = 200;
+
 	void Run() override;
 
 	void Reset()
@@ -83,6 +87,18 @@ private:
 		for (auto &m : _gyro_mean) {
 			m.reset();
 		}
+
+		Rollback();
+	}
+
+	// Discard only the samples gathered since the last block commit. The committed
+	// statistics already passed the stillness checks and are kept, so a short
+	// disturbance does not throw away the whole calibration window.
+	void Rollback()
+	{
+		for (auto &m : _gyro_mean_recent) {
+			m.reset();
+		}
 	}
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
@@ -93,7 +109,8 @@ private:
 	uORB::SubscriptionMultiArray<sensor_gyro_s, MAX_SENSORS>  _sensor_gyro_subs{ORB_ID::sensor_gyro};
 
 	calibration::Gyroscope _gyro_calibration[MAX_SENSORS] {};
-	math::WelfordMean<float, 3> _gyro_mean[MAX_SENSORS] {};
+	math::WelfordMean<float, 3> _gyro_mean[MAX_SENSORS] {};		///< committed statistics (whole still blocks)
+	math::WelfordMean<float, 3> _gyro_mean_recent[MAX_SENSORS] {};	///< block currently being gathered
 	float _temperature[MAX_SENSORS] {};
 	hrt_abstime _gyro_last_update[MAX_SENSORS] {};
 
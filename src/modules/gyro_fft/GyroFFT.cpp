@@ -49,6 +49,12 @@ GyroFFT::GyroFFT() :
 		_sensor_gyro_fft.peak_frequencies_z[i] = NAN;
 	}
 
+	for (int i = 0; i < NUM_HARMONICS; i++) {
+		_sensor_gyro_fft.harmonic_magnitude_x[i] = NAN;
+		_sensor_gyro_fft.harmonic_magnitude_y[i] = NAN;
+		_sensor_gyro_fft.harmonic_magnitude_z[i] = NAN;
+	}
+
 	_sensor_gyro_fft_pub.advertise();
 }
 
@@ -57,6 +63,7 @@ GyroFFT::~GyroFFT()
 	perf_free(_cycle_perf);
 	perf_free(_cycle_interval_perf);
 	perf_free(_fft_perf);
+	perf_free(_peak_tracking_perf);
 	perf_free(_gyro_generation_gap_perf);
 	perf_free(_gyro_fifo_generation_gap_perf);
 
@@ -326,6 +333,27 @@ void GyroFFT::Run()
 	const bool selection_updated = SensorSelectionUpdate();
 	VehicleIMUStatusUpdate(selection_updated);
 
+	if (_esc_status_sub.updated()) {
+		esc_status_s esc_status;
+
+		if (_esc_status_sub.copy(&esc_status)) {
+			// average rotation frequency of the reporting motors keys the published harmonic magnitudes
+			float rpm_sum = 0.f;
+			int rpm_count = 0;
+
+			const int limited_esc_count = math::min(esc_status.esc_count, esc_status_s::CONNECTED_ESC_MAX);
+
+			for (int i = 0; i < limited_esc_count; i++) {
+				if ((esc_status.esc_online_flags & (1 << i)) && (esc_status.esc[i].esc_rpm != 0)) {
+					rpm_sum += fabsf((float)esc_status.esc[i].esc_rpm);
+					rpm_count++;
+				}
+			}
+
+			_motor_frequency_hz = (rpm_count > 0) ? (rpm_sum / rpm_count) / 60.f : 0.f;
+		}
+	}
+
 	// reset
 	_fft_updated = false;
 
@@ -408,22 +436,40 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 
 			// if we have enough samples begin processing, but only one FFT per cycle
 			if ((buffer_index >= _imu_gyro_fft_len) && !_fft_updated) {
-				perf_begin(_fft_perf);
 
-				arm_mult_q15(gyro_data_buffer[axis], _hanning_window, _fft_input_buffer, _imu_gyro_fft_len);
-				arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+				// between full transforms only the bins around the currently published peaks are
+				// re-evaluated (Goertzel), the periodic full FFT re-acquires new peaks
+				bool peaks_tracked = false;
 
-				_fft_updated = true;
+				if (_peak_tracking_updates[axis] < PEAK_TRACKING_MAX_UPDATES) {
+					perf_begin(_peak_tracking_perf);
+					peaks_tracked = TrackPeaks(timestamp_sample, axis, gyro_data_buffer[axis]);
+					perf_end(_peak_tracking_perf);
+				}
+
+				if (peaks_tracked) {
+					_peak_tracking_updates[axis]++;
+
+				} else {
+					perf_begin(_fft_perf);
+
+					arm_mult_q15(gyro_data_buffer[axis], _hanning_window, _fft_input_buffer, _imu_gyro_fft_len);
+					arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+
+					FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
 
-				FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
+					_peak_tracking_updates[axis] = 0;
+
+					perf_end(_fft_perf);
+				}
+
+				_fft_updated = true;
 
 				// reset
 				// shift buffer (3/4 overlap)
 				const int overlap_start = _imu_gyro_fft_len / 4;
 				memmove(&gyro_data_buffer[axis][0], &gyro_data_buffer[axis][overlap_start], sizeof(q15_t) * overlap_start * 3);
 				buffer_index = overlap_start * 3;
-
-				perf_end(_fft_perf);
 			}
 		}
 	}
@@ -450,6 +496,11 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 		bin_mag_sum += fft_magnitude;
 	}
 
+	// keep the broadband magnitude as SNR background for the incremental peak updates
+	_fft_bin_mag_sum[axis] = bin_mag_sum;
+
+	// sample the motor rotation harmonics before the peak search zeroes the peak bins
+	UpdateHarmonics(axis);
 
 	// find raw peaks
 	uint16_t raw_peak_index[MAX_NUM_PEAKS] {};
@@ -546,6 +597,149 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 	}
 }
 
+void GyroFFT::UpdateHarmonics(int axis)
+{
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+
+	float *harmonic_magnitude_publish[] { _sensor_gyro_fft.harmonic_magnitude_x, _sensor_gyro_fft.harmonic_magnitude_y, _sensor_gyro_fft.harmonic_magnitude_z };
+
+	_sensor_gyro_fft.base_frequency_hz = _motor_frequency_hz;
+	_sensor_gyro_fft.mean_bin_magnitude[axis] = _fft_bin_mag_sum[axis] / ((_imu_gyro_fft_len / 2) - 1);
+
+	for (int harmonic = 0; harmonic < NUM_HARMONICS; harmonic++) {
+		float magnitude = NAN;
+
+		if (_motor_frequency_hz > resolution_hz) {
+			const int bin_index = (int)roundf((harmonic + 1) * _motor_frequency_hz / resolution_hz);
+
+			// the reported RPM can be off by a bin, take the largest neighbour
+			if ((bin_index >= 2) && (bin_index < (_imu_gyro_fft_len / 2) - 1)) {
+				magnitude = math::max(_peak_magnitudes_all[bin_index - 1], _peak_magnitudes_all[bin_index],
+						      _peak_magnitudes_all[bin_index + 1]);
+			}
+		}
+
+		harmonic_magnitude_publish[axis][harmonic] = magnitude;
+	}
+
+	_publish = true;
+}
+
+bool GyroFFT::TrackPeaks(const hrt_abstime &timestamp_sample, int axis, const q15_t *gyro_data_buffer)
+{
+	// incrementally re-evaluate only the 3 bins around each currently published peak (Goertzel)
+	// instead of computing the full transform, returns false if a full FFT is required to re-acquire
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+
+	if (!(_fft_bin_mag_sum[axis] > 0.f) || !(resolution_hz > 0.f)) {
+		return false;
+	}
+
+	float *peak_frequencies_publish[] { _sensor_gyro_fft.peak_frequencies_x, _sensor_gyro_fft.peak_frequencies_y, _sensor_gyro_fft.peak_frequencies_z };
+
+	// bins currently being tracked (bin - 1 and bin + 1 are needed for the frequency estimate)
+	int tracked_bins[MAX_NUM_PEAKS];
+	int num_tracked = 0;
+
+	for (int i = 0; i < MAX_NUM_PEAKS; i++) {
+		const float freq = peak_frequencies_publish[axis][i];
+
+		if (PX4_ISFINITE(freq) && (freq > 0)) {
+			const int bin_index = (int)roundf(freq / resolution_hz);
+
+			if ((bin_index >= 2) && (bin_index < (_imu_gyro_fft_len / 2) - 1)) {
+				tracked_bins[num_tracked] = bin_index;
+				num_tracked++;
+			}
+		}
+	}
+
+	if (num_tracked == 0) {
+		return false;
+	}
+
+	static constexpr float MIN_SNR = 1.f; // TODO: configurable?
+
+	int num_peaks_found = 0;
+	float peak_frequencies[MAX_NUM_PEAKS] {};
+	float peak_snr[MAX_NUM_PEAKS] {};
+
+	for (int peak = 0; peak < num_tracked; peak++) {
+
+		// Goertzel recurrence for bins [bin_index - 1, bin_index, bin_index + 1] over the Hann windowed buffer
+		const int bin_index = tracked_bins[peak];
+
+		float coeff[3];
+		float cos_w[3];
+		float sin_w[3];
+		float s1[3] {};
+		float s2[3] {};
+
+		for (int j = 0; j < 3; j++) {
+			const float w = 2.f * M_PI_F * (bin_index - 1 + j) / _imu_gyro_fft_len;
+			cos_w[j] = cosf(w);
+			sin_w[j] = sinf(w);
+			coeff[j] = 2.f * cos_w[j];
+		}
+
+		for (int n = 0; n < _imu_gyro_fft_len; n++) {
+			const float sample = (float)gyro_data_buffer[n] * (float)_hanning_window[n];
+
+			for (int j = 0; j < 3; j++) {
+				const float s0 = sample + coeff[j] * s1[j] - s2[j];
+				s2[j] = s1[j];
+				s1[j] = s0;
+			}
+		}
+
+		// match the scaling of the q15 FFT path (windowing product >> 15, transform downscaled by its length)
+		const float scale = 1.f / (32768.f * _imu_gyro_fft_len);
+
+		q15_t fft_bins[6]; // [real[bin - 1], imag[bin - 1], real[bin], imag[bin], real[bin + 1], imag[bin + 1]]
+
+		for (int j = 0; j < 3; j++) {
+			fft_bins[2 * j]     = (q15_t)((s1[j] * cos_w[j] - s2[j]) * scale);
+			fft_bins[2 * j + 1] = (q15_t)(s1[j] * sin_w[j] * scale);
+		}
+
+		const float real = fft_bins[2];
+		const float imag = fft_bins[3];
+		const float peak_magnitude = sqrtf(real * real + imag * imag);
+
+		// SNR against the broadband magnitude of the last full FFT (background changes slowly)
+		const float snr = 10.f * log10f((_imu_gyro_fft_len - 1) * peak_magnitude /
+						math::max(_fft_bin_mag_sum[axis] - peak_magnitude, FLT_EPSILON));
+
+		if (!PX4_ISFINITE(snr) || (snr < MIN_SNR)) {
+			// peak faded, fall back to the full FFT to re-acquire
+			continue;
+		}
+
+		// EstimatePeakFrequencyBin() on the 3 computed bins returns 1 + d (d: fractional bin offset)
+		const float adjusted_bin = 0.5f * EstimatePeakFrequencyBin(fft_bins, 2);
+
+		if (PX4_ISFINITE(adjusted_bin)) {
+			const float freq_adjusted = resolution_hz * (bin_index - 1 + adjusted_bin);
+
+			if (PX4_ISFINITE(freq_adjusted)
+			    && (freq_adjusted >= _param_imu_gyro_fft_min.get())
+			    && (freq_adjusted <= _param_imu_gyro_fft_max.get())) {
+
+				peak_frequencies[num_peaks_found] = freq_adjusted;
+				peak_snr[num_peaks_found] = snr;
+				num_peaks_found++;
+			}
+		}
+	}
+
+	if (num_peaks_found > 0) {
+		UpdateOutput(timestamp_sample, axis, peak_frequencies, peak_snr, num_peaks_found);
+		return true;
+	}
+
+	return false;
+}
+
 void GyroFFT::UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
 			   float peak_snr[MAX_NUM_PEAKS], int num_peaks_found)
 {
@@ -706,6 +900,7 @@ int GyroFFT::print_status()
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
+	perf_print_counter(_peak_tracking_perf);
 	perf_print_counter(_gyro_generation_gap_perf);
 	perf_print_counter(_gyro_fifo_generation_gap_perf);
 	return 0;
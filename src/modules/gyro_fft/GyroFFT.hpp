@@ -46,6 +46,7 @@
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/esc_status.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fft.h>
@@ -84,12 +85,20 @@ private:
 	static constexpr int MAX_NUM_PEAKS = sizeof(sensor_gyro_fft_s::peak_frequencies_x) / sizeof(
 			sensor_gyro_fft_s::peak_frequencies_x[0]);
 
+	// number of consecutive incremental peak updates before a full FFT re-acquires new peaks
+	static constexpr int PEAK_TRACKING_MAX_UPDATES = 8;
+
+	static constexpr int NUM_HARMONICS = sizeof(sensor_gyro_fft_s::harmonic_magnitude_x) / sizeof(
+			sensor_gyro_fft_s::harmonic_magnitude_x[0]);
+
 	void Run() override;
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
+	inline bool TrackPeaks(const hrt_abstime &timestamp_sample, int axis, const q15_t *gyro_data_buffer);
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
 	inline void Publish();
 	bool SensorSelectionUpdate(bool force = false);
 	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
+	inline void UpdateHarmonics(int axis);
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
 				 float peak_snr[MAX_NUM_PEAKS], int num_peaks_found);
 	void VehicleIMUStatusUpdate(bool force = false);
@@ -116,6 +125,7 @@ private:
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
+	uORB::Subscription _esc_status_sub{ORB_ID(esc_status)};
 	uORB::Subscription _sensor_selection_sub{ORB_ID(sensor_selection)};
 	uORB::Subscription _vehicle_imu_status_sub{ORB_ID(vehicle_imu_status)};
 
@@ -125,6 +135,7 @@ private:
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 	perf_counter_t _cycle_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": cycle interval")};
 	perf_counter_t _fft_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": FFT")};
+	perf_counter_t _peak_tracking_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": peak tracking")};
 	perf_counter_t _gyro_generation_gap_perf{nullptr};
 	perf_counter_t _gyro_fifo_generation_gap_perf{nullptr};
 
@@ -149,6 +160,10 @@ private:
 
 	int _fft_buffer_index[3] {};
 
+	float _fft_bin_mag_sum[3] {};           // total magnitude of the last full FFT (SNR background)
+	float _motor_frequency_hz{0.f};         // average rotation frequency of the reporting motors
+	uint8_t _peak_tracking_updates[3] {};   // incremental peak updates since the last full FFT
+
 	unsigned _gyro_last_generation{0};
 
 	math::MedianFilter<float, 7> _median_filter[3][MAX_NUM_PEAKS] {};
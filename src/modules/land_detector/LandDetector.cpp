@@ -199,6 +199,12 @@ void LandDetector::Run()
 
 	_previous_armed_state = _armed;
 
+	// near the ground the full vehicle_local_position rate matters for the hysteresis timing,
+	// during cruise the 50 ms backup schedule is sufficient
+	const bool near_ground = landDetected || maybe_landedDetected || ground_contactDetected
+				 || _get_close_to_ground_or_skipped_check();
+	_vehicle_local_position_sub.set_interval_us(near_ground ? 0 : 100_ms);
+
 	perf_end(_cycle_perf);
 
 	if (should_exit()) {
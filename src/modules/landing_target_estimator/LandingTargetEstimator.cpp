@@ -57,6 +57,7 @@ LandingTargetEstimator::LandingTargetEstimator()
 	_paramHandle.pos_unc_init = param_find("LTEST_POS_UNC_IN");
 	_paramHandle.vel_unc_init = param_find("LTEST_VEL_UNC_IN");
 	_paramHandle.mode = param_find("LTEST_MODE");
+	_paramHandle.fuse_dec = param_find("LTEST_FUSE_DEC");
 	_paramHandle.scale_x = param_find("LTEST_SCALE_X");
 	_paramHandle.scale_y = param_find("LTEST_SCALE_Y");
 	_paramHandle.sensor_yaw = param_find("LTEST_SENS_ROT");
@@ -78,6 +79,9 @@ void LandingTargetEstimator::update()
 			PX4_WARN("Timeout");
 			_estimator_initialized = false;
 
+			// drop stale frames so a partial batch does not leak into the re-init
+			_meas_batch = {};
+
 		} else {
 			float dt = (hrt_absolute_time() - _last_predict) / SEC2USEC;
 
@@ -97,6 +101,13 @@ void LandingTargetEstimator::update()
 			_kalman_filter_y.predict(dt, -a(1), _params.acc_unc);
 
 			_last_predict = hrt_absolute_time();
+
+			// with decimated fusion the pose topic would only refresh every
+			// LTEST_FUSE_DEC frames; re-publish the prediction in between so
+			// precland can track the target at its own rate
+			if (_params.fuse_dec > 1 && !_new_sensorReport && !_faulty && _target_pose.rel_pos_valid) {
+				_publish_prediction();
+			}
 		}
 	}
 
@@ -122,7 +133,7 @@ void LandingTargetEstimator::update()
 
 	} else {
 		// update
-		const float measurement_uncertainty = _params.meas_unc * _dist_z * _dist_z;
+		const float measurement_uncertainty = _params.meas_unc * _meas_unc_factor;
 		bool update_x = _kalman_filter_x.update(_target_position_report.rel_pos_x, measurement_uncertainty);
 		bool update_y = _kalman_filter_y.update(_target_position_report.rel_pos_y, measurement_uncertainty);
 
@@ -244,17 +255,20 @@ void LandingTargetEstimator::_update_topics()
 
 		_dist_z = _vehicleLocalPosition.dist_bottom - _params.offset_z;
 
-		// scale the ray s.t. the z component has length of _uncertainty_scale
-		_target_position_report.timestamp = _irlockReport.timestamp;
-		_target_position_report.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_z = _dist_z;
-
-		// Adjust relative position according to sensor offset
-		_target_position_report.rel_pos_x += _params.offset_x;
-		_target_position_report.rel_pos_y += _params.offset_y;
-
-		_new_sensorReport = true;
+		// scale the ray s.t. the z component has length of _uncertainty_scale,
+		// adjust relative position according to sensor offset and batch the frame
+		_meas_batch.timestamp = _irlockReport.timestamp;
+		_meas_batch.rel_pos_x += sensor_ray(0) / sensor_ray(2) * _dist_z + _params.offset_x;
+		_meas_batch.rel_pos_y += sensor_ray(1) / sensor_ray(2) * _dist_z + _params.offset_y;
+		_meas_batch.rel_pos_z += _dist_z;
+		_meas_batch.dist_z_sq += _dist_z * _dist_z;
+		_meas_batch.count++;
+
+		// fuse immediately while initializing so the filter seeds from the first frame,
+		// otherwise once LTEST_FUSE_DEC frames are accumulated
+		if (!_estimator_initialized || _meas_batch.count >= math::max(_params.fuse_dec, (int32_t)1)) {
+			_flush_meas_batch();
+		}
 
 	} else if (_uwbDistanceSub.update(&_uwbDistance)) {
 		if (!_vehicleAttitude_valid || !_vehicleLocalPosition_valid) {
@@ -279,9 +293,61 @@ void LandingTargetEstimator::_update_topics()
 		_target_position_report.rel_pos_x = -_uwbDistance.position[0];
 		_target_position_report.rel_pos_y = -_uwbDistance.position[1];
 		_target_position_report.rel_pos_z = -_uwbDistance.position[2];
+
+		// uwb reports come at low rate and are not batched
+		_meas_unc_factor = _dist_z * _dist_z;
 	}
 }
 
+void LandingTargetEstimator::_flush_meas_batch()
+{
+	const float inv_n = 1.0f / _meas_batch.count;
+
+	_target_position_report.timestamp = _meas_batch.timestamp;
+	_target_position_report.rel_pos_x = _meas_batch.rel_pos_x * inv_n;
+	_target_position_report.rel_pos_y = _meas_batch.rel_pos_y * inv_n;
+	_target_position_report.rel_pos_z = _meas_batch.rel_pos_z * inv_n;
+
+	// averaging n independent frames scales the measurement variance by 1/n
+	_meas_unc_factor = _meas_batch.dist_z_sq * inv_n * inv_n;
+
+	_meas_batch = {};
+	_new_sensorReport = true;
+}
+
+void LandingTargetEstimator::_publish_prediction()
+{
+	float x, xvel, y, yvel, covx, covx_v, covy, covy_v;
+	_kalman_filter_x.getState(x, xvel);
+	_kalman_filter_x.getCovariance(covx, covx_v);
+
+	_kalman_filter_y.getState(y, yvel);
+	_kalman_filter_y.getCovariance(covy, covy_v);
+
+	_target_pose.timestamp = _last_predict;
+	_target_pose.x_rel = x;
+	_target_pose.y_rel = y;
+	_target_pose.vx_rel = xvel;
+	_target_pose.vy_rel = yvel;
+
+	_target_pose.cov_x_rel = covx;
+	_target_pose.cov_y_rel = covy;
+
+	_target_pose.cov_vx_rel = covx_v;
+	_target_pose.cov_vy_rel = covy_v;
+
+	if (_vehicleLocalPosition_valid && _vehicleLocalPosition.xy_valid) {
+		_target_pose.x_abs = x + _vehicleLocalPosition.x;
+		_target_pose.y_abs = y + _vehicleLocalPosition.y;
+		_target_pose.abs_pos_valid = true;
+
+	} else {
+		_target_pose.abs_pos_valid = false;
+	}
+
+	_targetPosePub.publish(_target_pose);
+}
+
 void LandingTargetEstimator::_update_params()
 {
 	param_get(_paramHandle.acc_unc, &_params.acc_unc);
@@ -293,6 +359,8 @@ void LandingTargetEstimator::_update_params()
 	param_get(_paramHandle.mode, &mode);
 	_params.mode = (TargetMode)mode;
 
+	param_get(_paramHandle.fuse_dec, &_params.fuse_dec);
+
 	param_get(_paramHandle.scale_x, &_params.scale_x);
 	param_get(_paramHandle.scale_y, &_params.scale_y);
 
@@ -120,6 +120,7 @@ private:
 		param_t pos_unc_init;
 		param_t vel_unc_init;
 		param_t mode;
+		param_t fuse_dec;
 		param_t scale_x;
 		param_t scale_y;
 		param_t offset_x;
@@ -134,6 +135,7 @@ private:
 		float pos_unc_init;
 		float vel_unc_init;
 		TargetMode mode;
+		int32_t fuse_dec;
 		float scale_x;
 		float scale_y;
 		float offset_x;
@@ -149,6 +151,17 @@ private:
 		float rel_pos_z;
 	} _target_position_report;
 
+	/* accumulator for decimated fusion: sensor frames are averaged here and
+	 * handed to the filter as one measurement every LTEST_FUSE_DEC frames */
+	struct {
+		hrt_abstime timestamp;
+		float rel_pos_x;
+		float rel_pos_y;
+		float rel_pos_z;
+		float dist_z_sq;
+		uint8_t count;
+	} _meas_batch {};
+
 	uORB::Subscription _vehicleLocalPositionSub{ORB_ID(vehicle_local_position)};
 	uORB::Subscription _attitudeSub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription _vehicle_acceleration_sub{ORB_ID(vehicle_acceleration)};
@@ -180,9 +193,20 @@ private:
 	hrt_abstime _last_predict{0}; // timestamp of last filter prediction
 	hrt_abstime _last_update{0}; // timestamp of last filter update (used to check timeout)
 	float _dist_z{1.0f};
+	float _meas_unc_factor{1.0f}; // scale of the fused measurement variance (dist_z^2 / batch size)
 
 	void _check_params(const bool force);
 
+	/*
+	 * Average the batched sensor frames into one measurement report.
+	 */
+	void _flush_meas_batch();
+
+	/*
+	 * Re-publish the predicted target pose in between fused updates.
+	 */
+	void _publish_prediction();
+
 	void _update_state();
 };
 } // namespace landing_target_estimator
@@ -155,6 +155,24 @@ PARAM_DEFINE_FLOAT(LTEST_SCALE_Y, 1.0f);
  */
 PARAM_DEFINE_INT32(LTEST_SENS_ROT, 2);
 
+/**
+ * Measurement fusion decimation
+ *
+ * Number of sensor frames that are averaged into one Kalman filter update.
+ * With a high frame-rate vision pipeline this cuts the estimator CPU load by
+ * the decimation factor while the averaged measurement keeps the information
+ * of the individual frames (the measurement variance is scaled by 1/N).
+ * In between fused updates the predicted pose is re-published so consumers
+ * can track at their own rate.
+ *
+ * 1 means every frame is fused individually (previous behaviour).
+ *
+ * @min 1
+ * @max 10
+ * @group Landing target Estimator
+ */
+PARAM_DEFINE_INT32(LTEST_FUSE_DEC, 1);
+
 /**
  * X Position of IRLOCK in body frame (forward)
  *
@@ -58,6 +58,9 @@ LoadMon::LoadMon() :
 LoadMon::~LoadMon()
 {
 	ScheduleClear();
+#if defined(__PX4_NUTTX)
+	cpuload_monitor_stop();
+#endif
 	perf_free(_cycle_perf);
 }
 
@@ -81,6 +84,12 @@ int LoadMon::task_spawn(int argc, char *argv[])
 
 void LoadMon::start()
 {
+#if defined(__PX4_NUTTX)
+	// keep the per-task runtime accounting running continuously so the work
+	// queue breakdown integrates the true runtime instead of sampling it
+	cpuload_monitor_start();
+#endif
+
 	ScheduleOnInterval(500_ms); // 2 Hz
 }
 
@@ -222,7 +231,18 @@ void LoadMon::cpuload()
 	// get ram usage
 	struct mallinfo mem = mallinfo();
 	cpuload.ram_usage = (float)mem.uordblks / mem.arena;
+
+	// heap health: a fragmented heap can fail large allocations long before
+	// ram_usage looks critical, so report the largest contiguous free block too
+	cpuload.ram_largest_free_block = mem.mxordblk;
+
+	if (mem.fordblks > 0) {
+		cpuload.ram_fragmentation = 1.f - (float)mem.mxordblk / (float)mem.fordblks;
+	}
+
 	cpuload.load = 1.f - interval_idletime / interval;
+
+	wq_cpuload(cpuload, interval);
 #endif
 	cpuload.timestamp = hrt_absolute_time();
 
@@ -239,6 +259,76 @@ void LoadMon::cpuload()
 }
 
 #if defined(__PX4_NUTTX)
+void LoadMon::wq_cpuload(cpuload_s &cpuload, const float interval)
+{
+	// per work-queue CPU share: the scheduler hooks maintain the runtime counters
+	// continuously, so this is a plain read of the task table
+	for (int i = 1; i < CONFIG_FS_PROCFS_MAX_TASKS; i++) {
+
+		sched_lock(); // need to lock the tcb access (but make it as short as possible)
+
+		if (!system_load.tasks[i].valid || (system_load.tasks[i].tcb == nullptr)) {
+			sched_unlock();
+			_last_runtime[i] = 0;
+			_last_runtime_pid[i] = -1;
+			continue;
+		}
+
+		const pid_t pid = system_load.tasks[i].tcb->pid;
+		const uint64_t runtime = system_load.tasks[i].total_runtime;
+
+		char name[CONFIG_TASK_NAME_SIZE + 1] {};
+		strncpy(name, system_load.tasks[i].tcb->name, CONFIG_TASK_NAME_SIZE);
+
+		sched_unlock();
+
+		float *share = nullptr;
+
+		if (strncmp(name, "wq:", 3) == 0) {
+			const char *wq_name = &name[3];
+
+			if (strcmp(wq_name, "rate_ctrl") == 0) {
+				share = &cpuload.wq_rate_ctrl;
+
+			} else if (strncmp(wq_name, "INS", 3) == 0) {
+				share = &cpuload.wq_ins;
+
+			} else if (strcmp(wq_name, "nav_and_controllers") == 0) {
+				share = &cpuload.wq_nav_and_controllers;
+
+			} else if (strncmp(wq_name, "SPI", 3) == 0) {
+				share = &cpuload.wq_spi;
+
+			} else if (strncmp(wq_name, "I2C", 3) == 0) {
+				share = &cpuload.wq_i2c;
+
+			} else if (strncmp(wq_name, "tty", 3) == 0) {
+				share = &cpuload.wq_serial;
+
+			} else if (strcmp(wq_name, "uavcan") == 0) {
+				share = &cpuload.wq_uavcan;
+
+			} else if (strcmp(wq_name, "hp_default") == 0) {
+				share = &cpuload.wq_hp_default;
+
+			} else if (strcmp(wq_name, "lp_default") == 0) {
+				share = &cpuload.wq_lp_default;
+
+			} else {
+				share = &cpuload.wq_other;
+			}
+		}
+
+		// only accumulate once a full interval with the same task in this slot has passed
+		if ((share != nullptr) && (_last_runtime_pid[i] == pid) && (runtime >= _last_runtime[i])) {
+			*share += (runtime - _last_runtime[i]) / interval;
+		}
+
+		_last_runtime[i] = runtime;
+		_last_runtime_pid[i] = pid;
+	}
+}
+
 void LoadMon::stack_usage()
 {
 	unsigned stack_free = 0;
@@ -35,6 +35,7 @@
 
 #if defined(__PX4_NUTTX)
 #include <malloc.h>
+#include <string.h>
 #endif
 #include <drivers/drv_hrt.h>
 #include <lib/perf/perf_counter.h>
@@ -86,8 +87,14 @@ private:
 	/* Calculate stack usage */
 	void stack_usage();
 
+	/* Fill in the per work-queue CPU shares from the task runtime counters */
+	void wq_cpuload(cpuload_s &cpuload, const float interval);
+
 	int _stack_task_index{0};
 
+	uint64_t _last_runtime[CONFIG_FS_PROCFS_MAX_TASKS] {};
+	pid_t _last_runtime_pid[CONFIG_FS_PROCFS_MAX_TASKS] {};
+
 	uORB::Publication<task_stack_info_s> _task_stack_info_pub{ORB_ID(task_stack_info)};
 #endif
 	uORB::Publication<cpuload_s> _cpuload_pub {ORB_ID(cpuload)};
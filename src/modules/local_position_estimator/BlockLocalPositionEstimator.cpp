@@ -145,14 +145,6 @@ BlockLocalPositionEstimator::init()
 	return true;
 }
 
-Vector<float, BlockLocalPositionEstimator::n_x> BlockLocalPositionEstimator::dynamics(
-	float t,
-	const Vector<float, BlockLocalPositionEstimator::n_x> &x,
-	const Vector<float, BlockLocalPositionEstimator::n_u> &u)
-{
-	return m_A * x + m_B * u;
-}
-
 void BlockLocalPositionEstimator::Run()
 {
 	if (should_exit()) {
@@ -833,39 +825,11 @@ void BlockLocalPositionEstimator::initSS()
 {
 	initP();
 
-	// dynamics matrix
-	m_A.setZero();
-	// derivative of position is velocity
-	m_A(X_x, X_vx) = 1;
-	m_A(X_y, X_vy) = 1;
-	m_A(X_z, X_vz) = 1;
-
-	// input matrix
-	m_B.setZero();
-	m_B(X_vx, U_ax) = 1;
-	m_B(X_vy, U_ay) = 1;
-	m_B(X_vz, U_az) = 1;
-
-	// update components that depend on current state
-	updateSSStates();
-	updateSSParams();
-}
+	// the dynamics and input matrices are not stored: they are sparse
+	// selectors (position <- velocity, velocity <- input - rotated bias)
+	// and predict() applies them directly
 
-void BlockLocalPositionEstimator::updateSSStates()
-{
-	// derivative of velocity is accelerometer acceleration
-	// (in input matrix) - bias (in body frame)
-	m_A(X_vx, X_bx) = -_R_att(0, 0);
-	m_A(X_vx, X_by) = -_R_att(0, 1);
-	m_A(X_vx, X_bz) = -_R_att(0, 2);
-
-	m_A(X_vy, X_bx) = -_R_att(1, 0);
-	m_A(X_vy, X_by) = -_R_att(1, 1);
-	m_A(X_vy, X_bz) = -_R_att(1, 2);
-
-	m_A(X_vz, X_bx) = -_R_att(2, 0);
-	m_A(X_vz, X_by) = -_R_att(2, 1);
-	m_A(X_vz, X_bz) = -_R_att(2, 2);
+	updateSSParams();
 }
 
 void BlockLocalPositionEstimator::updateSSParams()
@@ -907,24 +871,29 @@ void BlockLocalPositionEstimator::predict(const sensor_combined_s &imu)
 	// get acceleration
 	_R_att = matrix::Dcm<float>(matrix::Quatf(_sub_att.get().q));
 	Vector3f a(imu.accelerometer_m_s2);
-	// note, bias is removed in dynamics function
+	// note, bias is removed below
 	_u = _R_att * a;
 	_u(U_az) += CONSTANTS_ONE_G;	// add g
 
-	// update state space based on new states
-	updateSSStates();
-
 	// continuous time kalman filter prediction
-	// integrate runge kutta 4th order
-	// TODO move rk4 algorithm to matrixlib
-	// https://en.wikipedia.org/wiki/Runge%E2%80%93Kutta_methods
+	// the dynamics are linear with a nilpotent A (A^3 = 0): bias and
+	// terrain are constant over a step, acceleration integrates into
+	// velocity and velocity into position, so the discrete transition
+	// terminates at the h^2 term and is exact; no runge kutta stages or
+	// dense A * x products are needed
 	float h = getDt();
-	Vector<float, n_x> k1, k2, k3, k4;
-	k1 = dynamics(0, _x, _u);
-	k2 = dynamics(h / 2, _x + k1 * h / 2, _u);
-	k3 = dynamics(h / 2, _x + k2 * h / 2, _u);
-	k4 = dynamics(h, _x + k3 * h, _u);
-	Vector<float, n_x> dx = (k1 + k2 * 2 + k3 * 2 + k4) * (h / 6);
+
+	// navigation frame acceleration with the bias removed
+	Vector3f a_n = Vector3f(_u(U_ax), _u(U_ay), _u(U_az))
+		       - _R_att * Vector3f(_x(X_bx), _x(X_by), _x(X_bz));
+
+	Vector<float, n_x> dx;
+	dx(X_x) = _x(X_vx) * h + a_n(0) * h * h / 2;
+	dx(X_y) = _x(X_vy) * h + a_n(1) * h * h / 2;
+	dx(X_z) = _x(X_vz) * h + a_n(2) * h * h / 2;
+	dx(X_vx) = a_n(0) * h;
+	dx(X_vy) = a_n(1) * h;
+	dx(X_vz) = a_n(2) * h;
 
 	// don't integrate position if no valid xy data
 	if (!(_estimatorInitialized & EST_XY))  {
@@ -966,8 +935,30 @@ void BlockLocalPositionEstimator::predict(const sensor_combined_s &imu)
 
 	// propagate
 	_x += dx;
-	Matrix<float, n_x, n_x> dP = (m_A * m_P + m_P * m_A.transpose() +
-				      m_B * m_R * m_B.transpose() + m_Q) * getDt();
+
+	// dP = (A * P + P * A^T + B * R * B^T + Q) * dt, using the sparsity of
+	// A and B: A has identity entries routing velocity into position and
+	// -R_att entries routing bias into velocity, B routes the input noise
+	// onto the velocity diagonal, all other rows are zero
+	Matrix<float, n_x, n_x> AP;
+
+	for (size_t j = 0; j < n_x; j++) {
+		AP(X_x, j) = m_P(X_vx, j);
+		AP(X_y, j) = m_P(X_vy, j);
+		AP(X_z, j) = m_P(X_vz, j);
+
+		for (size_t i = 0; i < 3; i++) {
+			AP(X_vx + i, j) = -(_R_att(i, 0) * m_P(X_bx, j)
+					    + _R_att(i, 1) * m_P(X_by, j)
+					    + _R_att(i, 2) * m_P(X_bz, j));
+		}
+	}
+
+	Matrix<float, n_x, n_x> dP = AP + AP.transpose() + m_Q;
+	dP(X_vx, X_vx) += m_R(U_ax, U_ax);
+	dP(X_vy, X_vy) += m_R(U_ay, U_ay);
+	dP(X_vz, X_vz) += m_R(U_az, U_az);
+	dP *= getDt();
 
 	// covariance propagation logic
 	for (size_t i = 0; i < n_x; i++) {
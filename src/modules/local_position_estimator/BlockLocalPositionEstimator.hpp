@@ -174,13 +174,8 @@ private:
 	// methods
 	// ----------------------------
 	//
-	Vector<float, n_x> dynamics(
-		float t,
-		const Vector<float, n_x> &x,
-		const Vector<float, n_u> &u);
 	void initP();
 	void initSS();
-	void updateSSStates();
 	void updateSSParams();
 
 	// predict the next state
@@ -251,6 +246,82 @@ private:
 	bool landed();
 	int getDelayPeriods(float delay, uint8_t *periods);
 
+	// sparse measurement support
+	// ----------------------------
+	//
+	// every sensor observes only a few states, so the measurement matrices
+	// are mostly zero columns; these helpers take the compact C (n_y x n_obs)
+	// together with the list of observed state indices and touch only the
+	// corresponding rows/columns of P instead of forming the dense
+	// Matrix<float, n_y, n_x> products
+
+	// gather the observed states out of a state vector
+	template<size_t n_obs>
+	Vector<float, n_obs> gatherStates(const Vector<float, n_x> &x, const size_t (&obs)[n_obs]) const
+	{
+		Vector<float, n_obs> xs;
+
+		for (size_t i = 0; i < n_obs; i++) {
+			xs(i) = x(obs[i]);
+		}
+
+		return xs;
+	}
+
+	// residual covariance S = C * P * C^T + R over the observed sub-block of P
+	template<size_t n_y, size_t n_obs>
+	Matrix<float, n_y, n_y> sparseMeasCov(const Matrix<float, n_y, n_obs> &Cs,
+					      const size_t (&obs)[n_obs],
+					      const Matrix<float, n_y, n_y> &R) const
+	{
+		Matrix<float, n_obs, n_obs> Ps;
+
+		for (size_t i = 0; i < n_obs; i++) {
+			for (size_t j = 0; j < n_obs; j++) {
+				Ps(i, j) = m_P(obs[i], obs[j]);
+			}
+		}
+
+		return Cs * Ps * Cs.transpose() + R;
+	}
+
+	// kalman filter correction x += K * r, P -= K * C * P with gain
+	// K = P * C^T * S_I; only the observed columns of P contribute to the
+	// gain and only the observed rows to the covariance decrement
+	template<size_t n_y, size_t n_obs>
+	void sparseCorrect(const Vector<float, n_y> &r,
+			   const Matrix<float, n_y, n_obs> &Cs,
+			   const size_t (&obs)[n_obs],
+			   const Matrix<float, n_y, n_y> &S_I)
+	{
+		Matrix<float, n_x, n_obs> Pc;
+
+		for (size_t i = 0; i < n_x; i++) {
+			for (size_t j = 0; j < n_obs; j++) {
+				Pc(i, j) = m_P(i, obs[j]);
+			}
+		}
+
+		Matrix<float, n_x, n_y> K = Pc * (Cs.transpose() * S_I);
+		_x += K * r;
+
+		Matrix<float, n_y, n_x> CP;
+
+		for (size_t i = 0; i < n_y; i++) {
+			for (size_t k = 0; k < n_x; k++) {
+				float c = 0;
+
+				for (size_t j = 0; j < n_obs; j++) {
+					c += Cs(i, j) * m_P(obs[j], k);
+				}
+
+				CP(i, k) = c;
+			}
+		}
+
+		m_P -= K * CP;
+	}
+
 	// publications
 	void publishLocalPos();
 	void publishGlobalPos();
@@ -394,8 +465,6 @@ private:
 
 	matrix::Dcm<float> _R_att;
 
-	Matrix<float, n_x, n_x>  m_A;	// dynamics matrix
-	Matrix<float, n_x, n_u>  m_B;	// input matrix
 	Matrix<float, n_u, n_u>  m_R;	// input covariance
 	Matrix<float, n_x, n_x>  m_Q;	// process noise covariance
 
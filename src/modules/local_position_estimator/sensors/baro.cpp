@@ -57,10 +57,10 @@ void BlockLocalPositionEstimator::baroCorrect()
 	// subtract baro origin alt
 	y -= _baroAltOrigin;
 
-	// baro measurement matrix
-	Matrix<float, n_y_baro, n_x> C;
-	C.setZero();
-	C(Y_baro_z, X_z) = -1;	// measured altitude, negative down dir.
+	// baro measurement matrix, observes z only
+	const size_t obs[] = {X_z};
+	Matrix<float, n_y_baro, 1> Cs;
+	Cs(Y_baro_z, 0) = -1;	// measured altitude, negative down dir.
 
 	Matrix<float, n_y_baro, n_y_baro> R;
 	R.setZero();
@@ -68,8 +68,8 @@ void BlockLocalPositionEstimator::baroCorrect()
 
 	// residual
 	Matrix<float, n_y_baro, n_y_baro> S_I =
-		inv<float, n_y_baro>((C * m_P * C.transpose()) + R);
-	Vector<float, n_y_baro> r = y - (C * _x);
+		inv<float, n_y_baro>(sparseMeasCov(Cs, obs, R));
+	Vector<float, n_y_baro> r = y - Cs * gatherStates(_x, obs);
 
 	// fault detection
 	float beta = (r.transpose() * (S_I * r))(0, 0);
@@ -87,10 +87,7 @@ void BlockLocalPositionEstimator::baroCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_baro> K = m_P * C.transpose() * S_I;
-	Vector<float, n_x> dx = K * r;
-	_x += dx;
-	m_P -= K * C * m_P;
+	sparseCorrect(r, Cs, obs, S_I);
 }
 
 void BlockLocalPositionEstimator::baroCheckTimeout()
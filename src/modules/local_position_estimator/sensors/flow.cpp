@@ -110,11 +110,11 @@ void BlockLocalPositionEstimator::flowCorrect()
 
 	if (flowMeasure(y) != OK) { return; }
 
-	// flow measurement matrix and noise matrix
-	Matrix<float, n_y_flow, n_x> C;
-	C.setZero();
-	C(Y_flow_vx, X_vx) = 1;
-	C(Y_flow_vy, X_vy) = 1;
+	// flow measurement matrix and noise matrix, observes vx, vy
+	const size_t obs[] = {X_vx, X_vy};
+	Matrix<float, n_y_flow, 2> Cs;
+	Cs(Y_flow_vx, 0) = 1;
+	Cs(Y_flow_vy, 1) = 1;
 
 	SquareMatrix<float, n_y_flow> R;
 	R.setZero();
@@ -164,10 +164,10 @@ void BlockLocalPositionEstimator::flowCorrect()
 	R(Y_flow_vy, Y_flow_vy) = R(Y_flow_vx, Y_flow_vx);
 
 	// residual
-	Vector<float, 2> r = y - C * _x;
+	Vector<float, 2> r = y - Cs * gatherStates(_x, obs);
 
 	// residual covariance
-	Matrix<float, n_y_flow, n_y_flow> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_flow, n_y_flow> S = sparseMeasCov(Cs, obs, R);
 
 	// publish innovations
 	_pub_innov.get().flow[0] = r(0);
@@ -193,11 +193,7 @@ void BlockLocalPositionEstimator::flowCorrect()
 	}
 
 	if (!(_sensorFault & SENSOR_FLOW)) {
-		Matrix<float, n_x, n_y_flow> K =
-			m_P * C.transpose() * S_I;
-		Vector<float, n_x> dx = K * r;
-		_x += dx;
-		m_P -= K * C * m_P;
+		sparseCorrect(r, Cs, obs, S_I);
 	}
 }
 
@@ -130,14 +130,9 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	y(Y_gps_vz) = y_global(Y_gps_vz);
 
 	// gps measurement matrix, measures position and velocity
-	Matrix<float, n_y_gps, n_x> C;
-	C.setZero();
-	C(Y_gps_x, X_x) = 1;
-	C(Y_gps_y, X_y) = 1;
-	C(Y_gps_z, X_z) = 1;
-	C(Y_gps_vx, X_vx) = 1;
-	C(Y_gps_vy, X_vy) = 1;
-	C(Y_gps_vz, X_vz) = 1;
+	const size_t obs[] = {X_x, X_y, X_z, X_vx, X_vy, X_vz};
+	Matrix<float, n_y_gps, n_y_gps> Cs;
+	Cs.setIdentity();
 
 	// gps covariance matrix
 	SquareMatrix<float, n_y_gps> R;
@@ -183,10 +178,10 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	Vector<float, n_x> x0 = _xDelay.get(i_hist);
 
 	// residual
-	Vector<float, n_y_gps> r = y - C * x0;
+	Vector<float, n_y_gps> r = y - Cs * gatherStates(x0, obs);
 
 	// residual covariance
-	Matrix<float, n_y_gps, n_y_gps> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_gps, n_y_gps> S = sparseMeasCov(Cs, obs, R);
 
 	// publish innovations
 	_pub_innov.get().gps_hpos[0] = r(0);
@@ -227,10 +222,7 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	}
 
 	// kalman filter correction always for GPS
-	Matrix<float, n_x, n_y_gps> K = m_P * C.transpose() * S_I;
-	Vector<float, n_x> dx = K * r;
-	_x += dx;
-	m_P -= K * C * m_P;
+	sparseCorrect(r, Cs, obs, S_I);
 }
 
 void BlockLocalPositionEstimator::gpsCheckTimeout()
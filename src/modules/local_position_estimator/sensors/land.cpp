@@ -42,14 +42,14 @@ void BlockLocalPositionEstimator::landCorrect()
 
 	if (landMeasure(y) != OK) { return; }
 
-	// measurement matrix
-	Matrix<float, n_y_land, n_x> C;
-	C.setZero();
+	// measurement matrix, observes vx, vy, z and terrain altitude
+	const size_t obs[] = {X_vx, X_vy, X_z, X_tz};
+	Matrix<float, n_y_land, 4> Cs;
 	// y = -(z - tz)
-	C(Y_land_vx, X_vx) = 1;
-	C(Y_land_vy, X_vy) = 1;
-	C(Y_land_agl, X_z) = -1;// measured altitude, negative down dir.
-	C(Y_land_agl, X_tz) = 1;// measured altitude, negative down dir.
+	Cs(Y_land_vx, 0) = 1;
+	Cs(Y_land_vy, 1) = 1;
+	Cs(Y_land_agl, 2) = -1;	// measured altitude, negative down dir.
+	Cs(Y_land_agl, 3) = 1;	// measured altitude, negative down dir.
 
 	// use parameter covariance
 	SquareMatrix<float, n_y_land> R;
@@ -59,8 +59,8 @@ void BlockLocalPositionEstimator::landCorrect()
 	R(Y_land_agl, Y_land_agl) = _param_lpe_land_z.get() * _param_lpe_land_z.get();
 
 	// residual
-	Matrix<float, n_y_land, n_y_land> S_I = inv<float, n_y_land>((C * m_P * C.transpose()) + R);
-	Vector<float, n_y_land> r = y - C * _x;
+	Matrix<float, n_y_land, n_y_land> S_I = inv<float, n_y_land>(sparseMeasCov(Cs, obs, R));
+	Vector<float, n_y_land> r = y - Cs * gatherStates(_x, obs);
 	_pub_innov.get().hagl = r(Y_land_agl);
 	_pub_innov_var.get().hagl = R(Y_land_agl, Y_land_agl);
 
@@ -85,10 +85,7 @@ void BlockLocalPositionEstimator::landCorrect()
 	}
 
 	// kalman filter correction always for land detector
-	Matrix<float, n_x, n_y_land> K = m_P * C.transpose() * S_I;
-	Vector<float, n_x> dx = K * r;
-	_x += dx;
-	m_P -= K * C * m_P;
+	sparseCorrect(r, Cs, obs, S_I);
 }
 
 void BlockLocalPositionEstimator::landCheckTimeout()
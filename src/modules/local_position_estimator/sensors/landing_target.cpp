@@ -63,13 +63,13 @@ void BlockLocalPositionEstimator::landingTargetCorrect()
 		cov_vy = _param_lpe_lt_cov.get();
 	}
 
-	// target measurement matrix and noise matrix
-	Matrix<float, n_y_target, n_x> C;
-	C.setZero();
+	// target measurement matrix and noise matrix, observes vx, vy
+	const size_t obs[] = {X_vx, X_vy};
+	Matrix<float, n_y_target, 2> Cs;
 	// residual = (y + vehicle velocity)
 	// sign change because target velocitiy is -vehicle velocity
-	C(Y_target_x, X_vx) = -1;
-	C(Y_target_y, X_vy) = -1;
+	Cs(Y_target_x, 0) = -1;
+	Cs(Y_target_y, 1) = -1;
 
 	// covariance matrix
 	SquareMatrix<float, n_y_target> R;
@@ -78,11 +78,11 @@ void BlockLocalPositionEstimator::landingTargetCorrect()
 	R(1, 1) = cov_vy;
 
 	// residual
-	Vector<float, n_y_target> r = y - C * _x;
+	Vector<float, n_y_target> r = y - Cs * gatherStates(_x, obs);
 
 	// residual covariance, (inverse)
 	Matrix<float, n_y_target, n_y_target> S_I =
-		inv<float, n_y_target>(C * m_P * C.transpose() + R);
+		inv<float, n_y_target>(sparseMeasCov(Cs, obs, R));
 
 	// fault detection
 	float beta = (r.transpose()  * (S_I * r))(0, 0);
@@ -102,11 +102,7 @@ void BlockLocalPositionEstimator::landingTargetCorrect()
 	}
 
 	// kalman filter correction
-	Matrix<float, n_x, n_y_target> K =
-		m_P * C.transpose() * S_I;
-	Vector<float, n_x> dx = K * r;
-	_x += dx;
-	m_P -= K * C * m_P;
+	sparseCorrect(r, Cs, obs, S_I);
 
 }
 
@@ -66,13 +66,13 @@ void BlockLocalPositionEstimator::lidarCorrect()
 
 	if (lidarMeasure(y) != OK) { return; }
 
-	// measurement matrix
-	Matrix<float, n_y_lidar, n_x> C;
-	C.setZero();
+	// measurement matrix, observes z and terrain altitude
+	const size_t obs[] = {X_z, X_tz};
+	Matrix<float, n_y_lidar, 2> Cs;
 	// y = -(z - tz)
 	// TODO could add trig to make this an EKF correction
-	C(Y_lidar_z, X_z) = -1;	// measured altitude, negative down dir.
-	C(Y_lidar_z, X_tz) = 1;	// measured altitude, negative down dir.
+	Cs(Y_lidar_z, 0) = -1;	// measured altitude, negative down dir.
+	Cs(Y_lidar_z, 1) = 1;	// measured altitude, negative down dir.
 
 	// use parameter covariance unless sensor provides reasonable value
 	SquareMatrix<float, n_y_lidar> R;
@@ -87,9 +87,9 @@ void BlockLocalPositionEstimator::lidarCorrect()
 	}
 
 	// residual
-	Vector<float, n_y_lidar> r = y - C * _x;
+	Vector<float, n_y_lidar> r = y - Cs * gatherStates(_x, obs);
 	// residual covariance
-	Matrix<float, n_y_lidar, n_y_lidar> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_lidar, n_y_lidar> S = sparseMeasCov(Cs, obs, R);
 
 	// publish innovations
 	_pub_innov.get().hagl = r(0);
@@ -116,10 +116,7 @@ void BlockLocalPositionEstimator::lidarCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_lidar> K = m_P * C.transpose() * S_I;
-	Vector<float, n_x> dx = K * r;
-	_x += dx;
-	m_P -= K * C * m_P;
+	sparseCorrect(r, Cs, obs, S_I);
 }
 
 void BlockLocalPositionEstimator::lidarCheckTimeout()
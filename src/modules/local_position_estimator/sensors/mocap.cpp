@@ -109,11 +109,9 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// mocap measurement matrix, measures position
-	Matrix<float, n_y_mocap, n_x> C;
-	C.setZero();
-	C(Y_mocap_x, X_x) = 1;
-	C(Y_mocap_y, X_y) = 1;
-	C(Y_mocap_z, X_z) = 1;
+	const size_t obs[] = {X_x, X_y, X_z};
+	Matrix<float, n_y_mocap, n_y_mocap> Cs;
+	Cs.setIdentity();
 
 	// noise matrix
 	Matrix<float, n_y_mocap, n_y_mocap> R;
@@ -137,9 +135,9 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// residual
-	Vector<float, n_y_mocap> r = y - C * _x;
+	Vector<float, n_y_mocap> r = y - Cs * gatherStates(_x, obs);
 	// residual covariance
-	Matrix<float, n_y_mocap, n_y_mocap> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_mocap, n_y_mocap> S = sparseMeasCov(Cs, obs, R);
 
 	// publish innovations
 	_pub_innov.get().ev_hpos[0] = r(0);
@@ -175,10 +173,7 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_mocap> K = m_P * C.transpose() * S_I;
-	Vector<float, n_x> dx = K * r;
-	_x += dx;
-	m_P -= K * C * m_P;
+	sparseCorrect(r, Cs, obs, S_I);
 }
 
 void BlockLocalPositionEstimator::mocapCheckTimeout()
@@ -93,13 +93,13 @@ void BlockLocalPositionEstimator::sonarCorrect()
 		cov = _param_lpe_snr_z.get() * _param_lpe_snr_z.get();
 	}
 
-	// sonar measurement matrix and noise matrix
-	Matrix<float, n_y_sonar, n_x> C;
-	C.setZero();
+	// sonar measurement matrix and noise matrix, observes z and terrain altitude
+	const size_t obs[] = {X_z, X_tz};
+	Matrix<float, n_y_sonar, 2> Cs;
 	// y = -(z - tz)
 	// TODO could add trig to make this an EKF correction
-	C(Y_sonar_z, X_z) = -1;	// measured altitude, negative down dir.
-	C(Y_sonar_z, X_tz) = 1;	// measured altitude, negative down dir.
+	Cs(Y_sonar_z, 0) = -1;	// measured altitude, negative down dir.
+	Cs(Y_sonar_z, 1) = 1;	// measured altitude, negative down dir.
 
 	// covariance matrix
 	SquareMatrix<float, n_y_sonar> R;
@@ -107,9 +107,9 @@ void BlockLocalPositionEstimator::sonarCorrect()
 	R(0, 0) = cov;
 
 	// residual
-	Vector<float, n_y_sonar> r = y - C * _x;
+	Vector<float, n_y_sonar> r = y - Cs * gatherStates(_x, obs);
 	// residual covariance
-	Matrix<float, n_y_sonar, n_y_sonar> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_sonar, n_y_sonar> S = sparseMeasCov(Cs, obs, R);
 
 	// publish innovations
 	_pub_innov.get().hagl = r(0);
@@ -137,11 +137,7 @@ void BlockLocalPositionEstimator::sonarCorrect()
 
 	// kalman filter correction if no fault
 	if (!(_sensorFault & SENSOR_SONAR)) {
-		Matrix<float, n_x, n_y_sonar> K =
-			m_P * C.transpose() * S_I;
-		Vector<float, n_x> dx = K * r;
-		_x += dx;
-		m_P -= K * C * m_P;
+		sparseCorrect(r, Cs, obs, S_I);
 	}
 }
 
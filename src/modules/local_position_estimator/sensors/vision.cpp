@@ -114,11 +114,9 @@ void BlockLocalPositionEstimator::visionCorrect()
 	}
 
 	// vision measurement matrix, measures position
-	Matrix<float, n_y_vision, n_x> C;
-	C.setZero();
-	C(Y_vision_x, X_x) = 1;
-	C(Y_vision_y, X_y) = 1;
-	C(Y_vision_z, X_z) = 1;
+	const size_t obs[] = {X_x, X_y, X_z};
+	Matrix<float, n_y_vision, n_y_vision> Cs;
+	Cs.setIdentity();
 
 	// noise matrix
 	Matrix<float, n_y_vision, n_y_vision> R;
@@ -154,14 +152,14 @@ void BlockLocalPositionEstimator::visionCorrect()
 	Vector<float, n_x> x0 = _xDelay.get(i_hist);
 
 	// residual
-	Matrix<float, n_y_vision, 1> r = y - C * x0;
+	Vector<float, n_y_vision> r = y - Cs * gatherStates(x0, obs);
 	// residual covariance
-	Matrix<float, n_y_vision, n_y_vision> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_vision, n_y_vision> S = sparseMeasCov(Cs, obs, R);
 
 	// publish innovations
-	_pub_innov.get().ev_hpos[0] = r(0, 0);
-	_pub_innov.get().ev_hpos[1] = r(1, 0);
-	_pub_innov.get().ev_vpos    = r(2, 0);
+	_pub_innov.get().ev_hpos[0] = r(0);
+	_pub_innov.get().ev_hpos[1] = r(1);
+	_pub_innov.get().ev_vpos    = r(2);
 	_pub_innov.get().ev_hvel[0] = NAN;
 	_pub_innov.get().ev_hvel[1] = NAN;
 	_pub_innov.get().ev_vvel    = NAN;
@@ -193,10 +191,7 @@ void BlockLocalPositionEstimator::visionCorrect()
 
 	// kalman filter correction if no fault
 	if (!(_sensorFault & SENSOR_VISION)) {
-		Matrix<float, n_x, n_y_vision> K = m_P * C.transpose() * S_I;
-		Vector<float, n_x> dx = K * r;
-		_x += dx;
-		m_P -= K * C * m_P;
+		sparseCorrect(r, Cs, obs, S_I);
 	}
 }
 
@@ -157,6 +157,24 @@ public:
 		if (_log_writer_mavlink) { _log_writer_mavlink->set_need_reliable_transfer(need_reliable); }
 	}
 
+	/**
+	 * Enable compression of data section messages for the full file log.
+	 * The mavlink backend is not affected. Must be called before start_log_file().
+	 */
+	void set_file_compression(bool enabled)
+	{
+		if (_log_writer_file) { _log_writer_file->set_compression(enabled); }
+	}
+
+	/**
+	 * Preallocate the full log file to this size when it is created (0 = disabled).
+	 * Must be called before start_log_file().
+	 */
+	void set_file_preallocate(size_t bytes)
+	{
+		if (_log_writer_file) { _log_writer_file->set_preallocate(bytes); }
+	}
+
 	bool need_reliable_transfer() const
 	{
 		if (_log_writer_file) { return _log_writer_file->need_reliable_transfer(); }
@@ -38,6 +38,7 @@
 #include <string.h>
 #include <errno.h>
 
+#include <lzss/lzss.h>
 #include <mathlib/mathlib.h>
 #include <px4_platform_common/posix.h>
 #include <px4_platform_common/crypto.h>
@@ -58,9 +59,11 @@ constexpr size_t LogWriterFile::_min_write_chunk;
 LogWriterFile::LogWriterFile(size_t buffer_size)
 	: _buffers{
 	//We always write larger chunks (orb messages) to the buffer, so the buffer
-	//needs to be larger than the minimum write chunk (300 is somewhat arbitrary)
+	//needs to be larger than the minimum write chunk (300 is somewhat arbitrary).
+	//Rounded up to a sector multiple so that wrap-around chunks keep the file
+	//writes sector-aligned (see run()).
 	{
-		math::max(buffer_size, _min_write_chunk + 300),
+		(math::max(buffer_size, _min_write_chunk + 300) + _sector_size - 1) & ~(_sector_size - 1),
 		perf_alloc(PC_ELAPSED, "logger_sd_write"), perf_alloc(PC_ELAPSED, "logger_sd_fsync")},
 
 	{
@@ -81,6 +84,33 @@ LogWriterFile::~LogWriterFile()
 {
 	pthread_mutex_destroy(&_mtx);
 	pthread_cond_destroy(&_cv);
+
+	free(_compress_in);
+	free(_compress_out);
+	free(_compress_hash);
+}
+
+void LogWriterFile::set_compression(bool enabled)
+{
+	if (enabled && _compress_in == nullptr) {
+		_compress_in = (uint8_t *)malloc(_compress_chunk_size);
+		_compress_out = (uint8_t *)malloc(sizeof(ulog_message_compressed_chunk_s) + _compress_chunk_size);
+		_compress_hash = (uint16_t *)malloc(lzss::HASH_TABLE_ENTRIES * sizeof(uint16_t));
+
+		if (_compress_in == nullptr || _compress_out == nullptr || _compress_hash == nullptr) {
+			PX4_ERR("Can't allocate log compression buffers");
+			free(_compress_in);
+			free(_compress_out);
+			free(_compress_hash);
+			_compress_in = nullptr;
+			_compress_out = nullptr;
+			_compress_hash = nullptr;
+			enabled = false;
+		}
+	}
+
+	_compress_enabled = enabled;
+	_compress_in_len = 0;
 }
 
 #if defined(PX4_CRYPTO)
@@ -246,9 +276,13 @@ void LogWriterFile::start_log(LogType type, const char *filename)
 		return;
 	}
 
+	_encrypted_ahead[(int)type] = 0;
 #endif
 
-	if (_buffers[(int)type].start_log(filename)) {
+	// only preallocate the full log: the mission log is small and written immediately
+	const size_t preallocate_bytes = (type == LogType::Full) ? _preallocate_bytes : 0;
+
+	if (_buffers[(int)type].start_log(filename, preallocate_bytes)) {
 		PX4_INFO("Opened %s log file: %s", log_type_str(type), filename);
 		notify();
 	}
@@ -288,6 +322,11 @@ int LogWriterFile::hardfault_store_filename(const char *log_file)
 
 void LogWriterFile::stop_log(LogType type)
 {
+	if (type == LogType::Full && _compress_in_len > 0) {
+		// best effort: if the write buffer is full, the remaining chunk is dropped
+		flush_compressed_chunk();
+	}
+
 	lock();
 	_buffers[(int)type]._should_run = false;
 	unlock();
@@ -359,21 +398,30 @@ void LogWriterFile::run()
 			break;
 		}
 
-		int poll_count = 0;
-		hrt_abstime last_fsync = hrt_absolute_time();
-
-		pthread_mutex_lock(&_mtx);
+		int poll_count[(int)LogType::Count] {};
+		hrt_abstime last_fsync[(int)LogType::Count];
+		last_fsync[0] = last_fsync[1] = hrt_absolute_time();
 
 		while (true) {
 
 			const hrt_abstime now = hrt_absolute_time();
 
-			/* call fsync periodically to minimize potential loss of data */
-			const bool call_fsync = ++poll_count >= 100 || now - last_fsync > 1_s;
-
-			if (call_fsync) {
-				last_fsync = now;
-				poll_count = 0;
+			/* call fsync periodically to minimize potential loss of data. At most one
+			 * file is synced per cycle: when both logs are active the syncs alternate,
+			 * so that the two files do not both force a seek on the card in the same
+			 * cycle (the file whose turn it is not stays due and syncs next cycle) */
+			bool call_fsync[(int)LogType::Count];
+			bool fsync_granted = false;
+
+			for (int t = 0; t < (int)LogType::Count; ++t) {
+				const bool fsync_due = ++poll_count[t] >= 100 || now - last_fsync[t] > 1_s;
+				call_fsync[t] = fsync_due && !fsync_granted;
+
+				if (call_fsync[t]) {
+					fsync_granted = true;
+					last_fsync[t] = now;
+					poll_count[t] = 0;
+				}
 			}
 
 			constexpr size_t min_available[(int)LogType::Count] = {
@@ -391,56 +439,79 @@ void LogWriterFile::run()
 				size_t available = buffer.get_read_ptr(&read_ptr, &is_part);
 
 #if defined(PX4_CRYPTO)
-				// Split into min blocksize chunks, so it is good for encrypting in pieces
-				available = (available / _min_blocksize) * _min_blocksize;
-#endif
-
-				/* if sufficient data available or partial read or terminating, write data */
-				if (available >= min_available[i] || is_part || (!buffer._should_run && available > 0)) {
-					pthread_mutex_unlock(&_mtx);
 
-#if defined(PX4_CRYPTO)
-					/* This makes the following assumptions:
-					 * - the chipher size is always the
-					     same as the input size
-					 * - the encryption can be done in
-					     place. This is always taken care
-					     by the px4 crypto interfaces
+				if (_algorithm != CRYPTO_NONE) {
+					/* Encrypt new data in place ahead of the write threshold, in min
+					 * blocksize multiples (cipher size == input size and in-place
+					 * operation are guaranteed by the px4 crypto interfaces). The
+					 * cipher runs in the gaps while the card is still busy from the
+					 * previous write or no write is due yet, so a due write can be
+					 * issued immediately instead of encrypting the whole chunk first.
 					 */
+					const size_t to_encrypt = ((available - _encrypted_ahead[i]) / _min_blocksize) * _min_blocksize;
 
-					size_t out = available;
+					if (to_encrypt > 0) {
+						uint8_t *encrypt_ptr = (uint8_t *)read_ptr + _encrypted_ahead[i];
+						size_t out = to_encrypt;
 
-					if (_algorithm != CRYPTO_NONE) {
-						_crypto.encrypt_data(
-							_key_idx,
-							(uint8_t *)read_ptr,
-							available,
-							(uint8_t *)read_ptr,
-							&out);
+						_crypto.encrypt_data(_key_idx, encrypt_ptr, to_encrypt, encrypt_ptr, &out);
 
-						if (out != available) {
+						if (out != to_encrypt) {
 							PX4_ERR("Encryption output size mismatch, logfile corrupted");
 						}
+
+						_encrypted_ahead[i] += to_encrypt;
 					}
 
+					// only data that is already encrypted may go out
+					available = _encrypted_ahead[i];
+				}
+
 #endif
 
-					int written = buffer.write_to_file(read_ptr, available, call_fsync);
+				// while logging, keep the full log writes sector-aligned so the FAT driver
+				// never does a read-modify-write of a partial sector. The buffer size is a
+				// sector multiple, so wrap-around chunks (is_part) are already aligned. The
+				// final drain after stopping writes whatever remains
+				if (i == (int)LogType::Full && buffer._should_run && !is_part) {
+					available &= ~(_sector_size - 1);
+				}
+
+				// While the full log is also due to write in this cycle, batch up small
+				// mission writes instead of interleaving them, so the card does not seek
+				// between the two files every cycle. The mission buffer is drained once it
+				// is half full, and unconditionally when the mission log is stopping
+				if (i == (int)LogType::Mission && buffer._should_run
+				    && _buffers[(int)LogType::Full].count() >= _min_write_chunk
+				    && available < buffer.buffer_size() / 2) {
+					available = 0;
+					is_part = false;
+				}
+
+				/* if sufficient data available or partial read or terminating, write data */
+				if (available >= min_available[i] || is_part || (!buffer._should_run && available > 0)) {
+
+					int written = buffer.write_to_file(read_ptr, available, call_fsync[i]);
 
 					if (written < 0) {
 						// retry once
 						PX4_ERR("write failed errno:%i (%s), retrying", errno, strerror(errno));
 						px4_usleep(10000); // 10 milliseconds
-						written = buffer.write_to_file(read_ptr, available, call_fsync);
+						written = buffer.write_to_file(read_ptr, available, call_fsync[i]);
 					}
 
-					/* buffer.mark_read() requires _mtx to be locked */
-					pthread_mutex_lock(&_mtx);
-
 					if (written >= 0) {
-						/* subtract bytes written from number in buffer (count -= written) */
+						/* release the written bytes back to the logger thread (count -= written) */
 						buffer.mark_read(written);
 
+#if defined(PX4_CRYPTO)
+
+						if (_algorithm != CRYPTO_NONE) {
+							_encrypted_ahead[i] -= written;
+						}
+
+#endif
+
 						if (!buffer._should_run && written == static_cast<int>(available) && !is_part) {
 							/* Stop only when all data written */
 							buffer.close_file();
@@ -452,10 +523,8 @@ void LogWriterFile::run()
 						buffer.close_file();
 					}
 
-				} else if (call_fsync && buffer._should_run) {
-					pthread_mutex_unlock(&_mtx);
+				} else if (call_fsync[i] && buffer._should_run) {
 					buffer.fsync();
-					pthread_mutex_lock(&_mtx);
 
 				} else if (available == 0 && !buffer._should_run) {
 					buffer.close_file();
@@ -480,23 +549,58 @@ void LogWriterFile::run()
 			}
 
 			/* Wait for a call to notify(), which indicates new data is available.
-			 * Note that at this point there could already be new data available (because of a longer write),
-			 * and calling pthread_cond_wait() will still wait for the next notify(). But this is generally
-			 * not an issue because notify() is called regularly.
-			 * If the logger was switched off in the meantime, do not wait for data, instead run this loop
-			 * once more to write remaining data and close the file. */
-			if (_buffers[0]._should_run || _buffers[1]._should_run) {
+			 * The buffers are filled without holding _mtx, so re-check for data that arrived
+			 * since the drain above under the lock before going to sleep. A publish racing with
+			 * this check at most delays the write until the next notify(), which is called
+			 * regularly.
+			 * If the logger was switched off in the meantime, do not wait for data, instead run
+			 * this loop once more to write remaining data and close the file. */
+			pthread_mutex_lock(&_mtx);
+
+			const bool work_pending = _buffers[(int)LogType::Full].count() >= _min_write_chunk
+						  || _buffers[(int)LogType::Mission].count() > 0
+						  || (!_buffers[0]._should_run && _buffers[0].fd() >= 0)
+						  || (!_buffers[1]._should_run && _buffers[1].fd() >= 0);
+
+			if (!work_pending && !_exit_thread.load()) {
 				pthread_cond_wait(&_cv, &_mtx);
 			}
-		}
 
-		// go back to idle
-		pthread_mutex_unlock(&_mtx);
+			pthread_mutex_unlock(&_mtx);
+		}
 	}
 }
 
 int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start)
 {
+	if (_compress_enabled && type == LogType::Full) {
+		if (!_need_reliable_transfer && !dropout_start && size <= _compress_chunk_size) {
+			if (_compress_in_len + size > _compress_chunk_size) {
+				if (flush_compressed_chunk() != 0) {
+					return -1;
+				}
+			}
+
+			memcpy(_compress_in + _compress_in_len, ptr, size);
+			_compress_in_len += size;
+			return 0;
+		}
+
+		// write out buffered data first so a reliable, oversized or dropout-carrying
+		// message does not overtake the messages already accumulated in the chunk
+		if (_need_reliable_transfer) {
+			while (flush_compressed_chunk() == -1) {
+				unlock();
+				notify();
+				px4_usleep(3000);
+				lock();
+			}
+
+		} else if (flush_compressed_chunk() != 0) {
+			return -1;
+		}
+	}
+
 	if (_need_reliable_transfer) {
 		int ret;
 
@@ -563,6 +667,39 @@ int LogWriterFile::write(LogType type, void *ptr, size_t size, uint64_t dropout_
 	return 0;
 }
 
+int LogWriterFile::flush_compressed_chunk()
+{
+	if (_compress_in_len == 0) {
+		return 0;
+	}
+
+	ulog_message_compressed_chunk_s *chunk = reinterpret_cast<ulog_message_compressed_chunk_s *>(_compress_out);
+	uint8_t *chunk_data = _compress_out + sizeof(*chunk);
+
+	// only wrap the chunk if compression is a net gain, otherwise write the
+	// accumulated messages as-is (they are complete, plain ulog messages)
+	const size_t compressed = lzss::compress(_compress_in, _compress_in_len, chunk_data,
+				 _compress_in_len - 1, _compress_hash);
+
+	int ret;
+
+	if (compressed == 0) {
+		ret = write(LogType::Full, _compress_in, _compress_in_len, 0);
+
+	} else {
+		chunk->msg_size = sizeof(chunk->uncompressed_size) + compressed;
+		chunk->msg_type = static_cast<uint8_t>(ULogMessageType::COMPRESSED_DATA);
+		chunk->uncompressed_size = _compress_in_len;
+		ret = write(LogType::Full, chunk, sizeof(*chunk) + compressed, 0);
+	}
+
+	if (ret == 0) {
+		_compress_in_len = 0;
+	}
+
+	return ret;
+}
+
 const char *log_type_str(LogType type)
 {
 	switch (type) {
@@ -614,28 +751,31 @@ void LogWriterFile::LogFileBuffer::write_no_check(void *ptr, size_t size)
 
 	memcpy(&(_buffer[_head]), &(buffer_c[n]), p);
 	_head = (_head + p) % _buffer_size;
-	_count += size;
+	// publish the data to the writer thread only after it is fully copied in
+	_count.fetch_add(size);
 }
 
 size_t LogWriterFile::LogFileBuffer::get_read_ptr(void **ptr, bool *is_part)
 {
-	// bytes available to read
-	int read_ptr = _head - _count;
+	// bytes available to read: _count is only incremented after the data is in place,
+	// so everything from _read_pos up to _read_pos + count is safe to read while the
+	// logger thread keeps filling the buffer behind it
+	const size_t count = _count.load();
+
+	*ptr = &_buffer[_read_pos];
 
-	if (read_ptr < 0) {
-		read_ptr += _buffer_size;
-		*ptr = &_buffer[read_ptr];
+	if (_read_pos + count > _buffer_size) {
+		// data wraps around: return the chunk up to the end of the buffer first
 		*is_part = true;
-		return _buffer_size - read_ptr;
+		return _buffer_size - _read_pos;
 
 	} else {
-		*ptr = &_buffer[read_ptr];
 		*is_part = false;
-		return _count;
+		return count;
 	}
 }
 
-bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
+bool LogWriterFile::LogFileBuffer::start_log(const char *filename, size_t preallocate_bytes)
 {
 	_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
 
@@ -644,6 +784,42 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 		return false;
 	}
 
+	_preallocated = 0;
+
+	if (preallocate_bytes > 0) {
+		// reserve the clusters up-front by writing zeros, so the filesystem never
+		// allocates while logging. The unused zero tail is cut off in close_file()
+		constexpr size_t chunk_size = 32 * 1024;
+		uint8_t *zeros = (uint8_t *)calloc(1, chunk_size);
+
+		if (zeros != nullptr) {
+			size_t remaining = preallocate_bytes;
+
+			while (remaining > 0) {
+				const size_t n = math::min(remaining, chunk_size);
+
+				if (::write(_fd, zeros, n) != (ssize_t)n) {
+					PX4_WARN("log preallocation stopped early (%zu of %zu bytes, errno: %d)",
+						 preallocate_bytes - remaining, preallocate_bytes, errno);
+					break;
+				}
+
+				remaining -= n;
+			}
+
+			free(zeros);
+			::fsync(_fd);
+			_preallocated = preallocate_bytes - remaining;
+
+			if (::lseek(_fd, 0, SEEK_SET) != 0) {
+				PX4_ERR("Can't rewind log file %s, errno: %d", filename, errno);
+				::close(_fd);
+				_fd = -1;
+				return false;
+			}
+		}
+	}
+
 	if (_buffer == nullptr) {
 		_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
 
@@ -655,9 +831,13 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 		}
 	}
 
+	strncpy(_filename, filename, sizeof(_filename) - 1);
+	_filename[sizeof(_filename) - 1] = '\0';
+
 	// Clear buffer and counters
 	_head = 0;
-	_count = 0;
+	_read_pos = 0;
+	_count.store(0);
 	_total_written = 0;
 
 	_should_run = true;
@@ -688,9 +868,19 @@ ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t s
 void LogWriterFile::LogFileBuffer::close_file()
 {
 	_head = 0;
-	_count = 0;
+	_read_pos = 0;
+	_count.store(0);
 
 	if (_fd >= 0) {
+		if (_preallocated > _total_written) {
+			// cut off the unused zero tail of the preallocated file
+			if (::ftruncate(_fd, _total_written) != 0) {
+				PX4_WARN("truncating preallocated log file failed (%i)", errno);
+			}
+		}
+
+		_preallocated = 0;
+
 		int res = close(_fd);
 		_fd = -1;
 
@@ -699,7 +889,12 @@ void LogWriterFile::LogFileBuffer::close_file()
 
 		} else {
 			PX4_INFO("closed logfile, bytes written: %zu", _total_written);
+
+			// add the finished file to the log index used by log list requests
+			util::log_index_add(_filename);
 		}
+
+		_filename[0] = '\0';
 	}
 }
 
@@ -33,6 +33,8 @@
 
 #pragma once
 
+#include "util.h"
+
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/atomic.h>
 #include <stdint.h>
@@ -123,6 +125,20 @@ public:
 		_need_reliable_transfer = need_reliable;
 	}
 
+	/**
+	 * Enable or disable LZSS compression of data section messages (LogType::Full only).
+	 * Must be called before start_log(). Allocates the chunk buffers on first use;
+	 * if that fails, compression stays disabled.
+	 */
+	void set_compression(bool enabled);
+
+	/**
+	 * Preallocate the full log file to this size when it is created, so the filesystem
+	 * does not have to allocate clusters while logging. The unused tail is cut off again
+	 * when the file is closed. Must be called before start_log(); 0 disables preallocation.
+	 */
+	void set_preallocate(size_t bytes) { _preallocate_bytes = bytes; }
+
 	bool need_reliable_transfer() const
 	{
 		return _need_reliable_transfer;
@@ -157,9 +173,24 @@ private:
 	 */
 	int write(LogType type, void *ptr, size_t size, uint64_t dropout_start);
 
+	/**
+	 * compress the accumulated chunk and write it to the buffer (or write it as-is
+	 * if it does not compress). On success the chunk is reset.
+	 * @return 0 on success (or empty chunk), -1 if the buffer is full (chunk kept)
+	 */
+	int flush_compressed_chunk();
+
 	/* 512 didn't seem to work properly, 4096 should match the FAT cluster size */
 	static constexpr size_t	_min_write_chunk = 4096;
 
+	/* compress this many bytes of framed messages at a time; matches the write chunk
+	 * so one compressed chunk amortizes into roughly half an SD write */
+	static constexpr size_t	_compress_chunk_size = 4096;
+
+	/* SD cards and the FAT driver work in sectors; keeping the steady-state writes
+	 * multiples of this avoids read-modify-write of partial sectors */
+	static constexpr size_t	_sector_size = 512;
+
 	class LogFileBuffer
 	{
 	public:
@@ -167,7 +198,7 @@ private:
 
 		~LogFileBuffer();
 
-		bool start_log(const char *filename);
+		bool start_log(const char *filename, size_t preallocate_bytes = 0);
 
 		void close_file();
 
@@ -178,7 +209,7 @@ private:
 		 */
 		inline void write_no_check(void *ptr, size_t size);
 
-		size_t available() const { return _buffer_size - _count; }
+		size_t available() const { return _buffer_size - _count.load(); }
 
 		int fd() const { return _fd; }
 
@@ -186,35 +217,60 @@ private:
 
 		inline void fsync() const;
 
-		void mark_read(size_t n) { _count -= n; _total_written += n; }
+		/**
+		 * Release bytes consumed by the writer thread. Must only be called from the
+		 * writer thread; the space becomes available to the logger thread immediately.
+		 */
+		void mark_read(size_t n)
+		{
+			_read_pos = (_read_pos + n) % _buffer_size;
+			_total_written += n;
+			_count.fetch_sub(n);
+		}
 
 		size_t total_written() const { return _total_written; }
 		size_t buffer_size() const { return _buffer_size; }
-		size_t count() const { return _count; }
+		size_t count() const { return _count.load(); }
 
 		bool _should_run = false;
 	private:
 		const size_t _buffer_size;
 		int	_fd = -1;
 		uint8_t *_buffer = nullptr;
-		size_t _head = 0; ///< next position to write to
-		size_t _count = 0; ///< number of bytes in _buffer to be written
+		size_t _head = 0; ///< next position to write to (logger thread only)
+		size_t _read_pos = 0; ///< next position to read from (writer thread only)
+		px4::atomic<size_t> _count{0}; ///< number of bytes in _buffer to be written, incremented by the
+		///< logger thread after the data is in place and decremented by the writer thread
+		///< once written out, so neither thread needs a lock to access the buffer
 		size_t _total_written = 0;
+		size_t _preallocated = 0; ///< preallocated file size, trimmed again in close_file()
+		char _filename[LOG_DIR_LEN] {}; ///< currently open file, for the log index update in close_file()
 		perf_counter_t _perf_write;
 		perf_counter_t _perf_fsync;
 	};
 
 	LogFileBuffer _buffers[(int)LogType::Count];
 
+	/* ulog data section compression (SDLOG_COMPRESS), all accessed from the logger thread only */
+	uint8_t		*_compress_in{nullptr}; ///< accumulates framed messages until a chunk is full
+	uint8_t		*_compress_out{nullptr}; ///< compressed chunk message, ready to write
+	uint16_t	*_compress_hash{nullptr}; ///< match-search scratch for the compressor
+	size_t		_compress_in_len{0};
+	bool		_compress_enabled{false};
+
+	size_t		_preallocate_bytes{0}; ///< @see set_preallocate()
+
 	px4::atomic_bool	_exit_thread{false};
 	bool			_need_reliable_transfer{false};
-	pthread_mutex_t		_mtx;
+	pthread_mutex_t		_mtx; ///< protects _should_run and backs _cv; the buffer data itself is exchanged lock-free
 	pthread_cond_t		_cv;
 	pthread_t _thread = 0;
 #if defined(PX4_CRYPTO)
 	bool init_logfile_encryption(const char *filename);
 	PX4Crypto _crypto;
 	int _min_blocksize;
+	size_t _encrypted_ahead[(int)LogType::Count] {};	///< bytes at the front of each readable region already
+	///< encrypted in place ahead of the writes (writer thread only)
 	px4_crypto_algorithm_t _algorithm;
 	uint8_t _key_idx;
 	uint8_t _exchange_key_idx;
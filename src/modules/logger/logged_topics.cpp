@@ -46,10 +46,10 @@ using namespace px4::logger;
 void LoggedTopics::add_default_topics()
 {
 	add_topic("action_request");
-	add_topic("actuator_armed");
-	add_topic("actuator_controls_0", 50);
-	add_topic("actuator_controls_1", 100);
-	add_topic("actuator_controls_2", 100);
+	add_topic_skip_unchanged("actuator_armed");
+	add_essential_topic("actuator_controls_0", 50);
+	add_essential_topic("actuator_controls_1", 100);
+	add_essential_topic("actuator_controls_2", 100);
 	add_optional_topic("actuator_controls_status_0", 300);
 	add_topic("airspeed", 1000);
 	add_optional_topic("airspeed_validated", 200);
@@ -60,7 +60,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("commander_state");
 	add_topic("cpuload");
 	add_optional_topic("esc_status", 250);
-	add_topic("failure_detector_status", 100);
+	add_topic_skip_unchanged("failure_detector_status", 100);
 	add_optional_topic("follow_target", 500);
 	add_optional_topic("follow_target_estimator", 200);
 	add_optional_topic("follow_target_status", 400);
@@ -69,16 +69,17 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("gps_dump");
 	add_optional_topic("gripper");
 	add_optional_topic("heater_status");
-	add_topic("home_position");
+	add_topic_skip_unchanged("home_position");
 	add_topic("hover_thrust_estimate", 100);
 	add_topic("input_rc", 500);
 	add_optional_topic("internal_combustion_engine_status", 10);
 	add_optional_topic("irlock_report", 1000);
 	add_optional_topic("landing_target_pose", 1000);
+	add_optional_topic("latency_trace");
 	add_optional_topic("magnetometer_bias_estimate", 200);
-	add_topic("manual_control_setpoint", 200);
+	add_essential_topic("manual_control_setpoint", 200);
 	add_topic("manual_control_switches");
-	add_topic("mission_result");
+	add_topic_skip_unchanged("mission_result");
 	add_topic("navigator_mission_item");
 	add_topic("npfg_status", 100);
 	add_topic("offboard_control_mode", 100);
@@ -90,10 +91,10 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("px4io_status");
 	add_topic("radio_status");
 	add_topic("rtl_time_estimate", 1000);
-	add_topic("sensor_combined");
+	add_essential_topic("sensor_combined");
 	add_optional_topic("sensor_correction");
 	add_optional_topic("sensor_gyro_fft", 50);
-	add_topic("sensor_selection");
+	add_topic_skip_unchanged("sensor_selection");
 	add_topic("sensors_status_imu", 200);
 	add_topic("system_power", 500);
 	add_optional_topic("takeoff_status", 1000);
@@ -102,23 +103,23 @@ void LoggedTopics::add_default_topics()
 	add_topic("transponder_report");
 	add_topic("vehicle_acceleration", 50);
 	add_topic("vehicle_air_data", 200);
-	add_topic("vehicle_angular_velocity", 20);
-	add_topic("vehicle_attitude", 50);
-	add_topic("vehicle_attitude_setpoint", 50);
+	add_essential_topic("vehicle_angular_velocity", 20);
+	add_essential_topic("vehicle_attitude", 50);
+	add_essential_topic("vehicle_attitude_setpoint", 50);
 	add_topic("vehicle_command");
 	add_topic("vehicle_command_ack");
 	add_topic("vehicle_constraints", 1000);
-	add_topic("vehicle_control_mode");
+	add_topic_skip_unchanged("vehicle_control_mode");
 	add_topic("vehicle_global_position", 200);
 	add_topic("vehicle_gps_position", 500);
-	add_topic("vehicle_land_detected");
-	add_topic("vehicle_local_position", 100);
-	add_topic("vehicle_local_position_setpoint", 100);
+	add_topic_skip_unchanged("vehicle_land_detected");
+	add_essential_topic("vehicle_local_position", 100);
+	add_essential_topic("vehicle_local_position_setpoint", 100);
 	add_topic("vehicle_magnetometer", 200);
-	add_topic("vehicle_rates_setpoint", 20);
+	add_essential_topic("vehicle_rates_setpoint", 20);
 	add_topic("vehicle_roi", 1000);
-	add_topic("vehicle_status");
-	add_topic("vehicle_status_flags");
+	add_topic_skip_unchanged("vehicle_status");
+	add_topic_skip_unchanged("vehicle_status_flags");
 	add_optional_topic("vtol_vehicle_status", 200);
 	add_topic("wind", 1000);
 
@@ -302,6 +303,8 @@ void LoggedTopics::add_debug_topics()
 	add_topic("debug_vect");
 	add_topic_multi("satellite_info", 1000, 2);
 	add_topic("mag_worker_data");
+	add_topic("orb_statistics"); // published while `uorb top -l` runs
+	add_topic("work_queue_status"); // published while `work_queue top` runs
 	add_topic("sensor_preflight_mag", 500);
 	add_topic("actuator_test", 500);
 }
@@ -470,6 +473,7 @@ bool LoggedTopics::add_topic(const orb_metadata *topic, uint16_t interval_ms, ui
 	sub.interval_ms = interval_ms;
 	sub.instance = instance;
 	sub.id = static_cast<ORB_ID>(topic->o_id);
+	_added_topic_ids.insert(sub.id);
 	return true;
 }
 
@@ -477,41 +481,86 @@ bool LoggedTopics::add_topic(const char *name, uint16_t interval_ms, uint8_t ins
 {
 	interval_ms /= _rate_factor;
 
-	const orb_metadata *const *topics = orb_get_topics();
-	bool success = false;
+	const orb_metadata *topic = orb_get_topic_meta(name);
 
-	for (size_t i = 0; i < orb_topics_count(); i++) {
-		if (strcmp(name, topics[i]->o_name) == 0) {
-			bool already_added = false;
+	if (topic == nullptr) {
+		return false;
+	}
+
+	const ORB_ID id = static_cast<ORB_ID>(topic->o_id);
 
-			// check if already added: if so, only update the interval
-			for (int j = 0; j < _subscriptions.count; ++j) {
-				if (_subscriptions.sub[j].id == static_cast<ORB_ID>(topics[i]->o_id) &&
-				    _subscriptions.sub[j].instance == instance) {
+	// check if already added: if so, only update the interval. The added-ids set
+	// avoids scanning all requested subscriptions for first-time additions.
+	if (_added_topic_ids.find(id)) {
+		for (int j = 0; j < _subscriptions.count; ++j) {
+			if (_subscriptions.sub[j].id == id && _subscriptions.sub[j].instance == instance) {
 
-					PX4_DEBUG("logging topic %s(%" PRIu8 "), interval: %" PRIu16 ", already added, only setting interval",
-						  topics[i]->o_name, instance, interval_ms);
+				PX4_DEBUG("logging topic %s(%" PRIu8 "), interval: %" PRIu16 ", already added, only setting interval",
+					  topic->o_name, instance, interval_ms);
 
-					_subscriptions.sub[j].interval_ms = interval_ms;
-					success = true;
-					already_added = true;
-					break;
-				}
+				_subscriptions.sub[j].interval_ms = interval_ms;
+				// a plain re-add also overrides skip-unchanged mode, so e.g. the
+				// estimator replay profile gets every sample of a default topic
+				_subscriptions.sub[j].skip_unchanged = false;
+				return true;
 			}
+		}
+	}
 
-			if (!already_added) {
-				success = add_topic(topics[i], interval_ms, instance, optional);
+	bool success = add_topic(topic, interval_ms, instance, optional);
 
-				if (success) {
-					PX4_DEBUG("logging topic: %s(%" PRIu8 "), interval: %" PRIu16, topics[i]->o_name, instance, interval_ms);
-				}
+	if (success) {
+		PX4_DEBUG("logging topic: %s(%" PRIu8 "), interval: %" PRIu16, topic->o_name, instance, interval_ms);
+	}
 
-				break;
+	return success;
+}
+
+LoggedTopics::RequestedSubscription *LoggedTopics::find_subscription(const char *name, uint8_t instance)
+{
+	const orb_metadata *topic = orb_get_topic_meta(name);
+
+	if (topic != nullptr && _added_topic_ids.find(static_cast<ORB_ID>(topic->o_id))) {
+		for (int j = 0; j < _subscriptions.count; ++j) {
+			if (_subscriptions.sub[j].id == static_cast<ORB_ID>(topic->o_id)
+			    && _subscriptions.sub[j].instance == instance) {
+				return &_subscriptions.sub[j];
 			}
 		}
 	}
 
-	return success;
+	return nullptr;
+}
+
+bool LoggedTopics::add_topic_skip_unchanged(const char *name, uint16_t interval_ms, uint8_t instance)
+{
+	if (!add_topic(name, interval_ms, instance)) {
+		return false;
+	}
+
+	// find the subscription again (it might have existed already) and mark it
+	RequestedSubscription *sub = find_subscription(name, instance);
+
+	if (sub != nullptr) {
+		sub->skip_unchanged = true;
+	}
+
+	return true;
+}
+
+bool LoggedTopics::add_essential_topic(const char *name, uint16_t interval_ms, uint8_t instance)
+{
+	if (!add_topic(name, interval_ms, instance)) {
+		return false;
+	}
+
+	RequestedSubscription *sub = find_subscription(name, instance);
+
+	if (sub != nullptr) {
+		sub->essential = true;
+	}
+
+	return true;
 }
 
 bool LoggedTopics::add_topic_multi(const char *name, uint16_t interval_ms, uint8_t max_num_instances, bool optional)
@@ -35,6 +35,7 @@
 
 #include <stdint.h>
 
+#include <uORB/ORBSet.hpp>
 #include <uORB/uORB.h>
 #include <uORB/topics/uORBTopics.hpp>
 
@@ -82,6 +83,8 @@ public:
 	struct RequestedSubscription {
 		uint16_t interval_ms;
 		uint8_t instance;
+		bool skip_unchanged{false}; ///< do not log samples whose payload is unchanged
+		bool essential{false}; ///< never reduce this topic's rate when shedding log bandwidth
 		ORB_ID id{ORB_ID::INVALID};
 	};
 	struct RequestedSubscriptionArray {
@@ -125,6 +128,21 @@ private:
 		return add_topic(name, interval_ms, instance, true);
 	}
 
+	/**
+	 * Add a topic to be logged in skip-unchanged mode: samples whose payload (apart
+	 * from the timestamp) equals the last logged sample are not written to the log.
+	 * For topics that are periodically re-published without changing.
+	 * @return true on success
+	 */
+	bool add_topic_skip_unchanged(const char *name, uint16_t interval_ms = 0, uint8_t instance = 0);
+
+	/**
+	 * Add an essential topic: its rate is never reduced when the logger sheds
+	 * bandwidth because the write buffer runs full (@see Logger::adjust_rate_shedding()).
+	 * @return true on success
+	 */
+	bool add_essential_topic(const char *name, uint16_t interval_ms = 0, uint8_t instance = 0);
+
 	/**
 	 * Add a topic to be logged.
 	 * @param name topic name
@@ -182,7 +200,14 @@ private:
 	 */
 	bool add_topic(const orb_metadata *topic, uint16_t interval_ms = 0, uint8_t instance = 0, bool optional = false);
 
+	/**
+	 * find an already requested subscription by topic name
+	 * @return the subscription or nullptr if not found
+	 */
+	RequestedSubscription *find_subscription(const char *name, uint8_t instance);
+
 	RequestedSubscriptionArray _subscriptions;
+	ORBSet _added_topic_ids; ///< topics with at least one requested subscription (duplicate-check fast path)
 	int _num_mission_subs{0};
 	float _rate_factor{1.0f};
 };
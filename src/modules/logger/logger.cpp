@@ -239,6 +239,43 @@ void Logger::print_statistics(LogType type)
 	stats.high_water = 0;
 	stats.write_dropouts = 0;
 	stats.max_dropout_duration = 0.f;
+
+	if (type == LogType::Full) {
+		if (_shed_level > 0) {
+			PX4_INFO("Rate shedding active: level %u (non-essential topics slowed down)", _shed_level);
+		}
+
+		// print the topics using the most log bandwidth
+		PX4_INFO("Top topics by written bytes:");
+		uint32_t prev_bytes = UINT32_MAX;
+		int prev_idx = -1;
+
+		for (int rank = 0; rank < 5; ++rank) {
+			// select the next topic in (written_bytes, index) descending order, without extra memory
+			int best_idx = -1;
+
+			for (int i = 0; i < _num_subscriptions; ++i) {
+				const uint32_t bytes = _subscriptions[i].written_bytes;
+
+				if (bytes > prev_bytes || (bytes == prev_bytes && i <= prev_idx) || bytes == 0) {
+					continue;
+				}
+
+				if (best_idx < 0 || bytes > _subscriptions[best_idx].written_bytes) {
+					best_idx = i;
+				}
+			}
+
+			if (best_idx < 0) {
+				break;
+			}
+
+			PX4_INFO("  %s: %.1f KiB", _subscriptions[best_idx].get_topic()->o_name,
+				 (double)(_subscriptions[best_idx].written_bytes / 1024.0f));
+			prev_bytes = _subscriptions[best_idx].written_bytes;
+			prev_idx = best_idx;
+		}
+	}
 }
 
 Logger *Logger::instantiate(int argc, char *argv[])
@@ -403,7 +440,18 @@ Logger::~Logger()
 	}
 
 	delete[](_msg_buffer);
+
+	if (_subscriptions) {
+		for (int i = 0; i < _num_subscriptions; ++i) {
+			free(_subscriptions[i].last_logged_data);
+		}
+	}
+
 	delete[](_subscriptions);
+
+	for (int i = 0; i < (int)LogType::Count; ++i) {
+		free(_format_blob[i]);
+	}
 }
 
 void Logger::update_params()
@@ -463,6 +511,27 @@ bool Logger::copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe)
 		}
 	}
 
+	if (updated && sub.skip_unchanged) {
+		// only log the sample if the payload changed since the last logged one. The leading
+		// timestamp is excluded from the comparison, since it updates on every re-publication
+		static constexpr size_t timestamp_size = sizeof(uint64_t);
+		const size_t compare_size = sub.get_topic()->o_size_no_padding - timestamp_size;
+		uint8_t *payload = static_cast<uint8_t *>(buffer) + timestamp_size;
+
+		if (sub.last_logged_data == nullptr) {
+			sub.last_logged_data = malloc(compare_size);
+		}
+
+		if (sub.last_logged_data != nullptr) { // if the allocation failed, log every sample
+			if (memcmp(sub.last_logged_data, payload, compare_size) == 0) {
+				updated = false;
+
+			} else {
+				memcpy(sub.last_logged_data, payload, compare_size);
+			}
+		}
+	}
+
 	return updated;
 }
 
@@ -549,6 +618,9 @@ bool Logger::initialize_topics()
 		for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
 			const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
 			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance);
+			_subscriptions[i].skip_unchanged = sub.skip_unchanged;
+			_subscriptions[i].essential = sub.essential;
+			_subscriptions[i].base_interval_us = sub.interval_ms * 1000;
 			_subscriptions[i].subscribe();
 		}
 	}
@@ -579,6 +651,11 @@ void Logger::run()
 					   _file_name[(int)LogType::Full].sess_dir_index) == 1) {
 			return;
 		}
+
+		// build the log index for list requests once, it is updated incrementally afterwards
+		if (!util::log_index_exists()) {
+			util::log_index_rebuild();
+		}
 	}
 
 	uORB::Subscription parameter_update_sub(ORB_ID(parameter_update));
@@ -625,6 +702,14 @@ void Logger::run()
 		}
 	}
 
+	// pre-serialize the format definition sections now, so that an arming-triggered
+	// log start only writes finished blocks and the first samples are not delayed
+	precompute_formats(LogType::Full);
+
+	if (_num_mission_subs > 0) {
+		precompute_formats(LogType::Mission);
+	}
+
 
 	if (!_writer.init()) {
 		PX4_ERR("writer init failed");
@@ -762,6 +847,7 @@ void Logger::run()
 
 					// full log
 					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+						sub.written_bytes += msg_size;
 
 #ifdef DBGPRINT
 						total_bytes += msg_size;
@@ -837,6 +923,8 @@ void Logger::run()
 				}
 			}
 
+			adjust_rate_shedding(loop_time);
+
 			publish_logger_status();
 
 			/* release the log buffer */
@@ -1072,6 +1160,59 @@ void Logger::adjust_subscription_updates()
 	}
 }
 
+void Logger::adjust_rate_shedding(const hrt_abstime &now)
+{
+	if (!_writer.is_started(LogType::Full, LogWriter::BackendFile)) {
+		return;
+	}
+
+	const size_t buffer_size = _writer.get_buffer_size_file(LogType::Full);
+	const size_t fill_count = _writer.get_buffer_fill_count_file(LogType::Full);
+
+	uint8_t new_level = _shed_level;
+
+	if (fill_count > buffer_size * 3 / 4) {
+		// raise at most one level per second, so the reduced rates have a
+		// chance to take effect before escalating further
+		if (_shed_level < 3 && now - _last_shed_change > 1_s) {
+			new_level = _shed_level + 1;
+		}
+
+	} else if (fill_count < buffer_size / 4) {
+		// require a sustained low fill state before restoring rates
+		if (_shed_level > 0 && now - _last_shed_change > 10_s) {
+			new_level = _shed_level - 1;
+		}
+	}
+
+	if (new_level == _shed_level) {
+		return;
+	}
+
+	if (new_level > _shed_level) {
+		PX4_WARN("write buffer running full, shedding log rates (level %u)", new_level);
+	}
+
+	_shed_level = new_level;
+	_last_shed_change = now;
+
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		LoggerSubscription &sub = _subscriptions[i];
+
+		if (sub.essential) {
+			continue;
+		}
+
+		if (_shed_level == 0) {
+			sub.set_interval_us(sub.base_interval_us);
+
+		} else {
+			// slow non-essential topics down to at most 40 Hz, halved per level
+			sub.set_interval_us(math::max(sub.base_interval_us, (uint32_t)25_ms) << (_shed_level - 1));
+		}
+	}
+}
+
 bool Logger::get_disable_boot_logging()
 {
 	if (_param_sdlog_boot_bat.get()) {
@@ -1403,6 +1544,31 @@ void Logger::start_log_file(LogType type)
 		_param_sdlog_crypto_exchange_key.get());
 #endif
 
+	if (type == LogType::Full) {
+		_writer.set_file_compression(_param_sdlog_compress.get());
+		_writer.set_file_preallocate((size_t)_param_sdlog_prealloc.get() * 1024 * 1024);
+	}
+
+	// forget the skip-unchanged state so each topic's first sample goes into the new file,
+	// and restart the per-topic bandwidth accounting
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		free(_subscriptions[i].last_logged_data);
+		_subscriptions[i].last_logged_data = nullptr;
+		_subscriptions[i].written_bytes = 0;
+	}
+
+	if (type == LogType::Full && _shed_level > 0) {
+		// restore the configured rates, a new log starts without shedding
+		_shed_level = 0;
+		_last_shed_change = 0;
+
+		for (int i = 0; i < _num_subscriptions; ++i) {
+			if (!_subscriptions[i].essential) {
+				_subscriptions[i].set_interval_us(_subscriptions[i].base_interval_us);
+			}
+		}
+	}
+
 	_writer.start_log_file(type, file_name);
 	_writer.select_write_backend(LogWriter::BackendFile);
 	_writer.set_need_reliable_transfer(true);
@@ -1461,6 +1627,13 @@ void Logger::start_log_mavlink()
 	// initialize cpu load as early as possible to get more data
 	initialize_load_output(PrintLoadReason::Preflight);
 
+	// forget the skip-unchanged state so each topic's first sample goes into the new stream
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		free(_subscriptions[i].last_logged_data);
+		_subscriptions[i].last_logged_data = nullptr;
+		_subscriptions[i].written_bytes = 0;
+	}
+
 	PX4_INFO("Start mavlink log");
 
 	_writer.start_log_mavlink();
@@ -1679,7 +1852,14 @@ void Logger::write_format(LogType type, const orb_metadata &meta, WrittenFormats
 	size_t msg_size = sizeof(msg) - sizeof(msg.format) + format_len;
 	msg.msg_size = msg_size - ULOG_MSG_HEADER_LEN;
 
-	write_message(type, &msg, msg_size);
+	if ((int)type == _format_capture_type) {
+		if (_format_capture_ok) {
+			_format_capture_ok = append_format_message(&msg, msg_size);
+		}
+
+	} else {
+		write_message(type, &msg, msg_size);
+	}
 
 	if (level > 1 && !written_formats.push_back(&meta)) {
 		PX4_ERR("Array too small");
@@ -1746,21 +1926,44 @@ void Logger::write_format(LogType type, const orb_metadata &meta, WrittenFormats
 	}
 }
 
-void Logger::write_formats(LogType type)
+bool Logger::append_format_message(const void *msg, size_t size)
 {
-	_writer.lock();
+	const int type = _format_capture_type;
+	uint8_t *blob = (uint8_t *)realloc(_format_blob[type], _format_blob_size[type] + size);
+
+	if (!blob) {
+		// drop the blob entirely, write_formats() falls back to direct serialization
+		free(_format_blob[type]);
+		_format_blob[type] = nullptr;
+		_format_blob_size[type] = 0;
+		return false;
+	}
+
+	memcpy(blob + _format_blob_size[type], msg, size);
+	_format_blob[type] = blob;
+	_format_blob_size[type] += size;
+	return true;
+}
+
+void Logger::precompute_formats(LogType type)
+{
+	free(_format_blob[(int)type]);
+	_format_blob[(int)type] = nullptr;
+	_format_blob_size[(int)type] = 0;
 
 	// both of these are large and thus we need to be careful in terms of stack size requirements
 	ulog_message_format_s msg;
 	WrittenFormats written_formats;
 
-	// write all subscribed formats
 	int sub_count = _num_subscriptions;
 
 	if (type == LogType::Mission) {
 		sub_count = _num_mission_subs;
 	}
 
+	_format_capture_type = (int)type;
+	_format_capture_ok = true;
+
 	for (int i = 0; i < sub_count; ++i) {
 		const LoggerSubscription &sub = _subscriptions[i];
 		write_format(type, *sub.get_topic(), written_formats, msg, i);
@@ -1768,6 +1971,37 @@ void Logger::write_formats(LogType type)
 
 	write_format(type, *_event_subscription.get_topic(), written_formats, msg, sub_count);
 
+	_format_capture_type = -1;
+}
+
+void Logger::write_formats(LogType type)
+{
+	_writer.lock();
+
+	if (_format_blob[(int)type]) {
+		// the section was pre-serialized at startup, write it in one block
+		write_message(type, _format_blob[(int)type], _format_blob_size[(int)type]);
+
+	} else {
+		// both of these are large and thus we need to be careful in terms of stack size requirements
+		ulog_message_format_s msg;
+		WrittenFormats written_formats;
+
+		// write all subscribed formats
+		int sub_count = _num_subscriptions;
+
+		if (type == LogType::Mission) {
+			sub_count = _num_mission_subs;
+		}
+
+		for (int i = 0; i < sub_count; ++i) {
+			const LoggerSubscription &sub = _subscriptions[i];
+			write_format(type, *sub.get_topic(), written_formats, msg, i);
+		}
+
+		write_format(type, *_event_subscription.get_topic(), written_formats, msg, sub_count);
+	}
+
 	_writer.unlock();
 }
 
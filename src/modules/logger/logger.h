@@ -78,6 +78,11 @@ struct LoggerSubscription : public uORB::SubscriptionInterval {
 	{}
 
 	uint8_t msg_id{MSG_ID_INVALID};
+	bool skip_unchanged{false}; ///< @see LoggedTopics::add_topic_skip_unchanged()
+	bool essential{false}; ///< @see LoggedTopics::add_essential_topic()
+	void *last_logged_data{nullptr}; ///< copy of the last logged payload when skip_unchanged is set
+	uint32_t written_bytes{0}; ///< bytes written to the full log since logging started
+	uint32_t base_interval_us{0}; ///< configured interval, to restore after rate shedding
 };
 
 class Logger : public ModuleBase<Logger>, public ModuleParams
@@ -226,6 +231,16 @@ private:
 			  int subscription_index, int level = 1);
 	void write_formats(LogType type);
 
+	/**
+	 * Serialize the format definition section once into a contiguous blob, so that
+	 * each log start only needs to write the finished block instead of re-serializing
+	 * every topic format. The formats are fixed after initialize_topics().
+	 */
+	void precompute_formats(LogType type);
+
+	/** append one serialized message to the format blob currently being captured */
+	bool append_format_message(const void *msg, size_t size);
+
 	/**
 	 * write performance counters
 	 * @param preflight preflight if true, postflight otherwise
@@ -323,6 +338,14 @@ private:
 
 	void adjust_subscription_updates();
 
+	/**
+	 * Degrade the intervals of non-essential topics when the full log write buffer
+	 * runs full, and restore them once it has drained. This trades log resolution of
+	 * secondary topics for keeping the high-rate control and sensor data gap-free
+	 * on a slow SD card.
+	 */
+	void adjust_rate_shedding(const hrt_abstime &now);
+
 	uint8_t						*_msg_buffer{nullptr};
 	int						_msg_buffer_len{0};
 
@@ -332,8 +355,16 @@ private:
 	bool						_manually_logging_override{false};
 
 	Statistics					_statistics[(int)LogType::Count];
+
+	uint8_t						*_format_blob[(int)LogType::Count] {};	///< pre-serialized format definition sections
+	size_t						_format_blob_size[(int)LogType::Count] {};
+	int						_format_capture_type{-1};	///< LogType while precompute_formats() captures, -1 otherwise
+	bool						_format_capture_ok{false};
 	hrt_abstime					_last_sync_time{0}; ///< last time a sync msg was sent
 
+	uint8_t						_shed_level{0}; ///< current rate shedding level (0 = no shedding)
+	hrt_abstime					_last_shed_change{0}; ///< last time the shedding level changed
+
 	LogMode						_log_mode;
 	const bool					_log_name_timestamp;
 
@@ -380,6 +411,8 @@ private:
 		(ParamInt<px4::params::SDLOG_PROFILE>) _param_sdlog_profile,
 		(ParamInt<px4::params::SDLOG_MISSION>) _param_sdlog_mission,
 		(ParamBool<px4::params::SDLOG_BOOT_BAT>) _param_sdlog_boot_bat,
+		(ParamBool<px4::params::SDLOG_COMPRESS>) _param_sdlog_compress,
+		(ParamInt<px4::params::SDLOG_PREALLOC>) _param_sdlog_prealloc,
 		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid
 #if defined(PX4_CRYPTO)
 		, (ParamInt<px4::params::SDLOG_ALGORITHM>) _param_sdlog_crypto_algorithm,
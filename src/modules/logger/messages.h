@@ -49,6 +49,7 @@ enum class ULogMessageType : uint8_t {
 	LOGGING = 'L',
 	LOGGING_TAGGED = 'C',
 	FLAG_BITS = 'B',
+	COMPRESSED_DATA = 'Z',
 };
 
 
@@ -179,6 +180,24 @@ struct ulog_message_data_s {
 	uint16_t msg_id;
 };
 
+/**
+ * @brief Compressed Data Chunk Message
+ *
+ * Wraps a batch of complete Data section messages, LZSS-compressed as one chunk
+ * (@see src/lib/lzss). Written instead of the plain messages when SDLOG_COMPRESS
+ * is enabled. Each chunk is compressed independently, so a reader can skip a
+ * corrupt chunk and resynchronize at the next message header.
+ *
+ * The uint8_t data[] section with the compressed stream follows after the
+ * uncompressed_size part; its length is msg_size - sizeof(uncompressed_size).
+ */
+struct ulog_message_compressed_chunk_s {
+	uint16_t msg_size; ///< size of message - ULOG_MSG_HEADER_LEN
+	uint8_t msg_type = static_cast<uint8_t>(ULogMessageType::COMPRESSED_DATA);
+
+	uint16_t uncompressed_size; ///< size of the contained messages after decompression
+};
+
 /**
  * @brief Information Message
  *
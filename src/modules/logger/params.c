@@ -166,6 +166,40 @@ PARAM_DEFINE_INT32(SDLOG_PROFILE, 1);
  */
 PARAM_DEFINE_INT32(SDLOG_DIRS_MAX, 0);
 
+/**
+ * Compress the full log file
+ *
+ * If enabled, data section messages of the full log are accumulated into chunks
+ * and LZSS-compressed before they are written to the SD card, trading some CPU
+ * for a considerably reduced card bandwidth. The mission log and log streaming
+ * over MAVLink are not affected.
+ *
+ * Note: the resulting log requires a reader with compressed chunk support
+ * (e.g. the replay module).
+ *
+ * @boolean
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_COMPRESS, 0);
+
+/**
+ * Preallocated size of the full log file
+ *
+ * If greater than 0, the full log file is preallocated to this size when logging
+ * starts, so the filesystem does not have to allocate clusters mid-flight (a
+ * common cause of SD write stalls and log dropouts). The unused part is cut off
+ * again when the log is closed.
+ *
+ * Note: preallocation delays the log start by the time it takes to write this
+ * amount of zeros to the card. Size it to the expected log size of one flight.
+ *
+ * @min 0
+ * @max 1024
+ * @unit MB
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_PREALLOC, 0);
+
 /**
  * Log UUID
  *
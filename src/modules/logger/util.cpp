@@ -34,6 +34,7 @@
 #include "util.h"
 
 #include <dirent.h>
+#include <errno.h>
 #include <sys/stat.h>
 #include <string.h>
 #include <stdlib.h>
@@ -43,6 +44,7 @@
 #include <uORB/topics/sensor_gps.h>
 
 #include <drivers/drv_hrt.h>
+#include <px4_platform_common/defines.h>
 #include <px4_platform_common/events.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/time.h>
@@ -57,6 +59,10 @@
 
 #define GPS_EPOCH_SECS ((time_t)1234567890ULL)
 
+static const char *kLogIndexRoot    = PX4_STORAGEDIR "/log";
+static const char *kLogIndexFile    = PX4_STORAGEDIR "/log/logindex.txt";
+static const char *kLogIndexTmpFile = PX4_STORAGEDIR "/log/logindex.tmp";
+
 typedef decltype(statfs::f_bavail) px4_statfs_buf_f_bavail_t;
 
 namespace px4
@@ -79,10 +85,17 @@ bool get_log_time(struct tm *tt, int utc_offset_sec, bool boot_time)
 	time_t utc_time_sec;
 	bool use_clock_time = true;
 
-	/* Get the latest GPS publication */
+	/* Prefer the PPS-disciplined hrt -> UTC mapping: it is drift-corrected and
+	 * aligned across vehicles to the GPS second */
+	uint64_t utc_time_usec;
 	sensor_gps_s gps_pos;
 
-	if (vehicle_gps_position_sub.copy(&gps_pos)) {
+	if (hrt_utc_time(&utc_time_usec, hrt_absolute_time()) == 0) {
+		utc_time_sec = utc_time_usec / 1e6;
+		use_clock_time = false;
+
+	} else if (vehicle_gps_position_sub.copy(&gps_pos)) {
+		/* Fall back to the latest GPS publication */
 		utc_time_sec = gps_pos.time_utc_usec / 1e6;
 
 		if (gps_pos.fix_type >= 2 && utc_time_sec >= GPS_EPOCH_SECS) {
@@ -222,6 +235,9 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 			break;
 		}
 
+		// keep the log index consistent with the deletion
+		log_index_remove_dir(directory_to_delete);
+
 	} while (true);
 
 
@@ -294,6 +310,160 @@ int remove_directory(const char *dir)
 	return ret;
 }
 
+bool log_index_exists()
+{
+	return file_exist(kLogIndexFile);
+}
+
+int log_index_rebuild()
+{
+	DIR *dp = opendir(kLogIndexRoot);
+
+	if (dp == nullptr) {
+		return -errno;
+	}
+
+	FILE *f = fopen(kLogIndexTmpFile, "w");
+
+	if (!f) {
+		closedir(dp);
+		return -errno;
+	}
+
+	struct dirent *session = nullptr;
+
+	while ((session = readdir(dp))) {
+		if (session->d_name[0] == '.') {
+			continue;
+		}
+
+		char session_path[LOG_DIR_LEN];
+		int n = snprintf(session_path, sizeof(session_path), "%s/%s", kLogIndexRoot, session->d_name);
+
+		struct stat st;
+
+		if (n <= 0 || n >= (int)sizeof(session_path) || stat(session_path, &st) != 0 || !S_ISDIR(st.st_mode)) {
+			continue;
+		}
+
+		DIR *session_dp = opendir(session_path);
+
+		if (session_dp == nullptr) {
+			continue;
+		}
+
+		struct dirent *file = nullptr;
+
+		while ((file = readdir(session_dp))) {
+			if (!strstr(file->d_name, ".ulg") && !strstr(file->d_name, ".px4log")) {
+				continue;
+			}
+
+			char file_path[LOG_DIR_LEN];
+			n = snprintf(file_path, sizeof(file_path), "%s/%s", session_path, file->d_name);
+
+			if (n <= 0 || n >= (int)sizeof(file_path) || stat(file_path, &st) != 0) {
+				continue;
+			}
+
+			time_t date = st.st_mtime;
+
+			// fall back to the sess<i>/log<i> numbering if the filesystem has no valid
+			// time (day per session, minute per flight)
+			if (date <= 60 * 60 * 24) {
+				unsigned session_idx, log_idx;
+
+				if (sscanf(session->d_name, "sess%u", &session_idx) == 1) {
+					date = session_idx * 60 * 60 * 24;
+
+					if (sscanf(file->d_name, "log%u", &log_idx) == 1) {
+						date += log_idx * 60;
+					}
+				}
+			}
+
+			fprintf(f, "%u %u %s\n", (unsigned)date, (unsigned)st.st_size, file_path);
+		}
+
+		closedir(session_dp);
+	}
+
+	closedir(dp);
+	fclose(f);
+
+	if (rename(kLogIndexTmpFile, kLogIndexFile) != 0) {
+		unlink(kLogIndexTmpFile);
+		return -errno;
+	}
+
+	return 0;
+}
+
+int log_index_add(const char *log_file_path)
+{
+	// only full-size logs below the log root are listed
+	if (strncmp(log_file_path, kLogIndexRoot, strlen(kLogIndexRoot)) != 0) {
+		return 0;
+	}
+
+	struct stat st;
+
+	if (stat(log_file_path, &st) != 0) {
+		return -errno;
+	}
+
+	FILE *f = fopen(kLogIndexFile, "a");
+
+	if (!f) {
+		return -errno;
+	}
+
+	fprintf(f, "%u %u %s\n", (unsigned)st.st_mtime, (unsigned)st.st_size, log_file_path);
+	fclose(f);
+
+	return 0;
+}
+
+int log_index_remove_dir(const char *removed_dir)
+{
+	FILE *in = fopen(kLogIndexFile, "r");
+
+	if (!in) {
+		return 0; // no index, nothing to update
+	}
+
+	FILE *out = fopen(kLogIndexTmpFile, "w");
+
+	if (!out) {
+		fclose(in);
+		return -errno;
+	}
+
+	const size_t dir_len = strlen(removed_dir);
+	char line[192];
+	unsigned date, size;
+	char path[160];
+
+	while (fgets(line, sizeof(line), in)) {
+		if (sscanf(line, "%u %u %159s", &date, &size, path) == 3
+		    && strncmp(path, removed_dir, dir_len) == 0 && path[dir_len] == '/') {
+			continue; // below the removed directory
+		}
+
+		fputs(line, out);
+	}
+
+	fclose(in);
+	fclose(out);
+
+	if (rename(kLogIndexTmpFile, kLogIndexFile) != 0) {
+		unlink(kLogIndexTmpFile);
+		return -errno;
+	}
+
+	return 0;
+}
+
 } //namespace util
 } //namespace logger
 } //namespace px4
@@ -84,6 +84,40 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
  */
 bool get_log_time(struct tm *tt, int utc_offset_sec = 0, bool boot_time = false);
 
+/* Persistent log index: one "<date> <size> <path>" line per log file in
+ * <log root>/logindex.txt, kept up to date by the logger so that log list
+ * requests (MavlinkLogHandler) read it sequentially instead of rescanning
+ * the whole log directory tree. All functions operate on the full-size log
+ * root directory, mission log files are ignored. */
+
+/**
+ * check if the log index file exists
+ */
+bool log_index_exists();
+
+/**
+ * Rebuild the log index from a full directory scan. Called once at logger
+ * startup if the index does not exist yet, afterwards it is updated
+ * incrementally.
+ * @return 0 on success, <0 on error
+ */
+int log_index_rebuild();
+
+/**
+ * Append an entry for a newly closed log file. Files outside the log root
+ * directory are ignored.
+ * @param log_file_path full path of the log file
+ * @return 0 on success, <0 on error
+ */
+int log_index_add(const char *log_file_path);
+
+/**
+ * Drop all entries below a removed log directory.
+ * @param removed_dir full path of the removed directory
+ * @return 0 on success, <0 on error
+ */
+int log_index_remove_dir(const char *removed_dir);
+
 } //namespace util
 } //namespace logger
 } //namespace px4
@@ -92,18 +92,13 @@ void MagBiasEstimator::Run()
 				for (auto &reset : _reset_field_estimator) {
 					reset = true;
 				}
-
-				if (_arming_state == vehicle_status_s::ARMING_STATE_ARMED) {
-					ScheduleOnInterval(1_s);
-
-				} else {
-					// restore 50 Hz scheduling
-					ScheduleOnInterval(20_ms);
-				}
 			}
 		}
 	}
 
+	// the estimator only runs while disarmed, otherwise a slow rate is enough to poll the arming state
+	ScheduleOnIntervalAdaptive((_arming_state == vehicle_status_s::ARMING_STATE_ARMED) ? 1_s : 20_ms);
+
 	// only run when disarmed
 	if (_arming_state == vehicle_status_s::ARMING_STATE_ARMED) {
 		return;
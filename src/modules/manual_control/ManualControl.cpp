@@ -34,6 +34,7 @@
 #include "ManualControl.hpp"
 
 #include <px4_platform_common/events.h>
+#include <lib/mathlib/mathlib.h>
 #include <lib/systemlib/mavlink_log.h>
 #include <uORB/topics/commander_state.h>
 #include <uORB/topics/vehicle_command.h>
@@ -143,11 +144,25 @@ void ManualControl::Run()
 	const hrt_abstime now = hrt_absolute_time();
 	_selector.updateValidityOfChosenInput(now);
 
-	for (int i = 0; i < MAX_MANUAL_INPUT_COUNT; i++) {
+	const uint64_t previous_timestamp_sample = _selector.setpoint().timestamp_sample;
+
+	if (_selector.setpoint().valid) {
+		// Fast path: while the chosen input stays valid only its own samples can
+		// change the selection, so only poll that source
 		manual_control_setpoint_s manual_control_input;
 
-		if (_manual_control_setpoint_subs[i].update(&manual_control_input)) {
-			_selector.updateWithNewInputSample(now, manual_control_input, i);
+		if (_manual_control_setpoint_subs[_selector.instance()].update(&manual_control_input)) {
+			_selector.updateWithNewInputSample(now, manual_control_input, _selector.instance());
+		}
+
+	} else {
+		// Re-evaluate all sources on startup and whenever the chosen input timed out
+		for (int i = 0; i < MAX_MANUAL_INPUT_COUNT; i++) {
+			manual_control_setpoint_s manual_control_input;
+
+			if (_manual_control_setpoint_subs[i].update(&manual_control_input)) {
+				_selector.updateWithNewInputSample(now, manual_control_input, i);
+			}
 		}
 	}
 
@@ -289,7 +304,25 @@ void ManualControl::Run()
 		}
 
 		_selector.setpoint().timestamp = now;
-		_manual_control_setpoint_pub.publish(_selector.setpoint());
+
+		const bool sample_fresh = (_selector.setpoint().timestamp_sample != previous_timestamp_sample);
+		const float gap_s = (now - _selector.setpoint().timestamp_sample) / 1e6f;
+
+		if (!sample_fresh && (gap_s < _param_man_extrap_t.get())) {
+			// Bridge a short input dropout by extrapolating the sticks with their
+			// filtered rate of change, so downstream controllers see a continuous
+			// setpoint across the gaps of long-range links. The rate estimate decays
+			// while no new samples arrive, fading the extrapolation out smoothly.
+			manual_control_setpoint_s extrapolated = _selector.setpoint();
+			extrapolated.x = math::constrain(extrapolated.x + _x_diff.diff() * gap_s, -1.f, 1.f);
+			extrapolated.y = math::constrain(extrapolated.y + _y_diff.diff() * gap_s, -1.f, 1.f);
+			extrapolated.z = math::constrain(extrapolated.z + _z_diff.diff() * gap_s, 0.f, 1.f);
+			extrapolated.r = math::constrain(extrapolated.r + _r_diff.diff() * gap_s, -1.f, 1.f);
+			_manual_control_setpoint_pub.publish(extrapolated);
+
+		} else {
+			_manual_control_setpoint_pub.publish(_selector.setpoint());
+		}
 
 		// If it's valid, this should really be valid but better safe than sorry.
 		const int instance = _selector.instance();
@@ -327,8 +360,13 @@ void ManualControl::Run()
 
 	_last_time = now;
 
-	// reschedule timeout
-	ScheduleDelayed(200_ms);
+	// reschedule timeout, shortened while extrapolation needs to fill input gaps
+	if (_selector.setpoint().valid && (_param_man_extrap_t.get() > FLT_EPSILON)) {
+		ScheduleDelayed(20_ms);
+
+	} else {
+		ScheduleDelayed(200_ms);
+	}
 
 	perf_end(_loop_perf);
 }
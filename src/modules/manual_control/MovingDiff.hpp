@@ -57,6 +57,8 @@ public:
 		return _difference_filter.getState();
 	}
 
+	float diff() const { return _difference_filter.getState(); }
+
 	void reset()
 	{
 		_difference_filter.reset(0.f);
@@ -47,3 +47,14 @@ TEST(MovingDiffTest, RcInputContinuous)
 	EXPECT_FLOAT_EQ(_diff.update(2.0f, 1.0f), 1.f); // 2*,1,-1
 	EXPECT_FLOAT_EQ(_diff.update(4.0f, 1.0f), 2.f); // 2,2*,-1
 }
+
+TEST(MovingDiffTest, DiffGetter)
+{
+	MovingDiff _diff;
+	EXPECT_FLOAT_EQ(_diff.diff(), 0.f);
+	_diff.update(0.0f, 1.0f);
+	const float last = _diff.update(3.0f, 1.0f);
+	EXPECT_FLOAT_EQ(_diff.diff(), last);
+	_diff.reset();
+	EXPECT_FLOAT_EQ(_diff.diff(), 0.f);
+}
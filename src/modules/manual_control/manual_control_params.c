@@ -41,3 +41,21 @@
  * @group Manual Control
  */
 PARAM_DEFINE_INT32(MAN_ARM_GESTURE, 1);
+
+/**
+ * Manual control extrapolation horizon
+ *
+ * When the selected input source drops out for less than this time,
+ * the manual control setpoint keeps being published with the sticks
+ * extrapolated from their rate of change, bridging the short gaps
+ * of long-range RC links with a continuous setpoint.
+ *
+ * Set to 0 to publish the last received value unchanged until timeout.
+ *
+ * @min 0.0
+ * @max 0.5
+ * @unit s
+ * @decimal 2
+ * @group Manual Control
+ */
+PARAM_DEFINE_FLOAT(MAN_EXTRAP_T, 0.f);
@@ -68,17 +68,45 @@ int EventBuffer::init()
 void EventBuffer::insert_event(const Event &event)
 {
 	pthread_mutex_lock(&_mutex);
-	_events[_next] = event;
-	_next = (_next + 1) % _capacity;
+
+	int index;
 
 	if (_size < _capacity) {
-		++_size;
+		index = _size++;
+
+	} else {
+		index = victim_index();
 	}
 
+	_events[index] = event;
 	_latest_sequence.store(event.sequence);
 	pthread_mutex_unlock(&_mutex);
 }
 
+int EventBuffer::victim_index() const
+{
+	// Evict the oldest event of the least important external log level
+	// (higher numeric level = less important): informational events are
+	// dropped first, critical ones only once nothing less important is left
+	const uint16_t latest = _latest_sequence.load();
+	int victim = 0;
+	uint8_t victim_level = _events[0].log_levels & 0xF;
+	uint16_t victim_age = latest - _events[0].sequence;
+
+	for (int i = 1; i < _size; ++i) {
+		const uint8_t level = _events[i].log_levels & 0xF;
+		const uint16_t age = latest - _events[i].sequence; // wrap-around safe
+
+		if ((level > victim_level) || (level == victim_level && age > victim_age)) {
+			victim = i;
+			victim_level = level;
+			victim_age = age;
+		}
+	}
+
+	return victim;
+}
+
 uint16_t EventBuffer::get_oldest_sequence_after(uint16_t sequence) const
 {
 	pthread_mutex_lock(&_mutex);
@@ -103,9 +131,7 @@ bool EventBuffer::get_event(uint16_t sequence, Event &event) const
 {
 	pthread_mutex_lock(&_mutex);
 
-	for (int count = 0; count < _size; ++count) {
-		int index = (_next - 1 - count + _size) % _size;
-
+	for (int index = 0; index < _size; ++index) {
 		if (_events[index].sequence == sequence) {
 			event = _events[index];
 			pthread_mutex_unlock(&_mutex);
@@ -128,6 +154,12 @@ int EventBuffer::size() const
 SendProtocol::SendProtocol(EventBuffer &buffer, Mavlink &mavlink)
 	: _buffer(buffer), _latest_sequence(buffer.get_latest_sequence()), _mavlink(mavlink)
 {
+	pthread_mutex_init(&_retransmit_mutex, nullptr);
+}
+
+SendProtocol::~SendProtocol()
+{
+	pthread_mutex_destroy(&_retransmit_mutex);
 }
 
 void SendProtocol::update(const hrt_abstime &now)
@@ -164,6 +196,8 @@ void SendProtocol::update(const hrt_abstime &now)
 		PX4_WARN("Dropped %i events (seq=%i)", num_drops, _latest_sequence);
 	}
 
+	service_retransmissions();
+
 	// Send immediately on startup. This is only needed for SITL to ensure we send the sequence reset flag
 	if (now - _last_current_sequence_sent > current_sequence_interval || _last_current_sequence_sent == 0) {
 		send_current_sequence(now);
@@ -174,19 +208,44 @@ void SendProtocol::handle_request_event(const mavlink_message_t &msg) const
 {
 	mavlink_request_event_t request_event;
 	mavlink_msg_request_event_decode(&msg, &request_event);
-	Event e;
 
-	const uint16_t end_sequence = request_event.last_sequence + 1;
+	// Only queue the request here: it is serviced window-wise from update() on
+	// the sending thread, so a large range does not stall other streams
+	pthread_mutex_lock(&_retransmit_mutex);
+	_retransmit_next = request_event.first_sequence;
+	_retransmit_end = request_event.last_sequence + 1;
+	_retransmit_sysid = msg.sysid;
+	_retransmit_compid = msg.compid;
+	_retransmit_pending = true;
+	pthread_mutex_unlock(&_retransmit_mutex);
+}
+
+void SendProtocol::service_retransmissions()
+{
+	pthread_mutex_lock(&_retransmit_mutex);
+
+	while (_retransmit_pending) {
+		if (_retransmit_next == _retransmit_end) {
+			_retransmit_pending = false;
+			break;
+		}
+
+		// keep a full message worth of tx buffer available for other streams
+		if (_mavlink.get_free_tx_buf() < 2 * (MAVLINK_MSG_ID_EVENT_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES)) {
+			break;
+		}
+
+		const uint16_t sequence = _retransmit_next++;
+		Event e;
 
-	for (uint16_t sequence = request_event.first_sequence; sequence != end_sequence; ++sequence) {
 		if (_buffer.get_event(sequence, e)) {
 			PX4_DEBUG("sending requested event %i", sequence);
 			send_event(e);
 
 		} else {
 			mavlink_response_event_error_t event_error{};
-			event_error.target_system = msg.sysid;
-			event_error.target_component = msg.compid;
+			event_error.target_system = _retransmit_sysid;
+			event_error.target_component = _retransmit_compid;
 			event_error.sequence = sequence;
 			event_error.sequence_oldest_available = _buffer.get_oldest_sequence_after(sequence);
 			event_error.reason = MAV_EVENT_ERROR_REASON_UNAVAILABLE;
@@ -194,21 +253,30 @@ void SendProtocol::handle_request_event(const mavlink_message_t &msg) const
 			mavlink_msg_response_event_error_send_struct(_mavlink.get_channel(), &event_error);
 		}
 	}
+
+	pthread_mutex_unlock(&_retransmit_mutex);
 }
 
 void SendProtocol::send_event(const Event &event) const
 {
-	mavlink_event_t event_msg{};
-	event_msg.event_time_boot_ms = event.timestamp_ms;
-	event_msg.destination_component = MAV_COMP_ID_ALL;
-	event_msg.destination_system = 0;
-	event_msg.id = event.id;
-	event_msg.sequence = event.sequence;
-	event_msg.log_levels = event.log_levels;
-	static_assert(sizeof(event_msg.arguments) >= sizeof(event.arguments), "MAVLink message arguments buffer too small");
-	memcpy(&event_msg.arguments, event.arguments, sizeof(event.arguments));
-	mavlink_msg_event_send_struct(_mavlink.get_channel(), &event_msg);
+	// The payload is identical across retransmits of an event, so the constructed
+	// message is cached and reused while the requested sequence matches. The full
+	// frame cannot be cached, as the framing adds per-channel sequence numbers.
+	if (!_event_msg_cached || _event_msg_cache.sequence != event.sequence) {
+		_event_msg_cache = {};
+		_event_msg_cache.event_time_boot_ms = event.timestamp_ms;
+		_event_msg_cache.destination_component = MAV_COMP_ID_ALL;
+		_event_msg_cache.destination_system = 0;
+		_event_msg_cache.id = event.id;
+		_event_msg_cache.sequence = event.sequence;
+		_event_msg_cache.log_levels = event.log_levels;
+		static_assert(sizeof(_event_msg_cache.arguments) >= sizeof(event.arguments),
+			      "MAVLink message arguments buffer too small");
+		memcpy(&_event_msg_cache.arguments, event.arguments, sizeof(event.arguments));
+		_event_msg_cached = true;
+	}
 
+	mavlink_msg_event_send_struct(_mavlink.get_channel(), &_event_msg_cache);
 }
 
 void SendProtocol::on_gcs_connected()
@@ -84,7 +84,9 @@ public:
 
 	/**
 	 * Insert a new event. It's expect to have a later sequence number than the
-	 * already inserted events.
+	 * already inserted events. When the buffer is full, the oldest event of the
+	 * least important external log level is evicted, so that a burst of
+	 * informational events cannot push out critical ones.
 	 */
 	void insert_event(const Event &event);
 
@@ -92,11 +94,17 @@ public:
 
 	int size() const;
 private:
+
+	/**
+	 * Find the eviction candidate: oldest event of the least important
+	 * external log level. Must be called with the mutex held.
+	 */
+	int victim_index() const;
+
 	::px4::atomic<uint16_t> _latest_sequence{events::initial_event_sequence};
 
-	Event *_events{nullptr}; ///< stored events, ringbuffer
+	Event *_events{nullptr}; ///< stored events, unordered
 	int _capacity;
-	int _next{0}; ///< next element to use
 	int _size{0};
 
 	mutable pthread_mutex_t _mutex;
@@ -110,6 +118,7 @@ class SendProtocol
 {
 public:
 	SendProtocol(EventBuffer &buffer, Mavlink &mavlink);
+	~SendProtocol();
 
 	/**
 	 * Handle sending of new events by checking the event buffer. Should be called
@@ -120,7 +129,9 @@ public:
 
 	/**
 	 * Handle mavlink_request_event_t message. Can be called from another thread than
-	 * the rest of the class and is therefore thread-safe.
+	 * the rest of the class and is therefore thread-safe. The requested range is
+	 * queued and retransmitted window-wise from update(), so a large request cannot
+	 * starve other streams of tx buffer space.
 	 */
 	void handle_request_event(const mavlink_message_t &msg) const;
 
@@ -134,12 +145,30 @@ private:
 	void send_event(const Event &event) const;
 	void send_current_sequence(const hrt_abstime &now);
 
+	/**
+	 * Retransmit a window of a pending request, leaving tx buffer space for
+	 * other streams
+	 */
+	void service_retransmissions();
+
 	static constexpr hrt_abstime current_sequence_interval{3_s};
 
 	EventBuffer &_buffer;
 	uint16_t _latest_sequence;
 	hrt_abstime _last_current_sequence_sent{0};
 	Mavlink &_mavlink;
+
+	// pending bulk retransmission request (newest request wins)
+	mutable uint16_t _retransmit_next{0};
+	mutable uint16_t _retransmit_end{0};
+	mutable uint8_t _retransmit_sysid{0};
+	mutable uint8_t _retransmit_compid{0};
+	mutable bool _retransmit_pending{false};
+	mutable pthread_mutex_t _retransmit_mutex;
+
+	// constructed message cache, reused across retransmits of the same event
+	mutable mavlink_event_t _event_msg_cache{};
+	mutable bool _event_msg_cached{false};
 };
 
 
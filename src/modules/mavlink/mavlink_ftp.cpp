@@ -34,7 +34,7 @@
 /// @file mavlink_ftp.cpp
 ///	@author px4dev, Don Gagne <don@thegagnes.com>
 
-#include <crc32.h>
+#include <px4_platform_common/crc.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <fcntl.h>
@@ -66,6 +66,7 @@ MavlinkFTP::~MavlinkFTP()
 {
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
+	delete[] _read_ahead_buffer;
 }
 
 unsigned
@@ -543,6 +544,7 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 	_session_info.fd = fd;
 	_session_info.file_size = fileSize;
 	_session_info.stream_download = false;
+	_read_ahead_length = 0; // the cache belongs to the previous session
 
 	payload->session = 0;
 	payload->size = sizeof(uint32_t);
@@ -567,19 +569,10 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 		return kErrEOF;
 	}
 
-	PX4_DEBUG("lseek with offset: %ld", payload->offset);
-
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-		_our_errno = errno;
-		PX4_ERR("seek fail: %s", strerror(_our_errno));
-		return kErrFailErrno;
-	}
-
-	int bytes_read = ::read(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_read = _cached_read(payload->offset, &payload->data[0], payload->size);
 
 	if (bytes_read < 0) {
 		// Negative return indicates error other than eof
-		_our_errno = errno;
 		PX4_ERR("read fail %d, %s", bytes_read, strerror(_our_errno));
 		return kErrFailErrno;
 	}
@@ -589,6 +582,61 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 	return kErrNone;
 }
 
+/// @brief Reads from the session file through the read-ahead cache
+int
+MavlinkFTP::_cached_read(uint32_t offset, uint8_t *buf, unsigned len)
+{
+	if (!_read_ahead_buffer) {
+		_read_ahead_buffer = new uint8_t[_read_ahead_size];
+	}
+
+	if (!_read_ahead_buffer) {
+		// allocation failed: fall back to a direct read
+		if (lseek(_session_info.fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		int ret = ::read(_session_info.fd, buf, len);
+
+		if (ret < 0) {
+			_our_errno = errno;
+		}
+
+		return ret;
+	}
+
+	if (offset < _read_ahead_offset || offset >= _read_ahead_offset + _read_ahead_length) {
+		// cache miss: refill with one large read
+		_read_ahead_length = 0;
+
+		if (lseek(_session_info.fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		int ret = ::read(_session_info.fd, _read_ahead_buffer, _read_ahead_size);
+
+		if (ret < 0) {
+			_our_errno = errno;
+			return ret;
+		}
+
+		_read_ahead_offset = offset;
+		_read_ahead_length = ret;
+	}
+
+	const uint32_t cache_pos = offset - _read_ahead_offset;
+	unsigned n = _read_ahead_length - cache_pos;
+
+	if (n > len) {
+		n = len;
+	}
+
+	memcpy(buf, _read_ahead_buffer + cache_pos, n);
+	return n;
+}
+
 /// @brief Responds to a Stream command
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id)
@@ -630,6 +678,7 @@ MavlinkFTP::_workWrite(PayloadHeader *payload)
 	}
 
 	PX4_DEBUG("write %d bytes", payload->size);
+	_read_ahead_length = 0; // the write may touch cached content
 	int bytes_written = ::write(_session_info.fd, &payload->data[0], payload->size);
 
 	if (bytes_written < 0) {
@@ -680,6 +729,7 @@ MavlinkFTP::_workTruncateFile(PayloadHeader *payload)
 	// ensure termination
 	_work_buffer1[_work_buffer1_len - 1] = '\0';
 	payload->size = 0;
+	_read_ahead_length = 0; // the truncated file may be the cached one
 
 	if (!_validatePathIsWritable(_work_buffer1)) {
 		return kErrFailFileProtected;
@@ -942,7 +992,7 @@ MavlinkFTP::_workCalcFileCRC32(PayloadHeader *payload)
 			return kErrFailErrno;
 		}
 
-		checksum = crc32part((uint8_t *)_work_buffer2, bytes_read, checksum);
+		checksum = px4_crc32part((uint8_t *)_work_buffer2, bytes_read, checksum);
 	} while (bytes_read == _work_buffer2_len);
 
 	::close(fd);
@@ -1044,6 +1094,12 @@ void MavlinkFTP::send()
 				delete[] _work_buffer2;
 				_work_buffer2 = nullptr;
 			}
+
+			if (_read_ahead_buffer) {
+				delete[] _read_ahead_buffer;
+				_read_ahead_buffer = nullptr;
+				_read_ahead_length = 0;
+			}
 		}
 
 	} else if (_session_info.fd != -1) {
@@ -1101,14 +1157,7 @@ void MavlinkFTP::send()
 		}
 
 		if (error_code == kErrNone) {
-			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: seek fail");
-			}
-		}
-
-		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+			int bytes_read = _cached_read(_session_info.stream_offset, &payload->data[0], kMaxDataLength);
 
 			if (bytes_read < 0) {
 				// Negative return indicates error other than eof
@@ -1141,8 +1190,16 @@ void MavlinkFTP::send()
 			if (max_bytes_to_send < (get_size() * 2)) {
 				more_data = false;
 
-				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
+				/* perform transfers in 35K chunks on serial links - this is determined
+				 * empirical. On UDP use a larger window, since the per-burst round trip
+				 * to the client otherwise caps the download rate */
+#if defined(MAVLINK_UDP)
+				const unsigned burst_chunk_size = (_mavlink->get_protocol() == Protocol::UDP) ? 140000 : 35000;
+#else
+				const unsigned burst_chunk_size = 35000;
+#endif // MAVLINK_UDP
+
+				if (_session_info.stream_chunk_transmitted > burst_chunk_size) {
 					payload->burst_complete = true;
 					_session_info.stream_download = false;
 					_session_info.stream_chunk_transmitted = 0;
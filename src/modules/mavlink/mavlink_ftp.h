@@ -163,6 +163,14 @@ private:
 	 */
 	bool _ensure_buffers_exist();
 
+	/**
+	 * read from the session file through the read-ahead cache, refilling it with
+	 * one large filesystem read instead of one small read per packet
+	 * @return number of bytes read (can be less than len at the end of the file),
+	 *         or -1 on error (_our_errno is set)
+	 */
+	int _cached_read(uint32_t offset, uint8_t *buf, unsigned len);
+
 	static const char	kDirentFile = 'F';	///< Identifies File returned from List command
 	static const char	kDirentDir = 'D';	///< Identifies Directory returned from List command
 	static const char	kDirentSkip = 'S';	///< Identifies Skipped entry from List command
@@ -198,6 +206,12 @@ private:
 	static constexpr int _work_buffer2_len = 256;
 	hrt_abstime _last_work_buffer_access{0}; ///< timestamp when the buffers were last accessed
 
+	/* read-ahead cache for file downloads (lazily allocated and freed together with the work buffers) */
+	uint8_t *_read_ahead_buffer{nullptr};
+	static constexpr uint32_t _read_ahead_size = 4096;
+	uint32_t _read_ahead_offset{0};	///< file offset of the first cached byte
+	uint32_t _read_ahead_length{0};	///< number of valid bytes in the cache
+
 	// prepend a root directory to each file/dir access to avoid enumerating the full FS tree (e.g. on Linux).
 	// Note that requests can still fall outside of the root dir by using ../..
 #ifdef MAVLINK_FTP_UNIT_TEST
@@ -43,6 +43,7 @@
 #define MOUNTPOINT PX4_STORAGEDIR
 
 static const char *kLogRoot    = MOUNTPOINT "/log";
+static const char *kLogIndex   = MOUNTPOINT "/log/logindex.txt";
 static const char *kLogData    = MOUNTPOINT "/logdata.txt";
 static const char *kTmpData    = MOUNTPOINT "/$log$.txt";
 
@@ -445,6 +446,13 @@ MavlinkLogHandler::_init_list_helper()
 
 	// Remove old log data file (if any)
 	unlink(kLogData);
+
+	// Use the persistent index maintained by the logger if available: a single
+	// sequential read instead of rescanning the whole log directory tree
+	if (_init_from_index()) {
+		return;
+	}
+
 	// Open log directory
 	DIR *dp = opendir(kLogRoot);
 
@@ -490,6 +498,52 @@ MavlinkLogHandler::_init_list_helper()
 	}
 }
 
+//-------------------------------------------------------------------
+bool
+MavlinkLogHandler::_init_from_index()
+{
+	FILE *idx = ::fopen(kLogIndex, "r");
+
+	if (!idx) {
+		return false;
+	}
+
+	// Create work file
+	FILE *f = ::fopen(kTmpData, "w");
+
+	if (!f) {
+		PX4LOG_WARN("MavlinkLogHandler::init Error creating %s", kTmpData);
+		::fclose(idx);
+		return false;
+	}
+
+	// Only copy well formed entries, the logger appends to the index incrementally
+	char line[160];
+	int count = 0;
+
+	while (fgets(line, sizeof(line), idx)) {
+		uint32_t date, size;
+		char file[160];
+
+		if (sscanf(line, "%" PRIu32 " %" PRIu32 " %159s", &date, &size, file) == 3) {
+			fprintf(f, "%u %u %s\n", (unsigned)date, (unsigned)size, file);
+			count++;
+		}
+	}
+
+	::fclose(idx);
+	fclose(f);
+
+	if (count == 0 || rename(kTmpData, kLogData)) {
+		// Fall back to scanning the directory tree
+		unlink(kTmpData);
+		return false;
+	}
+
+	_log_count = count;
+	return true;
+}
+
 //-------------------------------------------------------------------
 bool
 MavlinkLogHandler::_get_session_date(const char *path, const char *dir, time_t &date)
@@ -80,6 +80,7 @@ private:
 
 	void _reset_list_helper();
 	void _init_list_helper();
+	bool _init_from_index();
 	bool _get_session_date(const char *path, const char *dir, time_t &date);
 	void _scan_logs(FILE *f, const char *dir, time_t &date);
 	bool _get_log_time_size(const char *path, const char *file, time_t &date, uint32_t &size);
@@ -79,6 +79,7 @@
 #define FLOW_CONTROL_DISABLE_THRESHOLD 40              ///< picked so that some messages still would fit it.
 #define MAX_DATA_RATE                  10000000        ///< max data rate in bytes/s
 #define MAIN_LOOP_DELAY                10000           ///< 100 Hz @ 1000 bytes/s data rate
+#define MAX_SHELL_DATA_RATE_FACTOR     0.25f           ///< link share the shell/console drain may use at most
 
 static pthread_mutex_t mavlink_module_mutex = PTHREAD_MUTEX_INITIALIZER;
 events::EventBuffer *Mavlink::_event_buffer = nullptr;
@@ -732,8 +733,13 @@ void Mavlink::send_start(int length)
 	pthread_mutex_lock(&_send_mutex);
 	_last_write_try_time = hrt_absolute_time();
 
-	// check if there is space in the buffer
-	if (length > (int)get_free_tx_buf()) {
+	// write out the batched frames first if the new one does not fit anymore
+	if (_buf_fill + length > sizeof(_buf)) {
+		flush_send_buffer_unlocked();
+	}
+
+	// check if there is space in the buffer (including what is already batched)
+	if (length + (int)_buf_fill > (int)get_free_tx_buf()) {
 		// not enough space in buffer to send
 		count_txerrbytes(length);
 
@@ -749,8 +755,30 @@ void Mavlink::send_start(int length)
 
 void Mavlink::send_finish()
 {
-	if (_tx_buffer_low || (_buf_fill == 0)) {
-		pthread_mutex_unlock(&_send_mutex);
+	if (!_tx_buffer_low) {
+		++_buf_msg_count;
+	}
+
+	// the frame stays batched, so a cycle's worth of messages goes out in a single
+	// write: flush_send_buffer() runs at the end of each cycle, and send_start()
+	// flushes early if the next frame does not fit anymore
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::flush_send_buffer()
+{
+	pthread_mutex_lock(&_send_mutex);
+
+	if (_buf_fill > 0) {
+		flush_send_buffer_unlocked();
+	}
+
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::flush_send_buffer_unlocked()
+{
+	if (_buf_fill == 0) {
 		return;
 	}
 
@@ -802,7 +830,7 @@ void Mavlink::send_finish()
 #endif // MAVLINK_UDP
 
 	if (ret == (int)_buf_fill) {
-		_tstatus.tx_message_count++;
+		_tstatus.tx_message_count += _buf_msg_count;
 		count_txbytes(_buf_fill);
 		_last_write_success_time = _last_write_try_time;
 
@@ -811,8 +839,7 @@ void Mavlink::send_finish()
 	}
 
 	_buf_fill = 0;
-
-	pthread_mutex_unlock(&_send_mutex);
+	_buf_msg_count = 0;
 }
 
 void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
@@ -1368,15 +1395,18 @@ void
 Mavlink::update_rate_mult()
 {
 	float const_rate = 0.0f;
-	float rate = 0.0f;
+	float class_rate[MavlinkStream::NUM_PRIORITIES] {};
 
 	/* scale down rates if their theoretical bandwidth is exceeding the link bandwidth */
 	for (const auto &stream : _streams) {
+		const float stream_rate = (stream->get_interval() > 0) ?
+					  stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+
 		if (stream->const_rate()) {
-			const_rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			const_rate += stream_rate;
 
 		} else {
-			rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			class_rate[static_cast<int>(stream->get_priority())] += stream_rate;
 		}
 	}
 
@@ -1386,12 +1416,23 @@ Mavlink::update_rate_mult()
 		mavlink_ulog_streaming_rate_inv = 1.0f - _mavlink_ulog->current_data_rate();
 	}
 
-	/* scale up and down as the link permits */
-	float bandwidth_mult = (float)(_datarate * mavlink_ulog_streaming_rate_inv - const_rate) / rate;
+	/* bandwidth left after the constant-rate streams took their share */
+	float available = (float)(_datarate * mavlink_ulog_streaming_rate_inv) - const_rate;
+
+	/* hand out the remaining bandwidth by priority class: a class is only scaled down
+	 * once all lower-priority classes are already at their minimum rate, so critical
+	 * streams keep their rate on a degraded link while bulk streams back off first */
+	float class_mult[MavlinkStream::NUM_PRIORITIES];
+
+	for (int i = 0; i < MavlinkStream::NUM_PRIORITIES; i++) {
+		if (class_rate[i] > 0.0f) {
+			class_mult[i] = math::constrain(available / class_rate[i], 0.05f, 1.0f);
+
+		} else {
+			class_mult[i] = 1.0f;
+		}
 
-	/* if we do not have flow control, limit to the set data rate */
-	if (!get_flow_control_enabled()) {
-		bandwidth_mult = fminf(1.0f, bandwidth_mult);
+		available -= class_rate[i] * class_mult[i];
 	}
 
 	float hardware_mult = 1.0f;
@@ -1425,11 +1466,13 @@ Mavlink::update_rate_mult()
 		PX4_ERR("instance %d: RADIO_STATUS timeout", _instance_id);
 	}
 
-	/* pick the minimum from bandwidth mult and hardware mult as limit */
-	_rate_mult = fminf(bandwidth_mult, hardware_mult);
+	/* pick the minimum from bandwidth mult and hardware mult as limit, and ensure the
+	 * rate multiplier never drops below 5% so that something is always sent */
+	for (int i = 0; i < MavlinkStream::NUM_PRIORITIES; i++) {
+		_rate_mult_class[i] = math::constrain(fminf(class_mult[i], hardware_mult), 0.05f, 1.0f);
+	}
 
-	/* ensure the rate multiplier never drops below 5% so that something is always sent */
-	_rate_mult = math::constrain(_rate_mult, 0.05f, 1.0f);
+	_rate_mult = _rate_mult_class[static_cast<int>(MavlinkStream::Priority::DEFAULT)];
 }
 
 void
@@ -2430,7 +2473,21 @@ Mavlink::task_main(int argc, char *argv[])
 
 		/* check for shell output */
 		if (_mavlink_shell && _mavlink_shell->available() > 0) {
-			if (get_free_tx_buf() >= MAVLINK_MSG_ID_SERIAL_CONTROL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES) {
+			// Drain the shell in bulk, but rate-capped with a token bucket so a burst
+			// of console output (e.g. dmesg) takes a bounded share of the link and
+			// cannot perturb telemetry timing. Interactive shell usage stays well
+			// below the cap and is sent without delay.
+			static constexpr unsigned shell_frame_size = MAVLINK_MSG_ID_SERIAL_CONTROL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+			const float max_shell_rate = _datarate * MAX_SHELL_DATA_RATE_FACTOR; // bytes/s
+
+			_shell_byte_budget = math::min(_shell_byte_budget + max_shell_rate * (t - _last_shell_drain) * 1e-6f,
+						       max_shell_rate * 0.1f); // allow bursts of up to 100 ms worth
+			_last_shell_drain = t;
+
+			while (_mavlink_shell->available() > 0
+			       && _shell_byte_budget >= (float)shell_frame_size
+			       && get_free_tx_buf() >= shell_frame_size) {
+
 				mavlink_serial_control_t msg;
 				msg.baudrate = 0;
 				msg.flags = SERIAL_CONTROL_FLAG_REPLY;
@@ -2440,14 +2497,18 @@ Mavlink::task_main(int argc, char *argv[])
 				msg.target_system = _mavlink_shell->targetSysid();
 				msg.target_component = _mavlink_shell->targetCompid();
 				mavlink_msg_serial_control_send_struct(get_channel(), &msg);
+
+				_shell_byte_budget -= shell_frame_size;
 			}
 		}
 
 		check_requested_subscriptions();
 
-		/* update streams */
+		/* update streams (only the ones that are due, the update maintains the deadline) */
 		for (const auto &stream : _streams) {
-			stream->update(t);
+			if (stream->update_due(t)) {
+				stream->update(t);
+			}
 
 			if (!_first_heartbeat_sent) {
 				if (_mode == MAVLINK_MODE_IRIDIUM) {
@@ -2585,6 +2646,9 @@ Mavlink::task_main(int argc, char *argv[])
 			publish_telemetry_status();
 		}
 
+		// write out everything the streams batched in this iteration
+		flush_send_buffer();
+
 		perf_end(_loop_perf);
 	}
 
@@ -2972,8 +3036,6 @@ Mavlink::display_status_streams()
 {
 	printf("\t%-20s%-16s %s\n", "Name", "Rate Config (current) [Hz]", "Message Size (if active) [B]");
 
-	const float rate_mult = _rate_mult;
-
 	for (const auto &stream : _streams) {
 		const int interval = stream->get_interval();
 		const unsigned size = stream->get_size();
@@ -2986,7 +3048,7 @@ Mavlink::display_status_streams()
 			float rate = 1000000.0f / (float)interval;
 			// Note that the actual current rate can be lower if the associated uORB topic updates at a
 			// lower rate.
-			float rate_current = stream->const_rate() ? rate : rate * rate_mult;
+			float rate_current = stream->const_rate() ? rate : rate * get_rate_mult(stream->get_priority());
 			snprintf(rate_str, sizeof(rate_str), "%6.2f (%.3f)", (double)rate, (double)rate_current);
 		}
 
@@ -334,10 +334,18 @@ public:
 	void			send_bytes(const uint8_t *buf, unsigned packet_len);
 
 	/**
-	 * Flush the transmit buffer and send one MAVLink packet
+	 * This is the end of a MAVLINK_START_UART_SEND/MAVLINK_END_UART_SEND transaction.
+	 * The frame stays batched in the transmit buffer; it is written out once the buffer
+	 * cannot hold another full-size packet, or on the next flush_send_buffer() call.
 	 */
 	void             	send_finish();
 
+	/**
+	 * Write all batched frames to the link with a single transfer.
+	 * Called at the end of each main loop and receiver poll iteration.
+	 */
+	void			flush_send_buffer();
+
 	/**
 	 * Resend message as is, don't change sequence number and CRC.
 	 */
@@ -406,6 +414,9 @@ public:
 
 	float			get_rate_mult() const { return _rate_mult; }
 
+	float			get_rate_mult(MavlinkStream::Priority priority) const
+	{ return _rate_mult_class[static_cast<int>(priority)]; }
+
 	float			get_baudrate() { return _baudrate; }
 
 	/* Functions for waiting to start transmission until message received. */
@@ -568,6 +579,8 @@ private:
 	List<MavlinkStream *>		_streams;
 
 	MavlinkShell		*_mavlink_shell{nullptr};
+	float			_shell_byte_budget{0.f};	///< token bucket for the rate-capped shell drain [bytes]
+	hrt_abstime		_last_shell_drain{0};		///< last token bucket replenish time
 	MavlinkULog		*_mavlink_ulog{nullptr};
 	static events::EventBuffer	*_event_buffer;
 	events::SendProtocol		_events{*_event_buffer, *this};
@@ -585,6 +598,7 @@ private:
 	int			_baudrate{57600};
 	int			_datarate{1000};		///< data rate for normal streams (attitude, position, etc.)
 	float			_rate_mult{1.0f};
+	float			_rate_mult_class[MavlinkStream::NUM_PRIORITIES] {1.0f, 1.0f, 1.0f}; ///< rate multiplier per priority class
 
 	bool			_radio_status_available{false};
 	bool			_radio_status_critical{false};
@@ -632,8 +646,9 @@ private:
 	unsigned short		_remote_port{DEFAULT_REMOTE_PORT_UDP};
 #endif // MAVLINK_UDP
 
-	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
+	uint8_t			_buf[4 * MAVLINK_MAX_PACKET_LEN] {};	///< frame batching buffer, holds multiple packets per write
 	unsigned		_buf_fill{0};
+	unsigned		_buf_msg_count{0};	///< number of complete frames currently batched in _buf
 
 	bool			_tx_buffer_low{false};
 
@@ -683,6 +698,9 @@ private:
 
 	void			mavlink_update_parameters();
 
+	/** write the batched frames to the link. _send_mutex must be held */
+	void			flush_send_buffer_unlocked();
+
 	int mavlink_open_uart(const int baudrate = DEFAULT_BAUD_RATE,
 			      const char *uart_name = DEFAULT_DEVICE_NAME,
 			      const FLOW_CONTROL_MODE flow_control = FLOW_CONTROL_AUTO);
@@ -956,9 +956,14 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 						DM_KEY_WAYPOINTS_OFFBOARD_0);	// use inactive storage for transmission
 			_transfer_current_seq = -1;
 
-			if (_mission_type == MAV_MISSION_TYPE_FENCE) {
-				// We're about to write new geofence items, so take the lock. It will be released when
-				// switching back to idle
+			if (_mission_type == MAV_MISSION_TYPE_MISSION) {
+				transfer_transaction_begin(sizeof(mission_item_s), wpc.count);
+			}
+
+			if (_mission_type == MAV_MISSION_TYPE_FENCE
+			    && !transfer_transaction_begin(sizeof(mission_fence_point_s), wpc.count)) {
+				// Items go to dataman directly, so take the lock for the whole
+				// transfer. It will be released when switching back to idle
 				PX4_DEBUG("locking fence dataman items");
 
 				int ret = dm_lock(DM_KEY_FENCE_POINTS);
@@ -971,6 +976,10 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 				}
 			}
 
+			if (_mission_type == MAV_MISSION_TYPE_RALLY) {
+				transfer_transaction_begin(sizeof(mission_safe_point_s), wpc.count);
+			}
+
 		} else if (_state == MAVLINK_WPM_STATE_GETLIST) {
 			_time_last_recv = hrt_absolute_time();
 
@@ -1015,9 +1024,96 @@ MavlinkMissionManager::switch_to_idle_state()
 		PX4_DEBUG("unlocking geofence");
 	}
 
+	// same for the staging transaction of an aborted upload
+	transfer_transaction_abort();
+
 	_state = MAVLINK_WPM_STATE_IDLE;
 }
 
+bool
+MavlinkMissionManager::transfer_transaction_begin(size_t item_size, uint16_t count)
+{
+	transfer_transaction_abort();
+
+	if ((size_t)count * item_size > TRANSFER_ARENA_ITEMS * sizeof(mission_item_s)) {
+		// larger than the arena: fall back to writing each item to dataman directly
+		return false;
+	}
+
+	if (_transfer_arena == nullptr) {
+		// one long-lived allocation per channel instead of a new/delete pair per
+		// transfer, so concurrent uploads on several links cannot fragment the heap
+		_transfer_arena = new uint8_t[TRANSFER_ARENA_ITEMS * sizeof(mission_item_s)];
+
+		if (_transfer_arena == nullptr) {
+			PX4_WARN("WPM: no memory to stage %u items", count);
+			return false;
+		}
+	}
+
+	_transfer_staging = _transfer_arena;
+	_transfer_item_size = item_size;
+	return true;
+}
+
+bool
+MavlinkMissionManager::transfer_transaction_commit(dm_item_t dm_id, unsigned first_index)
+{
+	if (_transfer_staging == nullptr) {
+		return true; // the items were already written to dataman directly
+	}
+
+	bool success = true;
+
+	for (uint16_t i = 0; i < _transfer_count; i++) {
+		if (dm_write(dm_id, first_index + i, transfer_staged_item(i),
+			     _transfer_item_size) != (ssize_t)_transfer_item_size) {
+			success = false;
+			break;
+		}
+	}
+
+	transfer_transaction_abort();
+
+	if (!success) {
+		PX4_ERR("WPM: storing staged transfer failed");
+
+		if (_filesystem_errcount++ < FILESYSTEM_ERRCOUNT_NOTIFY_LIMIT) {
+			_mavlink->send_statustext_critical("Mission storage: Unable to write to microSD\t");
+			events::send(events::ID("mavlink_mission_commit_failure"), events::Log::Critical,
+				     "Mission: Unable to write to storage");
+		}
+	}
+
+	return success;
+}
+
+void
+MavlinkMissionManager::transfer_transaction_abort()
+{
+	// the arena itself stays allocated for the next transaction
+	_transfer_staging = nullptr;
+	_transfer_item_size = 0;
+}
+
+bool
+MavlinkMissionManager::validate_mission_item_while_receiving(const mission_item_s &mission_item, uint16_t seq)
+{
+	if (mission_item.nav_cmd == NAV_CMD_DO_JUMP) {
+		// the full mission feasibility check only runs in the navigator once the
+		// complete plan arrived; jump targets can already be validated here
+		if (mission_item.do_jump_mission_index < 0
+		    || mission_item.do_jump_mission_index >= (int32_t)_transfer_count
+		    || mission_item.do_jump_mission_index == (int32_t)seq) {
+			PX4_DEBUG("WPM: MISSION_ITEM seq %u: invalid DO_JUMP target %d", seq,
+				  (int)mission_item.do_jump_mission_index);
+			return false;
+		}
+	}
+
+	return true;
+}
+
 
 void
 MavlinkMissionManager::handle_mission_item(const mavlink_message_t *msg)
@@ -1128,6 +1224,19 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				    mission_item.nav_cmd == MAV_CMD_NAV_RALLY_POINT) {
 					check_failed = true;
 
+				} else if (!validate_mission_item_while_receiving(mission_item, wp.seq)) {
+					check_failed = true;
+
+				} else if (_transfer_staging != nullptr) {
+					// collect the item in RAM, it is committed to dataman with the rest
+					// of the plan once the transfer completed
+					*static_cast<mission_item_s *>(transfer_staged_item(wp.seq)) = mission_item;
+
+					/* waypoint marked as current */
+					if (wp.current) {
+						_transfer_current_seq = wp.seq;
+					}
+
 				} else {
 					dm_item_t dm_item = _transfer_dataman_id;
 
@@ -1157,7 +1266,11 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 					if (mission_item.vertex_count < 3) { // feasibility check
 						PX4_ERR("Fence: too few vertices");
 						check_failed = true;
-						update_geofence_count(0);
+
+						if (_transfer_staging == nullptr) {
+							// earlier items already went to dataman, invalidate the partial fence
+							update_geofence_count(0);
+						}
 					}
 
 				} else {
@@ -1167,8 +1280,13 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				mission_fence_point.frame = mission_item.frame;
 
 				if (!check_failed) {
-					write_failed = dm_write(DM_KEY_FENCE_POINTS, wp.seq + 1, &mission_fence_point,
-								sizeof(mission_fence_point_s)) != sizeof(mission_fence_point_s);
+					if (_transfer_staging != nullptr) {
+						*static_cast<mission_fence_point_s *>(transfer_staged_item(wp.seq)) = mission_fence_point;
+
+					} else {
+						write_failed = dm_write(DM_KEY_FENCE_POINTS, wp.seq + 1, &mission_fence_point,
+									sizeof(mission_fence_point_s)) != sizeof(mission_fence_point_s);
+					}
 				}
 
 			}
@@ -1180,8 +1298,14 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				mission_safe_point.lon = mission_item.lon;
 				mission_safe_point.alt = mission_item.altitude;
 				mission_safe_point.frame = mission_item.frame;
-				write_failed = dm_write(DM_KEY_SAFE_POINTS, wp.seq + 1, &mission_safe_point,
-							sizeof(mission_safe_point_s)) != sizeof(mission_safe_point_s);
+
+				if (_transfer_staging != nullptr) {
+					*static_cast<mission_safe_point_s *>(transfer_staged_item(wp.seq)) = mission_safe_point;
+
+				} else {
+					write_failed = dm_write(DM_KEY_SAFE_POINTS, wp.seq + 1, &mission_safe_point,
+								sizeof(mission_safe_point_s)) != sizeof(mission_safe_point_s);
+				}
 			}
 			break;
 
@@ -1226,15 +1350,48 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 
 			switch (_mission_type) {
 			case MAV_MISSION_TYPE_MISSION:
-				ret = update_active_mission(_transfer_dataman_id, _transfer_count, _transfer_current_seq);
+				if (transfer_transaction_commit(_transfer_dataman_id, 0)) {
+					ret = update_active_mission(_transfer_dataman_id, _transfer_count, _transfer_current_seq);
+
+				} else {
+					ret = PX4_ERROR;
+				}
+
 				break;
 
 			case MAV_MISSION_TYPE_FENCE:
-				ret = update_geofence_count(_transfer_count);
+				if (_transfer_staging != nullptr) {
+					// staged upload: the fence lock is only held while the finished
+					// transaction is committed, not for the whole transfer
+					if (dm_lock(DM_KEY_FENCE_POINTS) == 0) {
+						if (transfer_transaction_commit(DM_KEY_FENCE_POINTS, 1)) {
+							ret = update_geofence_count(_transfer_count);
+
+						} else {
+							ret = PX4_ERROR;
+						}
+
+						dm_unlock(DM_KEY_FENCE_POINTS);
+
+					} else {
+						PX4_ERR("locking failed (%i)", errno);
+						ret = PX4_ERROR;
+					}
+
+				} else {
+					ret = update_geofence_count(_transfer_count);
+				}
+
 				break;
 
 			case MAV_MISSION_TYPE_RALLY:
-				ret = update_safepoint_count(_transfer_count);
+				if (transfer_transaction_commit(DM_KEY_SAFE_POINTS, 1)) {
+					ret = update_safepoint_count(_transfer_count);
+
+				} else {
+					ret = PX4_ERROR;
+				}
+
 				break;
 
 			default:
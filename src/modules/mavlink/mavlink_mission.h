@@ -79,7 +79,7 @@ class MavlinkMissionManager
 public:
 	explicit MavlinkMissionManager(Mavlink *mavlink);
 
-	~MavlinkMissionManager() = default;
+	~MavlinkMissionManager() { delete[] _transfer_arena; }
 
 	/**
 	 * Handle sending of messages. Call this regularly at a fixed frequency.
@@ -121,6 +121,11 @@ private:
 
 	int32_t			_transfer_current_seq{-1};		///< Current item ID for current transmission (-1 means not initialized)
 
+	uint8_t			*_transfer_staging{nullptr};		///< item storage of the active staging transaction inside _transfer_arena (nullptr: items are written to dataman directly)
+	uint16_t		_transfer_item_size{0};			///< size of one staged item of the active transaction
+
+	uint8_t			*_transfer_arena{nullptr};		///< per-channel staging arena, allocated once on first upload and kept for the life of the channel
+
 	uint8_t			_transfer_partner_sysid{0};		///< Partner system ID for current transmission
 	uint8_t			_transfer_partner_compid{0};		///< Partner component ID for current transmission
 
@@ -147,6 +152,10 @@ private:
 	};	/**< Maximum number of mission items for each type
 					(fence & safe points use the first item for the stats) */
 
+	static constexpr uint16_t	TRANSFER_ARENA_ITEMS = (NUM_MISSIONS_SUPPORTED < 600) ? NUM_MISSIONS_SUPPORTED :
+			600;	/**< capacity of the staging arena in mission items; larger
+					uploads fall back to direct dataman writes */
+
 	/** get the maximum number of item count for the current _mission_type */
 	uint16_t current_max_item_count();
 
@@ -222,6 +231,38 @@ private:
 
 	void handle_mission_clear_all(const mavlink_message_t *msg);
 
+	/**
+	 * Begin a staging transaction on the per-channel arena. Received items are
+	 * collected in RAM and committed to dataman in one go when the transfer
+	 * completed, so the transfer never waits for storage between items and
+	 * concurrent uploads on several links do not churn the heap. The arena is
+	 * allocated once on first use and reused by all later transactions.
+	 * @return true if items are staged, false to fall back to direct dataman writes
+	 */
+	bool transfer_transaction_begin(size_t item_size, uint16_t count);
+
+	/** item storage of the active staging transaction (valid for seq < _transfer_count) */
+	void *transfer_staged_item(uint16_t seq) { return _transfer_staging + seq * _transfer_item_size; }
+
+	/**
+	 * Write all staged items of the transaction to dataman and end the transaction.
+	 * @param dm_id destination dataman storage
+	 * @param first_index dataman index of the first item (1 for fence & safe points, the stats live at 0)
+	 * @return true on success (or if nothing was staged)
+	 */
+	bool transfer_transaction_commit(dm_item_t dm_id, unsigned first_index);
+
+	/** end the transaction without touching dataman (transfer completed or aborted) */
+	void transfer_transaction_abort();
+
+	/**
+	 * Per-item feasibility checks that do not need vehicle state, run while the
+	 * upload is still in progress so a structurally broken plan aborts the
+	 * transfer at the offending item instead of after the complete upload.
+	 * @return true if the item passes
+	 */
+	bool validate_mission_item_while_receiving(const mission_item_s &mission_item, uint16_t seq);
+
 	/**
 	 * Parse mavlink MISSION_ITEM message to get mission_item_s.
 	 *
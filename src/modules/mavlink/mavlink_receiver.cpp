@@ -278,6 +278,10 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 		handle_message_statustext(msg);
 		break;
 
+	case MAVLINK_MSG_ID_TERRAIN_DATA:
+		handle_message_terrain_data(msg);
+		break;
+
 #if !defined(CONSTRAINED_FLASH)
 
 	case MAVLINK_MSG_ID_NAMED_VALUE_FLOAT:
@@ -1988,6 +1992,23 @@ MavlinkReceiver::handle_message_tunnel(mavlink_message_t *msg)
 
 }
 
+void
+MavlinkReceiver::handle_message_terrain_data(mavlink_message_t *msg)
+{
+	mavlink_terrain_data_t terrain_data;
+	mavlink_msg_terrain_data_decode(msg, &terrain_data);
+
+	// gridbit selects the 4x4 block within the 8x7 block area anchored at lat/lon
+	const double lat_spacing_deg = terrain_data.grid_spacing / 111320.0;
+	const double lon_spacing_deg = lat_spacing_deg / cos(math::radians(terrain_data.lat * 1e-7));
+
+	const double lat_sw = terrain_data.lat * 1e-7 + (terrain_data.gridbit / 8) * 4 * lat_spacing_deg;
+	const double lon_sw = terrain_data.lon * 1e-7 + (terrain_data.gridbit % 8) * 4 * lon_spacing_deg;
+
+	// merge the 4x4 block into the onboard tile store
+	_terrain_cache.store(lat_sw, lon_sw, terrain_data.grid_spacing, terrain_data.data);
+}
+
 void
 MavlinkReceiver::handle_message_trajectory_representation_bezier(mavlink_message_t *msg)
 {
@@ -3147,6 +3168,48 @@ MavlinkReceiver::handle_message_gimbal_device_attitude_status(mavlink_message_t
 	_gimbal_device_attitude_status_pub.publish(gimbal_attitude_status);
 }
 
+void
+MavlinkReceiver::process_rx_message_queue()
+{
+	for (unsigned i = 0; i < _rx_message_queue_count; ++i) {
+		mavlink_message_t *msg = &_rx_message_queue[i];
+
+		/* handle generic messages and commands */
+		handle_message(msg);
+
+		/* handle packet with mission manager */
+		_mission_manager.handle_message(msg);
+
+		/* handle packet with parameter component */
+		if (_mavlink->boot_complete()) {
+			// make sure mavlink app has booted before we start processing parameter sync
+			_parameters_manager.handle_message(msg);
+
+		} else {
+			if (hrt_elapsed_time(&_mavlink->get_first_start_time()) > 20_s) {
+				PX4_ERR("system boot did not complete in 20 seconds");
+				_mavlink->set_boot_complete();
+			}
+		}
+
+		if (_mavlink->ftp_enabled()) {
+			/* handle packet with ftp component */
+			_mavlink_ftp.handle_message(msg);
+		}
+
+		/* handle packet with log component */
+		_mavlink_log_handler.handle_message(msg);
+
+		/* handle packet with timesync component, with its arrival timestamp */
+		_mavlink_timesync.handle_message(msg, _rx_message_queue_arrival_time[i]);
+
+		/* handle packet with parent object */
+		_mavlink->handle_message(msg);
+	}
+
+	_rx_message_queue_count = 0;
+}
+
 void
 MavlinkReceiver::run()
 {
@@ -3191,6 +3254,7 @@ MavlinkReceiver::run()
 #endif // MAVLINK_UDP
 
 	ssize_t nread = 0;
+	hrt_abstime rx_arrival_time = 0;
 	hrt_abstime last_send_update = 0;
 
 	while (!_mavlink->should_exit()) {
@@ -3212,6 +3276,10 @@ MavlinkReceiver::run()
 				/* non-blocking read. read may return negative values */
 				nread = ::read(fds[0].fd, buf, sizeof(buf));
 
+				/* timestamp the chunk right at arrival, so parse and handler latency
+				 * does not bias receive-time-sensitive consumers (timesync) */
+				rx_arrival_time = hrt_absolute_time();
+
 				if (nread == -1 && errno == ENOTCONN) { // Not connected (can happen for USB)
 					usleep(100000);
 				}
@@ -3222,6 +3290,7 @@ MavlinkReceiver::run()
 			else if (_mavlink->get_protocol() == Protocol::UDP) {
 				if (fds[0].revents & POLLIN) {
 					nread = recvfrom(_mavlink->get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
+					rx_arrival_time = hrt_absolute_time();
 				}
 
 				struct sockaddr_in &srcaddr_last = _mavlink->get_client_source_address();
@@ -3262,38 +3331,16 @@ MavlinkReceiver::run()
 							_mavlink->set_proto_version(2);
 						}
 
-						/* handle generic messages and commands */
-						handle_message(&msg);
+						/* only decode and queue here: the handlers run once the whole chunk
+						 * is parsed, so a slow handler (e.g. FTP filesystem access) does not
+						 * sit between back-to-back messages of a high-rate burst */
+						_rx_message_queue_arrival_time[_rx_message_queue_count] = rx_arrival_time;
+						_rx_message_queue[_rx_message_queue_count++] = msg;
 
-						/* handle packet with mission manager */
-						_mission_manager.handle_message(&msg);
-
-						/* handle packet with parameter component */
-						if (_mavlink->boot_complete()) {
-							// make sure mavlink app has booted before we start processing parameter sync
-							_parameters_manager.handle_message(&msg);
-
-						} else {
-							if (hrt_elapsed_time(&_mavlink->get_first_start_time()) > 20_s) {
-								PX4_ERR("system boot did not complete in 20 seconds");
-								_mavlink->set_boot_complete();
-							}
+						if (_rx_message_queue_count == RX_MESSAGE_QUEUE_SIZE) {
+							process_rx_message_queue();
 						}
 
-						if (_mavlink->ftp_enabled()) {
-							/* handle packet with ftp component */
-							_mavlink_ftp.handle_message(&msg);
-						}
-
-						/* handle packet with log component */
-						_mavlink_log_handler.handle_message(&msg);
-
-						/* handle packet with timesync component */
-						_mavlink_timesync.handle_message(&msg);
-
-						/* handle packet with parent object */
-						_mavlink->handle_message(&msg);
-
 						update_rx_stats(msg);
 
 						if (_message_statistics_enabled) {
@@ -3302,6 +3349,9 @@ MavlinkReceiver::run()
 					}
 				}
 
+				/* run the handlers on everything decoded from this chunk */
+				process_rx_message_queue();
+
 				/* count received bytes (nread will be -1 on read error) */
 				if (nread > 0) {
 					_mavlink->count_rxbytes(nread);
@@ -3357,6 +3407,9 @@ MavlinkReceiver::run()
 		if (_tune_publisher != nullptr) {
 			_tune_publisher->publish_next_tune(t);
 		}
+
+		// write out the replies batched in this iteration
+		_mavlink->flush_send_buffer();
 	}
 }
 
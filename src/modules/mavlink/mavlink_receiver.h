@@ -53,6 +53,7 @@
 
 #include <geo/geo.h>
 #include <lib/drivers/accelerometer/PX4Accelerometer.hpp>
+#include <lib/terrain/TerrainCache.hpp>
 #include <lib/drivers/gyroscope/PX4Gyroscope.hpp>
 #include <lib/drivers/magnetometer/PX4Magnetometer.hpp>
 #include <lib/systemlib/mavlink_log.h>
@@ -195,6 +196,7 @@ private:
 	void handle_message_set_position_target_global_int(mavlink_message_t *msg);
 	void handle_message_set_position_target_local_ned(mavlink_message_t *msg);
 	void handle_message_statustext(mavlink_message_t *msg);
+	void handle_message_terrain_data(mavlink_message_t *msg);
 	void handle_message_tunnel(mavlink_message_t *msg);
 	void handle_message_trajectory_representation_bezier(mavlink_message_t *msg);
 	void handle_message_trajectory_representation_waypoints(mavlink_message_t *msg);
@@ -237,6 +239,12 @@ private:
 	void update_message_statistics(const mavlink_message_t &message);
 	void update_rx_stats(const mavlink_message_t &message);
 
+	/**
+	 * Run all message handlers on the queued messages. Called once a received
+	 * chunk is fully parsed, so the parse stage never waits on handler logic.
+	 */
+	void process_rx_message_queue();
+
 	px4::atomic_bool 	_should_exit{false};
 	pthread_t		_thread {};
 	/**
@@ -252,9 +260,15 @@ private:
 	MavlinkParametersManager	_parameters_manager;
 	MavlinkTimesync			_mavlink_timesync;
 	MavlinkStatustextHandler	_mavlink_statustext_handler;
+	terrain::TerrainCache		_terrain_cache;
 
 	mavlink_status_t		_status{}; ///< receiver status, used for mavlink_parse_char()
 
+	static constexpr unsigned	RX_MESSAGE_QUEUE_SIZE{8};
+	mavlink_message_t		_rx_message_queue[RX_MESSAGE_QUEUE_SIZE];	///< decoded messages awaiting the handler stage
+	hrt_abstime			_rx_message_queue_arrival_time[RX_MESSAGE_QUEUE_SIZE] {};	///< chunk arrival timestamps of the queued messages
+	unsigned			_rx_message_queue_count{0};
+
 	orb_advert_t _mavlink_log_pub{nullptr};
 
 	static constexpr unsigned MAX_REMOTE_COMPONENTS{16};
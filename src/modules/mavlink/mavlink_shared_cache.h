@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef MAVLINK_SHARED_CACHE_H_
+#define MAVLINK_SHARED_CACHE_H_
+
+#include <pthread.h>
+
+/**
+ * @class MavlinkSharedMessageCache
+ * Message struct cache shared between mavlink instances.
+ *
+ * With several enabled telemetry links every instance builds identical message
+ * structs (unit conversions, Euler angles, ...) from the same uORB sample. The
+ * first instance to see a sample stores the finished struct here keyed on the
+ * topic generation it was built from, and the other instances reuse it. The
+ * per-link framing (sequence number, CRC, signing) still happens in the
+ * regular mavlink_msg_*_send_struct() call, as the CRC covers the per-channel
+ * sequence and cannot be shared.
+ *
+ * Secondary decorating topics (e.g. angular velocity in ATTITUDE) ride along
+ * with whichever instance filled the cache; they are sampled at effectively
+ * the same time, so all links see a consistent message.
+ */
+template <typename T>
+class MavlinkSharedMessageCache
+{
+public:
+	/**
+	 * Fetch the cached message if it was built from the same topic generation.
+	 * @return true if msg was filled from the cache
+	 */
+	static bool fetch(unsigned generation, T &msg)
+	{
+		bool hit = false;
+
+		pthread_mutex_lock(&_mutex);
+
+		if (_valid && (_generation == generation)) {
+			msg = _msg;
+			hit = true;
+		}
+
+		pthread_mutex_unlock(&_mutex);
+
+		return hit;
+	}
+
+	/** Store a freshly built message under the topic generation it was built from. */
+	static void store(unsigned generation, const T &msg)
+	{
+		pthread_mutex_lock(&_mutex);
+		_msg = msg;
+		_generation = generation;
+		_valid = true;
+		pthread_mutex_unlock(&_mutex);
+	}
+
+private:
+	static pthread_mutex_t _mutex;
+	static T _msg;
+	static unsigned _generation;
+	static bool _valid;
+};
+
+template <typename T> pthread_mutex_t MavlinkSharedMessageCache<T>::_mutex = PTHREAD_MUTEX_INITIALIZER;
+template <typename T> T MavlinkSharedMessageCache<T>::_msg{};
+template <typename T> unsigned MavlinkSharedMessageCache<T>::_generation{0};
+template <typename T> bool MavlinkSharedMessageCache<T>::_valid{false};
+
+#endif /* MAVLINK_SHARED_CACHE_H_ */
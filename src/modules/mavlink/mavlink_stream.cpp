@@ -72,6 +72,7 @@ MavlinkStream::update(const hrt_abstime &t)
 			}
 		}
 
+		// keep _next_due at 0 so the regular schedule is set up on the next iteration
 		return 0;
 	}
 
@@ -85,15 +86,18 @@ MavlinkStream::update(const hrt_abstime &t)
 	int interval = _interval;
 
 	if (!const_rate()) {
-		interval /= _mavlink->get_rate_mult();
+		interval /= _mavlink->get_rate_mult(get_priority());
 	}
 
 	// We don't need to send anything if the inverval is 0. send() will be called manually.
 	if (interval == 0) {
+		// nothing to schedule; set_interval() and reset_last_sent() make the stream due again
+		_next_due = UINT64_MAX;
 		return 0;
 	}
 
 	const bool unlimited_rate = interval < 0;
+	const int64_t margin = (_mavlink->get_main_loop_delay() / 10) * 3;
 
 	// Send the message if it is due or
 	// if it will overrun the next scheduled send interval
@@ -105,7 +109,7 @@ MavlinkStream::update(const hrt_abstime &t)
 	// This method is not theoretically optimal but a suitable
 	// stopgap as it hits its deadlines well (0.5 Hz, 50 Hz and 250 Hz)
 
-	if (unlimited_rate || (dt > (interval - (_mavlink->get_main_loop_delay() / 10) * 3))) {
+	if (unlimited_rate || (dt > (interval - margin))) {
 		// interval expired, send message
 
 		// If the interval is non-zero and dt is smaller than 1.5 times the interval
@@ -115,6 +119,10 @@ MavlinkStream::update(const hrt_abstime &t)
 		if (send()) {
 			_last_sent = ((interval > 0) && ((int64_t)(1.5f * interval) > dt)) ? _last_sent + interval : t;
 
+			if (!unlimited_rate) {
+				_next_due = _last_sent + interval - margin;
+			}
+
 			if (!_first_message_sent) {
 				_first_message_sent = true;
 			}
@@ -122,9 +130,11 @@ MavlinkStream::update(const hrt_abstime &t)
 			return 0;
 
 		} else {
+			// the send buffer was full: leave _next_due in the past to retry on the next iteration
 			return -1;
 		}
 	}
 
+	_next_due = _last_sent + interval - margin;
 	return -1;
 }
@@ -55,6 +55,20 @@ public:
 	MavlinkStream(Mavlink *mavlink);
 	virtual ~MavlinkStream() = default;
 
+	/**
+	 * Bandwidth priority class of a stream. When the link bandwidth is not
+	 * sufficient for all configured rates, the remaining bandwidth is handed out
+	 * by class: BULK streams back off first, and CRITICAL streams only slow down
+	 * once everything else is already at its minimum rate.
+	 */
+	enum class Priority : uint8_t {
+		CRITICAL = 0,	///< basic situational awareness, served first
+		DEFAULT = 1,
+		BULK = 2,	///< high-volume diagnostic data, served last
+	};
+
+	static constexpr int NUM_PRIORITIES = 3;
+
 	// no copy, assignment, move, move assignment
 	MavlinkStream(const MavlinkStream &) = delete;
 	MavlinkStream &operator=(const MavlinkStream &) = delete;
@@ -66,7 +80,11 @@ public:
 	 *
 	 * @param interval the interval in microseconds (us) between messages
 	 */
-	void set_interval(const int interval) { _interval = interval; }
+	void set_interval(const int interval)
+	{
+		_interval = interval;
+		_next_due = 0; // reschedule on the next iteration
+	}
 
 	/**
 	 * Get the interval
@@ -79,6 +97,14 @@ public:
 	 * @return 0 if updated / sent, -1 if unchanged
 	 */
 	int update(const hrt_abstime &t);
+
+	/**
+	 * Check whether the stream needs to be processed in this iteration. update()
+	 * maintains the deadline, so streams that are not due can be skipped without
+	 * paying for the virtual update call and the interval math.
+	 * @return true if update() needs to be called
+	 */
+	bool update_due(const hrt_abstime &t) const { return t >= _next_due || _needs_data_updates; }
 	virtual const char *get_name() const = 0;
 	virtual uint16_t get_id() = 0;
 
@@ -87,6 +113,11 @@ public:
 	 */
 	virtual bool const_rate() { return false; }
 
+	/**
+	 * @return the bandwidth priority class used when the link degrades
+	 */
+	virtual Priority get_priority() const { return Priority::DEFAULT; }
+
 	/**
 	 * Get maximal total messages size on update
 	 */
@@ -120,12 +151,19 @@ public:
 	 * Reset the time of last sent to 0. Can be used if a message over this
 	 * stream needs to be sent immediately.
 	 */
-	void reset_last_sent() { _last_sent = 0; }
+	void reset_last_sent()
+	{
+		_last_sent = 0;
+		_next_due = 0;
+	}
 
 protected:
 	Mavlink      *const _mavlink;
 	int _interval{1000000};		///< if set to negative value = unlimited rate
 
+	bool _needs_data_updates{false};	///< set in the constructor if update_data() is overridden:
+						///< the stream is then processed on every iteration
+
 	virtual bool send() = 0;
 
 	/**
@@ -138,6 +176,7 @@ protected:
 
 private:
 	hrt_abstime _last_sent{0};
+	hrt_abstime _next_due{0};	///< earliest time the stream needs to be processed again (@see update_due())
 	bool _first_message_sent{false};
 };
 
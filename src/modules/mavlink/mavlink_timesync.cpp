@@ -49,7 +49,7 @@ MavlinkTimesync::MavlinkTimesync(Mavlink *mavlink) :
 }
 
 void
-MavlinkTimesync::handle_message(const mavlink_message_t *msg)
+MavlinkTimesync::handle_message(const mavlink_message_t *msg, const hrt_abstime rx_time)
 {
 	switch (msg->msgid) {
 	case MAVLINK_MSG_ID_TIMESYNC: {
@@ -57,7 +57,7 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 			mavlink_timesync_t tsync = {};
 			mavlink_msg_timesync_decode(msg, &tsync);
 
-			const uint64_t now = hrt_absolute_time();
+			const uint64_t now = (rx_time > 0) ? rx_time : hrt_absolute_time();
 
 			if (tsync.tc1 == 0) {			// Message originating from remote system, timestamp and return it
 
@@ -112,8 +112,8 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 							_filter_beta = BETA_GAIN_FINAL;
 						}
 
-						// Perform filter update
-						add_sample(offset_us);
+						// Perform filter update on the lowest-RTT sample of the window
+						add_sample(update_sample_window(offset_us, rtt_us));
 
 						// Increment sequence counter after filter update
 						_sequence++;
@@ -166,8 +166,18 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 			bool ofb_unix_valid = time.time_unix_usec > PX4_EPOCH_SECS * 1000000ULL;
 
 			if (!onb_unix_valid && ofb_unix_valid) {
-				tv.tv_sec = time.time_unix_usec / 1000000ULL;
-				tv.tv_nsec = (time.time_unix_usec % 1000000ULL) * 1000ULL;
+				// Prefer the PPS-disciplined hrt -> UTC mapping over the companion's
+				// clock: it is aligned to the GPS second and shared fleet-wide
+				uint64_t utc_time_usec;
+
+				if (hrt_utc_time(&utc_time_usec, hrt_absolute_time()) == 0) {
+					tv.tv_sec = utc_time_usec / 1000000ULL;
+					tv.tv_nsec = (utc_time_usec % 1000000ULL) * 1000ULL;
+
+				} else {
+					tv.tv_sec = time.time_unix_usec / 1000000ULL;
+					tv.tv_nsec = (time.time_unix_usec % 1000000ULL) * 1000ULL;
+				}
 
 				if (px4_clock_settime(CLOCK_REALTIME, &tv)) {
 					PX4_ERR("[timesync] Failed setting realtime clock");
@@ -223,6 +233,32 @@ MavlinkTimesync::add_sample(int64_t offset_us)
 
 }
 
+int64_t
+MavlinkTimesync::update_sample_window(int64_t offset_us, uint64_t rtt_us)
+{
+	_window_offset[_window_index] = offset_us;
+	_window_rtt[_window_index] = rtt_us;
+	_window_index = (_window_index + 1) % FILTER_WINDOW;
+
+	if (_window_count < FILTER_WINDOW) {
+		_window_count++;
+	}
+
+	// Link delay noise is strictly additive, so the sample with the lowest
+	// round-trip time in the window is the least disturbed observation
+	int64_t best_offset = _window_offset[0];
+	uint64_t best_rtt = _window_rtt[0];
+
+	for (unsigned i = 1; i < _window_count; i++) {
+		if (_window_rtt[i] < best_rtt) {
+			best_rtt = _window_rtt[i];
+			best_offset = _window_offset[i];
+		}
+	}
+
+	return best_offset;
+}
+
 void
 MavlinkTimesync::reset_filter()
 {
@@ -232,6 +268,8 @@ MavlinkTimesync::reset_filter()
 	_time_skew = 0.0;
 	_filter_alpha = ALPHA_GAIN_INITIAL;
 	_filter_beta = BETA_GAIN_INITIAL;
+	_window_index = 0;
+	_window_count = 0;
 	_high_deviation_count = 0;
 	_high_rtt_count = 0;
 
@@ -74,8 +74,18 @@ static constexpr double BETA_GAIN_FINAL = 0.003;
 // The filter interpolates between the INITIAL and FINAL gains while the number of
 // exhanged timesync packets is less than CONVERGENCE_WINDOW. A lower value will
 // allow the timesync to converge faster, but with potentially less accurate initial
-// offset and skew estimates.
-static constexpr uint32_t CONVERGENCE_WINDOW = 500;
+// offset and skew estimates. The windowed pre-filter below rejects the link delay
+// outliers that previously required a long schedule, so a comparatively short
+// window converges without the accuracy penalty.
+static constexpr uint32_t CONVERGENCE_WINDOW = 100;
+
+// Outlier-robust sample windowing
+//
+// The offset observation fed into the smoothing filter is the sample with the
+// lowest round-trip time within the last FILTER_WINDOW accepted samples: link
+// delay noise is strictly additive, so the minimum-RTT sample is the one least
+// disturbed by telemetry jitter.
+static constexpr unsigned FILTER_WINDOW = 8;
 
 // Outlier rejection and filter reset
 //
@@ -100,7 +110,12 @@ public:
 	explicit MavlinkTimesync(Mavlink *mavlink);
 	~MavlinkTimesync() = default;
 
-	void handle_message(const mavlink_message_t *msg);
+	/**
+	 * Handle an incoming message. When the receiver provides the arrival timestamp
+	 * of the containing transport chunk it is used as local receive time, removing
+	 * the parse and handler latency from the offset observations.
+	 */
+	void handle_message(const mavlink_message_t *msg, const hrt_abstime rx_time = 0);
 
 	/**
 	 * Convert remote timestamp to local hrt time (usec)
@@ -121,6 +136,12 @@ protected:
 	 */
 	void add_sample(int64_t offset_us);
 
+	/**
+	 * Push an offset/RTT sample into the window and return the offset of the
+	 * sample with the lowest round-trip time currently in the window
+	 */
+	int64_t update_sample_window(int64_t offset_us, uint64_t rtt_us);
+
 	/**
 	 * Return true if the timesync algorithm converged to a good estimate,
 	 * return false otherwise
@@ -144,6 +165,12 @@ protected:
 	double _filter_alpha{ALPHA_GAIN_INITIAL};
 	double _filter_beta{BETA_GAIN_INITIAL};
 
+	// Outlier-robust sample window
+	int64_t _window_offset[FILTER_WINDOW] {};
+	uint64_t _window_rtt[FILTER_WINDOW] {};
+	unsigned _window_index{0};
+	unsigned _window_count{0};
+
 	// Outlier rejection and filter reset
 	uint32_t _high_deviation_count{0};
 	uint32_t _high_rtt_count{0};
@@ -116,14 +116,11 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 
 					const ulog_stream_s &ulog_data = _ulog_stream_sub.get();
 
-					mavlink_logging_data_acked_t msg;
-					msg.sequence = ulog_data.msg_sequence;
-					msg.length = ulog_data.length;
-					msg.first_message_offset = ulog_data.first_message_offset;
-					msg.target_system = _target_system;
-					msg.target_component = _target_component;
-					memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-					mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+					// frame the message directly from the subscription data, to avoid
+					// copying through an intermediate struct
+					mavlink_msg_logging_data_acked_send(channel, _target_system, _target_component,
+									    ulog_data.msg_sequence, ulog_data.length,
+									    ulog_data.first_message_offset, ulog_data.data);
 				}
 			}
 		}
@@ -153,24 +150,16 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 				_ack_received = false;
 				unlock();
 
-				mavlink_logging_data_acked_t msg;
-				msg.sequence = ulog_data.msg_sequence;
-				msg.length = ulog_data.length;
-				msg.first_message_offset = ulog_data.first_message_offset;
-				msg.target_system = _target_system;
-				msg.target_component = _target_component;
-				memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-				mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+				mavlink_msg_logging_data_acked_send(channel, _target_system, _target_component,
+								    ulog_data.msg_sequence, ulog_data.length,
+								    ulog_data.first_message_offset, ulog_data.data);
 
 			} else {
-				mavlink_logging_data_t msg;
-				msg.sequence = ulog_data.msg_sequence;
-				msg.length = ulog_data.length;
-				msg.first_message_offset = ulog_data.first_message_offset;
-				msg.target_system = _target_system;
-				msg.target_component = _target_component;
-				memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-				mavlink_msg_logging_data_send_struct(channel, &msg);
+				// send directly from the subscription data: this only copies once, into
+				// the channel's send buffer
+				mavlink_msg_logging_data_send(channel, _target_system, _target_component,
+							      ulog_data.msg_sequence, ulog_data.length,
+							      ulog_data.first_message_offset, ulog_data.data);
 			}
 		}
 
@@ -34,6 +34,8 @@
 #ifndef ATTITUDE_HPP
 #define ATTITUDE_HPP
 
+#include "../mavlink_shared_cache.h"
+
 #include <uORB/topics/vehicle_attitude.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
 
@@ -47,6 +49,7 @@ public:
 
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
+	Priority get_priority() const override { return Priority::CRITICAL; }
 
 	unsigned get_size() override
 	{
@@ -64,20 +67,25 @@ private:
 		vehicle_attitude_s att;
 
 		if (_att_sub.update(&att)) {
-			vehicle_angular_velocity_s angular_velocity{};
-			_angular_velocity_sub.copy(&angular_velocity);
-
 			mavlink_attitude_t msg{};
 
-			const matrix::Eulerf euler = matrix::Quatf(att.q);
-			msg.time_boot_ms = att.timestamp / 1000;
-			msg.roll = euler.phi();
-			msg.pitch = euler.theta();
-			msg.yaw = euler.psi();
+			// reuse the message another instance already built from this sample
+			if (!MavlinkSharedMessageCache<mavlink_attitude_t>::fetch(_att_sub.get_last_generation(), msg)) {
+				vehicle_angular_velocity_s angular_velocity{};
+				_angular_velocity_sub.copy(&angular_velocity);
+
+				const matrix::Eulerf euler = matrix::Quatf(att.q);
+				msg.time_boot_ms = att.timestamp / 1000;
+				msg.roll = euler.phi();
+				msg.pitch = euler.theta();
+				msg.yaw = euler.psi();
+
+				msg.rollspeed = angular_velocity.xyz[0];
+				msg.pitchspeed = angular_velocity.xyz[1];
+				msg.yawspeed = angular_velocity.xyz[2];
 
-			msg.rollspeed = angular_velocity.xyz[0];
-			msg.pitchspeed = angular_velocity.xyz[1];
-			msg.yawspeed = angular_velocity.xyz[2];
+				MavlinkSharedMessageCache<mavlink_attitude_t>::store(_att_sub.get_last_generation(), msg);
+			}
 
 			mavlink_msg_attitude_send_struct(_mavlink->get_channel(), &msg);
 
@@ -34,6 +34,8 @@
 #ifndef ATTITUDE_QUATERNION_HPP
 #define ATTITUDE_QUATERNION_HPP
 
+#include "../mavlink_shared_cache.h"
+
 #include <uORB/topics/vehicle_attitude.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
 #include <uORB/topics/vehicle_status.h>
@@ -66,14 +68,20 @@ private:
 		vehicle_attitude_s att;
 
 		if (_att_sub.update(&att)) {
+			mavlink_attitude_quaternion_t msg{};
+
+			// reuse the message another instance already built from this sample
+			if (MavlinkSharedMessageCache<mavlink_attitude_quaternion_t>::fetch(_att_sub.get_last_generation(), msg)) {
+				mavlink_msg_attitude_quaternion_send_struct(_mavlink->get_channel(), &msg);
+				return true;
+			}
+
 			vehicle_angular_velocity_s angular_velocity{};
 			_angular_velocity_sub.copy(&angular_velocity);
 
 			vehicle_status_s status{};
 			_status_sub.copy(&status);
 
-			mavlink_attitude_quaternion_t msg{};
-
 			msg.time_boot_ms = att.timestamp / 1000;
 			msg.q1 = att.q[0];
 			msg.q2 = att.q[1];
@@ -100,6 +108,8 @@ private:
 				msg.repr_offset_q[3] = 0.0f;
 			}
 
+			MavlinkSharedMessageCache<mavlink_attitude_quaternion_t>::store(_att_sub.get_last_generation(), msg);
+
 			mavlink_msg_attitude_quaternion_send_struct(_mavlink->get_channel(), &msg);
 
 			return true;
@@ -34,6 +34,8 @@
 #ifndef GLOBAL_POSITION_INT_HPP
 #define GLOBAL_POSITION_INT_HPP
 
+#include "../mavlink_shared_cache.h"
+
 #include <uORB/topics/home_position.h>
 #include <uORB/topics/vehicle_air_data.h>
 #include <uORB/topics/vehicle_global_position.h>
@@ -49,6 +51,7 @@ public:
 
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
+	Priority get_priority() const override { return Priority::CRITICAL; }
 
 	unsigned get_size() override
 	{
@@ -72,6 +75,12 @@ private:
 
 			mavlink_global_position_int_t msg{};
 
+			// reuse the message another instance already built from this sample
+			if (MavlinkSharedMessageCache<mavlink_global_position_int_t>::fetch(_gpos_sub.get_last_generation(), msg)) {
+				mavlink_msg_global_position_int_send_struct(_mavlink->get_channel(), &msg);
+				return true;
+			}
+
 			if (lpos.z_valid && lpos.z_global) {
 				msg.alt = (-lpos.z + lpos.ref_alt) * 1000.0f;
 
@@ -112,6 +121,8 @@ private:
 
 			msg.hdg = math::degrees(matrix::wrap_2pi(lpos.heading)) * 100.0f;
 
+			MavlinkSharedMessageCache<mavlink_global_position_int_t>::store(_gpos_sub.get_last_generation(), msg);
+
 			mavlink_msg_global_position_int_send_struct(_mavlink->get_channel(), &msg);
 
 			return true;
@@ -90,6 +90,8 @@ private:
 		_throttle(SimpleAnalyzer::AVERAGE),
 		_windspeed(SimpleAnalyzer::AVERAGE)
 	{
+		// the analyzers need to sample the data at the full module rate
+		_needs_data_updates = true;
 		reset_last_sent();
 	}
 
@@ -46,6 +46,7 @@ public:
 
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
+	Priority get_priority() const override { return Priority::BULK; }
 
 	unsigned get_size() override
 	{
@@ -58,7 +58,7 @@ matrix::Vector3f AttitudeControl::update(const Quatf &q) const
 
 	// calculate reduced desired attitude neglecting vehicle's yaw to prioritize roll and pitch
 	const Vector3f e_z = q.dcm_z();
-	const Vector3f e_z_d = qd.dcm_z();
+	const Vector3f &e_z_d = _attitude_setpoint_dcm_z;
 	Quatf qd_red(e_z, e_z_d);
 
 	if (fabsf(qd_red(1)) > (1.f - 1e-5f) || fabsf(qd_red(2)) > (1.f - 1e-5f)) {
@@ -78,7 +78,16 @@ matrix::Vector3f AttitudeControl::update(const Quatf &q) const
 	// catch numerical problems with the domain of acosf and asinf
 	q_mix(0) = math::constrain(q_mix(0), -1.f, 1.f);
 	q_mix(3) = math::constrain(q_mix(3), -1.f, 1.f);
-	qd = qd_red * Quatf(cosf(_yaw_w * acosf(q_mix(0))), 0, 0, sinf(_yaw_w * asinf(q_mix(3))));
+
+	if (q_mix(0) > 1.f - 1e-3f) {
+		// small-angle fast path: within ~5 degrees of yaw error the trigonometry collapses
+		// to its first order series with an error below 1e-5, skipping four libm calls in the
+		// steady hover case where this loop runs at up to 1 kHz
+		qd = qd_red * Quatf(1.f - _yaw_w * _yaw_w * (1.f - q_mix(0)), 0, 0, _yaw_w * q_mix(3));
+
+	} else {
+		qd = qd_red * Quatf(cosf(_yaw_w * acosf(q_mix(0))), 0, 0, sinf(_yaw_w * asinf(q_mix(3))));
+	}
 
 	// quaternion attitude control law, qe is rotation from q to qd
 	const Quatf qe = q.inversed() * qd;
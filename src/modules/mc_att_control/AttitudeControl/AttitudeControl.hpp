@@ -79,6 +79,7 @@ public:
 	{
 		_attitude_setpoint_q = qd;
 		_attitude_setpoint_q.normalize();
+		_attitude_setpoint_dcm_z = _attitude_setpoint_q.dcm_z();
 		_yawspeed_setpoint = yawspeed_setpoint;
 	}
 
@@ -91,6 +92,7 @@ public:
 	{
 		_attitude_setpoint_q = q_delta * _attitude_setpoint_q;
 		_attitude_setpoint_q.normalize();
+		_attitude_setpoint_dcm_z = _attitude_setpoint_q.dcm_z();
 	}
 
 	/**
@@ -106,5 +108,6 @@ private:
 	float _yaw_w{0.f}; ///< yaw weight [0,1] to deprioritize caompared to roll and pitch
 
 	matrix::Quatf _attitude_setpoint_q; ///< latest known attitude setpoint e.g. from position control
+	matrix::Vector3f _attitude_setpoint_dcm_z{0.f, 0.f, 1.f}; ///< thrust axis of the setpoint, cached since the setpoint updates slower than the control loop
 	float _yawspeed_setpoint{0.f}; ///< latest known yawspeed feed-forward setpoint
 };
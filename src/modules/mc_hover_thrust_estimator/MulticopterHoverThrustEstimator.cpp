@@ -91,6 +91,8 @@ void MulticopterHoverThrustEstimator::updateParams()
 					    0.8f));
 	_hover_thrust_ekf.setMaxHoverThrust(math::constrain(_param_mpc_thr_hover.get() + _param_hte_thr_range.get(), 0.2f,
 					    0.9f));
+
+	_steady_hysteresis.set_hysteresis_time_from(false, (hrt_abstime)(_param_hte_stdy_t.get() * 1e6f));
 }
 
 void MulticopterHoverThrustEstimator::Run()
@@ -113,6 +115,10 @@ void MulticopterHoverThrustEstimator::Run()
 		}
 	}
 
+	// only an armed vehicle off the ground needs the full vehicle_local_position rate;
+	// a dormant estimator batches its updates at reduced rate until an excursion wakes it
+	_vehicle_local_position_sub.set_interval_us((_armed && !_landed && !_dormant) ? 0 : 100_ms);
+
 	if (!_vehicle_local_position_sub.updated()) {
 		return;
 	}
@@ -191,12 +197,29 @@ void MulticopterHoverThrustEstimator::Run()
 				_valid_hysteresis.set_state_and_update(valid, local_pos.timestamp);
 				_valid = _valid_hysteresis.get_state();
 
+				// Cheap prefilter for dormancy: a throttle excursion away from the estimate
+				// or a large innovation means hover thrust is moving and needs the full rate.
+				// Waking up is immediate, becoming dormant requires a quiescent steady window.
+				const bool quiescent = _valid
+						       && (_hover_thrust_ekf.getInnovationTestRatio() < 0.25f)
+						       && (fabsf(-local_pos_sp.thrust[2] - _hover_thrust_ekf.getHoverThrustEstimate()) < 0.05f);
+
+				if (_param_hte_stdy_t.get() > FLT_EPSILON) {
+					_steady_hysteresis.set_state_and_update(quiescent, local_pos.timestamp);
+					_dormant = _steady_hysteresis.get_state();
+
+				} else {
+					_dormant = false;
+				}
+
 				publishStatus(local_pos.timestamp);
 			}
 		}
 
 	} else {
 		_valid_hysteresis.set_state_and_update(false, hrt_absolute_time());
+		_steady_hysteresis.set_state_and_update(false, hrt_absolute_time());
+		_dormant = false;
 
 		if (!_armed) {
 			reset();
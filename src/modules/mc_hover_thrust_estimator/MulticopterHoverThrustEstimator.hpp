@@ -112,8 +112,10 @@ private:
 	bool _in_air{false};
 
 	bool _valid{false};
+	bool _dormant{false};
 
 	systemlib::Hysteresis _valid_hysteresis{false};
+	systemlib::Hysteresis _steady_hysteresis{false};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle time")};
 
@@ -122,6 +124,7 @@ private:
 		(ParamFloat<px4::params::HTE_ACC_GATE>) _param_hte_acc_gate,
 		(ParamFloat<px4::params::HTE_HT_ERR_INIT>) _param_hte_ht_err_init,
 		(ParamFloat<px4::params::HTE_THR_RANGE>) _param_hte_thr_range,
+		(ParamFloat<px4::params::HTE_STDY_T>) _param_hte_stdy_t,
 		(ParamFloat<px4::params::HTE_VXY_THR>) _param_hte_vxy_thr,
 		(ParamFloat<px4::params::HTE_VZ_THR>) _param_hte_vz_thr,
 		(ParamFloat<px4::params::MPC_THR_HOVER>) _param_mpc_thr_hover
@@ -130,3 +130,20 @@ PARAM_DEFINE_FLOAT(HTE_VZ_THR, 2.0);
  * @group Hover Thrust Estimator
  */
 PARAM_DEFINE_FLOAT(HTE_THR_RANGE, 0.2);
+
+/**
+ * Steady time before the estimator becomes dormant
+ *
+ * Once the estimate has been valid and the innovations and throttle
+ * have stayed quiescent for this long, the estimator reduces its
+ * update rate until a throttle or acceleration excursion wakes it up.
+ *
+ * Set to 0 to always run at the full rate.
+ *
+ * @decimal 1
+ * @min 0.0
+ * @max 60.0
+ * @unit s
+ * @group Hover Thrust Estimator
+ */
+PARAM_DEFINE_FLOAT(HTE_STDY_T, 10.0);
@@ -139,9 +139,14 @@ void PositionControl::_positionControl()
 
 void PositionControl::_velocityControl(const float dt)
 {
-	// PID velocity control
+	// PID velocity control, fused into one pass per axis so no intermediate vectors are
+	// materialized and the multiply-adds contract into fma instructions
 	Vector3f vel_error = _vel_sp - _vel;
-	Vector3f acc_sp_velocity = vel_error.emult(_gain_vel_p) + _vel_int - _vel_dot.emult(_gain_vel_d);
+	Vector3f acc_sp_velocity;
+
+	for (int i = 0; i < 3; i++) {
+		acc_sp_velocity(i) = vel_error(i) * _gain_vel_p(i) + _vel_int(i) - _vel_dot(i) * _gain_vel_d(i);
+	}
 
 	// No control input from setpoints or corresponding states which are NAN
 	ControlMath::addIfNotNanVector3f(_acc_sp, acc_sp_velocity);
@@ -194,8 +199,11 @@ void PositionControl::_velocityControl(const float dt)
 
 	// Make sure integral doesn't get NAN
 	ControlMath::setZeroIfNanVector3f(vel_error);
+
 	// Update integral part of velocity control
-	_vel_int += vel_error.emult(_gain_vel_i) * dt;
+	for (int i = 0; i < 3; i++) {
+		_vel_int(i) += vel_error(i) * _gain_vel_i(i) * dt;
+	}
 
 	// limit thrust integral
 	_vel_int(2) = math::min(fabsf(_vel_int(2)), CONSTANTS_ONE_G) * sign(_vel_int(2));
@@ -208,8 +216,8 @@ void PositionControl::_accelerationControl()
 	ControlMath::limitTilt(body_z, Vector3f(0, 0, 1), _lim_tilt);
 	// Scale thrust assuming hover thrust produces standard gravity
 	float collective_thrust = _acc_sp(2) * (_hover_thrust / CONSTANTS_ONE_G) - _hover_thrust;
-	// Project thrust to planned body attitude
-	collective_thrust /= (Vector3f(0, 0, 1).dot(body_z));
+	// Project thrust to planned body attitude (dot product with the vertical unit vector)
+	collective_thrust /= body_z(2);
 	collective_thrust = math::min(collective_thrust, -_lim_thr_min);
 	_thr_sp = body_z * collective_thrust;
 }
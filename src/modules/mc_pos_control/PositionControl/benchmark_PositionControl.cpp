@@ -0,0 +1,138 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * PositionControl performance harness: runs the full controller update over
+ * representative scenarios and reports the wall clock cost per cycle. This
+ * loop runs at the position control rate on every multicopter, so its jitter
+ * couples directly into hover performance.
+ *
+ * Build with `make mc_pos_control_bench` in a test build directory and run
+ * manually; compare the reported ns/update before and after changes.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include <PositionControl.hpp>
+
+using namespace matrix;
+
+namespace
+{
+
+PositionControlStates makeStates(const Vector3f &position, const Vector3f &velocity)
+{
+	PositionControlStates states;
+	states.position = position;
+	states.velocity = velocity;
+	states.acceleration = Vector3f{0.f, 0.f, 0.f};
+	states.yaw = 0.f;
+	return states;
+}
+
+uint64_t runScenario(const char *name, const vehicle_local_position_setpoint_s &setpoint,
+		     const PositionControlStates &states, const unsigned iterations)
+{
+	PositionControl position_control;
+	position_control.setPositionGains(Vector3f(1.f, 1.f, 1.f));
+	position_control.setVelocityGains(Vector3f(4.f, 4.f, 4.f), Vector3f(2.f, 2.f, 2.f), Vector3f(0.1f, 0.1f, 0.1f));
+	position_control.setVelocityLimits(12.f, 3.f, 1.f);
+	position_control.setThrustLimits(0.1f, 0.9f);
+	position_control.setHorizontalThrustMargin(0.3f);
+	position_control.setTiltLimit(0.7f);
+	position_control.setHoverThrust(0.5f);
+
+	vehicle_local_position_setpoint_s output{};
+	vehicle_attitude_setpoint_s attitude{};
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (unsigned i = 0; i < iterations; i++) {
+		position_control.setState(states);
+		position_control.setInputSetpoint(setpoint);
+		position_control.update(0.01f);
+		position_control.getLocalPositionSetpoint(output);
+		position_control.getAttitudeSetpoint(attitude);
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+	const uint64_t wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+	printf("%-24s %8.1f ns/update (thrust %.3f %.3f %.3f)\n", name, (double)wall_ns / iterations,
+	       (double)output.thrust[0], (double)output.thrust[1], (double)output.thrust[2]);
+
+	return wall_ns;
+}
+
+} // namespace
+
+int main(int, char **)
+{
+	static constexpr unsigned ITERATIONS = 1000000;
+
+	// position hold: pure position setpoint, small tracking error
+	vehicle_local_position_setpoint_s setpoint_hold{};
+	setpoint_hold.x = 0.1f;
+	setpoint_hold.y = -0.1f;
+	setpoint_hold.z = -2.f;
+	setpoint_hold.yaw = NAN;
+	setpoint_hold.yawspeed = NAN;
+	setpoint_hold.vx = NAN;
+	setpoint_hold.vy = NAN;
+	setpoint_hold.vz = NAN;
+	Vector3f(NAN, NAN, NAN).copyTo(setpoint_hold.acceleration);
+	runScenario("position hold", setpoint_hold, makeStates(Vector3f{0.f, 0.f, -2.f}, Vector3f{0.f, 0.f, 0.f}),
+		    ITERATIONS);
+
+	// velocity tracking: feed-forward velocity setpoint with position loop disabled
+	vehicle_local_position_setpoint_s setpoint_velocity = setpoint_hold;
+	setpoint_velocity.x = NAN;
+	setpoint_velocity.y = NAN;
+	setpoint_velocity.z = NAN;
+	setpoint_velocity.vx = 5.f;
+	setpoint_velocity.vy = 1.f;
+	setpoint_velocity.vz = -1.f;
+	runScenario("velocity tracking", setpoint_velocity, makeStates(Vector3f{0.f, 0.f, -2.f}, Vector3f{4.f, 0.5f, 0.f}),
+		    ITERATIONS);
+
+	// saturated: large error driving the thrust limits and the anti-windup paths
+	vehicle_local_position_setpoint_s setpoint_saturated = setpoint_hold;
+	setpoint_saturated.x = 50.f;
+	setpoint_saturated.y = 50.f;
+	setpoint_saturated.z = -50.f;
+	runScenario("saturated", setpoint_saturated, makeStates(Vector3f{0.f, 0.f, -2.f}, Vector3f{0.f, 0.f, 0.f}),
+		    ITERATIONS);
+
+	return 0;
+}
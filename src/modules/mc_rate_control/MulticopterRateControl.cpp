@@ -47,7 +47,8 @@ MulticopterRateControl::MulticopterRateControl(bool vtol) :
 	ModuleParams(nullptr),
 	WorkItem(MODULE_NAME, px4::wq_configurations::rate_ctrl),
 	_actuator_controls_0_pub(vtol ? ORB_ID(actuator_controls_virtual_mc) : ORB_ID(actuator_controls_0)),
-	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle"))
+	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
+	_latency_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": control latency"))
 {
 	_vehicle_status.vehicle_type = vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
 
@@ -58,6 +59,7 @@ MulticopterRateControl::MulticopterRateControl(bool vtol) :
 MulticopterRateControl::~MulticopterRateControl()
 {
 	perf_free(_loop_perf);
+	perf_free(_latency_perf);
 }
 
 bool
@@ -68,6 +70,9 @@ MulticopterRateControl::init()
 		return false;
 	}
 
+	// the inner loop must not wait behind other work queued on the same wq
+	set_deadline_us(250);
+
 	return true;
 }
 
@@ -278,6 +283,11 @@ MulticopterRateControl::Run()
 			actuators.timestamp = hrt_absolute_time();
 			_actuator_controls_0_pub.publish(actuators);
 
+			// end-to-end latency from gyro sampling to actuator controls publication
+			perf_set_elapsed(_latency_perf, actuators.timestamp - actuators.timestamp_sample);
+
+			_latency_trace.publish(latency_trace_s::HOP_RATE_CONTROL, actuators.timestamp_sample);
+
 			updateActuatorControlsStatus(actuators, dt);
 
 		} else if (_vehicle_control_mode.flag_control_termination_enabled) {
@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <lib/latency_trace/LatencyTrace.hpp>
 #include <lib/rate_control/rate_control.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/perf/perf_counter.h>
@@ -118,6 +119,8 @@ private:
 	uORB::Publication<vehicle_thrust_setpoint_s>	_vehicle_thrust_setpoint_pub{ORB_ID(vehicle_thrust_setpoint)};
 	uORB::Publication<vehicle_torque_setpoint_s>	_vehicle_torque_setpoint_pub{ORB_ID(vehicle_torque_setpoint)};
 
+	latency_trace::LatencyTracePublisher _latency_trace{};
+
 	orb_advert_t _mavlink_log_pub{nullptr};
 
 	vehicle_control_mode_s	_vehicle_control_mode{};
@@ -129,6 +132,7 @@ private:
 	hrt_abstime _last_run{0};
 
 	perf_counter_t	_loop_perf;			/**< loop duration performance counter */
+	perf_counter_t	_latency_perf;			/**< gyro sample timestamp to actuator publication latency */
 
 	// keep setpoint values between updates
 	matrix::Vector3f _acro_rate_max;		/**< max attitude rates in acro mode */
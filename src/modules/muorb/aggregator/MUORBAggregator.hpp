@@ -0,0 +1,182 @@
+/****************************************************************************
+ *
+ * Copyright (C) 2022 ModalAI, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef _MUORBAggregator_hpp_
+#define _MUORBAggregator_hpp_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace muorb
+{
+
+/**
+ * Packs individual topic publications into aggregate blocks so that
+ * high-rate topics (eg 8 kHz IMU data) cross the FastRPC boundary as a
+ * handful of block transfers per millisecond instead of one call per
+ * publication.
+ *
+ * A block is a sequence of records, each
+ *   [uint16 name_len][uint16 data_len][name (NUL included)][payload]
+ * sent under the reserved topic name AGGREGATE_TOPIC_NAME. The receiving
+ * side detects the reserved name and unpacks the records through the
+ * regular per-topic receive callback.
+ *
+ * Blocks are flushed when the buffer fills or when the oldest pending
+ * record is older than FLUSH_INTERVAL_US. Callers must provide their own
+ * synchronization; on the DSP side all sends come from the uORB channel
+ * thread.
+ */
+class Aggregator
+{
+public:
+	static constexpr uint32_t BUFFER_SIZE = 8192;
+	static constexpr uint64_t FLUSH_INTERVAL_US = 1000;
+
+	using SendFunc = int (*)(const char *topic, const uint8_t *data, int data_len_in_bytes);
+	using ReceiveFunc = void (*)(const char *topic, const uint8_t *data, uint32_t length_in_bytes);
+
+	static const char *AggregateTopicName() { return "muorb_aggregate"; }
+
+	static bool IsAggregate(const char *topic) { return strcmp(topic, AggregateTopicName()) == 0; }
+
+	void SetSendFunc(SendFunc send_func) { _send_func = send_func; }
+
+	/**
+	 * Queue one publication for aggregated transfer. Flushes the pending
+	 * block first if the record would not fit, and flushes afterwards if
+	 * the oldest pending record exceeds the flush interval.
+	 *
+	 * @return 0 on success, -1 on invalid input or failed flush.
+	 */
+	int Send(const char *topic, const uint8_t *data, uint32_t length_in_bytes, uint64_t now_us)
+	{
+		if ((topic == nullptr) || ((data == nullptr) && (length_in_bytes > 0))) {
+			return -1;
+		}
+
+		const uint32_t name_len = strlen(topic) + 1; // keep the terminator for the receive side
+		const uint32_t record_len = sizeof(RecordHeader) + name_len + length_in_bytes;
+
+		if (record_len > BUFFER_SIZE) {
+			// oversized record: send it unaggregated
+			return (_send_func != nullptr) ? _send_func(topic, data, length_in_bytes) : -1;
+		}
+
+		if (_fill + record_len > BUFFER_SIZE) {
+			if (Flush() != 0) {
+				return -1;
+			}
+		}
+
+		if (_fill == 0) {
+			_oldest_pending_us = now_us;
+		}
+
+		RecordHeader header{(uint16_t)name_len, (uint16_t)length_in_bytes};
+		memcpy(&_buffer[_fill], &header, sizeof(header));
+		memcpy(&_buffer[_fill + sizeof(header)], topic, name_len);
+
+		if (length_in_bytes > 0) {
+			memcpy(&_buffer[_fill + sizeof(header) + name_len], data, length_in_bytes);
+		}
+
+		_fill += record_len;
+
+		if ((now_us - _oldest_pending_us) >= FLUSH_INTERVAL_US) {
+			return Flush();
+		}
+
+		return 0;
+	}
+
+	/** Send the pending block, if any. */
+	int Flush()
+	{
+		if (_fill == 0) {
+			return 0;
+		}
+
+		if (_send_func == nullptr) {
+			return -1;
+		}
+
+		const int ret = _send_func(AggregateTopicName(), _buffer, _fill);
+		_fill = 0;
+
+		return ret;
+	}
+
+	/**
+	 * Unpack a received aggregate block, invoking the callback once per
+	 * contained record. Truncated trailing records are dropped.
+	 */
+	static void Unpack(const uint8_t *data, uint32_t length_in_bytes, ReceiveFunc callback)
+	{
+		uint32_t offset = 0;
+
+		while (offset + sizeof(RecordHeader) <= length_in_bytes) {
+			RecordHeader header;
+			memcpy(&header, &data[offset], sizeof(header));
+
+			const uint32_t record_len = sizeof(RecordHeader) + header.name_len + header.data_len;
+
+			if ((header.name_len == 0) || (offset + record_len > length_in_bytes)) {
+				break;
+			}
+
+			const char *name = (const char *)&data[offset + sizeof(RecordHeader)];
+
+			if (name[header.name_len - 1] == '\0') {
+				callback(name, &data[offset + sizeof(RecordHeader) + header.name_len], header.data_len);
+			}
+
+			offset += record_len;
+		}
+	}
+
+private:
+	struct RecordHeader {
+		uint16_t name_len; /**< topic name length including NUL terminator */
+		uint16_t data_len; /**< payload length */
+	};
+
+	uint8_t _buffer[BUFFER_SIZE];
+	uint32_t _fill{0};
+	uint64_t _oldest_pending_us{0};
+	SendFunc _send_func{nullptr};
+};
+
+} // namespace muorb
+
+#endif /* _MUORBAggregator_hpp_ */
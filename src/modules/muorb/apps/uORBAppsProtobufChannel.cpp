@@ -32,6 +32,7 @@
  ****************************************************************************/
 
 #include "uORBAppsProtobufChannel.hpp"
+#include "../aggregator/MUORBAggregator.hpp"
 #include <string.h>
 
 #include "fc_sensor.h"
@@ -45,6 +46,13 @@ void uORB::AppsProtobufChannel::ReceiveCallback(const char *topic,
 		const uint8_t *data,
 		uint32_t length_in_bytes)
 {
+	if (muorb::Aggregator::IsAggregate(topic)) {
+		// block of aggregated records from the DSP: unpack and handle each
+		// one individually
+		muorb::Aggregator::Unpack(data, length_in_bytes, &ReceiveCallback);
+		return;
+	}
+
 	if (strcmp(topic, "slpi_debug") == 0) {
 		PX4_INFO("SLPI: %s", (const char *) data);
 
@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef _muorb_shmem_h_
+#define _muorb_shmem_h_
+
+/**
+ * @file muorb_shmem.h
+ *
+ * Shared memory layout of the muorb companion link. This header is the wire
+ * format: a companion process on the same Linux system includes it, maps
+ * MUORB_SHMEM_NAME and exchanges uORB topic records with PX4 without any byte
+ * serialization in between. All synchronization uses process-shared pthread
+ * primitives living inside the mapping, so the companion wakes up on a
+ * condition variable instead of polling.
+ */
+
+#include <stdint.h>
+#include <pthread.h>
+
+#define MUORB_SHMEM_NAME           "/px4_muorb_shmem"
+#define MUORB_SHMEM_MAGIC          0x4d754f52u	/* "MuOR" */
+#define MUORB_SHMEM_VERSION        1u
+
+#define MUORB_SHMEM_TOPIC_NAME_LEN 64
+#define MUORB_SHMEM_MAX_DATA_LEN   2048
+#define MUORB_SHMEM_RING_SIZE      64		/* must be a power of two */
+
+/* record types */
+#define MUORB_SHMEM_RECORD_ADVERTISE    0u
+#define MUORB_SHMEM_RECORD_UNADVERTISE  1u
+#define MUORB_SHMEM_RECORD_SUBSCRIBE    2u
+#define MUORB_SHMEM_RECORD_UNSUBSCRIBE  3u
+#define MUORB_SHMEM_RECORD_TOPIC_DATA   4u
+
+typedef struct {
+	uint32_t type;				/* MUORB_SHMEM_RECORD_* */
+	int32_t  msg_rate_hz;			/* requested rate, SUBSCRIBE records only */
+	uint32_t length;			/* payload length, TOPIC_DATA records only */
+	char     topic[MUORB_SHMEM_TOPIC_NAME_LEN];
+	uint8_t  data[MUORB_SHMEM_MAX_DATA_LEN];
+} muorb_shmem_record_t;
+
+typedef struct {
+	pthread_mutex_t lock;			/* process-shared, protects head/tail/records */
+	pthread_cond_t  data_available;		/* process-shared, signalled on every push */
+	uint32_t head;				/* next record to write (free running) */
+	uint32_t tail;				/* next record to read (free running) */
+	uint32_t dropped;			/* records overwritten because the reader fell behind */
+	muorb_shmem_record_t records[MUORB_SHMEM_RING_SIZE];
+} muorb_shmem_ring_t;
+
+typedef struct {
+	uint32_t magic;				/* MUORB_SHMEM_MAGIC once PX4 finished initializing */
+	uint32_t version;			/* MUORB_SHMEM_VERSION */
+	muorb_shmem_ring_t to_companion;	/* PX4 -> companion: advertisements, subscriptions, topic data */
+	muorb_shmem_ring_t to_px4;		/* companion -> PX4 */
+} muorb_shmem_region_t;
+
+#endif /* _muorb_shmem_h_ */
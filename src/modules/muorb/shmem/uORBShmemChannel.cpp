@@ -0,0 +1,331 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "uORBShmemChannel.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/posix.h>
+#include <uORB/uORBManager.hpp>
+
+static_assert((MUORB_SHMEM_RING_SIZE & (MUORB_SHMEM_RING_SIZE - 1)) == 0,
+	      "MUORB_SHMEM_RING_SIZE must be a power of two");
+
+// Initialize the static members
+uORB::ShmemChannel *uORB::ShmemChannel::_InstancePtr = nullptr;
+
+bool uORB::ShmemChannel::InitializeRing(muorb_shmem_ring_t &ring)
+{
+	pthread_mutexattr_t mutex_attr;
+
+	if ((pthread_mutexattr_init(&mutex_attr) != 0)
+	    || (pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED) != 0)
+	    || (pthread_mutex_init(&ring.lock, &mutex_attr) != 0)) {
+		return false;
+	}
+
+	pthread_mutexattr_destroy(&mutex_attr);
+
+	pthread_condattr_t cond_attr;
+
+	if ((pthread_condattr_init(&cond_attr) != 0)
+	    || (pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED) != 0)
+#if defined(__PX4_LINUX)
+	    || (pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC) != 0)
+#endif
+	    || (pthread_cond_init(&ring.data_available, &cond_attr) != 0)) {
+		return false;
+	}
+
+	pthread_condattr_destroy(&cond_attr);
+
+	ring.head = 0;
+	ring.tail = 0;
+	ring.dropped = 0;
+
+	return true;
+}
+
+bool uORB::ShmemChannel::Initialize()
+{
+	if (_initialized) {
+		return true;
+	}
+
+	int fd = shm_open(MUORB_SHMEM_NAME, O_CREAT | O_RDWR, 0666);
+
+	if (fd < 0) {
+		PX4_ERR("shm_open(%s) failed (%d)", MUORB_SHMEM_NAME, errno);
+		return false;
+	}
+
+	if (ftruncate(fd, sizeof(muorb_shmem_region_t)) != 0) {
+		PX4_ERR("ftruncate failed (%d)", errno);
+		close(fd);
+		shm_unlink(MUORB_SHMEM_NAME);
+		return false;
+	}
+
+	void *mapping = mmap(nullptr, sizeof(muorb_shmem_region_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (mapping == MAP_FAILED) {
+		PX4_ERR("mmap failed (%d)", errno);
+		shm_unlink(MUORB_SHMEM_NAME);
+		return false;
+	}
+
+	_region = static_cast<muorb_shmem_region_t *>(mapping);
+	memset(_region, 0, sizeof(muorb_shmem_region_t));
+
+	if (!InitializeRing(_region->to_companion) || !InitializeRing(_region->to_px4)) {
+		PX4_ERR("shared ring initialization failed");
+		munmap(_region, sizeof(muorb_shmem_region_t));
+		_region = nullptr;
+		shm_unlink(MUORB_SHMEM_NAME);
+		return false;
+	}
+
+	_region->version = MUORB_SHMEM_VERSION;
+	// the magic is written last: once a companion sees it the region is ready for use
+	_region->magic = MUORB_SHMEM_MAGIC;
+
+	_should_exit = false;
+
+	if (pthread_create(&_recv_thread, nullptr, &ReceiveThreadTrampoline, this) != 0) {
+		PX4_ERR("receive thread creation failed (%d)", errno);
+		munmap(_region, sizeof(muorb_shmem_region_t));
+		_region = nullptr;
+		shm_unlink(MUORB_SHMEM_NAME);
+		return false;
+	}
+
+	_initialized = true;
+
+	// Register the shared memory channel with uORB.
+	uORB::Manager::get_instance()->set_uorb_communicator(this);
+
+	return true;
+}
+
+void uORB::ShmemChannel::Stop()
+{
+	if (!_initialized) {
+		return;
+	}
+
+	muorb_shmem_ring_t &ring = _region->to_px4;
+
+	pthread_mutex_lock(&ring.lock);
+	_should_exit = true;
+	pthread_cond_broadcast(&ring.data_available);
+	pthread_mutex_unlock(&ring.lock);
+
+	pthread_join(_recv_thread, nullptr);
+
+	_initialized = false;
+
+	munmap(_region, sizeof(muorb_shmem_region_t));
+	_region = nullptr;
+	shm_unlink(MUORB_SHMEM_NAME);
+}
+
+int16_t uORB::ShmemChannel::topic_advertised(const char *messageName)
+{
+	return PushRecord(MUORB_SHMEM_RECORD_ADVERTISE, messageName, 0, 0, nullptr);
+}
+
+int16_t uORB::ShmemChannel::add_subscription(const char *messageName, int32_t msgRateInHz)
+{
+	return PushRecord(MUORB_SHMEM_RECORD_SUBSCRIBE, messageName, msgRateInHz, 0, nullptr);
+}
+
+int16_t uORB::ShmemChannel::remove_subscription(const char *messageName)
+{
+	return PushRecord(MUORB_SHMEM_RECORD_UNSUBSCRIBE, messageName, 0, 0, nullptr);
+}
+
+int16_t uORB::ShmemChannel::register_handler(uORBCommunicator::IChannelRxHandler *handler)
+{
+	_RxHandler = handler;
+	return 0;
+}
+
+int16_t uORB::ShmemChannel::send_message(const char *messageName, int32_t length, uint8_t *data)
+{
+	return PushRecord(MUORB_SHMEM_RECORD_TOPIC_DATA, messageName, 0, length, data);
+}
+
+int16_t uORB::ShmemChannel::PushRecord(uint32_t type, const char *topic, int32_t msg_rate_hz, int32_t length,
+				       const uint8_t *data)
+{
+	if (!_initialized) {
+		return -1;
+	}
+
+	if ((length < 0) || (length > MUORB_SHMEM_MAX_DATA_LEN)) {
+		_oversize_drops++;
+		PX4_ERR("%s: unsupported message length %" PRId32, topic, length);
+		return -1;
+	}
+
+	muorb_shmem_ring_t &ring = _region->to_companion;
+
+	pthread_mutex_lock(&ring.lock);
+
+	if (ring.head - ring.tail >= MUORB_SHMEM_RING_SIZE) {
+		// full: drop the oldest record so the companion always sees the latest data
+		ring.tail++;
+		ring.dropped++;
+	}
+
+	muorb_shmem_record_t &record = ring.records[ring.head & (MUORB_SHMEM_RING_SIZE - 1)];
+	record.type = type;
+	record.msg_rate_hz = msg_rate_hz;
+	record.length = length;
+	strncpy(record.topic, topic, sizeof(record.topic) - 1);
+	record.topic[sizeof(record.topic) - 1] = '\0';
+
+	if ((data != nullptr) && (length > 0)) {
+		memcpy(record.data, data, length);
+	}
+
+	ring.head++;
+	_sent_records++;
+
+	pthread_cond_signal(&ring.data_available);
+	pthread_mutex_unlock(&ring.lock);
+
+	return 0;
+}
+
+void *uORB::ShmemChannel::ReceiveThreadTrampoline(void *arg)
+{
+	static_cast<uORB::ShmemChannel *>(arg)->ReceiveThread();
+	return nullptr;
+}
+
+void uORB::ShmemChannel::ReceiveThread()
+{
+	px4_prctl(PR_SET_NAME, "muorb_shmem_rx", px4_getpid());
+
+	muorb_shmem_ring_t &ring = _region->to_px4;
+	muorb_shmem_record_t record;
+
+	pthread_mutex_lock(&ring.lock);
+
+	while (!_should_exit) {
+
+		if (ring.tail == ring.head) {
+			// wake up at least once a second so a pending stop is noticed
+			struct timespec ts;
+#if defined(__PX4_LINUX)
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+			clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+			ts.tv_sec += 1;
+			pthread_cond_timedwait(&ring.data_available, &ring.lock, &ts);
+			continue;
+		}
+
+		// copy the record out so the handler runs without holding the shared lock
+		memcpy(&record, &ring.records[ring.tail & (MUORB_SHMEM_RING_SIZE - 1)], sizeof(record));
+		ring.tail++;
+		_received_records++;
+
+		pthread_mutex_unlock(&ring.lock);
+		DispatchRecord(record);
+		pthread_mutex_lock(&ring.lock);
+	}
+
+	pthread_mutex_unlock(&ring.lock);
+}
+
+void uORB::ShmemChannel::DispatchRecord(const muorb_shmem_record_t &record)
+{
+	if (_RxHandler == nullptr) {
+		return;
+	}
+
+	// ensure termination, the topic name crosses a trust boundary
+	char topic[MUORB_SHMEM_TOPIC_NAME_LEN];
+	strncpy(topic, record.topic, sizeof(topic) - 1);
+	topic[sizeof(topic) - 1] = '\0';
+
+	switch (record.type) {
+	case MUORB_SHMEM_RECORD_ADVERTISE:
+		_RxHandler->process_remote_topic(topic, true);
+		break;
+
+	case MUORB_SHMEM_RECORD_UNADVERTISE:
+		_RxHandler->process_remote_topic(topic, false);
+		break;
+
+	case MUORB_SHMEM_RECORD_SUBSCRIBE:
+		_RxHandler->process_add_subscription(topic, record.msg_rate_hz);
+		break;
+
+	case MUORB_SHMEM_RECORD_UNSUBSCRIBE:
+		_RxHandler->process_remove_subscription(topic);
+		break;
+
+	case MUORB_SHMEM_RECORD_TOPIC_DATA:
+		if (record.length <= MUORB_SHMEM_MAX_DATA_LEN) {
+			// the record is a stack copy, handing out mutable access is safe
+			_RxHandler->process_received_message(topic, record.length,
+							     const_cast<uint8_t *>(record.data));
+		}
+
+		break;
+
+	default:
+		PX4_ERR("unknown record type %" PRIu32, record.type);
+		break;
+	}
+}
+
+void uORB::ShmemChannel::PrintStatus()
+{
+	PX4_INFO("region: %s (%zu bytes)", MUORB_SHMEM_NAME, sizeof(muorb_shmem_region_t));
+	PX4_INFO("sent: %" PRIu32 " records (%" PRIu32 " overwritten, %" PRIu32 " oversize)",
+		 _sent_records, _region ? _region->to_companion.dropped : 0, _oversize_drops);
+	PX4_INFO("received: %" PRIu32 " records (%" PRIu32 " overwritten)",
+		 _received_records, _region ? _region->to_px4.dropped : 0);
+}
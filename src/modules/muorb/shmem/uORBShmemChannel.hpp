@@ -0,0 +1,118 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef _uORBShmemChannel_hpp_
+#define _uORBShmemChannel_hpp_
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/posix.h>
+#include <uORB/uORBCommunicator.hpp>
+
+#include "muorb_shmem.h"
+
+namespace uORB
+{
+class ShmemChannel;
+}
+
+/**
+ * uORB channel backed by a POSIX shared memory segment, for companion
+ * processes running on the same Linux system. Topic records are exchanged
+ * through two process-shared rings (see muorb_shmem.h), so an onboard link
+ * costs one memcpy per direction instead of MAVLink serialization, a UART
+ * and a parser.
+ */
+class uORB::ShmemChannel : public uORBCommunicator::IChannel
+{
+public:
+	/**
+	 * static method to get the IChannel Implementor.
+	 */
+	static uORB::ShmemChannel *GetInstance()
+	{
+		if (_InstancePtr == nullptr) {
+			_InstancePtr = new uORB::ShmemChannel();
+		}
+
+		return _InstancePtr;
+	}
+
+	/**
+	 * Static method to check if there is an instance.
+	 */
+	static bool isInstance()
+	{
+		return (_InstancePtr != nullptr);
+	}
+
+	bool Initialize();
+	void Stop();
+	bool isRunning() const { return _initialized; }
+	void PrintStatus();
+
+	// uORBCommunicator::IChannel
+	int16_t topic_advertised(const char *messageName) override;
+	int16_t add_subscription(const char *messageName, int32_t msgRateInHz) override;
+	int16_t remove_subscription(const char *messageName) override;
+	int16_t register_handler(uORBCommunicator::IChannelRxHandler *handler) override;
+	int16_t send_message(const char *messageName, int32_t length, uint8_t *data) override;
+
+private: // data members
+	static uORB::ShmemChannel *_InstancePtr;
+
+private: // class members.
+	/// constructor.
+	ShmemChannel() = default;
+
+	bool InitializeRing(muorb_shmem_ring_t &ring);
+	int16_t PushRecord(uint32_t type, const char *topic, int32_t msg_rate_hz, int32_t length, const uint8_t *data);
+	static void *ReceiveThreadTrampoline(void *arg);
+	void ReceiveThread();
+	void DispatchRecord(const muorb_shmem_record_t &record);
+
+	muorb_shmem_region_t *_region{nullptr};
+	uORBCommunicator::IChannelRxHandler *_RxHandler{nullptr};
+
+	pthread_t _recv_thread{};
+	volatile bool _should_exit{false};
+	bool _initialized{false};
+
+	uint32_t _sent_records{0};
+	uint32_t _received_records{0};
+	uint32_t _oversize_drops{0};
+};
+
+#endif /* _uORBShmemChannel_hpp_ */
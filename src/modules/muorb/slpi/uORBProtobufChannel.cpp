@@ -32,6 +32,7 @@
  ****************************************************************************/
 #include "uORBProtobufChannel.hpp"
 #include "MUORBTest.hpp"
+#include "../aggregator/MUORBAggregator.hpp"
 #include <string>
 
 #include <qurt.h>
@@ -45,6 +46,30 @@ static MUORBTestType test_to_run;
 
 fc_func_ptrs muorb_func_ptrs;
 
+// Aggregates high-rate topic data into blocks before crossing the FastRPC
+// boundary towards the apps processor
+static muorb::Aggregator topic_aggregator;
+
+static int aggregator_send_trampoline(const char *topic_name, const uint8_t *data, int data_len_in_bytes)
+{
+	if (muorb_func_ptrs.topic_data_func_ptr == nullptr) {
+		return -1;
+	}
+
+	return muorb_func_ptrs.topic_data_func_ptr(topic_name, data, data_len_in_bytes);
+}
+
+int muorb_send_topic_data_aggregated(const char *topic_name, const uint8_t *data, int data_len_in_bytes,
+				     uint64_t now_us)
+{
+	return topic_aggregator.Send(topic_name, data, (uint32_t) data_len_in_bytes, now_us);
+}
+
+int muorb_flush_aggregated_topic_data()
+{
+	return topic_aggregator.Flush();
+}
+
 static void test_runner(void *test)
 {
 	HAP_debug("test_runner called", 1, muorb_test_topic_name, 0);
@@ -83,6 +108,8 @@ int px4muorb_orb_initialize(fc_func_ptrs *func_ptrs, int32_t clock_offset_us)
 	// so they must be saved off here
 	if (func_ptrs != nullptr) { muorb_func_ptrs = *func_ptrs; }
 
+	topic_aggregator.SetSendFunc(&aggregator_send_trampoline);
+
 	HAP_debug("px4muorb_orb_initialize called", 1, "init", 0);
 
 	return 0;
@@ -130,9 +157,21 @@ int px4muorb_remove_subscriber(const char *topic_name)
 	return 0;
 }
 
+static void aggregate_receive_trampoline(const char *topic_name, const uint8_t *data, uint32_t length_in_bytes)
+{
+	(void) px4muorb_send_topic_data(topic_name, data, (int) length_in_bytes);
+}
+
 int px4muorb_send_topic_data(const char *topic_name, const uint8_t *data,
 			     int data_len_in_bytes)
 {
+	if (muorb::Aggregator::IsAggregate(topic_name)) {
+		// block of aggregated records from the apps processor: unpack and
+		// handle each one individually
+		muorb::Aggregator::Unpack(data, (uint32_t) data_len_in_bytes, &aggregate_receive_trampoline);
+		return 0;
+	}
+
 	if (IS_MUORB_TEST(topic_name)) {
 		// Validate the test data received
 		bool test_passed = true;
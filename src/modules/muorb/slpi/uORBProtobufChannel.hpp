@@ -75,4 +75,16 @@ extern "C" {
 	int px4muorb_send_topic_data(const char *name, const uint8_t *data, int data_len_in_bytes) __EXPORT;
 }
 
+/**
+ * Queue topic data for aggregated transfer to the apps processor: records
+ * are packed into blocks and flushed on fill or after a short interval,
+ * so high-rate topics cost a few FastRPC crossings per millisecond instead
+ * of one per publication (see muorb::Aggregator).
+ */
+int muorb_send_topic_data_aggregated(const char *topic_name, const uint8_t *data, int data_len_in_bytes,
+				     uint64_t now_us);
+
+/** Flush any pending aggregated topic data immediately. */
+int muorb_flush_aggregated_topic_data();
+
 #endif /* _uORBProtobufChannel_hpp_ */
@@ -175,6 +175,71 @@ void Geofence::_updateFence()
 
 	}
 
+	updateBoundingBoxes();
+}
+
+void Geofence::updateBoundingBoxes()
+{
+	// the full point-in-polygon test is expensive, as it reads every vertex from
+	// dataman. Precompute a bounding box per area so that a check only runs the
+	// full test on the areas the point can actually be in.
+	_check_cache_valid = false;
+
+	// margin covering the float rounding of the box and the spherical
+	// approximation of the circle radius (~10m)
+	static constexpr float margin_deg = 1e-4f;
+
+	for (int i = 0; i < _num_polygons; ++i) {
+		PolygonInfo &polygon = _polygons[i];
+
+		double lat_min = 90.0;
+		double lat_max = -90.0;
+		double lon_min = 180.0;
+		double lon_max = -180.0;
+
+		if (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION
+		    || polygon.fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION) {
+			mission_fence_point_s circle_point;
+
+			if (dm_read(DM_KEY_FENCE_POINTS, polygon.dataman_index, &circle_point,
+				    sizeof(mission_fence_point_s)) == sizeof(mission_fence_point_s)) {
+				const double radius_deg = (double)polygon.circle_radius /
+							  (CONSTANTS_RADIUS_OF_EARTH * M_PI / 180.0);
+				const double cos_lat = math::max(cos(math::radians(circle_point.lat)), 0.01);
+
+				lat_min = circle_point.lat - radius_deg;
+				lat_max = circle_point.lat + radius_deg;
+				lon_min = circle_point.lon - radius_deg / cos_lat;
+				lon_max = circle_point.lon + radius_deg / cos_lat;
+			}
+
+		} else {
+			for (unsigned v = 0; v < polygon.vertex_count; ++v) {
+				mission_fence_point_s vertex;
+
+				if (dm_read(DM_KEY_FENCE_POINTS, polygon.dataman_index + v, &vertex,
+					    sizeof(mission_fence_point_s)) != sizeof(mission_fence_point_s)) {
+					break;
+				}
+
+				lat_min = math::min(lat_min, vertex.lat);
+				lat_max = math::max(lat_max, vertex.lat);
+				lon_min = math::min(lon_min, vertex.lon);
+				lon_max = math::max(lon_max, vertex.lon);
+			}
+		}
+
+		polygon.lat_min = (float)lat_min - margin_deg;
+		polygon.lat_max = (float)lat_max + margin_deg;
+		polygon.lon_min = (float)lon_min - margin_deg;
+		polygon.lon_max = (float)lon_max + margin_deg;
+	}
+}
+
+bool Geofence::insideBoundingBox(const PolygonInfo &polygon, double lat, double lon) const
+{
+	return lat >= (double)polygon.lat_min && lat <= (double)polygon.lat_max
+	       && lon >= (double)polygon.lon_min && lon <= (double)polygon.lon_max;
 }
 
 bool Geofence::checkAll(const struct vehicle_global_position_s &global_position)
@@ -335,14 +400,26 @@ bool Geofence::isInsidePolygonOrCircle(double lat, double lon, float altitude)
 	}
 
 
-	/* Horizontal check: iterate all polygons & circles */
+	/* the horizontal result only depends on the position: serve repeated checks
+	 * from the same ~1m cell from the cache of the previous result */
+	const int32_t cell_lat = (int32_t)(lat * 1e5);
+	const int32_t cell_lon = (int32_t)(lon * 1e5);
+
+	if (_check_cache_valid && cell_lat == _check_cache_cell_lat && cell_lon == _check_cache_cell_lon) {
+		dm_unlock(DM_KEY_FENCE_POINTS);
+		return _check_cache_result;
+	}
+
+	/* Horizontal check: iterate all polygons & circles the point can be in */
 	bool outside_exclusion = true;
 	bool inside_inclusion = false;
 	bool had_inclusion_areas = false;
 
 	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		const bool in_bounding_box = insideBoundingBox(_polygons[polygon_index], lat, lon);
+
 		if (_polygons[polygon_index].fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION) {
-			bool inside = insideCircle(_polygons[polygon_index], lat, lon, altitude);
+			bool inside = in_bounding_box && insideCircle(_polygons[polygon_index], lat, lon, altitude);
 
 			if (inside) {
 				inside_inclusion = true;
@@ -351,14 +428,14 @@ bool Geofence::isInsidePolygonOrCircle(double lat, double lon, float altitude)
 			had_inclusion_areas = true;
 
 		} else if (_polygons[polygon_index].fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION) {
-			bool inside = insideCircle(_polygons[polygon_index], lat, lon, altitude);
+			bool inside = in_bounding_box && insideCircle(_polygons[polygon_index], lat, lon, altitude);
 
 			if (inside) {
 				outside_exclusion = false;
 			}
 
 		} else { // it's a polygon
-			bool inside = insidePolygon(_polygons[polygon_index], lat, lon, altitude);
+			bool inside = in_bounding_box && insidePolygon(_polygons[polygon_index], lat, lon, altitude);
 
 			if (_polygons[polygon_index].fence_type == NAV_CMD_FENCE_POLYGON_VERTEX_INCLUSION) {
 				if (inside) {
@@ -375,9 +452,16 @@ bool Geofence::isInsidePolygonOrCircle(double lat, double lon, float altitude)
 		}
 	}
 
+	const bool inside_fence = (!had_inclusion_areas || inside_inclusion) && outside_exclusion;
+
+	_check_cache_cell_lat = cell_lat;
+	_check_cache_cell_lon = cell_lon;
+	_check_cache_result = inside_fence;
+	_check_cache_valid = true;
+
 	dm_unlock(DM_KEY_FENCE_POINTS);
 
-	return (!had_inclusion_areas || inside_inclusion) && outside_exclusion;
+	return inside_fence;
 }
 
 bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon, float altitude)
@@ -393,13 +477,15 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 	mission_fence_point_s temp_vertex_j{};
 	bool c = false;
 
-	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
-		if (dm_read(DM_KEY_FENCE_POINTS, polygon.dataman_index + i, &temp_vertex_i,
-			    sizeof(mission_fence_point_s)) != sizeof(mission_fence_point_s)) {
-			break;
-		}
+	/* start with the edge closing the polygon, afterwards the previous vertex is
+	 * reused, so that each vertex is only read once */
+	if (dm_read(DM_KEY_FENCE_POINTS, polygon.dataman_index + polygon.vertex_count - 1, &temp_vertex_j,
+		    sizeof(mission_fence_point_s)) != sizeof(mission_fence_point_s)) {
+		return false;
+	}
 
-		if (dm_read(DM_KEY_FENCE_POINTS, polygon.dataman_index + j, &temp_vertex_j,
+	for (unsigned i = 0; i < polygon.vertex_count; i++) {
+		if (dm_read(DM_KEY_FENCE_POINTS, polygon.dataman_index + i, &temp_vertex_i,
 			    sizeof(mission_fence_point_s)) != sizeof(mission_fence_point_s)) {
 			break;
 		}
@@ -417,6 +503,8 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 		     (double)(temp_vertex_j.lon - temp_vertex_i.lon) + (double)temp_vertex_i.lat)) {
 			c = !c;
 		}
+
+		temp_vertex_j = temp_vertex_i;
 	}
 
 	return c;
@@ -161,6 +161,10 @@ private:
 			uint16_t vertex_count;
 			float circle_radius;
 		};
+		float lat_min;	///< bounding box of the area, expanded by a small margin [deg]
+		float lat_max;
+		float lon_min;
+		float lon_max;
 	};
 
 	Navigator   *_navigator{nullptr};
@@ -181,11 +185,28 @@ private:
 	int _outside_counter{0};
 	uint16_t _update_counter{0}; ///< dataman update counter: if it does not match, we polygon data was updated
 
+	int32_t _check_cache_cell_lat{0};	///< quantized position of the last horizontal check
+	int32_t _check_cache_cell_lon{0};
+	bool _check_cache_valid{false};
+	bool _check_cache_result{false};	///< cached result of the last horizontal check
+
 	/**
 	 * implementation of updateFence(), but without locking
 	 */
 	void _updateFence();
 
+	/**
+	 * Recompute the bounding box of each polygon and circle, so that checks can
+	 * cheaply skip areas the tested point cannot be in. Must be called whenever
+	 * the polygon list changed.
+	 */
+	void updateBoundingBoxes();
+
+	/**
+	 * Check if a point is within the precomputed bounding box of an area
+	 */
+	bool insideBoundingBox(const PolygonInfo &polygon, double lat, double lon) const;
+
 	/**
 	 * Check if a point passes the Geofence test.
 	 * This takes all polygons and minimum & maximum altitude into account
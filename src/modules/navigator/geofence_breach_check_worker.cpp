@@ -0,0 +1,164 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file geofence_breach_check_worker.cpp
+ */
+
+#include "geofence_breach_check_worker.h"
+
+#include "geofence.h"
+
+#include <uORB/topics/geofence_result.h>
+
+GeofenceBreachCheckWorker::GeofenceBreachCheckWorker(ModuleParams *parent, Geofence &geofence) :
+	ModuleParams(parent),
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default),
+	_geofence(geofence),
+	_gf_breach_avoidance(this)
+{
+	pthread_mutex_init(&_inputs_mutex, nullptr);
+}
+
+GeofenceBreachCheckWorker::~GeofenceBreachCheckWorker()
+{
+	ScheduleClear();
+	pthread_mutex_destroy(&_inputs_mutex);
+}
+
+void GeofenceBreachCheckWorker::setInputs(const Inputs &inputs)
+{
+	pthread_mutex_lock(&_inputs_mutex);
+	_inputs = inputs;
+	pthread_mutex_unlock(&_inputs_mutex);
+}
+
+void GeofenceBreachCheckWorker::Run()
+{
+	if (_parameter_update_sub.updated()) {
+		parameter_update_s pupdate;
+		_parameter_update_sub.copy(&pupdate);
+		_gf_breach_avoidance.updateParameters();
+	}
+
+	pthread_mutex_lock(&_inputs_mutex);
+	const Inputs inputs = _inputs;
+	_inputs.fresh = false;
+	pthread_mutex_unlock(&_inputs_mutex);
+
+	if (!inputs.fresh) {
+		return;
+	}
+
+	// Note: the fence evaluations below are safe to run concurrently with
+	// the checks on the navigator thread, the polygon iteration and the
+	// fence reload are serialized through the dataman item lock.
+
+	float vertical_test_point_distance;
+	float test_point_distance;
+
+	if (inputs.is_rotary_wing) {
+		_gf_breach_avoidance.setHorizontalVelocity(inputs.velocity_hor_abs);
+		_gf_breach_avoidance.setClimbRate(inputs.climbrate);
+		test_point_distance = _gf_breach_avoidance.computeBrakingDistanceMultirotor();
+		vertical_test_point_distance = _gf_breach_avoidance.computeVerticalBrakingDistanceMultirotor();
+
+	} else {
+		test_point_distance = 2.0f * inputs.loiter_radius;
+		vertical_test_point_distance = 5.0f;
+	}
+
+	_gf_breach_avoidance.setHorizontalTestPointDistance(test_point_distance);
+	_gf_breach_avoidance.setVerticalTestPointDistance(vertical_test_point_distance);
+	_gf_breach_avoidance.setTestPointBearing(inputs.test_point_bearing);
+	_gf_breach_avoidance.setCurrentPosition(inputs.lat, inputs.lon, inputs.alt_amsl);
+	_gf_breach_avoidance.setMaxHorDistHome(_geofence.getMaxHorDistanceHome());
+	_gf_breach_avoidance.setMaxVerDistHome(_geofence.getMaxVerDistanceHome());
+
+	if (inputs.home_valid) {
+		_gf_breach_avoidance.setHomePosition(inputs.home_lat, inputs.home_lon, inputs.home_alt_amsl);
+	}
+
+	matrix::Vector2<double> fence_violation_test_point;
+
+	if (_geofence.getPredict()) {
+		fence_violation_test_point = _gf_breach_avoidance.getFenceViolationTestPoint();
+
+	} else {
+		fence_violation_test_point = matrix::Vector2d(inputs.lat, inputs.lon);
+		vertical_test_point_distance = 0;
+	}
+
+	geofence_violation_type_u gf_violation_type{};
+
+	gf_violation_type.flags.dist_to_home_exceeded = !_geofence.isCloserThanMaxDistToHome(fence_violation_test_point(0),
+			fence_violation_test_point(1),
+			inputs.alt_amsl);
+
+	gf_violation_type.flags.max_altitude_exceeded = !_geofence.isBelowMaxAltitude(inputs.alt_amsl +
+			vertical_test_point_distance);
+
+	gf_violation_type.flags.fence_violation = !_geofence.isInsidePolygonOrCircle(fence_violation_test_point(0),
+			fence_violation_test_point(1),
+			inputs.alt_amsl);
+
+	geofence_breach_prediction_s prediction{};
+	prediction.violation_flags = gf_violation_type.value;
+	prediction.geofence_violated = (gf_violation_type.value != 0);
+
+	if (gf_violation_type.value && (_geofence.getGeofenceAction() == geofence_result_s::GF_ACTION_LOITER)) {
+		// precompute the breach avoidance loiter point so the navigator only has
+		// to fill in the reposition triplet when it decides to act
+		matrix::Vector2<double> loiter_center_lat_lon;
+		float loiter_altitude_amsl = inputs.alt_amsl;
+
+		if (inputs.is_rotary_wing) {
+			// the computation of the braking distance does not match the actual braking distance. Until we have a better model
+			// we set the loiter point to the current position, that will make sure that the vehicle will loiter inside the fence
+			loiter_center_lat_lon = _gf_breach_avoidance.generateLoiterPointForMultirotor(gf_violation_type, &_geofence);
+			loiter_altitude_amsl = _gf_breach_avoidance.generateLoiterAltitudeForMulticopter(gf_violation_type);
+
+		} else {
+			loiter_center_lat_lon = _gf_breach_avoidance.generateLoiterPointForFixedWing(gf_violation_type, &_geofence);
+			loiter_altitude_amsl = _gf_breach_avoidance.generateLoiterAltitudeForFixedWing(gf_violation_type);
+		}
+
+		prediction.loiter_point_valid = true;
+		prediction.loiter_lat = loiter_center_lat_lon(0);
+		prediction.loiter_lon = loiter_center_lat_lon(1);
+		prediction.loiter_altitude_amsl = loiter_altitude_amsl;
+	}
+
+	prediction.timestamp = hrt_absolute_time();
+	_geofence_breach_prediction_pub.publish(prediction);
+}
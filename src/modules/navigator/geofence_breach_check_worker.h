@@ -0,0 +1,102 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file geofence_breach_check_worker.h
+ * Background work item running the predictive geofence checks so the
+ * navigator cycle time stays constant even with complex fence shapes.
+ */
+
+#pragma once
+
+#include <pthread.h>
+
+#include <px4_platform_common/module_params.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/topics/geofence_breach_prediction.h>
+#include <uORB/topics/parameter_update.h>
+
+#include "GeofenceBreachAvoidance/geofence_breach_avoidance.h"
+
+class Geofence;
+
+class GeofenceBreachCheckWorker : public ModuleParams, public px4::ScheduledWorkItem
+{
+public:
+	/**
+	 * Snapshot of the navigator state the predictive check needs, handed
+	 * over to the work queue thread.
+	 */
+	struct Inputs {
+		double lat;
+		double lon;
+		float alt_amsl;
+
+		double home_lat;
+		double home_lon;
+		float home_alt_amsl;
+		bool home_valid;
+
+		float test_point_bearing;
+		float velocity_hor_abs;
+		float climbrate;
+		float loiter_radius;
+		bool is_rotary_wing;
+
+		bool fresh;	///< set by the navigator, cleared once consumed
+	};
+
+	GeofenceBreachCheckWorker(ModuleParams *parent, Geofence &geofence);
+	~GeofenceBreachCheckWorker() override;
+
+	void start() { ScheduleOnInterval(GEOFENCE_CHECK_INTERVAL_US); }
+
+	/**
+	 * Update the state the next check runs on (called from the navigator thread)
+	 */
+	void setInputs(const Inputs &inputs);
+
+private:
+	void Run() override;
+
+	Geofence &_geofence;
+	GeofenceBreachAvoidance _gf_breach_avoidance;
+
+	pthread_mutex_t _inputs_mutex;
+	Inputs _inputs{};
+
+	uORB::Publication<geofence_breach_prediction_s> _geofence_breach_prediction_pub{ORB_ID(geofence_breach_prediction)};
+	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
+};
@@ -201,6 +201,8 @@ Mission::on_activation()
 	// we already reset the mission items
 	_execution_mode_changed = false;
 
+	prefetch_mission_items();
+
 	set_mission_items();
 
 	// unpause triggering if it was paused
@@ -245,6 +247,10 @@ Mission::on_active()
 		set_mission_items();
 	}
 
+	/* top up the look-ahead cache in the background so that the next waypoint
+	 * transitions are served from RAM */
+	prefetch_mission_items();
+
 	/* lets check if we reached the current mission item */
 	if (_mission_type != MISSION_TYPE_NONE && is_mission_item_reached_or_completed()) {
 		/* If we just completed a takeoff which was inserted before the right waypoint,
@@ -513,6 +519,9 @@ Mission::update_mission()
 	 * an existing ROI setting from previous missions */
 	_navigator->reset_vroi();
 
+	/* the stored mission is about to change, cached items may be stale */
+	invalidate_mission_item_cache();
+
 	const mission_s old_mission = _mission;
 
 	if (_mission_sub.copy(&_mission)) {
@@ -604,9 +613,8 @@ Mission::advance_mission()
 
 				for (int32_t i = _current_mission_index - 1; i >= 0; i--) {
 					struct mission_item_s missionitem = {};
-					const ssize_t len = sizeof(missionitem);
 
-					if (dm_read(dm_current, i, &missionitem, len) != len) {
+					if (!load_mission_item(dm_current, i, &missionitem)) {
 						/* not supposed to happen unless the datamanager can't access the SD card, etc. */
 						PX4_ERR("dataman read failure");
 						break;
@@ -1573,8 +1581,8 @@ Mission::read_mission_item(int offset, struct mission_item_s *mission_item)
 		/* read mission item to temp storage first to not overwrite current mission item if data damaged */
 		struct mission_item_s mission_item_tmp;
 
-		/* read mission item from datamanager */
-		if (dm_read(dm_item, *mission_index_ptr, &mission_item_tmp, len) != len) {
+		/* read mission item from the look-ahead cache or the datamanager */
+		if (!load_mission_item(dm_item, *mission_index_ptr, &mission_item_tmp)) {
 			/* not supposed to happen unless the datamanager can't access the SD card, etc. */
 			mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Waypoint could not be read.\t");
 			events::send<uint16_t>(events::ID("mission_failed_to_read_wp"), events::Log::Error,
@@ -1603,6 +1611,8 @@ Mission::read_mission_item(int offset, struct mission_item_s *mission_item)
 						return false;
 					}
 
+					update_cached_mission_item(dm_item, *mission_index_ptr, mission_item_tmp);
+
 					report_do_jump_mission_changed(*mission_index_ptr, mission_item_tmp.do_jump_repeat_count);
 				}
 
@@ -1639,6 +1649,82 @@ Mission::read_mission_item(int offset, struct mission_item_s *mission_item)
 	return false;
 }
 
+void
+Mission::prefetch_mission_items()
+{
+	if (_mission.count == 0 || _current_mission_index < 0 || _current_mission_index >= (int)_mission.count) {
+		invalidate_mission_item_cache();
+		return;
+	}
+
+	/* in reverse execution the mission is flown towards lower indices */
+	int32_t window_start = _current_mission_index;
+
+	if (_mission_execution_mode == mission_result_s::MISSION_EXECUTION_MODE_REVERSE) {
+		window_start = math::max(_current_mission_index - (MISSION_ITEM_CACHE_SIZE - 1), (int32_t)0);
+	}
+
+	const int32_t window_count = math::min(MISSION_ITEM_CACHE_SIZE, (int32_t)_mission.count - window_start);
+
+	if (_mission_item_cache_count == window_count && _mission_item_cache_first == window_start
+	    && _mission_item_cache_dataman_id == _mission.dataman_id) {
+		/* the cache already covers the window */
+		return;
+	}
+
+	int32_t reuse = 0;
+
+	if ((_mission_item_cache_count > 0) && (_mission_item_cache_dataman_id == _mission.dataman_id)
+	    && (window_start >= _mission_item_cache_first)
+	    && (window_start < _mission_item_cache_first + _mission_item_cache_count)) {
+		/* the windows overlap: shift the still valid tail to the front and only read the new items */
+		const int32_t shift = window_start - _mission_item_cache_first;
+		reuse = math::min(_mission_item_cache_count - shift, window_count);
+
+		if (shift > 0) {
+			memmove(&_mission_item_cache[0], &_mission_item_cache[shift], reuse * sizeof(mission_item_s));
+		}
+	}
+
+	_mission_item_cache_first = window_start;
+	_mission_item_cache_dataman_id = _mission.dataman_id;
+	_mission_item_cache_count = reuse;
+
+	const dm_item_t dm_item = (dm_item_t)_mission.dataman_id;
+	const ssize_t len = sizeof(mission_item_s);
+
+	for (int32_t i = reuse; i < window_count; i++) {
+		if (dm_read(dm_item, window_start + i, &_mission_item_cache[i], len) != len) {
+			/* keep the prefix that was read, misses fall back to dataman */
+			break;
+		}
+
+		_mission_item_cache_count = i + 1;
+	}
+}
+
+bool
+Mission::load_mission_item(dm_item_t dm_item, int32_t index, struct mission_item_s *mission_item)
+{
+	if ((dm_item == _mission_item_cache_dataman_id) && (index >= _mission_item_cache_first)
+	    && (index < _mission_item_cache_first + _mission_item_cache_count)) {
+		*mission_item = _mission_item_cache[index - _mission_item_cache_first];
+		return true;
+	}
+
+	const ssize_t len = sizeof(mission_item_s);
+	return dm_read(dm_item, index, mission_item, len) == len;
+}
+
+void
+Mission::update_cached_mission_item(dm_item_t dm_item, int32_t index, const struct mission_item_s &mission_item)
+{
+	if ((dm_item == _mission_item_cache_dataman_id) && (index >= _mission_item_cache_first)
+	    && (index < _mission_item_cache_first + _mission_item_cache_count)) {
+		_mission_item_cache[index - _mission_item_cache_first] = mission_item;
+	}
+}
+
 void
 Mission::save_mission_state()
 {
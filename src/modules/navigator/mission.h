@@ -191,6 +191,31 @@ private:
 	 */
 	bool read_mission_item(int offset, struct mission_item_s *mission_item);
 
+	/**
+	 * Refresh the look-ahead cache so that the mission items around the current
+	 * index can be served from RAM and waypoint transitions do not have to wait
+	 * for dataman storage
+	 */
+	void prefetch_mission_items();
+
+	/**
+	 * Drop all cached mission items (call whenever the stored mission changes)
+	 */
+	void invalidate_mission_item_cache() { _mission_item_cache_count = 0; }
+
+	/**
+	 * Fetch a single mission item, from the look-ahead cache when possible,
+	 * falling back to a dataman read otherwise
+	 *
+	 * @return true if successful
+	 */
+	bool load_mission_item(dm_item_t dm_item, int32_t index, struct mission_item_s *mission_item);
+
+	/**
+	 * Keep a cached mission item in sync after it has been rewritten in dataman
+	 */
+	void update_cached_mission_item(dm_item_t dm_item, int32_t index, const struct mission_item_s &mission_item);
+
 	/**
 	 * Save current mission state to dataman
 	 */
@@ -253,6 +278,13 @@ private:
 
 	int32_t _current_mission_index{-1};
 
+	static constexpr int32_t MISSION_ITEM_CACHE_SIZE = 10;	/**< look-ahead window of mission items kept in RAM */
+
+	mission_item_s _mission_item_cache[MISSION_ITEM_CACHE_SIZE] {};
+	int32_t _mission_item_cache_first{0};	/**< mission index of the first cached item */
+	int32_t _mission_item_cache_count{0};	/**< number of valid cached items, 0 if the cache is empty */
+	uint8_t _mission_item_cache_dataman_id{DM_KEY_WAYPOINTS_OFFBOARD_0};	/**< dataman id the cached items were read from */
+
 	// track location of planned mission landing
 	bool	_land_start_available{false};
 	uint16_t _land_start_index{UINT16_MAX};		/**< index of DO_LAND_START, INVALID_DO_LAND_START if no planned landing */
@@ -189,6 +189,12 @@ MissionBlock::is_mission_item_reached_or_completed()
 		break;
 	}
 
+	// compile the fixed per-item constraints once, the cyclic checks below then
+	// only compare against them
+	if (!_acceptance_plan.compiled || _acceptance_plan.home_timestamp != _navigator->get_home_position()->timestamp) {
+		compile_acceptance_plan();
+	}
+
 	// Update the 'waypoint position reached' status
 	if (!_navigator->get_land_detected()->landed && !_waypoint_position_reached) {
 
@@ -196,7 +202,7 @@ MissionBlock::is_mission_item_reached_or_completed()
 		float dist_xy = -1.0f;
 		float dist_z = -1.0f;
 
-		const float mission_item_altitude_amsl = get_absolute_altitude_for_item(_mission_item);
+		const float mission_item_altitude_amsl = _acceptance_plan.altitude_amsl;
 
 		dist = get_distance_to_point_global_wgs84(_mission_item.lat, _mission_item.lon, mission_item_altitude_amsl,
 				_navigator->get_global_position()->lat,
@@ -211,9 +217,7 @@ MissionBlock::is_mission_item_reached_or_completed()
 			 * the altitude of the takeoff waypoint above home. Otherwise, we do not really follow
 			 * take-off procedures like leaving the landing gear down. */
 
-			float takeoff_alt = _mission_item.altitude_is_relative ?
-					    _mission_item.altitude :
-					    (_mission_item.altitude - _navigator->get_home_position()->alt);
+			const float takeoff_alt = _acceptance_plan.takeoff_altitude;
 
 			float altitude_acceptance_radius = _navigator->get_altitude_acceptance_radius();
 
@@ -467,15 +471,12 @@ MissionBlock::is_mission_item_reached_or_completed()
 			struct position_setpoint_s *curr_sp_new = &_navigator->get_position_setpoint_triplet()->current;
 			const position_setpoint_s &next_sp = _navigator->get_position_setpoint_triplet()->next;
 
-			const float dist_current_next = get_distance_to_next_waypoint(curr_sp_new->lat, curr_sp_new->lon, next_sp.lat,
-							next_sp.lon);
+			const float dist_current_next = _acceptance_plan.loiter_exit_dist_to_next;
 
 			/* enforce exit course if in FW, the next wp is valid, the vehicle is currently loitering and either having force_heading set,
 			   or if loitering to achieve altitdue at a NAV_CMD_WAYPOINT */
 			const bool enforce_exit_course = _navigator->get_vstatus()->vehicle_type != vehicle_status_s::VEHICLE_TYPE_ROTARY_WING
-							 && next_sp.valid
-							 && curr_sp_new->type == position_setpoint_s::SETPOINT_TYPE_LOITER
-							 && (_mission_item.force_heading || _mission_item.nav_cmd == NAV_CMD_WAYPOINT);
+							 && _acceptance_plan.loiter_exit_enforced;
 
 			// can only enforce exit course if next waypoint is not within loiter radius of current waypoint
 			const bool exit_course_is_reachable = dist_current_next > 1.2f * curr_sp_new->loiter_radius;
@@ -548,6 +549,34 @@ MissionBlock::reset_mission_item_reached()
 	_waypoint_position_reached = false;
 	_waypoint_yaw_reached = false;
 	_time_wp_reached = 0;
+
+	// a new item is becoming current, the acceptance constraints are compiled
+	// again on the next reached-check (once the setpoint triplet is in place)
+	_acceptance_plan.compiled = false;
+}
+
+void
+MissionBlock::compile_acceptance_plan()
+{
+	_acceptance_plan.altitude_amsl = get_absolute_altitude_for_item(_mission_item);
+	_acceptance_plan.takeoff_altitude = _mission_item.altitude_is_relative ?
+					    _mission_item.altitude :
+					    (_mission_item.altitude - _navigator->get_home_position()->alt);
+
+	const position_setpoint_s &curr_sp = _navigator->get_position_setpoint_triplet()->current;
+	const position_setpoint_s &next_sp = _navigator->get_position_setpoint_triplet()->next;
+
+	_acceptance_plan.loiter_exit_dist_to_next = get_distance_to_next_waypoint(curr_sp.lat, curr_sp.lon,
+			next_sp.lat, next_sp.lon);
+
+	/* the exit course is only enforced if the next wp is valid, the vehicle is loitering and
+	   either has force_heading set, or is loitering to achieve altitude at a NAV_CMD_WAYPOINT */
+	_acceptance_plan.loiter_exit_enforced = next_sp.valid
+						&& curr_sp.type == position_setpoint_s::SETPOINT_TYPE_LOITER
+						&& (_mission_item.force_heading || _mission_item.nav_cmd == NAV_CMD_WAYPOINT);
+
+	_acceptance_plan.home_timestamp = _navigator->get_home_position()->timestamp;
+	_acceptance_plan.compiled = true;
 }
 
 void
@@ -200,8 +200,32 @@ protected:
 
 	float get_absolute_altitude_for_item(const mission_item_s &mission_item) const;
 
+	/**
+	 * Constraints of the current mission item that stay fixed while the item is active.
+	 *
+	 * Compiled once on the first reached-check after a new item becomes current
+	 * (and whenever home moves), so the per-cycle checks reduce to comparisons
+	 * against precomputed values instead of re-deriving altitudes and loiter exit
+	 * geometry from parameters and setpoints on every navigator cycle.
+	 */
+	struct ItemAcceptancePlan {
+		float altitude_amsl;		/**< absolute target altitude of the item */
+		float takeoff_altitude;		/**< takeoff altitude above home */
+		float loiter_exit_dist_to_next;	/**< distance from current to next position setpoint */
+		bool loiter_exit_enforced;	/**< exit course must point at the next waypoint before leaving */
+		hrt_abstime home_timestamp;	/**< home position the plan was compiled against */
+		bool compiled;
+	};
+
+	/**
+	 * Compile the acceptance constraints of the current mission item
+	 */
+	void compile_acceptance_plan();
+
 	mission_item_s _mission_item{}; // Current mission item that is being executed
 
+	ItemAcceptancePlan _acceptance_plan{};
+
 	bool _waypoint_position_reached{false};
 	bool _waypoint_yaw_reached{false};
 
@@ -53,7 +53,7 @@
 
 #include "navigation.h"
 
-#include "GeofenceBreachAvoidance/geofence_breach_avoidance.h"
+#include "geofence_breach_check_worker.h"
 
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/module.h>
@@ -344,6 +344,7 @@ private:
 	uORB::Subscription _home_pos_sub{ORB_ID(home_position)};		/**< home position subscription */
 	uORB::Subscription _land_detected_sub{ORB_ID(vehicle_land_detected)};	/**< vehicle land detected subscription */
 	uORB::Subscription _pos_ctrl_landing_status_sub{ORB_ID(position_controller_landing_status)};	/**< position controller landing status subscription */
+	uORB::Subscription _geofence_breach_prediction_sub{ORB_ID(geofence_breach_prediction)};	/**< predictive geofence check results from the background worker */
 	uORB::Subscription _traffic_sub{ORB_ID(transponder_report)};		/**< traffic subscription */
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};	/**< vehicle commands (onboard and offboard) */
 
@@ -377,7 +378,7 @@ private:
 	perf_counter_t	_loop_perf;			/**< loop performance counter */
 
 	Geofence	_geofence;			/**< class that handles the geofence */
-	GeofenceBreachAvoidance _gf_breach_avoidance;
+	GeofenceBreachCheckWorker _gf_breach_check_worker;
 	hrt_abstime _last_geofence_check = 0;
 
 	bool		_geofence_violation_warning_sent{false};	/**< prevents spaming to mavlink */
@@ -70,7 +70,7 @@ Navigator::Navigator() :
 	ModuleParams(nullptr),
 	_loop_perf(perf_alloc(PC_ELAPSED, "navigator")),
 	_geofence(this),
-	_gf_breach_avoidance(this),
+	_gf_breach_check_worker(this, _geofence),
 	_mission(this),
 	_loiter(this),
 	_takeoff(this),
@@ -150,6 +150,8 @@ void Navigator::run()
 
 	params_update();
 
+	_gf_breach_check_worker.start();
+
 	/* wakeup source(s) */
 	px4_pollfd_struct_t fds[3] {};
 
@@ -801,75 +803,65 @@ void Navigator::geofence_breach_check(bool &have_geofence_position_data)
 	    (_geofence.getGeofenceAction() != geofence_result_s::GF_ACTION_NONE) &&
 	    (hrt_elapsed_time(&_last_geofence_check) > GEOFENCE_CHECK_INTERVAL_US)) {
 
-		const position_controller_status_s &pos_ctrl_status = _position_controller_status_sub.get();
+		// hand the current state to the background worker which runs the
+		// expensive predictive fence evaluation off the navigator thread
+		GeofenceBreachCheckWorker::Inputs inputs{};
 
-		matrix::Vector2<double> fence_violation_test_point;
-		geofence_violation_type_u gf_violation_type{};
-		float test_point_bearing;
-		float test_point_distance;
-		float vertical_test_point_distance;
-		char geofence_violation_warning[50];
+		inputs.lat = _global_pos.lat;
+		inputs.lon = _global_pos.lon;
+		inputs.alt_amsl = _global_pos.alt;
 
 		if (_vstatus.vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING) {
-			test_point_bearing = atan2f(_local_pos.vy, _local_pos.vx);
-			const float velocity_hor_abs = sqrtf(_local_pos.vx * _local_pos.vx + _local_pos.vy * _local_pos.vy);
-			_gf_breach_avoidance.setHorizontalVelocity(velocity_hor_abs);
-			_gf_breach_avoidance.setClimbRate(-_local_pos.vz);
-			test_point_distance = _gf_breach_avoidance.computeBrakingDistanceMultirotor();
-			vertical_test_point_distance = _gf_breach_avoidance.computeVerticalBrakingDistanceMultirotor();
+			inputs.is_rotary_wing = true;
+			inputs.test_point_bearing = atan2f(_local_pos.vy, _local_pos.vx);
+			inputs.velocity_hor_abs = sqrtf(_local_pos.vx * _local_pos.vx + _local_pos.vy * _local_pos.vy);
+			inputs.climbrate = -_local_pos.vz;
 
 		} else {
-			test_point_distance = 2.0f * get_loiter_radius();
-			vertical_test_point_distance = 5.0f;
+			const position_controller_status_s &pos_ctrl_status = _position_controller_status_sub.get();
+
+			inputs.loiter_radius = get_loiter_radius();
 
 			if (hrt_absolute_time() - pos_ctrl_status.timestamp < 100000 && PX4_ISFINITE(pos_ctrl_status.nav_bearing)) {
-				test_point_bearing = pos_ctrl_status.nav_bearing;
+				inputs.test_point_bearing = pos_ctrl_status.nav_bearing;
 
 			} else {
-				test_point_bearing = atan2f(_local_pos.vy, _local_pos.vx);
+				inputs.test_point_bearing = atan2f(_local_pos.vy, _local_pos.vx);
 			}
 		}
 
-		_gf_breach_avoidance.setHorizontalTestPointDistance(test_point_distance);
-		_gf_breach_avoidance.setVerticalTestPointDistance(vertical_test_point_distance);
-		_gf_breach_avoidance.setTestPointBearing(test_point_bearing);
-		_gf_breach_avoidance.setCurrentPosition(_global_pos.lat, _global_pos.lon, _global_pos.alt);
-		_gf_breach_avoidance.setMaxHorDistHome(_geofence.getMaxHorDistanceHome());
-		_gf_breach_avoidance.setMaxVerDistHome(_geofence.getMaxVerDistanceHome());
-
 		if (home_global_position_valid()) {
-			_gf_breach_avoidance.setHomePosition(_home_pos.lat, _home_pos.lon, _home_pos.alt);
+			inputs.home_valid = true;
+			inputs.home_lat = _home_pos.lat;
+			inputs.home_lon = _home_pos.lon;
+			inputs.home_alt_amsl = _home_pos.alt;
 		}
 
+		inputs.fresh = true;
+		_gf_breach_check_worker.setInputs(inputs);
+
+		_last_geofence_check = hrt_absolute_time();
+		have_geofence_position_data = false;
+	}
+
+	geofence_breach_prediction_s prediction;
+
+	if (_geofence_breach_prediction_sub.update(&prediction)) {
+
+		char geofence_violation_warning[50];
+
 		if (_geofence.getPredict()) {
-			fence_violation_test_point = _gf_breach_avoidance.getFenceViolationTestPoint();
 			snprintf(geofence_violation_warning, sizeof(geofence_violation_warning), "Approaching on geofence");
 
 		} else {
-			fence_violation_test_point = matrix::Vector2d(_global_pos.lat, _global_pos.lon);
-			vertical_test_point_distance = 0;
 			snprintf(geofence_violation_warning, sizeof(geofence_violation_warning), "Geofence exceeded");
 		}
 
-		gf_violation_type.flags.dist_to_home_exceeded = !_geofence.isCloserThanMaxDistToHome(fence_violation_test_point(0),
-				fence_violation_test_point(1),
-				_global_pos.alt);
-
-		gf_violation_type.flags.max_altitude_exceeded = !_geofence.isBelowMaxAltitude(_global_pos.alt +
-				vertical_test_point_distance);
-
-		gf_violation_type.flags.fence_violation = !_geofence.isInsidePolygonOrCircle(fence_violation_test_point(0),
-				fence_violation_test_point(1),
-				_global_pos.alt);
-
-		_last_geofence_check = hrt_absolute_time();
-		have_geofence_position_data = false;
-
 		_geofence_result.timestamp = hrt_absolute_time();
 		_geofence_result.geofence_action = _geofence.getGeofenceAction();
 		_geofence_result.home_required = _geofence.isHomeRequired();
 
-		if (gf_violation_type.value) {
+		if (prediction.geofence_violated) {
 			/* inform other apps via the mission result */
 			_geofence_result.geofence_violated = true;
 
@@ -880,35 +872,16 @@ void Navigator::geofence_breach_check(bool &have_geofence_position_data)
 					     geofence_violation_warning);
 
 				// we have predicted a geofence violation and if the action is to loiter then
-				// demand a reposition to a location which is inside the geofence
-				if (_geofence.getGeofenceAction() == geofence_result_s::GF_ACTION_LOITER) {
+				// demand a reposition to the precomputed location inside the geofence
+				if (_geofence.getGeofenceAction() == geofence_result_s::GF_ACTION_LOITER && prediction.loiter_point_valid) {
 					position_setpoint_triplet_s *rep = get_reposition_triplet();
 
-					matrix::Vector2<double> loiter_center_lat_lon;
-					matrix::Vector2<double> current_pos_lat_lon(_global_pos.lat, _global_pos.lon);
-					float loiter_altitude_amsl = _global_pos.alt;
-
-
-					if (_vstatus.vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING) {
-						// the computation of the braking distance does not match the actual braking distance. Until we have a better model
-						// we set the loiter point to the current position, that will make sure that the vehicle will loiter inside the fence
-						loiter_center_lat_lon =  _gf_breach_avoidance.generateLoiterPointForMultirotor(gf_violation_type,
-									 &_geofence);
-
-						loiter_altitude_amsl = _gf_breach_avoidance.generateLoiterAltitudeForMulticopter(gf_violation_type);
-
-					} else {
-
-						loiter_center_lat_lon = _gf_breach_avoidance.generateLoiterPointForFixedWing(gf_violation_type, &_geofence);
-						loiter_altitude_amsl = _gf_breach_avoidance.generateLoiterAltitudeForFixedWing(gf_violation_type);
-					}
-
 					rep->current.timestamp = hrt_absolute_time();
 					rep->current.yaw = get_local_position()->heading;
 					rep->current.yaw_valid = true;
-					rep->current.lat = loiter_center_lat_lon(0);
-					rep->current.lon = loiter_center_lat_lon(1);
-					rep->current.alt = loiter_altitude_amsl;
+					rep->current.lat = prediction.loiter_lat;
+					rep->current.lon = prediction.loiter_lon;
+					rep->current.alt = prediction.loiter_altitude_amsl;
 					rep->current.valid = true;
 					rep->current.loiter_radius = get_loiter_radius();
 					rep->current.alt_valid = true;
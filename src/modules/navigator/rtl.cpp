@@ -43,6 +43,7 @@
 #include "rtl.h"
 #include "navigator.h"
 #include <dataman/dataman.h>
+#include <float.h>
 #include <px4_platform_common/events.h>
 
 #include <lib/geo/geo.h>
@@ -96,13 +97,6 @@ void RTL::find_RTL_destination()
 	// get global position
 	const vehicle_global_position_s &global_position = *_navigator->get_global_position();
 
-	// set destination to home per default, then check if other valid landing spot is closer
-	_destination.set(home_landing_position);
-
-	// get distance to home position
-	double dlat = home_landing_position.lat - global_position.lat;
-	double dlon = home_landing_position.lon - global_position.lon;
-
 	double lon_scale = cos(radians(global_position.lat));
 
 	auto coord_dist_sq = [lon_scale](double lat_diff, double lon_diff) -> double {
@@ -110,13 +104,63 @@ void RTL::find_RTL_destination()
 		return lat_diff * lat_diff + lon_diff_scaled * lon_diff_scaled;
 	};
 
+	const bool vtol_in_rw_mode = _navigator->get_vstatus()->is_vtol
+				     && _navigator->get_vstatus()->vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
+
+	// refresh the RAM copy of the safe points if they changed
+	updateSafePointCache();
+
+	// the previous evaluation is only usable while all inputs except the vehicle
+	// position are unchanged
+	if (_last_evaluation.valid
+	    && (fabs(home_landing_position.lat - _last_evaluation.home_lat) > DBL_EPSILON
+		|| fabs(home_landing_position.lon - _last_evaluation.home_lon) > DBL_EPSILON
+		|| fabsf(home_landing_position.alt - _last_evaluation.home_alt) > FLT_EPSILON
+		|| _param_rtl_type.get() != _last_evaluation.rtl_type
+		|| _navigator->get_mission_start_land_available() != _last_evaluation.mission_landing_available
+		|| _navigator->getMissionLandingInProgress() != _last_evaluation.mission_landing_in_progress
+		|| vtol_in_rw_mode != _last_evaluation.vtol_in_rw_mode)) {
+		_last_evaluation.valid = false;
+	}
+
+	if (_last_evaluation.valid) {
+		// the closest candidate can only have changed once the vehicle moved at
+		// least half the distance margin of the previous evaluation
+		const double moved = sqrt(coord_dist_sq(global_position.lat - _last_evaluation.lat,
+							global_position.lon - _last_evaluation.lon));
+
+		if (moved < 0.5 * _last_evaluation.margin) {
+			// keep the destination, only the return altitude depends on the position
+			if (_navigator->get_vstatus()->vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING) {
+				_rtl_alt = calculate_return_alt_from_cone_half_angle((float)_param_rtl_cone_half_angle_deg.get());
+
+			} else {
+				_rtl_alt = max(global_position.alt, _destination.alt + _param_rtl_return_alt.get());
+			}
+
+			float terrain_alt_amsl = NAN;
+
+			if (_terrain_cache.lookup(_destination.lat, _destination.lon, terrain_alt_amsl)) {
+				// never return below the terrain around the destination
+				_rtl_alt = max(_rtl_alt, terrain_alt_amsl + _param_rtl_return_alt.get());
+			}
+
+			return;
+		}
+	}
+
+	// set destination to home per default, then check if other valid landing spot is closer
+	_destination.set(home_landing_position);
+
+	// get distance to home position
+	double dlat = home_landing_position.lat - global_position.lat;
+	double dlon = home_landing_position.lon - global_position.lon;
+
 	double min_dist_squared = coord_dist_sq(dlat, dlon);
+	double second_min_dist_squared = DBL_MAX;
 
 	_destination.type = RTL_DESTINATION_HOME;
 
-	const bool vtol_in_rw_mode = _navigator->get_vstatus()->is_vtol
-				     && _navigator->get_vstatus()->vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
-
 
 	// consider the mission landing if not RTL_TYPE_HOME_OR_RALLY type set
 	if (_param_rtl_type.get() != RTL_TYPE_HOME_OR_RALLY && _navigator->get_mission_start_land_available()) {
@@ -145,16 +189,21 @@ void RTL::find_RTL_destination()
 			// compare home position to landing position to decide which is closer
 			if (dist_squared < min_dist_squared) {
 				_destination.type = RTL_DESTINATION_MISSION_LANDING;
+				second_min_dist_squared = min_dist_squared;
 				min_dist_squared = dist_squared;
 				_destination.lat = mission_landing_lat;
 				_destination.lon = mission_landing_lon;
 				_destination.alt = mission_landing_alt;
+
+			} else if (dist_squared < second_min_dist_squared) {
+				second_min_dist_squared = dist_squared;
 			}
 
 		} else {
-			// it has to be the mission landing
+			// it has to be the mission landing, home is no longer a candidate
 			_destination.type = RTL_DESTINATION_MISSION_LANDING;
 			min_dist_squared = dist_squared;
+			second_min_dist_squared = DBL_MAX;
 			_destination.lat = mission_landing_lat;
 			_destination.lon = mission_landing_lon;
 			_destination.alt = mission_landing_alt;
@@ -163,30 +212,18 @@ void RTL::find_RTL_destination()
 
 	// do not consider rally point if RTL type is set to RTL_TYPE_MISSION_LANDING_REVERSED, so exit function and use either home or mission landing
 	if (_param_rtl_type.get() == RTL_TYPE_MISSION_LANDING_REVERSED) {
+		recordDestinationEvaluation(min_dist_squared, second_min_dist_squared);
 		return;
 	}
 
 	// compare to safe landing positions
 	mission_safe_point_s closest_safe_point {};
-	mission_stats_entry_s stats;
-	int ret = dm_read(DM_KEY_SAFE_POINTS, 0, &stats, sizeof(mission_stats_entry_s));
-	int num_safe_points = 0;
-
-	if (ret == sizeof(mission_stats_entry_s)) {
-		num_safe_points = stats.num_items;
-	}
 
 	// check if a safe point is closer than home or landing
 	int closest_index = 0;
 
-	for (int current_seq = 1; current_seq <= num_safe_points; ++current_seq) {
-		mission_safe_point_s mission_safe_point;
-
-		if (dm_read(DM_KEY_SAFE_POINTS, current_seq, &mission_safe_point, sizeof(mission_safe_point_s)) !=
-		    sizeof(mission_safe_point_s)) {
-			PX4_ERR("dm_read failed");
-			continue;
-		}
+	for (int i = 0; i < _num_safe_points; ++i) {
+		const mission_safe_point_s &mission_safe_point = _safe_points[i];
 
 		// TODO: take altitude into account for distance measurement
 		dlat = mission_safe_point.lat - global_position.lat;
@@ -194,12 +231,18 @@ void RTL::find_RTL_destination()
 		double dist_squared = coord_dist_sq(dlat, dlon);
 
 		if (dist_squared < min_dist_squared) {
-			closest_index = current_seq;
+			closest_index = i + 1;
+			second_min_dist_squared = min_dist_squared;
 			min_dist_squared = dist_squared;
 			closest_safe_point = mission_safe_point;
+
+		} else if (dist_squared < second_min_dist_squared) {
+			second_min_dist_squared = dist_squared;
 		}
 	}
 
+	recordDestinationEvaluation(min_dist_squared, second_min_dist_squared);
+
 	if (closest_index > 0) {
 		_destination.type = RTL_DESTINATION_SAFE_POINT;
 
@@ -234,6 +277,87 @@ void RTL::find_RTL_destination()
 	} else {
 		_rtl_alt = max(global_position.alt, _destination.alt + _param_rtl_return_alt.get());
 	}
+
+	// keep the tile around the destination resident so the non-blocking lookup
+	// is answered from RAM once RTL engages
+	_terrain_cache.prefetch(_destination.lat, _destination.lon);
+
+	float terrain_alt_amsl = NAN;
+
+	if (_terrain_cache.lookup(_destination.lat, _destination.lon, terrain_alt_amsl)) {
+		// never return below the terrain around the destination
+		_rtl_alt = max(_rtl_alt, terrain_alt_amsl + _param_rtl_return_alt.get());
+	}
+}
+
+void RTL::updateSafePointCache()
+{
+	mission_stats_entry_s stats;
+	int ret = dm_read(DM_KEY_SAFE_POINTS, 0, &stats, sizeof(mission_stats_entry_s));
+	int num_safe_points = 0;
+	uint16_t update_counter = 0;
+
+	if (ret == sizeof(mission_stats_entry_s)) {
+		num_safe_points = stats.num_items;
+		update_counter = stats.update_counter;
+	}
+
+	if (_safe_points_loaded && update_counter == _safe_points_update_counter) {
+		return;
+	}
+
+	delete[] _safe_points;
+	_safe_points = nullptr;
+	_num_safe_points = 0;
+
+	if (num_safe_points > 0) {
+		_safe_points = new mission_safe_point_s[num_safe_points];
+
+		if (_safe_points == nullptr) {
+			PX4_ERR("alloc failed");
+			_safe_points_loaded = false;
+			return;
+		}
+
+		for (int i = 0; i < num_safe_points; ++i) {
+			if (dm_read(DM_KEY_SAFE_POINTS, i + 1, &_safe_points[i], sizeof(mission_safe_point_s)) !=
+			    sizeof(mission_safe_point_s)) {
+				PX4_ERR("dm_read failed");
+				delete[] _safe_points;
+				_safe_points = nullptr;
+				_safe_points_loaded = false;
+				return;
+			}
+		}
+
+		_num_safe_points = num_safe_points;
+	}
+
+	_safe_points_update_counter = update_counter;
+	_safe_points_loaded = true;
+
+	// the candidate set changed, the previous evaluation is stale
+	_last_evaluation.valid = false;
+}
+
+void RTL::recordDestinationEvaluation(double min_dist_squared, double second_min_dist_squared)
+{
+	const home_position_s &home = *_navigator->get_home_position();
+	const vehicle_global_position_s &global_position = *_navigator->get_global_position();
+
+	_last_evaluation.lat = global_position.lat;
+	_last_evaluation.lon = global_position.lon;
+	_last_evaluation.margin = (second_min_dist_squared < DBL_MAX) ?
+				  sqrt(second_min_dist_squared) - sqrt(min_dist_squared) : DBL_MAX;
+	_last_evaluation.home_lat = home.lat;
+	_last_evaluation.home_lon = home.lon;
+	_last_evaluation.home_alt = home.alt;
+	_last_evaluation.rtl_type = _param_rtl_type.get();
+	_last_evaluation.mission_landing_available = _navigator->get_mission_start_land_available();
+	_last_evaluation.mission_landing_in_progress = _navigator->getMissionLandingInProgress();
+	_last_evaluation.vtol_in_rw_mode = _navigator->get_vstatus()->is_vtol
+					   && _navigator->get_vstatus()->vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
+	_last_evaluation.valid = true;
 }
 
 void RTL::on_activation()
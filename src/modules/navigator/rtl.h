@@ -53,6 +53,7 @@
 #include <uORB/topics/wind.h>
 #include <matrix/math.hpp>
 #include <lib/geo/geo.h>
+#include <lib/terrain/TerrainCache.hpp>
 
 class Navigator;
 
@@ -61,7 +62,7 @@ class RTL : public MissionBlock, public ModuleParams
 public:
 	RTL(Navigator *navigator);
 
-	~RTL() = default;
+	~RTL() { delete[] _safe_points; }
 
 	enum RTLType {
 		RTL_TYPE_HOME_OR_RALLY = 0,
@@ -133,6 +134,17 @@ private:
 
 	float getHoverLandSpeed();
 
+	/**
+	 * Reload the safe points from dataman into RAM if they changed
+	 */
+	void updateSafePointCache();
+
+	/**
+	 * Store the inputs and the candidate distance margin of a completed
+	 * destination evaluation for the movement-based early out
+	 */
+	void recordDestinationEvaluation(double min_dist_squared, double second_min_dist_squared);
+
 	RTLState _rtl_state{RTL_STATE_NONE};
 
 	struct RTLPosition {
@@ -156,10 +168,35 @@ private:
 
 	RTLPosition _destination{}; ///< the RTL position to fly to (typically the home position or a safe point)
 
+	mission_safe_point_s *_safe_points{nullptr};	///< in-RAM copy of the DM_KEY_SAFE_POINTS items
+	int _num_safe_points{0};
+	uint16_t _safe_points_update_counter{0};	///< dataman update counter the cache was loaded for
+	bool _safe_points_loaded{false};
+
+	/** inputs and result margin of the last full destination evaluation: while only
+	 *  the vehicle position changed and the movement is smaller than half the margin
+	 *  between the chosen candidate and the runner-up, the ordering cannot have
+	 *  changed and the evaluation can be skipped */
+	struct {
+		bool valid{false};
+		double lat{0.0};			///< vehicle position the evaluation ran at
+		double lon{0.0};
+		double margin{0.0};			///< distance lead of the winner over the runner-up [scaled deg]
+		double home_lat{0.0};
+		double home_lon{0.0};
+		float home_alt{0.0f};
+		int32_t rtl_type{-1};
+		bool mission_landing_available{false};
+		bool mission_landing_in_progress{false};
+		bool vtol_in_rw_mode{false};
+	} _last_evaluation;
+
 	hrt_abstime _destination_check_time{0};
 
 	float _rtl_alt{0.0f};	// AMSL altitude at which the vehicle should return to the home position
 
+	terrain::TerrainCache _terrain_cache;	///< cached terrain tiles around the return destination
+
 	bool _rtl_alt_min{false};
 	bool _should_engange_mission_for_landing{false};
 
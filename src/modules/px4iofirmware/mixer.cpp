@@ -93,17 +93,19 @@ mixer_tick()
 	    hrt_elapsed_time(&fmu_data_received_time) > FMU_INPUT_DROP_LIMIT_US) {
 
 		/* too long without FMU input, time to go to failsafe */
+		/* only take the critical section of the atomic update on the edge, not every tick */
 		if (r_status_flags & PX4IO_P_STATUS_FLAGS_FMU_OK) {
 			isr_debug(1, "AP RX timeout");
+			atomic_modify_clear(&r_status_flags, PX4IO_P_STATUS_FLAGS_FMU_OK);
 		}
 
-		atomic_modify_clear(&r_status_flags, PX4IO_P_STATUS_FLAGS_FMU_OK);
-
 	} else {
-		atomic_modify_or(&r_status_flags, PX4IO_P_STATUS_FLAGS_FMU_OK);
+		/* FMU_INITIALIZED is never cleared once OK */
+		static constexpr uint16_t fmu_ok_flags = PX4IO_P_STATUS_FLAGS_FMU_OK | PX4IO_P_STATUS_FLAGS_FMU_INITIALIZED;
 
-		/* this flag is never cleared once OK */
-		atomic_modify_or(&r_status_flags, PX4IO_P_STATUS_FLAGS_FMU_INITIALIZED);
+		if ((r_status_flags & fmu_ok_flags) != fmu_ok_flags) {
+			atomic_modify_or(&r_status_flags, fmu_ok_flags);
+		}
 
 		if (fmu_data_received_time > last_fmu_update) {
 			new_fmu_data = true;
@@ -155,7 +157,8 @@ mixer_tick()
 	if (REG_TO_BOOL(r_setup_flighttermination) && 			/* Flight termination is allowed */
 	    (source == MIX_DISARMED) && 				/* and if we ended up not changing the default mixer */
 	    should_arm && 						/* and we should be armed, so we intended to provide outputs */
-	    (r_status_flags & PX4IO_P_STATUS_FLAGS_FMU_INITIALIZED)) { 	/* and FMU is initialized */
+	    (r_status_flags & PX4IO_P_STATUS_FLAGS_FMU_INITIALIZED) && 	/* and FMU is initialized */
+	    !(r_setup_arming & PX4IO_P_SETUP_ARMING_FORCE_FAILSAFE)) { 	/* and not already latched */
 		atomic_modify_or(&r_setup_arming, PX4IO_P_SETUP_ARMING_FORCE_FAILSAFE); /* then FMU is dead -> terminate flight */
 	}
 
@@ -167,13 +170,17 @@ mixer_tick()
 	}
 
 	/*
-	 * Set failsafe status flag depending on mixing source
+	 * Set failsafe status flag on the edge of the mixing source change
 	 */
 	if (source == MIX_FAILSAFE) {
-		atomic_modify_or(&r_status_flags, PX4IO_P_STATUS_FLAGS_FAILSAFE);
+		if (!(r_status_flags & PX4IO_P_STATUS_FLAGS_FAILSAFE)) {
+			atomic_modify_or(&r_status_flags, PX4IO_P_STATUS_FLAGS_FAILSAFE);
+		}
 
 	} else {
-		atomic_modify_clear(&r_status_flags, (PX4IO_P_STATUS_FLAGS_FAILSAFE));
+		if (r_status_flags & PX4IO_P_STATUS_FLAGS_FAILSAFE) {
+			atomic_modify_clear(&r_status_flags, (PX4IO_P_STATUS_FLAGS_FAILSAFE));
+		}
 	}
 
 	/*
@@ -181,15 +188,11 @@ mixer_tick()
 	 */
 	if (source == MIX_FAILSAFE) {
 		/* copy failsafe values to the servo outputs */
-		for (unsigned i = 0; i < PX4IO_SERVO_COUNT; i++) {
-			r_page_servos[i] = r_page_servo_failsafe[i];
-		}
+		memcpy(r_page_servos, r_page_servo_failsafe, sizeof(uint16_t)*PX4IO_SERVO_COUNT);
 
 	} else if (source == MIX_DISARMED) {
 		/* copy disarmed values to the servo outputs */
-		for (unsigned i = 0; i < PX4IO_SERVO_COUNT; i++) {
-			r_page_servos[i] = r_page_servo_disarmed[i];
-		}
+		memcpy(r_page_servos, r_page_servo_disarmed, sizeof(uint16_t)*PX4IO_SERVO_COUNT);
 	}
 
 	/* set arming */
@@ -232,11 +235,12 @@ mixer_tick()
 		}
 
 	} else if (mixer_servos_armed && (should_always_enable_pwm || (r_setup_arming & PX4IO_P_SETUP_ARMING_LOCKDOWN))) {
+		/* copy disarmed values into the reporting register */
+		memcpy(r_page_servos, r_page_servo_disarmed, sizeof(uint16_t)*PX4IO_SERVO_COUNT);
+
 		/* set the disarmed servo outputs. */
 		for (unsigned i = 0; i < PX4IO_SERVO_COUNT; i++) {
 			up_pwm_servo_set(i, r_page_servo_disarmed[i]);
-			/* copy values into reporting register */
-			r_page_servos[i] = r_page_servo_disarmed[i];
 		}
 
 		/* set S.BUS1 or S.BUS2 outputs */
@@ -155,6 +155,16 @@ void RCUpdate::parameters_updated()
 
 	update_rc_functions();
 
+	// precompute the failsafe check channel so the per-frame signal check avoids the mapping lookup
+	if (_param_rc_map_failsafe.get() > 0) {
+		// if not 0, use channel number instead of rc.function mapping
+		_rc_failsafe_channel = _param_rc_map_failsafe.get() - 1;
+
+	} else {
+		// default to the channel mapped to throttle
+		_rc_failsafe_channel = _rc.function[rc_channels_s::FUNCTION_THROTTLE];
+	}
+
 	// deprecated parameters, will be removed post v1.12 once QGC is updated
 	{
 		int32_t rc_map_value = 0;
@@ -367,8 +377,6 @@ void RCUpdate::Run()
 		parameters_updated();
 	}
 
-	rc_parameter_map_poll();
-
 	/* read low-level values from FMU or IO RC inputs (PPM, Spektrum, S.Bus) */
 	input_rc_s input_rc;
 
@@ -431,12 +439,8 @@ void RCUpdate::Run()
 			/* signal looks good */
 			signal_lost = false;
 
-			/* check failsafe */
-			int8_t fs_ch = _rc.function[_param_rc_map_failsafe.get()]; // get channel mapped to throttle
-
-			if (_param_rc_map_failsafe.get() > 0) { // if not 0, use channel number instead of rc.function mapping
-				fs_ch = _param_rc_map_failsafe.get() - 1;
-			}
+			/* check failsafe on the channel precomputed on parameter update */
+			const int8_t fs_ch = _rc_failsafe_channel;
 
 			if (_param_rc_fails_thr.get() > 0 && fs_ch >= 0) {
 				/* failsafe configured */
@@ -448,6 +452,26 @@ void RCUpdate::Run()
 			}
 		}
 
+		/*
+		 * some RC systems glitch after a reboot, we should ignore the first 100ms of regained signal
+		 * as the glitch might be interpreted as a commanded stick action or a flight mode switch
+		 */
+		_rc_signal_lost_hysteresis.set_hysteresis_time_from(true, 100_ms);
+		_rc_signal_lost_hysteresis.set_state_and_update(signal_lost, hrt_absolute_time());
+
+		/*
+		 * coalesce frames: signal loss is tracked above on every frame, but full channel
+		 * decoding and publication only needs to happen at the rate the manual_control
+		 * consumers read, or immediately when the signal-lost state changes
+		 */
+		if ((_rc_signal_lost_hysteresis.get_state() == _rc.signal_lost)
+		    && (hrt_elapsed_time(&_last_rc_decode) < RC_DECODE_INTERVAL_US)) {
+			perf_end(_loop_perf);
+			return;
+		}
+
+		_last_rc_decode = hrt_absolute_time();
+
 		/* read out and scale values from raw message even if signal is invalid */
 		for (unsigned int i = 0; i < channel_count_limited; i++) {
 
@@ -496,13 +520,6 @@ void RCUpdate::Run()
 			}
 		}
 
-		/*
-		 * some RC systems glitch after a reboot, we should ignore the first 100ms of regained signal
-		 * as the glitch might be interpreted as a commanded stick action or a flight mode switch
-		 */
-		_rc_signal_lost_hysteresis.set_hysteresis_time_from(true, 100_ms);
-		_rc_signal_lost_hysteresis.set_state_and_update(signal_lost, hrt_absolute_time());
-
 		_rc.channel_count = input_rc.channel_count;
 		_rc.rssi = input_rc.rssi;
 		_rc.signal_lost = _rc_signal_lost_hysteresis.get_state();
@@ -539,6 +556,7 @@ void RCUpdate::Run()
 
 				/* Update parameters from RC Channels (tuning with RC) if activated */
 				if (hrt_elapsed_time(&_last_rc_to_param_map_time) > 1_s) {
+					rc_parameter_map_poll();
 					set_params_from_rc();
 					_last_rc_to_param_map_time = hrt_absolute_time();
 				}
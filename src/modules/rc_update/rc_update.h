@@ -92,6 +92,8 @@ public:
 
 	static constexpr uint64_t VALID_DATA_MIN_INTERVAL_US{1_s / 3}; // assume valid RC input is at least 3 Hz
 
+	static constexpr uint64_t RC_DECODE_INTERVAL_US{20_ms}; // manual_control consumers read at 50 Hz
+
 	void Run() override;
 
 	/**
@@ -176,9 +178,12 @@ public:
 	float _param_rc_values[rc_parameter_map_s::RC_PARAM_MAP_NCHAN] {};	/**< parameter values for RC control */
 
 	hrt_abstime _last_manual_control_input_publish{0};
+	hrt_abstime _last_rc_decode{0};
 	hrt_abstime _last_rc_to_param_map_time{0};
 	hrt_abstime _last_timestamp_signal{0};
 
+	int8_t _rc_failsafe_channel{-1};	/**< failsafe check channel, precomputed on parameter update */
+
 	uint16_t _rc_values_previous[RC_MAX_CHAN_COUNT] {};
 	float _last_manual_control_input[3] {};
 	bool _aux_already_active[3] = {false, false, false};
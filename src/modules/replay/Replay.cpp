@@ -60,6 +60,7 @@
 #include <string>
 
 #include <logger/messages.h>
+#include <lzss/lzss.h>
 
 #include "Replay.hpp"
 #include "ReplayEkf2.hpp"
@@ -521,6 +522,10 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 
 	onSubscriptionAdded(*_subscriptions[msg_id], msg_id);
 
+	if (!_topic_filter.empty() && _topic_filter.find(topic_name) == _topic_filter.end()) {
+		_subscriptions[msg_id]->ignored = true;
+	}
+
 	return true;
 }
 
@@ -643,6 +648,10 @@ Replay::readDropout(std::ifstream &file, uint16_t msg_size)
 bool
 Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id)
 {
+	if (_message_index_valid) {
+		return nextDataMessageFromIndex(file, subscription, msg_id);
+	}
+
 	ulog_message_header_s message_header;
 	file.seekg(subscription.next_read_pos);
 	//ignore the first message (it's data we already read)
@@ -726,6 +735,43 @@ Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg
 	return file.good();
 }
 
+bool
+Replay::nextDataMessageFromIndex(std::ifstream &file, Subscription &subscription, int msg_id)
+{
+	ulog_message_header_s message_header;
+
+	while (msg_id < (int)_message_index.size() && subscription.next_index < _message_index[msg_id].size()) {
+		const streamoff cur_pos = _message_index[msg_id][subscription.next_index++];
+
+		file.seekg(cur_pos);
+		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+
+		uint16_t file_msg_id;
+		file.read((char *)&file_msg_id, sizeof(file_msg_id));
+
+		if (!file) {
+			break;
+		}
+
+		if (message_header.msg_size == subscription.orb_meta->o_size_no_padding + 2) {
+			subscription.next_read_pos = cur_pos;
+			file.seekg(subscription.timestamp_offset, ios::cur);
+			file.read((char *)&subscription.next_timestamp, sizeof(subscription.next_timestamp));
+			return file.good();
+
+		} else { //sanity check failed!
+			PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
+				subscription.orb_meta->o_name, message_header.msg_size,
+				subscription.orb_meta->o_size_no_padding + 2);
+		}
+	}
+
+	//no more data messages for this subscription
+	subscription.orb_meta = nullptr;
+	file.clear();
+	return file.good();
+}
+
 const orb_metadata *
 Replay::findTopic(const std::string &name)
 {
@@ -829,9 +875,297 @@ Replay::readDefinitionsAndApplyParams(std::ifstream &file)
 	return true;
 }
 
+bool
+Replay::expandCompressedChunks()
+{
+	ifstream src(_replay_file, ios::in | ios::binary);
+	ulog_file_header_s file_header;
+	src.read((char *)&file_header, sizeof(file_header));
+
+	if (!src) {
+		return false;
+	}
+
+	// check whether the log contains compressed chunks at all
+	bool found_chunk = false;
+	ulog_message_header_s message_header;
+
+	while (src.read((char *)&message_header, ULOG_MSG_HEADER_LEN)) {
+		if (message_header.msg_type == (int)ULogMessageType::COMPRESSED_DATA) {
+			found_chunk = true;
+			break;
+		}
+
+		src.seekg(message_header.msg_size, ios::cur);
+	}
+
+	if (!found_chunk) {
+		return true;
+	}
+
+	string expanded_file_name = string(_replay_file) + ".expanded";
+	PX4_INFO("log contains compressed chunks, expanding to %s", expanded_file_name.c_str());
+
+	ofstream dst(expanded_file_name, ios::out | ios::binary | ios::trunc);
+
+	if (!dst) {
+		PX4_ERR("Failed to create %s", expanded_file_name.c_str());
+		return false;
+	}
+
+	src.clear();
+	src.seekg(0);
+	src.read((char *)&file_header, sizeof(file_header));
+	dst.write((const char *)&file_header, sizeof(file_header));
+
+	vector<uint8_t> message(1 << 16);
+	vector<uint8_t> expanded(1 << 16);
+
+	while (src.read((char *)&message_header, ULOG_MSG_HEADER_LEN)) {
+		src.read((char *)message.data(), message_header.msg_size);
+
+		if (!src) {
+			break; // truncated last message (e.g. power cut while logging)
+		}
+
+		if (message_header.msg_type == (int)ULogMessageType::COMPRESSED_DATA) {
+			uint16_t uncompressed_size;
+
+			if (message_header.msg_size < sizeof(uncompressed_size)) {
+				PX4_ERR("Corrupt compressed chunk, aborting");
+				return false;
+			}
+
+			memcpy(&uncompressed_size, message.data(), sizeof(uncompressed_size));
+
+			const size_t expanded_size = lzss::decompress(message.data() + sizeof(uncompressed_size),
+						     message_header.msg_size - sizeof(uncompressed_size),
+						     expanded.data(), uncompressed_size);
+
+			if (expanded_size != uncompressed_size) {
+				PX4_ERR("Corrupt compressed chunk, aborting");
+				return false;
+			}
+
+			// the chunk contains complete, plainly framed messages
+			dst.write((const char *)expanded.data(), expanded_size);
+
+		} else {
+			dst.write((const char *)&message_header, ULOG_MSG_HEADER_LEN);
+			dst.write((const char *)message.data(), message_header.msg_size);
+		}
+	}
+
+	setupReplayFile(expanded_file_name.c_str());
+	return true;
+}
+
+static constexpr char MESSAGE_INDEX_MAGIC[8] = {'U', 'L', 'O', 'G', 'I', 'D', 'X', '1'};
+
+bool
+Replay::loadMessageIndex(std::ifstream &file)
+{
+	ifstream idx(string(_replay_file) + ".index", ios::in | ios::binary);
+
+	if (!idx.is_open()) {
+		return false;
+	}
+
+	char magic[8];
+	idx.read(magic, sizeof(magic));
+
+	if (!idx || memcmp(magic, MESSAGE_INDEX_MAGIC, sizeof(magic)) != 0) {
+		return false;
+	}
+
+	// the index is only valid for the exact file it was built from
+	file.clear();
+	file.seekg(0, ios::end);
+	const int64_t file_size = file.tellg();
+
+	int64_t indexed_file_size;
+	int64_t indexed_data_section_start;
+	idx.read((char *)&indexed_file_size, sizeof(indexed_file_size));
+	idx.read((char *)&indexed_data_section_start, sizeof(indexed_data_section_start));
+
+	if (!idx || indexed_file_size != file_size
+	    || indexed_data_section_start != (int64_t)(streamoff)_data_section_start) {
+		return false;
+	}
+
+	uint32_t num_subscriptions;
+	idx.read((char *)&num_subscriptions, sizeof(num_subscriptions));
+
+	if (!idx) {
+		return false;
+	}
+
+	_subscription_offsets.resize(num_subscriptions);
+	idx.read((char *)_subscription_offsets.data(), num_subscriptions * sizeof(std::streamoff));
+
+	uint32_t num_msg_ids;
+	idx.read((char *)&num_msg_ids, sizeof(num_msg_ids));
+
+	if (!idx) {
+		return false;
+	}
+
+	_message_index.resize(num_msg_ids);
+
+	for (uint32_t i = 0; i < num_msg_ids; ++i) {
+		uint32_t count;
+		idx.read((char *)&count, sizeof(count));
+
+		if (!idx) {
+			return false;
+		}
+
+		_message_index[i].resize(count);
+		idx.read((char *)_message_index[i].data(), count * sizeof(std::streamoff));
+	}
+
+	return idx.good();
+}
+
+void
+Replay::saveMessageIndex()
+{
+	const string index_file_name = string(_replay_file) + ".index";
+	ofstream idx(index_file_name, ios::out | ios::binary | ios::trunc);
+
+	if (!idx) {
+		// not fatal: the index is rebuilt on the next run
+		PX4_WARN("Failed to create %s", index_file_name.c_str());
+		return;
+	}
+
+	ifstream file(_replay_file, ios::in | ios::binary);
+	file.seekg(0, ios::end);
+	const int64_t file_size = file.tellg();
+	const int64_t data_section_start = (streamoff)_data_section_start;
+
+	idx.write(MESSAGE_INDEX_MAGIC, sizeof(MESSAGE_INDEX_MAGIC));
+	idx.write((const char *)&file_size, sizeof(file_size));
+	idx.write((const char *)&data_section_start, sizeof(data_section_start));
+
+	const uint32_t num_subscriptions = _subscription_offsets.size();
+	idx.write((const char *)&num_subscriptions, sizeof(num_subscriptions));
+	idx.write((const char *)_subscription_offsets.data(), num_subscriptions * sizeof(std::streamoff));
+
+	const uint32_t num_msg_ids = _message_index.size();
+	idx.write((const char *)&num_msg_ids, sizeof(num_msg_ids));
+
+	for (uint32_t i = 0; i < num_msg_ids; ++i) {
+		const uint32_t count = _message_index[i].size();
+		idx.write((const char *)&count, sizeof(count));
+		idx.write((const char *)_message_index[i].data(), count * sizeof(std::streamoff));
+	}
+}
+
+bool
+Replay::buildMessageIndex(std::ifstream &file)
+{
+	_message_index.clear();
+	_subscription_offsets.clear();
+
+	if (loadMessageIndex(file)) {
+		PX4_INFO("Using message index from previous run");
+		_message_index_valid = true;
+		return true;
+	}
+
+	_message_index.clear();
+	_subscription_offsets.clear();
+
+	file.clear();
+	file.seekg(_data_section_start);
+
+	ulog_message_header_s message_header;
+
+	while (file.read((char *)&message_header, ULOG_MSG_HEADER_LEN)) {
+		const streamoff cur_pos = (streamoff)file.tellg() - ULOG_MSG_HEADER_LEN;
+
+		if (cur_pos + (streamoff)ULOG_MSG_HEADER_LEN + message_header.msg_size > _read_until_file_position) {
+			break;
+		}
+
+		switch (message_header.msg_type) {
+		case (int)ULogMessageType::ADD_LOGGED_MSG:
+			_subscription_offsets.push_back(cur_pos);
+			file.seekg(message_header.msg_size, ios::cur);
+			break;
+
+		case (int)ULogMessageType::DATA: {
+				uint16_t file_msg_id;
+				file.read((char *)&file_msg_id, sizeof(file_msg_id));
+
+				if (!file) {
+					break; // truncated last message
+				}
+
+				if (_message_index.size() <= file_msg_id) {
+					_message_index.resize(file_msg_id + 1);
+				}
+
+				_message_index[file_msg_id].push_back(cur_pos);
+				file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
+			}
+			break;
+
+		default:
+			file.seekg(message_header.msg_size, ios::cur);
+			break;
+		}
+	}
+
+	if (file.bad()) {
+		// hard IO error: fall back to sequential scanning
+		PX4_WARN("Failed to build message index, falling back to sequential reading");
+		_message_index.clear();
+		_subscription_offsets.clear();
+		file.clear();
+		return true;
+	}
+
+	file.clear();
+	_message_index_valid = true;
+	saveMessageIndex();
+	return true;
+}
+
+void
+Replay::setupTopicFilter()
+{
+	_topic_filter.clear();
+
+	const char *filter = getenv("PX4_REPLAY_TOPIC_FILTER");
+
+	if (!filter) {
+		return;
+	}
+
+	istringstream topic_names(filter);
+	string topic_name;
+
+	while (getline(topic_names, topic_name, ',')) {
+		if (!topic_name.empty()) {
+			_topic_filter.insert(topic_name);
+		}
+	}
+
+	if (!_topic_filter.empty()) {
+		PX4_INFO("Replaying only %zu topics (PX4_REPLAY_TOPIC_FILTER)", _topic_filter.size());
+	}
+}
+
 void
 Replay::run()
 {
+	if (!expandCompressedChunks()) {
+		PX4_ERR("Failed to expand compressed log file");
+		return;
+	}
+
 	ifstream replay_file(_replay_file, ios::in | ios::binary);
 
 	if (!readDefinitionsAndApplyParams(replay_file)) {
@@ -845,6 +1179,12 @@ Replay::run()
 		_speed_factor = atof(speedup);
 	}
 
+	setupTopicFilter();
+
+	if (!buildMessageIndex(replay_file)) {
+		return;
+	}
+
 	onEnterMainLoop();
 
 	_replay_start_time = hrt_absolute_time();
@@ -852,6 +1192,21 @@ Replay::run()
 	PX4_INFO("Replay in progress...");
 
 	ulog_message_header_s message_header;
+
+	if (_message_index_valid) {
+		//we already know where all subscriptions are: add them up-front, so the main
+		//loop never has to discover them while scanning for data
+		for (const std::streamoff subscription_offset : _subscription_offsets) {
+			replay_file.seekg(subscription_offset);
+			replay_file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+
+			if (!replay_file || !readAndAddSubscription(replay_file, message_header.msg_size)) {
+				PX4_ERR("Failed to read subscription");
+				return;
+			}
+		}
+	}
+
 	replay_file.seekg(_data_section_start);
 
 	//we know the next message must be an ADD_LOGGED_MSG
@@ -1171,6 +1526,10 @@ The module is typically used together with uORB publisher rules, to specify whic
 The replay module will just publish all messages that are found in the log. It also applies the parameters from
 the log.
 
+On the first run the module builds a per-topic message index of the log and stores it in a `<log file>.index`
+sidecar file, which is reused by subsequent replays of the same log. Optionally, `PX4_REPLAY_TOPIC_FILTER` can
+be set to a comma-separated list of topic names to restrict which topics are published.
+
 The replay procedure is documented on the [System-wide Replay](https://docs.px4.io/main/en/debug/system_wide_replay.html)
 page.
 )DESCR_STR");
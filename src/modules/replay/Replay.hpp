@@ -136,6 +136,7 @@ protected:
 
 		std::streampos next_read_pos;
 		uint64_t next_timestamp; ///< timestamp of the file
+		size_t next_index = 0; ///< cursor into the per-topic message index (only used if the index is valid)
 
 		CompatBase *compat = nullptr;
 
@@ -206,6 +207,12 @@ protected:
 	 */
 	bool nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id);
 
+	/**
+	 * Index-based variant of nextDataMessage(): jumps directly to the next data message
+	 * of this subscription instead of scanning over all messages in between.
+	 */
+	bool nextDataMessageFromIndex(std::ifstream &file, Subscription &subscription, int msg_id);
+
 	virtual uint64_t getTimestampOffset()
 	{
 		//we update the timestamps from the file by a constant offset to match
@@ -233,8 +240,40 @@ private:
 
 	float _accumulated_delay{0.f};
 
+	bool _message_index_valid = false;
+	std::vector<std::vector<std::streamoff>> _message_index; ///< per msg_id: file offsets of all data messages
+	std::vector<std::streamoff> _subscription_offsets; ///< file offsets of all ADD_LOGGED_MSG messages
+
+	std::set<std::string> _topic_filter; ///< if non-empty, only these topics are published in the main loop
+
 	bool readFileHeader(std::ifstream &file);
 
+	/**
+	 * Expand a log written with SDLOG_COMPRESS into a flat file next to it and switch
+	 * the replay to that file, so the seek-based reading below works unmodified.
+	 * A no-op if the log contains no compressed chunks.
+	 * @return true on success
+	 */
+	bool expandCompressedChunks();
+
+	/**
+	 * Build the per-topic message index for the data section, or load it from a
+	 * sidecar file next to the log if one from a previous run still matches.
+	 * On success the main loop can seek directly to each topic's messages. Falls
+	 * back to sequential scanning (index invalid) on file errors.
+	 * @return false on fatal file error
+	 */
+	bool buildMessageIndex(std::ifstream &file);
+
+	bool loadMessageIndex(std::ifstream &file);
+	void saveMessageIndex();
+
+	/**
+	 * Read the topic filter from the PX4_REPLAY_TOPIC_FILTER env variable (comma-separated
+	 * topic names). Topics not in a non-empty filter are ignored in the main loop.
+	 */
+	void setupTopicFilter();
+
 	/**
 	 * Read definitions section: check formats, apply parameters and store
 	 * the start of the data section.
@@ -267,8 +267,20 @@ RoverPositionControl::control_position(const matrix::Vector2d &current_position,
 			}
 		}
 
-		float dist_target = get_distance_to_next_waypoint(_global_pos.lat, _global_pos.lon,
-				    (double)curr_wp(0), (double)curr_wp(1)); // pos_sp_triplet.current.lat, pos_sp_triplet.current.lon);
+		/* re-project the waypoint segment only on waypoint advance or reference change */
+		if ((_wp_proj_ref_timestamp != _global_local_proj_ref.getProjectionReferenceTimestamp())
+		    || (curr_wp(0) != _proj_curr_wp(0)) || (curr_wp(1) != _proj_curr_wp(1))
+		    || (prev_wp(0) != _proj_prev_wp(0)) || (prev_wp(1) != _proj_prev_wp(1))) {
+
+			_curr_wp_local = _global_local_proj_ref.project(curr_wp(0), curr_wp(1));
+			_prev_wp_local = _global_local_proj_ref.project(prev_wp(0), prev_wp(1));
+			_proj_curr_wp = curr_wp;
+			_proj_prev_wp = prev_wp;
+			_wp_proj_ref_timestamp = _global_local_proj_ref.getProjectionReferenceTimestamp();
+		}
+
+		const Vector2f curr_pos_local{_local_pos.x, _local_pos.y};
+		float dist_target = Vector2f(_curr_wp_local - curr_pos_local).norm();
 
 		//PX4_INFO("Setpoint type %d", (int) pos_sp_triplet.current.type );
 		//PX4_INFO(" State machine state %d", (int) _pos_ctrl_state);
@@ -281,11 +293,7 @@ RoverPositionControl::control_position(const matrix::Vector2d &current_position,
 					_pos_ctrl_state = STOPPING;  // We are closer than loiter radius to waypoint, stop.
 
 				} else {
-					Vector2f curr_pos_local{_local_pos.x, _local_pos.y};
-					Vector2f curr_wp_local = _global_local_proj_ref.project(curr_wp(0), curr_wp(1));
-					Vector2f prev_wp_local = _global_local_proj_ref.project(prev_wp(0),
-								 prev_wp(1));
-					_gnd_control.navigate_waypoints(prev_wp_local, curr_wp_local, curr_pos_local, ground_speed_2d);
+					_gnd_control.navigate_waypoints(_prev_wp_local, _curr_wp_local, curr_pos_local, ground_speed_2d);
 
 					_act_controls.control[actuator_controls_s::INDEX_THROTTLE] = mission_throttle;
 
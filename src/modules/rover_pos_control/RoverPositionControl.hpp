@@ -164,6 +164,14 @@ private:
 	/* previous waypoint */
 	matrix::Vector2d _prev_wp{0, 0};
 
+	/* current/previous waypoint segment projected into the local frame; the geodetic
+	 * projection is only redone on waypoint advance or projection reference change */
+	matrix::Vector2d _proj_curr_wp{0, 0};
+	matrix::Vector2d _proj_prev_wp{0, 0};
+	matrix::Vector2f _curr_wp_local{};
+	matrix::Vector2f _prev_wp_local{};
+	uint64_t _wp_proj_ref_timestamp{0};
+
 	enum class VelocityFrame {
 		NED,
 		BODY,
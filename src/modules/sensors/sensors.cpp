@@ -113,6 +113,15 @@ Sensors::~Sensors()
 
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+
+	if (_vehicle_distance_sensor) {
+		_vehicle_distance_sensor->Stop();
+		delete _vehicle_distance_sensor;
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 
 	if (_vehicle_gps_position) {
@@ -242,6 +251,10 @@ int Sensors::parameters_update()
 	InitializeVehicleAirData();
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+	InitializeVehicleDistanceSensor();
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 	InitializeVehicleGPSPosition();
 #endif // CONFIG_SENSORS_VEHICLE_GPS_POSITION
@@ -432,6 +445,23 @@ void Sensors::InitializeVehicleAirData()
 }
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+void Sensors::InitializeVehicleDistanceSensor()
+{
+	if (_vehicle_distance_sensor == nullptr) {
+		uORB::Subscription distance_sensor_sub{ORB_ID(distance_sensor)};
+
+		if (distance_sensor_sub.advertised()) {
+			_vehicle_distance_sensor = new VehicleDistanceSensor();
+
+			if (_vehicle_distance_sensor) {
+				_vehicle_distance_sensor->Start();
+			}
+		}
+	}
+}
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 void Sensors::InitializeVehicleGPSPosition()
 {
@@ -543,6 +573,16 @@ void Sensors::Run()
 
 		bool updated = false;
 
+#if defined(CONFIG_SENSORS_VEHICLE_AIRSPEED)
+		const int n_diff_pres = orb_group_count(ORB_ID(differential_pressure));
+
+		if (n_diff_pres != _n_diff_pres) {
+			_n_diff_pres = n_diff_pres;
+			updated = true;
+		}
+
+#endif // CONFIG_SENSORS_VEHICLE_AIRSPEED
+
 #if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
 		const int n_baro = orb_group_count(ORB_ID(sensor_baro));
 
@@ -553,6 +593,16 @@ void Sensors::Run()
 
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+		const int n_distance_sensor = orb_group_count(ORB_ID(distance_sensor));
+
+		if (n_distance_sensor != _n_distance_sensor) {
+			_n_distance_sensor = n_distance_sensor;
+			updated = true;
+		}
+
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 		const int n_gps = orb_group_count(ORB_ID(sensor_gps));
 
@@ -625,7 +675,13 @@ void Sensors::Run()
 #if defined(CONFIG_SENSORS_VEHICLE_AIRSPEED)
 	// check analog airspeed
 	adc_poll();
-	diff_pres_poll();
+
+	// skip the differential pressure subscription checks entirely until a sensor
+	// has been seen by the periodic configuration scan
+	if (_n_diff_pres > 0) {
+		diff_pres_poll();
+	}
+
 #endif // CONFIG_SENSORS_VEHICLE_AIRSPEED
 
 	// backup schedule as a watchdog timeout
@@ -732,6 +788,15 @@ int Sensors::print_status()
 	_vehicle_angular_velocity.PrintStatus();
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+
+	if (_vehicle_distance_sensor) {
+		PX4_INFO_RAW("\n");
+		_vehicle_distance_sensor->PrintStatus();
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 
 	if (_vehicle_gps_position) {
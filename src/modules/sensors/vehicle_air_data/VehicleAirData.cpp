@@ -102,6 +102,9 @@ bool VehicleAirData::ParametersUpdate(bool force)
 
 		updateParams();
 
+		// QNH may have changed, force a refresh of the altitude linearization
+		_alt_lin_pressure_pa = NAN;
+
 		// update priority
 		for (int instance = 0; instance < MAX_SENSOR_COUNT; instance++) {
 
@@ -162,6 +165,13 @@ void VehicleAirData::Run()
 		if (_advertised[uorb_index]) {
 			sensor_baro_s report;
 
+			// drain the queue first, then calibrate and vote on the accumulated samples in one
+			// batch (the calibration is an offset, so correcting the mean is exact)
+			float pressure_raw_sum = 0.f;
+			float temperature_sum = 0.f;
+			uint64_t timestamp_sample_sum = 0;
+			int sample_count = 0;
+
 			while (_sensor_sub[uorb_index].update(&report)) {
 
 				if (_calibration[uorb_index].device_id() != report.device_id) {
@@ -186,22 +196,30 @@ void VehicleAirData::Run()
 						ParametersUpdate(true);
 					}
 
-					// pressure corrected with offset (if available)
-					_calibration[uorb_index].SensorCorrectionsUpdate();
-					const float pressure_corrected = _calibration[uorb_index].Correct(report.pressure);
+					pressure_raw_sum += report.pressure;
+					temperature_sum += report.temperature;
+					timestamp_sample_sum += report.timestamp_sample;
+					sample_count++;
+				}
+			}
+
+			if (sample_count > 0) {
+				// pressure corrected with offset (if available)
+				_calibration[uorb_index].SensorCorrectionsUpdate();
+				const float pressure_corrected = _calibration[uorb_index].Correct(pressure_raw_sum / sample_count);
+				const float temperature = temperature_sum / sample_count;
 
-					float data_array[3] {pressure_corrected, report.temperature, PressureToAltitude(pressure_corrected)};
-					_voter.put(uorb_index, report.timestamp, data_array, report.error_count, _priority[uorb_index]);
+				float data_array[3] {pressure_corrected, temperature, AltitudeLinearized(pressure_corrected)};
+				_voter.put(uorb_index, report.timestamp, data_array, report.error_count, _priority[uorb_index]);
 
-					_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
-					_data_sum[uorb_index] += pressure_corrected;
-					_temperature_sum[uorb_index] += report.temperature;
-					_data_sum_count[uorb_index]++;
+				_timestamp_sample_sum[uorb_index] += timestamp_sample_sum;
+				_data_sum[uorb_index] += pressure_corrected * sample_count;
+				_temperature_sum[uorb_index] += temperature_sum;
+				_data_sum_count[uorb_index] += sample_count;
 
-					_last_data[uorb_index] = pressure_corrected;
+				_last_data[uorb_index] = pressure_corrected;
 
-					updated[uorb_index] = true;
-				}
+				updated[uorb_index] = true;
 			}
 		}
 	}
@@ -321,6 +339,22 @@ float VehicleAirData::PressureToAltitude(float pressure_pa, float temperature) c
 	return altitude;
 }
 
+float VehicleAirData::AltitudeLinearized(float pressure_pa)
+{
+	// the conversion is smooth, so a first order expansion around a reference point is accurate
+	// to centimetres within the refresh band and avoids evaluating a powf() for every batch
+	static constexpr float REFRESH_BAND_PA = 1000.f; // roughly 85 m of altitude
+
+	if (!PX4_ISFINITE(_alt_lin_pressure_pa) || (fabsf(pressure_pa - _alt_lin_pressure_pa) > REFRESH_BAND_PA)) {
+		_alt_lin_pressure_pa = pressure_pa;
+		_alt_lin_altitude_m = PressureToAltitude(pressure_pa);
+		_alt_lin_slope_m_per_pa = (PressureToAltitude(pressure_pa + REFRESH_BAND_PA)
+					   - PressureToAltitude(pressure_pa - REFRESH_BAND_PA)) / (2.f * REFRESH_BAND_PA);
+	}
+
+	return _alt_lin_altitude_m + _alt_lin_slope_m_per_pa * (pressure_pa - _alt_lin_pressure_pa);
+}
+
 void VehicleAirData::CheckFailover(const hrt_abstime &time_now_us)
 {
 	// check failover and report (save failover report for a cycle where parameters didn't update)
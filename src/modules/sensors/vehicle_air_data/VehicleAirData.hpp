@@ -80,6 +80,7 @@ private:
 	void UpdateStatus();
 
 	float PressureToAltitude(float pressure_pa, float temperature = 15.f) const;
+	float AltitudeLinearized(float pressure_pa);
 
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
@@ -125,6 +126,12 @@ private:
 
 	float _air_temperature_celsius{20.f}; // initialize with typical 20degC ambient temperature
 
+	// cached linearization of the pressure to altitude conversion used for the validator input,
+	// refreshed when the pressure leaves the band around the reference point or QNH changes
+	float _alt_lin_pressure_pa{NAN};	// reference pressure the linearization was computed at
+	float _alt_lin_altitude_m{0.f};		// altitude at the reference pressure
+	float _alt_lin_slope_m_per_pa{0.f};	// altitude change per Pascal around the reference pressure
+
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::SENS_BARO_QNH>) _param_sens_baro_qnh,
 		(ParamFloat<px4::params::SENS_BARO_RATE>) _param_sens_baro_rate
@@ -755,13 +755,16 @@ float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_
 {
 	// angular acceleration: Differentiate & apply specific angular acceleration (D-term) low-pass (IMU_DGYRO_CUTOFF)
 	float angular_acceleration_filtered = 0.f;
+	float angular_velocity_prev = _angular_velocity_raw_prev(axis);
 
 	for (int n = 0; n < N; n++) {
-		const float angular_acceleration = (data[n] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
+		const float angular_acceleration = (data[n] - angular_velocity_prev) * inverse_dt_s;
 		angular_acceleration_filtered = _lp_filter_acceleration[axis].update(angular_acceleration);
-		_angular_velocity_raw_prev(axis) = data[n];
+		angular_velocity_prev = data[n];
 	}
 
+	_angular_velocity_raw_prev(axis) = angular_velocity_prev;
+
 	return angular_acceleration_filtered;
 }
 
@@ -805,35 +808,78 @@ void VehicleAngularVelocity::Run()
 
 	if (_fifo_available) {
 		// process all outstanding fifo messages
-		sensor_gyro_fifo_s sensor_fifo_data;
+		static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
 
-		while (_sensor_gyro_fifo_sub.update(&sensor_fifo_data)) {
-			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
-			const int N = sensor_fifo_data.samples;
-			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
+		while (true) {
+			// read directly out of the uORB queue slot where possible (validated below)
+			const sensor_gyro_fifo_s *sensor_fifo = static_cast<const sensor_gyro_fifo_s *>(_sensor_gyro_fifo_sub.peek());
 
-			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
+			sensor_gyro_fifo_s sensor_fifo_data;
 
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
+			if (sensor_fifo == nullptr) {
+				// zero-copy reads not available, fall back to a copy
+				if (!_sensor_gyro_fifo_sub.update(&sensor_fifo_data)) {
+					break;
+				}
 
-				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
+				sensor_fifo = &sensor_fifo_data;
+			}
+
+			// everything is consumed from the slot before the read is validated:
+			// convert the raw int16 sensor samples to float arrays for filtering
+			hrt_abstime timestamp_sample = 0;
+			float inverse_dt_s = 0.f;
+			int N = 0;
+			float data[3][FIFO_SIZE_MAX];
 
-					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
+			for (int attempt = 0; attempt < 2; attempt++) {
+				const int samples = sensor_fifo->samples;
+
+				if ((sensor_fifo->dt > 0) && (samples > 0) && (samples <= FIFO_SIZE_MAX)) {
+					timestamp_sample = sensor_fifo->timestamp_sample;
+					inverse_dt_s = 1e6f / sensor_fifo->dt;
+					N = samples;
+
+					const int16_t *raw_data_array[] {sensor_fifo->x, sensor_fifo->y, sensor_fifo->z};
+
+					for (int axis = 0; axis < 3; axis++) {
+						for (int n = 0; n < N; n++) {
+							data[axis][n] = sensor_fifo->scale * raw_data_array[axis][n];
+						}
 					}
 
+				} else {
+					N = 0;
+				}
+
+				if ((sensor_fifo != &sensor_fifo_data) && !_sensor_gyro_fifo_sub.peek_valid()) {
+					// the slot was overwritten while it was consumed (reader fell a full
+					// queue behind), re-read a fresh message with a copy
+					if (!_sensor_gyro_fifo_sub.update(&sensor_fifo_data)) {
+						N = 0;
+						break;
+					}
+
+					sensor_fifo = &sensor_fifo_data;
+					continue;
+				}
+
+				break;
+			}
+
+			if (N > 0) {
+				Vector3f angular_velocity_uncalibrated;
+				Vector3f angular_acceleration_uncalibrated;
+
+				for (int axis = 0; axis < 3; axis++) {
 					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data[axis], N);
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis], N);
 				}
 
 				// Publish
 				if (!_sensor_gyro_fifo_sub.updated()) {
-					if (CalibrateAndPublish(sensor_fifo_data.timestamp_sample,
+					if (CalibrateAndPublish(timestamp_sample,
 								angular_velocity_uncalibrated,
 								angular_acceleration_uncalibrated)) {
 
@@ -923,6 +969,8 @@ bool VehicleAngularVelocity::CalibrateAndPublish(const hrt_abstime &timestamp_sa
 		angular_velocity.timestamp = hrt_absolute_time();
 		_vehicle_angular_velocity_pub.publish(angular_velocity);
 
+		_latency_trace.publish(latency_trace_s::HOP_ANGULAR_VELOCITY, timestamp_sample);
+
 		// shift last publish time forward, but don't let it get further behind than the interval
 		_last_publish = math::constrain(_last_publish + _publish_interval_min_us,
 						timestamp_sample - _publish_interval_min_us, timestamp_sample);
@@ -0,0 +1,178 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "VehicleDistanceSensor.hpp"
+
+#include <px4_platform_common/log.h>
+
+namespace sensors
+{
+
+static constexpr uint32_t SENSOR_TIMEOUT{1_s};
+
+VehicleDistanceSensor::VehicleDistanceSensor() :
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
+{
+	_vehicle_distance_sensor_pub.advertise();
+}
+
+VehicleDistanceSensor::~VehicleDistanceSensor()
+{
+	Stop();
+	perf_free(_cycle_perf);
+}
+
+bool VehicleDistanceSensor::Start()
+{
+	ScheduleNow();
+	return true;
+}
+
+void VehicleDistanceSensor::Stop()
+{
+	Deinit();
+
+	// clear all registered callbacks
+	for (auto &sub : _distance_sensor_subs) {
+		sub.unregisterCallback();
+	}
+}
+
+int8_t VehicleDistanceSensor::OrientationSlot(uint8_t orientation)
+{
+	switch (orientation) {
+	case distance_sensor_s::ROTATION_DOWNWARD_FACING:
+		return vehicle_distance_sensor_s::ORIENTATION_DOWNWARD;
+
+	case distance_sensor_s::ROTATION_UPWARD_FACING:
+		return vehicle_distance_sensor_s::ORIENTATION_UPWARD;
+
+	case distance_sensor_s::ROTATION_FORWARD_FACING:
+		return vehicle_distance_sensor_s::ORIENTATION_FORWARD;
+
+	case distance_sensor_s::ROTATION_BACKWARD_FACING:
+		return vehicle_distance_sensor_s::ORIENTATION_BACKWARD;
+	}
+
+	return -1;
+}
+
+void VehicleDistanceSensor::Run()
+{
+	perf_begin(_cycle_perf);
+
+	const hrt_abstime time_now_us = hrt_absolute_time();
+
+	bool updated = false;
+
+	for (int uorb_index = 0; uorb_index < MAX_SENSOR_COUNT; uorb_index++) {
+
+		if (!_advertised[uorb_index]) {
+			// throttle advertisement checks
+			if ((_last_advertised_check[uorb_index] == 0)
+			    || (time_now_us > _last_advertised_check[uorb_index] + 1_s)) {
+
+				if (_distance_sensor_subs[uorb_index].advertised()) {
+					_advertised[uorb_index] = true;
+					_distance_sensor_subs[uorb_index].registerCallback();
+
+				} else {
+					_last_advertised_check[uorb_index] = time_now_us;
+				}
+			}
+		}
+
+		if (_advertised[uorb_index]) {
+			distance_sensor_s report;
+
+			while (_distance_sensor_subs[uorb_index].update(&report)) {
+
+				const int8_t slot = OrientationSlot(report.orientation);
+
+				if (slot < 0) {
+					// orientation without a dedicated slot (e.g. ROTATION_CUSTOM)
+					continue;
+				}
+
+				// latch the first instance reporting an orientation, only replace it once it has gone stale
+				if ((_selected_instance[slot] >= 0) && (_selected_instance[slot] != uorb_index)
+				    && (time_now_us < _aggregation.timestamps[slot] + SENSOR_TIMEOUT)) {
+					continue;
+				}
+
+				if (_selected_instance[slot] != uorb_index) {
+					_selected_instance[slot] = uorb_index;
+
+					if (orb_group_count(ORB_ID(distance_sensor)) > 1) {
+						PX4_INFO("slot %" PRId8 " using distance_sensor:%d (%" PRIu32 ")", slot, uorb_index, report.device_id);
+					}
+				}
+
+				_aggregation.timestamps[slot] = report.timestamp;
+				_aggregation.device_ids[slot] = report.device_id;
+				_aggregation.current_distance[slot] = report.current_distance;
+				_aggregation.min_distance[slot] = report.min_distance;
+				_aggregation.max_distance[slot] = report.max_distance;
+				_aggregation.variance[slot] = report.variance;
+				_aggregation.signal_quality[slot] = report.signal_quality;
+				_aggregation.type[slot] = report.type;
+
+				updated = true;
+			}
+		}
+	}
+
+	if (updated) {
+		_aggregation.timestamp = hrt_absolute_time();
+		_vehicle_distance_sensor_pub.publish(_aggregation);
+	}
+
+	// backup schedule to pick up late or newly started instances
+	ScheduleDelayed(300_ms);
+
+	perf_end(_cycle_perf);
+}
+
+void VehicleDistanceSensor::PrintStatus()
+{
+	for (int slot = 0; slot < vehicle_distance_sensor_s::ORIENTATION_COUNT; slot++) {
+		if (_selected_instance[slot] >= 0) {
+			PX4_INFO_RAW("[vehicle_distance_sensor] slot %d: distance_sensor:%" PRId8 " (%" PRIu32 ")\n",
+				     slot, _selected_instance[slot], _aggregation.device_ids[slot]);
+		}
+	}
+
+	perf_print_counter(_cycle_perf);
+}
+
+}; // namespace sensors
@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <lib/perf/perf_counter.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/distance_sensor.h>
+#include <uORB/topics/vehicle_distance_sensor.h>
+
+using namespace time_literals;
+
+namespace sensors
+{
+
+/**
+ * Aggregates all distance_sensor instances into a single per-orientation
+ * measurement table (vehicle_distance_sensor), so that consumers interested in
+ * one orientation do not each have to scan every instance per cycle.
+ */
+class VehicleDistanceSensor : public px4::ScheduledWorkItem
+{
+public:
+
+	VehicleDistanceSensor();
+	~VehicleDistanceSensor() override;
+
+	bool Start();
+	void Stop();
+
+	void PrintStatus();
+
+private:
+	void Run() override;
+
+	/**
+	 * Map a distance_sensor orientation to its slot in the aggregated table.
+	 * @return slot index, or -1 for orientations without a dedicated slot
+	 */
+	static int8_t OrientationSlot(uint8_t orientation);
+
+	static constexpr int MAX_SENSOR_COUNT = 4;
+
+	uORB::Publication<vehicle_distance_sensor_s> _vehicle_distance_sensor_pub{ORB_ID(vehicle_distance_sensor)};
+
+	uORB::SubscriptionCallbackWorkItem _distance_sensor_subs[MAX_SENSOR_COUNT] {
+		{this, ORB_ID(distance_sensor), 0},
+		{this, ORB_ID(distance_sensor), 1},
+		{this, ORB_ID(distance_sensor), 2},
+		{this, ORB_ID(distance_sensor), 3},
+	};
+
+	vehicle_distance_sensor_s _aggregation{};
+
+	bool _advertised[MAX_SENSOR_COUNT] {};
+	hrt_abstime _last_advertised_check[MAX_SENSOR_COUNT] {};
+
+	int8_t _selected_instance[vehicle_distance_sensor_s::ORIENTATION_COUNT] {-1, -1, -1, -1};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
+};
+}; // namespace sensors
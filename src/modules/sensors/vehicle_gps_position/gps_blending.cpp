@@ -204,148 +204,200 @@ bool GpsBlending::blend_gps_data(uint64_t hrt_now_us)
 	}
 
 	if (gps_new_output_data) {
-		// calculate the sum squared speed accuracy across all GPS sensors
-		float speed_accuracy_sum_sq = 0.0f;
+		// The weights only depend on the reported receiver accuracies which drift slowly,
+		// so they are only recomputed when a metric leaves the hysteresis band around the
+		// value the cached weights were computed from
+		if (!_blend_weights_valid || blend_weights_stale()) {
+			_blend_weights_valid = calc_blend_weights();
+		}
 
-		if (_blend_use_spd_acc) {
-			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-				if (_gps_state[i].fix_type >= 3 && _gps_state[i].s_variance_m_s > 0.0f) {
-					speed_accuracy_sum_sq += _gps_state[i].s_variance_m_s * _gps_state[i].s_variance_m_s;
-				}
-			}
+		// if we can't do blending using reported accuracy, return false and hard switch logic will be used instead
+		if (!_blend_weights_valid) {
+			return false;
 		}
 
-		// calculate the sum squared horizontal position accuracy across all GPS sensors
-		float horizontal_accuracy_sum_sq = 0.0f;
+		// With updated weights we can calculate a blended GPS solution and
+		// offsets for each physical receiver
+		sensor_gps_s gps_blended_state = gps_blend_states(_blend_weights);
 
-		if (_blend_use_hpos_acc) {
-			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-				if (_gps_state[i].fix_type >= 2 && _gps_state[i].eph > 0.0f) {
-					horizontal_accuracy_sum_sq += _gps_state[i].eph * _gps_state[i].eph;
-				}
+		update_gps_offsets(gps_blended_state);
+
+		// calculate a blended output from the offset corrected receiver data
+		// publish if blending was successful
+		calc_gps_blend_output(gps_blended_state, _blend_weights);
+
+		_gps_blended_state = gps_blended_state;
+		_selected_gps = GPS_MAX_RECEIVERS_BLEND;
+		_is_new_output_data_available = true;
+	}
+
+	return true;
+}
+
+bool GpsBlending::calc_blend_weights()
+{
+	// calculate the sum squared speed accuracy across all GPS sensors
+	float speed_accuracy_sum_sq = 0.0f;
+
+	if (_blend_use_spd_acc) {
+		for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+			if (_gps_state[i].fix_type >= 3 && _gps_state[i].s_variance_m_s > 0.0f) {
+				speed_accuracy_sum_sq += _gps_state[i].s_variance_m_s * _gps_state[i].s_variance_m_s;
 			}
 		}
+	}
 
-		// calculate the sum squared vertical position accuracy across all GPS sensors
-		float vertical_accuracy_sum_sq = 0.0f;
+	// calculate the sum squared horizontal position accuracy across all GPS sensors
+	float horizontal_accuracy_sum_sq = 0.0f;
 
-		if (_blend_use_vpos_acc) {
-			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-				if (_gps_state[i].fix_type >= 3 && _gps_state[i].epv > 0.0f) {
-					vertical_accuracy_sum_sq += _gps_state[i].epv * _gps_state[i].epv;
-				}
+	if (_blend_use_hpos_acc) {
+		for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+			if (_gps_state[i].fix_type >= 2 && _gps_state[i].eph > 0.0f) {
+				horizontal_accuracy_sum_sq += _gps_state[i].eph * _gps_state[i].eph;
 			}
 		}
+	}
 
-		// Check if we can do blending using reported accuracy
-		bool can_do_blending = (horizontal_accuracy_sum_sq > 0.0f || vertical_accuracy_sum_sq > 0.0f
-					|| speed_accuracy_sum_sq > 0.0f);
+	// calculate the sum squared vertical position accuracy across all GPS sensors
+	float vertical_accuracy_sum_sq = 0.0f;
 
-		// if we can't do blending using reported accuracy, return false and hard switch logic will be used instead
-		if (!can_do_blending) {
-			return false;
+	if (_blend_use_vpos_acc) {
+		for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+			if (_gps_state[i].fix_type >= 3 && _gps_state[i].epv > 0.0f) {
+				vertical_accuracy_sum_sq += _gps_state[i].epv * _gps_state[i].epv;
+			}
 		}
+	}
 
-		float sum_of_all_weights = 0.0f;
+	// Check if we can do blending using reported accuracy
+	bool can_do_blending = (horizontal_accuracy_sum_sq > 0.0f || vertical_accuracy_sum_sq > 0.0f
+				|| speed_accuracy_sum_sq > 0.0f);
 
-		// calculate a weighting using the reported speed accuracy
-		float spd_blend_weights[GPS_MAX_RECEIVERS_BLEND] {};
+	// if we can't do blending using reported accuracy, return false and hard switch logic will be used instead
+	if (!can_do_blending) {
+		return false;
+	}
 
-		if (speed_accuracy_sum_sq > 0.0f && _blend_use_spd_acc) {
-			// calculate the weights using the inverse of the variances
-			float sum_of_spd_weights = 0.0f;
+	float sum_of_all_weights = 0.0f;
 
-			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-				if (_gps_state[i].fix_type >= 3 && _gps_state[i].s_variance_m_s >= 0.001f) {
-					spd_blend_weights[i] = 1.0f / (_gps_state[i].s_variance_m_s * _gps_state[i].s_variance_m_s);
-					sum_of_spd_weights += spd_blend_weights[i];
-				}
-			}
+	// calculate a weighting using the reported speed accuracy
+	float spd_blend_weights[GPS_MAX_RECEIVERS_BLEND] {};
 
-			// normalise the weights
-			if (sum_of_spd_weights > 0.0f) {
-				for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-					spd_blend_weights[i] = spd_blend_weights[i] / sum_of_spd_weights;
-				}
+	if (speed_accuracy_sum_sq > 0.0f && _blend_use_spd_acc) {
+		// calculate the weights using the inverse of the variances
+		float sum_of_spd_weights = 0.0f;
 
-				sum_of_all_weights += 1.0f;
+		for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+			if (_gps_state[i].fix_type >= 3 && _gps_state[i].s_variance_m_s >= 0.001f) {
+				spd_blend_weights[i] = 1.0f / (_gps_state[i].s_variance_m_s * _gps_state[i].s_variance_m_s);
+				sum_of_spd_weights += spd_blend_weights[i];
 			}
 		}
 
-		// calculate a weighting using the reported horizontal position
-		float hpos_blend_weights[GPS_MAX_RECEIVERS_BLEND] {};
-
-		if (horizontal_accuracy_sum_sq > 0.0f && _blend_use_hpos_acc) {
-			// calculate the weights using the inverse of the variances
-			float sum_of_hpos_weights = 0.0f;
-
+		// normalise the weights
+		if (sum_of_spd_weights > 0.0f) {
 			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-				if (_gps_state[i].fix_type >= 2 && _gps_state[i].eph >= 0.001f) {
-					hpos_blend_weights[i] = horizontal_accuracy_sum_sq / (_gps_state[i].eph * _gps_state[i].eph);
-					sum_of_hpos_weights += hpos_blend_weights[i];
-				}
+				spd_blend_weights[i] = spd_blend_weights[i] / sum_of_spd_weights;
 			}
 
-			// normalise the weights
-			if (sum_of_hpos_weights > 0.0f) {
-				for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-					hpos_blend_weights[i] = hpos_blend_weights[i] / sum_of_hpos_weights;
-				}
-
-				sum_of_all_weights += 1.0f;
-			}
+			sum_of_all_weights += 1.0f;
 		}
+	}
 
-		// calculate a weighting using the reported vertical position accuracy
-		float vpos_blend_weights[GPS_MAX_RECEIVERS_BLEND] = {};
+	// calculate a weighting using the reported horizontal position
+	float hpos_blend_weights[GPS_MAX_RECEIVERS_BLEND] {};
 
-		if (vertical_accuracy_sum_sq > 0.0f && _blend_use_vpos_acc) {
-			// calculate the weights using the inverse of the variances
-			float sum_of_vpos_weights = 0.0f;
+	if (horizontal_accuracy_sum_sq > 0.0f && _blend_use_hpos_acc) {
+		// calculate the weights using the inverse of the variances
+		float sum_of_hpos_weights = 0.0f;
 
-			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-				if (_gps_state[i].fix_type >= 3 && _gps_state[i].epv >= 0.001f) {
-					vpos_blend_weights[i] = vertical_accuracy_sum_sq / (_gps_state[i].epv * _gps_state[i].epv);
-					sum_of_vpos_weights += vpos_blend_weights[i];
-				}
+		for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+			if (_gps_state[i].fix_type >= 2 && _gps_state[i].eph >= 0.001f) {
+				hpos_blend_weights[i] = horizontal_accuracy_sum_sq / (_gps_state[i].eph * _gps_state[i].eph);
+				sum_of_hpos_weights += hpos_blend_weights[i];
 			}
+		}
 
-			// normalise the weights
-			if (sum_of_vpos_weights > 0.0f) {
-				for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-					vpos_blend_weights[i] = vpos_blend_weights[i] / sum_of_vpos_weights;
-				}
+		// normalise the weights
+		if (sum_of_hpos_weights > 0.0f) {
+			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+				hpos_blend_weights[i] = hpos_blend_weights[i] / sum_of_hpos_weights;
+			}
 
-				sum_of_all_weights += 1.0f;
-			};
+			sum_of_all_weights += 1.0f;
 		}
+	}
 
-		// blend weight for each GPS. The blend weights must sum to 1.0 across all instances.
-		float blend_weights[GPS_MAX_RECEIVERS_BLEND];
+	// calculate a weighting using the reported vertical position accuracy
+	float vpos_blend_weights[GPS_MAX_RECEIVERS_BLEND] = {};
+
+	if (vertical_accuracy_sum_sq > 0.0f && _blend_use_vpos_acc) {
+		// calculate the weights using the inverse of the variances
+		float sum_of_vpos_weights = 0.0f;
 
-		// calculate an overall weight
 		for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
-			blend_weights[i] = (hpos_blend_weights[i] + vpos_blend_weights[i] + spd_blend_weights[i]) / sum_of_all_weights;
+			if (_gps_state[i].fix_type >= 3 && _gps_state[i].epv >= 0.001f) {
+				vpos_blend_weights[i] = vertical_accuracy_sum_sq / (_gps_state[i].epv * _gps_state[i].epv);
+				sum_of_vpos_weights += vpos_blend_weights[i];
+			}
 		}
 
-		// With updated weights we can calculate a blended GPS solution and
-		// offsets for each physical receiver
-		sensor_gps_s gps_blended_state = gps_blend_states(blend_weights);
+		// normalise the weights
+		if (sum_of_vpos_weights > 0.0f) {
+			for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+				vpos_blend_weights[i] = vpos_blend_weights[i] / sum_of_vpos_weights;
+			}
 
-		update_gps_offsets(gps_blended_state);
+			sum_of_all_weights += 1.0f;
+		};
+	}
 
-		// calculate a blended output from the offset corrected receiver data
-		// publish if blending was successful
-		calc_gps_blend_output(gps_blended_state, blend_weights);
+	if (sum_of_all_weights <= 0.0f) {
+		return false;
+	}
 
-		_gps_blended_state = gps_blended_state;
-		_selected_gps = GPS_MAX_RECEIVERS_BLEND;
-		_is_new_output_data_available = true;
+	// blend weight for each GPS. The blend weights must sum to 1.0 across all instances.
+	for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+		_blend_weights[i] = (hpos_blend_weights[i] + vpos_blend_weights[i] + spd_blend_weights[i]) / sum_of_all_weights;
+	}
+
+	// record the metrics the weights were computed from for the staleness check
+	for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+		_weights_fix_type[i] = _gps_state[i].fix_type;
+		_weights_s_variance[i] = _gps_state[i].s_variance_m_s;
+		_weights_eph[i] = _gps_state[i].eph;
+		_weights_epv[i] = _gps_state[i].epv;
 	}
 
 	return true;
 }
 
+bool GpsBlending::blend_weights_stale() const
+{
+	for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+		if (_gps_state[i].fix_type != _weights_fix_type[i]) {
+			return true;
+		}
+
+		if (_blend_use_spd_acc
+		    && (fabsf(_gps_state[i].s_variance_m_s - _weights_s_variance[i]) > WEIGHT_HYSTERESIS * _weights_s_variance[i])) {
+			return true;
+		}
+
+		if (_blend_use_hpos_acc
+		    && (fabsf(_gps_state[i].eph - _weights_eph[i]) > WEIGHT_HYSTERESIS * _weights_eph[i])) {
+			return true;
+		}
+
+		if (_blend_use_vpos_acc
+		    && (fabsf(_gps_state[i].epv - _weights_epv[i]) > WEIGHT_HYSTERESIS * _weights_epv[i])) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 sensor_gps_s GpsBlending::gps_blend_states(float blend_weights[GPS_MAX_RECEIVERS_BLEND]) const
 {
 	// Use the GPS with the highest weighting as the reference position
@@ -102,6 +102,18 @@ private:
 	*/
 	bool blend_gps_data(uint64_t hrt_now_us);
 
+	/*
+	 * Calculate the blend weights from the reported receiver accuracies and cache them together
+	 * with the metrics they were computed from. Returns false if no usable accuracy is reported.
+	 */
+	bool calc_blend_weights();
+
+	/*
+	 * Check if any receiver accuracy metric has left the hysteresis band around the value the
+	 * cached blend weights were computed from.
+	 */
+	bool blend_weights_stale() const;
+
 	/*
 	 * Calculate internal states used to blend GPS data from multiple receivers using weightings calculated
 	 * by calc_blend_weights()
@@ -139,6 +151,17 @@ private:
 	uint8_t _gps_slowest_index{0};			///< index of the physical receiver with the slowest update rate
 	float _gps_dt[GPS_MAX_RECEIVERS_BLEND] {};		///< average time step in seconds.
 
+	// cached blend weights and the accuracy metrics they were computed from; the reported
+	// accuracies drift slowly, so the weights are only recomputed when a metric leaves the
+	// hysteresis band and the blended output is otherwise produced from the cached weights
+	static constexpr float WEIGHT_HYSTERESIS = 0.05f;	///< relative accuracy change triggering a weight recompute
+	float _blend_weights[GPS_MAX_RECEIVERS_BLEND] {};
+	bool _blend_weights_valid{false};
+	uint8_t _weights_fix_type[GPS_MAX_RECEIVERS_BLEND] {};
+	float _weights_s_variance[GPS_MAX_RECEIVERS_BLEND] {};
+	float _weights_eph[GPS_MAX_RECEIVERS_BLEND] {};
+	float _weights_epv[GPS_MAX_RECEIVERS_BLEND] {};
+
 	bool _blend_use_spd_acc{false};
 	bool _blend_use_hpos_acc{false};
 	bool _blend_use_vpos_acc{false};
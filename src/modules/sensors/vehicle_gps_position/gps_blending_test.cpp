@@ -213,6 +213,41 @@ TEST_F(GpsBlendingTest, dualReceiverBlendingHPos)
 	EXPECT_FLOAT_EQ(gps_blending.getOutputGpsData().eph, gps_data1.eph); // TODO: should be greater than
 }
 
+TEST_F(GpsBlendingTest, dualReceiverBlendingHysteresis)
+{
+	GpsBlending gps_blending;
+
+	sensor_gps_s gps_data0 = getDefaultGpsData();
+	sensor_gps_s gps_data1 = getDefaultGpsData();
+
+	gps_blending.setBlendingUseHPosAccuracy(true);
+
+	// GIVEN: a blended dual receiver setup
+	gps_data1.eph = gps_data0.eph / 2.f;
+	runSeconds(1.f, gps_blending, gps_data0, gps_data1);
+
+	EXPECT_EQ(gps_blending.getSelectedGps(), 2);
+	EXPECT_TRUE(gps_blending.isNewOutputDataAvailable());
+
+	// WHEN: the reported accuracy changes within the hysteresis band
+	gps_data1.eph *= 1.01f;
+	runSeconds(1.f, gps_blending, gps_data0, gps_data1);
+
+	// THEN: the blended output is still produced from the cached weights
+	EXPECT_EQ(gps_blending.getSelectedGps(), 2);
+	EXPECT_TRUE(gps_blending.isNewOutputDataAvailable());
+	EXPECT_FLOAT_EQ(gps_blending.getOutputGpsData().eph, gps_data1.eph);
+
+	// WHEN: the accuracy degrades beyond the hysteresis band
+	gps_data1.eph = gps_data0.eph * 4.f;
+	runSeconds(1.f, gps_blending, gps_data0, gps_data1);
+
+	// THEN: the weights are recomputed and blending continues
+	EXPECT_EQ(gps_blending.getSelectedGps(), 2);
+	EXPECT_TRUE(gps_blending.isNewOutputDataAvailable());
+	EXPECT_FLOAT_EQ(gps_blending.getOutputGpsData().eph, gps_data0.eph);
+}
+
 TEST_F(GpsBlendingTest, dualReceiverFailover)
 {
 	GpsBlending gps_blending;
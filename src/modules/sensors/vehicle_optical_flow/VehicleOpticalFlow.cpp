@@ -131,7 +131,11 @@ void VehicleOpticalFlow::Run()
 			_delta_angle += _flow_rotation * Vector3f{sensor_optical_flow.delta_angle};
 
 		} else {
-			// integrate synchronized gyro
+			// integrate synchronized gyro over the flow interval in one pass: the buffer
+			// holds raw angular rates and the calibration is applied once to the batched
+			// integral instead of rotating and offset correcting every sample
+			_gyro_calibration.SensorCorrectionsUpdate();
+
 			gyroSample gyro_sample;
 
 			while (_gyro_buffer.pop_oldest(timestamp_oldest, timestamp_newest, &gyro_sample)) {
@@ -146,11 +150,16 @@ void VehicleOpticalFlow::Run()
 				}
 			}
 
-			Vector3f delta_angle{NAN, NAN, NAN};
+			Vector3f delta_angle_raw{NAN, NAN, NAN};
 			uint16_t delta_angle_dt;
 
-			if (_gyro_integrator.reset(delta_angle, delta_angle_dt)) {
-				_delta_angle += delta_angle;
+			if (_gyro_integrator.reset(delta_angle_raw, delta_angle_dt)) {
+				// the calibration is affine, so correcting the integral is equivalent to
+				// correcting every sample (the coning term only sees the offset to second order)
+				const float integral_dt_s = delta_angle_dt * 1e-6f;
+				const Vector3f offset{_gyro_calibration.offset() + _gyro_calibration.thermal_offset()};
+
+				_delta_angle += _gyro_calibration.rotation() * (delta_angle_raw - offset * integral_dt_s);
 
 			} else {
 				// force integrator reset
@@ -346,57 +355,27 @@ void VehicleOpticalFlow::Run()
 
 void VehicleOpticalFlow::UpdateDistanceSensor()
 {
-	// update range finder buffer
-	distance_sensor_s distance_sensor;
-
-	if ((_distance_sensor_selected < 0) && _distance_sensor_subs.advertised()) {
-		for (unsigned i = 0; i < _distance_sensor_subs.size(); i++) {
-
-			if (_distance_sensor_subs[i].update(&distance_sensor)) {
-				// only use the first instace which has the correct orientation
-				if ((hrt_elapsed_time(&distance_sensor.timestamp) < 100_ms)
-				    && (distance_sensor.orientation == distance_sensor_s::ROTATION_DOWNWARD_FACING)) {
+	// update range finder buffer from the aggregated downward facing slot
+	vehicle_distance_sensor_s aggregation;
 
-					int ndist = orb_group_count(ORB_ID(distance_sensor));
+	if (_vehicle_distance_sensor_sub.update(&aggregation)) {
 
-					if (ndist > 1) {
-						PX4_INFO("selected distance_sensor:%d (%d advertised)", i, ndist);
-					}
-
-					_distance_sensor_selected = i;
-					_last_range_sensor_update = distance_sensor.timestamp;
-					break;
-				}
-			}
-		}
-	}
+		static constexpr int slot = vehicle_distance_sensor_s::ORIENTATION_DOWNWARD;
 
-	if (_distance_sensor_selected >= 0 && _distance_sensor_subs[_distance_sensor_selected].update(&distance_sensor)) {
 		// range sample
-		if (distance_sensor.orientation == distance_sensor_s::ROTATION_DOWNWARD_FACING) {
-
-			if ((distance_sensor.current_distance >= distance_sensor.min_distance)
-			    && (distance_sensor.current_distance <= distance_sensor.max_distance)) {
-
-				rangeSample sample;
-				sample.time_us = distance_sensor.timestamp;
-				sample.data = distance_sensor.current_distance;
-
-				_range_buffer.push(sample);
+		if ((aggregation.timestamps[slot] != 0) && (aggregation.timestamps[slot] != _last_range_sensor_update)
+		    && (aggregation.current_distance[slot] >= aggregation.min_distance[slot])
+		    && (aggregation.current_distance[slot] <= aggregation.max_distance[slot])) {
 
-				_last_range_sensor_update = distance_sensor.timestamp;
+			rangeSample sample;
+			sample.time_us = aggregation.timestamps[slot];
+			sample.data = aggregation.current_distance[slot];
 
-				return;
-			}
+			_range_buffer.push(sample);
 
-		} else {
-			_distance_sensor_selected = -1;
+			_last_range_sensor_update = aggregation.timestamps[slot];
 		}
 	}
-
-	if (hrt_elapsed_time(&_last_range_sensor_update) > 1_s) {
-		_distance_sensor_selected = -1;
-	}
 }
 
 void VehicleOpticalFlow::UpdateSensorGyro()
@@ -428,7 +407,8 @@ void VehicleOpticalFlow::UpdateSensorGyro()
 		}
 	}
 
-	// buffer
+	// buffer raw angular rates, the calibration is applied once per flow integration
+	// interval when the batch is consumed
 	while (_sensor_gyro_sub.updated()) {
 		const unsigned last_generation = _sensor_gyro_sub.get_last_generation();
 
@@ -441,14 +421,13 @@ void VehicleOpticalFlow::UpdateSensorGyro()
 			}
 
 			_gyro_calibration.set_device_id(sensor_gyro.device_id);
-			_gyro_calibration.SensorCorrectionsUpdate();
 
 			const float dt_s = (sensor_gyro.timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
 			_gyro_timestamp_sample_last = sensor_gyro.timestamp_sample;
 
 			gyroSample gyro_sample;
 			gyro_sample.time_us = sensor_gyro.timestamp_sample;
-			gyro_sample.data = _gyro_calibration.Correct(Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z});
+			gyro_sample.data = Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z};
 			gyro_sample.dt = dt_s;
 
 			_gyro_buffer.push(gyro_sample);
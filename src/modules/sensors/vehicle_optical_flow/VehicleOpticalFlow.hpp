@@ -49,13 +49,12 @@
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionCallback.hpp>
-#include <uORB/SubscriptionMultiArray.hpp>
-#include <uORB/topics/distance_sensor.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_optical_flow.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_attitude.h>
+#include <uORB/topics/vehicle_distance_sensor.h>
 #include <uORB/topics/vehicle_optical_flow.h>
 #include <uORB/topics/vehicle_optical_flow_vel.h>
 
@@ -90,9 +89,8 @@ private:
 
 	uORB::Subscription _params_sub{ORB_ID(parameter_update)};
 
-	uORB::SubscriptionMultiArray<distance_sensor_s> _distance_sensor_subs{ORB_ID::distance_sensor};
-
 	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
+	uORB::Subscription _vehicle_distance_sensor_sub{ORB_ID(vehicle_distance_sensor)};
 
 	uORB::SubscriptionCallbackWorkItem _sensor_flow_sub{this, ORB_ID(sensor_optical_flow)};
 	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub{this, ORB_ID(sensor_gyro)};
@@ -119,12 +117,11 @@ private:
 
 	hrt_abstime _last_publication_timestamp{0};
 
-	int _distance_sensor_selected{-1}; // because we can have several distance sensor instances with different orientations
 	hrt_abstime _last_range_sensor_update{0};
 
 	struct gyroSample {
 		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
-		matrix::Vector3f data{};
+		matrix::Vector3f data{}; ///< raw angular rate, calibration is applied when the batch is consumed
 		float dt{0.f};
 	};
 
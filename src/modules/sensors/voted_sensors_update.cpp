@@ -140,12 +140,16 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 {
 	const hrt_abstime time_now_us = hrt_absolute_time();
 
+	_imu_fresh_mask = 0;
+
 	for (int uorb_index = 0; uorb_index < MAX_SENSOR_COUNT; uorb_index++) {
 		vehicle_imu_s imu_report;
 
 		if ((_accel.priority[uorb_index] > 0) && (_gyro.priority[uorb_index] > 0)
 		    && _vehicle_imu_sub[uorb_index].update(&imu_report)) {
 
+			_imu_fresh_mask |= (1u << uorb_index);
+
 			// copy corresponding vehicle_imu_status for accel & gyro error counts
 			vehicle_imu_status_s imu_status{};
 			_vehicle_imu_status_subs[uorb_index].copy(&imu_status);
@@ -400,6 +404,12 @@ void VotedSensorsUpdate::sensorsPoll(sensor_combined_s &raw)
 {
 	imuPoll(raw);
 
+	// the inconsistency filters and sensors_status_imu can only change when at least
+	// one instance delivered fresh data, otherwise hand off to the consumers immediately
+	if ((_imu_fresh_mask == 0) && !_parameter_update) {
+		return;
+	}
+
 	calcAccelInconsistency();
 	calcGyroInconsistency();
 
@@ -464,7 +474,9 @@ void VotedSensorsUpdate::calcAccelInconsistency()
 		accel_mean /= accel_count;
 
 		for (int sensor_index = 0; sensor_index < MAX_SENSOR_COUNT; sensor_index++) {
-			if ((_accel_device_id[sensor_index] != 0) && (_accel.priority[sensor_index] > 0)) {
+			// only advance the filter for instances with fresh data, a stale sample carries no new information
+			if ((_imu_fresh_mask & (1u << sensor_index))
+			    && (_accel_device_id[sensor_index] != 0) && (_accel.priority[sensor_index] > 0)) {
 				_accel_diff[sensor_index] = 0.95f * _accel_diff[sensor_index] + 0.05f * (accel_all[sensor_index] - accel_mean);
 			}
 		}
@@ -489,7 +501,9 @@ void VotedSensorsUpdate::calcGyroInconsistency()
 		gyro_mean /= gyro_count;
 
 		for (int sensor_index = 0; sensor_index < MAX_SENSOR_COUNT; sensor_index++) {
-			if ((_gyro_device_id[sensor_index] != 0) && (_gyro.priority[sensor_index] > 0)) {
+			// only advance the filter for instances with fresh data, a stale sample carries no new information
+			if ((_imu_fresh_mask & (1u << sensor_index))
+			    && (_gyro_device_id[sensor_index] != 0) && (_gyro.priority[sensor_index] > 0)) {
 				_gyro_diff[sensor_index] = 0.95f * _gyro_diff[sensor_index] + 0.05f * (gyro_all[sensor_index] - gyro_mean);
 			}
 		}
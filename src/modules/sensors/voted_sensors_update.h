@@ -174,6 +174,8 @@ private:
 
 	uint64_t _last_accel_timestamp[MAX_SENSOR_COUNT] {};	/**< latest full timestamp */
 
+	uint8_t _imu_fresh_mask{0};			/**< bitmask of vehicle_imu instances updated this cycle */
+
 	sensor_selection_s _selection {};		/**< struct containing the sensor selection to be published to the uORB */
 
 	bool _parameter_update{false};
@@ -392,8 +392,18 @@ void GZBridge::poseInfoCallback(const ignition::msgs::Pose_V &pose)
 
 	pthread_mutex_lock(&_mutex);
 
-	for (int p = 0; p < pose.pose_size(); p++) {
+	const int pose_count = pose.pose_size();
+
+	// the world pose array carries every entity in the world and grows with the
+	// vehicle count in multi-vehicle simulation; start the name scan at the index
+	// this model was last seen at so the steady state match is the first compare
+	const int scan_start = (_pose_index >= 0 && _pose_index < pose_count) ? _pose_index : 0;
+
+	for (int i = 0; i < pose_count; i++) {
+		const int p = (scan_start + i) % pose_count;
+
 		if (pose.pose(p).name() == _model_name) {
+			_pose_index = p;
 
 			const uint64_t time_us = (pose.header().stamp().sec() * 1000000) + (pose.header().stamp().nsec() / 1000);
 
@@ -119,6 +119,8 @@ private:
 	matrix::Vector3f _euler_prev{};
 	hrt_abstime _timestamp_prev{};
 
+	int _pose_index{-1};	///< index this model was last seen at in the world pose array
+
 	const std::string _world_name;
 	const std::string _model_name;
 	const std::string _model_sim;
@@ -53,6 +53,7 @@
 #include <poll.h>
 #include <pthread.h>
 #include <sys/socket.h>
+#include <sys/time.h>
 #include <termios.h>
 #include <arpa/inet.h>
 
@@ -480,6 +481,29 @@ void SimulatorMavlink::handle_message_hil_sensor(const mavlink_message_t *msg)
 		abstime_to_ts(&ts, imu.time_usec);
 
 		px4_clock_settime(CLOCK_MONOTONIC, &ts);
+
+		// monitor the achieved speedup against the requested speed factor. hrt time
+		// is simulated time here, so wall clock has to come from the system directly.
+		struct timeval tv;
+		gettimeofday(&tv, nullptr);
+		const uint64_t wall_time_us = (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+
+		if (_last_sitl_timestamp == 0) {
+			_last_sitl_timestamp = wall_time_us;
+			_last_sim_timestamp = imu.time_usec;
+
+		} else if (wall_time_us > _last_sitl_timestamp + 10_s) {
+			const double achieved_factor = (double)(imu.time_usec - _last_sim_timestamp)
+						       / (double)(wall_time_us - _last_sitl_timestamp);
+
+			if (achieved_factor < 0.9 * _realtime_factor) {
+				PX4_WARN("Requested speed factor %.1f not achieved, currently %.1f",
+					 _realtime_factor, achieved_factor);
+			}
+
+			_last_sitl_timestamp = wall_time_us;
+			_last_sim_timestamp = imu.time_usec;
+		}
 	}
 
 	hrt_abstime now_us = hrt_absolute_time();
@@ -1046,7 +1070,9 @@ void SimulatorMavlink::request_hil_state_quaternion()
 	mavlink_message_t message = {};
 	cmd_long.command = MAV_CMD_SET_MESSAGE_INTERVAL;
 	cmd_long.param1 = MAVLINK_MSG_ID_HIL_STATE_QUATERNION;
-	cmd_long.param2 = 5e3;
+	// the interval is in simulated time, scale it by the speed factor such that the
+	// ground truth wall-clock rate stays constant when running faster than real time
+	cmd_long.param2 = 5e3 * _realtime_factor;
 	mavlink_msg_command_long_encode(_param_mav_sys_id.get(), _param_mav_comp_id.get(), &message, &cmd_long);
 	send_mavlink_message(message);
 }
@@ -1069,6 +1095,17 @@ void SimulatorMavlink::run()
 	pthread_setname_np(pthread_self(), "sim_rcv");
 #endif
 
+	// Run the simulation at a multiple of real time if requested. The lockstep
+	// handshake advances simulated time as fast as both sides complete their work,
+	// so the achievable speedup is only bounded by the slower of the two; the
+	// simulator side paces itself from the same environment variable.
+	const char *speed_factor_str = getenv("PX4_SIM_SPEED_FACTOR");
+
+	if (speed_factor_str) {
+		_realtime_factor = atof(speed_factor_str);
+		PX4_INFO("Simulation with %.1fx speedup requested", _realtime_factor);
+	}
+
 	struct sockaddr_in _myaddr {};
 	_myaddr.sin_family = AF_INET;
 	_myaddr.sin_addr.s_addr = htonl(INADDR_ANY);
@@ -206,24 +206,38 @@ public:
 	AeroSeg() : AeroSeg(1.0f, 0.2f, 0.0f, matrix::Vector3f())
 	{}
 
+	/** air density (ISA model) at the given altitude
+	 * void update_air_density(float alt)
+	 *
+	 * alt: altitude above mean sea level [m].
+	 *
+	 * Kept separate from update_aero() so the caller can run it at a lower rate:
+	 * the altitude changes slowly compared to the integration step and the powf()
+	 * here dominates the cost of a segment update. The density defaults to sea
+	 * level until the first call.
+	 */
+	void update_air_density(float alt)
+	{
+		// ISA model taken from Mustafa Cavcar, Anadolu University, Turkey
+		_pressure = P0 * powf(1.0f - 0.0065f * alt / T0_K, 5.2561f);
+		_temperature = T0_K + TEMP_GRADIENT * alt;
+		_rho = _pressure / R / _temperature;
+	}
+
 	/** aerodynamic force and moments of a generic flate plate segment
-	 * void update_aero(matrix::Vector3f v_B, matrix::Vector3f w_B, float alt = 0.0f,
-	 *                  float def = 0.0f, float thrust=0.0f, float dt = -1.0f)
+	 * void update_aero(matrix::Vector3f v_B, matrix::Vector3f w_B,
+	 *                  float def = 0.0f, float thrust=0.0f)
 	 *
 	 * v_B: 3D velocity in body frame [m/s], (front, right, down FRD frame)
 	 * w_B: 3D body rates in body frame [rad/s], FRD frame.
-	 * alt: altitude above mean sea level for computing air density [m], default is 0.
 	 * def: flap deflection angle [rad], default is 0.
 	 * thrust: thrust force [N] from the propeller to compute the slipstream velocity, default is 0.
+	 *
+	 * Uses the air density from the last update_air_density() call.
 	 */
-	void update_aero(const matrix::Vector3f &v_B, const matrix::Vector3f &w_B, float alt = 0.0f, float def = 0.0f,
+	void update_aero(const matrix::Vector3f &v_B, const matrix::Vector3f &w_B, float def = 0.0f,
 			 float thrust = 0.0f)
 	{
-		// ISA model taken from Mustafa Cavcar, Anadolu University, Turkey
-		_pressure = P0 * powf(1.0f - 0.0065f * alt / T0_K, 5.2561f);
-		_temperature = T0_K + TEMP_GRADIENT * alt;
-		_rho = _pressure / R / _temperature;
-
 		_v_S = _C_BS.transpose() * (v_B + w_B % _p_B); 	// velocity in segment frame
 
 		if (_prop_radius > 1e-4f) {
@@ -253,7 +267,7 @@ public:
 				0.0f) + _p_B % _Fa; 	// computed at vehicle _CM
 	}
 
-	// return the air density at current altitude, must be called after update_aero()
+	// return the air density at current altitude, must be called after update_air_density()
 	float get_rho() const { return _rho; }
 
 	// return angle of attack in radians
@@ -75,6 +75,7 @@ void Sih::run()
 	_last_run = task_start;
 	_airspeed_time = task_start;
 	_dist_snsr_time = task_start;
+	_gt_time = task_start;
 	_vehicle = (VehicleType)constrain(_sih_vtype.get(), static_cast<typeof _sih_vtype.get()>(0),
 					  static_cast<typeof _sih_vtype.get()>(2));
 
@@ -110,6 +111,9 @@ void Sih::lockstep_loop()
 	// 200 - 2000 Hz
 	int sim_interval_us = math::constrain(int(roundf(1e6f / rate)), 500, 5000);
 
+	_dt_nominal = sim_interval_us * 1e-6f;
+	update_discrete_model();
+
 	float speed_factor = 1.f;
 	const char *speedup = getenv("PX4_SIM_SPEED_FACTOR");
 
@@ -175,6 +179,9 @@ void Sih::realtime_loop()
 	// 200 - 2000 Hz
 	int interval_us = math::constrain(int(roundf(1e6f / rate)), 500, 5000);
 
+	_dt_nominal = interval_us * 1e-6f;
+	update_discrete_model();
+
 	px4_sem_init(&_data_semaphore, 0, 0);
 	hrt_call_every(&_timer_call, interval_us, interval_us, timer_callback, &_data_semaphore);
 
@@ -208,7 +215,15 @@ void Sih::sensor_step()
 	const float dt = (now - _last_run) * 1e-6f;
 	_last_run = now;
 
-	read_motors(dt);
+	read_motors();
+
+	// the ISA density only depends on the (slowly changing) altitude and its
+	// powf() dominates the cost of an aerodynamic segment update, so refresh
+	// it at 10 Hz rather than in every update_aero() call
+	if ((_vehicle == VehicleType::FW || _vehicle == VehicleType::TS) && now - _air_density_time >= 100_ms) {
+		_air_density_time = now;
+		update_air_densities();
+	}
 
 	generate_force_and_torques();
 
@@ -228,7 +243,12 @@ void Sih::sensor_step()
 		send_dist_snsr(now);
 	}
 
-	publish_ground_truth(now);
+	// ground truth published at 250 Hz, the consumers (logging, comparison with
+	// the estimator) do not need the full IMU rate
+	if (now - _gt_time >= 4_ms) {
+		_gt_time = now;
+		publish_ground_truth(now);
+	}
 
 	perf_end(_loop_perf);
 }
@@ -264,11 +284,24 @@ void Sih::parameters_updated()
 	_distance_snsr_override = _sih_distance_snsr_override.get();
 
 	_T_TAU = _sih_thrust_tau.get();
+
+	update_discrete_model();
+}
+
+void Sih::update_discrete_model()
+{
+	// exact discretization of the first order motor lag at the nominal step,
+	// precomputed at rate or parameter change rather than per integration step.
+	// Unlike the forward Euler coefficient dt/tau this stays stable for any
+	// time constant.
+	_motor_lag_alpha = 1.0f - expf(-_dt_nominal / _T_TAU);
 }
 
 void Sih::init_variables()
 {
+#if defined(SIH_WGN_BOX_MULLER)
 	srand(1234);    // initialize the random seed once before calling generate_wgn()
+#endif
 
 	_p_I = Vector3f(0.0f, 0.0f, 0.0f);
 	_v_I = Vector3f(0.0f, 0.0f, 0.0f);
@@ -278,7 +311,7 @@ void Sih::init_variables()
 	_u[0] = _u[1] = _u[2] = _u[3] = 0.0f;
 }
 
-void Sih::read_motors(const float dt)
+void Sih::read_motors()
 {
 	actuator_outputs_s actuators_out;
 
@@ -291,7 +324,7 @@ void Sih::read_motors(const float dt)
 
 			} else {
 				float u_sp = actuators_out.output[i];
-				_u[i] = _u[i] + dt / _T_TAU * (u_sp - _u[i]); // first order transfer function with time constant tau
+				_u[i] = _u[i] + _motor_lag_alpha * (u_sp - _u[i]); // first order transfer function with time constant tau
 			}
 		}
 	}
@@ -326,12 +359,11 @@ void Sih::generate_force_and_torques()
 void Sih::generate_fw_aerodynamics()
 {
 	_v_B = _C_IB.transpose() * _v_I; 	// velocity in body frame [m/s]
-	float altitude = _H0 - _p_I(2);
-	_wing_l.update_aero(_v_B, _w_B, altitude, _u[0]*FLAP_MAX);
-	_wing_r.update_aero(_v_B, _w_B, altitude, -_u[0]*FLAP_MAX);
-	_tailplane.update_aero(_v_B, _w_B, altitude, _u[1]*FLAP_MAX, _T_MAX * _u[3]);
-	_fin.update_aero(_v_B, _w_B, altitude, _u[2]*FLAP_MAX, _T_MAX * _u[3]);
-	_fuselage.update_aero(_v_B, _w_B, altitude);
+	_wing_l.update_aero(_v_B, _w_B, _u[0]*FLAP_MAX);
+	_wing_r.update_aero(_v_B, _w_B, -_u[0]*FLAP_MAX);
+	_tailplane.update_aero(_v_B, _w_B, _u[1]*FLAP_MAX, _T_MAX * _u[3]);
+	_fin.update_aero(_v_B, _w_B, _u[2]*FLAP_MAX, _T_MAX * _u[3]);
+	_fuselage.update_aero(_v_B, _w_B);
 
 	// sum of aerodynamic forces
 	_Fa_I = _C_IB * (_wing_l.get_Fa() + _wing_r.get_Fa() + _tailplane.get_Fa() + _fin.get_Fa() + _fuselage.get_Fa()) - _KDV
@@ -349,17 +381,16 @@ void Sih::generate_ts_aerodynamics()
 	// the aerodynamic is resolved in a frame like a standard aircraft (nose-right-belly)
 	Vector3f v_ts = _C_BS.transpose() * _v_B;
 	Vector3f w_ts = _C_BS.transpose() * _w_B;
-	float altitude = _H0 - _p_I(2);
 
 	Vector3f Fa_ts{};
 	Vector3f Ma_ts{};
 
 	for (int i = 0; i < NB_TS_SEG; i++) {
 		if (i <= NB_TS_SEG / 2) {
-			_ts[i].update_aero(v_ts, w_ts, altitude, _u[5]*TS_DEF_MAX, _T_MAX * _u[1]);
+			_ts[i].update_aero(v_ts, w_ts, _u[5]*TS_DEF_MAX, _T_MAX * _u[1]);
 
 		} else {
-			_ts[i].update_aero(v_ts, w_ts, altitude, -_u[4]*TS_DEF_MAX, _T_MAX * _u[0]);
+			_ts[i].update_aero(v_ts, w_ts, -_u[4]*TS_DEF_MAX, _T_MAX * _u[0]);
 		}
 
 		Fa_ts += _ts[i].get_Fa();
@@ -370,6 +401,24 @@ void Sih::generate_ts_aerodynamics()
 	_Ma_B = _C_BS * Ma_ts - _KDW * _w_B; 	// aerodynamic moments
 }
 
+void Sih::update_air_densities()
+{
+	const float altitude = _H0 - _p_I(2);
+
+	if (_vehicle == VehicleType::FW) {
+		_wing_l.update_air_density(altitude);
+		_wing_r.update_air_density(altitude);
+		_tailplane.update_air_density(altitude);
+		_fin.update_air_density(altitude);
+		_fuselage.update_air_density(altitude);
+
+	} else if (_vehicle == VehicleType::TS) {
+		for (int i = 0; i < NB_TS_SEG; i++) {
+			_ts[i].update_air_density(altitude);
+		}
+	}
+}
+
 void Sih::equations_of_motion(const float dt)
 {
 	_C_IB = matrix::Dcm<float>(_q); // body to inertial transformation
@@ -567,6 +616,10 @@ void Sih::publish_ground_truth(const hrt_abstime &time_now_us)
 
 float Sih::generate_wgn()   // generate white Gaussian noise sample with std=1
 {
+#if defined(SIH_WGN_BOX_MULLER)
+	// exact Box-Muller generator, kept selectable for reference. Roughly four
+	// times the cost per sample of the integer generator below (logf, sqrtf,
+	// and the libc rand() lock on every other call).
 	// algorithm 1:
 	// float temp=((float)(rand()+1))/(((float)RAND_MAX+1.0f));
 	// return sqrtf(-2.0f*logf(temp))*cosf(2.0f*M_PI_F*rand()/RAND_MAX);
@@ -592,6 +645,24 @@ float Sih::generate_wgn()   // generate white Gaussian noise sample with std=1
 
 	phase = !phase;
 	return X;
+#else
+	// sum of 12 uniform 16 bit samples (central limit theorem), computed in
+	// integer arithmetic from a xorshift32 generator: no transcendentals and
+	// no libc rand() lock on the integration path. The tails are clipped at
+	// 6 sigma, well beyond the modeled sensor noise levels.
+	static uint32_t state = 1234u;
+
+	int32_t acc = -6 * 65535;
+
+	for (int i = 0; i < 6; i++) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		acc += (int32_t)(state & 0xffffu) + (int32_t)(state >> 16);
+	}
+
+	return (float)acc * (1.0f / 65536.0f);
+#endif
 }
 
 Vector3f Sih::noiseGauss3f(float stdx, float stdy, float stdz)
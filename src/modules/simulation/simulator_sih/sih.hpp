@@ -145,8 +145,11 @@ private:
 
 	void init_variables();
 
+	// precompute the constant-step discrete model (recomputed at rate or parameter change)
+	void update_discrete_model();
+
 	// read the motor signals outputted from the mixer
-	void read_motors(const float dt);
+	void read_motors();
 
 	// generate the motors thrust and torque in the body frame
 	void generate_force_and_torques();
@@ -161,6 +164,7 @@ private:
 	void publish_ground_truth(const hrt_abstime &time_now_us);
 	void generate_fw_aerodynamics();
 	void generate_ts_aerodynamics();
+	void update_air_densities();
 	void sensor_step();
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
@@ -181,6 +185,11 @@ private:
 	hrt_abstime _last_actuator_output_time{0};
 	hrt_abstime _airspeed_time{0};
 	hrt_abstime _dist_snsr_time{0};
+	hrt_abstime _air_density_time{0};
+	hrt_abstime _gt_time{0};
+
+	float _dt_nominal{4e-3f};     // nominal integration step [s], set by the loop rate
+	float _motor_lag_alpha{0.f};  // discrete coefficient of the first order motor lag at _dt_nominal
 
 	bool        _grounded{true};// whether the vehicle is on the ground
 
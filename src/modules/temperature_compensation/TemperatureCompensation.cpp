@@ -366,16 +366,20 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant
+	// a new publication, otherwise the cached offsets are still valid
+	const bool temperature_changed = fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
+	if (temperature_changed) {
+		calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, _gyro_data.last_offsets[topic_instance]);
 		_gyro_data.last_temperature[topic_instance] = temperature;
-		return 2;
 	}
 
-	return 1;
+	for (uint8_t i = 0; i < 3; i++) {
+		offsets[i] = _gyro_data.last_offsets[topic_instance][i];
+	}
+
+	return temperature_changed ? 2 : 1;
 }
 
 int TemperatureCompensation::update_offsets_accel(int topic_instance, float temperature, float *offsets)
@@ -392,16 +396,20 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant
+	// a new publication, otherwise the cached offsets are still valid
+	const bool temperature_changed = fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
+	if (temperature_changed) {
+		calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, _accel_data.last_offsets[topic_instance]);
 		_accel_data.last_temperature[topic_instance] = temperature;
-		return 2;
 	}
 
-	return 1;
+	for (uint8_t i = 0; i < 3; i++) {
+		offsets[i] = _accel_data.last_offsets[topic_instance][i];
+	}
+
+	return temperature_changed ? 2 : 1;
 }
 
 int TemperatureCompensation::update_offsets_baro(int topic_instance, float temperature, float *offsets)
@@ -418,16 +426,18 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant
+	// a new publication, otherwise the cached offset is still valid
+	const bool temperature_changed = fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
+	if (temperature_changed) {
+		calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, _baro_data.last_offsets[topic_instance][0]);
 		_baro_data.last_temperature[topic_instance] = temperature;
-		return 2;
 	}
 
-	return 1;
+	*offsets = _baro_data.last_offsets[topic_instance][0];
+
+	return temperature_changed ? 2 : 1;
 }
 
 void TemperatureCompensation::print_status()
@@ -269,6 +269,7 @@ private:
 
 		uint8_t device_mapping[SENSOR_COUNT_MAX] {}; /// map a topic instance to the parameters index
 		float last_temperature[SENSOR_COUNT_MAX] {};
+		float last_offsets[SENSOR_COUNT_MAX][3] {};  /// offsets evaluated at last_temperature (baro only uses [0])
 	};
 
 	PerSensorData _gyro_data;
@@ -0,0 +1,229 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "BridgeProtocol.hpp"
+
+#include <string.h>
+
+namespace uorb_bridge
+{
+
+uint16_t crc16(const uint8_t *data, size_t len, uint16_t crc)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= (uint16_t)data[i] << 8;
+
+		for (int bit = 0; bit < 8; bit++) {
+			if (crc & 0x8000) {
+				crc = (crc << 1) ^ 0x1021;
+
+			} else {
+				crc <<= 1;
+			}
+		}
+	}
+
+	return crc;
+}
+
+int delta_encode(const uint8_t *reference, const uint8_t *current, size_t len, uint8_t *out, size_t out_max)
+{
+	size_t pos = 0;
+	size_t encoded = 0;
+
+	while (pos < len) {
+		// run of unchanged bytes
+		size_t skip = 0;
+
+		while (pos + skip < len && skip < 255 && reference[pos + skip] == current[pos + skip]) {
+			skip++;
+		}
+
+		pos += skip;
+
+		// run of changed bytes (stop at a gap of 2+ equal bytes, a single equal
+		// byte is cheaper to copy than to encode as its own skip/copy pair)
+		size_t copy = 0;
+
+		while (pos + copy < len && copy < 255) {
+			if (reference[pos + copy] == current[pos + copy]
+			    && (pos + copy + 1 >= len || reference[pos + copy + 1] == current[pos + copy + 1])) {
+				break;
+			}
+
+			copy++;
+		}
+
+		if (encoded + 2 + copy >= len || encoded + 2 + copy > out_max) {
+			// not smaller than sending the full struct
+			return -1;
+		}
+
+		out[encoded++] = (uint8_t)skip;
+		out[encoded++] = (uint8_t)copy;
+		memcpy(&out[encoded], &current[pos], copy);
+		encoded += copy;
+		pos += copy;
+	}
+
+	return (int)encoded;
+}
+
+int delta_apply(uint8_t *state, size_t len, const uint8_t *delta, size_t delta_len)
+{
+	size_t pos = 0;
+	size_t consumed = 0;
+
+	while (consumed < delta_len) {
+		if (consumed + 2 > delta_len) {
+			return -1;
+		}
+
+		const size_t skip = delta[consumed++];
+		const size_t copy = delta[consumed++];
+
+		if (pos + skip + copy > len || consumed + copy > delta_len) {
+			return -1;
+		}
+
+		pos += skip;
+		memcpy(&state[pos], &delta[consumed], copy);
+		pos += copy;
+		consumed += copy;
+	}
+
+	return 0;
+}
+
+int frame_pack(FrameType type, uint8_t topic_id, uint8_t seq, const uint8_t *payload, size_t payload_len,
+	       uint8_t *out, size_t out_max)
+{
+	if (payload_len > MAX_PAYLOAD_SIZE || out_max < FRAME_HEADER_SIZE + payload_len + FRAME_CRC_SIZE) {
+		return -1;
+	}
+
+	FrameHeader *header = (FrameHeader *)out;
+	header->sync0 = SYNC0;
+	header->sync1 = SYNC1;
+	header->type = (uint8_t)type;
+	header->topic_id = topic_id;
+	header->seq = seq;
+	header->payload_len = (uint16_t)payload_len;
+
+	if (payload_len > 0) {
+		memcpy(out + FRAME_HEADER_SIZE, payload, payload_len);
+	}
+
+	// CRC over everything after the sync bytes
+	const uint16_t crc = crc16(out + 2, FRAME_HEADER_SIZE - 2 + payload_len);
+	out[FRAME_HEADER_SIZE + payload_len] = (uint8_t)(crc & 0xFF);
+	out[FRAME_HEADER_SIZE + payload_len + 1] = (uint8_t)(crc >> 8);
+
+	return (int)(FRAME_HEADER_SIZE + payload_len + FRAME_CRC_SIZE);
+}
+
+bool FrameParser::parse(uint8_t byte)
+{
+	switch (_state) {
+	case State::SYNC0:
+		if (byte == SYNC0) {
+			_state = State::SYNC1;
+		}
+
+		break;
+
+	case State::SYNC1:
+		if (byte == SYNC1) {
+			_header.sync0 = SYNC0;
+			_header.sync1 = SYNC1;
+			_count = 2;
+			_state = State::HEADER;
+
+		} else {
+			_state = (byte == SYNC0) ? State::SYNC1 : State::SYNC0;
+		}
+
+		break;
+
+	case State::HEADER:
+		((uint8_t *)&_header)[_count++] = byte;
+
+		if (_count == FRAME_HEADER_SIZE) {
+			if (_header.payload_len > MAX_PAYLOAD_SIZE) {
+				_state = State::SYNC0;
+
+			} else {
+				_count = 0;
+				_state = (_header.payload_len > 0) ? State::PAYLOAD : State::CRC;
+			}
+		}
+
+		break;
+
+	case State::PAYLOAD:
+		_payload[_count++] = byte;
+
+		if (_count == _header.payload_len) {
+			_count = 0;
+			_state = State::CRC;
+		}
+
+		break;
+
+	case State::CRC:
+		if (_count == 0) {
+			_crc_rx = byte;
+			_count = 1;
+
+		} else {
+			_crc_rx |= (uint16_t)byte << 8;
+			_count = 0;
+			_state = State::SYNC0;
+
+			uint16_t crc = crc16((const uint8_t *)&_header + 2, FRAME_HEADER_SIZE - 2);
+			crc = crc16(_payload, _header.payload_len, crc);
+
+			if (crc == _crc_rx) {
+				return true;
+			}
+
+			_crc_errors++;
+		}
+
+		break;
+	}
+
+	return false;
+}
+
+} // namespace uorb_bridge
@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file BridgeProtocol.hpp
+ *
+ * Wire format for the inter-FMU uORB replication bridge.
+ *
+ * Frames are byte-oriented so they work over UART as well as datagram
+ * transports. Data frames carry the topic's ORB_ID enum value instead of the
+ * topic name to keep the per-sample overhead small; control frames (which are
+ * rare) carry the name so both sides can resolve topics without agreeing on
+ * enum ordering at build time.
+ *
+ * Layout (little endian):
+ *
+ *   sync0 sync1 | type | topic_id | seq | payload_len (u16) | payload | crc (u16)
+ *
+ * The CRC covers type through the end of the payload.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace uorb_bridge
+{
+
+static constexpr uint8_t SYNC0 = 0xEB;
+static constexpr uint8_t SYNC1 = 0x5A;
+
+static constexpr uint8_t TOPIC_ID_NONE = 0xFF;	///< control frames not tied to a topic
+
+enum class FrameType : uint8_t {
+	HEARTBEAT = 0,		///< link keep-alive, payload: uint64 sender time
+	ADD_SUBSCRIPTION = 1,	///< payload: int32 rate_hz + topic name (no terminator)
+	REMOVE_SUBSCRIPTION = 2,	///< payload: topic name
+	ADVERTISE = 3,		///< payload: topic name
+	DATA = 4,		///< full topic struct (keyframe)
+	DATA_DELTA = 5,		///< delta against the last keyframe of this topic
+	ACK = 6,		///< payload: acked sequence number (uint8)
+};
+
+#pragma pack(push, 1)
+struct FrameHeader {
+	uint8_t sync0;
+	uint8_t sync1;
+	uint8_t type;
+	uint8_t topic_id;
+	uint8_t seq;
+	uint16_t payload_len;
+};
+#pragma pack(pop)
+
+static constexpr size_t FRAME_HEADER_SIZE = sizeof(FrameHeader);
+static constexpr size_t FRAME_CRC_SIZE = sizeof(uint16_t);
+static constexpr size_t MAX_PAYLOAD_SIZE = 512;
+static constexpr size_t MAX_FRAME_SIZE = FRAME_HEADER_SIZE + MAX_PAYLOAD_SIZE + FRAME_CRC_SIZE;
+
+/**
+ * CRC-16/CCITT-FALSE, the polynomial already used by px4io serial framing.
+ */
+uint16_t crc16(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
+
+/**
+ * Encode @p current as a delta against @p reference (the last keyframe).
+ *
+ * The delta is a sequence of (skip, copy, bytes...) runs: skip equal bytes,
+ * then copy differing bytes. Both counts are single bytes, so long runs are
+ * split. A delta is only useful if it is smaller than the full struct.
+ *
+ * @return encoded size, or -1 if the delta would not be smaller than @p len
+ */
+int delta_encode(const uint8_t *reference, const uint8_t *current, size_t len, uint8_t *out, size_t out_max);
+
+/**
+ * Apply a delta produced by delta_encode() on top of @p state (the receiver's
+ * copy of the keyframe). @p state is updated in place.
+ *
+ * @return 0 on success, -1 if the delta is malformed for @p len
+ */
+int delta_apply(uint8_t *state, size_t len, const uint8_t *delta, size_t delta_len);
+
+/**
+ * Write a complete frame (header, payload, CRC) into @p out.
+ *
+ * @return frame size, or -1 if @p out_max is too small or the payload too large
+ */
+int frame_pack(FrameType type, uint8_t topic_id, uint8_t seq, const uint8_t *payload, size_t payload_len,
+	       uint8_t *out, size_t out_max);
+
+/**
+ * Incremental frame parser fed one receive chunk at a time.
+ */
+class FrameParser
+{
+public:
+	/**
+	 * Feed a single byte.
+	 *
+	 * @return true when a complete, CRC-checked frame is available via header()/payload()
+	 */
+	bool parse(uint8_t byte);
+
+	const FrameHeader &header() const { return _header; }
+	const uint8_t *payload() const { return _payload; }
+
+	uint32_t crc_errors() const { return _crc_errors; }
+
+private:
+	enum class State : uint8_t {
+		SYNC0,
+		SYNC1,
+		HEADER,
+		PAYLOAD,
+		CRC,
+	};
+
+	State _state{State::SYNC0};
+	FrameHeader _header{};
+	uint8_t _payload[MAX_PAYLOAD_SIZE];
+	size_t _count{0};
+	uint16_t _crc_rx{0};
+	uint32_t _crc_errors{0};
+};
+
+} // namespace uorb_bridge
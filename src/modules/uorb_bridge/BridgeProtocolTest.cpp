@@ -0,0 +1,195 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include "BridgeProtocol.hpp"
+
+using namespace uorb_bridge;
+
+TEST(BridgeProtocolTest, DeltaRoundtripSparseChange)
+{
+	uint8_t reference[128];
+	uint8_t current[128];
+
+	for (size_t i = 0; i < sizeof(reference); i++) {
+		reference[i] = (uint8_t)(i * 7);
+	}
+
+	memcpy(current, reference, sizeof(reference));
+	current[3] = 0xAA;
+	current[4] = 0xBB;
+	current[100] = 0xCC;
+
+	uint8_t delta[128];
+	const int delta_len = delta_encode(reference, current, sizeof(current), delta, sizeof(delta));
+
+	ASSERT_GT(delta_len, 0);
+	EXPECT_LT((size_t)delta_len, sizeof(current));
+
+	uint8_t state[128];
+	memcpy(state, reference, sizeof(reference));
+
+	ASSERT_EQ(delta_apply(state, sizeof(state), delta, delta_len), 0);
+	EXPECT_EQ(memcmp(state, current, sizeof(current)), 0);
+}
+
+TEST(BridgeProtocolTest, DeltaRoundtripIdentical)
+{
+	uint8_t reference[64] {};
+	uint8_t delta[64];
+
+	const int delta_len = delta_encode(reference, reference, sizeof(reference), delta, sizeof(delta));
+	ASSERT_GE(delta_len, 0);
+
+	uint8_t state[64] {};
+	ASSERT_EQ(delta_apply(state, sizeof(state), delta, delta_len), 0);
+	EXPECT_EQ(memcmp(state, reference, sizeof(state)), 0);
+}
+
+TEST(BridgeProtocolTest, DeltaRejectsFullChange)
+{
+	uint8_t reference[64];
+	uint8_t current[64];
+
+	for (size_t i = 0; i < sizeof(reference); i++) {
+		reference[i] = (uint8_t)i;
+		current[i] = (uint8_t)(i + 1);
+	}
+
+	// every byte differs, a delta cannot be smaller than the full struct
+	uint8_t delta[128];
+	EXPECT_EQ(delta_encode(reference, current, sizeof(current), delta, sizeof(delta)), -1);
+}
+
+TEST(BridgeProtocolTest, DeltaRoundtripLongRuns)
+{
+	// runs longer than 255 bytes must be split across skip/copy pairs
+	uint8_t reference[400] {};
+	uint8_t current[400] {};
+	current[399] = 1;
+
+	uint8_t delta[400];
+	const int delta_len = delta_encode(reference, current, sizeof(current), delta, sizeof(delta));
+	ASSERT_GT(delta_len, 0);
+
+	uint8_t state[400] {};
+	ASSERT_EQ(delta_apply(state, sizeof(state), delta, delta_len), 0);
+	EXPECT_EQ(memcmp(state, current, sizeof(current)), 0);
+}
+
+TEST(BridgeProtocolTest, DeltaApplyRejectsMalformed)
+{
+	uint8_t state[16] {};
+
+	// copy run past the end of the state
+	const uint8_t bad_delta[] = {10, 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	EXPECT_EQ(delta_apply(state, sizeof(state), bad_delta, sizeof(bad_delta)), -1);
+
+	// truncated: copy count larger than the remaining delta bytes
+	const uint8_t truncated[] = {0, 5, 1, 2};
+	EXPECT_EQ(delta_apply(state, sizeof(state), truncated, sizeof(truncated)), -1);
+}
+
+TEST(BridgeProtocolTest, FrameRoundtrip)
+{
+	const uint8_t payload[] = {1, 2, 3, 4, 5};
+
+	uint8_t frame[MAX_FRAME_SIZE];
+	const int frame_len = frame_pack(FrameType::DATA, 42, 7, payload, sizeof(payload), frame, sizeof(frame));
+	ASSERT_EQ(frame_len, (int)(FRAME_HEADER_SIZE + sizeof(payload) + FRAME_CRC_SIZE));
+
+	FrameParser parser;
+	bool complete = false;
+
+	for (int i = 0; i < frame_len; i++) {
+		complete = parser.parse(frame[i]);
+	}
+
+	ASSERT_TRUE(complete);
+	EXPECT_EQ(parser.header().type, (uint8_t)FrameType::DATA);
+	EXPECT_EQ(parser.header().topic_id, 42);
+	EXPECT_EQ(parser.header().seq, 7);
+	ASSERT_EQ(parser.header().payload_len, sizeof(payload));
+	EXPECT_EQ(memcmp(parser.payload(), payload, sizeof(payload)), 0);
+	EXPECT_EQ(parser.crc_errors(), 0u);
+}
+
+TEST(BridgeProtocolTest, ParserResynchronizesAfterGarbage)
+{
+	const uint8_t payload[] = {0xDE, 0xAD};
+
+	uint8_t frame[MAX_FRAME_SIZE];
+	const int frame_len = frame_pack(FrameType::HEARTBEAT, TOPIC_ID_NONE, 0, payload, sizeof(payload),
+					 frame, sizeof(frame));
+	ASSERT_GT(frame_len, 0);
+
+	FrameParser parser;
+
+	// noise, including a stray sync byte
+	const uint8_t garbage[] = {0x00, 0xFF, SYNC0, 0x12};
+
+	for (uint8_t byte : garbage) {
+		EXPECT_FALSE(parser.parse(byte));
+	}
+
+	bool complete = false;
+
+	for (int i = 0; i < frame_len; i++) {
+		complete = parser.parse(frame[i]);
+	}
+
+	EXPECT_TRUE(complete);
+}
+
+TEST(BridgeProtocolTest, ParserDetectsCorruption)
+{
+	const uint8_t payload[] = {9, 8, 7};
+
+	uint8_t frame[MAX_FRAME_SIZE];
+	const int frame_len = frame_pack(FrameType::DATA, 1, 0, payload, sizeof(payload), frame, sizeof(frame));
+	ASSERT_GT(frame_len, 0);
+
+	frame[FRAME_HEADER_SIZE] ^= 0xFF; // corrupt the payload
+
+	FrameParser parser;
+	bool complete = false;
+
+	for (int i = 0; i < frame_len; i++) {
+		complete = parser.parse(frame[i]);
+	}
+
+	EXPECT_FALSE(complete);
+	EXPECT_EQ(parser.crc_errors(), 1u);
+}
@@ -0,0 +1,699 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "UorbBridge.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <px4_platform_common/getopt.h>
+#include <uORB/uORBManager.hpp>
+#include <uORB/uORBTopics.h>
+
+using namespace uorb_bridge;
+
+// Topics replicated to the standby FMU. Rates are the maximum forwarded rate;
+// reliable topics are sent as acked keyframes (retransmitted on loss) since
+// they change rarely but must not be missed, everything else streams
+// delta-encoded samples where a dropped frame only costs one sample.
+const UorbBridge::ReplicationPolicy UorbBridge::_replication_set[] = {
+	{"vehicle_attitude", 50, false},
+	{"vehicle_local_position", 50, false},
+	{"vehicle_angular_velocity", 50, false},
+	{"vehicle_global_position", 10, false},
+	{"vehicle_air_data", 10, false},
+	{"estimator_sensor_bias", 5, false},
+	{"vehicle_status", 5, true},
+	{"vehicle_control_mode", 5, true},
+	{"home_position", 2, true},
+	{"mission_result", 2, true},
+};
+
+const unsigned UorbBridge::_replication_set_size = sizeof(UorbBridge::_replication_set) / sizeof(
+			UorbBridge::_replication_set[0]);
+
+UorbBridge::UorbBridge(const char *device, int baudrate, bool standby) :
+	_device(device),
+	_baudrate(baudrate),
+	_standby(standby)
+{
+}
+
+UorbBridge::~UorbBridge()
+{
+	if (uORB::Manager::get_instance()->get_uorb_communicator() == this) {
+		uORB::Manager::get_instance()->set_uorb_communicator(nullptr);
+	}
+
+	for (size_t i = 0; i < ORB_TOPICS_COUNT; i++) {
+		if (_slots[i] != nullptr) {
+			delete[] _slots[i]->keyframe;
+			delete _slots[i];
+		}
+	}
+
+	if (_fd >= 0) {
+		close(_fd);
+	}
+}
+
+const UorbBridge::ReplicationPolicy *UorbBridge::findPolicy(const char *name) const
+{
+	for (unsigned i = 0; i < _replication_set_size; i++) {
+		if (strcmp(_replication_set[i].topic, name) == 0) {
+			return &_replication_set[i];
+		}
+	}
+
+	return nullptr;
+}
+
+UorbBridge::TopicSlot *UorbBridge::ensureSlot(const orb_metadata *meta)
+{
+	if (meta == nullptr || meta->o_id >= ORB_TOPICS_COUNT) {
+		return nullptr;
+	}
+
+	TopicSlot *slot = _slots[meta->o_id];
+
+	if (slot == nullptr) {
+		slot = new TopicSlot();
+
+		if (slot == nullptr) {
+			return nullptr;
+		}
+
+		slot->meta = meta;
+		slot->keyframe = new uint8_t[meta->o_size];
+
+		if (slot->keyframe == nullptr) {
+			delete slot;
+			return nullptr;
+		}
+
+		const ReplicationPolicy *policy = findPolicy(meta->o_name);
+
+		if (policy != nullptr) {
+			slot->min_interval_us = (policy->rate_hz > 0) ? (1000000 / policy->rate_hz) : 0;
+			slot->reliable = policy->reliable;
+		}
+
+		_slots[meta->o_id] = slot;
+	}
+
+	return slot;
+}
+
+int16_t UorbBridge::enqueueFrame(FrameType type, uint8_t topic_id, uint8_t seq,
+				 const uint8_t *payload, size_t payload_len)
+{
+	uint8_t frame[MAX_FRAME_SIZE];
+	const int frame_len = frame_pack(type, topic_id, seq, payload, payload_len, frame, sizeof(frame));
+
+	if (frame_len < 0) {
+		return -1;
+	}
+
+	int16_t ret = 0;
+
+	pthread_mutex_lock(&_tx_mutex);
+
+	const size_t used = _tx_head - _tx_tail;
+
+	if (used + (size_t)frame_len > TX_BUFFER_SIZE) {
+		// drop the whole frame rather than corrupting the stream
+		_tx_overruns++;
+		ret = -1;
+
+	} else {
+		for (int i = 0; i < frame_len; i++) {
+			_tx_buffer[(_tx_head + i) % TX_BUFFER_SIZE] = frame[i];
+		}
+
+		_tx_head += frame_len;
+		_tx_frames++;
+	}
+
+	pthread_mutex_unlock(&_tx_mutex);
+
+	return ret;
+}
+
+int16_t UorbBridge::enqueueControl(FrameType type, const char *messageName, const int32_t *rate_hz)
+{
+	uint8_t payload[MAX_PAYLOAD_SIZE];
+	size_t len = 0;
+
+	if (rate_hz != nullptr) {
+		memcpy(payload, rate_hz, sizeof(int32_t));
+		len += sizeof(int32_t);
+	}
+
+	const size_t name_len = strlen(messageName);
+
+	if (len + name_len > sizeof(payload)) {
+		return -1;
+	}
+
+	memcpy(&payload[len], messageName, name_len);
+	len += name_len;
+
+	return enqueueFrame(type, TOPIC_ID_NONE, 0, payload, len);
+}
+
+int16_t UorbBridge::topic_advertised(const char *messageName)
+{
+	return enqueueControl(FrameType::ADVERTISE, messageName);
+}
+
+int16_t UorbBridge::add_subscription(const char *messageName, int32_t msgRateInHz)
+{
+	return enqueueControl(FrameType::ADD_SUBSCRIPTION, messageName, &msgRateInHz);
+}
+
+int16_t UorbBridge::remove_subscription(const char *messageName)
+{
+	return enqueueControl(FrameType::REMOVE_SUBSCRIPTION, messageName);
+}
+
+int16_t UorbBridge::register_handler(uORBCommunicator::IChannelRxHandler *handler)
+{
+	_rx_handler = handler;
+	return 0;
+}
+
+int16_t UorbBridge::send_message(const char *messageName, int32_t length, uint8_t *data)
+{
+	if (length <= 0 || (size_t)length > MAX_PAYLOAD_SIZE) {
+		return -1;
+	}
+
+	TopicSlot *slot = ensureSlot(orb_get_topic_meta(messageName));
+
+	if (slot == nullptr) {
+		return -1;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (slot->min_interval_us > 0 && now - slot->last_sent < slot->min_interval_us) {
+		_policy_drops++;
+		return 0;
+	}
+
+	slot->seq++;
+
+	// delta-encode against the last keyframe; every delta stands alone so a
+	// lost frame only costs one sample, never the stream
+	if (slot->keyframe_valid && !slot->reliable && slot->frames_since_keyframe < KEYFRAME_INTERVAL) {
+		uint8_t delta[MAX_PAYLOAD_SIZE];
+		const int delta_len = delta_encode(slot->keyframe, data, length, delta, sizeof(delta));
+
+		if (delta_len >= 0) {
+			if (enqueueFrame(FrameType::DATA_DELTA, slot->meta->o_id, slot->seq, delta, delta_len) == 0) {
+				slot->last_sent = now;
+				slot->frames_since_keyframe++;
+				_delta_frames++;
+			}
+
+			return 0;
+		}
+	}
+
+	// keyframe: full struct, new delta reference
+	if (enqueueFrame(FrameType::DATA, slot->meta->o_id, slot->seq, data, length) == 0) {
+		memcpy(slot->keyframe, data, length);
+		slot->keyframe_valid = true;
+		slot->frames_since_keyframe = 0;
+		slot->last_sent = now;
+
+		if (slot->reliable) {
+			slot->awaiting_ack = true;
+			slot->ack_deadline = now + ACK_TIMEOUT_US;
+		}
+	}
+
+	return 0;
+}
+
+hrt_abstime UorbBridge::topic_last_replicated(ORB_ID id) const
+{
+	const TopicSlot *slot = _slots[static_cast<uint8_t>(id)];
+	return (slot != nullptr) ? slot->last_received : 0;
+}
+
+void UorbBridge::handleFrame(const FrameHeader &header, const uint8_t *payload)
+{
+	const hrt_abstime now = hrt_absolute_time();
+	_rx_frames++;
+
+	switch (static_cast<FrameType>(header.type)) {
+	case FrameType::HEARTBEAT:
+		_last_heartbeat_rx = now;
+		break;
+
+	case FrameType::ADD_SUBSCRIPTION:
+	case FrameType::REMOVE_SUBSCRIPTION:
+	case FrameType::ADVERTISE: {
+			char name[64];
+			const size_t rate_len = (static_cast<FrameType>(header.type) == FrameType::ADD_SUBSCRIPTION) ?
+						sizeof(int32_t) : 0;
+
+			if (header.payload_len <= rate_len || header.payload_len - rate_len >= sizeof(name)) {
+				break;
+			}
+
+			const size_t name_len = header.payload_len - rate_len;
+			memcpy(name, &payload[rate_len], name_len);
+			name[name_len] = '\0';
+
+			if (_rx_handler == nullptr) {
+				break;
+			}
+
+			if (static_cast<FrameType>(header.type) == FrameType::ADD_SUBSCRIPTION) {
+				int32_t rate_hz = 0;
+				memcpy(&rate_hz, payload, sizeof(rate_hz));
+				_rx_handler->process_add_subscription(name, rate_hz);
+
+			} else if (static_cast<FrameType>(header.type) == FrameType::REMOVE_SUBSCRIPTION) {
+				_rx_handler->process_remove_subscription(name);
+
+			} else {
+				_rx_handler->process_remote_topic(name, true);
+			}
+		}
+		break;
+
+	case FrameType::DATA:
+	case FrameType::DATA_DELTA: {
+			TopicSlot *slot = ensureSlot(get_orb_meta(static_cast<ORB_ID>(header.topic_id)));
+
+			if (slot == nullptr || slot->meta->o_size > MAX_PAYLOAD_SIZE) {
+				break;
+			}
+
+			const uint8_t *sample = nullptr;
+			static uint8_t scratch[MAX_PAYLOAD_SIZE];
+
+			if (static_cast<FrameType>(header.type) == FrameType::DATA) {
+				if (header.payload_len != slot->meta->o_size) {
+					break;
+				}
+
+				memcpy(slot->keyframe, payload, header.payload_len);
+				slot->keyframe_valid = true;
+				sample = slot->keyframe;
+
+				if (slot->reliable) {
+					enqueueFrame(FrameType::ACK, header.topic_id, header.seq, nullptr, 0);
+				}
+
+			} else {
+				if (!slot->keyframe_valid) {
+					// delta without a keyframe reference, wait for the next keyframe
+					break;
+				}
+
+				memcpy(scratch, slot->keyframe, slot->meta->o_size);
+
+				if (delta_apply(scratch, slot->meta->o_size, payload, header.payload_len) != 0) {
+					break;
+				}
+
+				sample = scratch;
+			}
+
+			slot->last_received = now;
+
+			if (_rx_handler != nullptr) {
+				_rx_handler->process_received_message(slot->meta->o_name, slot->meta->o_size,
+								      const_cast<uint8_t *>(sample));
+			}
+		}
+		break;
+
+	case FrameType::ACK:
+		if (header.topic_id < ORB_TOPICS_COUNT) {
+			TopicSlot *slot = _slots[header.topic_id];
+
+			if (slot != nullptr && slot->seq == header.seq) {
+				slot->awaiting_ack = false;
+			}
+		}
+
+		break;
+	}
+}
+
+void UorbBridge::drainTx()
+{
+	pthread_mutex_lock(&_tx_mutex);
+
+	while (_tx_tail < _tx_head) {
+		const size_t offset = _tx_tail % TX_BUFFER_SIZE;
+		const size_t contiguous = TX_BUFFER_SIZE - offset;
+		const size_t pending = _tx_head - _tx_tail;
+		const size_t chunk = (pending < contiguous) ? pending : contiguous;
+
+		const ssize_t written = write(_fd, &_tx_buffer[offset], chunk);
+
+		if (written <= 0) {
+			break;
+		}
+
+		_tx_tail += written;
+		_tx_bytes += written;
+	}
+
+	pthread_mutex_unlock(&_tx_mutex);
+}
+
+void UorbBridge::tick(const hrt_abstime &now)
+{
+	// heartbeat and link supervision
+	if (now - _last_heartbeat_tx >= HEARTBEAT_INTERVAL_US) {
+		uint64_t stamp = now;
+		enqueueFrame(FrameType::HEARTBEAT, TOPIC_ID_NONE, 0, (const uint8_t *)&stamp, sizeof(stamp));
+		_last_heartbeat_tx = now;
+	}
+
+	const bool link_was_active = _link_active;
+	_link_active = (_last_heartbeat_rx != 0) && (now - _last_heartbeat_rx < LINK_TIMEOUT_US);
+
+	if (_link_active && !link_was_active) {
+		PX4_INFO("link to remote FMU up");
+		_subscriptions_sent = false;
+
+	} else if (!_link_active && link_was_active) {
+		PX4_WARN("link to remote FMU lost");
+	}
+
+	// the standby side drives the replication set
+	if (_standby && _link_active && !_subscriptions_sent) {
+		for (unsigned i = 0; i < _replication_set_size; i++) {
+			add_subscription(_replication_set[i].topic, _replication_set[i].rate_hz);
+		}
+
+		_subscriptions_sent = true;
+	}
+
+	// retransmit unacked keyframes of reliable topics
+	for (size_t i = 0; i < ORB_TOPICS_COUNT; i++) {
+		TopicSlot *slot = _slots[i];
+
+		if (slot != nullptr && slot->awaiting_ack && now >= slot->ack_deadline) {
+			enqueueFrame(FrameType::DATA, slot->meta->o_id, slot->seq, slot->keyframe, slot->meta->o_size);
+			slot->ack_deadline = now + ACK_TIMEOUT_US;
+		}
+	}
+
+	if (now - _last_status_pub >= 1_s) {
+		publishStatus(now);
+		_last_status_pub = now;
+	}
+}
+
+void UorbBridge::publishStatus(const hrt_abstime &now)
+{
+	fmu_bridge_status_s status{};
+
+	status.link_active = _link_active;
+	status.standby = _standby;
+
+	for (size_t i = 0; i < ORB_TOPICS_COUNT; i++) {
+		const TopicSlot *slot = _slots[i];
+
+		if (slot != nullptr && slot->last_received != 0) {
+			status.topics_replicated++;
+
+			const uint64_t age = now - slot->last_received;
+
+			if (age > status.stalest_topic_age_us) {
+				status.stalest_topic_age_us = age;
+			}
+		}
+	}
+
+	status.tx_frames = _tx_frames;
+	status.rx_frames = _rx_frames;
+	status.rx_errors = _parser.crc_errors();
+	status.tx_bytes = _tx_bytes;
+	status.rx_bytes = _rx_bytes;
+
+	status.timestamp = hrt_absolute_time();
+	_status_pub.publish(status);
+}
+
+int UorbBridge::setBaudrate(int fd, unsigned baud)
+{
+	speed_t speed;
+
+	switch (baud) {
+	case 57600: speed = B57600; break;
+
+	case 115200: speed = B115200; break;
+
+	case 230400: speed = B230400; break;
+
+#ifndef B460800
+#define B460800 460800
+#endif
+
+	case 460800: speed = B460800; break;
+
+#ifndef B921600
+#define B921600 921600
+#endif
+
+	case 921600: speed = B921600; break;
+
+	default:
+		PX4_ERR("unsupported baudrate: %u", baud);
+		return -EINVAL;
+	}
+
+	struct termios uart_config;
+
+	if (tcgetattr(fd, &uart_config) != 0) {
+		return -errno;
+	}
+
+	// raw 8N1, no flow control
+	uart_config.c_iflag &= ~(IGNBRK | BRKINT | ICRNL | INLCR | PARMRK | INPCK | ISTRIP | IXON);
+	uart_config.c_oflag = 0;
+	uart_config.c_lflag &= ~(ECHO | ECHONL | ICANON | IEXTEN | ISIG);
+	uart_config.c_cflag &= ~(CSIZE | PARENB);
+	uart_config.c_cflag |= CS8;
+
+	if (cfsetispeed(&uart_config, speed) != 0 || cfsetospeed(&uart_config, speed) != 0) {
+		return -errno;
+	}
+
+	if (tcsetattr(fd, TCSANOW, &uart_config) != 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+void UorbBridge::run()
+{
+	_fd = open(_device, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+	if (_fd < 0) {
+		PX4_ERR("open %s failed (%i)", _device, errno);
+		return;
+	}
+
+	if (setBaudrate(_fd, _baudrate) != 0) {
+		close(_fd);
+		_fd = -1;
+		return;
+	}
+
+	// route remote subscriptions and received samples through this channel
+	uORB::Manager::get_instance()->set_uorb_communicator(this);
+
+	while (!should_exit()) {
+		pollfd fds{};
+		fds.fd = _fd;
+		fds.events = POLLIN;
+
+		if (poll(&fds, 1, 20) > 0 && (fds.revents & POLLIN)) {
+			uint8_t buffer[256];
+			const ssize_t nread = read(_fd, buffer, sizeof(buffer));
+
+			for (ssize_t i = 0; i < nread; i++) {
+				if (_parser.parse(buffer[i])) {
+					handleFrame(_parser.header(), _parser.payload());
+				}
+			}
+
+			if (nread > 0) {
+				_rx_bytes += nread;
+			}
+		}
+
+		tick(hrt_absolute_time());
+		drainTx();
+	}
+}
+
+int UorbBridge::print_status()
+{
+	PX4_INFO("Running in %s role on %s, link %s", _standby ? "standby" : "active", _device,
+		 _link_active ? "up" : "down");
+	PX4_INFO("TX: %" PRIu32 " frames (%" PRIu32 " delta), %" PRIu32 " B, %" PRIu32 " overruns, %" PRIu32 " policy drops",
+		 _tx_frames, _delta_frames, _tx_bytes, _tx_overruns, _policy_drops);
+	PX4_INFO("RX: %" PRIu32 " frames, %" PRIu32 " B, %" PRIu32 " CRC errors", _rx_frames, _rx_bytes,
+		 _parser.crc_errors());
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	for (size_t i = 0; i < ORB_TOPICS_COUNT; i++) {
+		const TopicSlot *slot = _slots[i];
+
+		if (slot != nullptr && slot->last_received != 0) {
+			PX4_INFO("  %s: age %.3f s", slot->meta->o_name, (now - slot->last_received) * 1e-6);
+		}
+	}
+
+	return 0;
+}
+
+UorbBridge *UorbBridge::instantiate(int argc, char *argv[])
+{
+	bool error_flag = false;
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	const char *device = nullptr;
+	int baudrate = 921600;
+	bool standby = false;
+
+	while ((ch = px4_getopt(argc, argv, "d:b:s", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'd':
+			device = myoptarg;
+			break;
+
+		case 'b':
+			baudrate = strtol(myoptarg, nullptr, 0);
+			break;
+
+		case 's':
+			standby = true;
+			break;
+
+		case '?':
+			error_flag = true;
+			break;
+
+		default:
+			PX4_WARN("unrecognized flag");
+			error_flag = true;
+			break;
+		}
+	}
+
+	if (device == nullptr) {
+		PX4_ERR("Missing device");
+		error_flag = true;
+	}
+
+	if (error_flag) {
+		return nullptr;
+	}
+
+	return new UorbBridge(device, baudrate, standby);
+}
+
+int UorbBridge::task_spawn(int argc, char *argv[])
+{
+	_task_id = px4_task_spawn_cmd("uorb_bridge",
+				      SCHED_DEFAULT,
+				      SCHED_PRIORITY_DEFAULT,
+				      PX4_STACK_ADJUSTED(4000),
+				      (px4_main_t)&run_trampoline,
+				      (char *const *)argv);
+
+	if (_task_id < 0) {
+		_task_id = -1;
+		return -errno;
+	}
+
+	return 0;
+}
+
+int UorbBridge::custom_command(int argc, char *argv[])
+{
+	return print_usage("unknown command");
+}
+
+int UorbBridge::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+uORB replication bridge between redundant flight computers.
+
+Forwards a fixed set of topics to the standby FMU over a serial link using
+the uORB communicator channel, delta-encoded against the last keyframe.
+The standby side (started with -s) subscribes to the replication set and
+publishes received samples locally, so its estimator stays warm for a
+takeover. Per-topic freshness is published on fmu_bridge_status.
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("uorb_bridge", "system");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_PARAM_STRING('d', nullptr, "<file:dev>", "Serial device", false);
+	PRINT_MODULE_USAGE_PARAM_INT('b', 921600, 57600, 3000000, "Baudrate", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('s', "Standby role (subscribe to the replication set)", true);
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+int uorb_bridge_main(int argc, char *argv[])
+{
+	return UorbBridge::main(argc, argv);
+}
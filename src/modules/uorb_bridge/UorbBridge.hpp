@@ -0,0 +1,189 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2023 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file UorbBridge.hpp
+ *
+ * Inter-FMU uORB replication bridge for redundant flight computer setups.
+ *
+ * Implements uORBCommunicator::IChannel (the same extension point used by
+ * muorb) over a serial link. The active FMU forwards publications of the
+ * replicated topic set, delta-encoded against the last keyframe; the standby
+ * FMU injects them into its local uORB graph through the Manager's
+ * IChannelRxHandler and keeps per-topic freshness so a takeover can start
+ * with a warm estimator.
+ */
+
+#pragma once
+
+#include <pthread.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/module.h>
+#include <uORB/Publication.hpp>
+#include <uORB/topics/fmu_bridge_status.h>
+#include <uORB/topics/uORBTopics.hpp>
+#include <uORB/uORBCommunicator.hpp>
+
+#include "BridgeProtocol.hpp"
+
+using namespace time_literals;
+
+extern "C" __EXPORT int uorb_bridge_main(int argc, char *argv[]);
+
+class UorbBridge : public ModuleBase<UorbBridge>, public uORBCommunicator::IChannel
+{
+public:
+	UorbBridge(const char *device, int baudrate, bool standby);
+	~UorbBridge() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static UorbBridge *instantiate(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	/** @see ModuleBase::run() */
+	void run() override;
+
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
+	// uORBCommunicator::IChannel
+	int16_t topic_advertised(const char *messageName) override;
+	int16_t add_subscription(const char *messageName, int32_t msgRateInHz) override;
+	int16_t remove_subscription(const char *messageName) override;
+	int16_t register_handler(uORBCommunicator::IChannelRxHandler *handler) override;
+	int16_t send_message(const char *messageName, int32_t length, uint8_t *data) override;
+
+	/**
+	 * Standby-side freshness: time of the last replicated sample of a topic,
+	 * 0 if the topic has never been received over the bridge.
+	 */
+	hrt_abstime topic_last_replicated(ORB_ID id) const;
+
+	bool link_active() const { return _link_active; }
+
+private:
+	/**
+	 * Per-topic replication policy, applied on the sending side.
+	 */
+	struct ReplicationPolicy {
+		const char *topic;
+		int32_t rate_hz;
+		bool reliable;	///< keyframe every sample, acked and retransmitted
+	};
+
+	static const ReplicationPolicy _replication_set[];
+	static const unsigned _replication_set_size;
+
+	/**
+	 * Per-topic link state, lazily allocated on first use, indexed by ORB_ID.
+	 */
+	struct TopicSlot {
+		const orb_metadata *meta{nullptr};
+		uint8_t *keyframe{nullptr};	///< last keyframe sent (tx) or received (rx)
+		hrt_abstime last_sent{0};
+		hrt_abstime last_received{0};
+		hrt_abstime ack_deadline{0};	///< retransmit keyframe if not acked by then
+		uint32_t min_interval_us{0};
+		uint8_t seq{0};
+		uint8_t frames_since_keyframe{0};
+		bool keyframe_valid{false};
+		bool reliable{false};
+		bool awaiting_ack{false};
+	};
+
+	static constexpr uint8_t KEYFRAME_INTERVAL = 32;	///< force a keyframe every N frames
+	static constexpr hrt_abstime ACK_TIMEOUT_US = 100_ms;
+	static constexpr hrt_abstime HEARTBEAT_INTERVAL_US = 1_s;
+	static constexpr hrt_abstime LINK_TIMEOUT_US = 3_s;
+
+	int setBaudrate(int fd, unsigned baud);
+
+	TopicSlot *ensureSlot(const orb_metadata *meta);
+	const ReplicationPolicy *findPolicy(const char *name) const;
+
+	/** pack a frame and append it to the TX ring (thread safe) */
+	int16_t enqueueFrame(uorb_bridge::FrameType type, uint8_t topic_id, uint8_t seq,
+			     const uint8_t *payload, size_t payload_len);
+
+	/** control frame whose payload is the topic name (plus optional rate prefix) */
+	int16_t enqueueControl(uorb_bridge::FrameType type, const char *messageName, const int32_t *rate_hz = nullptr);
+
+	void handleFrame(const uorb_bridge::FrameHeader &header, const uint8_t *payload);
+	void drainTx();
+	void tick(const hrt_abstime &now);
+	void publishStatus(const hrt_abstime &now);
+
+	const char *_device;
+	const int _baudrate;
+	const bool _standby;
+
+	int _fd{-1};
+
+	uORBCommunicator::IChannelRxHandler *_rx_handler{nullptr};
+
+	TopicSlot *_slots[ORB_TOPICS_COUNT] {};
+
+	// TX byte ring, filled from publisher threads, drained by the bridge task
+	static constexpr size_t TX_BUFFER_SIZE = 4096;
+	uint8_t _tx_buffer[TX_BUFFER_SIZE];
+	size_t _tx_head{0};	///< next write position
+	size_t _tx_tail{0};	///< next read position
+	pthread_mutex_t _tx_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	uorb_bridge::FrameParser _parser{};
+
+	bool _link_active{false};
+	bool _subscriptions_sent{false};
+	hrt_abstime _last_heartbeat_rx{0};
+	hrt_abstime _last_heartbeat_tx{0};
+	hrt_abstime _last_status_pub{0};
+
+	uint32_t _tx_frames{0};
+	uint32_t _rx_frames{0};
+	uint32_t _tx_bytes{0};
+	uint32_t _rx_bytes{0};
+	uint32_t _tx_overruns{0};
+	uint32_t _policy_drops{0};
+	uint32_t _delta_frames{0};
+
+	uORB::Publication<fmu_bridge_status_s> _status_pub{ORB_ID(fmu_bridge_status)};
+};
@@ -155,7 +155,7 @@ void UUVAttitudeControl::control_attitude_geo(const vehicle_attitude_s &attitude
 	 * D. Mellinger, V. Kumar, "Minimum Snap Trajectory Generation and Control for Quadrotors", IEEE ICRA 2011, pp. 2520-2525.
 	 * D. A. Duecker, A. Hackbarth, T. Johannink, E. Kreuzer, and E. Solowjow, “Micro Underwater Vehicle Hydrobatics: A SubmergedFuruta Pendulum,” IEEE ICRA 2018, pp. 7498–7503.
 	 */
-	Eulerf euler_angles(matrix::Quatf(attitude.q));
+	Eulerf euler_angles(_q_att);
 
 	float roll_u;
 	float pitch_u;
@@ -175,9 +175,8 @@ void UUVAttitudeControl::control_attitude_geo(const vehicle_attitude_s &attitude
 	/* get attitude setpoint rotational matrix */
 	Dcmf rot_des = Eulerf(roll_body, pitch_body, yaw_body);
 
-	/* get current rotation matrix from control state quaternions */
-	Quatf q_att(attitude.q);
-	Matrix3f rot_att =  matrix::Dcm<float>(q_att);
+	/* current rotation matrix from the per-cycle transform cache */
+	const Matrix3f &rot_att = _rot_att;
 
 	Vector3f e_R_vec;
 	Vector3f torques;
@@ -219,6 +218,75 @@ void UUVAttitudeControl::control_attitude_geo(const vehicle_attitude_s &attitude
 	/* Geometric Controller END*/
 }
 
+void UUVAttitudeControl::update_attitude_setpoint(const float thrust_x, const float thrust_y, const float thrust_z,
+		const float roll_des, const float pitch_des, const float yaw_des)
+{
+	_attitude_setpoint.timestamp = hrt_absolute_time();
+
+	_attitude_setpoint.roll_body = roll_des;
+	_attitude_setpoint.pitch_body = pitch_des;
+	_attitude_setpoint.yaw_body = yaw_des;
+
+	_attitude_setpoint.thrust_body[0] = thrust_x;
+	_attitude_setpoint.thrust_body[1] = thrust_y;
+	_attitude_setpoint.thrust_body[2] = thrust_z;
+
+	/* consumed in-process by the attitude stage, published for logging only */
+	_att_sp_pub.publish(_attitude_setpoint);
+}
+
+void UUVAttitudeControl::pose_controller_6dof(const Vector3f &pos_des,
+		const float roll_des, const float pitch_des, const float yaw_des,
+		const vehicle_local_position_s &vlocal_pos)
+{
+	Vector3f p_control_output = Vector3f(_param_pose_gain_x.get() * (pos_des(0) - vlocal_pos.x) - _param_pose_gain_d_x.get()
+					     * vlocal_pos.vx,
+					     _param_pose_gain_y.get() * (pos_des(1) - vlocal_pos.y) - _param_pose_gain_d_y.get() * vlocal_pos.vy,
+					     _param_pose_gain_z.get() * (pos_des(2) - vlocal_pos.z) - _param_pose_gain_d_z.get() * vlocal_pos.vz);
+
+	//rotate the coord.sys (from global to body) with the cached attitude transform
+	Vector3f rotated_input = _rot_att.transpose() * p_control_output;
+
+	update_attitude_setpoint(rotated_input(0),
+				 rotated_input(1),
+				 rotated_input(2),
+				 roll_des, pitch_des, yaw_des);
+}
+
+void UUVAttitudeControl::stabilization_controller_6dof(const Vector3f &pos_des,
+		const float roll_des, const float pitch_des, const float yaw_des,
+		const vehicle_local_position_s &vlocal_pos)
+{
+	Vector3f p_control_output = Vector3f(0,
+					     0,
+					     _param_pose_gain_z.get() * (pos_des(2) - vlocal_pos.z));
+	//potential d controller missing
+	//rotate the coord.sys (from global to body) with the cached attitude transform
+	Vector3f rotated_input = _rot_att.transpose() * p_control_output;
+
+	update_attitude_setpoint(rotated_input(0) + pos_des(0), rotated_input(1) + pos_des(1), rotated_input(2),
+				 roll_des, pitch_des, yaw_des);
+}
+
+void UUVAttitudeControl::control_position(const vehicle_local_position_s &vlocal_pos)
+{
+	_trajectory_setpoint_sub.update(&_trajectory_setpoint);
+
+	float roll_des = 0;
+	float pitch_des = 0;
+	float yaw_des = _trajectory_setpoint.yaw;
+
+	//stabilization controller(keep pos and hold depth + angle) vs position controller(global + yaw)
+	if (_param_stabilization.get() == 0) {
+		pose_controller_6dof(Vector3f(_trajectory_setpoint.position),
+				     roll_des, pitch_des, yaw_des, vlocal_pos);
+
+	} else {
+		stabilization_controller_6dof(Vector3f(_trajectory_setpoint.position),
+					      roll_des, pitch_des, yaw_des, vlocal_pos);
+	}
+}
+
 void UUVAttitudeControl::Run()
 {
 	if (should_exit()) {
@@ -242,6 +310,11 @@ void UUVAttitudeControl::Run()
 		vehicle_angular_velocity_s angular_velocity {};
 		_angular_velocity_sub.copy(&angular_velocity);
 
+		/* update the transform cache once per attitude sample, shared by the
+		 * position and attitude stages below */
+		_q_att = Quatf(attitude.q);
+		_rot_att = matrix::Dcm<float>(_q_att);
+
 		/* Run geometric attitude controllers if NOT manual mode*/
 		if (!_vcontrol_mode.flag_control_manual_enabled
 		    && _vcontrol_mode.flag_control_attitude_enabled
@@ -249,7 +322,16 @@ void UUVAttitudeControl::Run()
 
 			int input_mode = _param_input_mode.get();
 
-			_vehicle_attitude_setpoint_sub.update(&_attitude_setpoint);
+			/* 6-DOF position stage: generates the attitude setpoint in-process,
+			 * replacing the former uuv_pos_control module and its uORB hop */
+			if (_vcontrol_mode.flag_control_position_enabled
+			    && _vehicle_local_position_sub.update(&_vlocal_pos)) {
+				control_position(_vlocal_pos);
+
+			} else {
+				_vehicle_attitude_setpoint_sub.update(&_attitude_setpoint);
+			}
+
 			_vehicle_rates_setpoint_sub.update(&_rates_setpoint);
 
 			if (input_mode == 1) { // process manual data
@@ -63,8 +63,10 @@
 #include <uORB/Publication.hpp>
 #include <uORB/topics/manual_control_setpoint.h>
 #include <uORB/topics/parameter_update.h>
+#include <uORB/topics/trajectory_setpoint.h>
 #include <uORB/topics/vehicle_attitude.h>
 #include <uORB/topics/vehicle_attitude_setpoint.h>
+#include <uORB/topics/vehicle_local_position.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
 #include <uORB/topics/vehicle_rates_setpoint.h>
 #include <uORB/topics/vehicle_control_mode.h>
@@ -104,6 +106,7 @@ private:
 	void publishThrustSetpoint(const hrt_abstime &timestamp_sample);
 
 	uORB::Publication<actuator_controls_s> _actuator_controls_pub{ORB_ID(actuator_controls_0)};
+	uORB::Publication<vehicle_attitude_setpoint_s>	_att_sp_pub{ORB_ID(vehicle_attitude_setpoint)};
 	uORB::Publication<vehicle_thrust_setpoint_s>	_vehicle_thrust_setpoint_pub{ORB_ID(vehicle_thrust_setpoint)};
 	uORB::Publication<vehicle_torque_setpoint_s>	_vehicle_torque_setpoint_pub{ORB_ID(vehicle_torque_setpoint)};
 
@@ -114,15 +117,24 @@ private:
 	uORB::Subscription _angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};	/**< vehicle angular velocity subscription */
 	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};	/**< notification of manual control updates */
 	uORB::Subscription _vcontrol_mode_sub{ORB_ID(vehicle_control_mode)};		/**< vehicle status subscription */
+	uORB::Subscription _trajectory_setpoint_sub{ORB_ID(trajectory_setpoint)};	/**< trajectory setpoint for the position stage */
+	uORB::Subscription _vehicle_local_position_sub{ORB_ID(vehicle_local_position)};	/**< local position for the position stage */
 
 	uORB::SubscriptionCallbackWorkItem _vehicle_attitude_sub{this, ORB_ID(vehicle_attitude)};
 
 	actuator_controls_s _actuators{};
 	manual_control_setpoint_s _manual_control_setpoint{};
+	trajectory_setpoint_s _trajectory_setpoint{};
 	vehicle_attitude_setpoint_s _attitude_setpoint{};
+	vehicle_local_position_s _vlocal_pos{};
 	vehicle_rates_setpoint_s _rates_setpoint{};
 	vehicle_control_mode_s _vcontrol_mode{};
 
+	/* transforms computed once from the attitude sample and shared between
+	 * the position and attitude stages of the cycle */
+	Quatf _q_att;
+	Matrix3f _rot_att;
+
 	perf_counter_t	_loop_perf;
 
 	DEFINE_PARAMETERS(
@@ -139,7 +151,15 @@ private:
 		(ParamFloat<px4::params::UUV_DIRCT_ROLL>) _param_direct_roll,
 		(ParamFloat<px4::params::UUV_DIRCT_PITCH>) _param_direct_pitch,
 		(ParamFloat<px4::params::UUV_DIRCT_YAW>) _param_direct_yaw,
-		(ParamFloat<px4::params::UUV_DIRCT_THRUST>) _param_direct_thrust
+		(ParamFloat<px4::params::UUV_DIRCT_THRUST>) _param_direct_thrust,
+		// position stage
+		(ParamFloat<px4::params::UUV_GAIN_X_P>) _param_pose_gain_x,
+		(ParamFloat<px4::params::UUV_GAIN_Y_P>) _param_pose_gain_y,
+		(ParamFloat<px4::params::UUV_GAIN_Z_P>) _param_pose_gain_z,
+		(ParamFloat<px4::params::UUV_GAIN_X_D>) _param_pose_gain_d_x,
+		(ParamFloat<px4::params::UUV_GAIN_Y_D>) _param_pose_gain_d_y,
+		(ParamFloat<px4::params::UUV_GAIN_Z_D>) _param_pose_gain_d_z,
+		(ParamInt<px4::params::UUV_STAB_MODE>) _param_stabilization
 	)
 
 	void Run() override;
@@ -148,6 +168,22 @@ private:
 	 */
 	void parameters_update(bool force = false);
 
+	/**
+	 * Control Position
+	 *
+	 * 6-DOF position stage running in-process ahead of the attitude stage,
+	 * writing its result directly into _attitude_setpoint.
+	 */
+	void control_position(const vehicle_local_position_s &vlocal_pos);
+	void update_attitude_setpoint(const float thrust_x, const float thrust_y, const float thrust_z,
+				      const float roll_des, const float pitch_des, const float yaw_des);
+	void pose_controller_6dof(const Vector3f &pos_des,
+				  const float roll_des, const float pitch_des, const float yaw_des,
+				  const vehicle_local_position_s &vlocal_pos);
+	void stabilization_controller_6dof(const Vector3f &pos_des,
+					   const float roll_des, const float pitch_des, const float yaw_des,
+					   const vehicle_local_position_s &vlocal_pos);
+
 	/**
 	 * Control Attitude
 	 */
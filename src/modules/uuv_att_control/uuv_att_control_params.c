@@ -148,3 +148,54 @@ PARAM_DEFINE_FLOAT(UUV_DIRCT_YAW, 0.0f);
  * @group UUV Attitude Control
  */
 PARAM_DEFINE_FLOAT(UUV_DIRCT_THRUST, 0.0f);
+
+/*
+ * Position stage parameters (formerly uuv_pos_control)
+ *
+ */
+/**
+ * Gain of P controller X
+ *
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_FLOAT(UUV_GAIN_X_P, 1.0f);
+/**
+ * Gain of P controller Y
+ *
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_FLOAT(UUV_GAIN_Y_P, 1.0f);
+/**
+ * Gain of P controller Z
+ *
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_FLOAT(UUV_GAIN_Z_P, 1.0f);
+
+/**
+ * Gain of D controller X
+ *
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_FLOAT(UUV_GAIN_X_D, 0.2f);
+/**
+ * Gain of D controller Y
+ *
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_FLOAT(UUV_GAIN_Y_D, 0.2f);
+/**
+ * Gain of D controller Z
+ *
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_FLOAT(UUV_GAIN_Z_D, 0.2f);
+
+/**
+ * Stabilization mode(1) or Position Control(0)
+ *
+ * @value 0 Position Control
+ * @value 1 Stabilization Mode
+ * @group UUV Position Control
+ */
+PARAM_DEFINE_INT32(UUV_STAB_MODE, 1);
@@ -79,7 +79,8 @@ private:
 
 	float _pusher_throttle{0.0f};
 	float _reverse_output{0.0f};
-	float _airspeed_trans_blend_margin{0.0f};
+	float _airspeed_trans_blend_margin{0.0f};	// precomputed on parameter update
+	float _pusher_ramp_slope{0.0f};			// pusher throttle ramp slope [1/s], precomputed on parameter update
 
 	void parameters_update() override;
 
@@ -67,6 +67,15 @@ void
 Tiltrotor::parameters_update()
 {
 	VtolType::updateParams();
+
+	// precompute the transition ramp slopes such that the per-cycle transition
+	// code only needs multiply-adds (transitions are the worst time for overruns)
+	_front_trans_p1_tilt_slope = fabsf(_param_vt_tilt_trans.get() - _param_vt_tilt_mc.get()) /
+				     math::max(_param_vt_f_trans_dur.get(), FLT_EPSILON);
+	_front_trans_p2_tilt_slope = fabsf(_param_vt_tilt_fw.get() - _param_vt_tilt_trans.get()) /
+				     math::max(_param_vt_trans_p2_dur.get(), FLT_EPSILON);
+	_airspeed_blend_weight_slope = 1.0f / math::max(_param_vt_arsp_trans.get() - _param_vt_arsp_blend.get(),
+				       FLT_EPSILON);
 }
 
 void Tiltrotor::update_vtol_state()
@@ -311,9 +320,7 @@ void Tiltrotor::update_transition_state()
 
 		// tilt rotors forward up to certain angle
 		if (_tilt_control <= _param_vt_tilt_trans.get()) {
-			const float ramped_up_tilt = _param_vt_tilt_mc.get() +
-						     fabsf(_param_vt_tilt_trans.get() - _param_vt_tilt_mc.get()) *
-						     time_since_trans_start / _param_vt_f_trans_dur.get() ;
+			const float ramped_up_tilt = _param_vt_tilt_mc.get() + _front_trans_p1_tilt_slope * time_since_trans_start;
 
 			// only allow increasing tilt (tilt in hover can already be non-zero)
 			_tilt_control = math::max(_tilt_control, ramped_up_tilt);
@@ -325,8 +332,8 @@ void Tiltrotor::update_transition_state()
 
 		if (!_param_fw_arsp_mode.get()  && PX4_ISFINITE(_airspeed_validated->calibrated_airspeed_m_s) &&
 		    _airspeed_validated->calibrated_airspeed_m_s >= _param_vt_arsp_blend.get()) {
-			const float weight = 1.0f - (_airspeed_validated->calibrated_airspeed_m_s - _param_vt_arsp_blend.get()) /
-					     (_param_vt_arsp_trans.get()  - _param_vt_arsp_blend.get());
+			const float weight = 1.0f - (_airspeed_validated->calibrated_airspeed_m_s - _param_vt_arsp_blend.get()) *
+					     _airspeed_blend_weight_slope;
 			_mc_roll_weight = weight;
 			_mc_yaw_weight = weight;
 		}
@@ -348,9 +355,8 @@ void Tiltrotor::update_transition_state()
 
 	} else if (_vtol_schedule.flight_mode == vtol_mode::TRANSITION_FRONT_P2) {
 		// the plane is ready to go into fixed wing mode, tilt the rotors forward completely
-		_tilt_control = math::constrain(_param_vt_tilt_trans.get() +
-						fabsf(_param_vt_tilt_fw.get() - _param_vt_tilt_trans.get()) * time_since_trans_start /
-						_param_vt_trans_p2_dur.get(), _param_vt_tilt_trans.get(), _param_vt_tilt_fw.get());
+		_tilt_control = math::constrain(_param_vt_tilt_trans.get() + _front_trans_p2_tilt_slope * time_since_trans_start,
+						_param_vt_tilt_trans.get(), _param_vt_tilt_fw.get());
 
 		_mc_roll_weight = 0.0f;
 		_mc_yaw_weight = 0.0f;
@@ -83,6 +83,12 @@ private:
 
 	float _tilt_control{0.0f};		/**< actuator value for the tilt servo */
 
+	// transition ramp slopes, precomputed on parameter update so the per-cycle
+	// transition code reduces to multiply-adds
+	float _front_trans_p1_tilt_slope{0.0f};		/**< tilt ramp slope during front transition phase 1 [1/s] */
+	float _front_trans_p2_tilt_slope{0.0f};		/**< tilt ramp slope during front transition phase 2 [1/s] */
+	float _airspeed_blend_weight_slope{0.0f};	/**< mc weight reduction per unit airspeed above blend speed [s/m] */
+
 	void parameters_update() override;
 	float timeUntilMotorsAreUp();
 	float moveLinear(float start, float stop, float progress);
@@ -433,8 +433,15 @@ float VtolType::getFrontTransitionTimeFactor() const
 	const float rho = math::constrain(_attc->getAirDensity(), 0.7f, 1.5f);
 
 	if (PX4_ISFINITE(rho)) {
-		float rho0_over_rho = CONSTANTS_AIR_DENSITY_SEA_LEVEL_15C / rho;
-		return sqrtf(rho0_over_rho) * rho0_over_rho;
+		// the factor is queried several times per cycle during transitions, only
+		// re-evaluate the sqrtf when the (slowly changing) density input moves
+		if (fabsf(rho - _front_transition_time_factor_rho) > FLT_EPSILON) {
+			const float rho0_over_rho = CONSTANTS_AIR_DENSITY_SEA_LEVEL_15C / rho;
+			_front_transition_time_factor = sqrtf(rho0_over_rho) * rho0_over_rho;
+			_front_transition_time_factor_rho = rho;
+		}
+
+		return _front_transition_time_factor;
 	}
 
 	return 1.0f;
@@ -269,6 +269,11 @@ private:
 	*/
 	float getFrontTransitionTimeFactor() const;
 
+	// cache for getFrontTransitionTimeFactor(): air density changes slowly, so the
+	// sqrtf only needs to be re-evaluated when the density input actually moves
+	mutable float _front_transition_time_factor{1.f};
+	mutable float _front_transition_time_factor_rho{0.f};
+
 };
 
 #endif
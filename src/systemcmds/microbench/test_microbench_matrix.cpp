@@ -48,6 +48,7 @@
 #include <px4_platform_common/micro_hal.h>
 
 #include <matrix/math.hpp>
+#include <mathlib/math/Kernels.hpp>
 
 namespace MicroBenchMatrix
 {
@@ -99,6 +100,7 @@ private:
 	bool time_matrix_quaternion();
 	bool time_matrix_dcm();
 	bool time_matrix_pseduo_inverse();
+	bool time_math_kernels();
 
 	void reset();
 
@@ -108,6 +110,18 @@ private:
 	matrix::Matrix<float, 16, 6> A16;
 	matrix::Matrix<float, 6, 16> B16;
 	matrix::Matrix<float, 6, 16> B16_4;
+
+	matrix::Vector3f v_error;
+	matrix::Vector3f v_integral;
+	matrix::Vector3f v_derivative;
+	matrix::Vector3f v_setpoint;
+	matrix::Vector3f v_gain_p;
+	matrix::Vector3f v_gain_d;
+	matrix::Vector3f v_gain_ff;
+	matrix::Vector3f v_out;
+	matrix::Vector3f v_lp_state;
+	float f_angle;
+	float f_out;
 };
 
 bool MicroBenchMatrix::run_tests()
@@ -116,6 +130,7 @@ bool MicroBenchMatrix::run_tests()
 	ut_run_test(time_matrix_quaternion);
 	ut_run_test(time_matrix_dcm);
 	ut_run_test(time_matrix_pseduo_inverse);
+	ut_run_test(time_math_kernels);
 
 	return (_tests_failed == 0);
 }
@@ -145,6 +160,19 @@ void MicroBenchMatrix::reset()
 			B16_4(j, i) = random(-10.0, 10.0);
 		}
 	}
+
+	for (size_t i = 0; i < 3; i++) {
+		v_error(i) = random(-2.0f, 2.0f);
+		v_integral(i) = random(-0.5f, 0.5f);
+		v_derivative(i) = random(-5.0f, 5.0f);
+		v_setpoint(i) = random(-2.0f, 2.0f);
+		v_gain_p(i) = random(0.0f, 1.0f);
+		v_gain_d(i) = random(0.0f, 0.01f);
+		v_gain_ff(i) = random(0.0f, 0.5f);
+		v_lp_state(i) = random(-1.0f, 1.0f);
+	}
+
+	f_angle = random(-2.0f * float(M_PI), 2.0f * float(M_PI));
 }
 
 bool MicroBenchMatrix::time_matrix_euler()
@@ -175,6 +203,19 @@ bool MicroBenchMatrix::time_matrix_pseduo_inverse()
 	return true;
 }
 
+bool MicroBenchMatrix::time_math_kernels()
+{
+	// each kernel against the equivalent generic matrix-lib formulation
+	PERF("kernel pid3", v_out = math::kernels::pid3(v_error, v_integral, v_derivative, v_setpoint, v_gain_p, v_gain_d,
+			v_gain_ff), 100);
+	PERF("matrix emult pid expression", v_out = v_gain_p.emult(v_error) + v_integral - v_gain_d.emult(
+			v_derivative) + v_gain_ff.emult(v_setpoint), 100);
+	PERF("kernel lowpass3", math::kernels::lowpass3(v_lp_state, v_error, 0.1f), 100);
+	PERF("kernel wrap_pi_fast", f_out = math::kernels::wrap_pi_fast(f_angle), 100);
+	PERF("matrix wrap_pi", f_out = matrix::wrap_pi(f_angle), 100);
+	return true;
+}
+
 ut_declare_test_c(test_microbench_matrix, MicroBenchMatrix)
 
 } // namespace MicroBenchMatrix
@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_wq.cpp
+ * Tests for microbench work queue dispatch latency.
+ */
+
+#include <unit_test.h>
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+namespace MicroBenchWQ
+{
+
+/**
+ * Work item that records when it ran and signals the benchmark thread.
+ */
+class LatencyProbe : public px4::WorkItem
+{
+public:
+	LatencyProbe(const px4::wq_config_t &config) :
+		px4::WorkItem("microbench_wq", config)
+	{
+		px4_sem_init(&_done, 0, 0);
+	}
+
+	~LatencyProbe() override
+	{
+		px4_sem_destroy(&_done);
+	}
+
+	/**
+	 * Schedule the item and wait for it to run.
+	 * @return dispatch latency, or 0 if the item didn't run (queue not available)
+	 */
+	hrt_abstime measure()
+	{
+		struct timespec abstime;
+		px4_clock_gettime(CLOCK_REALTIME, &abstime);
+		abstime.tv_sec += 1;
+
+		_scheduled_time = hrt_absolute_time();
+		ScheduleNow();
+
+		if (px4_sem_timedwait(&_done, &abstime) != 0) {
+			return 0;
+		}
+
+		return _run_time - _scheduled_time;
+	}
+
+private:
+	void Run() override
+	{
+		_run_time = hrt_absolute_time();
+		px4_sem_post(&_done);
+	}
+
+	px4_sem_t _done;
+	hrt_abstime _scheduled_time{0};
+	hrt_abstime _run_time{0};
+};
+
+class MicroBenchWQ : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_wq_dispatch();
+
+	bool measure_queue(const char *name, const px4::wq_config_t &config);
+};
+
+bool MicroBenchWQ::run_tests()
+{
+	ut_run_test(time_wq_dispatch);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_wq, MicroBenchWQ)
+
+bool MicroBenchWQ::measure_queue(const char *name, const px4::wq_config_t &config)
+{
+	LatencyProbe probe(config);
+
+	perf_counter_t p = perf_alloc(PC_ELAPSED, name);
+
+	for (int i = 0; i < 100; i++) {
+		px4_usleep(100);
+		const hrt_abstime latency = probe.measure();
+
+		if (latency == 0) {
+			printf("skipping %s (item did not run)\n", name);
+			perf_free(p);
+			return true;
+		}
+
+		perf_set_elapsed(p, latency);
+	}
+
+	perf_print_counter(p);
+	perf_free(p);
+
+	return true;
+}
+
+bool MicroBenchWQ::time_wq_dispatch()
+{
+	// ScheduleNow() to Run() latency on an otherwise idle queue
+	bool ret = measure_queue("wq dispatch latency hp_default", px4::wq_configurations::hp_default);
+	ret = measure_queue("wq dispatch latency lp_default", px4::wq_configurations::lp_default) && ret;
+
+	return ret;
+}
+
+} // namespace MicroBenchWQ
@@ -161,7 +161,7 @@ $ reboot
 
 	PRINT_MODULE_USAGE_COMMAND_DESCR("set-default", "Set parameter default to a value");
 	PRINT_MODULE_USAGE_PARAM_FLAG('s', "If provided, silent errors if parameter doesn't exists", true);
-	PRINT_MODULE_USAGE_ARG("<param_name> <value>", "Parameter name and value to set", false);
+	PRINT_MODULE_USAGE_ARG("<param_name> <value> [<param2> <value2> ...]", "Parameter name/value pairs to set", false);
 	PRINT_MODULE_USAGE_ARG("fail", "If provided, let the command fail if param is not found", true);
 
 	PRINT_MODULE_USAGE_COMMAND_DESCR("compare", "Compare a param with a value. Command will succeed if equal");
@@ -328,16 +328,28 @@ param_main(int argc, char *argv[])
 		}
 
 		if (!strcmp(argv[1], "set-default")) {
-			if (argc >= 5 && !strcmp(argv[2], "-s")) {
-				return do_set_custom_default(argv[3], argv[4], true);
-
-			} else if (argc == 4) {
-				return do_set_custom_default(argv[2], argv[3]);
+			bool silent_fail = (argc >= 3) && !strcmp(argv[2], "-s");
+			int first = silent_fail ? 3 : 2;
 
-			} else {
-				PX4_ERR("not enough arguments.\nTry 'param set-default %s 3'", (argc > 2) ? argv[2] : "PARAM_NAME");
+			if ((argc < first + 2) || ((argc - first) % 2 != 0)) {
+				PX4_ERR("expected name/value pairs.\nTry 'param set-default %s 3'", (argc > 2) ? argv[2] : "PARAM_NAME");
 				return 1;
 			}
+
+			// multiple pairs per invocation: the ROMFS pruner coalesces
+			// consecutive set-default lines so that sourcing an airframe
+			// config spawns one command instead of one per parameter
+			int ret = 0;
+
+			for (int i = first; i < argc; i += 2) {
+				int pair_ret = do_set_custom_default(argv[i], argv[i + 1], silent_fail);
+
+				if (pair_ret != 0) {
+					ret = pair_ret;
+				}
+			}
+
+			return ret;
 		}
 
 		if (!strcmp(argv[1], "compare")) {
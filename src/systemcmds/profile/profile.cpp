@@ -0,0 +1,436 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file profile.cpp
+ *
+ * Statistical sampling profiler. Samples are aggregated on-device into a
+ * compact table of folded stacks and dumped in the format expected by
+ * flame-graph tooling (one "frame;frame;frame count" line per unique stack).
+ *
+ * On POSIX the sampling is driven by the profiling interval timer (SIGPROF),
+ * so whichever thread is consuming CPU time gets sampled and the full call
+ * stack is captured. On NuttX the sampling runs from the hrt interrupt and
+ * records the interrupted task plus its program counter, which can be
+ * resolved offline with addr2line.
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/defines.h>
+#include <drivers/drv_hrt.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__PX4_NUTTX)
+#include <nuttx/arch.h>
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+#else
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+#if defined(__PX4_NUTTX)
+static constexpr unsigned PROFILE_TABLE_SIZE = 256;	// power of two
+#else
+static constexpr unsigned PROFILE_TABLE_SIZE = 512;	// power of two
+static constexpr unsigned PROFILE_MAX_DEPTH = 16;
+// number of frames belonging to the signal handler itself, stripped from each sample
+static constexpr unsigned PROFILE_SKIP_FRAMES = 2;
+#endif
+
+struct profile_sample_s {
+#if defined(__PX4_NUTTX)
+	char		task_name[24];
+	uintptr_t	pc;
+#else
+	void		*frames[PROFILE_MAX_DEPTH];
+	uint8_t		depth;
+#endif
+	uint32_t	count;
+};
+
+static profile_sample_s *profile_table = nullptr;
+static volatile bool profile_running = false;
+static unsigned profile_freq_hz = 250;
+
+// statistics
+static uint32_t profile_num_samples = 0;
+static uint32_t profile_num_dropped = 0;	///< samples lost because the table was full
+
+#if defined(__PX4_NUTTX)
+static struct hrt_call profile_call;
+#endif
+
+static uint32_t profile_hash(const void *data, size_t len)
+{
+	// FNV-1a
+	const uint8_t *bytes = (const uint8_t *)data;
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ * Find the table entry for a sample, or a free slot to store it in.
+ * Runs in interrupt/signal context: linear probing, no allocation.
+ * @return nullptr if the table is full
+ */
+static profile_sample_s *profile_find_slot(uint32_t hash, const profile_sample_s &key)
+{
+	for (unsigned probe = 0; probe < 8; probe++) {
+		profile_sample_s &entry = profile_table[(hash + probe) & (PROFILE_TABLE_SIZE - 1)];
+
+		if (entry.count == 0) {
+			return &entry;
+		}
+
+#if defined(__PX4_NUTTX)
+
+		if (entry.pc == key.pc && strncmp(entry.task_name, key.task_name, sizeof(entry.task_name)) == 0) {
+			return &entry;
+		}
+
+#else
+
+		if (entry.depth == key.depth
+		    && memcmp(entry.frames, key.frames, key.depth * sizeof(void *)) == 0) {
+			return &entry;
+		}
+
+#endif
+	}
+
+	return nullptr;
+}
+
+#if defined(__PX4_NUTTX)
+
+static void profile_sample(void *arg)
+{
+	if (!profile_running) {
+		return;
+	}
+
+	profile_sample_s key {};
+
+	// the hrt callout interrupted whatever was running
+	struct tcb_s *tcb = (struct tcb_s *)sched_self();
+
+	if (tcb == nullptr) {
+		return;
+	}
+
+#if CONFIG_TASK_NAME_SIZE > 0
+	strncpy(key.task_name, tcb->name, sizeof(key.task_name) - 1);
+#endif
+
+#ifdef CURRENT_REGS
+
+	// program counter of the interrupted context
+	if (CURRENT_REGS != nullptr) {
+		key.pc = ((const uintptr_t *)CURRENT_REGS)[REG_PC];
+	}
+
+#endif
+
+	profile_sample_s *entry = profile_find_slot(
+					  profile_hash(&key, offsetof(profile_sample_s, count)), key);
+
+	if (entry == nullptr) {
+		profile_num_dropped++;
+		return;
+	}
+
+	if (entry->count == 0) {
+		*entry = key;
+	}
+
+	entry->count++;
+	profile_num_samples++;
+}
+
+static int profile_start()
+{
+	hrt_call_every(&profile_call, 1000000 / profile_freq_hz, 1000000 / profile_freq_hz,
+		       &profile_sample, nullptr);
+	return 0;
+}
+
+static void profile_stop()
+{
+	hrt_cancel(&profile_call);
+}
+
+static void profile_dump_entry(const profile_sample_s &entry)
+{
+	printf("%s;0x%08" PRIxPTR " %" PRIu32 "\n", entry.task_name, entry.pc, entry.count);
+}
+
+#else // POSIX
+
+static void profile_signal_handler(int sig)
+{
+	if (!profile_running) {
+		return;
+	}
+
+	profile_sample_s key {};
+	void *frames[PROFILE_MAX_DEPTH + PROFILE_SKIP_FRAMES];
+	const int depth = backtrace(frames, PROFILE_MAX_DEPTH + PROFILE_SKIP_FRAMES);
+
+	if (depth <= (int)PROFILE_SKIP_FRAMES) {
+		return;
+	}
+
+	key.depth = depth - PROFILE_SKIP_FRAMES;
+	memcpy(key.frames, frames + PROFILE_SKIP_FRAMES, key.depth * sizeof(void *));
+
+	profile_sample_s *entry = profile_find_slot(
+					  profile_hash(key.frames, key.depth * sizeof(void *)), key);
+
+	if (entry == nullptr) {
+		profile_num_dropped++;
+		return;
+	}
+
+	if (entry->count == 0) {
+		*entry = key;
+	}
+
+	entry->count++;
+	profile_num_samples++;
+}
+
+static int profile_start()
+{
+	// ensure backtrace's lazy initialization happens outside the signal handler
+	void *warmup[2];
+	backtrace(warmup, 2);
+
+	struct sigaction sa {};
+	sa.sa_handler = &profile_signal_handler;
+	sa.sa_flags = SA_RESTART;
+
+	if (sigaction(SIGPROF, &sa, nullptr) != 0) {
+		PX4_ERR("sigaction failed (%i)", errno);
+		return -1;
+	}
+
+	struct itimerval timer {};
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = 1000000 / profile_freq_hz;
+	timer.it_value = timer.it_interval;
+
+	if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+		PX4_ERR("setitimer failed (%i)", errno);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void profile_stop()
+{
+	struct itimerval timer {};
+	setitimer(ITIMER_PROF, &timer, nullptr);
+}
+
+static void profile_dump_entry(const profile_sample_s &entry)
+{
+	char **symbols = backtrace_symbols(entry.frames, entry.depth);
+
+	// folded stacks are printed root-first
+	for (int i = entry.depth - 1; i >= 0; i--) {
+		char frame_name[64];
+
+		if (symbols != nullptr) {
+			// extract the function name from "binary(function+0x12) [0x...]"
+			const char *start = strchr(symbols[i], '(');
+			const char *end = start ? strpbrk(start, "+)") : nullptr;
+
+			if (start != nullptr && end != nullptr && end - start > 1) {
+				snprintf(frame_name, sizeof(frame_name), "%.*s", (int)(end - start - 1), start + 1);
+
+			} else {
+				snprintf(frame_name, sizeof(frame_name), "%p", entry.frames[i]);
+			}
+
+		} else {
+			snprintf(frame_name, sizeof(frame_name), "%p", entry.frames[i]);
+		}
+
+		printf("%s%s", frame_name, (i > 0) ? ";" : "");
+	}
+
+	printf(" %" PRIu32 "\n", entry.count);
+	free(symbols);
+}
+
+#endif // POSIX
+
+static void print_usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Statistical sampling profiler. While running, it periodically samples which
+code is executing and aggregates the samples on-device into a table of folded
+stacks (full call stacks on POSIX, task name and program counter on NuttX).
+
+`profile dump` prints one `frame;frame;frame count` line per unique stack,
+which can be fed directly into flame-graph tooling (e.g. flamegraph.pl), also
+via the MAVLink shell. The overhead per sample is a backtrace capture and one
+hash table update, so the profiler can be left running in flight.
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME_SIMPLE("profile", "command");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("start", "Start sampling");
+	PRINT_MODULE_USAGE_PARAM_INT('f', 250, 10, 2000, "Sampling frequency in Hz", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("stop", "Stop sampling (keeps the samples)");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("dump", "Print folded stacks for flame-graph rendering");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print sample statistics");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("reset", "Discard all samples");
+}
+
+extern "C" __EXPORT int profile_main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		print_usage();
+		return -1;
+	}
+
+	if (strcmp(argv[1], "start") == 0) {
+		if (profile_running) {
+			PX4_INFO("already running");
+			return 0;
+		}
+
+		if (argc > 3 && strcmp(argv[2], "-f") == 0) {
+			const int freq = atoi(argv[3]);
+
+			if (freq < 10 || freq > 2000) {
+				PX4_ERR("invalid frequency %i", freq);
+				return -1;
+			}
+
+			profile_freq_hz = freq;
+		}
+
+		if (profile_table == nullptr) {
+			profile_table = (profile_sample_s *)calloc(PROFILE_TABLE_SIZE, sizeof(profile_sample_s));
+
+			if (profile_table == nullptr) {
+				PX4_ERR("table allocation failed");
+				return -1;
+			}
+		}
+
+		if (profile_start() != 0) {
+			return -1;
+		}
+
+		profile_running = true;
+		PX4_INFO("sampling at %u Hz", profile_freq_hz);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "stop") == 0) {
+		if (profile_running) {
+			profile_running = false;
+			profile_stop();
+		}
+
+		return 0;
+	}
+
+	if (strcmp(argv[1], "dump") == 0) {
+		if (profile_running) {
+			PX4_ERR("stop the profiler before dumping");
+			return -1;
+		}
+
+		if (profile_table != nullptr) {
+			for (unsigned i = 0; i < PROFILE_TABLE_SIZE; i++) {
+				if (profile_table[i].count > 0) {
+					profile_dump_entry(profile_table[i]);
+				}
+			}
+		}
+
+		fflush(stdout);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "status") == 0) {
+		unsigned used = 0;
+
+		if (profile_table != nullptr) {
+			for (unsigned i = 0; i < PROFILE_TABLE_SIZE; i++) {
+				if (profile_table[i].count > 0) {
+					used++;
+				}
+			}
+		}
+
+		PX4_INFO("%s, %" PRIu32 " samples, %u/%u unique stacks, %" PRIu32 " dropped",
+			 profile_running ? "running" : "stopped",
+			 profile_num_samples, used, PROFILE_TABLE_SIZE, profile_num_dropped);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "reset") == 0) {
+		if (profile_table != nullptr) {
+			memset(profile_table, 0, PROFILE_TABLE_SIZE * sizeof(profile_sample_s));
+		}
+
+		profile_num_samples = 0;
+		profile_num_dropped = 0;
+		return 0;
+	}
+
+	print_usage();
+	return -1;
+}
@@ -44,6 +44,7 @@ private:
 	bool constructTest();
 	bool setAllTest();
 	bool setRandomTest();
+	bool countFindTest();
 
 };
 
@@ -52,6 +53,7 @@ bool AtomicBitsetTest::run_tests()
 	ut_run_test(constructTest);
 	ut_run_test(setAllTest);
 	ut_run_test(setRandomTest);
+	ut_run_test(countFindTest);
 
 	return (_tests_failed == 0);
 }
@@ -173,3 +175,33 @@ bool AtomicBitsetTest::setRandomTest()
 
 	return true;
 }
+
+bool AtomicBitsetTest::countFindTest()
+{
+	px4::AtomicBitset<999> test_bitset4;
+
+	ut_compare("bitset count_before empty", test_bitset4.count_before(998), 0);
+	ut_compare("bitset find_nth_set empty", test_bitset4.find_nth_set(0), -1);
+
+	// set a few elements spread over multiple words, including word boundaries
+	const int set_array[] = { 0, 31, 32, 63, 64, 100, 500, 998 };
+	const int set_array_size = sizeof(set_array) / sizeof(set_array[0]);
+
+	for (auto x : set_array) {
+		test_bitset4.set(x, true);
+	}
+
+	// each set bit must be found at its used index, with the right number of
+	// set bits preceding it
+	for (int n = 0; n < set_array_size; n++) {
+		ut_compare("bitset find_nth_set", test_bitset4.find_nth_set(n), set_array[n]);
+		ut_compare("bitset count_before", test_bitset4.count_before(set_array[n]), n);
+	}
+
+	ut_compare("bitset find_nth_set out of range", test_bitset4.find_nth_set(set_array_size), -1);
+
+	// count_before of an unset position counts all set bits below it
+	ut_compare("bitset count_before unset position", test_bitset4.count_before(997), set_array_size - 1);
+
+	return true;
+}
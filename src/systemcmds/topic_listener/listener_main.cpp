@@ -53,8 +53,12 @@ extern "C" __EXPORT int listener_main(int argc, char *argv[]);
 static void usage();
 
 void listener(const orb_id_t &id, unsigned num_msgs, int topic_instance,
-	      unsigned topic_interval)
+	      unsigned topic_interval, bool binary_output)
 {
+	if (binary_output) {
+		// single text header describing the stream, then back-to-back raw structs
+		PX4_INFO_RAW("BINARY %s %i %s\n", id->o_name, id->o_size, id->o_fields);
+	}
 
 	if (topic_instance == -1 && num_msgs == 1) {
 		// first count the number of instances
@@ -139,9 +143,11 @@ void listener(const orb_id_t &id, unsigned num_msgs, int topic_instance,
 				if (fds[1].revents & POLLIN) {
 					msgs_received++;
 
-					PX4_INFO_RAW("\nTOPIC: %s instance %d #%d\n", id->o_name, topic_instance, msgs_received);
+					if (!binary_output) {
+						PX4_INFO_RAW("\nTOPIC: %s instance %d #%d\n", id->o_name, topic_instance, msgs_received);
+					}
 
-					int ret = listener_print_topic(id, sub);
+					int ret = listener_print_topic(id, sub, binary_output);
 
 					if (ret != PX4_OK) {
 						PX4_ERR("listener callback failed (%i)", ret);
@@ -172,12 +178,13 @@ int listener_main(int argc, char *argv[])
 	int topic_instance = -1;
 	unsigned topic_rate = 0;
 	unsigned num_msgs = 0;
+	bool binary_output = false;
 
 	int myoptind = 1;
 	int ch;
 	const char *myoptarg = nullptr;
 
-	while ((ch = px4_getopt(argc, argv, "i:r:n:", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "i:r:n:b", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 
 		case 'i':
@@ -192,6 +199,10 @@ int listener_main(int argc, char *argv[])
 			num_msgs = strtol(myoptarg, nullptr, 0);
 			break;
 
+		case 'b':
+			binary_output = true;
+			break;
+
 		default:
 			usage();
 			return -1;
@@ -225,7 +236,7 @@ int listener_main(int argc, char *argv[])
 	}
 
 	if (found_topic) {
-		listener(found_topic, num_msgs, topic_instance, topic_interval);
+		listener(found_topic, num_msgs, topic_instance, topic_interval, binary_output);
 
 	} else {
 		PX4_INFO_RAW("Topic %s did not match any known topics\n", topic_name);
@@ -252,4 +263,5 @@ The listener can be exited any time by pressing Ctrl+C, Esc, or Q.
 	PRINT_MODULE_USAGE_PARAM_INT('i', 0, 0, ORB_MULTI_MAX_INSTANCES - 1, "Topic instance", true);
 	PRINT_MODULE_USAGE_PARAM_INT('n', 1, 0, 100, "Number of messages", true);
 	PRINT_MODULE_USAGE_PARAM_INT('r', 0, 0, 1000, "Subscription rate (unlimited if 0)", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('b', "Binary output (raw structs, formatting deferred to the host)", true);
 }
@@ -44,13 +44,14 @@
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/log.h>
 #include <uORB/uORB.h>
+#include <uORB/topics/uORBTopics.hpp>
 #include <string.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
 
-inline int listener_print_topic(const orb_id_t &orb_id, int subscription)
+inline int listener_print_topic(const orb_id_t &orb_id, int subscription, bool binary_output = false)
 {
 	static constexpr int max_size = 512;
 	alignas(8) char container[max_size];
@@ -63,11 +64,19 @@ inline int listener_print_topic(const orb_id_t &orb_id, int subscription)
 	int ret = orb_copy(orb_id, subscription, &container);
 
 	if (ret == PX4_OK) {
-		orb_print_message_internal(orb_id, &container, true);
+		if (binary_output) {
+			// defer all formatting to the host, just stream the raw struct
+			fwrite(container, orb_id->o_size, 1, stdout);
+			fflush(stdout);
+
+		} else {
+			// dispatches to the print routine generated for the message type
+			orb_print_message(orb_id, &container);
+		}
 	}
 
 	return ret;
 }
 
 void listener(const orb_id_t &id, unsigned num_msgs, int topic_instance,
-	      unsigned topic_interval);
+	      unsigned topic_interval, bool binary_output);
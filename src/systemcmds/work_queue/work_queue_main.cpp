@@ -35,6 +35,13 @@
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/getopt.h>
 #include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
+#include <px4_platform_common/px4_work_queue/WorkQueue.hpp>
+#include <px4_platform_common/time.h>
+#include <drivers/drv_hrt.h>
+#include <uORB/Publication.hpp>
+#include <uORB/topics/work_queue_status.h>
+
+using namespace time_literals;
 
 static void	usage();
 
@@ -45,6 +52,54 @@ extern "C" {
 int
 work_queue_main(int argc, char *argv[])
 {
+	if (argc < 2) {
+		usage();
+		return 1;
+	}
+
+	if (!strcmp(argv[1], "top")) {
+		// trace scheduling latency and run durations for one second, then report
+		px4::WorkQueueManagerForEach([](px4::WorkQueue *wq, void *) { wq->reset_trace_statistics(); }, nullptr);
+		px4::WorkQueue::set_latency_tracing(true);
+
+		px4_usleep(1_s);
+
+		px4::WorkQueueManagerStatus();
+
+		uORB::Publication<work_queue_status_s> status_pub{ORB_ID(work_queue_status)};
+		status_pub.advertise();
+
+		px4::WorkQueueManagerForEach([](px4::WorkQueue *wq, void *context) {
+			auto *pub = static_cast<uORB::Publication<work_queue_status_s> *>(context);
+
+			work_queue_status_s status{};
+			strncpy((char *)status.name, wq->get_name(), sizeof(status.name) - 1);
+			status.run_count = wq->traced_run_count();
+			status.latency_mean_us = wq->latency_mean_us();
+			status.latency_max_us = wq->latency_max_us();
+			memcpy(status.run_duration_hist, wq->run_duration_histogram(), sizeof(status.run_duration_hist));
+			status.timestamp = hrt_absolute_time();
+			pub->publish(status);
+		}, &status_pub);
+
+		px4::WorkQueue::set_latency_tracing(false);
+		return 0;
+	}
+
+	if (!strcmp(argv[1], "steal")) {
+		if ((argc == 3) && !strcmp(argv[2], "on")) {
+			px4::WorkQueue::set_work_stealing_enabled(true);
+			return 0;
+
+		} else if ((argc == 3) && !strcmp(argv[2], "off")) {
+			px4::WorkQueue::set_work_stealing_enabled(false);
+			return 0;
+		}
+
+		PX4_INFO("work stealing %s", px4::WorkQueue::work_stealing_enabled() ? "enabled" : "disabled");
+		return 0;
+	}
+
 	if (argc != 2) {
 		usage();
 		return 1;
@@ -82,5 +137,7 @@ Command-line tool to show work queue status.
 
 	PRINT_MODULE_USAGE_NAME("work_queue", "system");
 	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("top", "Trace scheduling latency for 1s and print/publish per-queue statistics");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("steal", "Enable/disable work stealing by idle wq threads (on|off)");
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
 }